@@ -0,0 +1,866 @@
+/*
+ * AssetManager.cpp - UI资源包管理器实现文件
+ * ESP32S3监控项目 - 运行时资源加载模块
+ */
+
+#include "AssetManager.h"
+#include "FileManager.h"
+#include "PSRAMManager.h"
+#include "RLEImageDecoder.h"
+#include "ui.h"
+#include "ui2.h"
+#include "esp_rom_crc.h"
+#include <esp_timer.h>
+#include <string.h>
+
+/**
+ * @brief 被替换的对象属性
+ */
+enum {
+    BIND_IMG_SRC = 0,       // lv_img的图片源
+    BIND_BG_IMG_MAIN,       // 主体背景图
+    BIND_BG_IMG_INDICATOR,  // 指示器背景图（进度条等）
+    BIND_TEXT_FONT          // 文字字体
+};
+
+/**
+ * @brief LVGL文件系统驱动打开的文件
+ *
+ * 资源包内的条目映射为文件中的一个窗口，普通文件的窗口即整个文件
+ */
+typedef struct {
+    File file;
+    uint32_t base;  // 窗口起点
+    uint32_t size;  // 窗口大小
+    uint32_t pos;   // 窗口内的读取位置
+} asset_fs_file_t;
+
+// 可被资源包替换的内置图片（名称与ui.h/ui2.h中的变量名一致）
+static const struct {
+    const char* name;
+    const lv_img_dsc_t* img;
+} builtin_images[] = {
+    {"ui_img_52731097", &ui_img_52731097},
+    {"ui_img_411710101", &ui_img_411710101},
+    {"ui_img_334752297", &ui_img_334752297},
+    {"ui_img_888914300", &ui_img_888914300},
+    {"ui_img_919862230", &ui_img_919862230},
+    {"ui_img_934861631", &ui_img_934861631},
+    {"ui2_img_1985331572", &ui2_img_1985331572},
+};
+
+// 可被资源包替换的内置字体
+// 只用于按名称查找资源包替换，不显示文本：font_subsetter.py跳过标记之间对字体的引用
+// font_subsetter: skip-begin
+static const struct {
+    const char* name;
+    const lv_font_t* font;
+} builtin_fonts[] = {
+    {"ui_font_daoli24zhong", &ui_font_daoli24zhong},
+    {"ui_font_daoli26zhong", &ui_font_daoli26zhong},
+    {"ui_font_DaoLit36zhong", &ui_font_DaoLit36zhong},
+    {"ui_font_DaoLit36zhong3", &ui_font_DaoLit36zhong3},
+    {"ui_font_DaoLiti30", &ui_font_DaoLiti30},
+    {"ui_font_DaoLiti36", &ui_font_DaoLiti36},
+    {"ui_font_DaoLiti72", &ui_font_DaoLiti72},
+    {"ui2_font_ShuHei14", &ui2_font_ShuHei14},
+    {"ui2_font_ShuHei26", &ui2_font_ShuHei26},
+    {"ui2_font_ShuHei30", &ui2_font_ShuHei30},
+    {"ui2_font_ShuHei36", &ui2_font_ShuHei36},
+    {"ui2_font_ShuHei72", &ui2_font_ShuHei72},
+};
+// font_subsetter: skip-end
+
+/**
+ * @brief 查找内置资源的名称，不是内置资源时返回nullptr
+ */
+static const char* builtinName(const void* ptr, uint8_t type) {
+    if (!ptr) {
+        return nullptr;
+    }
+
+    if (type == ASSET_TYPE_IMAGE) {
+        for (size_t i = 0; i < sizeof(builtin_images) / sizeof(builtin_images[0]); i++) {
+            if (builtin_images[i].img == ptr) {
+                return builtin_images[i].name;
+            }
+        }
+    } else {
+        for (size_t i = 0; i < sizeof(builtin_fonts) / sizeof(builtin_fonts[0]); i++) {
+            if (builtin_fonts[i].font == ptr) {
+                return builtin_fonts[i].name;
+            }
+        }
+    }
+    return nullptr;
+}
+
+/**
+ * @brief 设置对象属性的资源
+ */
+static void applyProperty(lv_obj_t* obj, uint8_t kind, const void* value) {
+    switch (kind) {
+        case BIND_IMG_SRC:
+            lv_img_set_src(obj, value);
+            break;
+        case BIND_BG_IMG_MAIN:
+            lv_obj_set_style_bg_img_src(obj, value, LV_PART_MAIN | LV_STATE_DEFAULT);
+            break;
+        case BIND_BG_IMG_INDICATOR:
+            lv_obj_set_style_bg_img_src(obj, value, LV_PART_INDICATOR | LV_STATE_DEFAULT);
+            break;
+        case BIND_TEXT_FONT:
+            lv_obj_set_style_text_font(obj, (const lv_font_t*)value, LV_PART_MAIN | LV_STATE_DEFAULT);
+            break;
+    }
+}
+
+AssetManager::AssetManager()
+    : m_fileManager(nullptr)
+    , m_psramManager(nullptr)
+    , m_initialized(false)
+    , m_bindingCount(0)
+    , m_cacheBudget(ASSET_CACHE_MAX_BYTES)
+    , m_cacheBytes(0)
+    , m_useCounter(0)
+{
+    memset(&m_fsDrv, 0, sizeof(m_fsDrv));
+    memset(m_cache, 0, sizeof(m_cache));
+    memset(m_bindings, 0, sizeof(m_bindings));
+    resetStats();
+}
+
+AssetManager::~AssetManager() {
+    if (m_initialized) {
+        unbindAll();
+        clearCache();
+    }
+}
+
+/**
+ * @brief 初始化并注册LVGL文件系统驱动
+ */
+bool AssetManager::init(FileManager* fileManager, PSRAMManager* psramManager) {
+    if (m_initialized) {
+        return true;
+    }
+
+    if (!fileManager || !psramManager) {
+        printf("[AssetManager] 错误：无效的依赖参数\n");
+        return false;
+    }
+
+    if (!fileManager->isReady()) {
+        printf("[AssetManager] 错误：文件系统未初始化\n");
+        return false;
+    }
+
+    m_fileManager = fileManager;
+    m_psramManager = psramManager;
+
+    lv_fs_drv_init(&m_fsDrv);
+    m_fsDrv.letter = ASSET_FS_LETTER;
+    m_fsDrv.open_cb = fsOpenCb;
+    m_fsDrv.close_cb = fsCloseCb;
+    m_fsDrv.read_cb = fsReadCb;
+    m_fsDrv.seek_cb = fsSeekCb;
+    m_fsDrv.tell_cb = fsTellCb;
+    m_fsDrv.user_data = this;
+    lv_fs_drv_register(&m_fsDrv);
+
+    m_initialized = true;
+    printf("[AssetManager] 资源包管理器已初始化（文件系统盘符%c:，缓存上限%u KB）\n",
+           ASSET_FS_LETTER, (unsigned)(m_cacheBudget / 1024));
+    return true;
+}
+
+// === LVGL文件系统驱动 ===
+
+void* AssetManager::fsOpenCb(lv_fs_drv_t* drv, const char* path, lv_fs_mode_t mode) {
+    AssetManager* self = (AssetManager*)drv->user_data;
+
+    // 资源只读，写入请使用FileManager
+    if (mode != LV_FS_MODE_RD) {
+        return nullptr;
+    }
+
+    String fullPath = path;
+    if (!fullPath.startsWith("/")) {
+        fullPath = "/" + fullPath;
+    }
+
+    String filePath = fullPath;
+    const asset_pack_entry_t* entry = nullptr;
+
+    if (!self->m_fileManager->exists(fullPath)) {
+        // 资源包内的条目："/资源包路径/条目名"
+        int slash = fullPath.lastIndexOf('/');
+        if (slash <= 0 || self->m_packPath.length() == 0 || fullPath.substring(0, slash) != self->m_packPath) {
+            return nullptr;
+        }
+
+        entry = self->findPackEntry(fullPath.c_str() + slash + 1, 0);
+        if (!entry) {
+            return nullptr;
+        }
+        filePath = self->m_packPath;
+    }
+
+    asset_fs_file_t* f = new asset_fs_file_t();
+    f->file = self->m_fileManager->openFile(filePath, FILE_READ);
+    if (!f->file) {
+        delete f;
+        return nullptr;
+    }
+
+    f->base = entry ? entry->offset : 0;
+    f->size = entry ? entry->size : f->file.size();
+    f->pos = 0;
+
+    if (f->base + f->size > f->file.size() || !f->file.seek(f->base)) {
+        f->file.close();
+        delete f;
+        return nullptr;
+    }
+
+    return f;
+}
+
+lv_fs_res_t AssetManager::fsCloseCb(lv_fs_drv_t* drv, void* file_p) {
+    LV_UNUSED(drv);
+
+    asset_fs_file_t* f = (asset_fs_file_t*)file_p;
+    f->file.close();
+    delete f;
+    return LV_FS_RES_OK;
+}
+
+lv_fs_res_t AssetManager::fsReadCb(lv_fs_drv_t* drv, void* file_p, void* buf, uint32_t btr, uint32_t* br) {
+    LV_UNUSED(drv);
+
+    asset_fs_file_t* f = (asset_fs_file_t*)file_p;
+    if (btr > f->size - f->pos) {
+        btr = f->size - f->pos;
+    }
+
+    *br = btr ? f->file.read((uint8_t*)buf, btr) : 0;
+    f->pos += *br;
+    return (*br == btr) ? LV_FS_RES_OK : LV_FS_RES_HW_ERR;
+}
+
+lv_fs_res_t AssetManager::fsSeekCb(lv_fs_drv_t* drv, void* file_p, uint32_t pos, lv_fs_whence_t whence) {
+    LV_UNUSED(drv);
+
+    asset_fs_file_t* f = (asset_fs_file_t*)file_p;
+    uint32_t target;
+    switch (whence) {
+        case LV_FS_SEEK_SET: target = pos; break;
+        case LV_FS_SEEK_CUR: target = f->pos + pos; break;
+        case LV_FS_SEEK_END: target = f->size + pos; break;
+        default: return LV_FS_RES_INV_PARAM;
+    }
+
+    if (target > f->size) {
+        return LV_FS_RES_INV_PARAM;
+    }
+
+    if (!f->file.seek(f->base + target)) {
+        return LV_FS_RES_HW_ERR;
+    }
+
+    f->pos = target;
+    return LV_FS_RES_OK;
+}
+
+lv_fs_res_t AssetManager::fsTellCb(lv_fs_drv_t* drv, void* file_p, uint32_t* pos_p) {
+    LV_UNUSED(drv);
+
+    *pos_p = ((asset_fs_file_t*)file_p)->pos;
+    return LV_FS_RES_OK;
+}
+
+// === 资源包 ===
+
+/**
+ * @brief 读取资源包条目表
+ */
+bool AssetManager::loadPackIndex(const String& path) {
+    String fsPath = String(ASSET_FS_LETTER) + ":" + path;
+    lv_fs_file_t file;
+    if (lv_fs_open(&file, fsPath.c_str(), LV_FS_MODE_RD) != LV_FS_RES_OK) {
+        printf("[AssetManager] 错误：无法打开资源包 %s\n", path.c_str());
+        return false;
+    }
+
+    asset_pack_header_t header;
+    uint32_t br = 0;
+    bool ok = lv_fs_read(&file, &header, sizeof(header), &br) == LV_FS_RES_OK && br == sizeof(header)
+              && memcmp(header.magic, ASSET_PACK_MAGIC, 4) == 0
+              && header.version == ASSET_PACK_VERSION
+              && header.entry_count <= ASSET_PACK_MAX_ENTRIES;
+
+    if (ok) {
+        uint32_t table_size = header.entry_count * sizeof(asset_pack_entry_t);
+        m_packEntries.resize(header.entry_count);
+        ok = lv_fs_read(&file, m_packEntries.data(), table_size, &br) == LV_FS_RES_OK && br == table_size;
+    }
+    lv_fs_close(&file);
+
+    if (!ok) {
+        printf("[AssetManager] 错误：%s 不是有效的资源包（需要asset_packer.py生成的版本%d格式）\n",
+               path.c_str(), ASSET_PACK_VERSION);
+        m_packEntries.clear();
+        return false;
+    }
+
+    size_t file_size = m_fileManager->getFileSize(path);
+    for (auto& entry : m_packEntries) {
+        entry.name[ASSET_NAME_LEN - 1] = '\0';
+        if ((uint64_t)entry.offset + entry.size > file_size) {
+            printf("[AssetManager] 错误：资源包条目 %s 超出文件范围\n", entry.name);
+            m_packEntries.clear();
+            return false;
+        }
+    }
+
+    printf("[AssetManager] 已加载资源包 %s（%u个条目，%u KB）\n",
+           path.c_str(), (unsigned)m_packEntries.size(), (unsigned)(file_size / 1024));
+    return true;
+}
+
+/**
+ * @brief 按名称和类型查找资源包条目（type为0时不限类型）
+ */
+const asset_pack_entry_t* AssetManager::findPackEntry(const char* name, uint8_t type) const {
+    for (const auto& entry : m_packEntries) {
+        if ((type == 0 || entry.type == type) && strcmp(entry.name, name) == 0) {
+            return &entry;
+        }
+    }
+    return nullptr;
+}
+
+/**
+ * @brief 切换资源包
+ */
+bool AssetManager::setActivePack(const String& path) {
+    if (!m_initialized) {
+        return false;
+    }
+
+    // 还原所有屏幕后，旧资源包的缓存全部失效
+    unbindAll();
+    clearCache();
+    m_packEntries.clear();
+    m_packPath = "";
+
+    if (path.length() == 0) {
+        printf("[AssetManager] 已切换为内置资源\n");
+        return true;
+    }
+
+    String packPath = m_fileManager->sanitizePath(path);
+    if (!loadPackIndex(packPath)) {
+        return false;
+    }
+
+    m_packPath = packPath;
+
+    lv_obj_t* screen = lv_scr_act();
+    if (screen) {
+        bindScreen(screen);
+    }
+    return true;
+}
+
+String AssetManager::getActivePack() const {
+    return m_packPath;
+}
+
+int AssetManager::getPackEntryCount() const {
+    return (int)m_packEntries.size();
+}
+
+// === PSRAM LRU缓存 ===
+
+/**
+ * @brief 获取资源并增加引用
+ */
+int AssetManager::acquire(const char* name, uint8_t type, uint32_t* hits, uint32_t* misses) {
+    for (int i = 0; i < ASSET_CACHE_MAX_ENTRIES; i++) {
+        CacheEntry* slot = &m_cache[i];
+        if (slot->used && slot->type == type && strcmp(slot->name, name) == 0) {
+            slot->pins++;
+            slot->last_used = ++m_useCounter;
+            m_hits++;
+            (*hits)++;
+            return i;
+        }
+    }
+
+    const asset_pack_entry_t* entry = findPackEntry(name, type);
+    if (!entry) {
+        return -1;  // 资源包未提供，继续使用内置资源
+    }
+
+    m_misses++;
+    (*misses)++;
+
+    size_t bytes = entry->size;
+    if (type == ASSET_TYPE_IMAGE) {
+        size_t pixel_size = entry->format == ASSET_IMG_TRUE_COLOR_ALPHA ? LV_IMG_PX_SIZE_ALPHA_BYTE : sizeof(lv_color_t);
+        bytes = (size_t)entry->width * entry->height * pixel_size;
+    }
+
+    int index = makeRoom(bytes);
+    if (index < 0) {
+        printf("[AssetManager] 警告：缓存已满（显示中的资源占用%u KB），%s 使用内置资源\n",
+               (unsigned)(m_cacheBytes / 1024), name);
+        m_loadFailures++;
+        return -1;
+    }
+
+    CacheEntry* slot = &m_cache[index];
+    int64_t start_us = esp_timer_get_time();
+    if (!loadEntry(entry, slot)) {
+        m_loadFailures++;
+        return -1;
+    }
+    uint32_t load_us = (uint32_t)(esp_timer_get_time() - start_us);
+    m_loadUsTotal += load_us;
+
+    slot->used = true;
+    slot->type = type;
+    strncpy(slot->name, name, ASSET_NAME_LEN - 1);
+    slot->name[ASSET_NAME_LEN - 1] = '\0';
+    slot->pins = 1;
+    slot->last_used = ++m_useCounter;
+    m_cacheBytes += slot->bytes;
+
+    printf("[AssetManager] 已加载 %s（%u KB，耗时%lu us）\n",
+           name, (unsigned)(slot->bytes / 1024), (unsigned long)load_us);
+    return index;
+}
+
+/**
+ * @brief 释放资源引用
+ */
+void AssetManager::release(int index) {
+    if (index >= 0 && index < ASSET_CACHE_MAX_ENTRIES && m_cache[index].pins > 0) {
+        m_cache[index].pins--;
+    }
+}
+
+/**
+ * @brief 从资源包加载一个条目到缓存项
+ */
+bool AssetManager::loadEntry(const asset_pack_entry_t* entry, CacheEntry* slot) {
+    String fsPath = String(ASSET_FS_LETTER) + ":" + m_packPath + "/" + entry->name;
+
+    if (entry->type == ASSET_TYPE_FONT) {
+        // lv_font_load通过文件系统驱动按窗口读取资源包中的字体
+        lv_font_t* font = lv_font_load(fsPath.c_str());
+        if (!font) {
+            printf("[AssetManager] 错误：字体 %s 加载失败\n", entry->name);
+            return false;
+        }
+        slot->font = font;
+        slot->bytes = entry->size;
+        return true;
+    }
+
+    size_t pixel_size = entry->format == ASSET_IMG_TRUE_COLOR_ALPHA ? LV_IMG_PX_SIZE_ALPHA_BYTE : sizeof(lv_color_t);
+    size_t bytes = (size_t)entry->width * entry->height * pixel_size;
+    if (entry->format > ASSET_IMG_RLE || (entry->format != ASSET_IMG_RLE && entry->size != bytes)) {
+        printf("[AssetManager] 错误：图片 %s 格式或大小无效\n", entry->name);
+        return false;
+    }
+
+    uint8_t* raw = (uint8_t*)m_psramManager->allocate(entry->size, "资源包读取", POOL_BUFFER);
+    if (!raw) {
+        printf("[AssetManager] 错误：PSRAM不足，无法读取 %s\n", entry->name);
+        return false;
+    }
+
+    lv_fs_file_t file;
+    uint32_t br = 0;
+    bool ok = lv_fs_open(&file, fsPath.c_str(), LV_FS_MODE_RD) == LV_FS_RES_OK;
+    if (ok) {
+        ok = lv_fs_read(&file, raw, entry->size, &br) == LV_FS_RES_OK && br == entry->size;
+        lv_fs_close(&file);
+    }
+
+    if (!ok || esp_rom_crc32_le(0, raw, entry->size) != entry->crc32) {
+        printf("[AssetManager] 错误：图片 %s 读取失败或校验错误\n", entry->name);
+        m_psramManager->deallocate(raw);
+        return false;
+    }
+
+    uint8_t* pixels = raw;
+    if (entry->format == ASSET_IMG_RLE) {
+        pixels = (uint8_t*)m_psramManager->allocate(bytes, "资源包图片", POOL_GRAPHICS);
+
+        lv_img_dsc_t encoded;
+        memset(&encoded, 0, sizeof(encoded));
+        encoded.header.cf = LV_IMG_CF_USER_ENCODED_0;
+        encoded.header.w = entry->width;
+        encoded.header.h = entry->height;
+        encoded.data_size = entry->size;
+        encoded.data = raw;
+
+        ok = pixels && RLEImageDecoder::decode(&encoded, pixels);
+        m_psramManager->deallocate(raw);
+        if (!ok) {
+            printf("[AssetManager] 错误：图片 %s 解码失败\n", entry->name);
+            if (pixels) {
+                m_psramManager->deallocate(pixels);
+            }
+            return false;
+        }
+    }
+
+    memset(&slot->img, 0, sizeof(slot->img));
+    slot->img.header.always_zero = 0;
+    slot->img.header.w = entry->width;
+    slot->img.header.h = entry->height;
+    slot->img.header.cf = entry->format == ASSET_IMG_TRUE_COLOR_ALPHA ? LV_IMG_CF_TRUE_COLOR_ALPHA : LV_IMG_CF_TRUE_COLOR;
+    slot->img.data_size = bytes;
+    slot->img.data = pixels;
+    slot->font = nullptr;
+    slot->bytes = bytes;
+    return true;
+}
+
+/**
+ * @brief 释放缓存项占用的内存
+ */
+void AssetManager::freeEntry(CacheEntry* slot) {
+    if (!slot->used) {
+        return;
+    }
+
+    if (slot->type == ASSET_TYPE_IMAGE) {
+        // LVGL图片缓存以描述符地址为键，缓存项复用前必须失效
+        lv_img_cache_invalidate_src(&slot->img);
+        m_psramManager->deallocate((void*)slot->img.data);
+    } else if (slot->font) {
+        lv_font_free(slot->font);
+    }
+
+    m_cacheBytes -= slot->bytes;
+    memset(slot, 0, sizeof(CacheEntry));
+}
+
+/**
+ * @brief 按LRU淘汰未使用的资源
+ */
+int AssetManager::makeRoom(size_t bytes) {
+    while (true) {
+        int free_index = -1;
+        int lru_index = -1;
+        for (int i = 0; i < ASSET_CACHE_MAX_ENTRIES; i++) {
+            if (!m_cache[i].used) {
+                if (free_index < 0) {
+                    free_index = i;
+                }
+            } else if (m_cache[i].pins == 0 &&
+                       (lru_index < 0 || m_cache[i].last_used < m_cache[lru_index].last_used)) {
+                lru_index = i;
+            }
+        }
+
+        if (free_index >= 0 && m_cacheBytes + bytes <= m_cacheBudget) {
+            return free_index;
+        }
+
+        if (lru_index < 0) {
+            return -1;  // 剩余资源都在显示中
+        }
+
+        printf("[AssetManager] 淘汰 %s（%u KB）\n", m_cache[lru_index].name, (unsigned)(m_cache[lru_index].bytes / 1024));
+        freeEntry(&m_cache[lru_index]);
+        m_evictions++;
+    }
+}
+
+/**
+ * @brief 设置缓存容量上限
+ */
+void AssetManager::setCacheBudget(size_t bytes) {
+    m_cacheBudget = bytes;
+
+    // 只淘汰，不腾出新的缓存项
+    while (m_cacheBytes > m_cacheBudget) {
+        int lru_index = -1;
+        for (int i = 0; i < ASSET_CACHE_MAX_ENTRIES; i++) {
+            if (m_cache[i].used && m_cache[i].pins == 0 &&
+                (lru_index < 0 || m_cache[i].last_used < m_cache[lru_index].last_used)) {
+                lru_index = i;
+            }
+        }
+        if (lru_index < 0) {
+            break;
+        }
+        freeEntry(&m_cache[lru_index]);
+        m_evictions++;
+    }
+
+    printf("[AssetManager] 缓存上限设置为%u KB（当前占用%u KB）\n",
+           (unsigned)(m_cacheBudget / 1024), (unsigned)(m_cacheBytes / 1024));
+}
+
+/**
+ * @brief 释放缓存中所有未在显示的资源
+ */
+void AssetManager::clearCache() {
+    for (int i = 0; i < ASSET_CACHE_MAX_ENTRIES; i++) {
+        if (m_cache[i].used && m_cache[i].pins == 0) {
+            freeEntry(&m_cache[i]);
+        }
+    }
+}
+
+/**
+ * @brief 按LRU释放未在显示的资源
+ */
+size_t AssetManager::trimCache(size_t bytes) {
+    size_t freed = 0;
+    while (freed < bytes) {
+        int lru_index = -1;
+        for (int i = 0; i < ASSET_CACHE_MAX_ENTRIES; i++) {
+            if (m_cache[i].used && m_cache[i].pins == 0 &&
+                (lru_index < 0 || m_cache[i].last_used < m_cache[lru_index].last_used)) {
+                lru_index = i;
+            }
+        }
+        if (lru_index < 0) {
+            break;
+        }
+        freed += m_cache[lru_index].bytes;
+        freeEntry(&m_cache[lru_index]);
+        m_evictions++;
+    }
+    return freed;
+}
+
+// === 屏幕资源替换 ===
+
+/**
+ * @brief 为所有屏幕注册加载/卸载事件
+ */
+void AssetManager::attachScreens() {
+    if (!m_initialized) {
+        return;
+    }
+
+    lv_disp_t* disp = lv_disp_get_default();
+    if (!disp) {
+        return;
+    }
+
+    for (uint32_t i = 0; i < disp->screen_cnt; i++) {
+        lv_obj_t* screen = disp->screens[i];
+        lv_obj_remove_event_cb(screen, screenEventCb);
+        lv_obj_add_event_cb(screen, screenEventCb, LV_EVENT_ALL, this);
+    }
+
+    lv_obj_t* active = lv_scr_act();
+    if (active) {
+        bindScreen(active);
+    }
+}
+
+void AssetManager::screenEventCb(lv_event_t* e) {
+    AssetManager* self = (AssetManager*)lv_event_get_user_data(e);
+    lv_obj_t* screen = lv_event_get_target(e);
+
+    switch (lv_event_get_code(e)) {
+        case LV_EVENT_SCREEN_LOAD_START:
+            self->bindScreen(screen);
+            break;
+        case LV_EVENT_SCREEN_UNLOADED:
+            self->unbindScreen(screen, true);
+            break;
+        case LV_EVENT_DELETE:
+            self->unbindScreen(screen, false);
+            break;
+        default:
+            break;
+    }
+}
+
+bool AssetManager::isScreenBound(lv_obj_t* screen) const {
+    for (int i = 0; i < m_bindingCount; i++) {
+        if (m_bindings[i].screen == screen) {
+            return true;
+        }
+    }
+    return false;
+}
+
+/**
+ * @brief 把屏幕上的内置资源替换为资源包资源
+ */
+void AssetManager::bindScreen(lv_obj_t* screen) {
+    if (m_packEntries.empty() || isScreenBound(screen)) {
+        return;
+    }
+
+    int64_t start_us = esp_timer_get_time();
+    uint32_t hits = 0;
+    uint32_t misses = 0;
+    bindObject(screen, screen, &hits, &misses);
+
+    if (hits + misses == 0) {
+        return;  // 屏幕上没有资源包提供的资源
+    }
+
+    uint32_t elapsed_us = (uint32_t)(esp_timer_get_time() - start_us);
+    m_bindCount++;
+    m_lastBindUs = elapsed_us;
+    m_lastBindHits = hits;
+    m_lastBindMisses = misses;
+    if (misses) {
+        m_missBindCount++;
+        m_missBindUsTotal += elapsed_us;
+    } else {
+        m_hitBindCount++;
+        m_hitBindUsTotal += elapsed_us;
+    }
+}
+
+/**
+ * @brief 递归替换对象及其子对象的资源
+ */
+void AssetManager::bindObject(lv_obj_t* obj, lv_obj_t* screen, uint32_t* hits, uint32_t* misses) {
+    if (lv_obj_check_type(obj, &lv_img_class)) {
+        bindProperty(obj, screen, BIND_IMG_SRC, lv_img_get_src(obj), hits, misses);
+    }
+
+    // 只检查对象本地样式，主题和继承的样式不替换
+    lv_style_value_t value;
+    if (lv_obj_get_local_style_prop(obj, LV_STYLE_BG_IMG_SRC, &value, LV_PART_MAIN | LV_STATE_DEFAULT) == LV_RES_OK) {
+        bindProperty(obj, screen, BIND_BG_IMG_MAIN, value.ptr, hits, misses);
+    }
+    if (lv_obj_get_local_style_prop(obj, LV_STYLE_BG_IMG_SRC, &value, LV_PART_INDICATOR | LV_STATE_DEFAULT) == LV_RES_OK) {
+        bindProperty(obj, screen, BIND_BG_IMG_INDICATOR, value.ptr, hits, misses);
+    }
+    if (lv_obj_get_local_style_prop(obj, LV_STYLE_TEXT_FONT, &value, LV_PART_MAIN | LV_STATE_DEFAULT) == LV_RES_OK) {
+        bindProperty(obj, screen, BIND_TEXT_FONT, value.ptr, hits, misses);
+    }
+
+    uint32_t child_cnt = lv_obj_get_child_cnt(obj);
+    for (uint32_t i = 0; i < child_cnt; i++) {
+        bindObject(lv_obj_get_child(obj, i), screen, hits, misses);
+    }
+}
+
+/**
+ * @brief 替换单个属性
+ */
+void AssetManager::bindProperty(lv_obj_t* obj, lv_obj_t* screen, uint8_t kind, const void* builtin,
+                                uint32_t* hits, uint32_t* misses) {
+    uint8_t type = (kind == BIND_TEXT_FONT) ? ASSET_TYPE_FONT : ASSET_TYPE_IMAGE;
+    const char* name = builtinName(builtin, type);
+    if (!name) {
+        return;
+    }
+
+    if (m_bindingCount >= ASSET_MAX_BINDINGS) {
+        printf("[AssetManager] 警告：替换记录已满（%d），%s 使用内置资源\n", ASSET_MAX_BINDINGS, name);
+        return;
+    }
+
+    int index = acquire(name, type, hits, misses);
+    if (index < 0) {
+        return;
+    }
+
+    CacheEntry* slot = &m_cache[index];
+    applyProperty(obj, kind, type == ASSET_TYPE_FONT ? (const void*)slot->font : (const void*)&slot->img);
+
+    Binding* binding = &m_bindings[m_bindingCount++];
+    binding->obj = obj;
+    binding->screen = screen;
+    binding->kind = kind;
+    binding->cache_index = (int8_t)index;
+    binding->builtin = builtin;
+}
+
+/**
+ * @brief 还原屏幕上被替换的资源并释放引用
+ */
+void AssetManager::unbindScreen(lv_obj_t* screen, bool restore) {
+    for (int i = m_bindingCount - 1; i >= 0; i--) {
+        Binding* binding = &m_bindings[i];
+        if (binding->screen != screen) {
+            continue;
+        }
+
+        if (restore) {
+            applyProperty(binding->obj, binding->kind, binding->builtin);
+        }
+        release(binding->cache_index);
+
+        m_bindings[i] = m_bindings[--m_bindingCount];
+    }
+}
+
+/**
+ * @brief 还原所有屏幕
+ */
+void AssetManager::unbindAll() {
+    for (int i = 0; i < m_bindingCount; i++) {
+        applyProperty(m_bindings[i].obj, m_bindings[i].kind, m_bindings[i].builtin);
+        release(m_bindings[i].cache_index);
+    }
+    m_bindingCount = 0;
+}
+
+// === 统计 ===
+
+void AssetManager::getStats(AssetCacheStats* stats) const {
+    if (!stats) {
+        return;
+    }
+
+    memset(stats, 0, sizeof(AssetCacheStats));
+    for (int i = 0; i < ASSET_CACHE_MAX_ENTRIES; i++) {
+        if (m_cache[i].used) {
+            stats->cached_count++;
+            if (m_cache[i].pins > 0) {
+                stats->pinned_count++;
+            }
+        }
+    }
+
+    stats->hits = m_hits;
+    stats->misses = m_misses;
+    stats->evictions = m_evictions;
+    stats->load_failures = m_loadFailures;
+    stats->cached_bytes = m_cacheBytes;
+    stats->budget_bytes = m_cacheBudget;
+    stats->avg_load_us = m_misses ? (uint32_t)(m_loadUsTotal / m_misses) : 0;
+    stats->bind_count = m_bindCount;
+    stats->last_bind_us = m_lastBindUs;
+    stats->last_bind_hits = m_lastBindHits;
+    stats->last_bind_misses = m_lastBindMisses;
+    stats->avg_hit_bind_us = m_hitBindCount ? (uint32_t)(m_hitBindUsTotal / m_hitBindCount) : 0;
+    stats->avg_miss_bind_us = m_missBindCount ? (uint32_t)(m_missBindUsTotal / m_missBindCount) : 0;
+}
+
+void AssetManager::resetStats() {
+    m_hits = 0;
+    m_misses = 0;
+    m_evictions = 0;
+    m_loadFailures = 0;
+    m_loadUsTotal = 0;
+    m_bindCount = 0;
+    m_lastBindUs = 0;
+    m_lastBindHits = 0;
+    m_lastBindMisses = 0;
+    m_hitBindCount = 0;
+    m_hitBindUsTotal = 0;
+    m_missBindCount = 0;
+    m_missBindUsTotal = 0;
+}
@@ -0,0 +1,318 @@
+/*
+ * AssetManager.h - UI资源包管理器头文件
+ * ESP32S3监控项目 - 运行时资源加载模块
+ *
+ * 功能特性：
+ * - 从SPIFFS加载asset_packer.py生成的资源包（.uap），更换主题图片/字体只需上传资源包
+ * - 注册LVGL文件系统驱动（盘符A），由FileManager提供文件访问；资源包内的条目可以按
+ *   "A:/包路径/条目名"作为独立文件打开，字体直接交给lv_font_load加载
+ * - 解码后的资源放入容量受限的PSRAM LRU缓存（由PSRAMManager分配），正在显示的资源不会被淘汰
+ * - 屏幕开始加载时把内置图片/字体替换为资源包中的同名资源，卸载后还原并释放引用
+ * - 统计缓存命中率和屏幕切换时的资源解析耗时
+ *
+ * 资源包格式见asset_packer.py说明
+ */
+
+#ifndef ASSET_MANAGER_H
+#define ASSET_MANAGER_H
+
+#include <Arduino.h>
+#include <vector>
+#include "lvgl.h"
+
+// 前向声明
+class FileManager;
+class PSRAMManager;
+
+// 资源包配置
+#define ASSET_FS_LETTER          'A'                // LVGL文件系统驱动盘符
+#define ASSET_CACHE_MAX_BYTES    (3 * 1024 * 1024)  // PSRAM缓存默认容量上限
+#define ASSET_CACHE_MAX_ENTRIES  24                 // 缓存的最大资源数
+#define ASSET_MAX_BINDINGS       64                 // 同时替换为资源包资源的对象属性数
+#define ASSET_NAME_LEN           32                 // 条目名长度（含结尾0）
+
+#define ASSET_PACK_MAGIC         "UIAP"
+#define ASSET_PACK_VERSION       1
+#define ASSET_PACK_MAX_ENTRIES   64
+
+/**
+ * @brief 资源类型
+ */
+enum AssetType {
+    ASSET_TYPE_IMAGE = 1,   ///< 图片
+    ASSET_TYPE_FONT = 2     ///< 字体
+};
+
+/**
+ * @brief 资源包图片格式
+ */
+enum AssetImageFormat {
+    ASSET_IMG_TRUE_COLOR = 0,       ///< RGB565
+    ASSET_IMG_TRUE_COLOR_ALPHA = 1, ///< RGB565 + A8
+    ASSET_IMG_RLE = 2               ///< image_compressor.py的按行RLE格式，加载时解码为RGB565
+};
+
+/**
+ * @brief 资源包文件头（16字节）
+ */
+typedef struct __attribute__((packed)) {
+    char magic[4];          ///< 'U' 'I' 'A' 'P'
+    uint16_t version;       ///< 格式版本
+    uint16_t entry_count;   ///< 条目数
+    uint32_t data_offset;   ///< 数据区偏移
+    uint32_t reserved;
+} asset_pack_header_t;
+
+/**
+ * @brief 资源包条目（52字节）
+ */
+typedef struct __attribute__((packed)) {
+    char name[ASSET_NAME_LEN];  ///< 条目名，与ui.h/ui2.h中的变量名一致
+    uint8_t type;               ///< AssetType
+    uint8_t format;             ///< 图片为AssetImageFormat，字体为0
+    uint16_t reserved;
+    uint16_t width;             ///< 图片宽度
+    uint16_t height;            ///< 图片高度
+    uint32_t offset;            ///< 数据偏移（相对文件起点）
+    uint32_t size;              ///< 数据大小
+    uint32_t crc32;             ///< 数据CRC32
+} asset_pack_entry_t;
+
+/**
+ * @brief 资源缓存统计
+ */
+struct AssetCacheStats {
+    uint32_t hits;              ///< 缓存命中次数
+    uint32_t misses;            ///< 缓存未命中（从SPIFFS加载）次数
+    uint32_t evictions;         ///< LRU淘汰次数
+    uint32_t load_failures;     ///< 加载失败次数（继续使用内置资源）
+    uint32_t cached_count;      ///< 缓存中的资源数
+    uint32_t pinned_count;      ///< 正在显示（不可淘汰）的资源数
+    uint32_t cached_bytes;      ///< 缓存占用字节数
+    uint32_t budget_bytes;      ///< 缓存容量上限
+    uint32_t avg_load_us;       ///< 未命中时平均加载耗时
+    uint32_t bind_count;        ///< 屏幕资源解析次数
+    uint32_t last_bind_us;      ///< 最近一次屏幕切换的资源解析耗时
+    uint32_t last_bind_hits;    ///< 最近一次屏幕切换的命中数
+    uint32_t last_bind_misses;  ///< 最近一次屏幕切换的未命中数
+    uint32_t avg_hit_bind_us;   ///< 全部命中时的平均解析耗时
+    uint32_t avg_miss_bind_us;  ///< 含未命中时的平均解析耗时
+};
+
+/**
+ * @brief UI资源包管理器
+ *
+ * 除统计查询外，所有接口都需要在持有LVGL锁时调用
+ */
+class AssetManager {
+public:
+    AssetManager();
+    ~AssetManager();
+
+    /**
+     * @brief 初始化并注册LVGL文件系统驱动（需持有LVGL锁）
+     *
+     * @param fileManager 文件管理器（SPIFFS需已初始化）
+     * @param psramManager PSRAM管理器
+     * @return true 初始化成功，false 初始化失败
+     */
+    bool init(FileManager* fileManager, PSRAMManager* psramManager);
+
+    /**
+     * @brief 切换资源包（需持有LVGL锁）
+     *
+     * 先还原所有已替换的资源并清空缓存，再加载新资源包的条目表，并立即应用到当前屏幕
+     *
+     * @param path SPIFFS中的资源包路径，空字符串表示只使用内置资源
+     * @return true 切换成功，false 资源包无效（此时只使用内置资源）
+     */
+    bool setActivePack(const String& path);
+
+    /**
+     * @brief 获取当前资源包路径（未启用时为空）
+     */
+    String getActivePack() const;
+
+    /**
+     * @brief 获取当前资源包的条目数
+     */
+    int getPackEntryCount() const;
+
+    /**
+     * @brief 为当前显示器上的所有屏幕注册加载/卸载事件（需持有LVGL锁）
+     *
+     * 创建UI后调用一次，重复调用不会重复注册
+     */
+    void attachScreens();
+
+    /**
+     * @brief 设置缓存容量上限（需持有LVGL锁，超出部分立即淘汰未使用的资源）
+     */
+    void setCacheBudget(size_t bytes);
+
+    /**
+     * @brief 释放缓存中所有未在显示的资源（需持有LVGL锁）
+     */
+    void clearCache();
+
+    /**
+     * @brief 按LRU释放未在显示的资源，直到释放bytes字节或没有可释放的资源（需持有LVGL锁）
+     *
+     * @return 实际释放的字节数
+     */
+    size_t trimCache(size_t bytes);
+
+    /**
+     * @brief 获取缓存统计
+     */
+    void getStats(AssetCacheStats* stats) const;
+
+    /**
+     * @brief 重置命中率和耗时统计
+     */
+    void resetStats();
+
+    /**
+     * @brief 检查是否已初始化
+     */
+    bool isReady() const { return m_initialized; }
+
+private:
+    /**
+     * @brief 缓存项
+     */
+    struct CacheEntry {
+        bool used;
+        uint8_t type;                   ///< AssetType
+        char name[ASSET_NAME_LEN];
+        uint16_t pins;                  ///< 引用该资源的对象属性数，大于0时不可淘汰
+        uint32_t last_used;             ///< LRU序号
+        size_t bytes;                   ///< 占用字节数
+        lv_img_dsc_t img;               ///< 图片描述符（像素数据在PSRAM）
+        lv_font_t* font;                ///< lv_font_load加载的字体
+    };
+
+    /**
+     * @brief 替换记录（用于屏幕卸载时还原内置资源）
+     */
+    struct Binding {
+        lv_obj_t* obj;
+        lv_obj_t* screen;
+        uint8_t kind;                   ///< 被替换的属性
+        int8_t cache_index;
+        const void* builtin;            ///< 原内置资源
+    };
+
+    FileManager* m_fileManager;
+    PSRAMManager* m_psramManager;
+    bool m_initialized;
+    lv_fs_drv_t m_fsDrv;
+
+    String m_packPath;
+    std::vector<asset_pack_entry_t> m_packEntries;
+
+    CacheEntry m_cache[ASSET_CACHE_MAX_ENTRIES];
+    Binding m_bindings[ASSET_MAX_BINDINGS];
+    int m_bindingCount;
+    size_t m_cacheBudget;
+    size_t m_cacheBytes;
+    uint32_t m_useCounter;
+
+    // 统计数据
+    uint32_t m_hits;
+    uint32_t m_misses;
+    uint32_t m_evictions;
+    uint32_t m_loadFailures;
+    uint64_t m_loadUsTotal;
+    uint32_t m_bindCount;
+    uint32_t m_lastBindUs;
+    uint32_t m_lastBindHits;
+    uint32_t m_lastBindMisses;
+    uint32_t m_hitBindCount;
+    uint64_t m_hitBindUsTotal;
+    uint32_t m_missBindCount;
+    uint64_t m_missBindUsTotal;
+
+    // LVGL文件系统驱动回调
+    static void* fsOpenCb(lv_fs_drv_t* drv, const char* path, lv_fs_mode_t mode);
+    static lv_fs_res_t fsCloseCb(lv_fs_drv_t* drv, void* file_p);
+    static lv_fs_res_t fsReadCb(lv_fs_drv_t* drv, void* file_p, void* buf, uint32_t btr, uint32_t* br);
+    static lv_fs_res_t fsSeekCb(lv_fs_drv_t* drv, void* file_p, uint32_t pos, lv_fs_whence_t whence);
+    static lv_fs_res_t fsTellCb(lv_fs_drv_t* drv, void* file_p, uint32_t* pos_p);
+
+    // 屏幕事件回调
+    static void screenEventCb(lv_event_t* e);
+
+    /**
+     * @brief 读取资源包条目表
+     */
+    bool loadPackIndex(const String& path);
+
+    /**
+     * @brief 按名称和类型查找资源包条目
+     */
+    const asset_pack_entry_t* findPackEntry(const char* name, uint8_t type) const;
+
+    /**
+     * @brief 获取资源（命中直接返回，未命中时从资源包加载）并增加引用
+     *
+     * @return 缓存项索引，资源包中没有或加载失败时返回-1
+     */
+    int acquire(const char* name, uint8_t type, uint32_t* hits, uint32_t* misses);
+
+    /**
+     * @brief 释放资源引用（资源保留在缓存中，直到被淘汰）
+     */
+    void release(int index);
+
+    /**
+     * @brief 从资源包加载一个条目到缓存项
+     */
+    bool loadEntry(const asset_pack_entry_t* entry, CacheEntry* slot);
+
+    /**
+     * @brief 释放缓存项占用的内存
+     */
+    void freeEntry(CacheEntry* slot);
+
+    /**
+     * @brief 按LRU淘汰未使用的资源，直到可以放下bytes字节
+     *
+     * @return 可用的缓存项索引，无法腾出空间时返回-1
+     */
+    int makeRoom(size_t bytes);
+
+    /**
+     * @brief 把屏幕上的内置资源替换为资源包资源
+     */
+    void bindScreen(lv_obj_t* screen);
+
+    /**
+     * @brief 递归替换对象及其子对象的资源
+     */
+    void bindObject(lv_obj_t* obj, lv_obj_t* screen, uint32_t* hits, uint32_t* misses);
+
+    /**
+     * @brief 替换单个属性
+     */
+    void bindProperty(lv_obj_t* obj, lv_obj_t* screen, uint8_t kind, const void* builtin, uint32_t* hits, uint32_t* misses);
+
+    /**
+     * @brief 还原屏幕上被替换的资源并释放引用
+     *
+     * @param restore false表示屏幕正在删除，只释放引用
+     */
+    void unbindScreen(lv_obj_t* screen, bool restore);
+
+    /**
+     * @brief 还原所有屏幕
+     */
+    void unbindAll();
+
+    /**
+     * @brief 检查屏幕是否已有替换记录
+     */
+    bool isScreenBound(lv_obj_t* screen) const;
+};
+
+#endif // ASSET_MANAGER_H
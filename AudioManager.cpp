@@ -38,6 +38,10 @@ AudioManager::AudioManager()
 // 析构函数
 AudioManager::~AudioManager()
 {
+    if (m_psramManager != nullptr) {
+        m_psramManager->unregisterReclaimer(reclaimCallback, this);
+    }
+    
     stop();
     
     // 清理音频数据
@@ -120,6 +124,9 @@ bool AudioManager::init(PSRAMManager* psramManager, FileManager* fileManager)
         return false;
     }
     
+    // 播放结束后常驻PSRAM的PCM数据在内存紧张时可以释放（下次播放会重新加载）
+    m_psramManager->registerReclaimer("音频PCM数据", MEM_RECLAIM_DATA, MEM_CAP_SPIRAM, reclaimCallback, this);
+    
     m_initialized = true;
     logInfo("音频管理器初始化成功");
     
@@ -476,7 +483,7 @@ bool AudioManager::loadPCMData(const String& filePath)
     uint8_t* audioBuffer = nullptr;
     if (m_psramManager != nullptr) {
         audioBuffer = static_cast<uint8_t*>(
-            m_psramManager->allocateDataBuffer(fileSize, "AudioPCMBuffer_" + filePath)
+            m_psramManager->allocateDataBuffer(fileSize, "音频PCM缓冲区")
         );
     } else {
         audioBuffer = static_cast<uint8_t*>(malloc(fileSize));
@@ -539,6 +546,26 @@ void AudioManager::unloadPCMData()
     }
 }
 
+// 内存回收回调：只释放未在播放的PCM数据
+size_t AudioManager::reclaimCallback(size_t bytes, MemPressure pressure, void* userdata)
+{
+    AudioManager* audioManager = static_cast<AudioManager*>(userdata);
+    
+    // 播放任务写I2S时不持有锁，只要处于播放状态就不能释放
+    if (!audioManager->takeMutex(0)) {
+        return 0;
+    }
+    
+    size_t freed = 0;
+    if (audioManager->m_currentState != AUDIO_STATE_PLAYING && audioManager->m_currentAudioFile.isLoaded) {
+        freed = audioManager->m_currentAudioFile.fileSize;
+        audioManager->unloadPCMData();
+    }
+    
+    audioManager->giveMutex();
+    return freed;
+}
+
 // 写入音频数据
 bool AudioManager::writeAudioData(const uint8_t* data, size_t size)
 {
@@ -189,6 +189,7 @@ private:
     // 音频数据处理
     bool loadPCMData(const String& filePath);
     void unloadPCMData();
+    static size_t reclaimCallback(size_t bytes, MemPressure pressure, void* userdata);
     bool writeAudioData(const uint8_t* data, size_t size);
     
     // 内部控制方法
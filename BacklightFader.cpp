@@ -0,0 +1,379 @@
+/*
+ * BacklightFader.cpp - 背光渐变控制器实现文件
+ * ESP32S3监控项目 - 背光渐变模块
+ */
+
+#include "BacklightFader.h"
+#include "LVGL_Driver.h"
+#include <math.h>
+
+BacklightFader::BacklightFader()
+    : m_driver(nullptr)
+    , m_timer(nullptr)
+    , m_task(nullptr)
+    , m_sendMutex(nullptr)
+    , m_mux(portMUX_INITIALIZER_UNLOCKED)
+    , m_initialized(false)
+    , m_completionCallback(nullptr)
+    , m_completionArg(nullptr)
+    , m_running(false)
+    , m_completed(false)
+    , m_generation(0)
+    , m_startUs(0)
+    , m_nextTickUs(0)
+    , m_durationUs(0)
+    , m_fromPerceptual(0)
+    , m_toPerceptual(0)
+    , m_targetLevel(0)
+    , m_pendingLevel(0)
+    , m_finalPending(false)
+    , m_sentLevel(0)
+    , m_fades(0)
+    , m_completedCount(0)
+    , m_cancelled(0)
+    , m_ticks(0)
+    , m_commands(0)
+    , m_coalesced(0)
+    , m_maxCommandUs(0)
+    , m_maxTickLateUs(0) {
+}
+
+BacklightFader::~BacklightFader() {
+    if (m_timer) {
+        esp_timer_stop(m_timer);
+        esp_timer_delete(m_timer);
+        m_timer = nullptr;
+    }
+    if (m_task) {
+        vTaskDelete(m_task);
+        m_task = nullptr;
+    }
+    if (m_sendMutex) {
+        vSemaphoreDelete(m_sendMutex);
+        m_sendMutex = nullptr;
+    }
+}
+
+/**
+ * @brief 预计算查找表，创建定时器和发送任务
+ */
+bool BacklightFader::init(LVGLDriver* driver) {
+    if (m_initialized) {
+        return true;
+    }
+    if (!driver) {
+        printf("[BacklightFader] 错误：LVGL驱动为空\n");
+        return false;
+    }
+    m_driver = driver;
+    m_sentLevel = percentToLevel(driver->getBrightness());
+
+    buildTables();
+
+    m_sendMutex = xSemaphoreCreateMutex();
+    if (!m_sendMutex) {
+        printf("[BacklightFader] 错误：创建发送锁失败\n");
+        return false;
+    }
+
+    BaseType_t result = xTaskCreatePinnedToCore(
+        taskEntry,
+        "BLFade",
+        BL_FADE_TASK_STACK,
+        this,
+        BL_FADE_TASK_PRIORITY,
+        &m_task,
+        BL_FADE_TASK_CORE
+    );
+    if (result != pdPASS) {
+        printf("[BacklightFader] 错误：创建发送任务失败\n");
+        return false;
+    }
+
+    const esp_timer_create_args_t timerArgs = {
+        .callback = &BacklightFader::timerCb,
+        .arg = this,
+        .dispatch_method = ESP_TIMER_TASK,
+        .name = "bl_fade",
+        .skip_unhandled_events = true
+    };
+    if (esp_timer_create(&timerArgs, &m_timer) != ESP_OK) {
+        printf("[BacklightFader] 错误：创建渐变定时器失败\n");
+        return false;
+    }
+
+    m_initialized = true;
+    printf("[BacklightFader] 背光渐变已初始化：%dHz，gamma %.1f\n",
+           (int)(1000000 / BL_FADE_TICK_US), BL_FADE_GAMMA);
+    return true;
+}
+
+/**
+ * @brief 设置渐变完成回调
+ */
+void BacklightFader::setCompletionCallback(void (*callback)(void*), void* arg) {
+    m_completionArg = arg;
+    m_completionCallback = callback;
+}
+
+/**
+ * @brief 开始渐变
+ */
+void BacklightFader::start(uint8_t from_level, uint8_t to_level, uint32_t duration_ms) {
+    if (!m_initialized) {
+        return;
+    }
+
+    esp_timer_stop(m_timer);
+
+    int64_t now = esp_timer_get_time();
+
+    portENTER_CRITICAL(&m_mux);
+    if (m_running) {
+        m_cancelled++;
+    }
+    m_generation++;
+    m_fromPerceptual = m_perceptual[from_level];
+    m_toPerceptual = m_perceptual[to_level];
+    m_targetLevel = to_level;
+    m_pendingLevel = from_level;
+    m_finalPending = false;
+    m_durationUs = duration_ms > 0 ? duration_ms * 1000 : 1;
+    m_startUs = now;
+    m_nextTickUs = now + BL_FADE_TICK_US;
+    m_running = true;
+    m_completed = false;
+    m_fades++;
+    portEXIT_CRITICAL(&m_mux);
+
+    esp_timer_start_periodic(m_timer, BL_FADE_TICK_US);
+}
+
+/**
+ * @brief 停止渐变
+ */
+void BacklightFader::stop(bool jump_to_target) {
+    if (!m_initialized) {
+        return;
+    }
+
+    esp_timer_stop(m_timer);
+
+    uint32_t generation;
+    uint8_t target;
+    portENTER_CRITICAL(&m_mux);
+    if (m_running) {
+        m_cancelled++;
+    }
+    m_generation++;
+    generation = m_generation;
+    target = m_targetLevel;
+    m_running = false;
+    m_completed = false;
+    m_finalPending = false;
+    portEXIT_CRITICAL(&m_mux);
+
+    if (jump_to_target) {
+        sendLevel(target, generation);
+    }
+}
+
+/**
+ * @brief 渐变完成且目标亮度已发送后返回一次true
+ */
+bool BacklightFader::takeCompleted() {
+    bool completed;
+    portENTER_CRITICAL(&m_mux);
+    completed = m_completed;
+    m_completed = false;
+    portEXIT_CRITICAL(&m_mux);
+    return completed;
+}
+
+/**
+ * @brief 获取统计数据
+ */
+void BacklightFader::getStats(BacklightFadeStats* stats) const {
+    if (!stats) {
+        return;
+    }
+
+    portENTER_CRITICAL(&m_mux);
+    stats->fades = m_fades;
+    stats->completed = m_completedCount;
+    stats->cancelled = m_cancelled;
+    stats->ticks = m_ticks;
+    stats->commands = m_commands;
+    stats->coalesced = m_coalesced;
+    stats->max_command_us = m_maxCommandUs;
+    stats->max_tick_late_us = m_maxTickLateUs;
+    portEXIT_CRITICAL(&m_mux);
+}
+
+uint8_t BacklightFader::percentToLevel(uint8_t percent) {
+    if (percent > 100) {
+        percent = 100;
+    }
+    return (uint8_t)((percent * 255) / 100);
+}
+
+uint8_t BacklightFader::levelToPercent(uint8_t level) {
+    return (uint8_t)((level * 100 + 127) / 255);
+}
+
+/**
+ * @brief 计算缓动表和gamma表（只在初始化时使用浮点运算）
+ */
+void BacklightFader::buildTables() {
+    // 缓动曲线：前半段余弦、后半段三次曲线，再用五次smootherstep平滑（与原渐变曲线一致）
+    for (int i = 0; i < BL_FADE_EASE_LUT_SIZE; i++) {
+        float t = (float)i / (BL_FADE_EASE_LUT_SIZE - 1);
+        float s;
+        if (t < 0.5f) {
+            float u = t * 2.0f;
+            s = 0.5f * (1.0f - cosf(u * (float)M_PI * 0.5f));
+        } else {
+            float u = (t - 0.5f) * 2.0f;
+            s = 0.5f + 0.5f * u * u * (3.0f - 2.0f * u);
+        }
+        s = s * s * s * (s * (s * 6.0f - 15.0f) + 10.0f);
+        m_ease[i] = (uint16_t)lroundf(s * 65535.0f);
+    }
+
+    // 感知亮度与硬件亮度互相转换
+    for (int i = 0; i < 256; i++) {
+        float x = i / 255.0f;
+        m_gamma[i] = (uint8_t)lroundf(powf(x, BL_FADE_GAMMA) * 255.0f);
+        m_perceptual[i] = (uint8_t)lroundf(powf(x, 1.0f / BL_FADE_GAMMA) * 255.0f);
+    }
+}
+
+void BacklightFader::timerCb(void* arg) {
+    static_cast<BacklightFader*>(arg)->onTick();
+}
+
+/**
+ * @brief 定时器回调：按进度查表得到硬件亮度，有变化时通知发送任务
+ */
+void BacklightFader::onTick() {
+    int64_t now = esp_timer_get_time();
+    bool notify = false;
+    bool finished = false;
+
+    portENTER_CRITICAL(&m_mux);
+    if (m_running && !m_finalPending) {
+        m_ticks++;
+        if (now > m_nextTickUs) {
+            uint32_t late = (uint32_t)(now - m_nextTickUs);
+            if (late > m_maxTickLateUs) {
+                m_maxTickLateUs = late;
+            }
+        }
+        m_nextTickUs = now + BL_FADE_TICK_US;
+
+        uint32_t elapsed = (uint32_t)(now - m_startUs);
+        uint8_t level;
+        if (elapsed >= m_durationUs) {
+            level = m_targetLevel;
+            m_finalPending = true;
+            finished = true;
+        } else {
+            uint32_t index = (uint32_t)(((uint64_t)elapsed * (BL_FADE_EASE_LUT_SIZE - 1)) / m_durationUs);
+            int32_t span = (int32_t)m_toPerceptual - (int32_t)m_fromPerceptual;
+            int32_t perceptual = m_fromPerceptual + (span * (int32_t)m_ease[index]) / 65535;
+            level = m_gamma[perceptual];
+        }
+
+        if (level != m_pendingLevel || finished) {
+            // 上一个值还没发出去就被新值覆盖
+            if (m_pendingLevel != m_sentLevel) {
+                m_coalesced++;
+            }
+            m_pendingLevel = level;
+            notify = true;
+        }
+    }
+    portEXIT_CRITICAL(&m_mux);
+
+    if (finished) {
+        esp_timer_stop(m_timer);
+    }
+    if (notify && m_task) {
+        xTaskNotifyGive(m_task);
+    }
+}
+
+void BacklightFader::taskEntry(void* arg) {
+    static_cast<BacklightFader*>(arg)->sendTask();
+}
+
+/**
+ * @brief 发送任务：只发送最新的亮度值
+ */
+void BacklightFader::sendTask() {
+    while (true) {
+        ulTaskNotifyTake(pdTRUE, portMAX_DELAY);
+
+        uint8_t level;
+        bool final;
+        uint32_t generation;
+        portENTER_CRITICAL(&m_mux);
+        level = m_pendingLevel;
+        final = m_finalPending;
+        generation = m_generation;
+        portEXIT_CRITICAL(&m_mux);
+
+        if (level != m_sentLevel || final) {
+            sendLevel(level, generation);
+        }
+
+        if (final) {
+            bool completed = false;
+            portENTER_CRITICAL(&m_mux);
+            if (generation == m_generation && m_finalPending) {
+                m_finalPending = false;
+                m_running = false;
+                m_completed = true;
+                m_completedCount++;
+                completed = true;
+            }
+            portEXIT_CRITICAL(&m_mux);
+
+            if (completed && m_completionCallback) {
+                m_completionCallback(m_completionArg);
+            }
+        }
+    }
+}
+
+/**
+ * @brief 发送亮度命令
+ */
+void BacklightFader::sendLevel(uint8_t level, uint32_t generation) {
+    if (xSemaphoreTake(m_sendMutex, portMAX_DELAY) != pdTRUE) {
+        return;
+    }
+
+    // 渐变已被停止或重新启动，放弃过期的值
+    bool current;
+    portENTER_CRITICAL(&m_mux);
+    current = generation == m_generation;
+    portEXIT_CRITICAL(&m_mux);
+
+    if (current) {
+        int64_t startUs = esp_timer_get_time();
+        if (m_driver->setBacklightLevel(level)) {
+            m_sentLevel = level;
+        }
+        uint32_t elapsed = (uint32_t)(esp_timer_get_time() - startUs);
+
+        portENTER_CRITICAL(&m_mux);
+        m_commands++;
+        if (elapsed > m_maxCommandUs) {
+            m_maxCommandUs = elapsed;
+        }
+        portEXIT_CRITICAL(&m_mux);
+    }
+
+    xSemaphoreGive(m_sendMutex);
+}
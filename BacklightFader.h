@@ -0,0 +1,175 @@
+/*
+ * BacklightFader.h - 背光渐变控制器头文件
+ * ESP32S3监控项目 - 背光渐变模块
+ *
+ * 功能特性：
+ * - 渐变由独立的esp_timer定时推进，不依赖显示任务的循环和延时，UI消息繁忙时渐变依然平滑
+ * - 缓动曲线和感知亮度gamma曲线在初始化时预先计算成查找表，渐变过程中只做整数查表
+ * - 在感知亮度空间插值，暗部变化更细腻，起点和终点与setBrightness的硬件亮度一致
+ * - 亮度命令由高优先级的发送任务执行，定时器回调不等待QSPI总线；
+ *   命令未发完时只保留最新亮度，不会积压
+ * - 发送任务通过LVGLDriver::setBacklightLevel()的面板IO锁与LVGL刷新串行，不会与颜色传输同时访问面板
+ */
+
+#ifndef BACKLIGHT_FADER_H
+#define BACKLIGHT_FADER_H
+
+#include <Arduino.h>
+#include "freertos/FreeRTOS.h"
+#include "freertos/task.h"
+#include "freertos/semphr.h"
+#include "esp_timer.h"
+
+// 前向声明
+class LVGLDriver;
+
+// 背光渐变配置
+#define BL_FADE_TICK_US          8000    // 渐变定时器周期（125Hz）
+#define BL_FADE_EASE_LUT_SIZE    256     // 缓动表点数
+#define BL_FADE_GAMMA            2.2f    // 感知亮度gamma
+#define BL_FADE_TASK_STACK       2048    // 发送任务栈大小
+#define BL_FADE_TASK_PRIORITY    4       // 发送任务优先级（高于显示任务）
+#define BL_FADE_TASK_CORE        0       // 发送任务运行核心
+
+/**
+ * @brief 背光渐变统计
+ */
+struct BacklightFadeStats {
+    uint32_t fades;             ///< 启动的渐变次数
+    uint32_t completed;         ///< 正常完成的次数
+    uint32_t cancelled;         ///< 中途停止或反向的次数
+    uint32_t ticks;             ///< 定时器回调次数
+    uint32_t commands;          ///< 发送的亮度命令数
+    uint32_t coalesced;         ///< 上一条命令未发完时被合并的亮度值
+    uint32_t max_command_us;    ///< 单条亮度命令最大耗时
+    uint32_t max_tick_late_us;  ///< 定时器回调最大延迟
+};
+
+/**
+ * @brief 背光渐变控制器
+ *
+ * 亮度均为SH8601的硬件亮度（0-255）
+ */
+class BacklightFader {
+public:
+    BacklightFader();
+    ~BacklightFader();
+
+    /**
+     * @brief 预计算查找表，创建定时器和发送任务
+     *
+     * @param driver LVGL驱动（提供亮度命令）
+     * @return true 成功，false 失败
+     */
+    bool init(LVGLDriver* driver);
+
+    /**
+     * @brief 设置渐变完成回调（在发送任务中调用，不能阻塞）
+     */
+    void setCompletionCallback(void (*callback)(void*), void* arg);
+
+    /**
+     * @brief 开始渐变（正在渐变时先停止，不跳到上一次的终点）
+     *
+     * @param from_level 起始亮度
+     * @param to_level 目标亮度
+     * @param duration_ms 渐变时长
+     */
+    void start(uint8_t from_level, uint8_t to_level, uint32_t duration_ms);
+
+    /**
+     * @brief 停止渐变
+     *
+     * @param jump_to_target true时立即设置为目标亮度（同步发送），false时停在当前亮度
+     */
+    void stop(bool jump_to_target);
+
+    /**
+     * @brief 检查是否正在渐变
+     */
+    bool isRunning() const { return m_running; }
+
+    /**
+     * @brief 渐变完成且目标亮度已发送后返回一次true
+     */
+    bool takeCompleted();
+
+    /**
+     * @brief 获取最近发送的硬件亮度
+     */
+    uint8_t getLevel() const { return m_sentLevel; }
+
+    /**
+     * @brief 获取统计数据
+     */
+    void getStats(BacklightFadeStats* stats) const;
+
+    /**
+     * @brief 亮度百分比转换为硬件亮度（与LVGLDriver::setBrightness一致）
+     */
+    static uint8_t percentToLevel(uint8_t percent);
+
+    /**
+     * @brief 硬件亮度转换为亮度百分比
+     */
+    static uint8_t levelToPercent(uint8_t level);
+
+private:
+    LVGLDriver* m_driver;
+    esp_timer_handle_t m_timer;
+    TaskHandle_t m_task;
+    SemaphoreHandle_t m_sendMutex;
+    mutable portMUX_TYPE m_mux;
+    bool m_initialized;
+    void (*m_completionCallback)(void*);
+    void* m_completionArg;
+
+    // 预计算查找表
+    uint16_t m_ease[BL_FADE_EASE_LUT_SIZE];  ///< 进度 -> 缓动值（0-65535）
+    uint8_t m_gamma[256];                    ///< 感知亮度 -> 硬件亮度
+    uint8_t m_perceptual[256];               ///< 硬件亮度 -> 感知亮度
+
+    // 当前渐变（由m_mux保护）
+    volatile bool m_running;
+    volatile bool m_completed;
+    uint32_t m_generation;                   ///< 每次启动/停止加一，丢弃过期的发送
+    int64_t m_startUs;
+    int64_t m_nextTickUs;
+    uint32_t m_durationUs;
+    uint8_t m_fromPerceptual;
+    uint8_t m_toPerceptual;
+    uint8_t m_targetLevel;
+    uint8_t m_pendingLevel;
+    bool m_finalPending;
+    volatile uint8_t m_sentLevel;
+
+    // 统计
+    uint32_t m_fades;
+    uint32_t m_completedCount;
+    uint32_t m_cancelled;
+    uint32_t m_ticks;
+    uint32_t m_commands;
+    uint32_t m_coalesced;
+    uint32_t m_maxCommandUs;
+    uint32_t m_maxTickLateUs;
+
+    /**
+     * @brief 计算缓动表和gamma表
+     */
+    void buildTables();
+
+    // 定时器回调（esp_timer任务中执行，只查表和通知发送任务）
+    static void timerCb(void* arg);
+    void onTick();
+
+    // 发送任务
+    static void taskEntry(void* arg);
+    void sendTask();
+
+    /**
+     * @brief 发送亮度命令（持有发送锁，generation过期时放弃）
+     */
+    void sendLevel(uint8_t level, uint32_t generation);
+};
+
+#endif // BACKLIGHT_FADER_H
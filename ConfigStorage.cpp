@@ -5,6 +5,7 @@
  */
 
 #include "ConfigStorage.h"
+#include <esp_heap_caps.h>
 
 // 静态常量定义
 const char* ConfigStorage::WIFI_NAMESPACE = "wifi_config";
@@ -48,11 +49,17 @@ const char* ConfigStorage::CONNECTION_TIMEOUT_KEY = "srv_timeout";
 const char* ConfigStorage::AUTO_GET_DATA_KEY = "srv_auto_get";
 const char* ConfigStorage::AUTO_SCAN_SERVER_KEY = "srv_auto_scan";
 
-ConfigStorage::ConfigStorage() : configTaskHandle(nullptr), configQueue(nullptr), taskRunning(false) {
+ConfigStorage::ConfigStorage() : configTaskHandle(nullptr), configQueue(nullptr), taskRunning(false),
+                                 m_cache(nullptr), m_cacheSeq(0), m_cacheMux(portMUX_INITIALIZER_UNLOCKED) {
 }
 
 ConfigStorage::~ConfigStorage() {
     stopTask();
+
+    if (m_cache != nullptr) {
+        heap_caps_free(m_cache);
+        m_cache = nullptr;
+    }
 }
 
 // 任务管理方法实现
@@ -67,6 +74,9 @@ bool ConfigStorage::init() {
         return false;
     }
     
+    // 配置任务启动前加载缓存，此时只有当前任务访问NVS
+    loadCache();
+    
     printf("✅ [ConfigStorage] 配置存储任务管理器初始化完成\n");
     return true;
 }
@@ -475,6 +485,9 @@ void ConfigStorage::processConfigRequest(ConfigRequest* request) {
             break;
     }
     
+    // 写入操作后从NVS刷新对应的缓存（失败时NVS可能已部分写入，同样刷新）
+    refreshCacheAfter(request->operation);
+    
     printf("🔄 [ConfigStorage] 配置操作完成，结果: %s\n", request->success ? "成功" : "失败");
 }
 
@@ -516,6 +529,326 @@ bool ConfigStorage::sendRequestAndWait(ConfigRequest* request, uint32_t timeoutM
     return success;
 }
 
+// 配置缓存实现
+//
+// 读者无锁：记下序列号后复制数据，序列号为奇数或复制期间变化则重试。
+// 写者在临界区内递增序列号并复制已准备好的数据，临界区内不访问NVS、不分配内存，
+// 同核读者不会打断写者，另一核的读者最多重试一次复制的时间。
+
+void ConfigStorage::loadCache() {
+    unsigned long startTime = millis();
+
+    m_cache = (ConfigCache*)heap_caps_calloc(1, sizeof(ConfigCache), MALLOC_CAP_SPIRAM | MALLOC_CAP_8BIT);
+    if (m_cache == nullptr) {
+        m_cache = (ConfigCache*)heap_caps_calloc(1, sizeof(ConfigCache), MALLOC_CAP_8BIT);
+    }
+    if (m_cache == nullptr) {
+        printf("⚠️ [ConfigStorage] 配置缓存分配失败，读取将通过配置任务访问NVS\n");
+        return;
+    }
+
+    refreshCache();
+
+    printf("📦 [ConfigStorage] 配置缓存加载完成: %u字节, 耗时%lu ms\n",
+           (unsigned)sizeof(ConfigCache), millis() - startTime);
+}
+
+void ConfigStorage::refreshCache() {
+    refreshWiFiCache();
+    refreshMultiWiFiCache();
+    refreshSystemCache();
+    refreshBrightnessCache();
+    refreshThemeCache();
+    refreshTimeCache();
+    refreshScreenCache();
+    refreshServerCache();
+}
+
+void ConfigStorage::refreshCacheAfter(ConfigOperation operation) {
+    if (m_cache == nullptr) {
+        return;
+    }
+
+    switch (operation) {
+        case CONFIG_OP_SAVE_WIFI:
+        case CONFIG_OP_CLEAR_WIFI:
+            refreshWiFiCache();
+            break;
+
+        case CONFIG_OP_SAVE_MULTI_WIFI:
+        case CONFIG_OP_ADD_WIFI:
+        case CONFIG_OP_CLEAR_ALL_WIFI:
+        case CONFIG_OP_UPDATE_WIFI_PRIORITY:
+        case CONFIG_OP_SET_WIFI_PRIORITIES:
+            refreshMultiWiFiCache();
+            break;
+
+        case CONFIG_OP_SAVE_SYSTEM:
+            refreshSystemCache();
+            break;
+
+        case CONFIG_OP_SAVE_BRIGHTNESS:
+            refreshBrightnessCache();
+            break;
+
+        case CONFIG_OP_SAVE_THEME_CONFIG:
+            refreshThemeCache();
+            break;
+
+        case CONFIG_OP_SAVE_TIME_CONFIG:
+            refreshTimeCache();
+            break;
+
+        case CONFIG_OP_SAVE_SCREEN_CONFIG:
+            refreshScreenCache();
+            break;
+
+        case CONFIG_OP_SAVE_SERVER_CONFIG:
+            refreshServerCache();
+            break;
+
+        case CONFIG_OP_RESET_ALL:
+            // 通用配置都在系统命名空间中，已随之清除
+            clearCacheEntries();
+            refreshCache();
+            break;
+
+        default:
+            // 读取操作和通用配置（在putXxx/getXxx中更新）不需要刷新
+            break;
+    }
+}
+
+void ConfigStorage::refreshWiFiCache() {
+    ConfigCacheWiFi cache;
+    memset(&cache, 0, sizeof(cache));
+
+    String ssid, password;
+    cache.configured = hasWiFiConfig();
+    cache.loaded = loadWiFiConfig(ssid, password);
+    cache.cached = copyCacheString(cache.ssid, sizeof(cache.ssid), ssid) &&
+                   copyCacheString(cache.password, sizeof(cache.password), password);
+
+    writeCache(&ConfigCache::wifi, cache);
+}
+
+void ConfigStorage::refreshMultiWiFiCache() {
+    ConfigCacheMultiWiFi cache;
+    memset(&cache, 0, sizeof(cache));
+
+    WiFiConfig configs[MAX_WIFI_CONFIGS];
+    cache.count = getWiFiConfigCount();
+    cache.loaded = loadWiFiConfigs(configs);
+    cache.cached = true;
+    for (int i = 0; i < MAX_WIFI_CONFIGS; i++) {
+        cache.configs[i].priority = configs[i].priority;
+        cache.configs[i].isValid = configs[i].isValid;
+        cache.cached = cache.cached &&
+                       copyCacheString(cache.configs[i].ssid, sizeof(cache.configs[i].ssid), configs[i].ssid) &&
+                       copyCacheString(cache.configs[i].password, sizeof(cache.configs[i].password), configs[i].password);
+    }
+
+    writeCache(&ConfigCache::multiWiFi, cache);
+}
+
+void ConfigStorage::refreshSystemCache() {
+    ConfigCacheSystem cache;
+    memset(&cache, 0, sizeof(cache));
+
+    String deviceName;
+    cache.loaded = loadSystemConfig(deviceName, cache.refreshRate);
+    cache.cached = copyCacheString(cache.deviceName, sizeof(cache.deviceName), deviceName);
+
+    writeCache(&ConfigCache::system, cache);
+}
+
+void ConfigStorage::refreshBrightnessCache() {
+    ConfigCacheValue cache;
+    memset(&cache, 0, sizeof(cache));
+
+    cache.exists = hasBrightnessConfig();
+    cache.value = loadBrightness();
+    cache.cached = true;
+
+    writeCache(&ConfigCache::brightness, cache);
+}
+
+void ConfigStorage::refreshThemeCache() {
+    ConfigCacheValue cache;
+    memset(&cache, 0, sizeof(cache));
+
+    cache.exists = hasThemeConfig();
+    cache.value = loadThemeConfig();
+    cache.cached = true;
+
+    writeCache(&ConfigCache::theme, cache);
+}
+
+void ConfigStorage::refreshTimeCache() {
+    ConfigCacheTime cache;
+    memset(&cache, 0, sizeof(cache));
+
+    String primaryServer, secondaryServer, timezone;
+    cache.loaded = loadTimeConfig(primaryServer, secondaryServer, timezone, cache.syncInterval);
+    cache.cached = copyCacheString(cache.primaryServer, sizeof(cache.primaryServer), primaryServer) &&
+                   copyCacheString(cache.secondaryServer, sizeof(cache.secondaryServer), secondaryServer) &&
+                   copyCacheString(cache.timezone, sizeof(cache.timezone), timezone);
+
+    writeCache(&ConfigCache::time, cache);
+}
+
+void ConfigStorage::refreshScreenCache() {
+    ConfigCacheScreen cache;
+    memset(&cache, 0, sizeof(cache));
+
+    ScreenMode mode;
+    cache.exists = hasScreenConfig();
+    cache.loaded = loadScreenConfig(mode, cache.startHour, cache.startMinute, cache.endHour, cache.endMinute,
+                                    cache.timeoutMinutes, cache.autoRotationEnabled, cache.staticRotation);
+    cache.mode = (int)mode;
+    cache.cached = true;
+
+    writeCache(&ConfigCache::screen, cache);
+}
+
+void ConfigStorage::refreshServerCache() {
+    ConfigCacheServer cache;
+    memset(&cache, 0, sizeof(cache));
+
+    String serverUrl;
+    cache.exists = hasServerConfig();
+    cache.loaded = loadServerConfig(serverUrl, cache.requestInterval, cache.enabled,
+                                    cache.connectionTimeout, cache.autoGetData, cache.autoScanServer);
+    cache.cached = copyCacheString(cache.serverUrl, sizeof(cache.serverUrl), serverUrl);
+
+    writeCache(&ConfigCache::server, cache);
+}
+
+void ConfigStorage::clearCacheEntries() {
+    if (m_cache == nullptr) {
+        return;
+    }
+
+    portENTER_CRITICAL(&m_cacheMux);
+    m_cacheSeq.fetch_add(1, std::memory_order_relaxed);
+    std::atomic_thread_fence(std::memory_order_release);
+    memset(m_cache->entries, 0, sizeof(m_cache->entries));
+    m_cacheSeq.fetch_add(1, std::memory_order_release);
+    portEXIT_CRITICAL(&m_cacheMux);
+}
+
+template <typename T>
+bool ConfigStorage::readCache(T ConfigCache::*section, T& out) const {
+    if (m_cache == nullptr) {
+        return false;
+    }
+
+    uint32_t seq;
+    do {
+        seq = m_cacheSeq.load(std::memory_order_acquire);
+        out = m_cache->*section;
+        std::atomic_thread_fence(std::memory_order_acquire);
+    } while ((seq & 1) || m_cacheSeq.load(std::memory_order_relaxed) != seq);
+
+    return out.cached;
+}
+
+template <typename T>
+void ConfigStorage::writeCache(T ConfigCache::*section, const T& value) {
+    if (m_cache == nullptr) {
+        return;
+    }
+
+    portENTER_CRITICAL(&m_cacheMux);
+    m_cacheSeq.fetch_add(1, std::memory_order_relaxed);
+    std::atomic_thread_fence(std::memory_order_release);
+    m_cache->*section = value;
+    m_cacheSeq.fetch_add(1, std::memory_order_release);
+    portEXIT_CRITICAL(&m_cacheMux);
+}
+
+bool ConfigStorage::findCacheEntry(const String& key, ConfigCacheType type, ConfigCacheEntry& entry) const {
+    if (m_cache == nullptr) {
+        return false;
+    }
+
+    bool found;
+    uint32_t seq;
+    do {
+        seq = m_cacheSeq.load(std::memory_order_acquire);
+        found = false;
+        for (int i = 0; i < CONFIG_CACHE_ENTRIES; i++) {
+            const ConfigCacheEntry& candidate = m_cache->entries[i];
+            if (candidate.type == type && strncmp(candidate.key, key.c_str(), CONFIG_CACHE_KEY_SIZE) == 0) {
+                entry = candidate;
+                found = true;
+                break;
+            }
+        }
+        std::atomic_thread_fence(std::memory_order_acquire);
+    } while ((seq & 1) || m_cacheSeq.load(std::memory_order_relaxed) != seq);
+
+    return found;
+}
+
+void ConfigStorage::storeCacheEntry(const String& key, ConfigCacheType type, bool present, int intValue, const String& stringValue) {
+    if (m_cache == nullptr || key.length() >= CONFIG_CACHE_KEY_SIZE) {
+        return;
+    }
+
+    ConfigCacheEntry entry;
+    memset(&entry, 0, sizeof(entry));
+    memcpy(entry.key, key.c_str(), key.length());
+    entry.type = type;
+    entry.present = present;
+    entry.intValue = intValue;
+
+    // 放不下的字符串删除旧条目，之后读取走配置任务
+    if (type == CONFIG_CACHE_STRING && !copyCacheString(entry.stringValue, sizeof(entry.stringValue), stringValue)) {
+        entry.type = CONFIG_CACHE_EMPTY;
+    }
+
+    portENTER_CRITICAL(&m_cacheMux);
+
+    int slot = -1;
+    int freeSlot = -1;
+    for (int i = 0; i < CONFIG_CACHE_ENTRIES; i++) {
+        const ConfigCacheEntry& candidate = m_cache->entries[i];
+        if (candidate.type == CONFIG_CACHE_EMPTY) {
+            if (freeSlot < 0) {
+                freeSlot = i;
+            }
+        } else if (strcmp(candidate.key, entry.key) == 0) {
+            slot = i;
+            break;
+        }
+    }
+
+    // 条目已满时不缓存
+    if (slot < 0 && entry.type != CONFIG_CACHE_EMPTY) {
+        slot = freeSlot;
+    }
+
+    if (slot >= 0) {
+        m_cacheSeq.fetch_add(1, std::memory_order_relaxed);
+        std::atomic_thread_fence(std::memory_order_release);
+        m_cache->entries[slot] = entry;
+        m_cacheSeq.fetch_add(1, std::memory_order_release);
+    }
+
+    portEXIT_CRITICAL(&m_cacheMux);
+}
+
+bool ConfigStorage::copyCacheString(char* dst, size_t size, const String& value) {
+    if (value.length() >= size) {
+        dst[0] = '\0';
+        return false;
+    }
+
+    memcpy(dst, value.c_str(), value.length() + 1);
+    return true;
+}
+
 // 异步WiFi配置操作接口实现
 
 bool ConfigStorage::saveWiFiConfigAsync(const String& ssid, const String& password, uint32_t timeoutMs) {
@@ -528,6 +861,15 @@ bool ConfigStorage::saveWiFiConfigAsync(const String& ssid, const String& passwo
 }
 
 bool ConfigStorage::loadWiFiConfigAsync(String& ssid, String& password, uint32_t timeoutMs) {
+    ConfigCacheWiFi cache;
+    if (readCache(&ConfigCache::wifi, cache)) {
+        if (cache.loaded) {
+            ssid = cache.ssid;
+            password = cache.password;
+        }
+        return cache.loaded;
+    }
+
     WiFiConfigData result;
     ConfigRequest request;
     request.operation = CONFIG_OP_LOAD_WIFI;
@@ -543,6 +885,11 @@ bool ConfigStorage::loadWiFiConfigAsync(String& ssid, String& password, uint32_t
 }
 
 bool ConfigStorage::hasWiFiConfigAsync(uint32_t timeoutMs) {
+    ConfigCacheWiFi cache;
+    if (readCache(&ConfigCache::wifi, cache)) {
+        return cache.configured;
+    }
+
     bool result = false;
     ConfigRequest request;
     request.operation = CONFIG_OP_HAS_WIFI;
@@ -575,6 +922,17 @@ bool ConfigStorage::saveWiFiConfigsAsync(const WiFiConfig configs[3], uint32_t t
 }
 
 bool ConfigStorage::loadWiFiConfigsAsync(WiFiConfig configs[3], uint32_t timeoutMs) {
+    ConfigCacheMultiWiFi cache;
+    if (readCache(&ConfigCache::multiWiFi, cache)) {
+        if (cache.loaded) {
+            for (int i = 0; i < 3; i++) {
+                configs[i] = WiFiConfig(cache.configs[i].ssid, cache.configs[i].password, cache.configs[i].priority);
+                configs[i].isValid = cache.configs[i].isValid;
+            }
+        }
+        return cache.loaded;
+    }
+
     MultiWiFiConfigData result;
     ConfigRequest request;
     request.operation = CONFIG_OP_LOAD_MULTI_WIFI;
@@ -600,6 +958,11 @@ bool ConfigStorage::addWiFiConfigAsync(const String& ssid, const String& passwor
 }
 
 int ConfigStorage::getWiFiConfigCountAsync(uint32_t timeoutMs) {
+    ConfigCacheMultiWiFi cache;
+    if (readCache(&ConfigCache::multiWiFi, cache)) {
+        return cache.count;
+    }
+
     int result = 0;
     ConfigRequest request;
     request.operation = CONFIG_OP_GET_WIFI_COUNT;
@@ -655,6 +1018,15 @@ bool ConfigStorage::saveSystemConfigAsync(const String& deviceName, int refreshR
 }
 
 bool ConfigStorage::loadSystemConfigAsync(String& deviceName, int& refreshRate, uint32_t timeoutMs) {
+    ConfigCacheSystem cache;
+    if (readCache(&ConfigCache::system, cache)) {
+        if (cache.loaded) {
+            deviceName = cache.deviceName;
+            refreshRate = cache.refreshRate;
+        }
+        return cache.loaded;
+    }
+
     SystemConfigData result;
     ConfigRequest request;
     request.operation = CONFIG_OP_LOAD_SYSTEM;
@@ -681,6 +1053,11 @@ bool ConfigStorage::saveBrightnessAsync(uint8_t brightness, uint32_t timeoutMs)
 }
 
 uint8_t ConfigStorage::loadBrightnessAsync(uint32_t timeoutMs) {
+    ConfigCacheValue cache;
+    if (readCache(&ConfigCache::brightness, cache)) {
+        return (uint8_t)cache.value;
+    }
+
     BrightnessConfigData result;
     ConfigRequest request;
     request.operation = CONFIG_OP_LOAD_BRIGHTNESS;
@@ -691,6 +1068,11 @@ uint8_t ConfigStorage::loadBrightnessAsync(uint32_t timeoutMs) {
 }
 
 bool ConfigStorage::hasBrightnessConfigAsync(uint32_t timeoutMs) {
+    ConfigCacheValue cache;
+    if (readCache(&ConfigCache::brightness, cache)) {
+        return cache.exists;
+    }
+
     bool result = false;
     ConfigRequest request;
     request.operation = CONFIG_OP_HAS_BRIGHTNESS;
@@ -712,6 +1094,11 @@ bool ConfigStorage::saveThemeConfigAsync(int theme, uint32_t timeoutMs) {
 }
 
 int ConfigStorage::loadThemeConfigAsync(uint32_t timeoutMs) {
+    ConfigCacheValue cache;
+    if (readCache(&ConfigCache::theme, cache)) {
+        return cache.value;
+    }
+
     ThemeConfigData result;
     ConfigRequest request;
     request.operation = CONFIG_OP_LOAD_THEME_CONFIG;
@@ -721,6 +1108,11 @@ int ConfigStorage::loadThemeConfigAsync(uint32_t timeoutMs) {
 }
 
 bool ConfigStorage::hasThemeConfigAsync(uint32_t timeoutMs) {
+    ConfigCacheValue cache;
+    if (readCache(&ConfigCache::theme, cache)) {
+        return cache.exists;
+    }
+
     bool result = false;
     ConfigRequest request;
     request.operation = CONFIG_OP_HAS_THEME_CONFIG;
@@ -744,6 +1136,17 @@ bool ConfigStorage::saveTimeConfigAsync(const String& primaryServer, const Strin
 
 bool ConfigStorage::loadTimeConfigAsync(String& primaryServer, String& secondaryServer, 
                                        String& timezone, int& syncInterval, uint32_t timeoutMs) {
+    ConfigCacheTime cache;
+    if (readCache(&ConfigCache::time, cache)) {
+        if (cache.loaded) {
+            primaryServer = cache.primaryServer;
+            secondaryServer = cache.secondaryServer;
+            timezone = cache.timezone;
+            syncInterval = cache.syncInterval;
+        }
+        return cache.loaded;
+    }
+
     TimeConfigData result;
     ConfigRequest request;
     request.operation = CONFIG_OP_LOAD_TIME_CONFIG;
@@ -774,6 +1177,21 @@ bool ConfigStorage::saveScreenConfigAsync(ScreenMode mode, int startHour, int st
 
 bool ConfigStorage::loadScreenConfigAsync(ScreenMode& mode, int& startHour, int& startMinute, 
                                          int& endHour, int& endMinute, int& timeoutMinutes, bool& autoRotationEnabled, int& staticRotation, uint32_t timeoutMs) {
+    ConfigCacheScreen cache;
+    if (readCache(&ConfigCache::screen, cache)) {
+        if (cache.loaded) {
+            mode = (ScreenMode)cache.mode;
+            startHour = cache.startHour;
+            startMinute = cache.startMinute;
+            endHour = cache.endHour;
+            endMinute = cache.endMinute;
+            timeoutMinutes = cache.timeoutMinutes;
+            autoRotationEnabled = cache.autoRotationEnabled;
+            staticRotation = cache.staticRotation;
+        }
+        return cache.loaded;
+    }
+
     ScreenConfigData result;
     ConfigRequest request;
     request.operation = CONFIG_OP_LOAD_SCREEN_CONFIG;
@@ -795,6 +1213,11 @@ bool ConfigStorage::loadScreenConfigAsync(ScreenMode& mode, int& startHour, int&
 }
 
 bool ConfigStorage::hasScreenConfigAsync(uint32_t timeoutMs) {
+    ConfigCacheScreen cache;
+    if (readCache(&ConfigCache::screen, cache)) {
+        return cache.exists;
+    }
+
     bool result = false;
     ConfigRequest request;
     request.operation = CONFIG_OP_HAS_SCREEN_CONFIG;
@@ -818,6 +1241,19 @@ bool ConfigStorage::saveServerConfigAsync(const String& serverUrl, int requestIn
 
 bool ConfigStorage::loadServerConfigAsync(String& serverUrl, int& requestInterval, 
                                          bool& enabled, int& connectionTimeout, bool& autoGetData, bool& autoScanServer, uint32_t timeoutMs) {
+    ConfigCacheServer cache;
+    if (readCache(&ConfigCache::server, cache)) {
+        if (cache.loaded) {
+            serverUrl = cache.serverUrl;
+            requestInterval = cache.requestInterval;
+            enabled = cache.enabled;
+            connectionTimeout = cache.connectionTimeout;
+            autoGetData = cache.autoGetData;
+            autoScanServer = cache.autoScanServer;
+        }
+        return cache.loaded;
+    }
+
     ServerConfigData result;
     ConfigRequest request;
     request.operation = CONFIG_OP_LOAD_SERVER_CONFIG;
@@ -837,6 +1273,11 @@ bool ConfigStorage::loadServerConfigAsync(String& serverUrl, int& requestInterva
 }
 
 bool ConfigStorage::hasServerConfigAsync(uint32_t timeoutMs) {
+    ConfigCacheServer cache;
+    if (readCache(&ConfigCache::server, cache)) {
+        return cache.exists;
+    }
+
     bool result = false;
     ConfigRequest request;
     request.operation = CONFIG_OP_HAS_SERVER_CONFIG;
@@ -867,6 +1308,12 @@ bool ConfigStorage::putStringAsync(const String& key, const String& value, uint3
 }
 
 String ConfigStorage::getStringAsync(const String& key, const String& defaultValue, uint32_t timeoutMs) {
+    ConfigCacheEntry entry;
+    if (findCacheEntry(key, CONFIG_CACHE_STRING, entry)) {
+        return entry.present ? String(entry.stringValue) : defaultValue;
+    }
+
+    // 未缓存的键由配置任务从NVS读取并加入缓存
     GenericConfigData data;
     data.key = key;
     data.defaultStringValue = defaultValue;
@@ -892,6 +1339,11 @@ bool ConfigStorage::putBoolAsync(const String& key, bool value, uint32_t timeout
 }
 
 bool ConfigStorage::getBoolAsync(const String& key, bool defaultValue, uint32_t timeoutMs) {
+    ConfigCacheEntry entry;
+    if (findCacheEntry(key, CONFIG_CACHE_BOOL, entry)) {
+        return entry.present ? (entry.intValue != 0) : defaultValue;
+    }
+
     GenericConfigData data;
     data.key = key;
     data.defaultBoolValue = defaultValue;
@@ -917,6 +1369,11 @@ bool ConfigStorage::putIntAsync(const String& key, int value, uint32_t timeoutMs
 }
 
 int ConfigStorage::getIntAsync(const String& key, int defaultValue, uint32_t timeoutMs) {
+    ConfigCacheEntry entry;
+    if (findCacheEntry(key, CONFIG_CACHE_INT, entry)) {
+        return entry.present ? entry.intValue : defaultValue;
+    }
+
     GenericConfigData data;
     data.key = key;
     data.defaultIntValue = defaultValue;
@@ -1903,19 +2360,23 @@ bool ConfigStorage::hasServerConfig() {
     return exists;
 }
 
-// 内部通用配置方法实现
+// 内部通用配置方法实现（写入和未命中的读取都会更新缓存条目）
 
 bool ConfigStorage::putString(const String& key, const String& value) {
     preferences.begin(SYSTEM_NAMESPACE, false);
     bool success = preferences.putString(key.c_str(), value) > 0;
     preferences.end();
+    // 写入失败时NVS中的值不确定，删除缓存条目，下次读取重新从NVS加载
+    storeCacheEntry(key, success ? CONFIG_CACHE_STRING : CONFIG_CACHE_EMPTY, true, 0, value);
     return success;
 }
 
 String ConfigStorage::getString(const String& key, const String& defaultValue) {
     preferences.begin(SYSTEM_NAMESPACE, true);
-    String value = preferences.getString(key.c_str(), defaultValue);
+    bool present = preferences.getType(key.c_str()) == PT_STR;
+    String value = present ? preferences.getString(key.c_str(), defaultValue) : defaultValue;
     preferences.end();
+    storeCacheEntry(key, CONFIG_CACHE_STRING, present, 0, present ? value : String());
     return value;
 }
 
@@ -1923,13 +2384,16 @@ bool ConfigStorage::putBool(const String& key, bool value) {
     preferences.begin(SYSTEM_NAMESPACE, false);
     bool success = preferences.putBool(key.c_str(), value);
     preferences.end();
+    storeCacheEntry(key, success ? CONFIG_CACHE_BOOL : CONFIG_CACHE_EMPTY, true, value ? 1 : 0, String());
     return success;
 }
 
 bool ConfigStorage::getBool(const String& key, bool defaultValue) {
     preferences.begin(SYSTEM_NAMESPACE, true);
-    bool value = preferences.getBool(key.c_str(), defaultValue);
+    bool present = preferences.getType(key.c_str()) == PT_U8;  // putBool按uint8_t保存
+    bool value = present ? preferences.getBool(key.c_str(), defaultValue) : defaultValue;
     preferences.end();
+    storeCacheEntry(key, CONFIG_CACHE_BOOL, present, value ? 1 : 0, String());
     return value;
 }
 
@@ -1937,12 +2401,15 @@ bool ConfigStorage::putInt(const String& key, int value) {
     preferences.begin(SYSTEM_NAMESPACE, false);
     bool success = preferences.putInt(key.c_str(), value) > 0;
     preferences.end();
+    storeCacheEntry(key, success ? CONFIG_CACHE_INT : CONFIG_CACHE_EMPTY, true, value, String());
     return success;
 }
 
 int ConfigStorage::getInt(const String& key, int defaultValue) {
     preferences.begin(SYSTEM_NAMESPACE, true);
-    int value = preferences.getInt(key.c_str(), defaultValue);
+    bool present = preferences.getType(key.c_str()) == PT_I32;
+    int value = present ? preferences.getInt(key.c_str(), defaultValue) : defaultValue;
     preferences.end();
+    storeCacheEntry(key, CONFIG_CACHE_INT, present, value, String());
     return value;
-}
\ No newline at end of file
+}
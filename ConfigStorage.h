@@ -2,6 +2,7 @@
  * ConfigStorage.h - NVS配置存储任务管理器头文件
  * ESP32S3监控项目 - 配置存储模块
  * 基于FreeRTOS任务实现，确保NVS操作的线程安全性
+ * 读取走内存缓存：init时从NVS加载，配置任务写入NVS后刷新，读取不排队、不访问NVS
  */
 
 #ifndef CONFIGSTORAGE_H
@@ -9,11 +10,21 @@
 
 #include <Preferences.h>
 #include <Arduino.h>
+#include <atomic>
 #include <freertos/FreeRTOS.h>
 #include <freertos/task.h>
 #include <freertos/queue.h>
 #include <freertos/semphr.h>
 
+// 配置缓存容量（字符串含结尾0，放不下的值不进缓存，读取时仍走配置任务）
+#define CONFIG_CACHE_SSID_SIZE        33    // WiFi SSID最长32字节
+#define CONFIG_CACHE_PASSWORD_SIZE    65    // WiFi密码最长64字节
+#define CONFIG_CACHE_NAME_SIZE        64    // 设备名、NTP服务器、时区
+#define CONFIG_CACHE_URL_SIZE         128   // 监控服务器地址
+#define CONFIG_CACHE_KEY_SIZE         16    // NVS键名最长15字节
+#define CONFIG_CACHE_VALUE_SIZE       128   // 通用字符串配置值
+#define CONFIG_CACHE_ENTRIES          24    // 通用配置缓存条目数
+
 // WiFi配置结构体
 struct WiFiConfig {
     String ssid;
@@ -211,6 +222,113 @@ struct GenericConfigData {
           defaultStringValue(""), defaultBoolValue(false), defaultIntValue(def) {}
 };
 
+// 配置缓存结构（纯数据，可直接复制；cached为false时该部分不可用，读取走配置任务）
+
+// 单WiFi配置缓存
+struct ConfigCacheWiFi {
+    bool cached;
+    bool loaded;                                // loadWiFiConfig()的结果
+    bool configured;                            // hasWiFiConfig()的结果
+    char ssid[CONFIG_CACHE_SSID_SIZE];
+    char password[CONFIG_CACHE_PASSWORD_SIZE];
+};
+
+// 多WiFi配置缓存（按优先级排序后的结果）
+struct ConfigCacheMultiWiFi {
+    bool cached;
+    bool loaded;                                // loadWiFiConfigs()的结果
+    int count;                                  // NVS中记录的配置数量
+    struct {
+        char ssid[CONFIG_CACHE_SSID_SIZE];
+        char password[CONFIG_CACHE_PASSWORD_SIZE];
+        int priority;
+        bool isValid;
+    } configs[3];
+};
+
+// 系统配置缓存
+struct ConfigCacheSystem {
+    bool cached;
+    bool loaded;                                // loadSystemConfig()的结果（首次启动命名空间不存在时为false）
+    char deviceName[CONFIG_CACHE_NAME_SIZE];
+    int refreshRate;
+};
+
+// 亮度和主题配置缓存
+struct ConfigCacheValue {
+    bool cached;
+    bool exists;                                // NVS中是否有该键
+    int value;                                  // 校验后的值
+};
+
+// 时间配置缓存
+struct ConfigCacheTime {
+    bool cached;
+    bool loaded;
+    char primaryServer[CONFIG_CACHE_NAME_SIZE];
+    char secondaryServer[CONFIG_CACHE_NAME_SIZE];
+    char timezone[CONFIG_CACHE_NAME_SIZE];
+    int syncInterval;
+};
+
+// 屏幕设置配置缓存
+struct ConfigCacheScreen {
+    bool cached;
+    bool loaded;
+    bool exists;
+    int mode;
+    int startHour;
+    int startMinute;
+    int endHour;
+    int endMinute;
+    int timeoutMinutes;
+    bool autoRotationEnabled;
+    int staticRotation;
+};
+
+// 服务器配置缓存
+struct ConfigCacheServer {
+    bool cached;
+    bool loaded;
+    bool exists;
+    char serverUrl[CONFIG_CACHE_URL_SIZE];
+    int requestInterval;
+    bool enabled;
+    int connectionTimeout;
+    bool autoGetData;
+    bool autoScanServer;
+};
+
+// 通用配置缓存条目类型
+enum ConfigCacheType : uint8_t {
+    CONFIG_CACHE_EMPTY = 0,
+    CONFIG_CACHE_STRING,
+    CONFIG_CACHE_BOOL,
+    CONFIG_CACHE_INT
+};
+
+// 通用配置缓存条目（首次读取时从NVS加载，写入时更新）
+struct ConfigCacheEntry {
+    char key[CONFIG_CACHE_KEY_SIZE];
+    ConfigCacheType type;
+    bool present;                               // NVS中是否有该键，没有时返回调用方的默认值
+    int intValue;                               // 整数和布尔值
+    char stringValue[CONFIG_CACHE_VALUE_SIZE];
+};
+
+// 全部配置缓存
+struct ConfigCache {
+    ConfigCacheWiFi wifi;
+    ConfigCacheMultiWiFi multiWiFi;
+    ConfigCacheSystem system;
+    ConfigCacheValue brightness;
+    ConfigCacheValue theme;
+    ConfigCacheTime time;
+    ConfigCacheScreen screen;
+    ConfigCacheServer server;
+    ConfigCacheEntry entries[CONFIG_CACHE_ENTRIES];
+};
+
 class ConfigStorage {
 public:
     ConfigStorage();
@@ -300,7 +418,12 @@ private:
     
     // NVS操作对象
     Preferences preferences;
-    
+
+    // 配置缓存（PSRAM中，init时分配并加载；分配失败时所有读取走配置任务）
+    ConfigCache* m_cache;
+    std::atomic<uint32_t> m_cacheSeq;   // 缓存序列号，奇数表示正在写入，读者据此重试
+    portMUX_TYPE m_cacheMux;            // 写入缓存时关中断，同核读者不会等待被抢占的写者
+
     // NVS命名空间
     static const char* WIFI_NAMESPACE;
     static const char* MULTI_WIFI_NAMESPACE;
@@ -416,6 +539,26 @@ private:
     
     // 辅助方法：发送请求并等待响应
     bool sendRequestAndWait(ConfigRequest* request, uint32_t timeoutMs);
+
+    // 配置缓存方法（刷新方法读NVS，只在init和配置任务中调用）
+    void loadCache();
+    void refreshCache();
+    void refreshCacheAfter(ConfigOperation operation);
+    void refreshWiFiCache();
+    void refreshMultiWiFiCache();
+    void refreshSystemCache();
+    void refreshBrightnessCache();
+    void refreshThemeCache();
+    void refreshTimeCache();
+    void refreshScreenCache();
+    void refreshServerCache();
+    void clearCacheEntries();
+
+    template <typename T> bool readCache(T ConfigCache::*section, T& out) const;
+    template <typename T> void writeCache(T ConfigCache::*section, const T& value);
+    bool findCacheEntry(const String& key, ConfigCacheType type, ConfigCacheEntry& entry) const;
+    void storeCacheEntry(const String& key, ConfigCacheType type, bool present, int intValue, const String& stringValue);
+    static bool copyCacheString(char* dst, size_t size, const String& value);
 };
 
 #endif // CONFIGSTORAGE_H 
\ No newline at end of file
@@ -18,6 +18,7 @@
  */
 
 #include "DisplayManager.h"
+#include "PowerDisplayUpdater.h"
 #include "WiFiManager.h"
 #include "ConfigStorage.h"
 #include "PSRAMManager.h"
@@ -27,7 +28,10 @@
 #include <cstring>
 #include <cstdio>
 #include <cmath>
+#include <sys/time.h>
 #include <time.h>
+#include <esp_timer.h>
+#include <esp_heap_caps.h>
 
 #ifndef M_PI
 #define M_PI 3.14159265358979323846
@@ -39,6 +43,8 @@ DisplayManager* DisplayManager::s_instance = nullptr;
 // UI系统助手头文件
 #include "ui_helpers.h"
 #include "ui2_helpers.h"
+#include "RLEImageDecoder.h"
+#include "AssetManager.h"
 
 // 外部声明UI1系统的屏幕对象
 extern lv_obj_t * ui_standbySCREEN;
@@ -213,6 +219,7 @@ DisplayManager::DisplayManager()
     , m_configStorage(nullptr)
     , m_psramManager(nullptr)
     , m_weatherManager(nullptr)
+    , m_assetManager(nullptr)
     , m_currentPage(PAGE_HOME)
     , m_currentTheme(THEME_UI1)
     , m_brightness(80)
@@ -274,8 +281,18 @@ DisplayManager::DisplayManager()
     , m_wifiInfoDisplayActive(false)
     , m_wifiInfoPendingDestroy(false)
     , m_lastWiFiSwitchTime(0)
-    , m_firstSwipeTime(0)
     , m_swipeCount(0)
+    , m_powerState(DISPLAY_POWER_ACTIVE)
+    , m_renderSuspendEnabled(true)
+    , m_uiDirty(false)
+    , m_catchUpPending(false)
+    , m_darkStartTime(0)
+    , m_screenRefreshPending(false)
+    , m_taskStatsStartUs(0)
+    , m_msgLatencyTotalUs(0)
+    , m_soakStopRequested(false)
+    , m_soakSwitchDone(nullptr)
+    , m_soakSwitchUs(0)
 {
     // 设置全局实例指针
     s_instance = this;
@@ -285,6 +302,16 @@ DisplayManager::DisplayManager()
     m_powerData.port_count = 4;
     m_powerData.valid = false;
     
+    // 初始化显示任务调度统计
+    memset(&m_taskStats, 0, sizeof(m_taskStats));
+    
+    // 初始化显示电源状态统计
+    memset(&m_powerStats, 0, sizeof(m_powerStats));
+    m_powerStats.state = DISPLAY_POWER_ACTIVE;
+    
+    // 初始化主题切换压力测试结果
+    memset(&m_soakStats, 0, sizeof(m_soakStats));
+    
     // 初始化端口功率和状态历史
     for (int i = 0; i < 4; i++) {
         m_previousPortPower[i] = 0;
@@ -298,7 +325,41 @@ DisplayManager::DisplayManager()
 /**
  * @brief 析构函数
  */
+/**
+ * @brief 内存回收：按LRU释放未在显示的资源包资源
+ *
+ * 可能在持有LVGL锁的任务的分配路径上调用，只尝试零等待加锁
+ */
+static size_t reclaimAssetCache(size_t bytes, MemPressure pressure, void* userdata) {
+    DisplayManager* manager = static_cast<DisplayManager*>(userdata);
+    AssetManager* assets = manager->getAssetManager();
+    if (!assets || !assets->isReady() || !manager->getLVGLDriver()->lock(0)) {
+        return 0;
+    }
+    size_t freed = assets->trimCache(bytes);
+    manager->getLVGLDriver()->unlock();
+    return freed;
+}
+
+/**
+ * @brief 内存回收：释放背景图解码缓存（压力解除前按行解码，由屏幕维护定时器恢复）
+ */
+static size_t reclaimImageCache(size_t bytes, MemPressure pressure, void* userdata) {
+    DisplayManager* manager = static_cast<DisplayManager*>(userdata);
+    if (!manager->getLVGLDriver()->lock(0)) {
+        return 0;
+    }
+    size_t freed = RLEImageDecoder::reclaimCache();
+    manager->getLVGLDriver()->unlock();
+    return freed;
+}
+
 DisplayManager::~DisplayManager() {
+    if (m_psramManager) {
+        m_psramManager->unregisterReclaimer(reclaimAssetCache, this);
+        m_psramManager->unregisterReclaimer(reclaimImageCache, this);
+    }
+    
     stop();
     
     // 清理OTA页面资源
@@ -314,6 +375,11 @@ DisplayManager::~DisplayManager() {
         m_messageQueue = nullptr;
     }
     
+    if (m_soakSwitchDone) {
+        vSemaphoreDelete(m_soakSwitchDone);
+        m_soakSwitchDone = nullptr;
+    }
+    
     printf("[DisplayManager] 显示管理器已销毁\n");
 }
 
@@ -340,6 +406,28 @@ bool DisplayManager::init(LVGLDriver* lvgl_driver, WiFiManager* wifi_manager, Co
     m_psramManager = psram_manager;
     m_weatherManager = weather_manager;
     
+    // 背光渐变定时器和查找表
+    if (!m_fader.init(m_lvglDriver)) {
+        printf("[DisplayManager] 警告：背光渐变初始化失败，渐变将直接切换亮度\n");
+    }
+    m_fader.setCompletionCallback(fadeCompleteCallback, this);
+    
+    // 手势识别在LVGL触摸读取中完成，识别结果直接作为消息送到显示任务
+    m_lvglDriver->getGestureEngine().setCallback(gestureCallback, this);
+    
+    // 内存紧张时先释放资源包缓存，严重不足时再释放正在使用的背景图解码缓存
+    if (m_psramManager) {
+        m_psramManager->registerReclaimer("资源包缓存", MEM_RECLAIM_CACHE, MEM_CAP_SPIRAM, reclaimAssetCache, this);
+        m_psramManager->registerReclaimer("背景图解码缓存", MEM_RECLAIM_CRITICAL, MEM_CAP_SPIRAM, reclaimImageCache, this);
+    }
+    
+#if SCREEN_MIRROR_ENABLED
+    // 屏幕镜像（没有客户端时刷新回调只检查一个标志）
+    if (!m_screenMirror.init(m_lvglDriver, m_psramManager)) {
+        printf("[DisplayManager] 警告：屏幕镜像初始化失败\n");
+    }
+#endif
+    
     // 创建消息队列
     m_messageQueue = xQueueCreate(MESSAGE_QUEUE_SIZE, sizeof(DisplayMessage));
     if (!m_messageQueue) {
@@ -369,12 +457,35 @@ bool DisplayManager::init(LVGLDriver* lvgl_driver, WiFiManager* wifi_manager, Co
         printf("[DisplayManager] 使用默认主题: UI1\n");
     }
     
+    // 加载保存的UI资源包路径
+    String assetPack;
+    if (m_assetManager && m_assetManager->isReady()) {
+        assetPack = m_configStorage->getStringAsync("asset_pack", "", 3000);
+    }
+    
+#if POWER_TREND_ENABLED
+    // 初始化功率历史并加载保存的趋势图窗口
+    if (m_powerTrend.init(m_psramManager)) {
+        int trendWindow = m_configStorage->getIntAsync("trend_window", POWER_TREND_DEFAULT_MIN, 3000);
+        if (!m_powerTrend.setWindowMinutes((uint16_t)trendWindow)) {
+            printf("[DisplayManager] 警告：保存的趋势图窗口无效(%d)，使用默认窗口\n", trendWindow);
+        }
+    }
+#endif
+    
     // 获取LVGL锁并初始化对应的UI系统
     if (m_lvglDriver->lock(5000)) {
         // 根据目标主题初始化相应的UI系统
         if (targetTheme == THEME_UI1) {
             // 初始化UI1系统
-            ui_init();
+            preloadThemeImages(THEME_UI1);
+            m_screenManager.begin(SCREEN_SET_UI1);
+            
+            // 应用资源包（屏幕加载时替换为资源包中的图片和字体）
+            if (m_assetManager) {
+                m_assetManager->setActivePack(assetPack);
+                m_assetManager->attachScreens();
+            }
             
             // 获取主屏幕
             m_screen = lv_scr_act();
@@ -387,6 +498,7 @@ bool DisplayManager::init(LVGLDriver* lvgl_driver, WiFiManager* wifi_manager, Co
             // 显示默认页面（待机屏幕）
             if (ui_standbySCREEN) {
                 lv_scr_load(ui_standbySCREEN);
+                m_screenManager.noteShown(ui_standbySCREEN);
                 printf("[DisplayManager] 显示UI1默认页面：待机屏幕\n");
             }
             
@@ -395,7 +507,14 @@ bool DisplayManager::init(LVGLDriver* lvgl_driver, WiFiManager* wifi_manager, Co
             
         } else if (targetTheme == THEME_UI2) {
             // 直接初始化UI2系统
-            ui2_init();
+            preloadThemeImages(THEME_UI2);
+            m_screenManager.begin(SCREEN_SET_UI2);
+            
+            // 应用资源包（屏幕加载时替换为资源包中的图片和字体）
+            if (m_assetManager) {
+                m_assetManager->setActivePack(assetPack);
+                m_assetManager->attachScreens();
+            }
             
             // 获取主屏幕
             m_screen = lv_scr_act();
@@ -408,6 +527,7 @@ bool DisplayManager::init(LVGLDriver* lvgl_driver, WiFiManager* wifi_manager, Co
             // 显示默认页面（待机屏幕）
             if (ui2_standbySCREEN) {
                 lv_scr_load(ui2_standbySCREEN);
+                m_screenManager.noteShown(ui2_standbySCREEN);
                 printf("[DisplayManager] 显示UI2默认页面：待机屏幕\n");
             }
             
@@ -415,6 +535,9 @@ bool DisplayManager::init(LVGLDriver* lvgl_driver, WiFiManager* wifi_manager, Co
             printf("[DisplayManager] UI2系统初始化完成\n");
         }
         
+        // 在已创建的功率屏幕上挂载趋势图（需在确定主题后）
+        attachPowerTrends();
+        
         // 初始化时间和日期显示
         updateTimeDisplay();
         
@@ -540,86 +663,279 @@ void DisplayManager::displayTaskEntry(void* arg) {
 
 /**
  * @brief 显示管理器任务执行函数
+ * 
+ * 任务阻塞在任务通知上，只在有消息、状态事件或软定时器到期时唤醒；
+ * 空闲时的等待时长由最近到期的软定时器决定，没有定时器时无限等待。
  */
 void DisplayManager::displayTask() {
     printf("[DisplayManager] 显示管理器任务开始运行\n");
     
     DisplayMessage msg;
-    TickType_t lastUpdateTime = 0;
-    const TickType_t updateInterval = pdMS_TO_TICKS(1000); // 1秒更新间隔
+    m_taskStatsStartUs = esp_timer_get_time();
+    
+    // 任务启动前已入队的消息在第一次唤醒时处理
+    notifyTask(TASK_EVT_MESSAGE);
     
     while (m_running) {
-        // 处理消息队列中的消息
-        BaseType_t queueResult = xQueueReceive(m_messageQueue, &msg, pdMS_TO_TICKS(100));
-        if (queueResult == pdTRUE) {
+        armTimers();
+        
+        uint32_t events = 0;
+        if (xTaskNotifyWait(0, UINT32_MAX, &events, m_timers.ticksUntilNext()) == pdTRUE) {
+            m_taskStats.event_wakeups++;
+        } else {
+            m_taskStats.timer_wakeups++;
+        }
+        m_taskStats.wakeups++;
+        
+        // 处理消息队列中的所有消息（不等待）
+        while (xQueueReceive(m_messageQueue, &msg, 0) == pdTRUE) {
+            uint32_t latency = (uint32_t)(esp_timer_get_time() - msg.queued_us);
+            m_msgLatencyTotalUs += latency;
+            if (latency > m_taskStats.max_msg_latency_us) {
+                m_taskStats.max_msg_latency_us = latency;
+            }
+            m_taskStats.messages++;
             processMessage(msg);
         }
         
-        // 定期更新时间显示和屏幕模式检查
-        TickType_t currentTime = xTaskGetTickCount();
-        if (currentTime - lastUpdateTime >= updateInterval) {
-            // 更新时间显示
-            updateTimeDisplay();
+        // 亮灭屏后按新状态的间隔重新设置周期定时器
+        if (events & TASK_EVT_POWER) {
+            m_timers.cancel(TIMER_SCREEN_MODE);
+            m_timers.cancel(TIMER_MAINTENANCE);
+        }
+        // 页面切换检查间隔可能已修改
+        if (events & TASK_EVT_STATE) {
+            m_timers.cancel(TIMER_POWER_PAGE);
+        }
+        
+        // 唤醒后补齐UI并恢复渲染（须在LVGL锁外执行）
+        processPowerState();
+        
+        // 新创建的屏幕显示的是SquareLine默认文本，立即补齐数据（须在LVGL锁外执行）
+        if (m_screenRefreshPending) {
+            m_screenRefreshPending = false;
+            if (isUIUpdateSuspended()) {
+                m_uiDirty = true;
+            } else {
+                updatePowerDataDisplay();
+                for (int i = 0; i < 4; i++) {
+                    updatePortDetailDisplay(i);
+                }
+                updateTimeDisplay();
+                updateWeatherDisplay();
+            }
+        }
+        
+        // 渐变由背光定时器推进，完成时背光发送任务通知这里更新屏幕状态
+        if (m_isFading) {
+            processFading();
+        }
+        
+        // 执行到期的软定时器（上面的处理可能改变状态，先重新设置）
+        armTimers();
+        int id;
+        while ((id = m_timers.popDue()) >= 0) {
+            m_taskStats.timer_fires++;
+            runTimer(id);
+        }
+    }
+    
+    printf("[DisplayManager] 显示管理器任务结束\n");
+}
+
+/**
+ * @brief 发送消息到显示任务并唤醒任务
+ */
+BaseType_t DisplayManager::postMessage(DisplayMessage& msg, TickType_t timeout) {
+    if (!m_messageQueue) {
+        return pdFALSE;
+    }
+    
+    msg.queued_us = esp_timer_get_time();
+    BaseType_t result = xQueueSend(m_messageQueue, &msg, timeout);
+    if (result == pdTRUE) {
+        notifyTask(TASK_EVT_MESSAGE);
+    }
+    return result;
+}
+
+/**
+ * @brief 设置显示任务事件位
+ */
+void DisplayManager::notifyTask(uint32_t events) {
+    if (m_taskHandle) {
+        xTaskNotify(m_taskHandle, events, eSetBits);
+    }
+}
+
+/**
+ * @brief 背光渐变完成回调
+ */
+void DisplayManager::fadeCompleteCallback(void* arg) {
+    static_cast<DisplayManager*>(arg)->notifyTask(TASK_EVT_FADE);
+}
+
+/**
+ * @brief 手势回调（LVGL任务中调用，不能阻塞）
+ */
+void DisplayManager::gestureCallback(const GestureEvent& event, void* userdata) {
+    DisplayManager* manager = static_cast<DisplayManager*>(userdata);
+    DisplayMessage msg;
+    msg.type = DisplayMessage::MSG_GESTURE;
+    msg.data.gesture.event = event;
+    if (manager->postMessage(msg, 0) != pdTRUE) {
+        printf("[DisplayManager] 警告：消息队列已满，丢弃手势（%s）\n", GestureEngine::typeName(event.type));
+    }
+}
+
+/**
+ * @brief 按当前状态设置或取消软定时器
+ * 
+ * 周期定时器只在未设置时设置，频繁的消息唤醒不会推迟它们的到期时间；
+ * 单次超时按状态中记录的起始时间计算到期时间，重复设置结果相同。
+ */
+void DisplayManager::armTimers() {
+    bool suspended = isUIUpdateSuspended();
+    
+    // 时间标签显示秒，对齐到下一个整秒（留几毫秒余量），熄屏时停止
+    if (suspended) {
+        m_timers.cancel(TIMER_CLOCK);
+    } else if (!m_timers.isArmed(TIMER_CLOCK)) {
+        struct timeval tv;
+        gettimeofday(&tv, nullptr);
+        m_timers.arm(TIMER_CLOCK, 1000 - tv.tv_usec / 1000 + 5);
+    }
+    
+    // 天气数据由天气管理器定时获取，标签定期同步即可，熄屏时停止
+    if (suspended) {
+        m_timers.cancel(TIMER_WEATHER);
+    } else if (!m_timers.isArmed(TIMER_WEATHER)) {
+        m_timers.arm(TIMER_WEATHER, WEATHER_REFRESH_INTERVAL);
+    }
+    
+    // 延时模式需要按功率及时亮屏，熄屏时保持原检查间隔
+    if (!m_timers.isArmed(TIMER_SCREEN_MODE)) {
+        bool slow = suspended && m_screenMode != SCREEN_MODE_TIMEOUT;
+        m_timers.arm(TIMER_SCREEN_MODE, slow ? SCREEN_MODE_DARK_CHECK_INTERVAL : SCREEN_MODE_CHECK_INTERVAL);
+    }
+    
+    if (!m_timers.isArmed(TIMER_MAINTENANCE)) {
+        m_timers.arm(TIMER_MAINTENANCE, suspended ? MAINTENANCE_DARK_INTERVAL : MAINTENANCE_INTERVAL);
+    }
+    
+    if (!m_powerBasedAutoSwitchEnabled) {
+        m_timers.cancel(TIMER_POWER_PAGE);
+    } else if (!m_timers.isArmed(TIMER_POWER_PAGE)) {
+        m_timers.arm(TIMER_POWER_PAGE, m_powerCheckInterval);
+    }
+    
+    if (m_isInAutoSwitchMode) {
+        m_timers.armAt(TIMER_AUTO_SWITCH, pdMS_TO_TICKS(m_autoSwitchStartTime + m_autoSwitchDuration));
+    } else {
+        m_timers.cancel(TIMER_AUTO_SWITCH);
+    }
+    
+    if (!m_wifiInfoPendingDestroy) {
+        m_timers.cancel(TIMER_WIFI_DESTROY);
+    } else if (!m_timers.isArmed(TIMER_WIFI_DESTROY)) {
+        m_timers.arm(TIMER_WIFI_DESTROY, WIFI_DESTROY_CHECK_INTERVAL);
+    }
+    
+#if POWER_TREND_ENABLED
+    // 熄屏期间不追加数据点，唤醒后由第一次到期一并补齐
+    if (suspended) {
+        m_timers.cancel(TIMER_TREND);
+    } else if (!m_timers.isArmed(TIMER_TREND)) {
+        m_timers.arm(TIMER_TREND, m_powerTrend.getNextPointDelayMs());
+    }
+#endif
+    
+    m_taskStats.armed_timers = m_timers.count();
+}
+
+/**
+ * @brief 执行到期的软定时器
+ */
+void DisplayManager::runTimer(int id) {
+    switch (id) {
+        case TIMER_CLOCK:
+            if (isUIUpdateSuspended()) {
+                m_uiDirty = true;
+                m_powerStats.skipped_updates++;
+            } else {
+                updateTimeDisplay();
+            }
+            break;
             
-            // 更新天气显示
-            updateWeatherDisplay();
+        case TIMER_WEATHER:
+            if (isUIUpdateSuspended()) {
+                m_uiDirty = true;
+                m_powerStats.skipped_updates++;
+            } else {
+                updateWeatherDisplay();
+            }
+            break;
             
-            // 处理屏幕模式管理逻辑
+        case TIMER_SCREEN_MODE:
             processScreenModeLogic();
+            break;
+            
+        case TIMER_POWER_PAGE:
+            checkPowerBasedPageSwitch();
+            break;
             
-            // 检查自动切换超时
+        case TIMER_AUTO_SWITCH:
             checkAutoSwitchTimeout();
+            break;
             
-            // 检查基于总功率的页面切换
-            checkPowerBasedPageSwitch();
+        case TIMER_MAINTENANCE:
+            processScreenMaintenance();
+            break;
             
-            // 检查三击手势超时
-            checkTripleSwipeTimeout();
+        case TIMER_TREND:
+            processPowerTrend();
+            break;
             
-            // 处理WiFi信息页面的延迟销毁
-            if (m_wifiInfoPendingDestroy) {
-                printf("[DisplayManager] 执行WiFi信息页面延迟销毁检查\n");
-                
-                // 简化检查：确保WiFi信息页面对象存在且显示状态已清除
-                if (m_wifiInfoScreen && !m_wifiInfoDisplayActive) {
-                    printf("[DisplayManager] 条件满足，通过消息队列安全销毁WiFi信息页面\n");
-                    
-                    // 通过消息队列发送销毁命令，确保在LVGL锁保护下执行
-                    DisplayMessage msg;
-                    msg.type = DisplayMessage::MSG_DESTROY_WIFI_INFO;
-                    
-                    if (xQueueSend(m_messageQueue, &msg, pdMS_TO_TICKS(100)) == pdTRUE) {
-                        printf("[DisplayManager] WiFi信息页面销毁消息已发送到队列\n");
-                        m_wifiInfoPendingDestroy = false; // 清除标志，避免重复发送
-                    } else {
-                        printf("[DisplayManager] 错误：发送WiFi信息页面销毁消息失败\n");
-                    }
-                } else if (!m_wifiInfoScreen) {
-                    // 对象已经不存在，清除标志
-                    printf("[DisplayManager] WiFi信息页面对象已不存在，清除销毁标志\n");
-                    m_wifiInfoPendingDestroy = false;
-                } else {
-                    printf("[DisplayManager] WiFi信息页面显示仍处于活动状态，等待状态清除\n");
-                }
-            }
+        case TIMER_WIFI_DESTROY:
+            processWiFiInfoDestroy();
+            break;
             
-            lastUpdateTime = currentTime;
-        }
+        default:
+            break;
+    }
+}
+
+/**
+ * @brief 处理WiFi信息页面的延迟销毁
+ */
+void DisplayManager::processWiFiInfoDestroy() {
+    if (!m_wifiInfoPendingDestroy) {
+        return;
+    }
+    
+    printf("[DisplayManager] 执行WiFi信息页面延迟销毁检查\n");
+    
+    // 简化检查：确保WiFi信息页面对象存在且显示状态已清除
+    if (m_wifiInfoScreen && !m_wifiInfoDisplayActive) {
+        printf("[DisplayManager] 条件满足，通过消息队列安全销毁WiFi信息页面\n");
         
-        // 处理亮度渐变（更高频率更新以确保平滑渐变）
-        if (m_isFading && m_fadingEnabled) {
-            processFading();
-        }
+        // 通过消息队列发送销毁命令，确保在LVGL锁保护下执行
+        DisplayMessage msg;
+        msg.type = DisplayMessage::MSG_DESTROY_WIFI_INFO;
         
-        // 渐变期间使用更短的延迟以获得更平滑的效果
-        if (m_isFading && m_fadingEnabled) {
-            vTaskDelay(pdMS_TO_TICKS(10)); // 渐变时10ms更新间隔
+        if (postMessage(msg, pdMS_TO_TICKS(100)) == pdTRUE) {
+            printf("[DisplayManager] WiFi信息页面销毁消息已发送到队列\n");
+            m_wifiInfoPendingDestroy = false; // 清除标志，避免重复发送
         } else {
-            vTaskDelay(pdMS_TO_TICKS(50)); // 正常时50ms延迟
+            printf("[DisplayManager] 错误：发送WiFi信息页面销毁消息失败\n");
         }
+    } else if (!m_wifiInfoScreen) {
+        // 对象已经不存在，清除标志
+        printf("[DisplayManager] WiFi信息页面对象已不存在，清除销毁标志\n");
+        m_wifiInfoPendingDestroy = false;
+    } else {
+        printf("[DisplayManager] WiFi信息页面显示仍处于活动状态，等待状态清除\n");
     }
-    
-    printf("[DisplayManager] 显示管理器任务结束\n");
 }
 
 /**
@@ -632,6 +948,12 @@ void DisplayManager::processMessage(const DisplayMessage& msg) {
         return;
     }
     
+    // 手势只更新状态或转发消息，不需要LVGL锁
+    if (msg.type == DisplayMessage::MSG_GESTURE) {
+        handleGesture(msg.data.gesture.event);
+        return;
+    }
+    
     if (!m_lvglDriver->lock(1000)) {
         printf("[DisplayManager] 警告：处理消息时获取LVGL锁失败\n");
         return;
@@ -686,118 +1008,24 @@ void DisplayManager::processMessage(const DisplayMessage& msg) {
                     if (m_swipeCount > 0) {
                         printf("[DisplayManager] 切换到待机页面，重置三击手势状态\n");
                         m_swipeCount = 0;
-                        m_firstSwipeTime = 0;
                     }
                 }
                 
                 // 根据当前主题和页面类型执行实际的屏幕切换
                 bool switchSuccess = false;
                 
-                if (m_currentTheme == THEME_UI1) {
-                    // UI1系统的页面切换
-                    switch (newPage) {
-                        case PAGE_HOME:
-                            if (ui_standbySCREEN) {
-                                _ui_screen_change(&ui_standbySCREEN, LV_SCR_LOAD_ANIM_MOVE_RIGHT, 500, 0, &ui_standbySCREEN_screen_init);
-                                m_currentPage = newPage;
-                                switchSuccess = true;
-                            }
-                            break;
-                        case PAGE_POWER_TOTAL:
-                            if (ui_totalpowerSCREEN) {
-                                _ui_screen_change(&ui_totalpowerSCREEN, LV_SCR_LOAD_ANIM_MOVE_RIGHT, 500, 0, &ui_totalpowerSCREEN_screen_init);
-                                m_currentPage = newPage;
-                                switchSuccess = true;
-                            }
-                            break;
-                        case PAGE_POWER_PORT1:
-                            if (ui_prot1SCREEN) {
-                                _ui_screen_change(&ui_prot1SCREEN, LV_SCR_LOAD_ANIM_MOVE_RIGHT, 500, 0, &ui_prot1SCREEN_screen_init);
-                                m_currentPage = newPage;
-                                switchSuccess = true;
-                            }
-                            break;
-                        case PAGE_POWER_PORT2:
-                            if (ui_prot2SCREEN) {
-                                _ui_screen_change(&ui_prot2SCREEN, LV_SCR_LOAD_ANIM_MOVE_RIGHT, 500, 0, &ui_prot2SCREEN_screen_init);
-                                m_currentPage = newPage;
-                                switchSuccess = true;
-                            }
-                            break;
-                        case PAGE_POWER_PORT3:
-                            if (ui_prot3SCREEN) {
-                                _ui_screen_change(&ui_prot3SCREEN, LV_SCR_LOAD_ANIM_MOVE_RIGHT, 500, 0, &ui_prot3SCREEN_screen_init);
-                                m_currentPage = newPage;
-                                switchSuccess = true;
-                            }
-                            break;
-                        case PAGE_POWER_PORT4:
-                            if (ui_prot4SCREEN) {
-                                _ui_screen_change(&ui_prot4SCREEN, LV_SCR_LOAD_ANIM_MOVE_RIGHT, 500, 0, &ui_prot4SCREEN_screen_init);
-                                m_currentPage = newPage;
-                                switchSuccess = true;
-                            }
-                            break;
-                        case PAGE_WIFI_STATUS:
-                            // WiFi信息页面（统一处理，不依赖UI系统）
-                            // 注意：这里不能调用switchToWiFiInfoPage()，因为那会导致递归
-                            // WiFi信息页面应该通过showWiFiInfoPage()直接调用
-                            printf("[DisplayManager] 警告：PAGE_WIFI_STATUS应该通过showWiFiInfoPage()调用，而不是switchPage()\n");
-                            switchSuccess = false;
-                            break;
-                    }
-                } else if (m_currentTheme == THEME_UI2) {
-                    // UI2系统的页面切换
-                    switch (newPage) {
-                        case PAGE_HOME:
-                            if (ui2_standbySCREEN) {
-                                _ui2_screen_change(&ui2_standbySCREEN, LV_SCR_LOAD_ANIM_OVER_BOTTOM, 500, 0, &ui2_standbySCREEN_screen_init);
-                                m_currentPage = newPage;
-                                switchSuccess = true;
-                            }
-                            break;
-                        case PAGE_POWER_TOTAL:
-                            if (ui2_totalpowerSCREEN) {
-                                _ui2_screen_change(&ui2_totalpowerSCREEN, LV_SCR_LOAD_ANIM_MOVE_RIGHT, 500, 0, &ui2_totalpowerSCREEN_screen_init);
-                                m_currentPage = newPage;
-                                switchSuccess = true;
-                            }
-                            break;
-                        case PAGE_POWER_PORT1:
-                            if (ui2_port1SCREEN) {
-                                _ui2_screen_change(&ui2_port1SCREEN, LV_SCR_LOAD_ANIM_MOVE_RIGHT, 500, 0, &ui2_port1SCREEN_screen_init);
-                                m_currentPage = newPage;
-                                switchSuccess = true;
-                            }
-                            break;
-                        case PAGE_POWER_PORT2:
-                            if (ui2_port2SCREEN) {
-                                _ui2_screen_change(&ui2_port2SCREEN, LV_SCR_LOAD_ANIM_MOVE_RIGHT, 500, 0, &ui2_port2SCREEN_screen_init);
-                                m_currentPage = newPage;
-                                switchSuccess = true;
-                            }
-                            break;
-                        case PAGE_POWER_PORT3:
-                            if (ui2_port3SCREEN) {
-                                _ui2_screen_change(&ui2_port3SCREEN, LV_SCR_LOAD_ANIM_MOVE_RIGHT, 500, 0, &ui2_port3SCREEN_screen_init);
-                                m_currentPage = newPage;
-                                switchSuccess = true;
-                            }
-                            break;
-                        case PAGE_POWER_PORT4:
-                            if (ui2_port4SCREEN) {
-                                _ui2_screen_change(&ui2_port4SCREEN, LV_SCR_LOAD_ANIM_MOVE_RIGHT, 500, 0, &ui2_port4SCREEN_screen_init);
-                                m_currentPage = newPage;
-                                switchSuccess = true;
-                            }
-                            break;
-                        case PAGE_WIFI_STATUS:
-                            // WiFi信息页面（统一处理，不依赖UI系统）
-                            // 注意：这里不能调用switchToWiFiInfoPage()，因为那会导致递归
-                            // WiFi信息页面应该通过showWiFiInfoPage()直接调用
-                            printf("[DisplayManager] 警告：PAGE_WIFI_STATUS应该通过showWiFiInfoPage()调用，而不是switchPage()\n");
-                            switchSuccess = false;
-                            break;
+                if (newPage == PAGE_WIFI_STATUS) {
+                    // WiFi信息页面（统一处理，不依赖UI系统）
+                    // 注意：这里不能调用switchToWiFiInfoPage()，因为那会导致递归
+                    // WiFi信息页面应该通过showWiFiInfoPage()直接调用
+                    printf("[DisplayManager] 警告：PAGE_WIFI_STATUS应该通过showWiFiInfoPage()调用，而不是switchPage()\n");
+                } else {
+                    // 目标屏幕未创建时由屏幕管理器现场创建（UI2返回待机页使用从底部覆盖动画）
+                    lv_scr_load_anim_t anim = (m_currentTheme == THEME_UI2 && newPage == PAGE_HOME)
+                        ? LV_SCR_LOAD_ANIM_OVER_BOTTOM : LV_SCR_LOAD_ANIM_MOVE_RIGHT;
+                    if (m_screenManager.load(newPage, anim, 500)) {
+                        m_currentPage = newPage;
+                        switchSuccess = true;
                     }
                 }
                 
@@ -820,10 +1048,26 @@ void DisplayManager::processMessage(const DisplayMessage& msg) {
             
 
             
-        case DisplayMessage::MSG_SET_THEME:
-            // 主题切换改为重启系统的方式，此消息类型保留为兼容性
-            printf("[DisplayManager] 主题切换消息（将通过系统重启应用）：%d\n", msg.data.theme.theme);
+        case DisplayMessage::MSG_SET_THEME: {
+            // 运行时切换主题（已在LVGL锁保护下），自动主题暂按UI1处理
+            DisplayTheme theme = (msg.data.theme.theme == THEME_UI2) ? THEME_UI2 : THEME_UI1;
+            uint32_t switchUs = 0;
+            if (m_otaDisplayActive) {
+                // OTA结束后会重启，已保存的主题届时生效
+                printf("[DisplayManager] OTA进行中，暂不切换主题\n");
+            } else if (theme != m_currentTheme || !m_uiSystemActive) {
+                switchUs = switchUISystemLocked(theme);
+                if (!m_soakStats.running) {
+                    printf("[DisplayManager] 主题已切换到UI%d，耗时 %lu us\n", theme == THEME_UI1 ? 1 : 2, (unsigned long)switchUs);
+                }
+            }
+            // 压力测试在切换完成后才采样内存
+            if (m_soakStats.running && m_soakSwitchDone) {
+                m_soakSwitchUs = switchUs;
+                xSemaphoreGive(m_soakSwitchDone);
+            }
             break;
+        }
             
         case DisplayMessage::MSG_SHOW_NOTIFICATION:
             // 显示通知（暂时简化为控制台输出，后续可在UI1/UI2系统中重新实现）
@@ -976,34 +1220,17 @@ void DisplayManager::processMessage(const DisplayMessage& msg) {
                 // 根据目标页面和当前UI主题直接切换
                 switch (m_previousPageForWiFi) {
                     case PAGE_HOME:
-                        if (m_currentTheme == THEME_UI1 && ui_standbySCREEN) {
-                            _ui_screen_change(&ui_standbySCREEN, LV_SCR_LOAD_ANIM_MOVE_LEFT, 300, 0, &ui_standbySCREEN_screen_init);
-                            switchSuccess = true;
-                        } else if (m_currentTheme == THEME_UI2 && ui2_standbySCREEN) {
-                            _ui2_screen_change(&ui2_standbySCREEN, LV_SCR_LOAD_ANIM_MOVE_LEFT, 300, 0, &ui2_standbySCREEN_screen_init);
-                            switchSuccess = true;
-                        }
+                        switchSuccess = m_screenManager.load(PAGE_HOME, LV_SCR_LOAD_ANIM_MOVE_LEFT, 300);
                         break;
                         
                     case PAGE_POWER_TOTAL:
-                        if (m_currentTheme == THEME_UI1 && ui_totalpowerSCREEN) {
-                            _ui_screen_change(&ui_totalpowerSCREEN, LV_SCR_LOAD_ANIM_MOVE_RIGHT, 300, 0, &ui_totalpowerSCREEN_screen_init);
-                            switchSuccess = true;
-                        } else if (m_currentTheme == THEME_UI2 && ui2_totalpowerSCREEN) {
-                            _ui2_screen_change(&ui2_totalpowerSCREEN, LV_SCR_LOAD_ANIM_MOVE_RIGHT, 300, 0, &ui2_totalpowerSCREEN_screen_init);
-                            switchSuccess = true;
-                        }
+                        switchSuccess = m_screenManager.load(PAGE_POWER_TOTAL, LV_SCR_LOAD_ANIM_MOVE_RIGHT, 300);
                         break;
                         
                     // 其他页面可以根据需要扩展
                     default:
                         printf("[DisplayManager] 暂不支持返回到页面：%d，默认返回待机页面\n", m_previousPageForWiFi);
-                        if (m_currentTheme == THEME_UI1 && ui_standbySCREEN) {
-                            _ui_screen_change(&ui_standbySCREEN, LV_SCR_LOAD_ANIM_MOVE_RIGHT, 300, 0, &ui_standbySCREEN_screen_init);
-                            m_previousPageForWiFi = PAGE_HOME;
-                            switchSuccess = true;
-                        } else if (m_currentTheme == THEME_UI2 && ui2_standbySCREEN) {
-                            _ui2_screen_change(&ui2_standbySCREEN, LV_SCR_LOAD_ANIM_MOVE_RIGHT, 300, 0, &ui2_standbySCREEN_screen_init);
+                        if (m_screenManager.load(PAGE_HOME, LV_SCR_LOAD_ANIM_MOVE_RIGHT, 300)) {
                             m_previousPageForWiFi = PAGE_HOME;
                             switchSuccess = true;
                         }
@@ -1032,6 +1259,24 @@ void DisplayManager::processMessage(const DisplayMessage& msg) {
             destroyWiFiInfoPage();
             printf("[DisplayManager] WiFi信息页面销毁消息处理完成\n");
             break;
+            
+        case DisplayMessage::MSG_SET_ASSET_PACK:
+            // 切换资源包（已在LVGL锁保护下，当前屏幕立即重新应用）
+            if (m_assetManager) {
+                m_assetManager->setActivePack(msg.data.asset_pack.path);
+            }
+            break;
+            
+        case DisplayMessage::MSG_SET_ASSET_CACHE:
+            if (m_assetManager) {
+                if (msg.data.asset_cache.budget_bytes > 0) {
+                    m_assetManager->setCacheBudget(msg.data.asset_cache.budget_bytes);
+                }
+                if (msg.data.asset_cache.clear) {
+                    m_assetManager->clearCache();
+                }
+            }
+            break;
     }
     
     m_lvglDriver->unlock();
@@ -1102,7 +1347,7 @@ void DisplayManager::switchPage(DisplayPage page) {
     msg.data.page_switch.page = page;
     
     if (m_messageQueue) {
-        xQueueSend(m_messageQueue, &msg, pdMS_TO_TICKS(100));
+        postMessage(msg, pdMS_TO_TICKS(100));
     }
 }
 
@@ -1123,7 +1368,7 @@ void DisplayManager::updateWiFiStatus(bool connected, const char* ssid, const ch
     }
     
     if (m_messageQueue) {
-        xQueueSend(m_messageQueue, &msg, pdMS_TO_TICKS(100));
+        postMessage(msg, pdMS_TO_TICKS(100));
     }
 }
 
@@ -1135,7 +1380,7 @@ void DisplayManager::updateSystemInfo(uint32_t free_heap, uint32_t uptime, float
     msg.data.system_info.cpu_usage = cpu_usage;
     
     if (m_messageQueue) {
-        xQueueSend(m_messageQueue, &msg, pdMS_TO_TICKS(100));
+        postMessage(msg, pdMS_TO_TICKS(100));
     }
 }
 
@@ -1145,7 +1390,7 @@ void DisplayManager::setBrightness(uint8_t brightness) {
     msg.data.brightness.brightness = brightness;
     
     if (m_messageQueue) {
-        BaseType_t result = xQueueSend(m_messageQueue, &msg, pdMS_TO_TICKS(100));
+        BaseType_t result = postMessage(msg, pdMS_TO_TICKS(100));
         if (result != pdTRUE) {
             printf("[DisplayManager] 亮度设置消息发送失败\n");
         }
@@ -1153,88 +1398,306 @@ void DisplayManager::setBrightness(uint8_t brightness) {
 }
 
 void DisplayManager::setTheme(DisplayTheme theme) {
-    // 主题切换改为重启系统的方式，此函数保留为兼容性接口
-    // 实际的主题切换现在通过WebServerManager保存配置后重启系统完成
-    printf("[DisplayManager] 主题切换请求：%d（将通过系统重启应用）\n", theme);
+    // 通过消息队列在显示任务中切换，无需重启
+    DisplayMessage msg;
+    msg.type = DisplayMessage::MSG_SET_THEME;
+    msg.data.theme.theme = theme;
+    
+    if (m_messageQueue) {
+        if (postMessage(msg, pdMS_TO_TICKS(100)) != pdTRUE) {
+            printf("[DisplayManager] 主题切换消息发送失败\n");
+        }
+    }
 }
 
-void DisplayManager::switchUISystem(DisplayTheme theme) {
-    printf("[DisplayManager] 初始化UI系统到主题: %d\n", theme);
-    
-    // 获取LVGL锁
-    if (!m_lvglDriver->lock(5000)) {
-        printf("[DisplayManager] 错误：获取LVGL锁超时\n");
-        return;
+/**
+ * @brief 启动主题切换压力测试
+ */
+bool DisplayManager::startThemeSoak(uint32_t cycles) {
+    if (m_soakStats.running || !m_lvglDriver || !m_uiSystemActive) {
+        return false;
     }
     
-    // 创建一个临时的空白屏幕作为活动屏幕，避免删除活动屏幕的错误
-    lv_obj_t* temp_screen = lv_obj_create(NULL);
-    if (temp_screen) {
-        lv_scr_load(temp_screen);
-        printf("[DisplayManager] 创建临时屏幕作为活动屏幕\n");
-        
-        // 短暂延迟，确保屏幕切换完成
-        vTaskDelay(pdMS_TO_TICKS(100));
+    if (cycles > SOAK_MAX_CYCLES) {
+        cycles = SOAK_MAX_CYCLES;
     }
-    
-    // 销毁当前UI系统
-    if (m_currentTheme == THEME_UI1) {
-        destroyUI1System();
-    } else if (m_currentTheme == THEME_UI2) {
-        destroyUI2System();
+    // 偶数次切换，结束时回到原主题，与基线在同一主题下比较
+    cycles = (cycles + 1) & ~1u;
+    if (cycles < SOAK_WARMUP_CYCLES + 2) {
+        cycles = SOAK_WARMUP_CYCLES + 2;
     }
     
-    // 初始化新的UI系统
-    if (theme == THEME_UI1) {
-        initUI1System();
-    } else if (theme == THEME_UI2) {
-        initUI2System();
+    // 首次启动时创建，之后保留（显示任务可能在测试结束后才处理最后一条切换消息）
+    if (!m_soakSwitchDone) {
+        m_soakSwitchDone = xSemaphoreCreateBinary();
+        if (!m_soakSwitchDone) {
+            printf("[DisplayManager] 错误：创建主题压力测试信号量失败\n");
+            return false;
+        }
     }
     
-    // 删除临时屏幕（如果成功创建的话）
-    if (temp_screen) {
-        lv_obj_del(temp_screen);
-        printf("[DisplayManager] 删除临时屏幕\n");
+    memset(&m_soakStats, 0, sizeof(m_soakStats));
+    m_soakStats.cycles = cycles;
+    m_soakStats.running = true;
+    m_soakStopRequested = false;
+    
+    BaseType_t result = xTaskCreatePinnedToCore(
+        themeSoakTaskEntry,
+        "ThemeSoak",
+        4096,
+        this,
+        TASK_PRIORITY - 1,
+        nullptr,
+        TASK_CORE
+    );
+    if (result != pdPASS) {
+        printf("[DisplayManager] 错误：创建主题压力测试任务失败\n");
+        m_soakStats.running = false;
+        return false;
     }
     
-    // 更新当前主题
-    m_currentTheme = theme;
-    m_uiSystemActive = true;
+    printf("[DisplayManager] 主题切换压力测试开始，共 %lu 次切换\n", (unsigned long)cycles);
+    return true;
+}
+
+/**
+ * @brief 停止主题切换压力测试
+ */
+void DisplayManager::stopThemeSoak() {
+    m_soakStopRequested = true;
+}
+
+/**
+ * @brief 获取主题切换压力测试结果
+ */
+void DisplayManager::getThemeSoakStats(ThemeSoakStats* stats) const {
+    if (!stats) {
+        return;
+    }
     
-    // 注意：不在此处保存配置，主题配置的保存由WebServerManager负责
-    // 这个函数现在主要用于系统初始化时根据保存的配置加载对应的UI系统
+    *stats = m_soakStats;
+}
+
+void DisplayManager::themeSoakTaskEntry(void* arg) {
+    DisplayManager* manager = static_cast<DisplayManager*>(arg);
+    if (manager) {
+        manager->themeSoakTask();
+    }
+    vTaskDelete(nullptr);
+}
+
+/**
+ * @brief 主题切换压力测试任务
+ */
+void DisplayManager::themeSoakTask() {
+    ThemeSoakStats& st = m_soakStats;
+    uint64_t switchUsTotal = 0;
+    lv_mem_monitor_t mon;
     
-    // 更新显示
-    updateTimeDisplay();
-    updatePowerDataDisplay();
-    updateWeatherDisplay();
+    st.internal_min_free = heap_caps_get_free_size(MALLOC_CAP_INTERNAL);
+    st.psram_min_free = heap_caps_get_free_size(MALLOC_CAP_SPIRAM);
     
+    // 当前主题由显示任务在LVGL锁内修改，加锁读取一次，之后本地交替
+    if (!m_lvglDriver->lock(5000)) {
+        printf("[DisplayManager] 主题压力测试：获取LVGL锁超时，中止\n");
+        st.running = false;
+        return;
+    }
+    DisplayTheme next = (m_currentTheme == THEME_UI1) ? THEME_UI2 : THEME_UI1;
     m_lvglDriver->unlock();
     
-    printf("[DisplayManager] UI系统初始化完成\n");
-}
-
-void DisplayManager::initUI1System() {
-    printf("[DisplayManager] 初始化UI1系统\n");
-    
-    try {
-        // 初始化UI1系统
-        ui_init();
+    while (st.completed < st.cycles) {
+        // 请求停止时仍补足偶数次，保证回到原主题
+        if (m_soakStopRequested && (st.completed % 2) == 0) {
+            break;
+        }
         
-        // 短暂延迟，确保UI系统初始化完成
-        vTaskDelay(pdMS_TO_TICKS(50));
+        // 与运行时切换主题相同：投递MSG_SET_THEME，等显示任务完成切换
+        xSemaphoreTake(m_soakSwitchDone, 0);
+        setTheme(next);
+        if (xSemaphoreTake(m_soakSwitchDone, pdMS_TO_TICKS(5000)) != pdTRUE) {
+            printf("[DisplayManager] 主题压力测试：等待显示任务切换主题超时，中止\n");
+            break;
+        }
+        uint32_t switchUs = m_soakSwitchUs;
+        if (switchUs == 0) {
+            printf("[DisplayManager] 主题压力测试：显示任务未执行切换（OTA进行中），中止\n");
+            break;
+        }
+        next = (next == THEME_UI1) ? THEME_UI2 : THEME_UI1;
         
-        // 显示默认页面
-        if (ui_standbySCREEN) {
-            lv_scr_load(ui_standbySCREEN);
-            printf("[DisplayManager] UI1待机屏幕已加载\n");
-        } else {
-            printf("[DisplayManager] 警告：UI1待机屏幕未创建\n");
+        st.completed++;
+        switchUsTotal += switchUs;
+        st.avg_switch_us = (uint32_t)(switchUsTotal / st.completed);
+        if (switchUs > st.max_switch_us) {
+            st.max_switch_us = switchUs;
         }
         
-        printf("[DisplayManager] UI1系统初始化完成\n");
-    } catch (...) {
-        printf("[DisplayManager] 错误：UI1系统初始化失败\n");
+        // 让LVGL渲染新屏幕、显示任务补齐数据后再采样
+        vTaskDelay(pdMS_TO_TICKS(SOAK_CYCLE_DELAY_MS));
+        
+        if (!m_lvglDriver->lock(5000)) {
+            printf("[DisplayManager] 主题压力测试：获取LVGL锁超时，中止\n");
+            break;
+        }
+        lv_mem_monitor(&mon);
+        m_lvglDriver->unlock();
+        
+        uint32_t internalFree = heap_caps_get_free_size(MALLOC_CAP_INTERNAL);
+        uint32_t psramFree = heap_caps_get_free_size(MALLOC_CAP_SPIRAM);
+        uint32_t lvglUsed = mon.total_size - mon.free_size;
+        
+        if (internalFree < st.internal_min_free) st.internal_min_free = internalFree;
+        if (psramFree < st.psram_min_free) st.psram_min_free = psramFree;
+        if (lvglUsed > st.lvgl_used_peak) st.lvgl_used_peak = lvglUsed;
+        
+        // 预热结束时（已回到原主题）取基线
+        if (st.completed == SOAK_WARMUP_CYCLES) {
+            st.internal_free_base = internalFree;
+            st.psram_free_base = psramFree;
+            st.lvgl_used_base = lvglUsed;
+        }
+        
+        if (st.completed % 100 == 0) {
+            printf("[DisplayManager] 主题压力测试 %lu/%lu：内部RAM空闲 %lu，PSRAM空闲 %lu，LVGL占用 %lu\n",
+                   (unsigned long)st.completed, (unsigned long)st.cycles, (unsigned long)internalFree,
+                   (unsigned long)psramFree, (unsigned long)lvglUsed);
+        }
+        
+        st.internal_free_end = internalFree;
+        st.psram_free_end = psramFree;
+        st.lvgl_used_end = lvglUsed;
+    }
+    
+    // 结束时与基线比较（未到预热次数则无基线，视为未通过）
+    st.passed = st.completed > SOAK_WARMUP_CYCLES
+        && (st.completed % 2) == 0
+        && st.internal_free_end + SOAK_HEAP_TOLERANCE >= st.internal_free_base
+        && st.psram_free_end + SOAK_HEAP_TOLERANCE >= st.psram_free_base
+        && st.lvgl_used_end <= st.lvgl_used_base + SOAK_LVGL_TOLERANCE;
+    st.running = false;
+    
+    printf("[DisplayManager] 主题切换压力测试结束：%lu 次切换，平均 %lu us，最大 %lu us，"
+           "内部RAM %lu -> %lu（最低 %lu），LVGL %lu -> %lu（峰值 %lu），%s\n",
+           (unsigned long)st.completed, (unsigned long)st.avg_switch_us, (unsigned long)st.max_switch_us,
+           (unsigned long)st.internal_free_base, (unsigned long)st.internal_free_end, (unsigned long)st.internal_min_free,
+           (unsigned long)st.lvgl_used_base, (unsigned long)st.lvgl_used_end, (unsigned long)st.lvgl_used_peak,
+           st.passed ? "通过" : "未通过");
+}
+
+void DisplayManager::switchUISystem(DisplayTheme theme) {
+    printf("[DisplayManager] 初始化UI系统到主题: %d\n", theme);
+    
+    // 获取LVGL锁
+    if (!m_lvglDriver->lock(5000)) {
+        printf("[DisplayManager] 错误：获取LVGL锁超时\n");
+        return;
+    }
+    
+    uint32_t switchUs = switchUISystemLocked(theme);
+    
+    m_lvglDriver->unlock();
+    
+    // 注意：不在此处保存配置，主题配置的保存由WebServerManager负责
+    printf("[DisplayManager] UI系统初始化完成，耗时 %lu us\n", (unsigned long)switchUs);
+}
+
+/**
+ * @brief 切换UI系统（需持有LVGL锁）
+ */
+uint32_t DisplayManager::switchUISystemLocked(DisplayTheme theme) {
+    int64_t startUs = esp_timer_get_time();
+    
+    // 先立即加载临时空白屏幕：结束进行中的切换动画，旧屏幕收到卸载事件（资源包替换被还原），
+    // 之后旧主题的屏幕都不再是活动屏幕，可以安全删除
+    lv_obj_t* temp_screen = lv_obj_create(NULL);
+    lv_scr_load(temp_screen);
+    
+    // WiFi信息页面不属于主题，交给延迟销毁流程隐藏
+    if (m_wifiInfoDisplayActive) {
+        m_wifiInfoDisplayActive = false;
+        m_wifiInfoPendingDestroy = true;
+    }
+    
+    // 销毁当前UI系统
+    if (m_currentTheme == THEME_UI1) {
+        destroyUI1System();
+    } else if (m_currentTheme == THEME_UI2) {
+        destroyUI2System();
+    }
+    
+    // 释放旧主题的背景图解码缓存和资源包缓存（新主题的背景图在创建前重新预解码）
+    RLEImageDecoder::clearCache();
+    if (m_assetManager) {
+        m_assetManager->clearCache();
+    }
+    
+    // 初始化新的UI系统（屏幕映射依赖当前主题，需先更新）
+    m_currentTheme = theme;
+    if (theme == THEME_UI1) {
+        initUI1System();
+    } else if (theme == THEME_UI2) {
+        initUI2System();
+    }
+    
+    // 待机屏幕已加载，删除临时屏幕
+    lv_obj_del(temp_screen);
+    
+    m_uiSystemActive = true;
+    m_currentPage = PAGE_HOME;
+    
+    // 新屏幕显示的是SquareLine默认文本，由显示任务在锁外补齐数据
+    m_screenRefreshPending = true;
+    notifyTask(TASK_EVT_REFRESH);
+    
+    return (uint32_t)(esp_timer_get_time() - startUs);
+}
+
+/**
+ * @brief 预解码主题背景图到PSRAM（需持有LVGL锁）
+ */
+void DisplayManager::preloadThemeImages(DisplayTheme theme) {
+#if RLE_IMG_PRELOAD_ON_BOOT
+    if (theme == THEME_UI1) {
+        RLEImageDecoder::preload(&ui_img_52731097);
+        RLEImageDecoder::preload(&ui_img_411710101);
+        RLEImageDecoder::preload(&ui_img_919862230);
+        RLEImageDecoder::preload(&ui_img_934861631);
+    } else if (theme == THEME_UI2) {
+        RLEImageDecoder::preload(&ui2_img_1985331572);
+    }
+    
+    printf("[DisplayManager] 背景图预解码完成，缓存%d幅，占用PSRAM %u KB\n",
+           RLEImageDecoder::getCachedCount(), (unsigned)(RLEImageDecoder::getCacheBytes() / 1024));
+#else
+    (void)theme;
+#endif
+}
+
+void DisplayManager::initUI1System() {
+    printf("[DisplayManager] 初始化UI1系统\n");
+    
+    try {
+        // 初始化UI1系统
+        preloadThemeImages(THEME_UI1);
+        m_screenManager.begin(SCREEN_SET_UI1);
+        if (m_assetManager) {
+            m_assetManager->attachScreens();
+        }
+        attachPowerTrends();
+        
+        // 显示默认页面
+        if (ui_standbySCREEN) {
+            lv_scr_load(ui_standbySCREEN);
+            m_screenManager.noteShown(ui_standbySCREEN);
+            printf("[DisplayManager] UI1待机屏幕已加载\n");
+        } else {
+            printf("[DisplayManager] 警告：UI1待机屏幕未创建\n");
+        }
+        
+        printf("[DisplayManager] UI1系统初始化完成\n");
+    } catch (...) {
+        printf("[DisplayManager] 错误：UI1系统初始化失败\n");
     }
 }
 
@@ -1243,14 +1706,17 @@ void DisplayManager::initUI2System() {
     
     try {
         // 初始化UI2系统
-        ui2_init();
-        
-        // 短暂延迟，确保UI系统初始化完成
-        vTaskDelay(pdMS_TO_TICKS(50));
+        preloadThemeImages(THEME_UI2);
+        m_screenManager.begin(SCREEN_SET_UI2);
+        if (m_assetManager) {
+            m_assetManager->attachScreens();
+        }
+        attachPowerTrends();
         
         // 显示默认页面
         if (ui2_standbySCREEN) {
             lv_scr_load(ui2_standbySCREEN);
+            m_screenManager.noteShown(ui2_standbySCREEN);
             printf("[DisplayManager] UI2待机屏幕已加载\n");
         } else {
             printf("[DisplayManager] 警告：UI2待机屏幕未创建\n");
@@ -1299,7 +1765,7 @@ void DisplayManager::showNotification(const char* text, uint32_t duration_ms) {
     msg.data.notification.text[sizeof(msg.data.notification.text) - 1] = '\0';
     
     if (m_messageQueue) {
-        xQueueSend(m_messageQueue, &msg, pdMS_TO_TICKS(100));
+        postMessage(msg, pdMS_TO_TICKS(100));
     }
 }
 
@@ -1328,12 +1794,21 @@ void DisplayManager::updatePowerData(const PowerMonitorData& power_data) {
     // 直接更新内部数据
     m_powerData = power_data;
     
-    // 立即更新新UI系统的显示
-    updatePowerDataDisplay();
+    // 记录功率历史（趋势图由显示任务每秒追加）
+    m_powerTrend.addSample(power_data);
     
-    // 更新所有端口的详细信息显示
-    for (int i = 0; i < 4; i++) {
-        updatePortDetailDisplay(i);
+    if (isUIUpdateSuspended()) {
+        // 熄屏期间只保留数据，标签在唤醒时统一补齐
+        m_uiDirty = true;
+        m_powerStats.skipped_updates++;
+    } else {
+        // 立即更新新UI系统的显示
+        updatePowerDataDisplay();
+        
+        // 更新所有端口的详细信息显示
+        for (int i = 0; i < 4; i++) {
+            updatePortDetailDisplay(i);
+        }
     }
     
     // 检查端口功率变化并触发自动切换
@@ -1358,7 +1833,7 @@ void DisplayManager::updatePowerData(const PowerMonitorData& power_data) {
     msg.data.power_monitor.power_data = power_data;
     
     if (m_messageQueue) {
-        xQueueSend(m_messageQueue, &msg, pdMS_TO_TICKS(100));
+        postMessage(msg, pdMS_TO_TICKS(100));
     }
 }
 
@@ -1383,7 +1858,7 @@ void DisplayManager::updateWeatherData(const char* temperature, const char* weat
     msg.data.weather_data.valid = true;
     
     if (m_messageQueue) {
-        xQueueSend(m_messageQueue, &msg, pdMS_TO_TICKS(100));
+        postMessage(msg, pdMS_TO_TICKS(100));
     }
 }
 
@@ -1462,241 +1937,11 @@ void DisplayManager::updatePowerDataDisplay() {
         return;
     }
     
-    // 根据当前主题更新相应的功率显示
-    if (m_currentTheme == THEME_UI1) {
-        // UI1系统的功率显示
-        if (ui_totalpowerlabel && m_powerData.valid) {
-            char total_power_str[16];
-            snprintf(total_power_str, sizeof(total_power_str), "%.1fW", m_powerData.total_power / 1000.0f);
-            lv_label_set_text(ui_totalpowerlabel, total_power_str);
-        }
-        
-        if (m_powerData.valid) {
-            // 端口1
-            if (ui_port1power && m_powerData.ports[0].valid) {
-                char port1_str[16];
-                snprintf(port1_str, sizeof(port1_str), "%.2fW", m_powerData.ports[0].power / 1000.0f);
-                lv_label_set_text(ui_port1power, port1_str);
-            }
-            
-            // 端口2
-            if (ui_port2power && m_powerData.ports[1].valid) {
-                char port2_str[16];
-                snprintf(port2_str, sizeof(port2_str), "%.2fW", m_powerData.ports[1].power / 1000.0f);
-                lv_label_set_text(ui_port2power, port2_str);
-            }
-            
-            // 端口3
-            if (ui_port3power && m_powerData.ports[2].valid) {
-                char port3_str[16];
-                snprintf(port3_str, sizeof(port3_str), "%.2fW", m_powerData.ports[2].power / 1000.0f);
-                lv_label_set_text(ui_port3power, port3_str);
-            }
-            
-            // 端口4
-            if (ui_port4power && m_powerData.ports[3].valid) {
-                char port4_str[16];
-                snprintf(port4_str, sizeof(port4_str), "%.2fW", m_powerData.ports[3].power / 1000.0f);
-                lv_label_set_text(ui_port4power, port4_str);
-            }
-            
-            // 更新功率条显示
-            updatePowerBars();
-        }
-    } else if (m_currentTheme == THEME_UI2) {
-        // UI2系统的功率显示
-        if (ui2_totalpowerlabel && m_powerData.valid) {
-            char total_power_str[16];
-            snprintf(total_power_str, sizeof(total_power_str), "%.1fW", m_powerData.total_power / 1000.0f);
-            lv_label_set_text(ui2_totalpowerlabel, total_power_str);
-        }
-        
-        if (m_powerData.valid) {
-            // UI2系统的端口功率显示
-            if (ui2_port1power && m_powerData.ports[0].valid) {
-                char port1_str[16];
-                snprintf(port1_str, sizeof(port1_str), "%.2fW", m_powerData.ports[0].power / 1000.0f);
-                lv_label_set_text(ui2_port1power, port1_str);
-            }
-            
-            if (ui2_port2power && m_powerData.ports[1].valid) {
-                char port2_str[16];
-                snprintf(port2_str, sizeof(port2_str), "%.2fW", m_powerData.ports[1].power / 1000.0f);
-                lv_label_set_text(ui2_port2power, port2_str);
-            }
-            
-            if (ui2_port3power && m_powerData.ports[2].valid) {
-                char port3_str[16];
-                snprintf(port3_str, sizeof(port3_str), "%.2fW", m_powerData.ports[2].power / 1000.0f);
-                lv_label_set_text(ui2_port3power, port3_str);
-            }
-            
-            if (ui2_port4power && m_powerData.ports[3].valid) {
-                char port4_str[16];
-                snprintf(port4_str, sizeof(port4_str), "%.2fW", m_powerData.ports[3].power / 1000.0f);
-                lv_label_set_text(ui2_port4power, port4_str);
-            }
-            
-            // UI2系统的电压和电流显示
-            if (ui2_port1voltage && m_powerData.ports[0].valid) {
-                char voltage_str[16];
-                snprintf(voltage_str, sizeof(voltage_str), "%.2fV", m_powerData.ports[0].voltage / 1000.0f);
-                lv_label_set_text(ui2_port1voltage, voltage_str);
-            }
-            
-            if (ui2_port1current && m_powerData.ports[0].valid) {
-                char current_str[16];
-                snprintf(current_str, sizeof(current_str), "%.2fA", m_powerData.ports[0].current / 1000.0f);
-                lv_label_set_text(ui2_port1current, current_str);
-            }
-            
-            if (ui2_port2voltage && m_powerData.ports[1].valid) {
-                char voltage_str[16];
-                snprintf(voltage_str, sizeof(voltage_str), "%.2fV", m_powerData.ports[1].voltage / 1000.0f);
-                lv_label_set_text(ui2_port2voltage, voltage_str);
-            }
-            
-            if (ui2_port2current && m_powerData.ports[1].valid) {
-                char current_str[16];
-                snprintf(current_str, sizeof(current_str), "%.2fA", m_powerData.ports[1].current / 1000.0f);
-                lv_label_set_text(ui2_port2current, current_str);
-            }
-            
-            if (ui2_port3voltage && m_powerData.ports[2].valid) {
-                char voltage_str[16];
-                snprintf(voltage_str, sizeof(voltage_str), "%.2fV", m_powerData.ports[2].voltage / 1000.0f);
-                lv_label_set_text(ui2_port3voltage, voltage_str);
-            }
-            
-            if (ui2_port3current && m_powerData.ports[2].valid) {
-                char current_str[16];
-                snprintf(current_str, sizeof(current_str), "%.2fA", m_powerData.ports[2].current / 1000.0f);
-                lv_label_set_text(ui2_port3current, current_str);
-            }
-            
-            if (ui2_port4voltage && m_powerData.ports[3].valid) {
-                char voltage_str[16];
-                snprintf(voltage_str, sizeof(voltage_str), "%.2fV", m_powerData.ports[3].voltage / 1000.0f);
-                lv_label_set_text(ui2_port4voltage, voltage_str);
-            }
-            
-            if (ui2_port4current && m_powerData.ports[3].valid) {
-                char current_str[16];
-                snprintf(current_str, sizeof(current_str), "%.2fA", m_powerData.ports[3].current / 1000.0f);
-                lv_label_set_text(ui2_port4current, current_str);
-            }
-            
-            // UI2系统端口详细页面的数据更新
-            updateUI2PortDetailPages();
-        }
-    }
-    
-    // 更新端口功率页面的详细信息
-    if (m_powerData.valid) {
-        // 端口1功率页面
-        if (ui_port1powerlabel && m_powerData.ports[0].valid) {
-            char port1_power_str[16];
-            snprintf(port1_power_str, sizeof(port1_power_str), "%.3fW", m_powerData.ports[0].power / 1000.0f);
-            lv_label_set_text(ui_port1powerlabel, port1_power_str);
-        }
-        if (ui_port1voltage && m_powerData.ports[0].valid) {
-            char port1_voltage_str[16];
-            snprintf(port1_voltage_str, sizeof(port1_voltage_str), "%.3fV", m_powerData.ports[0].voltage / 1000.0f);
-            lv_label_set_text(ui_port1voltage, port1_voltage_str);
-        }
-        if (ui_port1current && m_powerData.ports[0].valid) {
-            char port1_current_str[16];
-            snprintf(port1_current_str, sizeof(port1_current_str), "%.3fA", m_powerData.ports[0].current / 1000.0f);
-            lv_label_set_text(ui_port1current, port1_current_str);
-        }
-        
-        // 端口2功率页面
-        if (ui_port2powerlabel && m_powerData.ports[1].valid) {
-            char port2_power_str[16];
-            snprintf(port2_power_str, sizeof(port2_power_str), "%.3fW", m_powerData.ports[1].power / 1000.0f);
-            lv_label_set_text(ui_port2powerlabel, port2_power_str);
-        }
-        if (ui_port2voltage && m_powerData.ports[1].valid) {
-            char port2_voltage_str[16];
-            snprintf(port2_voltage_str, sizeof(port2_voltage_str), "%.3fV", m_powerData.ports[1].voltage / 1000.0f);
-            lv_label_set_text(ui_port2voltage, port2_voltage_str);
-        }
-        if (ui_port2current && m_powerData.ports[1].valid) {
-            char port2_current_str[16];
-            snprintf(port2_current_str, sizeof(port2_current_str), "%.3fA", m_powerData.ports[1].current / 1000.0f);
-            lv_label_set_text(ui_port2current, port2_current_str);
-        }
-        
-        // 端口3功率页面
-        if (ui_port3powerlabel && m_powerData.ports[2].valid) {
-            char port3_power_str[16];
-            snprintf(port3_power_str, sizeof(port3_power_str), "%.3fW", m_powerData.ports[2].power / 1000.0f);
-            lv_label_set_text(ui_port3powerlabel, port3_power_str);
-        }
-        if (ui_port3voltage && m_powerData.ports[2].valid) {
-            char port3_voltage_str[16];
-            snprintf(port3_voltage_str, sizeof(port3_voltage_str), "%.3fV", m_powerData.ports[2].voltage / 1000.0f);
-            lv_label_set_text(ui_port3voltage, port3_voltage_str);
-        }
-        if (ui_port3current && m_powerData.ports[2].valid) {
-            char port3_current_str[16];
-            snprintf(port3_current_str, sizeof(port3_current_str), "%.3fA", m_powerData.ports[2].current / 1000.0f);
-            lv_label_set_text(ui_port3current, port3_current_str);
-        }
-        
-        // 端口4功率页面
-        if (ui_port4powerlabel && m_powerData.ports[3].valid) {
-            char port4_power_str[16];
-            snprintf(port4_power_str, sizeof(port4_power_str), "%.3fW", m_powerData.ports[3].power / 1000.0f);
-            lv_label_set_text(ui_port4powerlabel, port4_power_str);
-        }
-        if (ui_port4voltage && m_powerData.ports[3].valid) {
-            char port4_voltage_str[16];
-            snprintf(port4_voltage_str, sizeof(port4_voltage_str), "%.3fV", m_powerData.ports[3].voltage / 1000.0f);
-            lv_label_set_text(ui_port4voltage, port4_voltage_str);
-        }
-        if (ui_port4current && m_powerData.ports[3].valid) {
-            char port4_current_str[16];
-            snprintf(port4_current_str, sizeof(port4_current_str), "%.3fA", m_powerData.ports[3].current / 1000.0f);
-            lv_label_set_text(ui_port4current, port4_current_str);
-        }
-    }
+    PowerDisplayUpdater::updatePowerData(m_powerData, m_currentTheme == THEME_UI2);
     
     m_lvglDriver->unlock();
 }
 
-/**
- * @brief 更新功率条显示
- */
-void DisplayManager::updatePowerBars() {
-    // 计算功率条的比例 (基于最大功率100W)
-    const float MAX_POWER = 100000.0f; // 100W in mW
-    
-    if (ui_port1powerbar && m_powerData.ports[0].valid) {
-        float ratio = m_powerData.ports[0].power / MAX_POWER;
-        if (ratio > 1.0f) ratio = 1.0f;
-        lv_bar_set_value(ui_port1powerbar, (int32_t)(ratio * 100), LV_ANIM_ON);
-    }
-    
-    if (ui_port2powerbar && m_powerData.ports[1].valid) {
-        float ratio = m_powerData.ports[1].power / MAX_POWER;
-        if (ratio > 1.0f) ratio = 1.0f;
-        lv_bar_set_value(ui_port2powerbar, (int32_t)(ratio * 100), LV_ANIM_ON);
-    }
-    
-    if (ui_port3powerbar && m_powerData.ports[2].valid) {
-        float ratio = m_powerData.ports[2].power / MAX_POWER;
-        if (ratio > 1.0f) ratio = 1.0f;
-        lv_bar_set_value(ui_port3powerbar, (int32_t)(ratio * 100), LV_ANIM_ON);
-    }
-    
-    if (ui_port4powerbar && m_powerData.ports[3].valid) {
-        float ratio = m_powerData.ports[3].power / MAX_POWER;
-        if (ratio > 1.0f) ratio = 1.0f;
-        lv_bar_set_value(ui_port4powerbar, (int32_t)(ratio * 100), LV_ANIM_ON);
-    }
-}
-
 /**
  * @brief 更新端口详细信息显示
  */
@@ -1705,123 +1950,7 @@ void DisplayManager::updatePortDetailDisplay(int port_index) {
         return;
     }
     
-    if (port_index < 0 || port_index >= 4 || !m_powerData.ports[port_index].valid) {
-        m_lvglDriver->unlock();
-        return;
-    }
-    
-    // 获取当前端口的数据
-    const PortData& portData = m_powerData.ports[port_index];
-    
-    // 根据端口索引更新对应的详细屏幕标签
-    lv_obj_t* state_label = nullptr;
-    lv_obj_t* protocol_label = nullptr;
-    lv_obj_t* manufacturer_label = nullptr;
-    lv_obj_t* cable_label = nullptr;
-    lv_obj_t* voltage_label = nullptr;
-    lv_obj_t* current_label = nullptr;
-    
-    // 根据端口索引获取对应的UI组件
-    switch (port_index) {
-        case 0:
-            state_label = ui_port1state;
-            protocol_label = ui_port1protocol;
-            manufacturer_label = ui_port1manufactuervid;
-            cable_label = ui_port1cablevid;
-            voltage_label = ui_port1maxvbusvoltage;
-            current_label = ui_port1maxvbuscurrent;
-            break;
-        case 1:
-            state_label = ui_port2state;
-            protocol_label = ui_port2protocol;
-            manufacturer_label = ui_port2manufactuervid;
-            cable_label = ui_port2cablevid;
-            voltage_label = ui_port2maxvbusvoltage;
-            current_label = ui_port2maxvbuscurrent;
-            break;
-        case 2:
-            state_label = ui_port3state;
-            protocol_label = ui_port3protocol;
-            manufacturer_label = ui_port3manufactuervid;
-            cable_label = ui_port3cablevid;
-            voltage_label = ui_port3maxvbusvoltage;
-            current_label = ui_port3maxvbuscurrent;
-            break;
-        case 3:
-            state_label = ui_port4state;
-            protocol_label = ui_port4protocol;
-            manufacturer_label = ui_port4manufactuervid;
-            cable_label = ui_port4cablevid;
-            voltage_label = ui_port4maxvbusvoltage;
-            current_label = ui_port4maxvbuscurrent;
-            break;
-    }
-    
-    // 更新状态显示
-    if (state_label) {
-        const char* state_text;
-        if (strcmp(portData.state, "ATTACHED") == 0) {
-            state_text = "已开启\n已连接";
-        } else if (strcmp(portData.state, "ACTIVE") == 0) {
-            state_text = "已开启\n未连接";
-        } else {
-            state_text = "未知状态";
-        }
-        lv_label_set_text(state_label, state_text);
-    }
-    
-    // 更新协议显示
-    if (protocol_label) {
-        if (strlen(portData.protocol_name) > 0) {
-            lv_label_set_text(protocol_label, portData.protocol_name);
-        } else {
-            lv_label_set_text(protocol_label, "未知");
-        }
-    }
-    
-    // 更新制造商VID显示
-    if (manufacturer_label) {
-        if (portData.manufacturer_vid > 0) {
-            char manufacturer_str[16];
-            snprintf(manufacturer_str, sizeof(manufacturer_str), "0x%04X", portData.manufacturer_vid);
-            lv_label_set_text(manufacturer_label, manufacturer_str);
-        } else {
-            lv_label_set_text(manufacturer_label, "未知");
-        }
-    }
-    
-    // 更新线缆VID显示
-    if (cable_label) {
-        if (portData.cable_vid > 0) {
-            char cable_str[16];
-            snprintf(cable_str, sizeof(cable_str), "0x%04X", portData.cable_vid);
-            lv_label_set_text(cable_label, cable_str);
-        } else {
-            lv_label_set_text(cable_label, "未知");
-        }
-    }
-    
-    // 更新最大电压显示
-    if (voltage_label) {
-        if (portData.cable_max_vbus_voltage > 0) {
-            char voltage_str[16];
-            snprintf(voltage_str, sizeof(voltage_str), "%.1fV", portData.cable_max_vbus_voltage / 1000.0f);
-            lv_label_set_text(voltage_label, voltage_str);
-        } else {
-            lv_label_set_text(voltage_label, "未知");
-        }
-    }
-    
-    // 更新最大电流显示
-    if (current_label) {
-        if (portData.cable_max_vbus_current > 0) {
-            char current_str[16];
-            snprintf(current_str, sizeof(current_str), "%.2fA", portData.cable_max_vbus_current / 1000.0f);
-            lv_label_set_text(current_label, current_str);
-        } else {
-            lv_label_set_text(current_label, "未知");
-        }
-    }
+    PowerDisplayUpdater::updatePortDetail(m_powerData, port_index);
     
     m_lvglDriver->unlock();
 }
@@ -1964,7 +2093,7 @@ void DisplayManager::setScreenMode(ScreenMode mode, int startHour, int startMinu
     }
     
     if (m_messageQueue) {
-        xQueueSend(m_messageQueue, &msg, pdMS_TO_TICKS(100));
+        postMessage(msg, pdMS_TO_TICKS(100));
     }
 }
 
@@ -2005,7 +2134,7 @@ void DisplayManager::forceScreenOn() {
     msg.type = DisplayMessage::MSG_SCREEN_ON;
     
     if (m_messageQueue) {
-        xQueueSend(m_messageQueue, &msg, pdMS_TO_TICKS(100));
+        postMessage(msg, pdMS_TO_TICKS(100));
     }
 }
 
@@ -2017,7 +2146,7 @@ void DisplayManager::forceScreenOff() {
     msg.type = DisplayMessage::MSG_SCREEN_OFF;
     
     if (m_messageQueue) {
-        xQueueSend(m_messageQueue, &msg, pdMS_TO_TICKS(100));
+        postMessage(msg, pdMS_TO_TICKS(100));
     }
 }
 
@@ -2029,7 +2158,7 @@ void DisplayManager::notifyTouchActivity() {
     msg.type = DisplayMessage::MSG_TOUCH_ACTIVITY;
     
     if (m_messageQueue) {
-        BaseType_t result = xQueueSend(m_messageQueue, &msg, pdMS_TO_TICKS(100));
+        BaseType_t result = postMessage(msg, pdMS_TO_TICKS(100));
         if (result != pdTRUE) {
             printf("[DisplayManager] 警告：触摸活动消息发送失败\n");
         }
@@ -2141,11 +2270,7 @@ void DisplayManager::performScreenOn() {
         return; // 已经开启且不在关闭渐变中
     }
     
-    // 如果正在渐变关闭，立即停止并开始开启渐变
-    if (m_isFading && m_fadeDirection == FADE_TO_OFF) {
-        stopFading();
-    }
-    
+    // 正在渐变关闭时不跳到黑屏，由startFading从当前亮度反向渐变
     printf("[DisplayManager] 开启屏幕\n");
     
     // 如果启用了渐变功能，使用渐变开启
@@ -2255,396 +2380,11 @@ bool DisplayManager::isPowerControlEnabled() const {
 /**
  * @brief 获取当前功率状态
  */
-int DisplayManager::getCurrentPower() const {
-    if (m_powerData.valid) {
-        return m_powerData.total_power;
-    }
-    return 0;
-}
-
-/**
- * @brief 更新UI2系统端口详细页面数据
- */
-void DisplayManager::updateUI2PortDetailPages() {
-    if (m_currentTheme != THEME_UI2 || !m_powerData.valid) {
-        return;
-    }
-    
-    // 更新端口1详细页面
-    if (m_powerData.ports[0].valid) {
-        // 电压显示
-        if (ui2_port1voltage1) {
-            char voltage_str[16];
-            snprintf(voltage_str, sizeof(voltage_str), "%.3fV", m_powerData.ports[0].voltage / 1000.0f);
-            lv_label_set_text(ui2_port1voltage1, voltage_str);
-        }
-        
-        // 电流显示
-        if (ui2_port1current1) {
-            char current_str[16];
-            snprintf(current_str, sizeof(current_str), "%.3fA", m_powerData.ports[0].current / 1000.0f);
-            lv_label_set_text(ui2_port1current1, current_str);
-        }
-        
-        // 功率显示
-        if (ui2_port1powerlabel) {
-            char power_str[16];
-            snprintf(power_str, sizeof(power_str), "%.3fW", m_powerData.ports[0].power / 1000.0f);
-            lv_label_set_text(ui2_port1powerlabel, power_str);
-        }
-        
-        // 活动状态显示
-        if (ui2_port1active) {
-            lv_label_set_text(ui2_port1active, m_powerData.ports[0].state ? "已开启" : "未开启");
-        }
-        
-        // 连接状态显示
-        if (ui2_port1state) {
-            lv_label_set_text(ui2_port1state, m_powerData.ports[0].state ? "已连接" : "未连接");
-        }
-        
-        // 协议显示
-        if (ui2_port1protocol) {
-            lv_label_set_text(ui2_port1protocol, strlen(m_powerData.ports[0].protocol_name) > 0 ? m_powerData.ports[0].protocol_name : "未知");
-        }
-        
-        // 制造商VID
-        if (ui2_port1manufactuervid) {
-            if (m_powerData.ports[0].manufacturer_vid > 0) {
-                char vid_str[16];
-                snprintf(vid_str, sizeof(vid_str), "0x%04X", m_powerData.ports[0].manufacturer_vid);
-                lv_label_set_text(ui2_port1manufactuervid, vid_str);
-            } else {
-                lv_label_set_text(ui2_port1manufactuervid, "未知");
-            }
-        }
-        
-        // 线缆VID
-        if (ui2_port1cablevid) {
-            if (m_powerData.ports[0].cable_vid > 0) {
-                char vid_str[16];
-                snprintf(vid_str, sizeof(vid_str), "0x%04X", m_powerData.ports[0].cable_vid);
-                lv_label_set_text(ui2_port1cablevid, vid_str);
-            } else {
-                lv_label_set_text(ui2_port1cablevid, "未知");
-            }
-        }
-        
-        // 协议握手功率显示
-        if (ui2_port1protocolpower) {
-            if (m_powerData.ports[0].protocol_handshake_power > 0) {
-                char protocol_power_str[16];
-                snprintf(protocol_power_str, sizeof(protocol_power_str), "%.1fW", m_powerData.ports[0].protocol_handshake_power / 1000.0f);
-                lv_label_set_text(ui2_port1protocolpower, protocol_power_str);
-            } else {
-                lv_label_set_text(ui2_port1protocolpower, "--W");
-            }
-        }
-        
-        // 最大电压
-        if (ui2_port1maxvbusvoltage) {
-            if (m_powerData.ports[0].cable_max_vbus_voltage > 0) {
-                char voltage_str[16];
-                snprintf(voltage_str, sizeof(voltage_str), "%.1fV", m_powerData.ports[0].cable_max_vbus_voltage / 1000.0f);
-                lv_label_set_text(ui2_port1maxvbusvoltage, voltage_str);
-            } else {
-                lv_label_set_text(ui2_port1maxvbusvoltage, "未知");
-            }
-        }
-        
-        // 最大电流
-        if (ui2_port1maxvbuscurrent) {
-            if (m_powerData.ports[0].cable_max_vbus_current > 0) {
-                char current_str[16];
-                snprintf(current_str, sizeof(current_str), "%.2fA", m_powerData.ports[0].cable_max_vbus_current / 1000.0f);
-                lv_label_set_text(ui2_port1maxvbuscurrent, current_str);
-            } else {
-                lv_label_set_text(ui2_port1maxvbuscurrent, "未知");
-            }
-        }
-    }
-    
-    // 更新端口2详细页面
-    if (m_powerData.ports[1].valid) {
-        // 电压显示
-        if (ui2_port2voltage1) {
-            char voltage_str[16];
-            snprintf(voltage_str, sizeof(voltage_str), "%.3fV", m_powerData.ports[1].voltage / 1000.0f);
-            lv_label_set_text(ui2_port2voltage1, voltage_str);
-        }
-        
-        // 电流显示
-        if (ui2_port2current1) {
-            char current_str[16];
-            snprintf(current_str, sizeof(current_str), "%.3fA", m_powerData.ports[1].current / 1000.0f);
-            lv_label_set_text(ui2_port2current1, current_str);
-        }
-        
-        // 活动状态显示（powerlabel实际上是状态标签）
-        if (ui2_port2powerlabel) {
-            lv_label_set_text(ui2_port2powerlabel, m_powerData.ports[1].state ? "已开启" : "未开启");
-        }
-        
-        // 功率显示（powerlabel1才是真正的功率标签）
-        if (ui2_port2powerlabel1) {
-            char power_str[16];
-            snprintf(power_str, sizeof(power_str), "%.3fW", m_powerData.ports[1].power / 1000.0f);
-            lv_label_set_text(ui2_port2powerlabel1, power_str);
-        }
-        
-        // 状态显示
-        if (ui2_port2state) {
-            lv_label_set_text(ui2_port2state, m_powerData.ports[1].state ? "已连接" : "未连接");
-        }
-        
-        // 协议显示
-        if (ui2_port2protocol) {
-            lv_label_set_text(ui2_port2protocol, strlen(m_powerData.ports[1].protocol_name) > 0 ? m_powerData.ports[1].protocol_name : "未知");
-        }
-        
-        // 制造商VID
-        if (ui2_port2manufactuervid) {
-            if (m_powerData.ports[1].manufacturer_vid > 0) {
-                char vid_str[16];
-                snprintf(vid_str, sizeof(vid_str), "0x%04X", m_powerData.ports[1].manufacturer_vid);
-                lv_label_set_text(ui2_port2manufactuervid, vid_str);
-            } else {
-                lv_label_set_text(ui2_port2manufactuervid, "未知");
-            }
-        }
-        
-        // 线缆VID
-        if (ui2_port2cablevid) {
-            if (m_powerData.ports[1].cable_vid > 0) {
-                char vid_str[16];
-                snprintf(vid_str, sizeof(vid_str), "0x%04X", m_powerData.ports[1].cable_vid);
-                lv_label_set_text(ui2_port2cablevid, vid_str);
-            } else {
-                lv_label_set_text(ui2_port2cablevid, "未知");
-            }
-        }
-        
-        // 协议握手功率显示
-        if (ui2_port2protocolpower) {
-            if (m_powerData.ports[1].protocol_handshake_power > 0) {
-                char protocol_power_str[16];
-                snprintf(protocol_power_str, sizeof(protocol_power_str), "%.1fW", m_powerData.ports[1].protocol_handshake_power / 1000.0f);
-                lv_label_set_text(ui2_port2protocolpower, protocol_power_str);
-            } else {
-                lv_label_set_text(ui2_port2protocolpower, "--W");
-            }
-        }
-        
-        // 最大电压
-        if (ui2_port2maxvbusvoltage) {
-            if (m_powerData.ports[1].cable_max_vbus_voltage > 0) {
-                char voltage_str[16];
-                snprintf(voltage_str, sizeof(voltage_str), "%.1fV", m_powerData.ports[1].cable_max_vbus_voltage / 1000.0f);
-                lv_label_set_text(ui2_port2maxvbusvoltage, voltage_str);
-            } else {
-                lv_label_set_text(ui2_port2maxvbusvoltage, "未知");
-            }
-        }
-        
-        // 最大电流
-        if (ui2_port2maxvbuscurrent) {
-            if (m_powerData.ports[1].cable_max_vbus_current > 0) {
-                char current_str[16];
-                snprintf(current_str, sizeof(current_str), "%.2fA", m_powerData.ports[1].cable_max_vbus_current / 1000.0f);
-                lv_label_set_text(ui2_port2maxvbuscurrent, current_str);
-            } else {
-                lv_label_set_text(ui2_port2maxvbuscurrent, "未知");
-            }
-        }
-    }
-    
-    // 更新端口3详细页面
-    if (m_powerData.ports[2].valid) {
-        // 电压显示
-        if (ui2_port3voltage1) {
-            char voltage_str[16];
-            snprintf(voltage_str, sizeof(voltage_str), "%.3fV", m_powerData.ports[2].voltage / 1000.0f);
-            lv_label_set_text(ui2_port3voltage1, voltage_str);
-        }
-        
-        // 电流显示
-        if (ui2_port3current1) {
-            char current_str[16];
-            snprintf(current_str, sizeof(current_str), "%.3fA", m_powerData.ports[2].current / 1000.0f);
-            lv_label_set_text(ui2_port3current1, current_str);
-        }
-        
-        // 活动状态显示（powerlabel实际上是状态标签）
-        if (ui2_port3powerlabel) {
-            lv_label_set_text(ui2_port3powerlabel, m_powerData.ports[2].state ? "已开启" : "未开启");
-        }
-        
-        // 功率显示（powerlabel1才是真正的功率标签）
-        if (ui2_port3powerlabel1) {
-            char power_str[16];
-            snprintf(power_str, sizeof(power_str), "%.3fW", m_powerData.ports[2].power / 1000.0f);
-            lv_label_set_text(ui2_port3powerlabel1, power_str);
-        }
-        
-        // 状态显示
-        if (ui2_port3state) {
-            lv_label_set_text(ui2_port3state, m_powerData.ports[2].state ? "已连接" : "未连接");
-        }
-        
-        // 协议显示
-        if (ui2_port3protocol) {
-            lv_label_set_text(ui2_port3protocol, strlen(m_powerData.ports[2].protocol_name) > 0 ? m_powerData.ports[2].protocol_name : "未知");
-        }
-        
-        // 制造商VID
-        if (ui2_port3manufactuervid) {
-            if (m_powerData.ports[2].manufacturer_vid > 0) {
-                char vid_str[16];
-                snprintf(vid_str, sizeof(vid_str), "0x%04X", m_powerData.ports[2].manufacturer_vid);
-                lv_label_set_text(ui2_port3manufactuervid, vid_str);
-            } else {
-                lv_label_set_text(ui2_port3manufactuervid, "未知");
-            }
-        }
-        
-        // 线缆VID
-        if (ui2_port3cablevid) {
-            if (m_powerData.ports[2].cable_vid > 0) {
-                char vid_str[16];
-                snprintf(vid_str, sizeof(vid_str), "0x%04X", m_powerData.ports[2].cable_vid);
-                lv_label_set_text(ui2_port3cablevid, vid_str);
-            } else {
-                lv_label_set_text(ui2_port3cablevid, "未知");
-            }
-        }
-        
-        // 协议握手功率显示
-        if (ui2_port3protocolpower) {
-            if (m_powerData.ports[2].protocol_handshake_power > 0) {
-                char protocol_power_str[16];
-                snprintf(protocol_power_str, sizeof(protocol_power_str), "%.1fW", m_powerData.ports[2].protocol_handshake_power / 1000.0f);
-                lv_label_set_text(ui2_port3protocolpower, protocol_power_str);
-            } else {
-                lv_label_set_text(ui2_port3protocolpower, "--W");
-            }
-        }
-        
-        // 最大电压
-        if (ui2_port3maxvbusvoltage) {
-            if (m_powerData.ports[2].cable_max_vbus_voltage > 0) {
-                char voltage_str[16];
-                snprintf(voltage_str, sizeof(voltage_str), "%.1fV", m_powerData.ports[2].cable_max_vbus_voltage / 1000.0f);
-                lv_label_set_text(ui2_port3maxvbusvoltage, voltage_str);
-            } else {
-                lv_label_set_text(ui2_port3maxvbusvoltage, "未知");
-            }
-        }
-        
-        // 最大电流
-        if (ui2_port3maxvbuscurrent) {
-            if (m_powerData.ports[2].cable_max_vbus_current > 0) {
-                char current_str[16];
-                snprintf(current_str, sizeof(current_str), "%.2fA", m_powerData.ports[2].cable_max_vbus_current / 1000.0f);
-                lv_label_set_text(ui2_port3maxvbuscurrent, current_str);
-            } else {
-                lv_label_set_text(ui2_port3maxvbuscurrent, "未知");
-            }
-        }
-    }
-    
-    // 更新端口4详细页面
-    if (m_powerData.ports[3].valid) {
-        // 电压显示
-        if (ui2_port4voltage1) {
-            char voltage_str[16];
-            snprintf(voltage_str, sizeof(voltage_str), "%.3fV", m_powerData.ports[3].voltage / 1000.0f);
-            lv_label_set_text(ui2_port4voltage1, voltage_str);
-        }
-        
-        // 电流显示
-        if (ui2_port4current1) {
-            char current_str[16];
-            snprintf(current_str, sizeof(current_str), "%.3fA", m_powerData.ports[3].current / 1000.0f);
-            lv_label_set_text(ui2_port4current1, current_str);
-        }
-        
-        // 活动状态显示（powerlabel实际上是状态标签）
-        if (ui2_port4powerlabel) {
-            lv_label_set_text(ui2_port4powerlabel, m_powerData.ports[3].state ? "已开启" : "未开启");
-        }
-        
-        // 功率显示（powerlabel1才是真正的功率标签）
-        if (ui2_port4powerlabel1) {
-            char power_str[16];
-            snprintf(power_str, sizeof(power_str), "%.3fW", m_powerData.ports[3].power / 1000.0f);
-            lv_label_set_text(ui2_port4powerlabel1, power_str);
-        }
-        
-        // 状态显示
-        if (ui2_port4state) {
-            lv_label_set_text(ui2_port4state, m_powerData.ports[3].state ? "已连接" : "未连接");
-        }
-        
-        // 协议显示
-        if (ui2_port4protocol) {
-            lv_label_set_text(ui2_port4protocol, strlen(m_powerData.ports[3].protocol_name) > 0 ? m_powerData.ports[3].protocol_name : "未知");
-        }
-        
-        // 制造商VID
-        if (ui2_port4manufactuervid) {
-            if (m_powerData.ports[3].manufacturer_vid > 0) {
-                char vid_str[16];
-                snprintf(vid_str, sizeof(vid_str), "0x%04X", m_powerData.ports[3].manufacturer_vid);
-                lv_label_set_text(ui2_port4manufactuervid, vid_str);
-            } else {
-                lv_label_set_text(ui2_port4manufactuervid, "未知");
-            }
-        }
-        
-        // 线缆VID
-        if (ui2_port4cablevid) {
-            if (m_powerData.ports[3].cable_vid > 0) {
-                char vid_str[16];
-                snprintf(vid_str, sizeof(vid_str), "0x%04X", m_powerData.ports[3].cable_vid);
-                lv_label_set_text(ui2_port4cablevid, vid_str);
-            } else {
-                lv_label_set_text(ui2_port4cablevid, "未知");
-            }
-        }
-        
-        // 协议握手功率显示
-        if (ui2_port4protocolpower) {
-            if (m_powerData.ports[3].protocol_handshake_power > 0) {
-                char protocol_power_str[16];
-                snprintf(protocol_power_str, sizeof(protocol_power_str), "%.1fW", m_powerData.ports[3].protocol_handshake_power / 1000.0f);
-                lv_label_set_text(ui2_port4protocolpower, protocol_power_str);
-            } else {
-                lv_label_set_text(ui2_port4protocolpower, "--W");
-            }
-        }
-        
-        // 最大电压
-        if (ui2_port4maxvbusvoltage) {
-            if (m_powerData.ports[3].cable_max_vbus_voltage > 0) {
-                char voltage_str[16];
-                snprintf(voltage_str, sizeof(voltage_str), "%.1fV", m_powerData.ports[3].cable_max_vbus_voltage / 1000.0f);
-                lv_label_set_text(ui2_port4maxvbusvoltage, voltage_str);
-            } else {
-                lv_label_set_text(ui2_port4maxvbusvoltage, "未知");
-            }
-        }
-        
-        // 最大电流
-        if (ui2_port4maxvbuscurrent) {
-            if (m_powerData.ports[3].cable_max_vbus_current > 0) {
-                char current_str[16];
-                snprintf(current_str, sizeof(current_str), "%.2fA", m_powerData.ports[3].cable_max_vbus_current / 1000.0f);
-                lv_label_set_text(ui2_port4maxvbuscurrent, current_str);
-            } else {
-                lv_label_set_text(ui2_port4maxvbuscurrent, "未知");
-            }
-        }
+int DisplayManager::getCurrentPower() const {
+    if (m_powerData.valid) {
+        return m_powerData.total_power;
     }
+    return 0;
 }
 
 /**
@@ -2894,7 +2634,7 @@ void DisplayManager::checkPortPowerChange() {
                 msg.data.auto_switch_port.duration_ms = 20000; // 20秒
                 
                 if (m_messageQueue) {
-                    xQueueSend(m_messageQueue, &msg, pdMS_TO_TICKS(100));
+                    postMessage(msg, pdMS_TO_TICKS(100));
                 }
                 
                 break; // 只处理第一个检测到的端口变化
@@ -2924,6 +2664,7 @@ void DisplayManager::performAutoSwitchToPort(int port_index, uint32_t duration_m
     m_autoSwitchDuration = duration_ms;
     m_isInAutoSwitchMode = true;
     m_currentAutoSwitchPort = port_index;
+    notifyTask(TASK_EVT_STATE);
     
     // 切换到端口屏幕
     switchToPortScreen(port_index);
@@ -2948,26 +2689,6 @@ void DisplayManager::checkAutoSwitchTimeout() {
     }
 }
 
-/**
- * @brief 检查三击手势超时
- */
-void DisplayManager::checkTripleSwipeTimeout() {
-    if (m_swipeCount == 0) {
-        return;
-    }
-    
-    TickType_t currentTime = xTaskGetTickCount();
-    TickType_t timeSinceFirstSwipe = currentTime - m_firstSwipeTime;
-    uint32_t timeSinceFirstSwipeMs = pdTICKS_TO_MS(timeSinceFirstSwipe);
-    
-    if (timeSinceFirstSwipeMs > TRIPLE_SWIPE_TIMEOUT_MS) {
-        // 三击超时，重置状态
-        printf("[DisplayManager] 三击手势超时（%lu毫秒），重置状态\n", timeSinceFirstSwipeMs);
-        m_swipeCount = 0;
-        m_firstSwipeTime = 0;
-    }
-}
-
 /**
  * @brief 恢复到切换前的页面（根据总功率条件智能决定）
  */
@@ -3045,6 +2766,9 @@ void DisplayManager::updateCurrentPage(DisplayPage page) {
 void DisplayManager::updateCurrentPageByScreen(lv_obj_t* screen) {
     if (!screen) return;
     
+    // 记录访问，用于空闲释放和预创建预测
+    m_screenManager.noteShown(screen);
+    
     // 根据当前主题和屏幕对象确定页面类型
     if (m_currentTheme == THEME_UI1) {
         if (screen == ui_standbySCREEN) {
@@ -3085,14 +2809,11 @@ extern "C" void updateDisplayManagerCurrentPage(void* screen) {
     }
 }
 
-// UI系统调用WiFi信息页面的桥接函数（三击检测）
-extern "C" void showWiFiInfoPageFromUI() {
+// C风格包装函数，屏幕按需创建后由UI系统调用
+extern "C" void notifyDisplayManagerScreenCreated(void* screen, uint32_t build_us) {
     DisplayManager* instance = DisplayManager::getInstance();
     if (instance) {
-        printf("[DisplayManager] UI待机页面右滑手势，当前页面：%d\n", instance->getCurrentPage());
-        instance->handleStandbyRightSwipe();
-    } else {
-        printf("[DisplayManager] 错误：DisplayManager实例未找到\n");
+        instance->onScreenCreated((lv_obj_t*)screen, build_us);
     }
 }
 
@@ -3143,6 +2864,13 @@ uint8_t DisplayManager::getCurrentFadingBrightness() const {
     return m_currentFadingBrightness;
 }
 
+/**
+ * @brief 获取背光渐变统计
+ */
+void DisplayManager::getFadeStats(BacklightFadeStats* stats) const {
+    m_fader.getStats(stats);
+}
+
 /**
  * @brief 启动亮度渐变
  */
@@ -3157,29 +2885,39 @@ void DisplayManager::startFading(uint8_t targetBrightness, FadeDirection directi
         return;
     }
     
-    // 停止当前渐变（如果正在进行）
+    uint8_t fromLevel;
     if (m_isFading) {
-        stopFading();
+        // 中途反向：从当前实际亮度继续，不先跳到上一次渐变的终点
+        m_fader.stop(false);
+        fromLevel = m_fader.getLevel();
+        m_isFading = false;
+    } else if (direction == FADE_TO_ON) {
+        // 开启时从0开始渐变
+        fromLevel = 0;
+        setBrightnessImmediate(0);
+    } else {
+        // 关闭时从当前亮度开始渐变
+        fromLevel = BacklightFader::percentToLevel(m_brightness);
     }
     
-    // 获取当前实际亮度作为起始亮度
     if (direction == FADE_TO_ON) {
-        // 开启时从0开始渐变
-        m_currentFadingBrightness = 0;
-        setBrightnessImmediate(0);
-        // 立即标记屏幕为开启状态，但亮度从0开始
+        setPowerState(DISPLAY_POWER_WAKING);
+        // 立即标记屏幕为开启状态，但亮度从低到高渐变
         m_screenOn = true;
     } else {
-        // 关闭时从当前亮度开始渐变
-        m_currentFadingBrightness = m_brightness;
+        setPowerState(DISPLAY_POWER_DIMMING);
     }
     
     // 设置渐变参数
+    m_currentFadingBrightness = BacklightFader::levelToPercent(fromLevel);
     m_targetFadingBrightness = targetBrightness;
     m_fadeDirection = direction;
     m_fadeStartTime = xTaskGetTickCount() * portTICK_PERIOD_MS;
     m_isFading = true;
     
+    // 渐变由esp_timer推进，不占用显示任务
+    m_fader.start(fromLevel, BacklightFader::percentToLevel(targetBrightness), m_fadeDuration);
+    
     printf("[DisplayManager] 开始亮度渐变: %d%% -> %d%%, 方向: %s, 持续时间: %d毫秒\n",
            m_currentFadingBrightness, 
            m_targetFadingBrightness,
@@ -3188,114 +2926,35 @@ void DisplayManager::startFading(uint8_t targetBrightness, FadeDirection directi
 }
 
 /**
- * @brief 处理亮度渐变逻辑
+ * @brief 处理亮度渐变完成后的屏幕状态
  */
 void DisplayManager::processFading() {
-    if (!m_isFading || !m_fadingEnabled) {
+    if (!m_isFading) {
         return;
     }
     
-    uint32_t currentTime = xTaskGetTickCount() * portTICK_PERIOD_MS;
-    uint32_t elapsedTime = currentTime - m_fadeStartTime;
+    m_currentFadingBrightness = BacklightFader::levelToPercent(m_fader.getLevel());
     
-    // 检查渐变是否完成
-    if (elapsedTime >= m_fadeDuration) {
-        // 渐变完成，设置最终亮度
-        m_currentFadingBrightness = m_targetFadingBrightness;
-        setBrightnessImmediate(m_currentFadingBrightness);
-        
-        // 更新屏幕状态
-        if (m_fadeDirection == FADE_TO_OFF) {
-            m_screenOn = false;
-            printf("[DisplayManager] 渐变关闭完成，屏幕背光已关闭，触摸系统保持活跃状态\n");
-        } else {
-            m_screenOn = true;
-            printf("[DisplayManager] 渐变开启完成，屏幕亮度已恢复至 %d%%\n", m_currentFadingBrightness);
-        }
-        
-        // 停止渐变
-        m_isFading = false;
+    // 背光定时器未初始化时退化为直接设置目标亮度
+    if (!m_fader.takeCompleted() && m_fader.isRunning()) {
         return;
     }
-    
-    // 计算渐变进度 (0.0 到 1.0)
-    float linearProgress = (float)elapsedTime / (float)m_fadeDuration;
-    
-    // 使用更平滑的缓动曲线 - 组合多种缓动函数
-    // 1. 三次贝塞尔曲线：3t²-2t³
-    float cubicProgress = linearProgress * linearProgress * (3.0f - 2.0f * linearProgress);
-    
-    // 2. 正弦波缓动：sin(t*π/2) 用于更自然的变化
-    float sineProgress = sin(linearProgress * M_PI * 0.5f);
-    
-    // 3. 组合缓动：前半段使用正弦波，后半段使用三次贝塞尔，过渡更自然
-    float smoothProgress;
-    if (linearProgress < 0.5f) {
-        // 前半段：使用修正的正弦波缓动，起步更平缓
-        float t = linearProgress * 2.0f;
-        smoothProgress = 0.5f * (1.0f - cos(t * M_PI * 0.5f));
-    } else {
-        // 后半段：使用修正的三次贝塞尔曲线，结束更平缓
-        float t = (linearProgress - 0.5f) * 2.0f;
-        float cubicPart = t * t * (3.0f - 2.0f * t);
-        smoothProgress = 0.5f + 0.5f * cubicPart;
+    if (m_fader.getLevel() != BacklightFader::percentToLevel(m_targetFadingBrightness)) {
+        setBrightnessImmediate(m_targetFadingBrightness);
     }
     
-    // 进一步平滑处理：使用五次多项式进行最终平滑
-    // f(t) = 6t⁵ - 15t⁴ + 10t³ （Ken Perlin's smoothstep的扩展版本）
-    smoothProgress = smoothProgress * smoothProgress * smoothProgress * 
-                    (smoothProgress * (smoothProgress * 6.0f - 15.0f) + 10.0f);
+    // 渐变完成，更新屏幕状态
+    m_currentFadingBrightness = m_targetFadingBrightness;
+    m_isFading = false;
     
-    uint8_t startBrightness, endBrightness;
-    if (m_fadeDirection == FADE_TO_ON) {
-        startBrightness = 0;
-        endBrightness = m_targetFadingBrightness;
+    if (m_fadeDirection == FADE_TO_OFF) {
+        m_screenOn = false;
+        setPowerState(DISPLAY_POWER_DARK);
+        printf("[DisplayManager] 渐变关闭完成，屏幕背光已关闭，触摸系统保持活跃状态\n");
     } else {
-        startBrightness = m_brightness; // 从设定亮度开始
-        endBrightness = 0;
-    }
-    
-    // 计算亮度范围和总步数
-    int brightnessRange = abs(endBrightness - startBrightness);
-    
-    // 根据亮度范围和渐变时间计算理想步数，确保足够平滑
-    int idealSteps = (brightnessRange * m_fadeDuration) / 100; // 每100ms每1%亮度一步
-    if (idealSteps < brightnessRange * 2) idealSteps = brightnessRange * 2; // 最少每0.5%一步
-    if (idealSteps > brightnessRange * 10) idealSteps = brightnessRange * 10; // 最多每0.1%一步
-    
-    // 使用更精确的浮点计算，支持小数点后一位精度
-    float currentBrightnessFloat = (float)startBrightness + 
-                                  ((float)(endBrightness - startBrightness) * smoothProgress);
-    
-    // 将亮度值精确到0.1%，然后四舍五入到整数
-    float precisionBrightness = roundf(currentBrightnessFloat * 10.0f) / 10.0f;
-    uint8_t newBrightness = (uint8_t)(precisionBrightness + 0.5f);
-    
-    // 确保亮度值在有效范围内
-    if (newBrightness > 100) newBrightness = 100;
-    
-    // 对于平滑渐变，允许每一个亮度单位的变化
-    // 在渐变过程中不设置变化阈值，让每个计算出的值都能更新
-    bool shouldUpdate = false;
-    
-    // 如果亮度值发生任何变化就更新（提高平滑度）
-    if (newBrightness != m_currentFadingBrightness) {
-        shouldUpdate = true;
-    }
-    
-    // 在渐变接近完成时强制更新，确保到达目标值
-    if (elapsedTime >= m_fadeDuration - 50) {
-        shouldUpdate = true;
-    }
-    
-    // 更新硬件亮度
-    if (shouldUpdate) {
-        m_currentFadingBrightness = newBrightness;
-        setBrightnessImmediate(m_currentFadingBrightness);
-        
-        // 可选：输出详细渐变进度（调试用，正常使用时可注释掉）
-        // printf("[DisplayManager] 渐变进度: %.1f%%, 平滑进度: %.2f, 当前亮度: %d%%, 精确值: %.1f%%\n", 
-        //        linearProgress * 100, smoothProgress, m_currentFadingBrightness, precisionBrightness);
+        m_screenOn = true;
+        setPowerState(DISPLAY_POWER_ACTIVE);
+        printf("[DisplayManager] 渐变开启完成，屏幕亮度已恢复至 %d%%\n", m_currentFadingBrightness);
     }
 }
 
@@ -3311,14 +2970,19 @@ void DisplayManager::stopFading() {
     m_isFading = false;
     
     // 设置为目标亮度（完成渐变）
+    m_fader.stop(true);
     m_currentFadingBrightness = m_targetFadingBrightness;
-    setBrightnessImmediate(m_currentFadingBrightness);
+    if (m_fader.getLevel() != BacklightFader::percentToLevel(m_targetFadingBrightness)) {
+        setBrightnessImmediate(m_currentFadingBrightness);
+    }
     
     // 更新屏幕状态
     if (m_fadeDirection == FADE_TO_OFF) {
         m_screenOn = false;
+        setPowerState(DISPLAY_POWER_DARK);
     } else {
         m_screenOn = true;
+        setPowerState(DISPLAY_POWER_ACTIVE);
     }
 }
 
@@ -3332,6 +2996,9 @@ void DisplayManager::performScreenOnImmediate() {
     
     printf("[DisplayManager] 即时开启屏幕（无渐变）\n");
     
+    // 先标记补齐UI，背光点亮后显示任务立即完成补齐刷新
+    setPowerState(DISPLAY_POWER_ACTIVE);
+    
     // 恢复屏幕亮度（使用安全的亮度设置方法）
     setBrightnessImmediate(m_brightness);
     
@@ -3375,9 +3042,167 @@ void DisplayManager::performScreenOffImmediate() {
     }
     
     m_screenOn = false;
+    setPowerState(DISPLAY_POWER_DARK);
     printf("[DisplayManager] 屏幕背光已关闭，触摸系统保持活跃状态\n");
 }
 
+// === 显示电源状态管理 ===
+
+/**
+ * @brief 切换显示电源状态
+ * 
+ * 可能在持有LVGL锁时被调用（如触摸唤醒消息处理），因此这里只修改状态，
+ * 需要加锁的UI补齐由processPowerState在显示任务循环中完成。
+ */
+void DisplayManager::setPowerState(DisplayPowerState state) {
+    DisplayPowerState previous = m_powerState;
+    if (state == previous) {
+        return;
+    }
+    
+    uint32_t now = xTaskGetTickCount() * portTICK_PERIOD_MS;
+    
+    if (state == DISPLAY_POWER_DARK) {
+        // 进入熄屏：挂起渲染，之后的UI更新只记录不执行
+        m_darkStartTime = now;
+        m_powerStats.dark_count++;
+        m_catchUpPending = false;
+        if (m_renderSuspendEnabled && m_lvglDriver) {
+            m_lvglDriver->setRenderSuspended(true);
+        }
+    } else if (previous == DISPLAY_POWER_DARK) {
+        // 离开熄屏：累计熄屏时间，补齐UI后再恢复渲染
+        m_powerStats.dark_ms += now - m_darkStartTime;
+        m_catchUpPending = true;
+    }
+    
+    m_powerState = state;
+    m_powerStats.state = state;
+    
+    // 熄屏和唤醒时显示任务按新状态调整定时器
+    if (state == DISPLAY_POWER_DARK || previous == DISPLAY_POWER_DARK) {
+        notifyTask(TASK_EVT_POWER);
+    }
+}
+
+/**
+ * @brief 处理待完成的唤醒补齐
+ * 
+ * 先把熄屏期间跳过的标签更新一次性写入，再恢复渲染，
+ * 使累积的无效区域在一轮刷新中完成。
+ */
+void DisplayManager::processPowerState() {
+    if (!m_catchUpPending) {
+        return;
+    }
+    m_catchUpPending = false;
+    
+    int64_t startUs = esp_timer_get_time();
+    
+    if (m_uiDirty) {
+        m_uiDirty = false;
+        updatePowerDataDisplay();
+        for (int i = 0; i < 4; i++) {
+            updatePortDetailDisplay(i);
+        }
+        updateTimeDisplay();
+        updateWeatherDisplay();
+    }
+    
+    if (m_lvglDriver) {
+        m_lvglDriver->setRenderSuspended(false);
+    }
+    
+    m_powerStats.last_catchup_us = (uint32_t)(esp_timer_get_time() - startUs);
+    printf("[DisplayManager] 唤醒补齐完成，耗时 %lu us，熄屏期间跳过UI更新 %lu 次\n",
+           (unsigned long)m_powerStats.last_catchup_us, (unsigned long)m_powerStats.skipped_updates);
+}
+
+/**
+ * @brief 检查是否应跳过UI更新
+ */
+bool DisplayManager::isUIUpdateSuspended() const {
+    return m_powerState == DISPLAY_POWER_DARK && m_renderSuspendEnabled;
+}
+
+/**
+ * @brief 获取显示电源状态
+ */
+DisplayPowerState DisplayManager::getPowerState() const {
+    return m_powerState;
+}
+
+/**
+ * @brief 获取显示电源状态统计
+ */
+void DisplayManager::getPowerStats(DisplayPowerStats* stats) const {
+    if (!stats) {
+        return;
+    }
+    
+    *stats = m_powerStats;
+    
+    // 熄屏中则计入当前熄屏时段
+    if (m_powerState == DISPLAY_POWER_DARK) {
+        stats->dark_ms += xTaskGetTickCount() * portTICK_PERIOD_MS - m_darkStartTime;
+    }
+}
+
+/**
+ * @brief 获取显示任务调度统计
+ */
+void DisplayManager::getTaskStats(DisplayTaskStats* stats) const {
+    if (!stats) {
+        return;
+    }
+    
+    *stats = m_taskStats;
+    stats->window_ms = m_taskStatsStartUs > 0 ? (uint32_t)((esp_timer_get_time() - m_taskStatsStartUs) / 1000) : 0;
+    stats->avg_msg_latency_us = stats->messages > 0 ? (uint32_t)(m_msgLatencyTotalUs / stats->messages) : 0;
+}
+
+/**
+ * @brief 重置显示任务调度统计
+ */
+void DisplayManager::resetTaskStats() {
+    uint32_t armed = m_taskStats.armed_timers;
+    memset(&m_taskStats, 0, sizeof(m_taskStats));
+    m_taskStats.armed_timers = armed;
+    m_msgLatencyTotalUs = 0;
+    m_taskStatsStartUs = esp_timer_get_time();
+}
+
+/**
+ * @brief 启用/禁用熄屏渲染挂起
+ */
+void DisplayManager::setRenderSuspendEnabled(bool enabled) {
+    if (enabled == m_renderSuspendEnabled) {
+        return;
+    }
+    
+    m_renderSuspendEnabled = enabled;
+    printf("[DisplayManager] 熄屏渲染挂起已%s\n", enabled ? "启用" : "禁用");
+    
+    if (m_powerState == DISPLAY_POWER_DARK) {
+        if (enabled) {
+            if (m_lvglDriver) {
+                m_lvglDriver->setRenderSuspended(true);
+            }
+        } else {
+            // 熄屏中禁用：立即补齐UI并恢复渲染
+            m_catchUpPending = true;
+            notifyTask(TASK_EVT_POWER);
+        }
+    }
+}
+
+/**
+ * @brief 检查熄屏渲染挂起是否启用
+ */
+bool DisplayManager::isRenderSuspendEnabled() const {
+    return m_renderSuspendEnabled;
+}
+
 // === 基于总功率的自动页面切换功能实现 ===
 
 /**
@@ -3388,6 +3213,7 @@ void DisplayManager::setPowerBasedAutoSwitch(bool enabled, int lowPowerThreshold
     m_lowPowerThreshold = lowPowerThreshold;
     m_highPowerThreshold = highPowerThreshold;
     m_powerCheckInterval = checkInterval;
+    notifyTask(TASK_EVT_STATE);
     
     printf("[DisplayManager] 基于总功率的自动页面切换已%s：低功率阈值=%.1fW，高功率阈值=%.1fW，检查间隔=%d毫秒\n", 
            enabled ? "启用" : "禁用",
@@ -3569,7 +3395,7 @@ void DisplayManager::startOTADisplay(bool isServerOTA) {
     msg.type = DisplayMessage::MSG_OTA_START;
     msg.data.ota_status.isServerOTA = isServerOTA;
     
-    if (m_messageQueue && xQueueSend(m_messageQueue, &msg, pdMS_TO_TICKS(100)) != pdTRUE) {
+    if (m_messageQueue && postMessage(msg, pdMS_TO_TICKS(100)) != pdTRUE) {
         printf("[DisplayManager] 警告：发送OTA开始消息失败\n");
     }
 }
@@ -3594,7 +3420,7 @@ void DisplayManager::updateOTAStatus(int status, float progress, uint32_t totalS
     strncpy(msg.data.ota_status.errorMessage, errorMessage ? errorMessage : "", sizeof(msg.data.ota_status.errorMessage) - 1);
     msg.data.ota_status.errorMessage[sizeof(msg.data.ota_status.errorMessage) - 1] = '\0';
     
-    if (m_messageQueue && xQueueSend(m_messageQueue, &msg, pdMS_TO_TICKS(100)) != pdTRUE) {
+    if (m_messageQueue && postMessage(msg, pdMS_TO_TICKS(100)) != pdTRUE) {
         printf("[DisplayManager] 警告：发送OTA状态更新消息失败\n");
     }
 }
@@ -3615,7 +3441,7 @@ void DisplayManager::completeOTADisplay(bool success, const char* message) {
     strncpy(msg.data.ota_status.statusText, message ? message : "", sizeof(msg.data.ota_status.statusText) - 1);
     msg.data.ota_status.statusText[sizeof(msg.data.ota_status.statusText) - 1] = '\0';
     
-    if (m_messageQueue && xQueueSend(m_messageQueue, &msg, pdMS_TO_TICKS(100)) != pdTRUE) {
+    if (m_messageQueue && postMessage(msg, pdMS_TO_TICKS(100)) != pdTRUE) {
         printf("[DisplayManager] 警告：发送OTA完成消息失败\n");
     }
 }
@@ -3888,6 +3714,183 @@ LVGLDriver* DisplayManager::getLVGLDriver() const {
     return m_lvglDriver;
 }
 
+// === UI资源包功能实现 ===
+
+void DisplayManager::setAssetManager(AssetManager* asset_manager) {
+    m_assetManager = asset_manager;
+}
+
+AssetManager* DisplayManager::getAssetManager() const {
+    return m_assetManager;
+}
+
+void DisplayManager::setAssetPack(const char* path) {
+    DisplayMessage msg;
+    msg.type = DisplayMessage::MSG_SET_ASSET_PACK;
+    strncpy(msg.data.asset_pack.path, path ? path : "", sizeof(msg.data.asset_pack.path) - 1);
+    msg.data.asset_pack.path[sizeof(msg.data.asset_pack.path) - 1] = '\0';
+    
+    if (m_messageQueue) {
+        if (postMessage(msg, pdMS_TO_TICKS(100)) != pdTRUE) {
+            printf("[DisplayManager] 资源包切换消息发送失败\n");
+        }
+    }
+}
+
+void DisplayManager::setAssetCache(uint32_t budget_bytes, bool clear) {
+    DisplayMessage msg;
+    msg.type = DisplayMessage::MSG_SET_ASSET_CACHE;
+    msg.data.asset_cache.budget_bytes = budget_bytes;
+    msg.data.asset_cache.clear = clear;
+    
+    if (m_messageQueue) {
+        if (postMessage(msg, pdMS_TO_TICKS(100)) != pdTRUE) {
+            printf("[DisplayManager] 资源缓存消息发送失败\n");
+        }
+    }
+}
+
+// === 屏幕按需创建功能实现 ===
+
+/**
+ * @brief 屏幕按需创建后的处理（由_ui_screen_change回调，调用时已持有LVGL锁）
+ */
+void DisplayManager::onScreenCreated(lv_obj_t* screen, uint32_t build_us) {
+    m_screenManager.noteCreated(screen, build_us);
+    prepareNewScreen();
+}
+
+/**
+ * @brief 为新创建的屏幕注册资源替换并标记待补齐数据（需持有LVGL锁）
+ */
+void DisplayManager::prepareNewScreen() {
+    // 在屏幕开始加载前注册事件，加载时才能替换为资源包资源
+    if (m_assetManager) {
+        m_assetManager->attachScreens();
+    }
+
+    attachPowerTrends();
+
+    // 不能在此处更新标签（LVGL锁不可重入），由显示任务在锁外补齐
+    m_screenRefreshPending = true;
+    notifyTask(TASK_EVT_REFRESH);
+}
+
+/**
+ * @brief 释放空闲屏幕并预创建下一个屏幕
+ */
+void DisplayManager::processScreenMaintenance() {
+    if (!m_lvglDriver || !m_lvglDriver->lock(100)) {
+        return;
+    }
+
+    // 熄屏期间只释放不预创建
+    if (m_screenManager.maintain(!isUIUpdateSuspended())) {
+        prepareNewScreen();
+    }
+
+    // 回收后暂停的背景图缓存在PSRAM回到低水位以上后恢复，下一次重绘重新整幅解码
+    if (RLEImageDecoder::isCacheSuspended() && m_psramManager &&
+        m_psramManager->getMemoryPressure(MEM_CAP_SPIRAM) == MEM_PRESSURE_NONE) {
+        RLEImageDecoder::resumeCache();
+    }
+
+    m_lvglDriver->unlock();
+}
+
+/**
+ * @brief 在当前主题已创建的功率屏幕上挂载趋势图（需持有LVGL锁）
+ */
+void DisplayManager::attachPowerTrends() {
+#if POWER_TREND_ENABLED
+    // 通道0为总功率，1-4为端口；未创建的屏幕在创建时再挂载
+    if (m_currentTheme == THEME_UI1) {
+        m_powerTrend.attach(ui_totalpowerSCREEN, 0);
+        m_powerTrend.attach(ui_prot1SCREEN, 1);
+        m_powerTrend.attach(ui_prot2SCREEN, 2);
+        m_powerTrend.attach(ui_prot3SCREEN, 3);
+        m_powerTrend.attach(ui_prot4SCREEN, 4);
+    } else if (m_currentTheme == THEME_UI2) {
+        m_powerTrend.attach(ui2_totalpowerSCREEN, 0);
+        m_powerTrend.attach(ui2_port1SCREEN, 1);
+        m_powerTrend.attach(ui2_port2SCREEN, 2);
+        m_powerTrend.attach(ui2_port3SCREEN, 3);
+        m_powerTrend.attach(ui2_port4SCREEN, 4);
+    }
+#endif
+}
+
+/**
+ * @brief 追加趋势图的新数据点
+ */
+void DisplayManager::processPowerTrend() {
+#if POWER_TREND_ENABLED
+    // 熄屏期间不追加，唤醒后一次补齐（落后超过一屏时整图重绘）
+    if (isUIUpdateSuspended()) {
+        return;
+    }
+    
+    if (!m_lvglDriver || !m_lvglDriver->lock(100)) {
+        return;
+    }
+    
+    m_powerTrend.update();
+    
+    m_lvglDriver->unlock();
+#endif
+}
+
+/**
+ * @brief 设置功率趋势图的显示窗口并保存
+ */
+bool DisplayManager::setPowerTrendWindow(uint16_t minutes) {
+    if (!m_powerTrend.setWindowMinutes(minutes)) {
+        return false;
+    }
+    
+    // 显示任务下次更新时整图重绘
+    if (m_configStorage) {
+        m_configStorage->putIntAsync("trend_window", minutes, 3000);
+    }
+    printf("[DisplayManager] 趋势图窗口设置为%u分钟\n", minutes);
+    return true;
+}
+
+/**
+ * @brief 获取功率趋势图
+ */
+PowerTrend& DisplayManager::getPowerTrend() {
+    return m_powerTrend;
+}
+
+/**
+ * @brief 获取屏幕镜像
+ */
+ScreenMirror& DisplayManager::getScreenMirror() {
+    return m_screenMirror;
+}
+
+/**
+ * @brief 设置屏幕释放策略
+ */
+void DisplayManager::setScreenPolicy(uint32_t idle_ms, uint8_t max_resident, bool prewarm) {
+    m_screenManager.setPolicy(idle_ms, max_resident, prewarm);
+}
+
+/**
+ * @brief 获取屏幕管理器
+ */
+const ScreenManager& DisplayManager::getScreenManager() const {
+    return m_screenManager;
+}
+
+/**
+ * @brief 获取屏幕创建/释放统计
+ */
+void DisplayManager::getScreenStats(ScreenManagerStats* stats) const {
+    m_screenManager.getStats(stats);
+}
+
 // === WiFi信息页面功能实现 ===
 
 /**
@@ -3896,14 +3899,14 @@ LVGLDriver* DisplayManager::getLVGLDriver() const {
  */
 void DisplayManager::showWiFiInfoPage() {
     printf("[DisplayManager] showWiFiInfoPage() 已更新为消息队列方式\n");
-    printf("[DisplayManager] 建议直接使用showWiFiInfoPageFromUI()函数\n");
+    printf("[DisplayManager] 建议使用requestShowWiFiInfoPage()函数\n");
     
     // 现在改为通过消息队列处理
     DisplayMessage msg;
     msg.type = DisplayMessage::MSG_SHOW_WIFI_INFO;
     
     if (m_messageQueue) {
-        if (xQueueSend(m_messageQueue, &msg, pdMS_TO_TICKS(100)) == pdTRUE) {
+        if (postMessage(msg, pdMS_TO_TICKS(100)) == pdTRUE) {
             printf("[DisplayManager] WiFi信息页面显示消息已发送到队列\n");
         } else {
             printf("[DisplayManager] 错误：发送WiFi信息页面显示消息失败\n");
@@ -3914,47 +3917,33 @@ void DisplayManager::showWiFiInfoPage() {
 }
 
 /**
- * @brief 处理待机页面右滑手势（三击检测）
+ * @brief 处理手势识别引擎发出的手势（三击检测）
+ * 
+ * 引擎按时间窗口累计连续同向滑动次数，这里只统计发生在待机页面上的部分：
+ * 引擎计数重新从1开始或离开待机页面时重置。
  */
-void DisplayManager::handleStandbyRightSwipe() {
-    TickType_t currentTime = xTaskGetTickCount();
-    
-    printf("[DisplayManager] 检测到待机页面右滑手势\n");
-    
-    if (m_swipeCount == 0) {
-        // 第一次右滑
-        m_swipeCount = 1;
-        m_firstSwipeTime = currentTime;
-        printf("[DisplayManager] 第1次右滑已记录，请在2秒内再滑动2次以打开WiFi信息页面（1/%d）\n", REQUIRED_SWIPE_COUNT);
+void DisplayManager::handleGesture(const GestureEvent& event) {
+    if (event.type != GESTURE_SWIPE) {
         return;
     }
     
-    // 检查是否在2秒内进行后续右滑
-    TickType_t timeSinceFirstSwipe = currentTime - m_firstSwipeTime;
-    uint32_t timeSinceFirstSwipeMs = pdTICKS_TO_MS(timeSinceFirstSwipe);
+    if (event.dir != GESTURE_DIR_RIGHT || m_currentPage != PAGE_HOME) {
+        m_swipeCount = 0;
+        return;
+    }
     
-    if (timeSinceFirstSwipeMs <= TRIPLE_SWIPE_TIMEOUT_MS) {
-        // 在时间窗口内，增加滑动计数
-        m_swipeCount++;
-        printf("[DisplayManager] 第%d次右滑已记录（%d/%d）\n", m_swipeCount, m_swipeCount, REQUIRED_SWIPE_COUNT);
-        
-        if (m_swipeCount >= REQUIRED_SWIPE_COUNT) {
-            // 三击成功，执行WiFi页面切换
-            printf("[DisplayManager] 三击手势成功，总间隔时间：%lu毫秒\n", timeSinceFirstSwipeMs);
-            m_swipeCount = 0; // 重置状态
-            m_firstSwipeTime = 0;
-            requestShowWiFiInfoPage();
-        } else {
-            // 还需要更多滑动
-            uint8_t remaining = REQUIRED_SWIPE_COUNT - m_swipeCount;
-            printf("[DisplayManager] 还需要%d次滑动，剩余时间：%lu毫秒\n", remaining, TRIPLE_SWIPE_TIMEOUT_MS - timeSinceFirstSwipeMs);
-        }
-    } else {
-        // 超时，重新开始计时
-        printf("[DisplayManager] 三击超时（间隔%lu毫秒），重新开始计时\n", timeSinceFirstSwipeMs);
+    if (event.count == 1 || m_swipeCount == 0) {
         m_swipeCount = 1;
-        m_firstSwipeTime = currentTime;
-        printf("[DisplayManager] 第1次右滑已记录，请在2秒内再滑动2次以打开WiFi信息页面（1/%d）\n", REQUIRED_SWIPE_COUNT);
+    } else {
+        m_swipeCount++;
+    }
+    printf("[DisplayManager] 待机页面右滑（速度%u像素/秒），第%d次（%d/%d）\n",
+           event.velocity, m_swipeCount, m_swipeCount, REQUIRED_SWIPE_COUNT);
+    
+    if (m_swipeCount >= REQUIRED_SWIPE_COUNT) {
+        printf("[DisplayManager] 三击手势成功\n");
+        m_swipeCount = 0;
+        requestShowWiFiInfoPage();
     }
 }
 
@@ -3986,7 +3975,7 @@ void DisplayManager::requestShowWiFiInfoPage() {
     msg.type = DisplayMessage::MSG_SHOW_WIFI_INFO;
     
     if (m_messageQueue) {
-        if (xQueueSend(m_messageQueue, &msg, pdMS_TO_TICKS(100)) == pdTRUE) {
+        if (postMessage(msg, pdMS_TO_TICKS(100)) == pdTRUE) {
             printf("[DisplayManager] WiFi信息页面显示消息已发送到队列\n");
             // 更新切换时间
             m_lastWiFiSwitchTime = currentTime;
@@ -4159,7 +4148,7 @@ void DisplayManager::switchToWiFiInfoPage() {
     printf("[DisplayManager] switchToWiFiInfoPage() 已弃用，请使用消息队列方式\n");
     
     // 现在通过消息队列处理，这里只保留兼容性
-    printf("[DisplayManager] 建议使用showWiFiInfoPageFromUI()触发显示\n");
+    printf("[DisplayManager] 建议使用requestShowWiFiInfoPage()触发显示\n");
 }
 
 /**
@@ -4244,7 +4233,7 @@ void DisplayManager::wifiInfoScreenEventHandler(lv_event_t* e) {
                 msg.type = DisplayMessage::MSG_RETURN_FROM_WIFI_INFO;
                 
                 if (instance->m_messageQueue) {
-                    if (xQueueSend(instance->m_messageQueue, &msg, pdMS_TO_TICKS(100)) == pdTRUE) {
+                    if (instance->postMessage(msg, pdMS_TO_TICKS(100)) == pdTRUE) {
                         printf("[DisplayManager] WiFi信息页面返回消息已发送\n");
                         // 更新切换时间
                         instance->m_lastWiFiSwitchTime = currentTime;
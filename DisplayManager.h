@@ -30,6 +30,11 @@
 #include "LVGL_Driver.h"
 #include "PowerMonitorData.h"
 #include "ConfigStorage.h"
+#include "ScreenManager.h"
+#include "PowerTrend.h"
+#include "BacklightFader.h"
+#include "SoftTimerWheel.h"
+#include "ScreenMirror.h"
 
 // 新的UI系统头文件
 #include "ui.h"
@@ -40,6 +45,7 @@ class WiFiManager;
 class ConfigStorage;
 class PSRAMManager;
 class WeatherManager;
+class AssetManager;
 
 /**
  * @brief 显示页面枚举
@@ -68,6 +74,67 @@ enum DisplayTheme {
     THEME_AUTO          ///< 自动主题
 };
 
+/**
+ * @brief 显示电源状态枚举
+ */
+enum DisplayPowerState {
+    DISPLAY_POWER_ACTIVE = 0,   ///< 亮屏，正常渲染
+    DISPLAY_POWER_DIMMING,      ///< 渐变熄屏中，继续渲染
+    DISPLAY_POWER_DARK,         ///< 熄屏，渲染挂起，仅响应触摸唤醒
+    DISPLAY_POWER_WAKING        ///< 渐变亮屏中，UI已补齐
+};
+
+/**
+ * @brief 显示电源状态统计
+ */
+struct DisplayPowerStats {
+    DisplayPowerState state;    ///< 当前电源状态
+    uint32_t dark_count;        ///< 进入熄屏状态的次数
+    uint32_t dark_ms;           ///< 累计熄屏时间（毫秒）
+    uint32_t skipped_updates;   ///< 熄屏期间跳过的UI更新次数
+    uint32_t last_catchup_us;   ///< 最近一次唤醒补齐UI的耗时（微秒）
+};
+
+/**
+ * @brief 显示任务调度统计
+ *
+ * 显示任务只在有消息、状态事件或软定时器到期时唤醒，统计用于评估唤醒频率和消息延迟
+ */
+struct DisplayTaskStats {
+    uint32_t window_ms;         ///< 统计时长（毫秒）
+    uint32_t wakeups;           ///< 唤醒总次数
+    uint32_t event_wakeups;     ///< 由消息或事件唤醒的次数
+    uint32_t timer_wakeups;     ///< 由软定时器到期唤醒的次数
+    uint32_t timer_fires;       ///< 软定时器执行次数
+    uint32_t messages;          ///< 处理的消息数
+    uint32_t avg_msg_latency_us;///< 消息从入队到开始处理的平均延迟
+    uint32_t max_msg_latency_us;///< 消息从入队到开始处理的最大延迟
+    uint32_t armed_timers;      ///< 当前设置的软定时器数
+};
+
+/**
+ * @brief 主题切换压力测试结果
+ *
+ * 内存基线在预热切换后、回到原主题时采样，结束时同样在原主题采样，两者之差即每轮残留
+ */
+struct ThemeSoakStats {
+    bool running;               ///< 测试进行中
+    bool passed;                ///< 结束后内存回到基线（在容差内）
+    uint32_t cycles;            ///< 计划切换次数
+    uint32_t completed;         ///< 已完成切换次数
+    uint32_t avg_switch_us;     ///< 平均切换耗时（微秒）
+    uint32_t max_switch_us;     ///< 最大切换耗时（微秒）
+    uint32_t internal_free_base;///< 内部RAM空闲基线
+    uint32_t internal_free_end; ///< 结束时内部RAM空闲
+    uint32_t internal_min_free; ///< 测试期间内部RAM最低空闲（高水位）
+    uint32_t psram_free_base;   ///< PSRAM空闲基线
+    uint32_t psram_free_end;    ///< 结束时PSRAM空闲
+    uint32_t psram_min_free;    ///< 测试期间PSRAM最低空闲
+    uint32_t lvgl_used_base;    ///< LVGL内存占用基线
+    uint32_t lvgl_used_end;     ///< 结束时LVGL内存占用
+    uint32_t lvgl_used_peak;    ///< 测试期间LVGL内存占用峰值
+};
+
 /**
  * @brief 显示消息结构
  */
@@ -91,7 +158,10 @@ struct DisplayMessage {
         MSG_OTA_COMPLETE,           ///< OTA完成
         MSG_SHOW_WIFI_INFO,         ///< 显示WiFi信息页面
         MSG_RETURN_FROM_WIFI_INFO,  ///< 从WiFi信息页面返回
-        MSG_DESTROY_WIFI_INFO       ///< 销毁WiFi信息页面
+        MSG_DESTROY_WIFI_INFO,      ///< 销毁WiFi信息页面
+        MSG_SET_ASSET_PACK,         ///< 切换UI资源包
+        MSG_SET_ASSET_CACHE,        ///< 调整资源缓存
+        MSG_GESTURE                 ///< 手势识别引擎识别出的手势
     } type;
     
     union {
@@ -160,7 +230,22 @@ struct DisplayMessage {
             char errorMessage[128]; ///< 错误信息
             bool isServerOTA;       ///< 是否为服务器OTA
         } ota_status;
+        
+        struct {
+            char path[64];          ///< 资源包路径，空字符串表示内置资源
+        } asset_pack;
+        
+        struct {
+            uint32_t budget_bytes;  ///< 缓存容量上限（0表示不修改）
+            bool clear;             ///< 是否释放未在显示的资源
+        } asset_cache;
+        
+        struct {
+            GestureEvent event;     ///< 手势事件
+        } gesture;
     } data;
+    
+    int64_t queued_us;              ///< 入队时间（由postMessage填写，用于统计消息处理延迟）
 };
 
 /**
@@ -265,6 +350,27 @@ public:
      */
     void setTheme(DisplayTheme theme);
     
+    /**
+     * @brief 启动主题切换压力测试（在独立任务中反复切换UI1/UI2并记录内存高水位）
+     * 
+     * 每次切换通过setTheme()交给显示任务执行（与运行时切换主题相同的路径），完成后再采样；
+     * 切换次数向上取偶数，结束时回到原主题
+     * 
+     * @param cycles 切换次数
+     * @return true 已启动，false 已有测试在进行或UI未初始化
+     */
+    bool startThemeSoak(uint32_t cycles);
+    
+    /**
+     * @brief 停止主题切换压力测试（当前切换完成后退出）
+     */
+    void stopThemeSoak();
+    
+    /**
+     * @brief 获取主题切换压力测试结果
+     */
+    void getThemeSoakStats(ThemeSoakStats* stats) const;
+    
     /**
      * @brief 获取当前主题
      * 
@@ -345,21 +451,11 @@ public:
      */
     void updatePowerDataDisplay();
     
-    /**
-     * @brief 更新功率条显示
-     */
-    void updatePowerBars();
-    
     /**
      * @brief 更新天气显示
      */
     void updateWeatherDisplay();
     
-    /**
-     * @brief 更新UI2系统端口详细页面数据
-     */
-    void updateUI2PortDetailPages();
-    
     // === 屏幕模式管理功能 ===
     
     /**
@@ -440,9 +536,11 @@ public:
     void requestShowWiFiInfoPage();
     
     /**
-     * @brief 处理待机页面右滑手势（三击检测）
+     * @brief 处理手势识别引擎发出的手势（显示任务中调用）
+     * 
+     * 待机页面连续右滑REQUIRED_SWIPE_COUNT次打开WiFi信息页面
      */
-    void handleStandbyRightSwipe();
+    void handleGesture(const GestureEvent& event);
     
     /**
      * @brief 更新WiFi信息显示
@@ -538,6 +636,120 @@ public:
      */
     bool isScreenOn() const;
     
+    /**
+     * @brief 获取显示电源状态
+     */
+    DisplayPowerState getPowerState() const;
+    
+    /**
+     * @brief 获取显示电源状态统计
+     * 
+     * @param stats 输出统计数据
+     */
+    void getPowerStats(DisplayPowerStats* stats) const;
+    
+    /**
+     * @brief 启用/禁用熄屏渲染挂起
+     * 
+     * 禁用后熄屏期间照常渲染和更新UI，可用于对比测量挂起节省的CPU和电流
+     * 
+     * @param enabled true 启用，false 禁用
+     */
+    void setRenderSuspendEnabled(bool enabled);
+    
+    /**
+     * @brief 检查熄屏渲染挂起是否启用
+     */
+    bool isRenderSuspendEnabled() const;
+    
+    // === UI资源包功能 ===
+    
+    /**
+     * @brief 设置UI资源包管理器（在init之前调用）
+     * 
+     * @param asset_manager 资源包管理器实例指针
+     */
+    void setAssetManager(AssetManager* asset_manager);
+    
+    /**
+     * @brief 获取UI资源包管理器
+     */
+    AssetManager* getAssetManager() const;
+    
+    /**
+     * @brief 切换UI资源包（通过消息队列，在显示任务中执行）
+     * 
+     * @param path SPIFFS中的资源包路径，空字符串表示只使用内置资源
+     */
+    void setAssetPack(const char* path);
+    
+    /**
+     * @brief 调整资源缓存（通过消息队列，在显示任务中执行）
+     * 
+     * @param budget_bytes 缓存容量上限，0表示不修改
+     * @param clear 是否释放未在显示的资源
+     */
+    void setAssetCache(uint32_t budget_bytes, bool clear);
+    
+    // === 屏幕按需创建功能 ===
+    
+    /**
+     * @brief 屏幕按需创建后的处理（由_ui_screen_change回调，调用时已持有LVGL锁）
+     * 
+     * @param screen 新创建的屏幕
+     * @param build_us 创建耗时（微秒）
+     */
+    void onScreenCreated(lv_obj_t* screen, uint32_t build_us);
+    
+    /**
+     * @brief 设置屏幕释放策略
+     * 
+     * @param idle_ms 空闲多久释放屏幕（毫秒）
+     * @param max_resident 常驻屏幕数上限
+     * @param prewarm 是否预创建下一个最可能访问的屏幕
+     */
+    void setScreenPolicy(uint32_t idle_ms, uint8_t max_resident, bool prewarm);
+    
+    /**
+     * @brief 获取屏幕管理器（查询策略）
+     */
+    const ScreenManager& getScreenManager() const;
+    
+    /**
+     * @brief 获取屏幕创建/释放统计
+     */
+    void getScreenStats(ScreenManagerStats* stats) const;
+    
+    /**
+     * @brief 获取显示任务调度统计
+     * 
+     * @param stats 输出统计数据
+     */
+    void getTaskStats(DisplayTaskStats* stats) const;
+    
+    /**
+     * @brief 重置显示任务调度统计
+     */
+    void resetTaskStats();
+    
+    /**
+     * @brief 设置功率趋势图的显示窗口并保存
+     * 
+     * @param minutes 1、10、60或1440分钟
+     * @return true 设置成功，false 不支持的窗口
+     */
+    bool setPowerTrendWindow(uint16_t minutes);
+    
+    /**
+     * @brief 获取功率趋势图（查询窗口、曲线数据和统计）
+     */
+    PowerTrend& getPowerTrend();
+    
+    /**
+     * @brief 获取屏幕镜像（查询推流统计、断开客户端）
+     */
+    ScreenMirror& getScreenMirror();
+    
     /**
      * @brief 检查触摸唤醒功能是否可用
      * 
@@ -592,6 +804,13 @@ public:
      */
     uint8_t getCurrentFadingBrightness() const;
     
+    /**
+     * @brief 获取背光渐变统计
+     * 
+     * @param stats 输出统计数据
+     */
+    void getFadeStats(BacklightFadeStats* stats) const;
+    
     /**
      * @brief 根据当前主题切换到对应的端口屏幕
      */
@@ -671,6 +890,30 @@ private:
      */
     void switchUISystem(DisplayTheme theme);
     
+    /**
+     * @brief 切换UI系统（需持有LVGL锁）
+     * 
+     * 销毁旧主题的全部屏幕并释放解码缓存和资源包缓存，创建新主题的待机屏幕，
+     * 显示数据由显示任务在锁外补齐
+     * 
+     * @param theme UI主题类型
+     * @return 切换耗时（微秒）
+     */
+    uint32_t switchUISystemLocked(DisplayTheme theme);
+    
+    /**
+     * @brief 主题切换压力测试任务
+     */
+    static void themeSoakTaskEntry(void* arg);
+    void themeSoakTask();
+    
+    /**
+     * @brief 预解码主题背景图到PSRAM
+     * 
+     * @param theme 主题
+     */
+    void preloadThemeImages(DisplayTheme theme);
+    
     /**
      * @brief 初始化UI1系统
      */
@@ -773,11 +1016,6 @@ private:
      */
     void checkAutoSwitchTimeout();
     
-    /**
-     * @brief 检查三击手势超时
-     */
-    void checkTripleSwipeTimeout();
-    
     /**
      * @brief 恢复到切换前的页面
      */
@@ -896,9 +1134,9 @@ private:
     void startFading(uint8_t targetBrightness, FadeDirection direction);
     
     /**
-     * @brief 处理亮度渐变逻辑
+     * @brief 处理亮度渐变完成后的屏幕状态
      * 
-     * 在主任务循环中定期调用，更新渐变进度
+     * 渐变本身由BacklightFader的定时器推进，显示任务只在渐变完成后更新屏幕状态
      */
     void processFading();
     
@@ -917,6 +1155,111 @@ private:
      */
     void performScreenOffImmediate();
     
+    // === 显示电源状态私有方法 ===
+    
+    /**
+     * @brief 切换显示电源状态
+     * 
+     * 进入熄屏时挂起渲染；离开熄屏时标记待补齐，由显示任务在锁外完成补齐并恢复渲染
+     * 
+     * @param state 目标状态
+     */
+    void setPowerState(DisplayPowerState state);
+    
+    /**
+     * @brief 处理待完成的唤醒补齐（显示任务循环中调用，不能持有LVGL锁）
+     */
+    void processPowerState();
+    
+    /**
+     * @brief 释放空闲屏幕并预创建下一个屏幕（显示任务循环中调用，不能持有LVGL锁）
+     */
+    void processScreenMaintenance();
+    
+    /**
+     * @brief 为新创建的屏幕注册资源替换并标记待补齐数据（需持有LVGL锁）
+     */
+    void prepareNewScreen();
+    
+    /**
+     * @brief 在当前主题已创建的功率屏幕上挂载趋势图（需持有LVGL锁）
+     */
+    void attachPowerTrends();
+    
+    /**
+     * @brief 追加趋势图的新数据点（显示任务每秒调用，不能持有LVGL锁）
+     */
+    void processPowerTrend();
+    
+    /**
+     * @brief 显示任务事件位（任务通知）
+     */
+    enum DisplayTaskEvent {
+        TASK_EVT_MESSAGE = 1 << 0,      ///< 消息队列有新消息
+        TASK_EVT_REFRESH = 1 << 1,      ///< 新屏幕待补齐数据
+        TASK_EVT_POWER = 1 << 2,        ///< 电源状态变化（唤醒补齐）
+        TASK_EVT_FADE = 1 << 3,         ///< 背光渐变完成
+        TASK_EVT_STATE = 1 << 4         ///< 需要重新设置定时器的状态变化（手势、自动切换等）
+    };
+    
+    /**
+     * @brief 显示任务软定时器编号
+     */
+    enum DisplayTimerId {
+        TIMER_CLOCK = 0,                ///< 时间标签（对齐整秒，熄屏时停止）
+        TIMER_WEATHER,                  ///< 天气标签
+        TIMER_SCREEN_MODE,              ///< 屏幕模式管理
+        TIMER_POWER_PAGE,               ///< 基于总功率的页面切换
+        TIMER_AUTO_SWITCH,              ///< 端口自动切换超时（单次）
+        TIMER_MAINTENANCE,              ///< 释放空闲屏幕、预创建
+        TIMER_TREND,                    ///< 趋势图下一个点完成
+        TIMER_WIFI_DESTROY              ///< WiFi信息页面延迟销毁检查
+    };
+    
+    /**
+     * @brief 发送消息到显示任务并唤醒任务
+     * 
+     * @param msg 消息（填写入队时间）
+     * @param timeout 队列满时的等待时间
+     * @return pdTRUE 成功，pdFALSE 失败
+     */
+    BaseType_t postMessage(DisplayMessage& msg, TickType_t timeout);
+    
+    /**
+     * @brief 设置显示任务事件位（任意任务调用）
+     */
+    void notifyTask(uint32_t events);
+    
+    /**
+     * @brief 背光渐变完成回调（背光发送任务中调用）
+     */
+    static void fadeCompleteCallback(void* arg);
+    
+    /**
+     * @brief 手势回调（LVGL任务中调用，转发为显示任务消息）
+     */
+    static void gestureCallback(const GestureEvent& event, void* userdata);
+    
+    /**
+     * @brief 按当前状态设置或取消软定时器（显示任务每次唤醒后调用）
+     */
+    void armTimers();
+    
+    /**
+     * @brief 执行到期的软定时器（不能持有LVGL锁）
+     */
+    void runTimer(int id);
+    
+    /**
+     * @brief 检查WiFi信息页面是否可以销毁，满足条件时发送销毁消息
+     */
+    void processWiFiInfoDestroy();
+    
+    /**
+     * @brief 检查是否应跳过UI更新（熄屏且渲染挂起时）
+     */
+    bool isUIUpdateSuspended() const;
+    
 private:
     // 成员变量
     bool m_initialized;                 ///< 初始化状态
@@ -933,6 +1276,7 @@ private:
     ConfigStorage* m_configStorage;     ///< 配置存储指针
     PSRAMManager* m_psramManager;        ///< PSRAM管理器指针
     WeatherManager* m_weatherManager;   ///< 天气管理器指针
+    AssetManager* m_assetManager;       ///< UI资源包管理器指针
     
     // 显示状态
     DisplayPage m_currentPage;          ///< 当前页面
@@ -986,10 +1330,8 @@ private:
     bool m_wifiInfoPendingDestroy;      ///< WiFi信息页面是否等待销毁
     TickType_t m_lastWiFiSwitchTime;    ///< 上次WiFi页面切换时间，用于5秒冷却
     
-    // === 三击手势检测成员变量 ===
-    TickType_t m_firstSwipeTime;        ///< 第一次右滑时间
-    uint8_t m_swipeCount;               ///< 当前滑动次数计数
-    static const uint32_t TRIPLE_SWIPE_TIMEOUT_MS = 2000; ///< 三击超时时间（2秒）
+    // === 三击手势检测成员变量（时间窗口由手势引擎的连续滑动计数负责） ===
+    uint8_t m_swipeCount;               ///< 待机页面上的连续右滑次数
     static const uint8_t REQUIRED_SWIPE_COUNT = 3;         ///< 需要的滑动次数
     
     // === 自动切换端口成员变量 ===
@@ -1025,6 +1367,37 @@ private:
     uint32_t m_fadeDuration;            ///< 渐变持续时间（毫秒）
     bool m_isFading;                    ///< 是否正在渐变中
     FadeDirection m_fadeDirection;      ///< 渐变方向
+    BacklightFader m_fader;             ///< 背光渐变控制器（esp_timer驱动）
+    
+    // === 显示电源状态成员变量 ===
+    volatile DisplayPowerState m_powerState;  ///< 当前显示电源状态
+    bool m_renderSuspendEnabled;        ///< 是否在熄屏时挂起渲染
+    volatile bool m_uiDirty;            ///< 熄屏期间有被跳过的UI更新
+    volatile bool m_catchUpPending;     ///< 唤醒后待补齐UI并恢复渲染
+    uint32_t m_darkStartTime;           ///< 本次熄屏开始时间
+    DisplayPowerStats m_powerStats;     ///< 显示电源状态统计
+    
+    // === 屏幕按需创建成员变量 ===
+    ScreenManager m_screenManager;      ///< 屏幕按需创建管理器
+    volatile bool m_screenRefreshPending;  ///< 有新创建的屏幕待补齐显示数据
+    
+    // === 功率趋势图成员变量 ===
+    PowerTrend m_powerTrend;            ///< 功率历史与趋势图
+    
+    // === 屏幕镜像成员变量 ===
+    ScreenMirror m_screenMirror;        ///< 远程屏幕镜像（WebSocket）
+    
+    // === 显示任务调度成员变量 ===
+    SoftTimerWheel m_timers;            ///< 显示任务软定时器（只在显示任务中访问）
+    DisplayTaskStats m_taskStats;       ///< 显示任务调度统计
+    int64_t m_taskStatsStartUs;         ///< 统计开始时间
+    uint64_t m_msgLatencyTotalUs;       ///< 消息延迟累计
+    
+    // === 主题切换压力测试成员变量 ===
+    ThemeSoakStats m_soakStats;         ///< 压力测试结果
+    volatile bool m_soakStopRequested;  ///< 请求停止压力测试
+    SemaphoreHandle_t m_soakSwitchDone; ///< 显示任务处理完主题切换消息（压力测试等待）
+    volatile uint32_t m_soakSwitchUs;   ///< 最近一次切换耗时，未切换时为0
     
     // 任务配置
     static const uint32_t TASK_STACK_SIZE = 9 * 1024;    ///< 任务栈大小
@@ -1032,15 +1405,25 @@ private:
     static const BaseType_t TASK_CORE = 0;               ///< 任务运行核心
     static const uint32_t MESSAGE_QUEUE_SIZE = 10;       ///< 消息队列大小
     
+    // 主题切换压力测试配置
+    static const uint32_t SOAK_MAX_CYCLES = 10000;       ///< 最大切换次数
+    static const uint32_t SOAK_WARMUP_CYCLES = 4;        ///< 预热切换次数（缓存达到稳态后再取基线）
+    static const uint32_t SOAK_CYCLE_DELAY_MS = 20;      ///< 每次切换后等待渲染和数据补齐的时间
+    static const uint32_t SOAK_HEAP_TOLERANCE = 2048;    ///< 内部RAM/PSRAM残留容差（其他任务也在分配）
+    static const uint32_t SOAK_LVGL_TOLERANCE = 512;     ///< LVGL内存残留容差（标签文本长度随数据变化）
+    
     // 屏幕模式相关常量
     static const uint32_t SCREEN_MODE_CHECK_INTERVAL = 1000;  ///< 屏幕模式检查间隔（毫秒）
+    static const uint32_t SCREEN_MODE_DARK_CHECK_INTERVAL = 5000;  ///< 熄屏时屏幕模式检查间隔（毫秒）
+    static const uint32_t WEATHER_REFRESH_INTERVAL = 30000;   ///< 天气标签刷新间隔（毫秒）
+    static const uint32_t MAINTENANCE_INTERVAL = 1000;        ///< 屏幕释放/预创建检查间隔（毫秒）
+    static const uint32_t MAINTENANCE_DARK_INTERVAL = 10000;  ///< 熄屏时屏幕释放检查间隔（毫秒）
+    static const uint32_t WIFI_DESTROY_CHECK_INTERVAL = 1000; ///< WiFi信息页面销毁检查间隔（毫秒）
     static const uint32_t TOUCH_TIMEOUT_MARGIN = 5000;        ///< 触摸超时边距（毫秒）
 };
 
 // C风格包装函数声明（供UI系统调用）
 extern "C" void updateDisplayManagerCurrentPage(void* screen);
-
-// UI系统调用WiFi信息页面的桥接函数声明
-extern "C" void showWiFiInfoPageFromUI();
+extern "C" void notifyDisplayManagerScreenCreated(void* screen, uint32_t build_us);
 
 #endif // DISPLAY_MANAGER_H 
\ No newline at end of file
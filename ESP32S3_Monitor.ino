@@ -39,6 +39,7 @@
 #include "WebServerManager.h"
 #include "OTAManager.h"
 #include "FileManager.h"
+#include "AssetManager.h"
 #include "LVGL_Driver.h"
 #include "DisplayManager.h"
 #include "PSRAMManager.h"
@@ -62,6 +63,7 @@ WiFiManager wifiManager;
 WebServerManager* webServerManager;
 OTAManager otaManager;
 FileManager fileManager;
+AssetManager assetManager;
 DisplayManager displayManager;
 PSRAMManager psramManager;
 TimeManager timeManager;
@@ -90,7 +92,8 @@ void setup() {
   
   // 初始化PSRAM管理器（优先初始化）
   printf("\n初始化PSRAM管理器...\n");
-  if (psramManager.init()) {
+  bool psramReady = psramManager.init();
+  if (psramReady) {
     psramManager.start();
     psramManager.setDebugMode(false); // 生产环境关闭调试模式
     printf("PSRAM管理器初始化成功\n");
@@ -126,7 +129,7 @@ void setup() {
   
   // 初始化LVGL驱动系统
   printf("开始LVGL驱动系统初始化...\n");
-  lvglDriverInstance.init();
+  lvglDriverInstance.init(psramReady ? &psramManager : nullptr);
     // 设置全局LVGL驱动指针
     lvglDriver = &lvglDriverInstance;
   // 启动LVGL驱动任务  
@@ -141,6 +144,13 @@ void setup() {
   // 初始化文件管理器
   fileManager.init();
   
+  // 初始化UI资源包管理器（需要SPIFFS和LVGL，注册LVGL文件系统驱动）
+  printf("初始化UI资源包管理器...\n");
+  if (lvglDriverInstance.lock(5000)) {
+    assetManager.init(&fileManager, &psramManager);
+    lvglDriverInstance.unlock();
+  }
+  
   // 初始化天气管理器（需要在DisplayManager之前初始化）
   printf("开始初始化天气管理器...\n");
   if (weatherManager.init(&psramManager, &wifiManager, &configStorage)) {
@@ -195,6 +205,7 @@ void setup() {
 
   // 初始化显示管理器（现在包含WeatherManager）
   printf("开始初始化显示管理器...\n");
+  displayManager.setAssetManager(&assetManager);
   displayManager.init(&lvglDriverInstance, &wifiManager, &configStorage, &psramManager, &weatherManager);
   
   // 启动显示管理器任务
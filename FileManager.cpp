@@ -165,6 +165,20 @@ bool FileManager::renameFile(const String& oldPath, const String& newPath) {
     return success;
 }
 
+File FileManager::openFile(const String& path, const char* mode) {
+    if (!initialized) {
+        return File();
+    }
+    
+    String sanitizedPath = sanitizePath(path);
+    if (!isValidPath(sanitizedPath)) {
+        printf("无效的文件路径: %s\n", sanitizedPath.c_str());
+        return File();
+    }
+    
+    return SPIFFS.open(sanitizedPath, mode);
+}
+
 std::vector<FileInfo> FileManager::listFiles(const String& path) {
     std::vector<FileInfo> files;
     
@@ -38,6 +38,9 @@ public:
     bool deleteFile(const String& path);
     bool renameFile(const String& oldPath, const String& newPath);
     
+    // 流式打开文件（供LVGL文件系统驱动等按块读取的场景，调用者负责关闭）
+    File openFile(const String& path, const char* mode = FILE_READ);
+    
     // 目录操作
     bool createDirectory(const String& path);
     bool deleteDirectory(const String& path);
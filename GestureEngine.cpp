@@ -0,0 +1,213 @@
+/*
+ * GestureEngine.cpp - 触摸手势识别引擎实现文件
+ * ESP32S3监控项目 - 输入处理模块
+ */
+
+#include "GestureEngine.h"
+#include <stdlib.h>
+#include <math.h>
+
+GestureEngine::GestureEngine()
+    : m_mux(portMUX_INITIALIZER_UNLOCKED)
+    , m_callback(nullptr)
+    , m_callbackUserdata(nullptr)
+    , m_pressed(false)
+    , m_moved(false)
+    , m_longPressFired(false)
+    , m_startX(0)
+    , m_startY(0)
+    , m_lastX(0)
+    , m_lastY(0)
+    , m_startMs(0)
+    , m_tapPending(false)
+    , m_tapX(0)
+    , m_tapY(0)
+    , m_tapMs(0)
+    , m_swipeDir(GESTURE_DIR_NONE)
+    , m_swipeCount(0)
+    , m_swipeFirstMs(0) {
+    m_config.tap_slop_px = GESTURE_TAP_SLOP_PX;
+    m_config.tap_max_ms = GESTURE_TAP_MAX_MS;
+    m_config.double_tap_ms = GESTURE_DOUBLE_TAP_MS;
+    m_config.long_press_ms = GESTURE_LONG_PRESS_MS;
+    m_config.swipe_min_distance_px = GESTURE_SWIPE_MIN_DISTANCE_PX;
+    m_config.swipe_min_velocity = GESTURE_SWIPE_MIN_VELOCITY;
+    m_config.swipe_max_ms = GESTURE_SWIPE_MAX_MS;
+    m_config.multi_swipe_window_ms = GESTURE_MULTI_SWIPE_WINDOW_MS;
+}
+
+void GestureEngine::setCallback(GestureCallback callback, void* userdata) {
+    // 回调和用户数据成对更新，识别在另一个核的LVGL任务中进行
+    portENTER_CRITICAL(&m_mux);
+    m_callback = callback;
+    m_callbackUserdata = userdata;
+    portEXIT_CRITICAL(&m_mux);
+}
+
+void GestureEngine::setConfig(const GestureConfig& config) {
+    portENTER_CRITICAL(&m_mux);
+    if (config.tap_slop_px) m_config.tap_slop_px = config.tap_slop_px;
+    if (config.tap_max_ms) m_config.tap_max_ms = config.tap_max_ms;
+    if (config.double_tap_ms) m_config.double_tap_ms = config.double_tap_ms;
+    if (config.long_press_ms) m_config.long_press_ms = config.long_press_ms;
+    if (config.swipe_min_distance_px) m_config.swipe_min_distance_px = config.swipe_min_distance_px;
+    if (config.swipe_min_velocity) m_config.swipe_min_velocity = config.swipe_min_velocity;
+    if (config.swipe_max_ms) m_config.swipe_max_ms = config.swipe_max_ms;
+    if (config.multi_swipe_window_ms) m_config.multi_swipe_window_ms = config.multi_swipe_window_ms;
+    portEXIT_CRITICAL(&m_mux);
+}
+
+GestureConfig GestureEngine::getConfig() const {
+    portENTER_CRITICAL(&m_mux);
+    GestureConfig config = m_config;
+    portEXIT_CRITICAL(&m_mux);
+    return config;
+}
+
+void GestureEngine::feed(bool pressed, int16_t x, int16_t y, uint32_t timestamp_ms) {
+    GestureConfig cfg = getConfig();
+
+    if (pressed) {
+        if (!m_pressed) {
+            // 按下
+            m_pressed = true;
+            m_moved = false;
+            m_longPressFired = false;
+            m_startX = x;
+            m_startY = y;
+            m_startMs = timestamp_ms;
+        }
+        m_lastX = x;
+        m_lastY = y;
+
+        if (!m_moved && (abs(x - m_startX) > cfg.tap_slop_px || abs(y - m_startY) > cfg.tap_slop_px)) {
+            m_moved = true;
+        }
+
+        // 长按在达到时间的那次采样中发出，不等抬起
+        uint32_t held_ms = timestamp_ms - m_startMs;
+        if (!m_moved && !m_longPressFired && held_ms >= cfg.long_press_ms) {
+            m_longPressFired = true;
+            m_tapPending = false;
+            GestureEvent event = {};
+            event.type = GESTURE_LONG_PRESS;
+            event.x = m_startX;
+            event.y = m_startY;
+            event.duration_ms = held_ms;
+            event.timestamp_ms = timestamp_ms;
+            emit(event);
+        }
+        return;
+    }
+
+    if (m_pressed) {
+        m_pressed = false;
+        if (!m_longPressFired) {
+            recognizeRelease(cfg, timestamp_ms);
+        }
+    }
+}
+
+void GestureEngine::recognizeRelease(const GestureConfig& cfg, uint32_t timestamp_ms) {
+    int16_t dx = m_lastX - m_startX;
+    int16_t dy = m_lastY - m_startY;
+    uint32_t duration_ms = timestamp_ms - m_startMs;
+
+    GestureEvent event = {};
+    event.x = m_startX;
+    event.y = m_startY;
+    event.dx = dx;
+    event.dy = dy;
+    event.duration_ms = duration_ms;
+    event.timestamp_ms = timestamp_ms;
+
+    if (!m_moved) {
+        if (duration_ms > cfg.tap_max_ms) {
+            return;
+        }
+
+        // 与上一次单击足够近且间隔足够短时合成双击
+        if (m_tapPending && timestamp_ms - m_tapMs <= cfg.double_tap_ms &&
+            abs(m_startX - m_tapX) <= cfg.tap_slop_px * 2 && abs(m_startY - m_tapY) <= cfg.tap_slop_px * 2) {
+            m_tapPending = false;
+            event.type = GESTURE_DOUBLE_TAP;
+        } else {
+            m_tapPending = true;
+            m_tapX = m_startX;
+            m_tapY = m_startY;
+            m_tapMs = timestamp_ms;
+            event.type = GESTURE_TAP;
+        }
+        emit(event);
+        return;
+    }
+
+    m_tapPending = false;
+
+    // 滑动：主轴位移、持续时间和平均速度都满足阈值
+    int adx = abs(dx);
+    int ady = abs(dy);
+    int distance = adx > ady ? adx : ady;
+    if (distance < cfg.swipe_min_distance_px || duration_ms > cfg.swipe_max_ms) {
+        return;
+    }
+    uint32_t velocity = (uint32_t)(sqrtf((float)dx * dx + (float)dy * dy) * 1000.0f / (duration_ms ? duration_ms : 1));
+    if (velocity < cfg.swipe_min_velocity) {
+        return;
+    }
+
+    GestureDirection dir;
+    if (adx >= ady) {
+        dir = dx > 0 ? GESTURE_DIR_RIGHT : GESTURE_DIR_LEFT;
+    } else {
+        dir = dy > 0 ? GESTURE_DIR_DOWN : GESTURE_DIR_UP;
+    }
+
+    // 连续同向滑动计数：方向改变或超出窗口时重新计数
+    if (m_swipeCount > 0 && dir == m_swipeDir && timestamp_ms - m_swipeFirstMs <= cfg.multi_swipe_window_ms) {
+        if (m_swipeCount < 255) {
+            m_swipeCount++;
+        }
+    } else {
+        m_swipeDir = dir;
+        m_swipeCount = 1;
+        m_swipeFirstMs = timestamp_ms;
+    }
+
+    event.type = GESTURE_SWIPE;
+    event.dir = dir;
+    event.count = m_swipeCount;
+    event.velocity = velocity > 0xFFFF ? 0xFFFF : (uint16_t)velocity;
+    emit(event);
+}
+
+void GestureEngine::emit(const GestureEvent& event) {
+    // 在锁内取出成对的回调和用户数据，锁外调用（回调会投递消息，不能在临界区内执行）
+    portENTER_CRITICAL(&m_mux);
+    GestureCallback callback = m_callback;
+    void* userdata = m_callbackUserdata;
+    portEXIT_CRITICAL(&m_mux);
+    if (callback) {
+        callback(event, userdata);
+    }
+}
+
+const char* GestureEngine::typeName(GestureType type) {
+    switch (type) {
+        case GESTURE_TAP:        return "单击";
+        case GESTURE_DOUBLE_TAP: return "双击";
+        case GESTURE_LONG_PRESS: return "长按";
+        case GESTURE_SWIPE:      return "滑动";
+        default:                 return "无";
+    }
+}
+
+const char* GestureEngine::directionName(GestureDirection dir) {
+    switch (dir) {
+        case GESTURE_DIR_LEFT:  return "左";
+        case GESTURE_DIR_RIGHT: return "右";
+        case GESTURE_DIR_UP:    return "上";
+        case GESTURE_DIR_DOWN:  return "下";
+        default:                return "无";
+    }
+}
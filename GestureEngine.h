@@ -0,0 +1,165 @@
+/*
+ * GestureEngine.h - 触摸手势识别引擎头文件
+ * ESP32S3监控项目 - 输入处理模块
+ *
+ * 功能特性：
+ * - 输入带时间戳的原始触摸采样（LVGL触摸读取回调每个输入周期调用一次）
+ * - 识别滑动（方向、速度）、连续同向滑动、长按、单击、双击
+ * - 阈值可配置，运行时修改立即生效
+ * - 手势在产生它的那次采样中识别完成，通过回调直接发出
+ *
+ * 采样和识别只在LVGL任务中进行，配置可由任意任务修改
+ */
+
+#ifndef GESTURE_ENGINE_H
+#define GESTURE_ENGINE_H
+
+#include <stdint.h>
+#include "freertos/FreeRTOS.h"
+
+// === 默认阈值 ===
+#define GESTURE_TAP_SLOP_PX             12      // 单击/长按允许的最大移动距离
+#define GESTURE_TAP_MAX_MS              300     // 单击最长按下时间
+#define GESTURE_DOUBLE_TAP_MS           350     // 双击两次抬起的最大间隔
+#define GESTURE_LONG_PRESS_MS           600     // 长按触发时间
+#define GESTURE_SWIPE_MIN_DISTANCE_PX   50      // 滑动最小距离（与LVGL默认gesture_limit一致）
+#define GESTURE_SWIPE_MIN_VELOCITY      150     // 滑动最小平均速度（像素/秒）
+#define GESTURE_SWIPE_MAX_MS            800     // 滑动最长持续时间
+#define GESTURE_MULTI_SWIPE_WINDOW_MS   2000    // 连续滑动计数窗口（从第一次滑动开始计算）
+
+/**
+ * @brief 手势类型
+ */
+enum GestureType {
+    GESTURE_NONE = 0,
+    GESTURE_TAP,            ///< 单击
+    GESTURE_DOUBLE_TAP,     ///< 双击（第二次抬起时发出，第二次不再发单击）
+    GESTURE_LONG_PRESS,     ///< 长按（按住达到时间时发出，抬起后不再发单击/滑动）
+    GESTURE_SWIPE           ///< 滑动（抬起时发出，count为窗口内连续同向滑动次数）
+};
+
+/**
+ * @brief 滑动方向（屏幕逻辑坐标）
+ */
+enum GestureDirection {
+    GESTURE_DIR_NONE = 0,
+    GESTURE_DIR_LEFT,
+    GESTURE_DIR_RIGHT,
+    GESTURE_DIR_UP,
+    GESTURE_DIR_DOWN
+};
+
+/**
+ * @brief 识别出的手势事件
+ */
+struct GestureEvent {
+    GestureType type;           ///< 手势类型
+    GestureDirection dir;       ///< 滑动方向（仅滑动）
+    uint8_t count;              ///< 连续同向滑动次数（仅滑动，从1开始）
+    int16_t x;                  ///< 起点X
+    int16_t y;                  ///< 起点Y
+    int16_t dx;                 ///< 终点相对起点的X位移
+    int16_t dy;                 ///< 终点相对起点的Y位移
+    uint16_t velocity;          ///< 平均速度（像素/秒，仅滑动）
+    uint32_t duration_ms;       ///< 按下持续时间
+    uint32_t timestamp_ms;      ///< 识别时间
+};
+
+/**
+ * @brief 手势阈值配置
+ */
+struct GestureConfig {
+    uint16_t tap_slop_px;
+    uint16_t tap_max_ms;
+    uint16_t double_tap_ms;
+    uint16_t long_press_ms;
+    uint16_t swipe_min_distance_px;
+    uint16_t swipe_min_velocity;
+    uint16_t swipe_max_ms;
+    uint16_t multi_swipe_window_ms;
+};
+
+/**
+ * @brief 手势回调（在LVGL任务中调用，不能阻塞）
+ */
+typedef void (*GestureCallback)(const GestureEvent& event, void* userdata);
+
+/**
+ * @brief 触摸手势识别引擎
+ */
+class GestureEngine {
+public:
+    GestureEngine();
+
+    /**
+     * @brief 输入一次触摸采样
+     *
+     * @param pressed 是否按下
+     * @param x 逻辑X坐标（未按下时忽略）
+     * @param y 逻辑Y坐标（未按下时忽略）
+     * @param timestamp_ms 采样时间（毫秒，回绕安全）
+     */
+    void feed(bool pressed, int16_t x, int16_t y, uint32_t timestamp_ms);
+
+    /**
+     * @brief 设置手势回调（回调和用户数据在锁内一起替换，可在识别进行中调用）
+     */
+    void setCallback(GestureCallback callback, void* userdata);
+
+    /**
+     * @brief 设置阈值（为0的字段保持原值）
+     */
+    void setConfig(const GestureConfig& config);
+
+    /**
+     * @brief 获取当前阈值
+     */
+    GestureConfig getConfig() const;
+
+    /**
+     * @brief 手势类型名称（日志用）
+     */
+    static const char* typeName(GestureType type);
+
+    /**
+     * @brief 滑动方向名称（日志用）
+     */
+    static const char* directionName(GestureDirection dir);
+
+private:
+    GestureConfig m_config;
+    mutable portMUX_TYPE m_mux;         ///< 保护m_config和回调
+
+    GestureCallback m_callback;
+    void* m_callbackUserdata;
+
+    // 当前按压
+    bool m_pressed;
+    bool m_moved;               ///< 移动超过tap_slop，不再是单击/长按
+    bool m_longPressFired;      ///< 本次按压已发出长按
+    int16_t m_startX;
+    int16_t m_startY;
+    int16_t m_lastX;
+    int16_t m_lastY;
+    uint32_t m_startMs;
+
+    // 双击：上一次单击
+    bool m_tapPending;
+    int16_t m_tapX;
+    int16_t m_tapY;
+    uint32_t m_tapMs;
+
+    // 连续滑动
+    GestureDirection m_swipeDir;
+    uint8_t m_swipeCount;
+    uint32_t m_swipeFirstMs;
+
+    /**
+     * @brief 抬起时识别单击/双击/滑动
+     */
+    void recognizeRelease(const GestureConfig& cfg, uint32_t timestamp_ms);
+
+    void emit(const GestureEvent& event);
+};
+
+#endif // GESTURE_ENGINE_H
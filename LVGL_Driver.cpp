@@ -16,6 +16,7 @@
  */
 
 #include <stdio.h>
+#include <string.h>             // 内存拷贝（弹跳缓冲区）
 #include <math.h>               // 数学函数库（fabs等）
 
 // === FreeRTOS系统相关头文件 ===
@@ -42,10 +43,13 @@
 #include "esp_lcd_sh8601.h"       // SH8601 LCD控制器驱动
 #include "touch_bsp.h"            // 触摸屏板级支持包
 #include "I2CBusManager.h"        // I2C总线管理器
+#include "RLEImageDecoder.h"      // RLE压缩图片解码器
+#include "PSRAMManager.h"         // 按能力分配内存
 
 // === 常量定义 ===
 static const char *TAG = "ESP_LCD_LVGL";  // 日志标签
 static SemaphoreHandle_t lvgl_mux = NULL;  // LVGL互斥锁，保证线程安全
+static SemaphoreHandle_t lvgl_panel_io_mux = NULL;  // 面板IO互斥锁，esp_lcd的SPI面板IO不是线程安全的
 
 // === 硬件接口配置 ===
 #define LCD_HOST SPI2_HOST        // LCD使用的SPI主机接口
@@ -68,12 +72,13 @@ static SemaphoreHandle_t lvgl_mux = NULL;  // LVGL互斥锁，保证线程安全
 // === LCD显示屏参数 ===
 #define LCD_H_RES 368     // LCD水平分辨率（宽度）
 #define LCD_V_RES 448     // LCD垂直分辨率（高度）
+#define LCD_MIRROR_X_GAP 0  // MADCTL X镜像时的列地址偏移（控制器RAM宽度与屏幕宽度之差）
 
 // === 触摸屏功能开关 ===
 #define USE_TOUCH 1       // 1：启用触摸功能，0：禁用触摸功能
 
 // === LVGL配置参数 ===
-#define LVGL_BUF_HEIGHT (LCD_V_RES / 4)  // LVGL缓冲区高度（屏幕高度的1/4）
+#define LVGL_BOUNCE_BUF_PIXELS (LCD_H_RES * LVGL_BOUNCE_BUF_LINES)  // 单个弹跳缓冲区像素数
 #define LVGL_TICK_PERIOD_MS 2                    // LVGL时钟节拍周期（毫秒）
 #define LVGL_TASK_MAX_DELAY_MS 500               // LVGL任务最大延迟时间
 #define LVGL_TASK_MIN_DELAY_MS 1                 // LVGL任务最小延迟时间
@@ -102,6 +107,227 @@ static const sh8601_lcd_init_cmd_t lcd_init_cmds[] = {
   { 0x51, (uint8_t[]){ 0x80 }, 1, 0 },           // 亮度设置为中等值（50%）
 };
 
+/**
+ * @brief 绘图缓冲区运行状态
+ * 
+ * 记录当前缓冲区策略和缓冲区指针，
+ * 由刷新回调、刷新完成中断和运行时策略切换共同使用。
+ */
+typedef struct {
+  lvgl_buffer_strategy_t strategy;   // 当前缓冲区策略
+  uint16_t lines;                    // 缓冲区行数
+  lv_color_t *buf1;                  // 绘图缓冲区1
+  lv_color_t *buf2;                  // 绘图缓冲区2
+  uint32_t buf_pixels;               // 单个绘图缓冲区像素数
+  size_t internal_bytes;             // 占用的内部RAM字节数
+  size_t psram_bytes;                // 占用的PSRAM字节数
+  uint8_t *bounce_buf[2];            // 内部DMA弹跳缓冲区
+  SemaphoreHandle_t bounce_sem;      // 空闲弹跳缓冲区计数信号量
+  volatile bool bounce_mode;         // 刷新是否经过弹跳缓冲区
+} lvgl_buffer_state_t;
+
+static lvgl_buffer_state_t lvgl_buf = {};
+static PSRAMManager *lvgl_mem = NULL;  // 绘图缓冲区分配器（为空时直接使用heap_caps）
+
+/**
+ * @brief 硬件旋转状态
+ * 
+ * SH8601的MADCTL只支持X镜像（不支持Y镜像和XY交换），
+ * 180度由X镜像 + 刷新时倒序发送行实现，90/270度回退到LVGL软件旋转。
+ */
+static struct {
+  volatile bool hw_flip_180;         // 是否处于硬件180度旋转
+  lv_color_t row_tmp[LCD_H_RES];     // 就地倒序行时的临时行缓冲
+} lvgl_rot = {};
+
+/**
+ * @brief 显示管线性能计数器
+ * 
+ * 由刷新回调、刷新完成中断、LVGL任务和加锁函数累加，
+ * 多任务/中断共同写入的字段通过lvgl_perf_spinlock保护。
+ */
+typedef struct {
+  uint32_t frames;                   // 完成的帧数（最后一个刷新区域计为一帧）
+  uint32_t areas;                    // 刷新区域数
+  uint32_t merged_areas;             // 被合并器并入其他区域的无效区域数
+  uint64_t pixels;                   // 推送的像素数
+  uint64_t bytes;                    // 通过QSPI推送的字节数
+  int64_t flush_start_us;            // 本次刷新开始时间
+  uint64_t flush_total_us;           // 累计刷新耗时（flush_cb到刷新完成）
+  uint32_t flush_max_us;             // 最大刷新耗时
+  uint32_t handler_count;            // lv_timer_handler调用次数
+  uint64_t handler_total_us;         // lv_timer_handler累计耗时
+  uint32_t handler_max_us;           // lv_timer_handler最大耗时
+  uint32_t lock_count;               // 成功加锁次数
+  uint32_t lock_timeouts;            // 加锁超时次数
+  uint64_t lock_wait_total_us;       // 累计锁等待时间
+  uint32_t lock_wait_max_us;         // 最大锁等待时间
+  int64_t window_start_us;           // 帧率统计窗口开始时间
+  uint32_t window_frames;            // 窗口开始时的帧数
+  uint32_t window_areas;             // 窗口开始时的区域数
+  float fps;                         // 最近窗口帧率
+  float areas_per_frame;             // 最近窗口平均每帧区域数
+  int64_t stats_start_us;            // 统计开始时间
+  uint32_t suspend_count;            // 进入渲染挂起的次数
+  int64_t suspend_start_us;          // 本次挂起开始时间（0表示未挂起）
+  uint64_t suspended_total_us;       // 已结束的挂起时段累计时长
+  uint64_t suspended_handler_us;     // 挂起期间lv_timer_handler累计耗时
+} lvgl_perf_counters_t;
+
+static lvgl_perf_counters_t lvgl_perf = {};
+
+/**
+ * @brief 刷新捕获回调（屏幕镜像），由刷新回调在LVGL任务中调用
+ */
+static struct {
+  volatile FlushCaptureCallback callback;  // 捕获回调（为空时不捕获）
+  void *userdata;                          // 回调用户数据
+} lvgl_capture = {};
+static portMUX_TYPE lvgl_perf_spinlock = portMUX_INITIALIZER_UNLOCKED;
+
+/**
+ * @brief 记录一次刷新完成（任务或中断上下文均可调用）
+ */
+static inline void lvgl_perf_flush_done(void) {
+  uint32_t elapsed_us = (uint32_t)(esp_timer_get_time() - lvgl_perf.flush_start_us);
+  lvgl_perf.flush_total_us += elapsed_us;
+  if (elapsed_us > lvgl_perf.flush_max_us) {
+    lvgl_perf.flush_max_us = elapsed_us;
+  }
+}
+
+/**
+ * @brief 分配绘图相关缓冲区
+ * 
+ * @param bytes 字节数
+ * @param dma true为LCD DMA直接读取的内部缓冲区，false为只由CPU访问的PSRAM缓冲区
+ * @param purpose 用途（计入PSRAM管理器统计）
+ */
+static void *lvgl_buf_alloc(size_t bytes, bool dma, const char *purpose) {
+  if (lvgl_mem) {
+    return dma ? lvgl_mem->allocateCaps(bytes, MEM_CAP_DMA, purpose, 0, MEM_INTERNAL_ONLY)
+               : lvgl_mem->allocateCaps(bytes, MEM_CAP_SPIRAM, purpose, 0, MEM_PSRAM_ONLY, POOL_GRAPHICS);
+  }
+  return heap_caps_malloc(bytes, dma ? (MALLOC_CAP_DMA | MALLOC_CAP_INTERNAL) : MALLOC_CAP_SPIRAM);
+}
+
+static void lvgl_buf_free(void *ptr) {
+  if (lvgl_mem) {
+    lvgl_mem->deallocate(ptr);
+  } else {
+    heap_caps_free(ptr);
+  }
+}
+
+/**
+ * @brief 分配背景图解码缓存（与绘图缓冲区一样经PSRAM管理器分配，受内存压力调控）
+ */
+static void *lvgl_img_cache_alloc(size_t bytes) {
+  return lvgl_buf_alloc(bytes, false, "背景图解码缓存");
+}
+
+/**
+ * @brief 释放当前绘图缓冲区和弹跳缓冲区
+ */
+static void lvgl_free_draw_buffers(void) {
+  lvgl_buf.bounce_mode = false;
+  
+  if (lvgl_buf.buf1) {
+    lvgl_buf_free(lvgl_buf.buf1);
+    lvgl_buf.buf1 = NULL;
+  }
+  if (lvgl_buf.buf2) {
+    lvgl_buf_free(lvgl_buf.buf2);
+    lvgl_buf.buf2 = NULL;
+  }
+  for (int i = 0; i < 2; i++) {
+    if (lvgl_buf.bounce_buf[i]) {
+      lvgl_buf_free(lvgl_buf.bounce_buf[i]);
+      lvgl_buf.bounce_buf[i] = NULL;
+    }
+  }
+  
+  lvgl_buf.buf_pixels = 0;
+  lvgl_buf.internal_bytes = 0;
+  lvgl_buf.psram_bytes = 0;
+}
+
+/**
+ * @brief 按指定策略分配绘图缓冲区
+ * 
+ * - 内部条带：两个内部DMA条带缓冲区，行数取偶数并限制在[2, LCD_V_RES]
+ * - PSRAM整帧/直接模式：两个PSRAM整帧缓冲区 + 两个内部DMA弹跳缓冲区
+ * 
+ * @param strategy 缓冲区策略
+ * @param lines 条带行数（仅内部条带模式有效）
+ * @return true 分配成功，false 分配失败（已释放部分分配的内存）
+ */
+static bool lvgl_alloc_draw_buffers(lvgl_buffer_strategy_t strategy, uint16_t lines) {
+  if (strategy == LVGL_BUF_INTERNAL_STRIPE) {
+    lines &= ~1;
+    if (lines < 2) {
+      lines = 2;
+    } else if (lines > LCD_V_RES) {
+      lines = LCD_V_RES;
+    }
+    
+    size_t bytes = LCD_H_RES * lines * sizeof(lv_color_t);
+    lvgl_buf.buf1 = (lv_color_t *)lvgl_buf_alloc(bytes, true, "LVGL条带缓冲区");
+    lvgl_buf.buf2 = (lv_color_t *)lvgl_buf_alloc(bytes, true, "LVGL条带缓冲区");
+    if (!lvgl_buf.buf1 || !lvgl_buf.buf2) {
+      printf("[ESP_LCD_LVGL] 内部DMA条带缓冲区分配失败（%d行，%u字节x2）\n", lines, bytes);
+      lvgl_free_draw_buffers();
+      return false;
+    }
+    
+    lvgl_buf.internal_bytes = bytes * 2;
+  } else {
+    lines = LCD_V_RES;
+    
+    size_t bytes = LCD_H_RES * LCD_V_RES * sizeof(lv_color_t);
+    size_t bounce_bytes = LVGL_BOUNCE_BUF_PIXELS * sizeof(lv_color_t);
+    lvgl_buf.buf1 = (lv_color_t *)lvgl_buf_alloc(bytes, false, "LVGL整帧缓冲区");
+    lvgl_buf.buf2 = (lv_color_t *)lvgl_buf_alloc(bytes, false, "LVGL整帧缓冲区");
+    lvgl_buf.bounce_buf[0] = (uint8_t *)lvgl_buf_alloc(bounce_bytes, true, "LVGL弹跳缓冲区");
+    lvgl_buf.bounce_buf[1] = (uint8_t *)lvgl_buf_alloc(bounce_bytes, true, "LVGL弹跳缓冲区");
+    if (!lvgl_buf.buf1 || !lvgl_buf.buf2 || !lvgl_buf.bounce_buf[0] || !lvgl_buf.bounce_buf[1]) {
+      printf("[ESP_LCD_LVGL] PSRAM整帧缓冲区或弹跳缓冲区分配失败\n");
+      lvgl_free_draw_buffers();
+      return false;
+    }
+    
+    if (!lvgl_buf.bounce_sem) {
+      lvgl_buf.bounce_sem = xSemaphoreCreateCounting(2, 2);
+      if (!lvgl_buf.bounce_sem) {
+        printf("[ESP_LCD_LVGL] 弹跳缓冲区信号量创建失败\n");
+        lvgl_free_draw_buffers();
+        return false;
+      }
+    }
+    
+    lvgl_buf.internal_bytes = bounce_bytes * 2;
+    lvgl_buf.psram_bytes = bytes * 2;
+    lvgl_buf.bounce_mode = true;
+  }
+  
+  lvgl_buf.strategy = strategy;
+  lvgl_buf.lines = lines;
+  lvgl_buf.buf_pixels = LCD_H_RES * lines;
+  
+  printf("[ESP_LCD_LVGL] 绘图缓冲区：%s，%d行，内部RAM %u字节，PSRAM %u字节\n",
+         LVGLDriver::getBufferStrategyName(strategy), lines,
+         lvgl_buf.internal_bytes, lvgl_buf.psram_bytes);
+  return true;
+}
+
+/**
+ * @brief 将当前缓冲区应用到LVGL显示驱动
+ */
+static void lvgl_apply_draw_buffers(lv_disp_drv_t *drv) {
+  lv_disp_draw_buf_init(drv->draw_buf, lvgl_buf.buf1, lvgl_buf.buf2, lvgl_buf.buf_pixels);
+  drv->direct_mode = (lvgl_buf.strategy == LVGL_BUF_PSRAM_DIRECT) ? 1 : 0;
+}
+
 /**
  * @brief LVGL显示刷新完成通知回调函数
  * 
@@ -114,11 +340,44 @@ static const sh8601_lcd_init_cmd_t lcd_init_cmds[] = {
  * @return false 表示不需要调用其他回调
  */
 static bool notify_lvgl_flush_ready(esp_lcd_panel_io_handle_t panel_io, esp_lcd_panel_io_event_data_t *edata, void *user_ctx) {
+  // 弹跳缓冲区模式：归还一个空闲弹跳缓冲区，由刷新回调统一通知LVGL
+  if (lvgl_buf.bounce_mode) {
+    BaseType_t high_task_woken = pdFALSE;
+    xSemaphoreGiveFromISR(lvgl_buf.bounce_sem, &high_task_woken);
+    return high_task_woken == pdTRUE;
+  }
+  
+  portENTER_CRITICAL_ISR(&lvgl_perf_spinlock);
+  lvgl_perf_flush_done();
+  portEXIT_CRITICAL_ISR(&lvgl_perf_spinlock);
+  
   lv_disp_drv_t *disp_driver = (lv_disp_drv_t *)user_ctx;
   lv_disp_flush_ready(disp_driver);  // 通知LVGL刷新完成
   return false;
 }
 
+/**
+ * @brief 获取面板IO互斥锁
+ *
+ * 颜色数据和命令共用同一个面板IO：发送命令（tx_param）时会等待并回收进行中的颜色传输，
+ * 与刷新回调同时进行会破坏进行中的传输计数或永久阻塞。刷新回调、背光亮度和MADCTL命令
+ * 都必须在持有此锁时访问面板。面板创建前没有并发访问，不加锁。
+ */
+static void panel_io_lock(void) {
+  if (lvgl_panel_io_mux) {
+    xSemaphoreTake(lvgl_panel_io_mux, portMAX_DELAY);
+  }
+}
+
+/**
+ * @brief 释放面板IO互斥锁
+ */
+static void panel_io_unlock(void) {
+  if (lvgl_panel_io_mux) {
+    xSemaphoreGive(lvgl_panel_io_mux);
+  }
+}
+
 /**
  * @brief LVGL显示缓冲区刷新回调函数
  * 
@@ -137,9 +396,101 @@ static void lvgl_flush_cb(lv_disp_drv_t *drv, const lv_area_t *area, lv_color_t
   const int offsetx2 = area->x2;  // 右下角X坐标
   const int offsety1 = area->y1;  // 左上角Y坐标
   const int offsety2 = area->y2;  // 右下角Y坐标
-
-  // 将颜色缓冲区内容复制到LCD屏幕的指定区域
-  esp_lcd_panel_draw_bitmap(panel_handle, offsetx1, offsety1, offsetx2 + 1, offsety2 + 1, color_map);
+  
+  // 统计刷新区域、像素和字节数
+  const uint32_t area_pixels = (uint32_t)(offsetx2 - offsetx1 + 1) * (offsety2 - offsety1 + 1);
+  portENTER_CRITICAL(&lvgl_perf_spinlock);
+  lvgl_perf.areas++;
+  lvgl_perf.pixels += area_pixels;
+  lvgl_perf.bytes += area_pixels * sizeof(lv_color_t);
+  if (lv_disp_flush_is_last(drv)) {
+    lvgl_perf.frames++;
+  }
+  lvgl_perf.flush_start_us = esp_timer_get_time();
+  portEXIT_CRITICAL(&lvgl_perf_spinlock);
+  
+  const int width = offsetx2 - offsetx1 + 1;
+  const int height = offsety2 - offsety1 + 1;
+  
+  // 屏幕镜像：在倒序行之前捕获（回调只做压缩拷贝，不等待）
+  FlushCaptureCallback capture = lvgl_capture.callback;
+  if (capture) {
+    if (drv->direct_mode) {
+      capture(area, color_map + offsety1 * drv->hor_res + offsetx1, drv->hor_res,
+              drv->rotated, lv_disp_flush_is_last(drv), lvgl_capture.userdata);
+    } else {
+      capture(area, color_map, width, drv->rotated, lv_disp_flush_is_last(drv), lvgl_capture.userdata);
+    }
+  }
+  
+  // 硬件180度旋转：水平方向由MADCTL镜像完成，垂直方向按倒序发送行
+  const bool flip = lvgl_rot.hw_flip_180;
+  const int phys_y1 = flip ? (LCD_V_RES - 1 - offsety2) : offsety1;
+  
+  if (!lvgl_buf.bounce_mode) {
+    if (flip) {
+      // 就地倒序各行（部分刷新模式下缓冲区内容刷新后即丢弃，可以直接改写）
+      for (int top = 0, bottom = height - 1; top < bottom; top++, bottom--) {
+        lv_color_t *row_top = color_map + top * width;
+        lv_color_t *row_bottom = color_map + bottom * width;
+        memcpy(lvgl_rot.row_tmp, row_top, width * sizeof(lv_color_t));
+        memcpy(row_top, row_bottom, width * sizeof(lv_color_t));
+        memcpy(row_bottom, lvgl_rot.row_tmp, width * sizeof(lv_color_t));
+      }
+    }
+    // 缓冲区位于内部DMA内存：直接将颜色缓冲区内容复制到LCD屏幕的指定区域
+    panel_io_lock();
+    esp_lcd_panel_draw_bitmap(panel_handle, offsetx1, phys_y1, offsetx2 + 1, phys_y1 + height, color_map);
+    panel_io_unlock();
+    return;
+  }
+  
+  // 缓冲区位于PSRAM：分块拷贝到内部DMA弹跳缓冲区后发送，两个弹跳缓冲区交替使用，
+  // 拷贝下一块的同时上一块正在传输
+  const lv_color_t *src = color_map;
+  int stride = width;
+  if (drv->direct_mode) {
+    // 直接模式下color_map指向整帧缓冲区，需要按屏幕宽度取行
+    stride = drv->hor_res;
+    src = color_map + offsety1 * stride + offsetx1;
+  }
+  
+  int chunk_lines = (LVGL_BOUNCE_BUF_PIXELS / width) & ~1;  // 保持偶数行，满足SH8601对齐要求
+  if (chunk_lines < 2) {
+    chunk_lines = 2;
+  }
+  
+  int slot = 0;
+  for (int y = 0; y < height; y += chunk_lines) {
+    const int lines = (height - y < chunk_lines) ? (height - y) : chunk_lines;
+    
+    // 等待一个空闲的弹跳缓冲区
+    xSemaphoreTake(lvgl_buf.bounce_sem, portMAX_DELAY);
+    
+    lv_color_t *dst = (lv_color_t *)lvgl_buf.bounce_buf[slot];
+    for (int row = 0; row < lines; row++) {
+      // 180度时物理第(y + row)行对应区域内倒数第(y + row)行
+      const int src_row = flip ? (height - 1 - (y + row)) : (y + row);
+      memcpy(dst + row * width, src + src_row * stride, width * sizeof(lv_color_t));
+    }
+    // 只在提交传输时持锁，等待弹跳缓冲区时不阻塞亮度命令
+    panel_io_lock();
+    esp_lcd_panel_draw_bitmap(panel_handle, offsetx1, phys_y1 + y, offsetx2 + 1, phys_y1 + y + lines, dst);
+    panel_io_unlock();
+    slot ^= 1;
+  }
+  
+  // 等待所有分块传输完成后再通知LVGL，避免缓冲区被提前改写
+  xSemaphoreTake(lvgl_buf.bounce_sem, portMAX_DELAY);
+  xSemaphoreTake(lvgl_buf.bounce_sem, portMAX_DELAY);
+  xSemaphoreGive(lvgl_buf.bounce_sem);
+  xSemaphoreGive(lvgl_buf.bounce_sem);
+  
+  portENTER_CRITICAL(&lvgl_perf_spinlock);
+  lvgl_perf_flush_done();
+  portEXIT_CRITICAL(&lvgl_perf_spinlock);
+  
+  lv_disp_flush_ready(drv);
 }
 
 /**
@@ -152,10 +503,10 @@ static void lvgl_flush_cb(lv_disp_drv_t *drv, const lv_area_t *area, lv_color_t
  * @param area 要调整的区域
  */
 void lvgl_rounder_cb(struct _lv_disp_drv_t *disp_drv, lv_area_t *area) {
-  uint16_t x1 = area->x1;
-  uint16_t x2 = area->x2;
-  uint16_t y1 = area->y1;
-  uint16_t y2 = area->y2;
+  lv_coord_t x1 = area->x1;
+  lv_coord_t x2 = area->x2;
+  lv_coord_t y1 = area->y1;
+  lv_coord_t y2 = area->y2;
 
   // 将起始坐标向下舍入到最近的偶数
   area->x1 = (x1 >> 1) << 1;
@@ -165,17 +516,147 @@ void lvgl_rounder_cb(struct _lv_disp_drv_t *disp_drv, lv_area_t *area) {
   area->y2 = ((y2 >> 1) << 1) + 1;
 }
 
+/**
+ * @brief 无效区域合并配置（代价模型参数）
+ */
+static struct {
+  bool enabled;           // 是否启用合并
+  uint32_t txn_cost_px;   // 每次刷新事务的固定开销（折算为像素数）
+} lvgl_merge_config = { LVGL_AREA_MERGE_ENABLED != 0, LVGL_AREA_MERGE_TXN_COST_PX };
+
+/**
+ * @brief 合并显示器的无效区域
+ * 
+ * 每个刷新区域都需要一次CASET/RASET/RAMWR命令往返，大量小标签更新会产生许多小区域。
+ * 代价模型：单独刷新的代价 = 区域像素数 + 事务开销，当两个区域的外接矩形像素数
+ * 不超过两者像素数之和加一次事务开销时，合并为外接矩形更便宜。
+ * 区域在失效时已经过rounder对齐，外接矩形保持偶数起点/奇数终点对齐。
+ * 合并结果通过inv_area_joined标记，LVGL自身的合并会跳过已合并的区域。
+ * 
+ * @param disp 显示器
+ * @return 被合并的区域数
+ */
+static uint32_t lvgl_merge_inv_areas(lv_disp_t *disp) {
+  const uint32_t txn_cost = lvgl_merge_config.txn_cost_px;
+  uint32_t merged = 0;
+  bool changed = true;
+  
+  // 合并会使区域变大，可能产生新的合并机会，重复直到没有变化
+  while (changed) {
+    changed = false;
+    for (uint16_t i = 0; i < disp->inv_p; i++) {
+      if (disp->inv_area_joined[i]) {
+        continue;
+      }
+      for (uint16_t j = i + 1; j < disp->inv_p; j++) {
+        if (disp->inv_area_joined[j]) {
+          continue;
+        }
+        
+        lv_area_t joined;
+        _lv_area_join(&joined, &disp->inv_areas[i], &disp->inv_areas[j]);
+        
+        uint32_t separate_px = lv_area_get_size(&disp->inv_areas[i]) + lv_area_get_size(&disp->inv_areas[j]);
+        if (lv_area_get_size(&joined) <= separate_px + txn_cost) {
+          lv_area_copy(&disp->inv_areas[i], &joined);
+          disp->inv_area_joined[j] = 1;
+          merged++;
+          changed = true;
+        }
+      }
+    }
+  }
+  
+  return merged;
+}
+
+// 渲染挂起标志（熄屏期间为true，由LVGLDriver::setRenderSuspended修改）
+static volatile bool lvgl_render_suspended = false;
+// 渲染恢复待处理标志（由LVGL任务在锁内恢复刷新定时器）
+static volatile bool lvgl_render_resume_pending = false;
+
+/**
+ * @brief 显示刷新定时器回调
+ * 
+ * 替换LVGL默认的刷新定时器回调，在渲染前先按代价模型合并无效区域，
+ * 然后交给LVGL完成渲染和刷新。
+ * 渲染挂起期间直接返回，无效区域保留在inv_areas中，恢复后一次性渲染。
+ * 
+ * @param timer 刷新定时器（user_data为显示器）
+ */
+static void lvgl_refr_timer_cb(lv_timer_t *timer) {
+  lv_disp_t *disp = (lv_disp_t *)timer->user_data;
+  
+  if (lvgl_render_suspended) {
+    // 暂停定时器；新的无效区域会由LVGL重新恢复定时器，这里再次暂停即可
+    lv_timer_pause(timer);
+    return;
+  }
+  
+  if (disp && lvgl_merge_config.enabled && disp->inv_p > 1) {
+    uint32_t merged = lvgl_merge_inv_areas(disp);
+    if (merged) {
+      portENTER_CRITICAL(&lvgl_perf_spinlock);
+      lvgl_perf.merged_areas += merged;
+      portEXIT_CRITICAL(&lvgl_perf_spinlock);
+    }
+  }
+  
+  _lv_disp_refr_timer(timer);
+}
+
 #if USE_TOUCH
+// 触摸输入设备（TP_INT中断到来时让其读取定时器立即就绪）
+static lv_indev_t *lvgl_touch_indev = NULL;
+// TP_INT中断标志（ISR置位，LVGL任务在锁内处理）
+static volatile bool lvgl_touch_irq = false;
+
+/**
+ * @brief TP_INT中断回调（在ISR中执行）
+ * 
+ * 唤醒正在等待的LVGL任务，使触摸在下一轮lv_timer_handler中立即读取，
+ * 而不必等到任务延迟或LVGL输入读取周期结束。
+ * 
+ * @param arg LVGL任务句柄
+ */
+static void IRAM_ATTR lvgl_touch_irq_cb(void *arg) {
+  BaseType_t higher_priority_woken = pdFALSE;
+  lvgl_touch_irq = true;
+  vTaskNotifyGiveFromISR((TaskHandle_t)arg, &higher_priority_woken);
+  if (higher_priority_woken) {
+    portYIELD_FROM_ISR();
+  }
+}
+
+/**
+ * @brief 把触摸坐标转换为屏幕逻辑坐标（与LVGL输入处理的软件旋转转换一致）
+ * 
+ * 90/270度软件旋转时LVGL在读取回调之后才转换坐标，手势识别需要提前按同样规则转换，
+ * 滑动方向才与用户看到的画面一致。
+ */
+static void lvgl_touch_to_logical(lv_indev_drv_t *drv, lv_point_t *point) {
+  lv_disp_drv_t *disp_drv = drv->disp->driver;
+  if (disp_drv->rotated == LV_DISP_ROT_180 || disp_drv->rotated == LV_DISP_ROT_270) {
+    point->x = disp_drv->hor_res - point->x - 1;
+    point->y = disp_drv->ver_res - point->y - 1;
+  }
+  if (disp_drv->rotated == LV_DISP_ROT_90 || disp_drv->rotated == LV_DISP_ROT_270) {
+    lv_coord_t tmp = point->y;
+    point->y = point->x;
+    point->x = disp_drv->ver_res - tmp - 1;
+  }
+}
+
 /**
- * @brief LVGL触摸输入回调函数（支持软件旋转）
+ * @brief LVGL触摸输入回调函数（支持硬件/软件旋转）
  * 
  * LVGL调用此函数读取触摸屏状态，包括触摸位置和按压状态。
- * 在软件旋转模式下，需要根据当前屏幕旋转角度来转换触摸坐标。
+ * 需要根据当前屏幕旋转方式来转换触摸坐标。
  * 
  * 触摸坐标转换步骤：
  * 1. 读取原始触摸坐标 (tp_x, tp_y)
  * 2. 执行坐标轴交换：swapped_x = tp_y, swapped_y = tp_x
- * 3. 根据屏幕旋转角度进行相应的坐标变换
+ * 3. 硬件180度旋转时镜像X/Y；90/270度软件旋转由LVGL自动转换
  * 
  * @param drv 输入设备驱动结构
  * @param data 触摸数据结构，用于返回触摸信息
@@ -192,21 +673,19 @@ static void lvgl_touch_cb(lv_indev_drv_t *drv, lv_indev_data_t *data) {
     lv_coord_t final_x, final_y;
     
 #if USE_GYROSCOPE
-    // 获取当前屏幕旋转角度
-    screen_rotation_t current_rotation = SCREEN_ROTATION_0;
-    if (lvglDriver && lvglDriver->isInitialized()) {
-      current_rotation = lvglDriver->getScreenRotation();
-    }
-    
     // 根据旋转角度转换触摸坐标
     // 首先进行坐标交换（触摸屏和显示屏坐标系匹配）
     uint16_t swapped_x = tp_y;
     uint16_t swapped_y = tp_x;
     
-    // 所有角度都使用相同的坐标交换，让LVGL软件旋转自动处理角度转换
-    // 因为启用了LVGL软件旋转（sw_rotate = 1），LVGL会自动处理角度转换
+    // 90/270度使用LVGL软件旋转，LVGL会自动转换输入坐标；
+    // 180度使用硬件旋转，LVGL不知道屏幕已翻转，需要在这里映射到逻辑坐标
     final_x = swapped_x;    // tp_y
     final_y = swapped_y;    // tp_x
+    if (lvgl_rot.hw_flip_180) {
+      final_x = LCD_H_RES - 1 - final_x;
+      final_y = LCD_V_RES - 1 - final_y;
+    }
 #else
     // 未启用陀螺仪时使用默认坐标转换（与0度旋转保持一致）
     final_x = tp_y;
@@ -217,6 +696,12 @@ static void lvgl_touch_cb(lv_indev_drv_t *drv, lv_indev_data_t *data) {
     data->point.y = final_y;
     data->state = LV_INDEV_STATE_PRESSED;  // 设置为按下状态
     
+    if (lvglDriver) {
+      lv_point_t logical = {final_x, final_y};
+      lvgl_touch_to_logical(drv, &logical);
+      lvglDriver->getGestureEngine().feed(true, logical.x, logical.y, lv_tick_get());
+    }
+    
     // 触发触摸活动回调（用于屏幕延时模式）
     if (lvglDriver && lvglDriver->isInitialized()) {
       lvglDriver->triggerTouchActivityCallback();
@@ -224,8 +709,8 @@ static void lvgl_touch_cb(lv_indev_drv_t *drv, lv_indev_data_t *data) {
     
     // 输出调试信息到串口
 #if USE_GYROSCOPE
-    //printf("触摸坐标 原始(%d,%d) -> 交换(%d,%d) -> 旋转后(%d,%d) [角度:%d]\n", 
-    //       tp_x, tp_y, swapped_x, swapped_y, final_x, final_y, current_rotation);
+    //printf("触摸坐标 原始(%d,%d) -> 交换(%d,%d) -> 旋转后(%d,%d) [硬件180:%d]\n", 
+    //       tp_x, tp_y, swapped_x, swapped_y, final_x, final_y, lvgl_rot.hw_flip_180);
 #else
     //printf("触摸坐标 原始(%d,%d) -> 交换后(%d,%d)\n", 
     //       tp_x, tp_y, final_x, final_y);
@@ -233,6 +718,10 @@ static void lvgl_touch_cb(lv_indev_drv_t *drv, lv_indev_data_t *data) {
   } else {
     // 无触摸事件
     data->state = LV_INDEV_STATE_RELEASED;  // 设置为释放状态
+    
+    if (lvglDriver) {
+      lvglDriver->getGestureEngine().feed(false, 0, 0, lv_tick_get());
+    }
   }
 }
 #endif
@@ -324,6 +813,8 @@ LVGLDriver::LVGLDriver()
     , m_tca9554_initialized(false)  // 初始化TCA9554状态标志
     , m_touchActivityCallback(nullptr)  // 初始化触摸活动回调
     , m_touchActivityUserdata(nullptr)  // 初始化触摸活动用户数据
+    , m_perfOverlayLabel(nullptr)
+    , m_perfOverlayTimer(nullptr)
 #if USE_GYROSCOPE
     , m_rotation_initialized(false)
     , m_current_rotation(SCREEN_ROTATION_0)
@@ -341,7 +832,7 @@ LVGLDriver::LVGLDriver()
     m_rotation_config.detection_interval_ms = 150;    // 150ms检测间隔（提高检测频率）
     m_rotation_config.auto_rotation_enabled = true;   // 默认启用自动旋转
     
-    printf("[LVGLDriver] 屏幕自动旋转配置已初始化（软件旋转模式）\n");
+    printf("[LVGLDriver] 屏幕自动旋转配置已初始化（0/180度硬件旋转，90/270度软件旋转）\n");
 #endif
 }
 
@@ -375,12 +866,14 @@ LVGLDriver::~LVGLDriver() {
 /**
  * @brief 初始化LVGL驱动系统
  */
-bool LVGLDriver::init() {
+bool LVGLDriver::init(PSRAMManager* psramManager) {
     if (m_initialized) {
         printf("[LVGLDriver] 警告：重复初始化\n");
         return true;
     }
     
+    lvgl_mem = psramManager;
+    
     printf("[LVGLDriver] 开始初始化LVGL驱动系统...\n");
     
     // === 1. 检查I2C总线管理器是否已初始化 ===
@@ -412,6 +905,12 @@ bool LVGLDriver::init() {
     // 不创建自己的互斥锁，使用全局的lvgl_mux
     m_mutex = nullptr;
     
+    // 从显示器就绪时开始统计
+    resetPerfStats();
+    
+    // 注册RLE压缩图片解码器（背景图由image_compressor.py压缩）
+    RLEImageDecoder::init(lvgl_img_cache_alloc, lvgl_buf_free);
+    
     m_initialized = true;
     printf("[LVGLDriver] LVGL驱动初始化完成\n");
     
@@ -424,6 +923,15 @@ bool LVGLDriver::init() {
     }
 #endif
     
+#if LVGL_PERF_OVERLAY_DEFAULT
+    setPerfOverlayEnabled(true);
+#endif
+    
+#if LVGL_BUFFER_BENCHMARK_ON_BOOT
+    // 基准测试模式：UI创建前测量各缓冲区策略
+    runBufferBenchmark(nullptr, 0);
+#endif
+    
     return true;
 }
 
@@ -461,6 +969,13 @@ bool LVGLDriver::start() {
         return false;
     }
     
+#if USE_TOUCH
+    // TP_INT中断直接唤醒LVGL任务
+    if (Touch_IsInterruptMode()) {
+        Touch_SetIrqCallback(lvgl_touch_irq_cb, m_taskHandle);
+    }
+#endif
+    
     printf("[LVGLDriver] LVGL任务已启动（核心%d，优先级%d）\n", LVGLDriver::TASK_CORE, LVGLDriver::TASK_PRIORITY);
     return true;
 }
@@ -475,6 +990,10 @@ void LVGLDriver::stop() {
     
     m_running = false;
     
+#if USE_TOUCH
+    Touch_SetIrqCallback(NULL, NULL);
+#endif
+    
     // 等待任务结束
     if (m_taskHandle) {
         vTaskDelete(m_taskHandle);
@@ -508,11 +1027,43 @@ void LVGLDriver::lvglTask() {
         
         // 获取LVGL互斥锁确保线程安全
         if (lock(-1)) {
-            // 调用LVGL定时器处理函数
+            // 渲染恢复：挂起期间累积的无效区域在本轮lv_timer_handler中一次性渲染
+            if (lvgl_render_resume_pending && !lvgl_render_suspended) {
+                lvgl_render_resume_pending = false;
+                lv_timer_resume(m_display->refr_timer);
+                lv_timer_ready(m_display->refr_timer);
+            }
+            
+#if USE_TOUCH
+            // TP_INT中断唤醒：本轮立即读取触摸，不等输入读取周期
+            if (lvgl_touch_irq) {
+                lvgl_touch_irq = false;
+                if (lvgl_touch_indev) {
+                    lv_timer_ready(lvgl_touch_indev->driver->read_timer);
+                }
+            }
+#endif
+            
+            // 调用LVGL定时器处理函数并统计耗时
+            int64_t handler_start_us = esp_timer_get_time();
             task_delay_ms = lv_timer_handler();
+            uint32_t handler_us = (uint32_t)(esp_timer_get_time() - handler_start_us);
             // 释放互斥锁
             unlock();
             
+            portENTER_CRITICAL(&lvgl_perf_spinlock);
+            lvgl_perf.handler_count++;
+            lvgl_perf.handler_total_us += handler_us;
+            if (handler_us > lvgl_perf.handler_max_us) {
+                lvgl_perf.handler_max_us = handler_us;
+            }
+            if (lvgl_render_suspended) {
+                lvgl_perf.suspended_handler_us += handler_us;
+            }
+            portEXIT_CRITICAL(&lvgl_perf_spinlock);
+            
+            updatePerfWindow();
+            
             // 每10000次循环打印一次状态（降低输出频率）
             if (loop_count % 10000 == 0) {
                 printf("[LVGLDriver] LVGL任务运行正常，循环次数: %d\n", loop_count);
@@ -525,8 +1076,10 @@ void LVGLDriver::lvglTask() {
         }
         
 #if USE_GYROSCOPE
-        // 处理屏幕自动旋转
-        processScreenRotation();
+        // 处理屏幕自动旋转（熄屏期间无需检测方向，亮屏后再恢复）
+        if (!lvgl_render_suspended) {
+            processScreenRotation();
+        }
 #endif
         
         // 限制任务延迟时间在合理范围内
@@ -536,8 +1089,13 @@ void LVGLDriver::lvglTask() {
             task_delay_ms = LVGL_TASK_MIN_DELAY_MS;
         }
         
-        // 任务延迟
-        vTaskDelay(pdMS_TO_TICKS(task_delay_ms));
+        // 渲染挂起期间只需按触摸读取周期轮询
+        if (lvgl_render_suspended && task_delay_ms < LVGL_SUSPENDED_TASK_DELAY_MS) {
+            task_delay_ms = LVGL_SUSPENDED_TASK_DELAY_MS;
+        }
+        
+        // 任务延迟（TP_INT中断会提前唤醒）
+        ulTaskNotifyTake(pdTRUE, pdMS_TO_TICKS(task_delay_ms));
     }
     
     printf("[LVGLDriver] LVGL任务结束，总循环次数: %d\n", loop_count);
@@ -547,8 +1105,24 @@ void LVGLDriver::lvglTask() {
  * @brief 获取LVGL互斥锁
  */
 bool LVGLDriver::lock(int timeout_ms) {
-    // 使用全局的lvgl_lock函数
-    return lvgl_lock(timeout_ms);
+    // 使用全局的lvgl_lock函数，并统计锁等待时间
+    int64_t wait_start_us = esp_timer_get_time();
+    bool locked = lvgl_lock(timeout_ms);
+    uint32_t wait_us = (uint32_t)(esp_timer_get_time() - wait_start_us);
+    
+    portENTER_CRITICAL(&lvgl_perf_spinlock);
+    if (locked) {
+        lvgl_perf.lock_count++;
+        lvgl_perf.lock_wait_total_us += wait_us;
+        if (wait_us > lvgl_perf.lock_wait_max_us) {
+            lvgl_perf.lock_wait_max_us = wait_us;
+        }
+    } else {
+        lvgl_perf.lock_timeouts++;
+    }
+    portEXIT_CRITICAL(&lvgl_perf_spinlock);
+    
+    return locked;
 }
 
 /**
@@ -598,38 +1172,44 @@ void LVGLDriver::setBrightness(uint8_t brightness) {
         brightness = 100;
     }
     
-    m_brightness = brightness;
-    
     // SH8601 AMOLED显示屏通过QSPI命令控制背光亮度
     // 将0-100的百分比转换为0-255的硬件值
     uint8_t hw_brightness = (uint8_t)((brightness * 255) / 100);
     
-    // 使用专用的SH8601亮度控制函数
-    if (m_display) {
-        lv_disp_drv_t* drv = m_display->driver;
-        if (drv && drv->user_data) {
-            esp_lcd_panel_handle_t panel_handle = (esp_lcd_panel_handle_t)drv->user_data;
-            
-            if (panel_handle) {
-                // 调用SH8601专用的亮度控制函数
-                esp_err_t ret = esp_lcd_sh8601_set_brightness(panel_handle, hw_brightness);
-                
-                if (ret == ESP_OK) {
-                    printf("[LVGLDriver] 亮度设置成功：%d%%\n", m_brightness);
-                } else {
-                    printf("[LVGLDriver] 亮度设置失败，错误码：0x%x\n", ret);
-                }
-            } else {
-                printf("[LVGLDriver] Panel句柄无效\n");
-            }
-        } else {
-            printf("[LVGLDriver] 显示驱动无效\n");
-        }
+    bool ok = setBacklightLevel(hw_brightness);
+    
+    // 保留百分比原值（硬件值反算会有取整误差）
+    m_brightness = brightness;
+    
+    if (ok) {
+        printf("[LVGLDriver] 亮度设置成功：%d%%\n", m_brightness);
     } else {
-        printf("[LVGLDriver] 显示器未初始化\n");
+        printf("[LVGLDriver] 亮度设置失败：%d%%\n", m_brightness);
     }
 }
 
+/**
+ * @brief 直接设置硬件背光亮度
+ */
+bool LVGLDriver::setBacklightLevel(uint8_t level) {
+    if (!m_display || !m_display->driver || !m_display->driver->user_data) {
+        return false;
+    }
+    
+    // 使用SH8601专用的亮度控制函数（0x51命令）
+    // 由背光渐变的发送任务调用，不持有LVGL锁，与刷新回调通过面板IO锁串行
+    esp_lcd_panel_handle_t panel_handle = (esp_lcd_panel_handle_t)m_display->driver->user_data;
+    panel_io_lock();
+    esp_err_t ret = esp_lcd_sh8601_set_brightness(panel_handle, level);
+    panel_io_unlock();
+    if (ret != ESP_OK) {
+        return false;
+    }
+    
+    m_brightness = (uint8_t)((level * 100 + 127) / 255);
+    return true;
+}
+
 /**
  * @brief 获取当前显示屏亮度
  */
@@ -637,6 +1217,482 @@ uint8_t LVGLDriver::getBrightness() const {
     return m_brightness;
 }
 
+/**
+ * @brief 更新帧率统计窗口（由LVGL任务每轮调用）
+ */
+void LVGLDriver::updatePerfWindow() {
+    int64_t now_us = esp_timer_get_time();
+    
+    portENTER_CRITICAL(&lvgl_perf_spinlock);
+    int64_t window_us = now_us - lvgl_perf.window_start_us;
+    if (window_us >= PERF_WINDOW_MS * 1000) {
+        uint32_t frames = lvgl_perf.frames - lvgl_perf.window_frames;
+        uint32_t areas = lvgl_perf.areas - lvgl_perf.window_areas;
+        lvgl_perf.fps = frames * 1000000.0f / window_us;
+        lvgl_perf.areas_per_frame = frames ? (float)areas / frames : 0.0f;
+        lvgl_perf.window_start_us = now_us;
+        lvgl_perf.window_frames = lvgl_perf.frames;
+        lvgl_perf.window_areas = lvgl_perf.areas;
+    }
+    portEXIT_CRITICAL(&lvgl_perf_spinlock);
+}
+
+/**
+ * @brief 获取显示管线性能统计
+ */
+void LVGLDriver::getPerfStats(lvgl_perf_stats_t* stats) const {
+    if (!stats) {
+        return;
+    }
+    
+    portENTER_CRITICAL(&lvgl_perf_spinlock);
+    lvgl_perf_counters_t c = lvgl_perf;
+    portEXIT_CRITICAL(&lvgl_perf_spinlock);
+    
+    stats->frames = c.frames;
+    stats->areas = c.areas;
+    stats->merged_areas = c.merged_areas;
+    stats->pixels = c.pixels;
+    stats->bytes = c.bytes;
+    stats->fps = c.fps;
+    stats->areas_per_frame = c.areas_per_frame;
+    stats->flush_avg_us = c.areas ? (uint32_t)(c.flush_total_us / c.areas) : 0;
+    stats->flush_max_us = c.flush_max_us;
+    stats->handler_count = c.handler_count;
+    stats->handler_avg_us = c.handler_count ? (uint32_t)(c.handler_total_us / c.handler_count) : 0;
+    stats->handler_max_us = c.handler_max_us;
+    stats->lock_count = c.lock_count;
+    stats->lock_timeouts = c.lock_timeouts;
+    stats->lock_wait_avg_us = c.lock_count ? (uint32_t)(c.lock_wait_total_us / c.lock_count) : 0;
+    stats->lock_wait_max_us = c.lock_wait_max_us;
+    
+    // 亮屏/熄屏分别统计LVGL任务CPU占用，用于评估熄屏挂起节省的CPU时间
+    int64_t now_us = esp_timer_get_time();
+    uint64_t suspended_us = c.suspended_total_us;
+    if (c.suspend_start_us) {
+        suspended_us += now_us - c.suspend_start_us;
+    }
+    uint64_t elapsed_us = now_us > c.stats_start_us ? (uint64_t)(now_us - c.stats_start_us) : 0;
+    uint64_t active_us = elapsed_us > suspended_us ? elapsed_us - suspended_us : 0;
+    uint64_t active_handler_us = c.handler_total_us - c.suspended_handler_us;
+    
+    stats->render_suspended = lvgl_render_suspended;
+    stats->suspend_count = c.suspend_count;
+    stats->suspended_ms = (uint32_t)(suspended_us / 1000);
+    stats->active_load = active_us ? active_handler_us * 100.0f / active_us : 0.0f;
+    stats->suspended_load = suspended_us ? c.suspended_handler_us * 100.0f / suspended_us : 0.0f;
+}
+
+/**
+ * @brief 清零显示管线性能统计
+ */
+void LVGLDriver::resetPerfStats() {
+    int64_t now_us = esp_timer_get_time();
+    
+    portENTER_CRITICAL(&lvgl_perf_spinlock);
+    int64_t flush_start_us = lvgl_perf.flush_start_us;  // 保留进行中的刷新开始时间
+    lvgl_perf = {};
+    lvgl_perf.flush_start_us = flush_start_us;
+    lvgl_perf.window_start_us = now_us;
+    lvgl_perf.stats_start_us = now_us;
+    lvgl_perf.suspend_start_us = lvgl_render_suspended ? now_us : 0;  // 挂起中则从现在重新计时
+    portEXIT_CRITICAL(&lvgl_perf_spinlock);
+}
+
+/**
+ * @brief 挂起/恢复渲染
+ * 
+ * 不获取LVGL锁，调用方持有LVGL锁时也可安全调用；
+ * 刷新定时器的暂停由刷新回调自行完成，恢复由LVGL任务在锁内完成。
+ */
+void LVGLDriver::setRenderSuspended(bool suspended) {
+    if (!m_display || suspended == lvgl_render_suspended) {
+        return;
+    }
+    
+    int64_t now_us = esp_timer_get_time();
+    
+    portENTER_CRITICAL(&lvgl_perf_spinlock);
+    if (suspended) {
+        lvgl_perf.suspend_count++;
+        lvgl_perf.suspend_start_us = now_us;
+    } else if (lvgl_perf.suspend_start_us) {
+        lvgl_perf.suspended_total_us += now_us - lvgl_perf.suspend_start_us;
+        lvgl_perf.suspend_start_us = 0;
+    }
+    portEXIT_CRITICAL(&lvgl_perf_spinlock);
+    
+    if (!suspended) {
+        lvgl_render_resume_pending = true;
+    }
+    lvgl_render_suspended = suspended;
+    
+    printf("[LVGLDriver] 渲染已%s\n", suspended ? "挂起，仅保留触摸读取" : "恢复");
+}
+
+/**
+ * @brief 检查渲染是否处于挂起状态
+ */
+bool LVGLDriver::isRenderSuspended() const {
+    return lvgl_render_suspended;
+}
+
+/**
+ * @brief 性能叠加层定时刷新回调（在lv_timer_handler中执行，已持有LVGL锁）
+ */
+void LVGLDriver::perfOverlayTimerCb(lv_timer_t* timer) {
+    LVGLDriver* driver = static_cast<LVGLDriver*>(timer->user_data);
+    if (!driver || !driver->m_perfOverlayLabel) {
+        return;
+    }
+    
+    lvgl_perf_stats_t stats;
+    driver->getPerfStats(&stats);
+    lv_label_set_text_fmt(driver->m_perfOverlayLabel, "%d FPS %d.%d A/F\nflush %lu us\nlvgl %lu us",
+                          (int)(stats.fps + 0.5f),
+                          (int)stats.areas_per_frame, (int)(stats.areas_per_frame * 10) % 10,
+                          (unsigned long)stats.flush_avg_us, (unsigned long)stats.handler_avg_us);
+}
+
+/**
+ * @brief 显示/隐藏屏幕性能叠加层
+ */
+void LVGLDriver::setPerfOverlayEnabled(bool enabled) {
+    if (!m_display || enabled == isPerfOverlayEnabled()) {
+        return;
+    }
+    
+    if (!lock(1000)) {
+        printf("[LVGLDriver] 错误：获取LVGL锁失败，无法切换性能叠加层\n");
+        return;
+    }
+    
+    if (enabled) {
+        // 叠加层放在系统层，切换屏幕时保持显示
+        m_perfOverlayLabel = lv_label_create(lv_layer_sys());
+        lv_obj_set_style_bg_color(m_perfOverlayLabel, lv_color_black(), 0);
+        lv_obj_set_style_bg_opa(m_perfOverlayLabel, LV_OPA_60, 0);
+        lv_obj_set_style_text_color(m_perfOverlayLabel, lv_color_hex(0x00FF00), 0);
+        lv_obj_set_style_pad_all(m_perfOverlayLabel, 4, 0);
+        lv_obj_align(m_perfOverlayLabel, LV_ALIGN_TOP_LEFT, 4, 4);
+        lv_label_set_text(m_perfOverlayLabel, "-- FPS");
+        m_perfOverlayTimer = lv_timer_create(perfOverlayTimerCb, PERF_WINDOW_MS, this);
+    } else {
+        lv_timer_del(m_perfOverlayTimer);
+        lv_obj_del(m_perfOverlayLabel);
+        m_perfOverlayTimer = nullptr;
+        m_perfOverlayLabel = nullptr;
+    }
+    
+    unlock();
+    printf("[LVGLDriver] 性能叠加层 %s\n", enabled ? "已显示" : "已隐藏");
+}
+
+/**
+ * @brief 检查屏幕性能叠加层是否显示
+ */
+bool LVGLDriver::isPerfOverlayEnabled() const {
+    return m_perfOverlayLabel != nullptr;
+}
+
+/**
+ * @brief 配置无效区域合并
+ */
+void LVGLDriver::setAreaMergeConfig(bool enabled, uint32_t txn_cost_px) {
+    if (lock(1000)) {
+        lvgl_merge_config.enabled = enabled;
+        lvgl_merge_config.txn_cost_px = txn_cost_px;
+        unlock();
+        printf("[LVGLDriver] 无效区域合并 %s，事务开销 %u 像素\n", enabled ? "已启用" : "已禁用", txn_cost_px);
+    } else {
+        printf("[LVGLDriver] 错误：获取LVGL锁失败，无法配置区域合并\n");
+    }
+}
+
+/**
+ * @brief 检查无效区域合并是否启用
+ */
+bool LVGLDriver::isAreaMergeEnabled() const {
+    return lvgl_merge_config.enabled;
+}
+
+/**
+ * @brief 获取区域合并代价模型的事务开销
+ */
+uint32_t LVGLDriver::getAreaMergeTxnCost() const {
+    return lvgl_merge_config.txn_cost_px;
+}
+
+/**
+ * @brief 获取缓冲区策略名称
+ */
+const char* LVGLDriver::getBufferStrategyName(lvgl_buffer_strategy_t strategy) {
+    switch (strategy) {
+        case LVGL_BUF_INTERNAL_STRIPE:   return "内部DMA条带";
+        case LVGL_BUF_PSRAM_FULL_BOUNCE: return "PSRAM整帧+弹跳缓冲";
+        case LVGL_BUF_PSRAM_DIRECT:      return "PSRAM直接模式+弹跳缓冲";
+        default:                         return "未知策略";
+    }
+}
+
+/**
+ * @brief 运行时切换绘图缓冲区策略
+ */
+bool LVGLDriver::setBufferStrategy(lvgl_buffer_strategy_t strategy, uint16_t stripe_lines) {
+    if (!m_display) {
+        printf("[LVGLDriver] 错误：显示器未初始化，无法切换缓冲区策略\n");
+        return false;
+    }
+    
+    if (strategy >= LVGL_BUF_STRATEGY_COUNT) {
+        printf("[LVGLDriver] 错误：无效的缓冲区策略 %d\n", strategy);
+        return false;
+    }
+    
+    if (stripe_lines == 0) {
+        stripe_lines = LVGL_STRIPE_LINES_DEFAULT;
+    }
+    
+#if USE_GYROSCOPE
+    // LVGL软件旋转按刷新区域旋转，直接模式下缓冲区为整帧布局，两者不兼容；
+    // 0/180度由硬件完成，不受影响
+    if (strategy == LVGL_BUF_PSRAM_DIRECT &&
+        (m_current_rotation == SCREEN_ROTATION_90 || m_current_rotation == SCREEN_ROTATION_270)) {
+        printf("[LVGLDriver] 错误：直接模式不支持软件旋转，请先旋转到0或180度\n");
+        return false;
+    }
+#endif
+    
+    if (!lock(1000)) {
+        printf("[LVGLDriver] 错误：获取LVGL锁失败，无法切换缓冲区策略\n");
+        return false;
+    }
+    
+    lv_disp_drv_t* drv = m_display->driver;
+    
+    // 等待进行中的DMA刷新完成，之后缓冲区才能安全释放
+    while (drv->draw_buf->flushing) {
+        vTaskDelay(pdMS_TO_TICKS(1));
+    }
+    
+    lvgl_buffer_strategy_t old_strategy = lvgl_buf.strategy;
+    uint16_t old_lines = lvgl_buf.lines;
+    
+    // 先释放旧缓冲区再分配，内部RAM不足以同时容纳新旧两套缓冲区
+    lvgl_free_draw_buffers();
+    bool success = lvgl_alloc_draw_buffers(strategy, stripe_lines);
+    if (!success) {
+        printf("[LVGLDriver] 缓冲区策略切换失败，回退到原策略：%s\n", getBufferStrategyName(old_strategy));
+        if (!lvgl_alloc_draw_buffers(old_strategy, old_lines)) {
+            // 原策略也无法分配时，使用最小的内部条带保证显示可用
+            lvgl_alloc_draw_buffers(LVGL_BUF_INTERNAL_STRIPE, LCD_V_RES / 10);
+        }
+    }
+    
+    lvgl_apply_draw_buffers(drv);
+    lv_disp_drv_update(m_display, drv);
+    
+    unlock();
+    
+    if (success) {
+        printf("[LVGLDriver] 缓冲区策略已切换：%s（%d行）\n", getBufferStrategyName(lvgl_buf.strategy), lvgl_buf.lines);
+    }
+    return success;
+}
+
+/**
+ * @brief 获取当前绘图缓冲区策略
+ */
+lvgl_buffer_strategy_t LVGLDriver::getBufferStrategy() const {
+    return lvgl_buf.strategy;
+}
+
+/**
+ * @brief 获取当前缓冲区行数
+ */
+uint16_t LVGLDriver::getBufferLines() const {
+    return lvgl_buf.lines;
+}
+
+/**
+ * @brief 获取绘图缓冲区占用的内部RAM字节数
+ */
+size_t LVGLDriver::getBufferInternalBytes() const {
+    return lvgl_buf.internal_bytes;
+}
+
+/**
+ * @brief 获取绘图缓冲区占用的PSRAM字节数
+ */
+size_t LVGLDriver::getBufferPSRAMBytes() const {
+    return lvgl_buf.psram_bytes;
+}
+
+/**
+ * @brief 基准测试场景对象
+ */
+typedef struct {
+    lv_obj_t* screen;       // 基准测试屏幕
+    lv_obj_t* label;        // 局部更新数字
+    lv_obj_t* bar;          // 局部更新进度条
+    lv_obj_t* blocks[8];    // 移动色块
+} lvgl_benchmark_scene_t;
+
+/**
+ * @brief 基准测试策略列表（固定顺序，便于对比）
+ */
+static const struct {
+    lvgl_buffer_strategy_t strategy;
+    uint16_t lines;
+} lvgl_benchmark_configs[] = {
+    { LVGL_BUF_INTERNAL_STRIPE,   LCD_V_RES / 10 },
+    { LVGL_BUF_INTERNAL_STRIPE,   LCD_V_RES / 4 },
+    { LVGL_BUF_INTERNAL_STRIPE,   LCD_V_RES / 2 },
+    { LVGL_BUF_PSRAM_FULL_BOUNCE, LCD_V_RES },
+    { LVGL_BUF_PSRAM_DIRECT,      LCD_V_RES },
+};
+
+/**
+ * @brief 更新基准测试场景的一帧
+ * 
+ * 场景0：全屏背景色切换（整屏刷新）
+ * 场景1：数字和进度条更新（小区域刷新，与监控界面相近）
+ * 场景2：8个圆角色块移动（多个中等区域刷新）
+ */
+static void lvgl_benchmark_step(lvgl_benchmark_scene_t* scene, int scene_index, uint32_t frame) {
+    switch (scene_index) {
+        case 0:
+            lv_obj_set_style_bg_color(scene->screen, (frame & 1) ? lv_color_hex(0x203040) : lv_color_hex(0x402030), 0);
+            break;
+        case 1:
+            lv_label_set_text_fmt(scene->label, "%05u", (unsigned)(frame * 37));
+            lv_bar_set_value(scene->bar, frame % 100, LV_ANIM_OFF);
+            break;
+        case 2:
+            for (int i = 0; i < 8; i++) {
+                lv_coord_t x = (lv_coord_t)((frame * (4 + i) + i * 40) % (LCD_H_RES - 60));
+                lv_obj_set_pos(scene->blocks[i], x, 20 + i * 52);
+            }
+            break;
+        default:
+            break;
+    }
+}
+
+/**
+ * @brief 运行绘图缓冲区基准测试
+ */
+int LVGLDriver::runBufferBenchmark(lvgl_buffer_benchmark_result_t* results, int max_results) {
+    if (!m_display) {
+        printf("[LVGLDriver] 错误：显示器未初始化，无法运行基准测试\n");
+        return 0;
+    }
+    
+    printf("[LVGLDriver] 开始绘图缓冲区基准测试（每场景%u帧）...\n", BENCHMARK_FRAMES_PER_SCENE);
+    
+    lvgl_buffer_strategy_t original_strategy = lvgl_buf.strategy;
+    uint16_t original_lines = lvgl_buf.lines;
+    
+    // 创建基准测试场景
+    lvgl_benchmark_scene_t scene = {};
+    lv_obj_t* original_screen = nullptr;
+    if (!lock(1000)) {
+        printf("[LVGLDriver] 错误：获取LVGL锁失败，无法运行基准测试\n");
+        return 0;
+    }
+    original_screen = lv_scr_act();
+    scene.screen = lv_obj_create(NULL);
+    lv_obj_clear_flag(scene.screen, LV_OBJ_FLAG_SCROLLABLE);
+    scene.label = lv_label_create(scene.screen);
+    lv_obj_set_style_text_color(scene.label, lv_color_white(), 0);
+    lv_obj_align(scene.label, LV_ALIGN_CENTER, 0, -30);
+    scene.bar = lv_bar_create(scene.screen);
+    lv_obj_set_size(scene.bar, LCD_H_RES - 80, 16);
+    lv_obj_align(scene.bar, LV_ALIGN_CENTER, 0, 20);
+    for (int i = 0; i < 8; i++) {
+        scene.blocks[i] = lv_obj_create(scene.screen);
+        lv_obj_set_size(scene.blocks[i], 48, 40);
+        lv_obj_set_style_radius(scene.blocks[i], 8, 0);
+        lv_obj_set_style_border_width(scene.blocks[i], 0, 0);
+        lv_obj_set_style_bg_color(scene.blocks[i], lv_palette_main((lv_palette_t)(i % LV_PALETTE_LAST)), 0);
+    }
+    lv_scr_load(scene.screen);
+    lv_refr_now(m_display);
+    unlock();
+    
+    const int config_count = sizeof(lvgl_benchmark_configs) / sizeof(lvgl_benchmark_configs[0]);
+    int completed = 0;
+    
+    for (int c = 0; c < config_count; c++) {
+        lvgl_buffer_benchmark_result_t result = {};
+        result.strategy = lvgl_benchmark_configs[c].strategy;
+        result.stripe_lines = lvgl_benchmark_configs[c].lines;
+        
+        result.success = setBufferStrategy(result.strategy, result.stripe_lines);
+        if (result.success) {
+            result.stripe_lines = lvgl_buf.lines;
+            result.internal_buf_bytes = lvgl_buf.internal_bytes;
+            result.psram_buf_bytes = lvgl_buf.psram_bytes;
+            result.internal_free_bytes = heap_caps_get_free_size(MALLOC_CAP_INTERNAL);
+            
+            resetPerfStats();
+            int64_t elapsed_us = 0;
+            
+            for (int s = 0; s < 3; s++) {
+                // 每个场景单独加锁，场景之间让出锁给其他任务
+                if (!lock(1000)) {
+                    result.success = false;
+                    break;
+                }
+                int64_t start_us = esp_timer_get_time();
+                for (uint32_t f = 0; f < BENCHMARK_FRAMES_PER_SCENE; f++) {
+                    lvgl_benchmark_step(&scene, s, f);
+                    lv_refr_now(m_display);
+                }
+                // 等待最后一帧刷新完成
+                while (m_display->driver->draw_buf->flushing) {
+                    taskYIELD();
+                }
+                elapsed_us += esp_timer_get_time() - start_us;
+                result.frames += BENCHMARK_FRAMES_PER_SCENE;
+                unlock();
+                vTaskDelay(pdMS_TO_TICKS(10));
+            }
+            
+            result.flush_count = lvgl_perf.areas;
+            if (elapsed_us > 0 && result.frames > 0) {
+                result.fps = result.frames * 1000000.0f / elapsed_us;
+                result.avg_frame_ms = elapsed_us / 1000.0f / result.frames;
+            }
+            if (result.flush_count > 0) {
+                result.avg_flush_ms = lvgl_perf.flush_total_us / 1000.0f / result.flush_count;
+            }
+        }
+        
+        printf("[LVGLDriver] 基准测试 %-24s %3d行：%s fps=%.1f 帧耗时=%.2fms 刷新=%.2fms(%u次) 内部RAM=%uB PSRAM=%uB 内部剩余=%uB\n",
+               getBufferStrategyName(result.strategy), result.stripe_lines,
+               result.success ? "完成" : "失败", result.fps, result.avg_frame_ms,
+               result.avg_flush_ms, result.flush_count, result.internal_buf_bytes,
+               result.psram_buf_bytes, result.internal_free_bytes);
+        
+        if (results && completed < max_results) {
+            results[completed] = result;
+        }
+        completed++;
+    }
+    
+    // 恢复原策略和原屏幕
+    setBufferStrategy(original_strategy, original_lines);
+    if (lock(1000)) {
+        lv_scr_load(original_screen);
+        lv_obj_del(scene.screen);
+        unlock();
+    }
+    
+    printf("[LVGLDriver] 绘图缓冲区基准测试完成，已恢复策略：%s\n", getBufferStrategyName(lvgl_buf.strategy));
+    return completed;
+}
+
 #if USE_GYROSCOPE
 /**
  * @brief 初始化屏幕自动旋转功能（基于加速度计重力感应）
@@ -843,41 +1899,72 @@ screen_rotation_t LVGLDriver::determineOrientationFromAccel(const QMI8658_IMUDat
 }
 
 /**
- * @brief 执行屏幕旋转（纯软件旋转）
+ * @brief 执行屏幕旋转（硬件优先，软件回退）
  * 
- * 使用LVGL的软件旋转功能，不依赖硬件旋转。
- * 这种方式适用于所有LCD控制器，包括不支持硬件旋转的QMI8658。
+ * SH8601的MADCTL只支持X镜像，不支持Y镜像和XY交换：
+ * - 0/180度：LVGL按0度渲染，180度通过MADCTL X镜像 + 刷新时倒序发送行完成，
+ *   不需要CPU逐像素旋转，渲染速度与0度相同
+ * - 90/270度：控制器无法交换行列，回退到LVGL软件旋转（sw_rotate）
  */
 void LVGLDriver::performScreenRotation(screen_rotation_t rotation) {
     if (!m_display || rotation == m_current_rotation) {
         return;
     }
     
-    printf("[LVGLDriver] 执行软件屏幕旋转：%d -> %d\n", m_current_rotation, rotation);
+    const bool use_hw = (rotation == SCREEN_ROTATION_0 || rotation == SCREEN_ROTATION_180);
+    
+    if (lvgl_buf.strategy == LVGL_BUF_PSRAM_DIRECT && !use_hw) {
+        printf("[LVGLDriver] 警告：直接模式缓冲区不支持软件旋转，忽略90/270度旋转请求\n");
+        return;
+    }
+    
+    printf("[LVGLDriver] 执行%s屏幕旋转：%d -> %d\n", use_hw ? "硬件" : "软件", m_current_rotation, rotation);
     
     // 获取LVGL锁
     if (lock(1000)) {
-        // 转换为LVGL旋转枚举
+        // 转换为LVGL旋转枚举（硬件旋转时LVGL保持0度渲染）
         lv_disp_rot_t lv_rotation;
         switch (rotation) {
-            case SCREEN_ROTATION_0:
-                lv_rotation = LV_DISP_ROT_NONE;
-                break;
             case SCREEN_ROTATION_90:
                 lv_rotation = LV_DISP_ROT_90;
                 break;
-            case SCREEN_ROTATION_180:
-                lv_rotation = LV_DISP_ROT_180;
-                break;
             case SCREEN_ROTATION_270:
                 lv_rotation = LV_DISP_ROT_270;
                 break;
+            case SCREEN_ROTATION_0:
+            case SCREEN_ROTATION_180:
             default:
                 lv_rotation = LV_DISP_ROT_NONE;
                 break;
         }
         
-        // 使用LVGL纯软件旋转（不触发硬件旋转回调）
+        // 等待进行中的刷新完成，避免同一帧前后两部分使用不同的扫描方向
+        lv_disp_drv_t* drv = m_display->driver;
+        while (drv->draw_buf->flushing) {
+            vTaskDelay(pdMS_TO_TICKS(1));
+        }
+        
+        // 更新MADCTL X镜像和刷新时的行倒序
+        const bool flip = (rotation == SCREEN_ROTATION_180);
+        esp_lcd_panel_handle_t panel_handle = (esp_lcd_panel_handle_t)drv->user_data;
+        panel_io_lock();
+        esp_err_t ret = esp_lcd_panel_mirror(panel_handle, flip, false);
+        if (ret == ESP_OK) {
+            esp_lcd_panel_set_gap(panel_handle, flip ? LCD_MIRROR_X_GAP : 0, 0);
+        }
+        panel_io_unlock();
+        
+        if (ret == ESP_OK) {
+            lvgl_rot.hw_flip_180 = flip;
+        } else {
+            // MADCTL写入失败时180度回退到软件旋转
+            printf("[LVGLDriver] 警告：MADCTL镜像设置失败(0x%x)，回退到软件旋转\n", ret);
+            lvgl_rot.hw_flip_180 = false;
+            if (flip) {
+                lv_rotation = LV_DISP_ROT_180;
+            }
+        }
+        
         lv_disp_set_rotation(m_display, lv_rotation);
         
         // 更新当前旋转状态
@@ -885,11 +1972,14 @@ void LVGLDriver::performScreenRotation(screen_rotation_t rotation) {
         
         // 立即刷新整个显示屏以确保旋转效果立即生效
         lv_obj_invalidate(lv_scr_act());
+        lv_obj_invalidate(lv_layer_top());
+        lv_obj_invalidate(lv_layer_sys());
         lv_refr_now(m_display);
         
         unlock();
         
-        printf("[LVGLDriver] 软件屏幕旋转完成：角度 %d度\n", rotation * 90);
+        printf("[LVGLDriver] 屏幕旋转完成：角度 %d度（%s）\n", rotation * 90,
+               lvgl_rot.hw_flip_180 ? "MADCTL镜像+行倒序" : (lv_rotation == LV_DISP_ROT_NONE ? "无旋转" : "LVGL软件旋转"));
         printf("[LVGLDriver] 显示分辨率：%dx%d -> %dx%d\n", 
                (rotation % 2 == 0) ? LCD_H_RES : LCD_V_RES,
                (rotation % 2 == 0) ? LCD_V_RES : LCD_H_RES,
@@ -978,6 +2068,8 @@ lv_disp_t* LVGL_Init(void) {
   
   printf("[ESP_LCD_LVGL] 安装SH8601面板驱动\n");
   ESP_ERROR_CHECK(esp_lcd_new_panel_sh8601(io_handle, &panel_config, &panel_handle));
+  lvgl_panel_io_mux = xSemaphoreCreateMutex();  // 刷新回调和背光等命令共用面板IO，需要串行
+  assert(lvgl_panel_io_mux);
   ESP_ERROR_CHECK(esp_lcd_panel_reset(panel_handle));       // 复位面板
   ESP_ERROR_CHECK(esp_lcd_panel_init(panel_handle));        // 初始化面板
   ESP_ERROR_CHECK(esp_lcd_panel_disp_on_off(panel_handle, true)); // 开启显示
@@ -992,34 +2084,31 @@ lv_disp_t* LVGL_Init(void) {
   printf("[ESP_LCD_LVGL] 初始化LVGL图形库\n");
   lv_init();
   
-  // 分配LVGL使用的绘图缓冲区（建议至少为屏幕大小的1/10）
-  lv_color_t *buf1 = (lv_color_t *)heap_caps_malloc(
-    LCD_H_RES * LVGL_BUF_HEIGHT * sizeof(lv_color_t), 
-    MALLOC_CAP_DMA  // DMA兼容内存
-  );
-  assert(buf1);
-  
-  lv_color_t *buf2 = (lv_color_t *)heap_caps_malloc(
-    LCD_H_RES * LVGL_BUF_HEIGHT * sizeof(lv_color_t), 
-    MALLOC_CAP_DMA  // DMA兼容内存
-  );
-  assert(buf2);
+  // 按编译期默认策略分配LVGL绘图缓冲区，失败时回退到内部DMA条带缓冲区
+  if (!lvgl_alloc_draw_buffers(LVGL_BUFFER_STRATEGY_DEFAULT, LVGL_STRIPE_LINES_DEFAULT)) {
+    bool fallback_ok = lvgl_alloc_draw_buffers(LVGL_BUF_INTERNAL_STRIPE, LVGL_STRIPE_LINES_DEFAULT);
+    assert(fallback_ok);
+  }
   
   // 初始化LVGL双缓冲区
-  lv_disp_draw_buf_init(&disp_buf, buf1, buf2, LCD_H_RES * LVGL_BUF_HEIGHT);
+  lv_disp_draw_buf_init(&disp_buf, lvgl_buf.buf1, lvgl_buf.buf2, lvgl_buf.buf_pixels);
 
   // === 10. 注册LVGL显示驱动 ===
-  printf("[ESP_LCD_LVGL] 向LVGL注册显示驱动（启用软件旋转）\n");
+  printf("[ESP_LCD_LVGL] 向LVGL注册显示驱动（90/270度启用软件旋转）\n");
   lv_disp_drv_init(&disp_drv);
   disp_drv.hor_res = LCD_H_RES;                 // 水平分辨率
   disp_drv.ver_res = LCD_V_RES;                 // 垂直分辨率
   disp_drv.flush_cb = lvgl_flush_cb;            // 刷新回调函数
   disp_drv.rounder_cb = lvgl_rounder_cb;        // 区域舍入回调
-  disp_drv.sw_rotate = 1;                       // 启用LVGL软件旋转功能
+  disp_drv.sw_rotate = 1;                       // 90/270度使用LVGL软件旋转（0/180度由硬件完成）
   disp_drv.rotated = LV_DISP_ROT_NONE;          // 设置默认旋转角度为0度
   disp_drv.draw_buf = &disp_buf;                        // 绘图缓冲区
+  disp_drv.direct_mode = (lvgl_buf.strategy == LVGL_BUF_PSRAM_DIRECT) ? 1 : 0; // 直接模式
   disp_drv.user_data = panel_handle;                    // 用户数据（面板句柄）
   lv_disp_t *disp = lv_disp_drv_register(&disp_drv);   // 注册显示驱动
+  
+  // 接管刷新定时器，渲染前合并无效区域
+  lv_timer_set_cb(disp->refr_timer, lvgl_refr_timer_cb);
 
   // === 11. 安装LVGL时钟定时器 ===
   printf("[ESP_LCD_LVGL] 安装LVGL时钟定时器\n");
@@ -1039,7 +2128,7 @@ lv_disp_t* LVGL_Init(void) {
   indev_drv.type = LV_INDEV_TYPE_POINTER;     // 设备类型：指针设备
   indev_drv.disp = disp;                      // 关联的显示设备
   indev_drv.read_cb = lvgl_touch_cb;  // 触摸读取回调函数
-  lv_indev_drv_register(&indev_drv);          // 注册输入设备驱动
+  lvgl_touch_indev = lv_indev_drv_register(&indev_drv);  // 注册输入设备驱动
 #endif
 
   // === 13. 创建LVGL任务和同步机制 ===
@@ -1216,3 +2305,14 @@ void LVGLDriver::triggerTouchActivityCallback() {
     }
 }
 
+/**
+ * @brief 设置刷新捕获回调
+ */
+void LVGLDriver::setFlushCaptureCallback(FlushCaptureCallback callback, void* userdata) {
+    // 先清除回调再更新用户数据，刷新回调不会拿到不匹配的组合
+    lvgl_capture.callback = nullptr;
+    lvgl_capture.userdata = userdata;
+    lvgl_capture.callback = callback;
+    printf("[LVGLDriver] 刷新捕获回调已%s\n", callback ? "设置" : "清除");
+}
+
@@ -14,7 +14,7 @@
  * - 接口类型：QSPI (4线SPI)
  * - 触摸接口：I2C (与陀螺仪共用)
  * - 陀螺仪接口：I2C (QMI8658)
- * - 缓冲区：双缓冲机制，提高刷新效率
+ * - 缓冲区：双缓冲机制，支持内部DMA条带/PSRAM整帧/直接模式多种策略
  */
 
 #ifndef LVGL_DRIVER_H
@@ -26,13 +26,20 @@
 #include "lvgl.h"
 #include "I2CBusManager.h"    // 使用统一的I2C总线管理器
 #include "tca9554_bsp.h"      // TCA9554 BSP接口
+#include "GestureEngine.h"    // 触摸手势识别
 
 // 前向声明
 class DisplayManager;
+class PSRAMManager;
 
 // 触摸活动回调函数类型
 typedef void (*TouchActivityCallback)(void* userdata);
 
+// 刷新捕获回调函数类型（在LVGL刷新回调中调用，不能阻塞）
+// pixels指向区域左上角像素，stride为每行像素数，rotation为LVGL软件旋转角度（lv_disp_rot_t）
+typedef void (*FlushCaptureCallback)(const lv_area_t* area, const lv_color_t* pixels, int stride,
+                                     uint8_t rotation, bool last, void* userdata);
+
 // === TCA9554控制引脚定义 ===
 #define TCA9554_LCD_RESET_PIN     0    // TCA9554 GPIO0 - LCD复位引脚
 #define TCA9554_POWER_RESET_PIN   1    // TCA9554 GPIO1 - 电源复位引脚
@@ -48,6 +55,76 @@ typedef void (*TouchActivityCallback)(void* userdata);
 #include "qmi8658_bsp.h"
 #endif
 
+/**
+ * @brief LVGL绘图缓冲区策略
+ */
+typedef enum {
+    LVGL_BUF_INTERNAL_STRIPE = 0,   ///< 内部DMA条带双缓冲（条带行数可配置）
+    LVGL_BUF_PSRAM_FULL_BOUNCE = 1, ///< PSRAM整帧双缓冲，经内部DMA弹跳缓冲区刷新
+    LVGL_BUF_PSRAM_DIRECT = 2,      ///< PSRAM整帧直接模式（direct mode），经内部DMA弹跳缓冲区刷新
+    LVGL_BUF_STRATEGY_COUNT
+} lvgl_buffer_strategy_t;
+
+// 绘图缓冲区编译期配置
+#define LVGL_BUFFER_STRATEGY_DEFAULT  LVGL_BUF_INTERNAL_STRIPE  // 默认缓冲区策略
+#define LVGL_STRIPE_LINES_DEFAULT     (448 / 4)                 // 默认条带行数（屏幕高度的1/4）
+#define LVGL_BOUNCE_BUF_LINES         24                        // 弹跳缓冲区行数（必须为偶数）
+#define LVGL_BUFFER_BENCHMARK_ON_BOOT 0  // 1：初始化完成后运行缓冲区基准测试，0：不运行
+
+/**
+ * @brief 缓冲区基准测试单项结果
+ */
+typedef struct {
+    lvgl_buffer_strategy_t strategy;   ///< 缓冲区策略
+    uint16_t stripe_lines;             ///< 条带行数（整帧策略为屏幕高度）
+    bool success;                      ///< 该策略是否成功应用并完成测试
+    uint32_t frames;                   ///< 渲染帧数
+    float fps;                         ///< 平均帧率
+    float avg_frame_ms;                ///< 平均每帧耗时（毫秒）
+    float avg_flush_ms;                ///< 平均每次刷新耗时（毫秒）
+    uint32_t flush_count;              ///< 刷新次数
+    size_t internal_buf_bytes;         ///< 缓冲区占用的内部RAM
+    size_t psram_buf_bytes;            ///< 缓冲区占用的PSRAM
+    size_t internal_free_bytes;        ///< 应用策略后的内部RAM剩余
+} lvgl_buffer_benchmark_result_t;
+
+// 无效区域合并配置
+#define LVGL_AREA_MERGE_ENABLED     1    // 1：渲染前按代价模型合并无效区域，0：仅使用LVGL默认合并
+#define LVGL_AREA_MERGE_TXN_COST_PX 512  // 每次刷新事务（CASET/RASET/RAMWR）开销折算的像素数
+
+// 性能统计配置
+#define LVGL_PERF_OVERLAY_DEFAULT 0  // 1：启动时显示屏幕性能叠加层，0：默认隐藏
+
+// 渲染挂起配置（熄屏时停止渲染和刷新，仅保留触摸读取）
+#define LVGL_SUSPENDED_TASK_DELAY_MS 30  // 挂起期间LVGL任务轮询间隔，与LVGL触摸读取周期一致
+
+/**
+ * @brief 显示管线性能统计快照
+ */
+typedef struct {
+    uint32_t frames;            ///< 完成的帧数
+    uint32_t areas;             ///< 刷新区域数
+    uint32_t merged_areas;      ///< 被合并的无效区域数
+    uint64_t pixels;            ///< 推送的像素数
+    uint64_t bytes;             ///< 通过QSPI推送的字节数
+    float fps;                  ///< 最近统计窗口帧率
+    float areas_per_frame;      ///< 最近统计窗口平均每帧刷新区域数
+    uint32_t flush_avg_us;      ///< 平均刷新耗时（flush_cb到刷新完成）
+    uint32_t flush_max_us;      ///< 最大刷新耗时
+    uint32_t handler_count;     ///< lv_timer_handler调用次数
+    uint32_t handler_avg_us;    ///< lv_timer_handler平均耗时
+    uint32_t handler_max_us;    ///< lv_timer_handler最大耗时
+    uint32_t lock_count;        ///< 成功加锁次数
+    uint32_t lock_timeouts;     ///< 加锁超时次数
+    uint32_t lock_wait_avg_us;  ///< 平均锁等待时间
+    uint32_t lock_wait_max_us;  ///< 最大锁等待时间
+    bool render_suspended;      ///< 当前是否处于渲染挂起（熄屏）状态
+    uint32_t suspend_count;     ///< 进入渲染挂起的次数
+    uint32_t suspended_ms;      ///< 累计渲染挂起时间
+    float active_load;          ///< 亮屏期间LVGL任务CPU占用（lv_timer_handler耗时占比，%）
+    float suspended_load;       ///< 熄屏期间LVGL任务CPU占用（%）
+} lvgl_perf_stats_t;
+
 /**
  * @brief 屏幕旋转角度枚举
  */
@@ -103,9 +180,10 @@ public:
      * - 显示缓冲区配置
      * - 输入设备注册
      * 
+     * @param psramManager PSRAM管理器（可选），提供时绘图缓冲区和弹跳缓冲区经其按能力分配并计入统计
      * @return true 初始化成功，false 初始化失败
      */
-    bool init();
+    bool init(PSRAMManager* psramManager = nullptr);
     
     /**
      * @brief 启动LVGL处理任务
@@ -180,6 +258,14 @@ public:
      */
     void setBrightness(uint8_t brightness);
     
+    /**
+     * @brief 直接设置硬件背光亮度（不输出日志，供背光渐变高频调用）
+     * 
+     * @param level 硬件亮度（0-255）
+     * @return true 设置成功，false 失败
+     */
+    bool setBacklightLevel(uint8_t level);
+    
     /**
      * @brief 获取当前显示屏亮度
      * 
@@ -231,6 +317,130 @@ public:
      * 该函数会在触摸事件发生时被调用
      */
     void triggerTouchActivityCallback();
+    
+    /**
+     * @brief 获取触摸手势识别引擎
+     * 
+     * 触摸读取回调把每次采样（逻辑坐标）送入引擎，识别出的手势通过引擎回调发出
+     */
+    GestureEngine& getGestureEngine() { return m_gestureEngine; }
+
+    /**
+     * @brief 设置刷新捕获回调（屏幕镜像）
+     * 
+     * 每个刷新区域在发送到屏幕前调用一次，像素为LVGL渲染结果（硬件180度旋转前）
+     * 
+     * @param callback 捕获回调，nullptr表示清除
+     * @param userdata 用户数据指针
+     */
+    void setFlushCaptureCallback(FlushCaptureCallback callback, void* userdata);
+
+    /**
+     * @brief 运行时切换绘图缓冲区策略
+     *
+     * 等待进行中的刷新完成后释放旧缓冲区并按新策略重新分配，
+     * 分配失败时回退到原策略。直接模式不支持软件旋转，仅在0/180度（硬件旋转）时可用。
+     *
+     * @param strategy 缓冲区策略
+     * @param stripe_lines 条带行数（仅内部条带模式有效，0表示使用默认值）
+     * @return true 切换成功，false 切换失败（已回退）
+     */
+    bool setBufferStrategy(lvgl_buffer_strategy_t strategy, uint16_t stripe_lines = 0);
+
+    /**
+     * @brief 获取当前绘图缓冲区策略
+     */
+    lvgl_buffer_strategy_t getBufferStrategy() const;
+
+    /**
+     * @brief 获取当前缓冲区行数
+     */
+    uint16_t getBufferLines() const;
+
+    /**
+     * @brief 获取绘图缓冲区占用的内部RAM和PSRAM字节数
+     */
+    size_t getBufferInternalBytes() const;
+    size_t getBufferPSRAMBytes() const;
+
+    /**
+     * @brief 获取缓冲区策略名称
+     */
+    static const char* getBufferStrategyName(lvgl_buffer_strategy_t strategy);
+
+    /**
+     * @brief 运行绘图缓冲区基准测试
+     *
+     * 依次应用各缓冲区策略，渲染固定场景集（全屏填充、局部数字更新、移动色块），
+     * 统计帧率、刷新耗时和内部RAM占用，测试结束后恢复原策略和原屏幕。
+     *
+     * @param results 结果数组（可为nullptr，仅打印结果）
+     * @param max_results 结果数组容量
+     * @return 完成测试的策略数量
+     */
+    int runBufferBenchmark(lvgl_buffer_benchmark_result_t* results, int max_results);
+
+    /**
+     * @brief 配置无效区域合并
+     * 
+     * 两个无效区域的外接矩形像素数不超过两者之和加一次事务开销时合并刷新
+     * 
+     * @param enabled 是否启用合并
+     * @param txn_cost_px 每次刷新事务开销折算的像素数，越大越倾向合并
+     */
+    void setAreaMergeConfig(bool enabled, uint32_t txn_cost_px = LVGL_AREA_MERGE_TXN_COST_PX);
+
+    /**
+     * @brief 检查无效区域合并是否启用
+     */
+    bool isAreaMergeEnabled() const;
+
+    /**
+     * @brief 获取区域合并代价模型的事务开销（像素）
+     */
+    uint32_t getAreaMergeTxnCost() const;
+
+    /**
+     * @brief 获取显示管线性能统计
+     * 
+     * 包括帧数、刷新区域/像素/字节数、刷新延迟、lv_timer_handler耗时和锁等待时间
+     * 
+     * @param stats 输出统计快照
+     */
+    void getPerfStats(lvgl_perf_stats_t* stats) const;
+
+    /**
+     * @brief 清零显示管线性能统计
+     */
+    void resetPerfStats();
+
+    /**
+     * @brief 显示/隐藏屏幕性能叠加层（左上角FPS等信息）
+     * 
+     * @param enabled true 显示，false 隐藏
+     */
+    void setPerfOverlayEnabled(bool enabled);
+
+    /**
+     * @brief 检查屏幕性能叠加层是否显示
+     */
+    bool isPerfOverlayEnabled() const;
+
+    /**
+     * @brief 挂起/恢复渲染
+     * 
+     * 挂起时暂停显示刷新定时器，不再渲染和推送帧，触摸读取照常进行以便唤醒；
+     * 恢复后挂起期间累积的无效区域在下一轮lv_timer_handler中一次性渲染。
+     * 不获取LVGL锁，可在持有LVGL锁时调用
+     * 
+     * @param suspended true 挂起，false 恢复
+     */
+    void setRenderSuspended(bool suspended);
+
+    /**
+     * @brief 检查渲染是否处于挂起状态
+     */
+    bool isRenderSuspended() const;
 
 #if USE_GYROSCOPE
     /**
@@ -300,6 +510,16 @@ private:
      */
     void lvglTask();
 
+    /**
+     * @brief 更新帧率统计窗口
+     */
+    void updatePerfWindow();
+
+    /**
+     * @brief 性能叠加层定时刷新回调
+     */
+    static void perfOverlayTimerCb(lv_timer_t* timer);
+
 #if USE_GYROSCOPE
     /**
      * @brief 屏幕自动旋转处理函数
@@ -338,6 +558,11 @@ private:
     // 触摸活动回调相关
     TouchActivityCallback m_touchActivityCallback;  ///< 触摸活动回调函数
     void* m_touchActivityUserdata;                  ///< 触摸活动回调用户数据
+    GestureEngine m_gestureEngine;                  ///< 触摸手势识别引擎
+    
+    // 性能叠加层相关
+    lv_obj_t* m_perfOverlayLabel;     ///< 性能叠加层标签
+    lv_timer_t* m_perfOverlayTimer;   ///< 性能叠加层刷新定时器
     
 #if USE_GYROSCOPE
     // 屏幕自动旋转相关成员变量
@@ -353,6 +578,8 @@ private:
     static const uint32_t TASK_STACK_SIZE = 4 * 1024;  ///< 任务栈大小
     static const UBaseType_t TASK_PRIORITY = 2;         ///< 任务优先级
     static const uint32_t TASK_CORE = 1;                ///< 任务运行核心
+    static const uint32_t BENCHMARK_FRAMES_PER_SCENE = 60;  ///< 基准测试每个场景的渲染帧数
+    static const uint32_t PERF_WINDOW_MS = 1000;            ///< 帧率统计窗口（毫秒）
 };
 
 // 全局LVGL驱动实例声明
@@ -445,6 +445,10 @@ void LocationManager::locationTask(void* parameter) {
     manager->locationLoop();
     
     printf("🌍 定位任务结束\n");
+    // 归还临时内存区槽位，重新创建任务时不会占用新的槽位
+    if (manager->_psramManager) {
+        manager->_psramManager->releaseTaskArena(xTaskGetCurrentTaskHandle());
+    }
     vTaskDelete(NULL);
 }
 
@@ -560,9 +564,10 @@ bool LocationManager::makeHttpRequest(const String& url, String& response) {
     bool usePSRAM = (contentLength > LARGE_RESPONSE_THRESHOLD || contentLength == -1);
     
     if (usePSRAM && _psramManager && _psramManager->isPSRAMAvailable()) {
-        // 使用PSRAM分配响应缓冲区
+        // 使用当前任务的PSRAM临时内存区作为响应缓冲区，离开作用域时回收
         size_t bufferSize = (contentLength > 0) ? contentLength + 256 : 4096;
-        char* responseBuffer = (char*)_psramManager->allocateDataBuffer(bufferSize, "HTTP响应缓冲区");
+        PSRAMArenaScope arena(_psramManager);
+        char* responseBuffer = (char*)arena.alloc(bufferSize);
         
         if (responseBuffer) {
             trackMemoryAllocation(bufferSize, true);
@@ -603,8 +608,6 @@ bool LocationManager::makeHttpRequest(const String& url, String& response) {
                 response = "";
             }
             
-            // 释放PSRAM缓冲区
-            _psramManager->deallocate(responseBuffer);
             trackMemoryDeallocation(bufferSize, true);
         } else {
             printf("[LocationManager] PSRAM分配失败，使用标准方法\n");
@@ -640,90 +643,41 @@ bool LocationManager::parseLocationResponse(const String& response) {
     
     printf("[LocationManager] 开始解析定位响应，长度: %d\n", response.length());
     
-    // 使用PSRAM分配JSON解析缓冲区
+    // JSON文档从当前任务的临时内存区分配，函数返回时整体回收
     const size_t capacity = JSON_OBJECT_SIZE(20) + JSON_ARRAY_SIZE(5) + 1024;
-    DynamicJsonDocument* doc = nullptr;
-    void* docBuffer = nullptr;
-    bool usedPSRAMForJSON = false;
-    
-    if (_psramManager && _psramManager->isPSRAMAvailable()) {
-        // 使用PSRAM分配JSON文档
-        docBuffer = _psramManager->allocateDataBuffer(capacity, "JSON解析缓冲区");
-        if (docBuffer) {
-            doc = new(docBuffer) DynamicJsonDocument(capacity);
-            usedPSRAMForJSON = true;
-            trackMemoryAllocation(capacity, true);
-            _statistics.jsonBufferSize = capacity;
-            printf("[LocationManager] 使用PSRAM分配JSON解析缓冲区: %u字节\n", capacity);
-        }
-    }
-    
-    // 如果PSRAM分配失败，使用内部RAM
-    if (!doc) {
-        doc = new DynamicJsonDocument(capacity);
-        usedPSRAMForJSON = false;
-        trackMemoryAllocation(capacity, false);
-        _statistics.jsonBufferSize = capacity;
-        printf("[LocationManager] 使用内部RAM分配JSON解析缓冲区: %u字节\n", capacity);
-    }
-    
-    if (!doc) {
+    PSRAMArenaScope arena(_psramManager);
+    ArenaJsonDocument doc(capacity, arena.jsonAllocator());
+    if (doc.capacity() == 0) {
         printf("❌ [LocationManager] JSON文档分配失败\n");
         return false;
     }
+    _statistics.jsonBufferSize = capacity;
     
-    DeserializationError error = deserializeJson(*doc, response);
+    DeserializationError error = deserializeJson(doc, response);
     if (error) {
         printf("❌ [LocationManager] JSON解析失败: %s\n", error.c_str());
-        // 清理JSON文档
-        doc->~DynamicJsonDocument();
-        if (usedPSRAMForJSON) {
-            _psramManager->deallocate(docBuffer);
-            trackMemoryDeallocation(capacity, true);
-        } else {
-            delete doc;
-            trackMemoryDeallocation(capacity, false);
-        }
         return false;
     }
     
     // 检查响应状态
-    const char* status = (*doc)["status"];
+    const char* status = doc["status"];
     if (!status || strcmp(status, "1") != 0) {
-        const char* info = (*doc)["info"];
+        const char* info = doc["info"];
         printf("❌ [LocationManager] API响应错误: %s\n", info ? info : "未知错误");
-        // 清理JSON文档
-        doc->~DynamicJsonDocument();
-        if (usedPSRAMForJSON) {
-            _psramManager->deallocate(docBuffer);
-            trackMemoryDeallocation(capacity, true);
-        } else {
-            delete doc;
-            trackMemoryDeallocation(capacity, false);
-        }
         return false;
     }
     
     // 解析定位数据
     if (!lockLocationData()) {
         printf("❌ [LocationManager] 获取定位数据锁失败\n");
-        // 清理JSON文档
-        doc->~DynamicJsonDocument();
-        if (usedPSRAMForJSON) {
-            _psramManager->deallocate(docBuffer);
-            trackMemoryDeallocation(capacity, true);
-        } else {
-            delete doc;
-            trackMemoryDeallocation(capacity, false);
-        }
         return false;
     }
     
     // 解析响应数据
-    const char* province = (*doc)["province"];
-    const char* city = (*doc)["city"];
-    const char* adcode = (*doc)["adcode"];
-    const char* rectangle = (*doc)["rectangle"];
+    const char* province = doc["province"];
+    const char* city = doc["city"];
+    const char* adcode = doc["adcode"];
+    const char* rectangle = doc["rectangle"];
     
     _currentLocation.province = province ? String(province) : "";
     _currentLocation.city = city ? String(city) : "";
@@ -748,16 +702,6 @@ bool LocationManager::parseLocationResponse(const String& response) {
     
     unlockLocationData();
     
-    // 清理JSON文档
-    doc->~DynamicJsonDocument();
-    if (usedPSRAMForJSON) {
-        _psramManager->deallocate(docBuffer);
-        trackMemoryDeallocation(capacity, true);
-    } else {
-        delete doc;
-        trackMemoryDeallocation(capacity, false);
-    }
-    
     printDebugInfo("定位数据解析成功");
     
     return true;
@@ -1000,6 +944,10 @@ bool LocationManager::createLocationTask() {
 void LocationManager::deleteLocationTask() {
     if (_locationTaskHandle) {
         vTaskDelete(_locationTaskHandle);
+        // 任务已被删除，作用域不会再析构，强制归还临时内存区
+        if (_psramManager) {
+            _psramManager->releaseTaskArena(_locationTaskHandle, true);
+        }
         _locationTaskHandle = nullptr;
         printDebugInfo("定位任务已删除");
     }
@@ -360,40 +360,9 @@ void Monitor::processPortData(JsonObject port) {
         m_currentPowerData.ports[index].protocol_handshake_power = 0;
         
         // 设置协议名称
-        const char* protocol_names[] = {
-            "None",         // 0  FC_None
-            "QC2.0",        // 1  FC_QC2
-            "QC3.0",        // 2  FC_QC3
-            "QC3+",         // 3  FC_QC3P
-            "SFCP",         // 4  FC_SFCP
-            "AFC",          // 5  FC_AFC
-            "FCP",          // 6  FC_FCP
-            "SCP",          // 7  FC_SCP
-            "VOOC1.0",      // 8  FC_VOOC1P0
-            "VOOC4.0",      // 9  FC_VOOC4P0
-            "SVOOC2.0",     // 10 FC_SVOOC2P0
-            "TFCP",         // 11 FC_TFCP
-            "UFCS",         // 12 FC_UFCS
-            "PE1.0",        // 13 FC_PE1
-            "PE2.0",        // 14 FC_PE2
-            "PD 3.0",     // 15 FC_PD_Fix5V
-            "PD 3.0",     // 16 FC_PD_FixHV
-            "PD 3.0",   // 17 FC_PD_SPR_AVS
-            "PD PPS",       // 18 FC_PD_PPS
-            "PD 3.1",    // 19 FC_PD_EPR_HV
-            "PD 3.1"        // 20 FC_PD_AVS
-        };
-        
-        int protocol = m_currentPowerData.ports[index].fc_protocol;
-        if (protocol == 0xff) {
-            // 特殊值：不充电状态
-            strcpy(m_currentPowerData.ports[index].protocol_name, "未知");
-        } else if (protocol >= 0 && protocol <= 20) {
-            strncpy(m_currentPowerData.ports[index].protocol_name, protocol_names[protocol], 15);
-            m_currentPowerData.ports[index].protocol_name[15] = '\0';
-        } else {
-            strcpy(m_currentPowerData.ports[index].protocol_name, "未知");
-        }
+        strncpy(m_currentPowerData.ports[index].protocol_name,
+                getFastChargeProtocolName(m_currentPowerData.ports[index].fc_protocol), 15);
+        m_currentPowerData.ports[index].protocol_name[15] = '\0';
         
         // 解析PD状态信息
         if (port.containsKey("pd_status")) {
@@ -0,0 +1,593 @@
+/*
+ * PSRAMAllocProfiler.cpp - PSRAM分配剖析器实现文件
+ * ESP32S3监控项目 - PSRAM内存管理模块
+ *
+ * 二进制快照格式（小端，无填充）：
+ *   头部     magic u32, version u16, flags u16(bit0=剖析开启), uptimeSec u32, sinceSec u32,
+ *            allocs, frees, liveCount, liveBytes, peakLiveBytes, leakScans, psramMinFree (u32 x7),
+ *            当前堆水位 (u32 x6，字段顺序同ProfilerHeapSample),
+ *            sizeClasses u8, lifetimeClasses u8, tagCount u16, heapSampleCount u16, leakWindow u16
+ *   直方图   sizeAllocs[sizeClasses] u32, sizeLive[sizeClasses] u32, lifetimes[lifetimeClasses] u32
+ *   标签     tagCount条：tag u16, nameLen u8, name[nameLen](UTF-8),
+ *            用途统计和任务统计各一份 (allocs, frees, liveCount, liveBytes, peakBytes, maxLifetimeMs u32,
+ *            lifetimeSumMs u64)，泄漏信息 (oldBytes, oldCount, oldestAgeMs, growthBytes u32, windowFill u8, suspected u8)
+ *   堆水位   heapSampleCount条，按时间先后，每条u32 x6
+ */
+
+#include "PSRAMAllocProfiler.h"
+#include <string.h>
+#include <esp_timer.h>
+#include "esp_heap_caps.h"
+
+// 存活时间级别上界（毫秒）：10ms, 100ms, 1s, 10s, 1分钟, 10分钟, 1小时, 1天, 更长
+static const uint32_t PROFILER_LIFETIME_BOUNDS[PROFILER_LIFETIME_CLASSES] = {
+    10, 100, 1000, 10000, 60000, 600000, 3600000, 86400000, 0
+};
+
+static const size_t DUMP_HEADER_BYTES = 4 + 2 + 2 + 4 + 4 + 7 * 4 + sizeof(ProfilerHeapSample) + 1 + 1 + 2 + 2 + 2;
+static const size_t DUMP_TAG_STATS_BYTES = 6 * 4 + 8;
+static const size_t DUMP_TAG_FIXED_BYTES = 2 + 1 + DUMP_TAG_STATS_BYTES * 2 + 4 * 4 + 1 + 1;
+
+/**
+ * @brief 定长顺序写入（设备为小端，直接复制）
+ */
+class DumpWriter {
+public:
+    DumpWriter(uint8_t* out, size_t max) : m_out(out), m_max(max), m_pos(0), m_overflow(false) {}
+
+    void put(const void* data, size_t len) {
+        if (m_pos + len > m_max) {
+            m_overflow = true;
+            return;
+        }
+        memcpy(m_out + m_pos, data, len);
+        m_pos += len;
+    }
+    void u8(uint8_t v) { put(&v, 1); }
+    void u16(uint16_t v) { put(&v, 2); }
+    void u32(uint32_t v) { put(&v, 4); }
+    void u64(uint64_t v) { put(&v, 8); }
+
+    size_t pos() const { return m_pos; }
+    bool overflow() const { return m_overflow; }
+    uint8_t* at(size_t pos) { return m_out + pos; }
+
+private:
+    uint8_t* m_out;
+    size_t m_max;
+    size_t m_pos;
+    bool m_overflow;
+};
+
+static void writeTagStats(DumpWriter& w, const ProfilerTagStats& s) {
+    w.u32(s.allocs);
+    w.u32(s.frees);
+    w.u32(s.liveCount);
+    w.u32(s.liveBytes);
+    w.u32(s.peakBytes);
+    w.u32(s.maxLifetimeMs);
+    w.u64(s.lifetimeSumMs);
+}
+
+static void writeHeapSample(DumpWriter& w, const ProfilerHeapSample& s) {
+    w.u32(s.uptimeSec);
+    w.u32(s.internalFree);
+    w.u32(s.internalMinFree);
+    w.u32(s.internalLargest);
+    w.u32(s.psramFree);
+    w.u32(s.liveBytes);
+}
+
+PSRAMAllocProfiler::PSRAMAllocProfiler()
+    : m_tables(nullptr)
+    , m_enabled(PSRAM_PROFILER_ENABLED)
+    , m_allocs(0)
+    , m_frees(0)
+    , m_liveCount(0)
+    , m_liveBytes(0)
+    , m_peakLiveBytes(0)
+    , m_sinceSec(0)
+    , m_heapHead(0)
+    , m_heapCount(0)
+    , m_lastHeapSample(0)
+    , m_leakHead(0)
+    , m_leakFill(0)
+    , m_leakScans(0)
+    , m_lastLeakScan(0)
+    , m_suspects(0)
+    , m_mux(portMUX_INITIALIZER_UNLOCKED) {
+    memset(m_sizeAllocs, 0, sizeof(m_sizeAllocs));
+    memset(m_sizeLive, 0, sizeof(m_sizeLive));
+    memset(m_lifetimes, 0, sizeof(m_lifetimes));
+}
+
+PSRAMAllocProfiler::~PSRAMAllocProfiler() {
+    if (m_tables) {
+        heap_caps_free(m_tables);
+        m_tables = nullptr;
+    }
+}
+
+bool PSRAMAllocProfiler::init(uint32_t caps) {
+    if (m_tables) {
+        return true;
+    }
+
+    m_tables = (Tables*)heap_caps_calloc(1, sizeof(Tables), caps);
+    if (!m_tables) {
+        return false;
+    }
+    m_sinceSec = uptimeSec();
+    return true;
+}
+
+uint8_t PSRAMAllocProfiler::sizeClassOf(uint32_t size) {
+    if (size <= 16) {
+        return 0;
+    }
+    // 向上取整的log2，16B对应0级
+    uint8_t cls = (uint8_t)(32 - __builtin_clz(size - 1) - 4);
+    return cls < PROFILER_SIZE_CLASSES - 1 ? cls : PROFILER_SIZE_CLASSES - 1;
+}
+
+uint32_t PSRAMAllocProfiler::sizeClassLimit(uint8_t cls) {
+    return cls < PROFILER_SIZE_CLASSES - 1 ? (16u << cls) : 0;
+}
+
+uint8_t PSRAMAllocProfiler::lifetimeClassOf(uint32_t ms) {
+    for (uint8_t i = 0; i < PROFILER_LIFETIME_CLASSES - 1; i++) {
+        if (ms < PROFILER_LIFETIME_BOUNDS[i]) {
+            return i;
+        }
+    }
+    return PROFILER_LIFETIME_CLASSES - 1;
+}
+
+uint32_t PSRAMAllocProfiler::lifetimeClassLimit(uint8_t cls) {
+    return cls < PROFILER_LIFETIME_CLASSES ? PROFILER_LIFETIME_BOUNDS[cls] : 0;
+}
+
+uint32_t PSRAMAllocProfiler::uptimeSec() {
+    // millis()约49.7天回绕，长时间运行的记录使用64位计时器
+    return (uint32_t)(esp_timer_get_time() / 1000000LL);
+}
+
+void PSRAMAllocProfiler::addLive(ProfilerTagStats& stats, uint32_t size) {
+    stats.liveCount++;
+    stats.liveBytes += size;
+    if (stats.liveBytes > stats.peakBytes) {
+        stats.peakBytes = stats.liveBytes;
+    }
+}
+
+void PSRAMAllocProfiler::removeLive(ProfilerTagStats& stats, uint32_t size) {
+    // 重新开启剖析前分配的块不在统计中，减到0为止
+    stats.liveCount = stats.liveCount > 0 ? stats.liveCount - 1 : 0;
+    stats.liveBytes = stats.liveBytes > size ? stats.liveBytes - size : 0;
+}
+
+void PSRAMAllocProfiler::onAlloc(const PSRAMBlockInfo& info) {
+    if (!isEnabled() || info.purposeTag >= ALLOC_TAG_MAX || info.taskTag >= ALLOC_TAG_MAX) {
+        return;
+    }
+
+    uint8_t cls = sizeClassOf(info.size);
+    portENTER_CRITICAL(&m_mux);
+    m_allocs++;
+    m_liveCount++;
+    m_liveBytes += info.size;
+    if (m_liveBytes > m_peakLiveBytes) {
+        m_peakLiveBytes = m_liveBytes;
+    }
+    m_sizeAllocs[cls]++;
+    m_sizeLive[cls]++;
+
+    ProfilerTagStats& purpose = m_tables->purpose[info.purposeTag];
+    purpose.allocs++;
+    addLive(purpose, info.size);
+    ProfilerTagStats& task = m_tables->task[info.taskTag];
+    task.allocs++;
+    addLive(task, info.size);
+    portEXIT_CRITICAL(&m_mux);
+}
+
+void PSRAMAllocProfiler::onFree(const PSRAMBlockInfo& info, uint32_t now) {
+    if (!isEnabled() || info.purposeTag >= ALLOC_TAG_MAX || info.taskTag >= ALLOC_TAG_MAX) {
+        return;
+    }
+
+    uint32_t lifetime = now - info.allocTime;
+    uint8_t cls = sizeClassOf(info.size);
+    uint8_t lifeCls = lifetimeClassOf(lifetime);
+
+    portENTER_CRITICAL(&m_mux);
+    m_frees++;
+    m_liveCount = m_liveCount > 0 ? m_liveCount - 1 : 0;
+    m_liveBytes = m_liveBytes > info.size ? m_liveBytes - info.size : 0;
+    if (m_sizeLive[cls] > 0) {
+        m_sizeLive[cls]--;
+    }
+    m_lifetimes[lifeCls]++;
+
+    ProfilerTagStats* stats[2] = { &m_tables->purpose[info.purposeTag], &m_tables->task[info.taskTag] };
+    for (int i = 0; i < 2; i++) {
+        stats[i]->frees++;
+        removeLive(*stats[i], info.size);
+        stats[i]->lifetimeSumMs += lifetime;
+        if (lifetime > stats[i]->maxLifetimeMs) {
+            stats[i]->maxLifetimeMs = lifetime;
+        }
+    }
+    portEXIT_CRITICAL(&m_mux);
+}
+
+void PSRAMAllocProfiler::moveTask(const PSRAMBlockInfo& info, uint16_t newTaskTag) {
+    if (!isEnabled() || info.taskTag >= ALLOC_TAG_MAX || newTaskTag >= ALLOC_TAG_MAX || info.taskTag == newTaskTag) {
+        return;
+    }
+
+    portENTER_CRITICAL(&m_mux);
+    ProfilerTagStats& from = m_tables->task[info.taskTag];
+    ProfilerTagStats& to = m_tables->task[newTaskTag];
+    from.allocs = from.allocs > 0 ? from.allocs - 1 : 0;
+    removeLive(from, info.size);
+    to.allocs++;
+    addLive(to, info.size);
+    portEXIT_CRITICAL(&m_mux);
+}
+
+void PSRAMAllocProfiler::beginRebuild() {
+    if (!m_tables) {
+        return;
+    }
+
+    portENTER_CRITICAL(&m_mux);
+    m_liveCount = 0;
+    m_liveBytes = 0;
+    memset(m_sizeLive, 0, sizeof(m_sizeLive));
+    for (int i = 0; i < ALLOC_TAG_MAX; i++) {
+        m_tables->purpose[i].liveCount = 0;
+        m_tables->purpose[i].liveBytes = 0;
+        m_tables->task[i].liveCount = 0;
+        m_tables->task[i].liveBytes = 0;
+    }
+    portEXIT_CRITICAL(&m_mux);
+}
+
+void PSRAMAllocProfiler::rebuildBlock(const PSRAMBlockInfo& info) {
+    if (!m_tables || info.purposeTag >= ALLOC_TAG_MAX || info.taskTag >= ALLOC_TAG_MAX) {
+        return;
+    }
+
+    uint8_t cls = sizeClassOf(info.size);
+    portENTER_CRITICAL(&m_mux);
+    m_liveCount++;
+    m_liveBytes += info.size;
+    if (m_liveBytes > m_peakLiveBytes) {
+        m_peakLiveBytes = m_liveBytes;
+    }
+    m_sizeLive[cls]++;
+    addLive(m_tables->purpose[info.purposeTag], info.size);
+    addLive(m_tables->task[info.taskTag], info.size);
+    portEXIT_CRITICAL(&m_mux);
+}
+
+void PSRAMAllocProfiler::resetCounters() {
+    if (!m_tables) {
+        return;
+    }
+
+    portENTER_CRITICAL(&m_mux);
+    m_allocs = 0;
+    m_frees = 0;
+    m_peakLiveBytes = m_liveBytes;
+    memset(m_sizeAllocs, 0, sizeof(m_sizeAllocs));
+    memset(m_lifetimes, 0, sizeof(m_lifetimes));
+    ProfilerTagStats* tables[2] = { m_tables->purpose, m_tables->task };
+    for (int t = 0; t < 2; t++) {
+        for (int i = 0; i < ALLOC_TAG_MAX; i++) {
+            ProfilerTagStats& s = tables[t][i];
+            s.allocs = 0;
+            s.frees = 0;
+            s.peakBytes = s.liveBytes;
+            s.maxLifetimeMs = 0;
+            s.lifetimeSumMs = 0;
+        }
+    }
+    portEXIT_CRITICAL(&m_mux);
+    m_sinceSec = uptimeSec();
+}
+
+void PSRAMAllocProfiler::readHeap(ProfilerHeapSample* sample) const {
+    sample->uptimeSec = uptimeSec();
+    sample->internalFree = heap_caps_get_free_size(MALLOC_CAP_INTERNAL);
+    sample->internalMinFree = heap_caps_get_minimum_free_size(MALLOC_CAP_INTERNAL);
+    sample->internalLargest = heap_caps_get_largest_free_block(MALLOC_CAP_INTERNAL);
+    sample->psramFree = heap_caps_get_free_size(MALLOC_CAP_SPIRAM);
+    sample->liveBytes = m_liveBytes;
+}
+
+bool PSRAMAllocProfiler::heapSampleDue(uint32_t now) const {
+    return isEnabled() && (m_heapCount == 0 || now - m_lastHeapSample >= PROFILER_HEAP_SAMPLE_MS);
+}
+
+void PSRAMAllocProfiler::sampleHeap(uint32_t now) {
+    if (!m_tables) {
+        return;
+    }
+
+    ProfilerHeapSample sample;
+    readHeap(&sample);
+
+    portENTER_CRITICAL(&m_mux);
+    m_tables->heapSamples[m_heapHead] = sample;
+    m_heapHead = (m_heapHead + 1) % PROFILER_HEAP_SAMPLES;
+    if (m_heapCount < PROFILER_HEAP_SAMPLES) {
+        m_heapCount++;
+    }
+    portEXIT_CRITICAL(&m_mux);
+    m_lastHeapSample = now;
+}
+
+bool PSRAMAllocProfiler::leakScanDue(uint32_t now) const {
+    return isEnabled() && now - m_lastLeakScan >= PROFILER_LEAK_SCAN_MS;
+}
+
+void PSRAMAllocProfiler::beginLeakScan() {
+    // 累加区只由监控任务访问，不需要加锁
+    if (m_tables) {
+        memset(m_tables->scanBytes, 0, sizeof(m_tables->scanBytes));
+        memset(m_tables->scanCount, 0, sizeof(m_tables->scanCount));
+        memset(m_tables->scanOldest, 0, sizeof(m_tables->scanOldest));
+    }
+}
+
+void PSRAMAllocProfiler::scanBlock(const PSRAMBlockInfo& info, uint32_t now) {
+    if (!m_tables || info.purposeTag >= ALLOC_TAG_MAX) {
+        return;
+    }
+
+    uint32_t age = now - info.allocTime;
+    if (age < PROFILER_LEAK_AGE_MS) {
+        return;
+    }
+    m_tables->scanBytes[info.purposeTag] += info.size;
+    m_tables->scanCount[info.purposeTag]++;
+    if (age > m_tables->scanOldest[info.purposeTag]) {
+        m_tables->scanOldest[info.purposeTag] = age;
+    }
+}
+
+void PSRAMAllocProfiler::endLeakScan(uint32_t now) {
+    if (!m_tables) {
+        return;
+    }
+
+    uint8_t head = m_leakHead;
+    uint8_t fill = m_leakFill < PROFILER_LEAK_WINDOW ? m_leakFill + 1 : PROFILER_LEAK_WINDOW;
+    uint8_t start = (uint8_t)((head + PROFILER_LEAK_WINDOW + 1 - fill) % PROFILER_LEAK_WINDOW);
+    uint32_t suspects = 0;
+
+    for (int tag = 0; tag < ALLOC_TAG_MAX; tag++) {
+        uint32_t* history = m_tables->leakHistory[tag];
+        history[head] = m_tables->scanBytes[tag];
+
+        // 窗口内老块字节只增不减，且总增长超过阈值
+        bool growing = true;
+        for (uint8_t i = 1; i < fill; i++) {
+            uint8_t prev = (start + i - 1) % PROFILER_LEAK_WINDOW;
+            uint8_t cur = (start + i) % PROFILER_LEAK_WINDOW;
+            if (history[cur] < history[prev]) {
+                growing = false;
+                break;
+            }
+        }
+        uint32_t first = history[start];
+        uint32_t last = history[head];
+        uint32_t growth = last > first ? last - first : 0;
+        bool suspected = fill == PROFILER_LEAK_WINDOW && growing && growth >= PROFILER_LEAK_MIN_GROWTH;
+        if (suspected) {
+            suspects++;
+        }
+
+        portENTER_CRITICAL(&m_mux);
+        ProfilerLeakInfo& leak = m_tables->leak[tag];
+        leak.oldBytes = m_tables->scanBytes[tag];
+        leak.oldCount = m_tables->scanCount[tag];
+        leak.oldestAgeMs = m_tables->scanOldest[tag];
+        leak.growthBytes = growth;
+        leak.windowFill = fill;
+        leak.suspected = suspected;
+        portEXIT_CRITICAL(&m_mux);
+    }
+
+    m_leakHead = (head + 1) % PROFILER_LEAK_WINDOW;
+    m_leakFill = fill;
+    m_leakScans++;
+    m_suspects = suspects;
+    m_lastLeakScan = now;
+}
+
+void PSRAMAllocProfiler::getSummary(ProfilerSummary* summary) const {
+    if (!summary) {
+        return;
+    }
+
+    memset(summary, 0, sizeof(ProfilerSummary));
+    readHeap(&summary->current);
+    summary->psramMinFree = heap_caps_get_minimum_free_size(MALLOC_CAP_SPIRAM);
+
+    portENTER_CRITICAL(&m_mux);
+    summary->enabled = isEnabled();
+    summary->sinceSec = m_sinceSec;
+    summary->allocs = m_allocs;
+    summary->frees = m_frees;
+    summary->liveCount = m_liveCount;
+    summary->liveBytes = m_liveBytes;
+    summary->peakLiveBytes = m_peakLiveBytes;
+    summary->leakScans = m_leakScans;
+    summary->suspects = m_suspects;
+    memcpy(summary->sizeAllocs, m_sizeAllocs, sizeof(m_sizeAllocs));
+    memcpy(summary->sizeLive, m_sizeLive, sizeof(m_sizeLive));
+    memcpy(summary->lifetimes, m_lifetimes, sizeof(m_lifetimes));
+    portEXIT_CRITICAL(&m_mux);
+}
+
+bool PSRAMAllocProfiler::getPurposeStats(uint16_t tag, ProfilerTagStats* stats) const {
+    if (!m_tables || !stats || tag >= ALLOC_TAG_MAX) {
+        return false;
+    }
+
+    portENTER_CRITICAL(&m_mux);
+    *stats = m_tables->purpose[tag];
+    portEXIT_CRITICAL(&m_mux);
+    return true;
+}
+
+bool PSRAMAllocProfiler::getTaskStats(uint16_t tag, ProfilerTagStats* stats) const {
+    if (!m_tables || !stats || tag >= ALLOC_TAG_MAX) {
+        return false;
+    }
+
+    portENTER_CRITICAL(&m_mux);
+    *stats = m_tables->task[tag];
+    portEXIT_CRITICAL(&m_mux);
+    return true;
+}
+
+bool PSRAMAllocProfiler::getLeakInfo(uint16_t tag, ProfilerLeakInfo* info) const {
+    if (!m_tables || !info || tag >= ALLOC_TAG_MAX) {
+        return false;
+    }
+
+    portENTER_CRITICAL(&m_mux);
+    *info = m_tables->leak[tag];
+    portEXIT_CRITICAL(&m_mux);
+    return true;
+}
+
+uint32_t PSRAMAllocProfiler::getHeapSamples(ProfilerHeapSample* out, uint32_t max) const {
+    if (!m_tables || !out) {
+        return 0;
+    }
+
+    portENTER_CRITICAL(&m_mux);
+    uint32_t n = m_heapCount < max ? m_heapCount : max;
+    // 最旧的一条位于head - count处，只取最新的n条
+    uint32_t start = (m_heapHead + PROFILER_HEAP_SAMPLES - n) % PROFILER_HEAP_SAMPLES;
+    for (uint32_t i = 0; i < n; i++) {
+        out[i] = m_tables->heapSamples[(start + i) % PROFILER_HEAP_SAMPLES];
+    }
+    portEXIT_CRITICAL(&m_mux);
+    return n;
+}
+
+size_t PSRAMAllocProfiler::dumpSize(const PSRAMAllocTracker& tags) const {
+    AllocTrackerStats stats;
+    tags.getStats(&stats);
+    // 标签名总长不超过标签字符串区
+    return DUMP_HEADER_BYTES
+         + (PROFILER_SIZE_CLASSES * 2 + PROFILER_LIFETIME_CLASSES) * 4
+         + stats.tags * DUMP_TAG_FIXED_BYTES + ALLOC_TAG_ARENA_BYTES
+         + PROFILER_HEAP_SAMPLES * sizeof(ProfilerHeapSample);
+}
+
+size_t PSRAMAllocProfiler::dump(uint8_t* out, size_t max, const PSRAMAllocTracker& tags) const {
+    if (!m_tables || !out) {
+        return 0;
+    }
+
+    ProfilerSummary summary;
+    getSummary(&summary);
+    AllocTrackerStats trackerStats;
+    tags.getStats(&trackerStats);
+
+    DumpWriter w(out, max);
+    w.u32(PROFILER_DUMP_MAGIC);
+    w.u16(PROFILER_DUMP_VERSION);
+    w.u16(summary.enabled ? 1 : 0);
+    w.u32(summary.current.uptimeSec);
+    w.u32(summary.sinceSec);
+    w.u32(summary.allocs);
+    w.u32(summary.frees);
+    w.u32(summary.liveCount);
+    w.u32(summary.liveBytes);
+    w.u32(summary.peakLiveBytes);
+    w.u32(summary.leakScans);
+    w.u32(summary.psramMinFree);
+    writeHeapSample(w, summary.current);
+    w.u8(PROFILER_SIZE_CLASSES);
+    w.u8(PROFILER_LIFETIME_CLASSES);
+    size_t tagCountPos = w.pos();
+    w.u16(0);
+    size_t sampleCountPos = w.pos();
+    w.u16(0);
+    w.u16(PROFILER_LEAK_WINDOW);
+
+    for (int i = 0; i < PROFILER_SIZE_CLASSES; i++) {
+        w.u32(summary.sizeAllocs[i]);
+    }
+    for (int i = 0; i < PROFILER_SIZE_CLASSES; i++) {
+        w.u32(summary.sizeLive[i]);
+    }
+    for (int i = 0; i < PROFILER_LIFETIME_CLASSES; i++) {
+        w.u32(summary.lifetimes[i]);
+    }
+
+    // 只导出有过分配的标签
+    uint16_t tagCount = 0;
+    for (uint16_t tag = 0; tag < trackerStats.tags && tag < ALLOC_TAG_MAX; tag++) {
+        ProfilerTagStats purpose, task;
+        ProfilerLeakInfo leak;
+        if (!getPurposeStats(tag, &purpose) || !getTaskStats(tag, &task) || !getLeakInfo(tag, &leak)) {
+            continue;
+        }
+        if (!purpose.allocs && !purpose.liveCount && !task.allocs && !task.liveCount) {
+            continue;
+        }
+
+        const char* name = tags.tagName(tag);
+        size_t nameLen = strlen(name);
+        if (nameLen > 255) {
+            nameLen = 255;
+        }
+        w.u16(tag);
+        w.u8((uint8_t)nameLen);
+        w.put(name, nameLen);
+        writeTagStats(w, purpose);
+        writeTagStats(w, task);
+        w.u32(leak.oldBytes);
+        w.u32(leak.oldCount);
+        w.u32(leak.oldestAgeMs);
+        w.u32(leak.growthBytes);
+        w.u8(leak.windowFill);
+        w.u8(leak.suspected ? 1 : 0);
+        tagCount++;
+    }
+
+    // 堆水位历史分批复制到栈上再写出，临界区内不做写出
+    ProfilerHeapSample samples[16];
+    portENTER_CRITICAL(&m_mux);
+    uint16_t sampleCount = m_heapCount;
+    uint32_t first = (m_heapHead + PROFILER_HEAP_SAMPLES - m_heapCount) % PROFILER_HEAP_SAMPLES;
+    portEXIT_CRITICAL(&m_mux);
+    for (uint32_t done = 0; done < sampleCount; ) {
+        uint32_t batch = sampleCount - done < 16 ? sampleCount - done : 16;
+        portENTER_CRITICAL(&m_mux);
+        for (uint32_t i = 0; i < batch; i++) {
+            samples[i] = m_tables->heapSamples[(first + done + i) % PROFILER_HEAP_SAMPLES];
+        }
+        portEXIT_CRITICAL(&m_mux);
+        for (uint32_t i = 0; i < batch; i++) {
+            writeHeapSample(w, samples[i]);
+        }
+        done += batch;
+    }
+
+    if (w.overflow()) {
+        return 0;
+    }
+    memcpy(w.at(tagCountPos), &tagCount, 2);
+    memcpy(w.at(sampleCountPos), &sampleCount, 2);
+    return w.pos();
+}
@@ -0,0 +1,234 @@
+/*
+ * PSRAMAllocProfiler.h - PSRAM分配剖析器头文件
+ * ESP32S3监控项目 - PSRAM内存管理模块
+ *
+ * 功能特性：
+ * - 按2的幂分级的尺寸直方图（累计分配次数 + 当前在用块数）和释放时的存活时间直方图
+ * - 按用途标签和任务标签分别统计在用字节/块数、峰值、分配/释放次数、平均和最长存活时间
+ * - 内部RAM（MALLOC_CAP_INTERNAL）和PSRAM水位：当前/历史最低空闲、最大连续块，定时采样成环形历史
+ * - 疑似泄漏检测：定时扫描跟踪表，统计每个用途中存活超过PROFILER_LEAK_AGE_MS的"老块"，
+ *   连续PROFILER_LEAK_WINDOW次检查只增不减且增长超过阈值的用途标记为疑似泄漏
+ * - 二进制导出（小端紧凑格式，见PROFILER_DUMP_MAGIC），配合host_memprof.py在主机上分析和对比
+ *
+ * 统计表在init时一次性分配到PSRAM，分配/释放路径只做定长更新；扫描和采样由PSRAMManager的监控任务驱动
+ */
+
+#ifndef PSRAM_ALLOC_PROFILER_H
+#define PSRAM_ALLOC_PROFILER_H
+
+#include <stdint.h>
+#include <stddef.h>
+#include "freertos/FreeRTOS.h"
+#include "PSRAMAllocTracker.h"
+
+#define PSRAM_PROFILER_ENABLED      1                       // 启动时是否开启剖析（运行时可切换）
+
+#define PROFILER_SIZE_CLASSES       18                      // 尺寸分级：≤16B, ≤32B ... ≤1MB, >1MB
+#define PROFILER_LIFETIME_CLASSES   9                       // 存活时间分级，见PROFILER_LIFETIME_BOUNDS
+#define PROFILER_HEAP_SAMPLES       96                      // 堆水位历史采样数
+#define PROFILER_HEAP_SAMPLE_MS     (15 * 60 * 1000)        // 采样间隔（96 × 15分钟 = 24小时）
+#define PROFILER_LEAK_SCAN_MS       (30 * 60 * 1000)        // 疑似泄漏检查间隔
+#define PROFILER_LEAK_AGE_MS        (60 * 60 * 1000)        // 存活超过此时间的块计为老块
+#define PROFILER_LEAK_WINDOW        12                      // 连续增长的检查次数（12 × 30分钟 = 6小时）
+#define PROFILER_LEAK_MIN_GROWTH    1024                    // 窗口内老块至少增长的字节数
+
+#define PROFILER_DUMP_MAGIC         0x4650524Du             // "MPRF"
+#define PROFILER_DUMP_VERSION       1
+
+/**
+ * @brief 单个标签的分配统计
+ */
+struct ProfilerTagStats {
+    uint32_t allocs;            ///< 累计分配次数
+    uint32_t frees;             ///< 累计释放次数
+    uint32_t liveCount;         ///< 当前在用块数
+    uint32_t liveBytes;         ///< 当前在用字节
+    uint32_t peakBytes;         ///< 在用字节峰值
+    uint32_t maxLifetimeMs;     ///< 已释放块的最长存活时间
+    uint64_t lifetimeSumMs;     ///< 已释放块的存活时间之和（求平均用）
+};
+
+/**
+ * @brief 单个用途标签的疑似泄漏信息（最近一次检查）
+ */
+struct ProfilerLeakInfo {
+    uint32_t oldBytes;          ///< 老块字节数
+    uint32_t oldCount;          ///< 老块数
+    uint32_t oldestAgeMs;       ///< 最老块的存活时间
+    uint32_t growthBytes;       ///< 窗口内老块字节的增长
+    uint8_t windowFill;         ///< 窗口中已有的检查次数
+    bool suspected;             ///< 是否疑似泄漏
+};
+
+/**
+ * @brief 堆水位采样
+ */
+struct ProfilerHeapSample {
+    uint32_t uptimeSec;         ///< 开机秒数
+    uint32_t internalFree;      ///< 内部RAM空闲
+    uint32_t internalMinFree;   ///< 内部RAM历史最低空闲（系统记录的低水位）
+    uint32_t internalLargest;   ///< 内部RAM最大连续块
+    uint32_t psramFree;         ///< PSRAM空闲
+    uint32_t liveBytes;         ///< 跟踪到的在用字节
+};
+
+/**
+ * @brief 剖析器汇总
+ */
+struct ProfilerSummary {
+    bool enabled;
+    uint32_t sinceSec;                                  ///< 计数开始（或上次重置）的开机秒数
+    uint32_t allocs;
+    uint32_t frees;
+    uint32_t liveCount;
+    uint32_t liveBytes;
+    uint32_t peakLiveBytes;
+    uint32_t leakScans;                                 ///< 已完成的泄漏检查次数
+    uint32_t suspects;                                  ///< 当前疑似泄漏的用途数
+    ProfilerHeapSample current;                         ///< 调用时的堆水位
+    uint32_t psramMinFree;                              ///< PSRAM历史最低空闲
+    uint32_t sizeAllocs[PROFILER_SIZE_CLASSES];         ///< 各尺寸级别累计分配次数
+    uint32_t sizeLive[PROFILER_SIZE_CLASSES];           ///< 各尺寸级别当前在用块数
+    uint32_t lifetimes[PROFILER_LIFETIME_CLASSES];      ///< 各存活时间级别的释放次数
+};
+
+/**
+ * @brief PSRAM分配剖析器
+ */
+class PSRAMAllocProfiler {
+public:
+    PSRAMAllocProfiler();
+    ~PSRAMAllocProfiler();
+
+    /**
+     * @brief 分配统计表
+     *
+     * @param caps 分配能力（设备上为MALLOC_CAP_SPIRAM）
+     */
+    bool init(uint32_t caps);
+
+    bool isInitialized() const { return m_tables != nullptr; }
+
+    void setEnabled(bool enabled) { m_enabled = enabled; }
+    bool isEnabled() const { return m_enabled && m_tables; }
+
+    /**
+     * @brief 记录一次分配/释放（info为跟踪表中的记录）
+     */
+    void onAlloc(const PSRAMBlockInfo& info);
+    void onFree(const PSRAMBlockInfo& info, uint32_t now);
+
+    /**
+     * @brief 在用块改归属任务（allocateForTask）
+     */
+    void moveTask(const PSRAMBlockInfo& info, uint16_t newTaskTag);
+
+    /**
+     * @brief 清零在用统计后按跟踪表逐块补入（重新开启剖析时使用）
+     */
+    void beginRebuild();
+    void rebuildBlock(const PSRAMBlockInfo& info);
+
+    /**
+     * @brief 清零累计计数和直方图，在用统计保留，峰值从当前值重新开始
+     */
+    void resetCounters();
+
+    /**
+     * @brief 采样堆水位（到达采样间隔时写入历史）
+     */
+    bool heapSampleDue(uint32_t now) const;
+    void sampleHeap(uint32_t now);
+
+    /**
+     * @brief 疑似泄漏检查：begin后对跟踪表每条记录调用scanBlock，最后end
+     */
+    bool leakScanDue(uint32_t now) const;
+    void beginLeakScan();
+    void scanBlock(const PSRAMBlockInfo& info, uint32_t now);
+    void endLeakScan(uint32_t now);
+
+    void getSummary(ProfilerSummary* summary) const;
+
+    /**
+     * @brief 标签统计（tag >= ALLOC_TAG_MAX 时返回false）
+     */
+    bool getPurposeStats(uint16_t tag, ProfilerTagStats* stats) const;
+    bool getTaskStats(uint16_t tag, ProfilerTagStats* stats) const;
+    bool getLeakInfo(uint16_t tag, ProfilerLeakInfo* info) const;
+
+    /**
+     * @brief 按时间先后复制堆水位历史
+     */
+    uint32_t getHeapSamples(ProfilerHeapSample* out, uint32_t max) const;
+
+    /**
+     * @brief 导出二进制快照所需的最大字节数
+     */
+    size_t dumpSize(const PSRAMAllocTracker& tags) const;
+
+    /**
+     * @brief 导出二进制快照
+     *
+     * @param tags 标签名来源
+     * @return 写入的字节数，缓冲区不足时返回0
+     */
+    size_t dump(uint8_t* out, size_t max, const PSRAMAllocTracker& tags) const;
+
+    /**
+     * @brief 尺寸级别的上界（最后一级返回0表示无上界）
+     */
+    static uint32_t sizeClassLimit(uint8_t cls);
+
+    /**
+     * @brief 存活时间级别的上界毫秒（最后一级返回0表示无上界）
+     */
+    static uint32_t lifetimeClassLimit(uint8_t cls);
+
+private:
+    // 统计表（一次性分配到PSRAM）
+    struct Tables {
+        ProfilerTagStats purpose[ALLOC_TAG_MAX];
+        ProfilerTagStats task[ALLOC_TAG_MAX];
+        ProfilerLeakInfo leak[ALLOC_TAG_MAX];
+        uint32_t leakHistory[ALLOC_TAG_MAX][PROFILER_LEAK_WINDOW];     ///< 每次检查的老块字节（环形）
+        uint32_t scanBytes[ALLOC_TAG_MAX];                              ///< 本次检查的累加区
+        uint32_t scanCount[ALLOC_TAG_MAX];
+        uint32_t scanOldest[ALLOC_TAG_MAX];
+        ProfilerHeapSample heapSamples[PROFILER_HEAP_SAMPLES];
+    };
+
+    Tables* m_tables;
+    volatile bool m_enabled;
+
+    uint32_t m_sizeAllocs[PROFILER_SIZE_CLASSES];
+    uint32_t m_sizeLive[PROFILER_SIZE_CLASSES];
+    uint32_t m_lifetimes[PROFILER_LIFETIME_CLASSES];
+    uint32_t m_allocs;
+    uint32_t m_frees;
+    uint32_t m_liveCount;
+    uint32_t m_liveBytes;
+    uint32_t m_peakLiveBytes;
+    uint32_t m_sinceSec;
+
+    uint16_t m_heapHead;            ///< 下一个写入位置
+    uint16_t m_heapCount;
+    uint32_t m_lastHeapSample;
+
+    uint8_t m_leakHead;             ///< 下一个写入的窗口位置
+    uint8_t m_leakFill;
+    uint32_t m_leakScans;
+    uint32_t m_lastLeakScan;
+    uint32_t m_suspects;
+
+    mutable portMUX_TYPE m_mux;
+
+    static uint8_t sizeClassOf(uint32_t size);
+    static uint8_t lifetimeClassOf(uint32_t ms);
+    static uint32_t uptimeSec();
+    void addLive(ProfilerTagStats& stats, uint32_t size);
+    void removeLive(ProfilerTagStats& stats, uint32_t size);
+    void readHeap(ProfilerHeapSample* sample) const;
+};
+
+#endif // PSRAM_ALLOC_PROFILER_H
@@ -0,0 +1,277 @@
+/*
+ * PSRAMAllocTracker.cpp - PSRAM分配跟踪表实现文件
+ * ESP32S3监控项目 - PSRAM内存管理模块
+ */
+
+#include "PSRAMAllocTracker.h"
+#include <string.h>
+#include "esp_heap_caps.h"
+
+PSRAMAllocTracker::PSRAMAllocTracker()
+    : m_table(nullptr)
+    , m_mask(0)
+    , m_count(0)
+    , m_peak(0)
+    , m_maxProbe(0)
+    , m_dropped(0)
+    , m_tagArena(nullptr)
+    , m_tagArenaUsed(0)
+    , m_tagCount(0)
+    , m_tagOverflows(0)
+    , m_mux(portMUX_INITIALIZER_UNLOCKED) {
+    memset(m_tagOffsets, 0, sizeof(m_tagOffsets));
+    memset(m_tagIndex, 0, sizeof(m_tagIndex));
+}
+
+PSRAMAllocTracker::~PSRAMAllocTracker() {
+    if (m_table) {
+        heap_caps_free(m_table);
+        m_table = nullptr;
+    }
+    if (m_tagArena) {
+        heap_caps_free(m_tagArena);
+        m_tagArena = nullptr;
+    }
+}
+
+bool PSRAMAllocTracker::init(uint32_t capacity, uint32_t caps) {
+    if (m_table) {
+        return true;
+    }
+
+    uint32_t size = 16;
+    while (size < capacity) {
+        size <<= 1;
+    }
+
+    m_table = (PSRAMBlockInfo*)heap_caps_calloc(size, sizeof(PSRAMBlockInfo), caps);
+    m_tagArena = (char*)heap_caps_calloc(1, ALLOC_TAG_ARENA_BYTES, caps);
+    if (!m_table || !m_tagArena) {
+        heap_caps_free(m_table);
+        heap_caps_free(m_tagArena);
+        m_table = nullptr;
+        m_tagArena = nullptr;
+        return false;
+    }
+    m_mask = size - 1;
+
+    // 预置两个固定标签，偏移0处为空串
+    m_tagArenaUsed = 1;
+    m_tagCount = 1;
+    internTag("未指定");
+    internTag("其他");
+    return true;
+}
+
+uint32_t PSRAMAllocTracker::slotOf(const void* ptr) const {
+    // 分配地址至少4字节对齐，去掉低位后做乘法散列
+    uint32_t key = (uint32_t)(uintptr_t)ptr >> 2;
+    return (key * 2654435761u) & m_mask;
+}
+
+uint32_t PSRAMAllocTracker::hashString(const char* s) {
+    // FNV-1a
+    uint32_t h = 2166136261u;
+    while (*s) {
+        h ^= (uint8_t)*s++;
+        h *= 16777619u;
+    }
+    return h ? h : 1;
+}
+
+uint16_t PSRAMAllocTracker::internTag(const char* name) {
+    if (!name || !name[0] || !m_tagArena) {
+        return ALLOC_TAG_NONE;
+    }
+
+    uint32_t hash = hashString(name);
+    size_t len = strlen(name);
+    const uint32_t index_mask = ALLOC_TAG_MAX * 2 - 1;
+    uint16_t tag = ALLOC_TAG_OTHER;
+
+    portENTER_CRITICAL(&m_mux);
+    uint32_t slot = hash & index_mask;
+    while (m_tagIndex[slot].tag) {
+        const TagSlot& s = m_tagIndex[slot];
+        if (s.hash == hash && strcmp(m_tagArena + m_tagOffsets[s.tag], name) == 0) {
+            tag = s.tag;
+            portEXIT_CRITICAL(&m_mux);
+            return tag;
+        }
+        slot = (slot + 1) & index_mask;
+    }
+
+    if (m_tagCount < ALLOC_TAG_MAX && m_tagArenaUsed + len + 1 <= ALLOC_TAG_ARENA_BYTES) {
+        tag = m_tagCount++;
+        m_tagOffsets[tag] = m_tagArenaUsed;
+        memcpy(m_tagArena + m_tagArenaUsed, name, len + 1);
+        m_tagArenaUsed += len + 1;
+        m_tagIndex[slot].hash = hash;
+        m_tagIndex[slot].tag = tag;
+    } else {
+        m_tagOverflows++;
+    }
+    portEXIT_CRITICAL(&m_mux);
+    return tag;
+}
+
+const char* PSRAMAllocTracker::tagName(uint16_t tag) const {
+    if (!m_tagArena) {
+        return "";
+    }
+
+    // 标签只追加不修改：在锁内确认已发布，返回的字符串之后不会再变
+    portENTER_CRITICAL(&m_mux);
+    bool valid = tag < m_tagCount;
+    portEXIT_CRITICAL(&m_mux);
+    return valid ? m_tagArena + m_tagOffsets[tag] : "";
+}
+
+bool PSRAMAllocTracker::insert(const PSRAMBlockInfo& info) {
+    if (!m_table || !info.address) {
+        return false;
+    }
+
+    portENTER_CRITICAL(&m_mux);
+    // 装载率限制在75%以内，保证探测长度有界
+    if (m_count >= (m_mask + 1) / 4 * 3) {
+        m_dropped++;
+        portEXIT_CRITICAL(&m_mux);
+        return false;
+    }
+
+    uint32_t slot = slotOf(info.address);
+    uint32_t probe = 0;
+    while (m_table[slot].address && m_table[slot].address != info.address) {
+        slot = (slot + 1) & m_mask;
+        probe++;
+    }
+    if (!m_table[slot].address) {
+        m_count++;
+        if (m_count > m_peak) {
+            m_peak = m_count;
+        }
+    }
+    m_table[slot] = info;
+    if (probe > m_maxProbe) {
+        m_maxProbe = probe;
+    }
+    portEXIT_CRITICAL(&m_mux);
+    return true;
+}
+
+bool PSRAMAllocTracker::remove(void* ptr, PSRAMBlockInfo* removed) {
+    if (!m_table || !ptr) {
+        return false;
+    }
+
+    portENTER_CRITICAL(&m_mux);
+    uint32_t slot = slotOf(ptr);
+    while (m_table[slot].address && m_table[slot].address != ptr) {
+        slot = (slot + 1) & m_mask;
+    }
+    if (!m_table[slot].address) {
+        portEXIT_CRITICAL(&m_mux);
+        return false;
+    }
+    if (removed) {
+        *removed = m_table[slot];
+    }
+
+    // 后移补位：把探测链上后面的记录挪到空位，查找不需要墓碑
+    uint32_t hole = slot;
+    uint32_t next = (hole + 1) & m_mask;
+    while (m_table[next].address) {
+        uint32_t home = slotOf(m_table[next].address);
+        // home不在(hole, next]之间时，记录可以挪到hole
+        bool movable = (hole <= next) ? (home <= hole || home > next) : (home <= hole && home > next);
+        if (movable) {
+            m_table[hole] = m_table[next];
+            hole = next;
+        }
+        next = (next + 1) & m_mask;
+    }
+    m_table[hole].address = nullptr;
+    m_count--;
+    portEXIT_CRITICAL(&m_mux);
+    return true;
+}
+
+bool PSRAMAllocTracker::find(void* ptr, PSRAMBlockInfo* info) const {
+    if (!m_table || !ptr) {
+        return false;
+    }
+
+    bool found = false;
+    portENTER_CRITICAL(&m_mux);
+    uint32_t slot = slotOf(ptr);
+    while (m_table[slot].address) {
+        if (m_table[slot].address == ptr) {
+            if (info) {
+                *info = m_table[slot];
+            }
+            found = true;
+            break;
+        }
+        slot = (slot + 1) & m_mask;
+    }
+    portEXIT_CRITICAL(&m_mux);
+    return found;
+}
+
+bool PSRAMAllocTracker::findByTask(uint16_t taskTag, PSRAMBlockInfo* info) const {
+    if (!m_table) {
+        return false;
+    }
+
+    bool found = false;
+    portENTER_CRITICAL(&m_mux);
+    for (uint32_t i = 0; i <= m_mask; i++) {
+        if (m_table[i].address && m_table[i].taskTag == taskTag) {
+            *info = m_table[i];
+            found = true;
+            break;
+        }
+    }
+    portEXIT_CRITICAL(&m_mux);
+    return found;
+}
+
+uint32_t PSRAMAllocTracker::snapshot(PSRAMBlockInfo* out, uint32_t max) const {
+    uint32_t cursor = 0;
+    return snapshotFrom(&cursor, out, max);
+}
+
+uint32_t PSRAMAllocTracker::snapshotFrom(uint32_t* cursor, PSRAMBlockInfo* out, uint32_t max) const {
+    if (!m_table || !out || !cursor) {
+        return 0;
+    }
+
+    uint32_t n = 0;
+    uint32_t i = *cursor;
+    portENTER_CRITICAL(&m_mux);
+    for (; i <= m_mask && n < max; i++) {
+        if (m_table[i].address) {
+            out[n++] = m_table[i];
+        }
+    }
+    portEXIT_CRITICAL(&m_mux);
+    *cursor = i;
+    return n;
+}
+
+void PSRAMAllocTracker::getStats(AllocTrackerStats* stats) const {
+    if (!stats) {
+        return;
+    }
+
+    portENTER_CRITICAL(&m_mux);
+    stats->capacity = m_table ? m_mask + 1 : 0;
+    stats->count = m_count;
+    stats->peak = m_peak;
+    stats->maxProbe = m_maxProbe;
+    stats->dropped = m_dropped;
+    stats->tags = m_tagCount;
+    stats->tagOverflows = m_tagOverflows;
+    portEXIT_CRITICAL(&m_mux);
+}
@@ -0,0 +1,156 @@
+/*
+ * PSRAMAllocTracker.h - PSRAM分配跟踪表头文件
+ * ESP32S3监控项目 - PSRAM内存管理模块
+ *
+ * 功能特性：
+ * - 固定容量的开放寻址哈希表（线性探测，删除时后移补位，不留墓碑），按地址记录每次分配
+ * - 任务名和用途字符串驻留为整数标签，记录中只保存标签ID
+ * - 哈希表和标签字符串区在init时一次性分配到PSRAM，之后插入/删除/查找不访问堆
+ * - 表满或标签区满时计数并降级（不记录/归入"其他"标签），分配本身不受影响
+ *
+ * 临界区只有固定长度的探测，使用自旋锁，任意任务可调用
+ */
+
+#ifndef PSRAM_ALLOC_TRACKER_H
+#define PSRAM_ALLOC_TRACKER_H
+
+#include <stdint.h>
+#include <stddef.h>
+#include "freertos/FreeRTOS.h"
+
+#define ALLOC_TRACKER_CAPACITY      1024    // 跟踪表容量（2的幂，装载率超过75%后新分配不再记录）
+#define ALLOC_TAG_MAX               128     // 最多驻留的标签数
+#define ALLOC_TAG_ARENA_BYTES       4096    // 标签字符串区大小
+
+#define ALLOC_TAG_NONE              0       // 未指定
+#define ALLOC_TAG_OTHER             1       // 标签区已满时的归类
+
+/**
+ * @brief PSRAM分配块信息（跟踪表记录）
+ */
+struct PSRAMBlockInfo {
+    void* address;          ///< 内存块地址
+    uint32_t size;          ///< 内存块大小
+    uint32_t allocTime;     ///< 分配时间戳（毫秒）
+    uint16_t taskTag;       ///< 分配任务名标签
+    uint16_t purposeTag;    ///< 分配用途标签
+    uint8_t pool;           ///< 内存池类型（PSRAMPoolType）
+    uint8_t memClass;       ///< 实际放置的内存类别（MemClass）
+};
+
+/**
+ * @brief 跟踪表统计
+ */
+struct AllocTrackerStats {
+    uint32_t capacity;      ///< 表容量
+    uint32_t count;         ///< 当前记录数
+    uint32_t peak;          ///< 峰值记录数
+    uint32_t maxProbe;      ///< 插入时的最大探测长度
+    uint32_t dropped;       ///< 表满未记录的分配数
+    uint16_t tags;          ///< 已驻留标签数
+    uint16_t tagOverflows;  ///< 标签区满归入"其他"的次数
+};
+
+/**
+ * @brief PSRAM分配跟踪表
+ */
+class PSRAMAllocTracker {
+public:
+    PSRAMAllocTracker();
+    ~PSRAMAllocTracker();
+
+    /**
+     * @brief 分配哈希表和标签区
+     *
+     * @param capacity 表容量（向上取整为2的幂）
+     * @param caps 分配能力（设备上为MALLOC_CAP_SPIRAM）
+     */
+    bool init(uint32_t capacity, uint32_t caps);
+
+    bool isInitialized() const { return m_table != nullptr; }
+
+    /**
+     * @brief 驻留字符串并返回标签ID（相同内容返回相同ID）
+     *
+     * @param name 字符串，nullptr或空串返回ALLOC_TAG_NONE
+     */
+    uint16_t internTag(const char* name);
+
+    /**
+     * @brief 标签ID对应的字符串
+     */
+    const char* tagName(uint16_t tag) const;
+
+    /**
+     * @brief 记录一次分配
+     *
+     * @return true 已记录，false 表已满（计入dropped）
+     */
+    bool insert(const PSRAMBlockInfo& info);
+
+    /**
+     * @brief 删除记录
+     *
+     * @param ptr 内存块地址
+     * @param removed 返回被删除的记录，可为nullptr
+     * @return true 找到并删除，false 没有记录
+     */
+    bool remove(void* ptr, PSRAMBlockInfo* removed);
+
+    /**
+     * @brief 查找记录
+     */
+    bool find(void* ptr, PSRAMBlockInfo* info) const;
+
+    /**
+     * @brief 查找第一条指定任务标签的记录（批量释放用）
+     */
+    bool findByTask(uint16_t taskTag, PSRAMBlockInfo* info) const;
+
+    /**
+     * @brief 复制所有记录（报告用）
+     *
+     * @param out 输出数组
+     * @param max 输出数组容量
+     * @return 复制的记录数
+     */
+    uint32_t snapshot(PSRAMBlockInfo* out, uint32_t max) const;
+
+    /**
+     * @brief 从槽位游标处继续复制记录（分批遍历整张表，每批只短暂加锁）
+     *
+     * @param cursor 起始槽位，返回时指向下一批的起点；遍历结束时返回0条
+     */
+    uint32_t snapshotFrom(uint32_t* cursor, PSRAMBlockInfo* out, uint32_t max) const;
+
+    uint32_t count() const { return m_count; }
+
+    void getStats(AllocTrackerStats* stats) const;
+
+private:
+    struct TagSlot {
+        uint32_t hash;
+        uint16_t tag;       ///< 0表示空槽
+    };
+
+    PSRAMBlockInfo* m_table;    ///< address为nullptr表示空槽
+    uint32_t m_mask;
+    uint32_t m_count;
+    uint32_t m_peak;
+    uint32_t m_maxProbe;
+    uint32_t m_dropped;
+
+    char* m_tagArena;
+    uint16_t m_tagArenaUsed;
+    uint16_t m_tagOffsets[ALLOC_TAG_MAX];   ///< 标签ID -> 字符串区偏移
+    TagSlot m_tagIndex[ALLOC_TAG_MAX * 2];  ///< 字符串哈希 -> 标签ID
+    uint16_t m_tagCount;
+    uint16_t m_tagOverflows;
+
+    mutable portMUX_TYPE m_mux;
+
+    uint32_t slotOf(const void* ptr) const;
+    static uint32_t hashString(const char* s);
+};
+
+#endif // PSRAM_ALLOC_TRACKER_H
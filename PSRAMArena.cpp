@@ -0,0 +1,262 @@
+/*
+ * PSRAMArena.cpp - 任务级PSRAM临时内存区实现文件
+ * ESP32S3监控项目 - PSRAM内存管理模块
+ */
+
+#include "PSRAMArena.h"
+#include "PSRAMManager.h"
+#include <string.h>
+#include <stdlib.h>
+
+// 每次分配前的大小头，realloc据此复制旧数据
+struct alignas(PSRAM_ARENA_ALIGNMENT) ArenaAllocHeader {
+    uint32_t size;
+};
+
+static inline uint32_t arenaAlign(size_t size) {
+    return (uint32_t)((size + PSRAM_ARENA_ALIGNMENT - 1) & ~(size_t)(PSRAM_ARENA_ALIGNMENT - 1));
+}
+
+PSRAMArena::PSRAMArena()
+    : m_manager(nullptr)
+    , m_chunkBytes(PSRAM_ARENA_CHUNK_BYTES)
+    , m_head(nullptr)
+    , m_last(nullptr)
+    , m_used(0)
+    , m_peak(0)
+    , m_allocs(0)
+    , m_chunkAllocs(0)
+    , m_resets(0)
+    , m_depth(0) {
+}
+
+PSRAMArena::~PSRAMArena() {
+    release();
+}
+
+void PSRAMArena::init(PSRAMManager* manager, uint32_t chunkBytes) {
+    release();
+    // 槽位可能来自被强制删除的任务，作用域深度和峰值按新任务重新计算
+    m_peak = 0;
+    m_allocs = 0;
+    m_chunkAllocs = 0;
+    m_resets = 0;
+    m_depth = 0;
+    m_manager = manager;
+    m_chunkBytes = chunkBytes > sizeof(Chunk) * 2 ? chunkBytes : PSRAM_ARENA_CHUNK_BYTES;
+}
+
+PSRAMArena::Chunk* PSRAMArena::newChunk(uint32_t size) {
+    // size为数据区大小，内存块总大小 = 头 + 数据区
+    size_t total = sizeof(Chunk) + size;
+    Chunk* chunk;
+    if (m_manager) {
+        chunk = (Chunk*)m_manager->allocate(total, "任务临时内存区", POOL_BUFFER);
+    } else {
+        chunk = (Chunk*)heap_caps_malloc(total, MALLOC_CAP_SPIRAM);
+    }
+    if (!chunk) {
+        return nullptr;
+    }
+
+    chunk->next = m_head;
+    chunk->size = size;
+    chunk->used = 0;
+    m_head = chunk;
+    m_chunkAllocs++;
+    return chunk;
+}
+
+void PSRAMArena::freeChunk(Chunk* chunk) {
+    if (m_manager) {
+        m_manager->deallocate(chunk);
+    } else {
+        heap_caps_free(chunk);
+    }
+}
+
+void* PSRAMArena::alloc(size_t size) {
+    uint32_t need = sizeof(ArenaAllocHeader) + arenaAlign(size ? size : 1);
+
+    if (!m_head || m_head->used + need > m_head->size) {
+        // 当前块剩余空间不足，申请新块（大对象单独成块）
+        uint32_t dataSize = m_chunkBytes - sizeof(Chunk);
+        if (need > dataSize) {
+            dataSize = need;
+        }
+        if (!newChunk(dataSize)) {
+            return nullptr;
+        }
+    }
+
+    uint8_t* p = dataOf(m_head) + m_head->used;
+    ((ArenaAllocHeader*)p)->size = (uint32_t)size;
+    m_head->used += need;
+    m_used += need;
+    if (m_used > m_peak) {
+        m_peak = m_used;
+    }
+    m_allocs++;
+
+    m_last = p + sizeof(ArenaAllocHeader);
+    return m_last;
+}
+
+void* PSRAMArena::realloc(void* ptr, size_t size) {
+    if (!ptr) {
+        return alloc(size);
+    }
+
+    ArenaAllocHeader* header = (ArenaAllocHeader*)((uint8_t*)ptr - sizeof(ArenaAllocHeader));
+    uint32_t oldSize = header->size;
+
+    // 最近一次分配且位于当前块末尾：原地调整
+    if (ptr == m_last) {
+        uint32_t oldNeed = arenaAlign(oldSize ? oldSize : 1);
+        uint32_t newNeed = arenaAlign(size ? size : 1);
+        if (m_head->used - oldNeed + newNeed <= m_head->size) {
+            m_head->used = m_head->used - oldNeed + newNeed;
+            m_used = m_used - oldNeed + newNeed;
+            if (m_used > m_peak) {
+                m_peak = m_used;
+            }
+            header->size = (uint32_t)size;
+            return ptr;
+        }
+    }
+
+    // 缩小直接复用原地址，空间在作用域结束时回收
+    if (size <= oldSize) {
+        return ptr;
+    }
+
+    void* p = alloc(size);
+    if (p) {
+        memcpy(p, ptr, oldSize);
+    }
+    return p;
+}
+
+bool PSRAMArena::owns(const void* ptr) const {
+    for (Chunk* c = m_head; c; c = c->next) {
+        const uint8_t* data = dataOf(c);
+        if ((const uint8_t*)ptr >= data && (const uint8_t*)ptr < data + c->size) {
+            return true;
+        }
+    }
+    return false;
+}
+
+PSRAMArena::Mark PSRAMArena::mark() {
+    Mark m;
+    m.chunk = m_head;
+    m.used = m_head ? m_head->used : 0;
+    return m;
+}
+
+void PSRAMArena::rewind(const Mark& mark) {
+    // 释放标记之后申请的块；标记时还没有块的，保留最早的一块供下次使用
+    while (m_head && m_head != mark.chunk) {
+        if (!mark.chunk && !m_head->next) {
+            m_head->used = 0;
+            break;
+        }
+        Chunk* next = m_head->next;
+        freeChunk(m_head);
+        m_head = next;
+    }
+    if (m_head && m_head == mark.chunk) {
+        m_head->used = mark.used;
+    }
+
+    m_used = 0;
+    for (Chunk* c = m_head; c; c = c->next) {
+        m_used += c->used;
+    }
+    m_last = nullptr;
+
+    if (m_depth > 0) {
+        return;
+    }
+
+    // 回到最外层：峰值超过第一块容量时按峰值换成更大的块，下次请求不再申请新块
+    m_resets++;
+    if (m_head && !m_head->next && m_head->used == 0 && m_peak > m_head->size &&
+        m_head->size + sizeof(Chunk) < PSRAM_ARENA_MAX_CHUNK_BYTES) {
+        uint32_t total = (m_peak + sizeof(Chunk) + 4095) & ~4095u;
+        if (total > PSRAM_ARENA_MAX_CHUNK_BYTES) {
+            total = PSRAM_ARENA_MAX_CHUNK_BYTES;
+        }
+        Chunk* old = m_head;
+        m_head = nullptr;
+        freeChunk(old);
+        newChunk(total - sizeof(Chunk));
+    }
+}
+
+void PSRAMArena::release() {
+    while (m_head) {
+        Chunk* next = m_head->next;
+        freeChunk(m_head);
+        m_head = next;
+    }
+    m_used = 0;
+    m_last = nullptr;
+}
+
+void PSRAMArena::getStats(PSRAMArenaStats* stats) const {
+    if (!stats) {
+        return;
+    }
+
+    memset(stats, 0, sizeof(PSRAMArenaStats));
+    for (Chunk* c = m_head; c; c = c->next) {
+        stats->capacity += c->size;
+        stats->chunks++;
+    }
+    stats->used = m_used;
+    stats->peak = m_peak;
+    stats->allocs = m_allocs;
+    stats->chunkAllocs = m_chunkAllocs;
+    stats->resets = m_resets;
+    stats->depth = m_depth;
+}
+
+void* ArenaJsonAllocator::allocate(size_t size) {
+    void* p = arena ? arena->alloc(size) : nullptr;
+    return p ? p : malloc(size);
+}
+
+void ArenaJsonAllocator::deallocate(void* ptr) {
+    // 内存区中的地址在作用域结束时统一回收
+    if (arena && arena->owns(ptr)) {
+        return;
+    }
+    free(ptr);
+}
+
+void* ArenaJsonAllocator::reallocate(void* ptr, size_t size) {
+    if (arena && ptr && arena->owns(ptr)) {
+        return arena->realloc(ptr, size);
+    }
+    return realloc(ptr, size);
+}
+
+PSRAMArenaScope::PSRAMArenaScope(PSRAMManager* manager)
+    : m_arena(manager ? manager->getTaskArena() : nullptr) {
+    if (m_arena) {
+        m_mark = m_arena->mark();
+        m_arena->m_depth++;
+    }
+}
+
+PSRAMArenaScope::~PSRAMArenaScope() {
+    if (m_arena) {
+        m_arena->m_depth--;
+        m_arena->rewind(m_mark);
+    }
+}
+
+void* PSRAMArenaScope::alloc(size_t size) {
+    return m_arena ? m_arena->alloc(size) : nullptr;
+}
@@ -0,0 +1,159 @@
+/*
+ * PSRAMArena.h - 任务级PSRAM临时内存区头文件
+ * ESP32S3监控项目 - PSRAM内存管理模块
+ *
+ * 功能特性：
+ * - 顺序分配（bump）内存区，内存块从PSRAMManager申请，单个对象不单独释放
+ * - PSRAMArenaScope在构造时记录位置、析构时回退，作用域内的所有临时对象一次性释放
+ * - 作用域可以嵌套；回到最外层时只保留第一块，并按峰值扩大，稳态下每次请求不再申请内存
+ * - ArenaJsonAllocator适配ArduinoJson的分配器接口，ArenaJsonDocument可直接替换DynamicJsonDocument
+ *
+ * 每个任务使用自己的内存区（PSRAMManager::getTaskArena），内存区本身不加锁
+ */
+
+#ifndef PSRAM_ARENA_H
+#define PSRAM_ARENA_H
+
+#include <stdint.h>
+#include <stddef.h>
+#include <ArduinoJson.h>
+
+class PSRAMManager;
+
+#define PSRAM_ARENA_CHUNK_BYTES     (16 * 1024)     // 默认内存块大小
+#define PSRAM_ARENA_MAX_CHUNK_BYTES (64 * 1024)     // 回到最外层时第一块最多扩大到的大小
+#define PSRAM_ARENA_ALIGNMENT       8               // 分配对齐
+
+/**
+ * @brief 内存区统计
+ */
+struct PSRAMArenaStats {
+    uint32_t capacity;          ///< 当前所有内存块的容量
+    uint32_t used;              ///< 当前已分配字节
+    uint32_t peak;              ///< 一次作用域内的峰值字节
+    uint32_t allocs;            ///< 分配次数
+    uint32_t chunkAllocs;       ///< 向PSRAMManager申请内存块的次数
+    uint32_t resets;            ///< 回到最外层的次数
+    uint16_t chunks;            ///< 当前内存块数
+    uint16_t depth;             ///< 当前作用域嵌套深度
+};
+
+/**
+ * @brief 顺序分配内存区
+ */
+class PSRAMArena {
+public:
+    /**
+     * @brief 分配位置（用于回退）
+     */
+    struct Mark {
+        void* chunk;
+        uint32_t used;
+    };
+
+    PSRAMArena();
+    ~PSRAMArena();
+
+    /**
+     * @brief 设置内存块来源（manager为nullptr时使用PSRAM系统堆）
+     */
+    void init(PSRAMManager* manager, uint32_t chunkBytes = PSRAM_ARENA_CHUNK_BYTES);
+
+    /**
+     * @brief 分配size字节（按PSRAM_ARENA_ALIGNMENT对齐）
+     *
+     * @return 地址；内存块申请失败时返回nullptr
+     */
+    void* alloc(size_t size);
+
+    /**
+     * @brief 调整分配大小：最近一次分配原地调整，缩小直接返回原地址，其他情况重新分配并复制
+     */
+    void* realloc(void* ptr, size_t size);
+
+    /**
+     * @brief 地址是否位于本内存区的内存块中
+     */
+    bool owns(const void* ptr) const;
+
+    Mark mark();
+    void rewind(const Mark& mark);
+
+    /**
+     * @brief 释放所有内存块
+     */
+    void release();
+
+    void getStats(PSRAMArenaStats* stats) const;
+
+private:
+    struct alignas(PSRAM_ARENA_ALIGNMENT) Chunk {
+        Chunk* next;            ///< 更早申请的内存块
+        uint32_t size;          ///< 数据区大小
+        uint32_t used;
+    };
+
+    PSRAMManager* m_manager;
+    uint32_t m_chunkBytes;
+    Chunk* m_head;              ///< 当前内存块（链表头为最新）
+    void* m_last;               ///< 最近一次分配的地址（realloc原地调整用）
+    uint32_t m_used;
+    uint32_t m_peak;
+    uint32_t m_allocs;
+    uint32_t m_chunkAllocs;
+    uint32_t m_resets;
+    uint16_t m_depth;
+
+    friend class PSRAMArenaScope;
+
+    Chunk* newChunk(uint32_t size);
+    void freeChunk(Chunk* chunk);
+    static uint8_t* dataOf(Chunk* chunk) { return (uint8_t*)(chunk + 1); }
+};
+
+/**
+ * @brief ArduinoJson分配器适配（内存区不可用时回退到malloc）
+ */
+struct ArenaJsonAllocator {
+    PSRAMArena* arena;
+
+    ArenaJsonAllocator(PSRAMArena* a = nullptr) : arena(a) {}
+
+    void* allocate(size_t size);
+    void deallocate(void* ptr);
+    void* reallocate(void* ptr, size_t size);
+};
+
+typedef BasicJsonDocument<ArenaJsonAllocator> ArenaJsonDocument;
+
+/**
+ * @brief 内存区作用域：析构时回退到构造时的位置
+ */
+class PSRAMArenaScope {
+public:
+    /**
+     * @brief 使用当前任务的内存区
+     *
+     * @param manager PSRAM管理器，为nullptr或内存区不可用时退化为堆分配
+     */
+    explicit PSRAMArenaScope(PSRAMManager* manager);
+    ~PSRAMArenaScope();
+
+    /**
+     * @brief 在作用域内分配临时内存（内存区不可用时返回nullptr）
+     */
+    void* alloc(size_t size);
+
+    ArenaJsonAllocator jsonAllocator() const { return ArenaJsonAllocator(m_arena); }
+
+    PSRAMArena* arena() const { return m_arena; }
+
+private:
+    PSRAMArena* m_arena;
+    PSRAMArena::Mark m_mark;
+
+    PSRAMArenaScope(const PSRAMArenaScope&);
+    PSRAMArenaScope& operator=(const PSRAMArenaScope&);
+};
+
+#endif // PSRAM_ARENA_H
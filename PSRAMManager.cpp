@@ -5,6 +5,47 @@
 
 #include "PSRAMManager.h"
 #include <ArduinoJson.h>
+#include "esp_memory_utils.h"
+
+// 各内存池的级别布局（按块大小升序，百分比之和为100）
+static const SlabClassLayout POOL_LAYOUT_GENERAL[] = {
+    {64, 10}, {256, 20}, {1024, 30}, {4096, 40}
+};
+static const SlabClassLayout POOL_LAYOUT_GRAPHICS[] = {
+    {4096, 25}, {16384, 35}, {65536, 40}
+};
+static const SlabClassLayout POOL_LAYOUT_BUFFER[] = {
+    {1024, 10}, {4096, 30}, {16384, 30}, {65536, 30}
+};
+// 任务栈按栈大小取整到级别，9KB的显示任务栈使用16KB块
+static const SlabClassLayout POOL_LAYOUT_TASK_STACK[] = {
+    {4096, 25}, {8192, 25}, {16384, 50}
+};
+
+struct PoolLayout {
+    const SlabClassLayout* classes;
+    uint8_t count;
+    size_t defaultBytes;
+};
+
+// 各放置策略依次尝试的内存类别（MEM_CLASS_INTERNAL按能力需求落到内部/DMA/可执行内存，MEM_CLASS_COUNT表示结束）
+static const MemClass PLACEMENT_CHAINS[][3] = {
+    {MEM_CLASS_PSRAM_POOL, MEM_CLASS_PSRAM_HEAP, MEM_CLASS_INTERNAL},   // MEM_PREFER_PSRAM
+    {MEM_CLASS_INTERNAL, MEM_CLASS_PSRAM_POOL, MEM_CLASS_PSRAM_HEAP},   // MEM_PREFER_INTERNAL
+    {MEM_CLASS_PSRAM_POOL, MEM_CLASS_PSRAM_HEAP, MEM_CLASS_COUNT},      // MEM_PSRAM_ONLY
+    {MEM_CLASS_INTERNAL, MEM_CLASS_COUNT, MEM_CLASS_COUNT}              // MEM_INTERNAL_ONLY
+};
+
+static inline bool isPSRAMClass(uint8_t memClass) {
+    return memClass == MEM_CLASS_PSRAM_POOL || memClass == MEM_CLASS_PSRAM_HEAP;
+}
+
+static const PoolLayout POOL_LAYOUTS[POOL_COUNT] = {
+    {POOL_LAYOUT_GENERAL, sizeof(POOL_LAYOUT_GENERAL) / sizeof(SlabClassLayout), PSRAM_POOL_GENERAL_BYTES},
+    {POOL_LAYOUT_GRAPHICS, sizeof(POOL_LAYOUT_GRAPHICS) / sizeof(SlabClassLayout), PSRAM_POOL_GRAPHICS_BYTES},
+    {POOL_LAYOUT_BUFFER, sizeof(POOL_LAYOUT_BUFFER) / sizeof(SlabClassLayout), PSRAM_POOL_BUFFER_BYTES},
+    {POOL_LAYOUT_TASK_STACK, sizeof(POOL_LAYOUT_TASK_STACK) / sizeof(SlabClassLayout), PSRAM_POOL_TASK_STACK_BYTES}
+};
 
 PSRAMManager::PSRAMManager() 
     : m_initialized(false)
@@ -12,14 +53,30 @@ PSRAMManager::PSRAMManager()
     , m_debugMode(false)
     , m_monitorTaskHandle(nullptr)
     , m_mutex(nullptr)
-    , m_monitorCallback(nullptr) {
+    , m_untrackedCount(0)
+    , m_defaultPurposeTag(ALLOC_TAG_NONE)
+    , m_alignedPurposeTag(ALLOC_TAG_NONE)
+    , m_arenaMux(portMUX_INITIALIZER_UNLOCKED)
+    , m_statsMux(portMUX_INITIALIZER_UNLOCKED)
+    , m_monitorCallback(nullptr)
+    , m_reclaimerCount(0)
+    , m_reclaiming(false)
+    , m_internalLow(MEM_INTERNAL_LOW_WATERMARK)
+    , m_internalCritical(MEM_INTERNAL_CRITICAL_WATERMARK)
+    , m_psramLow(MEM_PSRAM_LOW_WATERMARK)
+    , m_psramCritical(MEM_PSRAM_CRITICAL_WATERMARK)
+    , m_lastPressureCheck(0)
+    , m_governorMux(portMUX_INITIALIZER_UNLOCKED) {
     
     // 初始化统计信息
     memset(&m_statistics, 0, sizeof(PSRAMStatistics));
+    memset(m_classStats, 0, sizeof(m_classStats));
+    memset(m_reclaimers, 0, sizeof(m_reclaimers));
+    memset(&m_governorStats, 0, sizeof(m_governorStats));
     
-    // 初始化内存池
-    for (int i = 0; i < POOL_COUNT; i++) {
-        m_pools[i] = MemoryPool();
+    for (int i = 0; i < PSRAM_ARENA_MAX_TASKS; i++) {
+        m_taskArenas[i].task = nullptr;
+        m_taskArenas[i].taskTag = ALLOC_TAG_NONE;
     }
     
     printf("[PSRAMManager] PSRAM管理器已创建\n");
@@ -28,13 +85,20 @@ PSRAMManager::PSRAMManager()
 PSRAMManager::~PSRAMManager() {
     stop();
     
-    // 释放所有分配的内存
-    for (auto& block : m_allocatedBlocks) {
-        if (block.isAllocated && block.address) {
-            heap_caps_free(block.address);
+    // 先释放临时内存区的内存块，避免成员析构时重复释放
+    for (int i = 0; i < PSRAM_ARENA_MAX_TASKS; i++) {
+        m_taskArenas[i].arena.release();
+    }
+    
+    // 释放所有分配的内存（池内的块随内存池区域一起释放）
+    PSRAMBlockInfo batch[16];
+    uint32_t n;
+    while ((n = m_tracker.snapshot(batch, 16)) > 0) {
+        for (uint32_t i = 0; i < n; i++) {
+            m_tracker.remove(batch[i].address, nullptr);
+            freeRaw(batch[i].address);
         }
     }
-    m_allocatedBlocks.clear();
     
     // 销毁互斥锁
     if (m_mutex) {
@@ -78,16 +142,30 @@ bool PSRAMManager::init() {
     m_statistics.freeSize = freePsram;
     m_statistics.usedSize = psramSize - freePsram;
     
-    // 不再预分配大内存池，改为按需分配
-    // 初始化内存池结构但不分配实际内存
-    for (int i = 0; i < POOL_COUNT; i++) {
-        m_pools[i].baseAddress = nullptr;
-        m_pools[i].totalSize = 0;
-        m_pools[i].usedSize = 0;
-        m_pools[i].initialized = false;
+    // 分配跟踪表和标签区一次性放入PSRAM，之后记录分配不再访问堆
+    if (m_tracker.init(ALLOC_TRACKER_CAPACITY, MALLOC_CAP_SPIRAM)) {
+        printf("[PSRAMManager] 分配跟踪表创建成功: %u条记录\n", ALLOC_TRACKER_CAPACITY);
+    } else {
+        printf("[PSRAMManager] 分配跟踪表创建失败，分配将不被记录\n");
     }
+    m_defaultPurposeTag = m_tracker.internTag("未指定用途");
+    m_alignedPurposeTag = m_tracker.internTag("对齐内存分配");
     
-    printf("[PSRAMManager] 采用按需分配策略，不预分配内存池\n");
+    // 剖析统计表同样放入PSRAM，在内存池之前创建以便记录全部分配
+    if (m_profiler.init(MALLOC_CAP_SPIRAM)) {
+        printf("[PSRAMManager] 分配剖析器已创建: %s\n", m_profiler.isEnabled() ? "开启" : "关闭");
+    } else {
+        printf("[PSRAMManager] 分配剖析器创建失败，剖析不可用\n");
+    }
+    
+#if PSRAM_POOL_ENABLED
+    // 预分配分级内存池，热点分配路径不再在PSRAM系统堆中产生碎片
+    for (int i = 0; i < POOL_COUNT; i++) {
+        createPool((PSRAMPoolType)i, POOL_LAYOUTS[i].defaultBytes);
+    }
+#else
+    printf("[PSRAMManager] 分级内存池已关闭，所有分配使用PSRAM系统堆\n");
+#endif
     
     m_initialized = true;
     printf("[PSRAMManager] PSRAM管理器初始化完成\n");
@@ -147,128 +225,169 @@ void PSRAMManager::stop() {
 }
 
 void* PSRAMManager::allocate(size_t size, PSRAMPoolType pool) {
-    return allocate(size, "未指定用途", pool);
+    return allocateTagged(size, m_defaultPurposeTag, pool);
+}
+
+void* PSRAMManager::allocate(size_t size, const char* purpose, PSRAMPoolType pool) {
+    return allocateTagged(size, m_tracker.internTag(purpose), pool);
 }
 
 void* PSRAMManager::allocate(size_t size, const String& purpose, PSRAMPoolType pool) {
+    return allocateTagged(size, m_tracker.internTag(purpose.c_str()), pool);
+}
+
+void* PSRAMManager::allocateTagged(size_t size, uint16_t purposeTag, PSRAMPoolType pool) {
+    return allocateCapsTagged(size, MEM_CAP_SPIRAM, purposeTag, 0, MEM_PSRAM_ONLY, pool);
+}
+
+void* PSRAMManager::allocateAligned(size_t size, size_t alignment, PSRAMPoolType pool) {
+    if (alignment == 0) {
+        return nullptr;
+    }
+    
+    // 对齐地址由内存池或heap_caps_aligned_alloc直接给出，记录的键就是释放时使用的地址
+    return allocateCapsTagged(size, MEM_CAP_SPIRAM, m_alignedPurposeTag, alignment, MEM_PSRAM_ONLY, pool);
+}
+
+void* PSRAMManager::allocateCaps(size_t size, uint32_t caps, const char* purpose, size_t alignment,
+                                 MemPlacement placement, PSRAMPoolType pool) {
+    return allocateCapsTagged(size, caps, m_tracker.internTag(purpose), alignment, placement, pool);
+}
+
+void* PSRAMManager::allocateCapsTagged(size_t size, uint32_t caps, uint16_t purposeTag, size_t alignment,
+                                       MemPlacement placement, PSRAMPoolType pool) {
     if (!m_initialized || size == 0) {
         return nullptr;
     }
     
-    if (!takeMutex()) {
-        printf("[PSRAMManager] 获取互斥锁失败\n");
+    if (alignment & (alignment - 1)) {
+        printf("[PSRAMManager] ✗ 对齐必须是2的幂: %u, 用途: %s\n", alignment, m_tracker.tagName(purposeTag));
         return nullptr;
     }
     
-    // 直接从PSRAM分配，不使用内存池
-    void* ptr = heap_caps_malloc(size, MALLOC_CAP_SPIRAM);
+    uint8_t memClass = MEM_CLASS_COUNT;
+    void* ptr = allocateRaw(size, caps, alignment, placement, pool, &memClass);
+    
+#if MEM_GOVERNOR_ENABLED
+    if (!ptr && m_reclaimerCount > 0) {
+        // 分配失败前先按优先级回收可能放置到的内存类型，有释放时重试一次
+        bool internalOnly = (caps & (MEM_CAP_INTERNAL | MEM_CAP_EXEC)) ||
+                            ((caps & MEM_CAP_DMA) && !(caps & MEM_CAP_SPIRAM)) ||
+                            placement == MEM_INTERNAL_ONLY;
+        bool psramOnly = (caps & MEM_CAP_SPIRAM) || placement == MEM_PSRAM_ONLY;
+        uint32_t reclaimCaps = internalOnly ? MEM_CAP_INTERNAL :
+                               psramOnly ? MEM_CAP_SPIRAM : (MEM_CAP_INTERNAL | MEM_CAP_SPIRAM);
+        if (reclaimMemory(size, reclaimCaps, MEM_PRESSURE_CRITICAL) > 0) {
+            ptr = allocateRaw(size, caps, alignment, placement, pool, &memClass);
+            portENTER_CRITICAL(&m_governorMux);
+            m_governorStats.allocRetries++;
+            if (ptr) {
+                m_governorStats.allocRescued++;
+            }
+            portEXIT_CRITICAL(&m_governorMux);
+        }
+    }
+#endif
     
     if (ptr) {
-        // 记录分配信息
-        String taskName = getCurrentTaskName();
-        String poolName = getPoolName(pool);
-        String fullPurpose = poolName + " - " + purpose;
-        
-        m_allocatedBlocks.emplace_back(ptr, size, taskName, fullPurpose);
-        m_ptrSizeMap[ptr] = size;
+        // 记录分配信息（定长记录写入哈希表，表满时只计数）
+        PSRAMBlockInfo info;
+        info.address = ptr;
+        info.size = size;
+        info.allocTime = millis();
+        info.taskTag = getCurrentTaskTag();
+        info.purposeTag = purposeTag;
+        info.pool = pool;
+        info.memClass = memClass;
+        bool tracked = m_tracker.insert(info);
+        if (tracked) {
+            m_profiler.onAlloc(info);
+        }
         
-        // 更新统计信息
+        // 更新统计信息（PSRAMStatistics只统计PSRAM中的分配）
+        portENTER_CRITICAL(&m_statsMux);
+        if (!tracked) {
+            m_untrackedCount++;
+        }
         m_statistics.allocationCount++;
-        m_statistics.usedSize += size;
-        m_statistics.freeSize -= size;
+        if (isPSRAMClass(memClass)) {
+            m_statistics.usedSize += size;
+            m_statistics.freeSize -= size;
+        }
+        // 未记录的块释放时查不到大小和类别，不计入类别统计，否则在用字节永远不会归零
+        if (tracked) {
+            MemClassStats& cls = m_classStats[memClass];
+            cls.allocs++;
+            cls.liveBytes += size;
+            if (cls.liveBytes > cls.peakBytes) {
+                cls.peakBytes = cls.liveBytes;
+            }
+        }
+        portEXIT_CRITICAL(&m_statsMux);
         
         if (m_debugMode) {
-            printf("[PSRAMManager] ✓ 分配PSRAM: %u字节, 任务: %s, 池: %s, 用途: %s\n", 
-                   size, taskName.c_str(), poolName.c_str(), purpose.c_str());
+            printf("[PSRAMManager] ✓ 分配: %u字节, 任务: %s, 类别: %s, 池: %s, 用途: %s\n", 
+                   size, m_tracker.tagName(info.taskTag), getMemClassName((MemClass)memClass),
+                   getPoolName(pool), m_tracker.tagName(purposeTag));
         }
         
-        logAllocation(ptr, size, fullPurpose);
+        logAllocation(ptr, size, purposeTag);
     } else {
-        printf("[PSRAMManager] ✗ PSRAM分配失败: %u字节, 池: %s, 用途: %s\n", size, getPoolName(pool).c_str(), purpose.c_str());
+        printf("[PSRAMManager] ✗ 内存分配失败: %u字节, 能力: 0x%x, 策略: %d, 池: %s, 用途: %s\n",
+               size, caps, placement, getPoolName(pool), m_tracker.tagName(purposeTag));
     }
     
-    giveMutex();
     return ptr;
 }
 
-void* PSRAMManager::allocateAligned(size_t size, size_t alignment, PSRAMPoolType pool) {
-    if (!m_initialized || size == 0 || alignment == 0) {
-        return nullptr;
-    }
-    
-    // 增加对齐所需的额外空间
-    size_t alignedSize = alignSize(size, alignment);
-    void* ptr = allocate(alignedSize, "对齐内存分配", pool);
-    
-    if (ptr) {
-        // 对地址进行对齐
-        void* alignedPtr = alignAddress(ptr, alignment);
-        if (alignedPtr != ptr) {
-            // 如果需要对齐调整，更新记录
-            if (takeMutex()) {
-                for (auto& block : m_allocatedBlocks) {
-                    if (block.address == ptr) {
-                        block.address = alignedPtr;
-                        break;
-                    }
-                }
-                giveMutex();
-            }
-        }
-        return alignedPtr;
-    }
-    
-    return nullptr;
-}
-
 bool PSRAMManager::deallocate(void* ptr) {
     if (!ptr || !m_initialized) {
         return false;
     }
     
-    if (!takeMutex()) {
-        return false;
+    // 查找并移除分配记录
+    PSRAMBlockInfo info;
+    bool found = m_tracker.remove(ptr, &info);
+    size_t size = found ? info.size : 0;
+    if (found) {
+        m_profiler.onFree(info, millis());
     }
     
-    // 查找并移除分配记录
-    bool found = false;
-    size_t size = 0;
-    
-    for (auto it = m_allocatedBlocks.begin(); it != m_allocatedBlocks.end(); ++it) {
-        if (it->address == ptr) {
-            size = it->size;
-            m_allocatedBlocks.erase(it);
-            found = true;
-            break;
+    if (!found) {
+        // 跟踪表满时未记录的块：只接受PSRAM或内部RAM中的地址
+        bool untracked = false;
+        portENTER_CRITICAL(&m_statsMux);
+        if (m_untrackedCount > 0 && (esp_ptr_external_ram(ptr) || esp_ptr_internal(ptr))) {
+            m_untrackedCount--;
+            untracked = true;
+        }
+        portEXIT_CRITICAL(&m_statsMux);
+        if (!untracked) {
+            return false;
         }
     }
     
-    auto sizeIt = m_ptrSizeMap.find(ptr);
-    if (sizeIt != m_ptrSizeMap.end()) {
-        if (!found) {
-            size = sizeIt->second;
-            found = true;
+    freeRaw(ptr);
+    
+    // 更新统计信息
+    portENTER_CRITICAL(&m_statsMux);
+    m_statistics.freeCount++;
+    if (found && info.memClass < MEM_CLASS_COUNT) {
+        if (isPSRAMClass(info.memClass)) {
+            m_statistics.usedSize -= size;
+            m_statistics.freeSize += size;
         }
-        m_ptrSizeMap.erase(sizeIt);
+        m_classStats[info.memClass].frees++;
+        m_classStats[info.memClass].liveBytes -= size;
     }
+    portEXIT_CRITICAL(&m_statsMux);
     
-    if (found) {
-        heap_caps_free(ptr);
-        
-        // 更新统计信息
-        m_statistics.freeCount++;
-        m_statistics.usedSize -= size;
-        m_statistics.freeSize += size;
-        
-        if (m_debugMode) {
-            printf("[PSRAMManager] 释放PSRAM: %u字节\n", size);
-        }
-        
-        logDeallocation(ptr);
+    if (m_debugMode) {
+        printf("[PSRAMManager] 释放PSRAM: %u字节\n", size);
     }
     
-    giveMutex();
-    return found;
+    logDeallocation(ptr);
+    return true;
 }
 
 bool PSRAMManager::deallocateAll(const String& taskName) {
@@ -276,51 +395,53 @@ bool PSRAMManager::deallocateAll(const String& taskName) {
         return false;
     }
     
-    if (!takeMutex()) {
-        return false;
-    }
-    
-    std::vector<void*> ptrsToFree;
-    
-    // 查找指定任务分配的所有内存块
-    for (const auto& block : m_allocatedBlocks) {
-        if (block.taskName == taskName && block.isAllocated) {
-            ptrsToFree.push_back(block.address);
-        }
-    }
-    
-    giveMutex();
+    uint16_t taskTag = m_tracker.internTag(taskName.c_str());
     
-    // 释放找到的内存块
+    // 逐个查找并释放指定任务分配的内存块
     bool allFreed = true;
-    for (void* ptr : ptrsToFree) {
-        if (!deallocate(ptr)) {
+    uint32_t freed = 0;
+    PSRAMBlockInfo block;
+    while (m_tracker.findByTask(taskTag, &block)) {
+        if (!deallocate(block.address)) {
             allFreed = false;
+            break;
         }
+        freed++;
     }
     
     printf("[PSRAMManager] 释放任务 %s 的PSRAM内存: %u个块\n", 
-           taskName.c_str(), ptrsToFree.size());
+           taskName.c_str(), freed);
     
     return allFreed;
 }
 
 void* PSRAMManager::allocateForTask(size_t size, const String& taskName, const String& purpose) {
-    String fullPurpose = taskName + " - " + purpose;
-    return allocate(size, fullPurpose, POOL_GENERAL);
+    void* ptr = allocate(size, purpose, POOL_GENERAL);
+    
+    // 记录归属任务，以便deallocateAll按任务释放
+    PSRAMBlockInfo info;
+    if (ptr && m_tracker.remove(ptr, &info)) {
+        uint16_t taskTag = m_tracker.internTag(taskName.c_str());
+        m_profiler.moveTask(info, taskTag);
+        info.taskTag = taskTag;
+        m_tracker.insert(info);
+    }
+    return ptr;
 }
 
 void* PSRAMManager::allocateGraphicsBuffer(size_t width, size_t height, size_t bytesPerPixel) {
     size_t bufferSize = width * height * bytesPerPixel;
-    String purpose = "图形缓冲区 " + String(width) + "x" + String(height) + "x" + String(bytesPerPixel);
     
     // 图形缓冲区需要对齐到32字节边界以优化DMA传输
     return allocateAligned(bufferSize, 32, POOL_GRAPHICS);
 }
 
-void* PSRAMManager::allocateDataBuffer(size_t size, const String& purpose) {
-    String fullPurpose = "数据缓冲区 - " + purpose;
-    return allocate(size, fullPurpose, POOL_BUFFER);
+void* PSRAMManager::allocateDataBuffer(size_t size, const char* purpose) {
+    return allocate(size, purpose, POOL_BUFFER);
+}
+
+void* PSRAMManager::allocateDMABuffer(size_t size, const char* purpose) {
+    return allocateCaps(size, MEM_CAP_DMA, purpose, 0, MEM_INTERNAL_ONLY);
 }
 
 TaskHandle_t PSRAMManager::createTaskWithPSRAMStack(TaskFunction_t taskFunction, 
@@ -346,7 +467,8 @@ TaskHandle_t PSRAMManager::createTaskWithPSRAMStack(TaskFunction_t taskFunction,
     
     // 任务控制块必须分配在内部SRAM中，不能放在PSRAM中！
     // 因为FreeRTOS调度器需要快速访问TCB
-    StaticTask_t* taskBuffer = (StaticTask_t*)heap_caps_malloc(sizeof(StaticTask_t), MALLOC_CAP_INTERNAL);
+    StaticTask_t* taskBuffer = (StaticTask_t*)allocateCaps(sizeof(StaticTask_t), MEM_CAP_INTERNAL, "任务控制块(SRAM)",
+                                                           0, MEM_INTERNAL_ONLY);
     if (!taskBuffer) {
         deallocate(stackBuffer);
         printf("[PSRAMManager] 为任务 %s 分配SRAM控制块失败\n", taskName);
@@ -369,17 +491,10 @@ TaskHandle_t PSRAMManager::createTaskWithPSRAMStack(TaskFunction_t taskFunction,
     
     if (taskHandle) {
         printf("[PSRAMManager] ✓ 成功创建PSRAM任务: %s (栈: %u字节在PSRAM)\n", taskName, alignedStackSize * sizeof(StackType_t));
-        
-        // 记录任务控制块，以便后续清理
-        if (takeMutex()) {
-            String tcbPurpose = String(taskName) + " - TCB(SRAM)";
-            m_allocatedBlocks.emplace_back(taskBuffer, sizeof(StaticTask_t), getCurrentTaskName(), tcbPurpose);
-            giveMutex();
-        }
     } else {
         printf("[PSRAMManager] ✗ 创建PSRAM任务失败: %s\n", taskName);
         deallocate(stackBuffer);
-        heap_caps_free(taskBuffer);
+        deallocate(taskBuffer);
     }
     
     return taskHandle;
@@ -392,7 +507,9 @@ bool PSRAMManager::isPSRAMAvailable() const {
 PSRAMStatistics PSRAMManager::getStatistics() {
     if (takeMutex()) {
         updateStatistics();
+        portENTER_CRITICAL(&m_statsMux);
         PSRAMStatistics stats = m_statistics;
+        portEXIT_CRITICAL(&m_statsMux);
         giveMutex();
         return stats;
     }
@@ -430,35 +547,103 @@ float PSRAMManager::getFragmentationRate() const {
 }
 
 std::vector<PSRAMBlockInfo> PSRAMManager::getAllocatedBlocks() {
-    std::vector<PSRAMBlockInfo> blocks;
-    
-    if (takeMutex()) {
-        blocks = m_allocatedBlocks;
-        giveMutex();
-    }
-    
+    // 仅用于报告：按当前记录数预留空间后复制，期间新增的记录可能不在结果中
+    std::vector<PSRAMBlockInfo> blocks(m_tracker.count() + 16);
+    blocks.resize(m_tracker.snapshot(blocks.data(), blocks.size()));
     return blocks;
 }
 
-PSRAMBlockInfo* PSRAMManager::getBlockInfo(void* ptr) {
-    if (!ptr || !takeMutex()) {
+bool PSRAMManager::getBlockInfo(void* ptr, PSRAMBlockInfo* info) const {
+    return m_tracker.find(ptr, info);
+}
+
+uint32_t PSRAMManager::getBlockCount() const {
+    return m_tracker.count();
+}
+
+void PSRAMManager::getTrackerStats(AllocTrackerStats* stats) const {
+    m_tracker.getStats(stats);
+}
+
+uint16_t PSRAMManager::internTag(const char* name) {
+    return m_tracker.internTag(name);
+}
+
+const char* PSRAMManager::getTagName(uint16_t tag) const {
+    return m_tracker.tagName(tag);
+}
+
+PSRAMArena* PSRAMManager::getTaskArena() {
+    if (!m_initialized) {
         return nullptr;
     }
     
-    PSRAMBlockInfo* info = nullptr;
-    for (auto& block : m_allocatedBlocks) {
-        if (block.address == ptr) {
-            info = &block;
+    TaskHandle_t current = xTaskGetCurrentTaskHandle();
+    if (!current) {
+        return nullptr;
+    }
+    
+    int claimed = -1;
+    portENTER_CRITICAL(&m_arenaMux);
+    for (int i = 0; i < PSRAM_ARENA_MAX_TASKS; i++) {
+        if (m_taskArenas[i].task == current) {
+            portEXIT_CRITICAL(&m_arenaMux);
+            return &m_taskArenas[i].arena;
+        }
+    }
+    for (int i = 0; i < PSRAM_ARENA_MAX_TASKS; i++) {
+        if (!m_taskArenas[i].task) {
+            m_taskArenas[i].task = current;
+            claimed = i;
             break;
         }
     }
+    portEXIT_CRITICAL(&m_arenaMux);
     
-    giveMutex();
-    return info;
+    if (claimed < 0) {
+        // 槽位用完时调用方退化为堆分配
+        return nullptr;
+    }
+    
+    TaskArenaSlot& slot = m_taskArenas[claimed];
+    slot.taskTag = getCurrentTaskTag();
+    slot.arena.init(this);
+    printf("[PSRAMManager] 为任务 %s 创建临时内存区\n", m_tracker.tagName(slot.taskTag));
+    return &slot.arena;
 }
 
-uint32_t PSRAMManager::getBlockCount() const {
-    return m_allocatedBlocks.size();
+void PSRAMManager::releaseTaskArena(TaskHandle_t task, bool taskDeleted) {
+    if (!task) {
+        return;
+    }
+    
+    // 槽位的任务句柄由其他任务在锁内认领和清除，查找同样要在锁内
+    int index = -1;
+    portENTER_CRITICAL(&m_arenaMux);
+    for (int i = 0; i < PSRAM_ARENA_MAX_TASKS; i++) {
+        if (m_taskArenas[i].task == task) {
+            index = i;
+            break;
+        }
+    }
+    portEXIT_CRITICAL(&m_arenaMux);
+    if (index < 0) {
+        return;
+    }
+    
+    TaskArenaSlot& slot = m_taskArenas[index];
+    PSRAMArenaStats stats;
+    slot.arena.getStats(&stats);
+    // 已删除的任务栈上的作用域不会再析构，深度不会归零，直接释放
+    if (stats.depth > 0 && !taskDeleted) {
+        printf("[PSRAMManager] 任务 %s 的临时内存区仍在使用，无法释放\n", m_tracker.tagName(slot.taskTag));
+        return;
+    }
+    slot.arena.release();
+    
+    portENTER_CRITICAL(&m_arenaMux);
+    slot.task = nullptr;
+    portEXIT_CRITICAL(&m_arenaMux);
 }
 
 bool PSRAMManager::createPool(PSRAMPoolType type, size_t size) {
@@ -466,46 +651,290 @@ bool PSRAMManager::createPool(PSRAMPoolType type, size_t size) {
         return false;
     }
     
-    if (m_pools[type].initialized) {
-        printf("[PSRAMManager] 内存池 %d 已经初始化\n", type);
+    if (m_pools[type].isInitialized()) {
+        printf("[PSRAMManager] 内存池 %s 已经初始化\n", getPoolName(type));
         return true;
     }
     
-    void* poolMemory = heap_caps_malloc(size, MALLOC_CAP_SPIRAM);
-    if (!poolMemory) {
-        printf("[PSRAMManager] 内存池 %d 创建失败\n", type);
+    const PoolLayout& layout = POOL_LAYOUTS[type];
+    if (!m_pools[type].init(size, layout.classes, layout.count, MALLOC_CAP_SPIRAM)) {
+        printf("[PSRAMManager] 内存池 %s 创建失败\n", getPoolName(type));
         return false;
     }
     
-    m_pools[type].baseAddress = poolMemory;
-    m_pools[type].totalSize = size;
-    m_pools[type].usedSize = 0;
-    m_pools[type].initialized = true;
-    
-    printf("[PSRAMManager] 内存池 %d 创建成功: %u KB\n", type, size / 1024);
+    SlabPoolStats stats;
+    m_pools[type].getStats(&stats);
+    printf("[PSRAMManager] 内存池 %s 创建成功: %u KB,", getPoolName(type), stats.region_bytes / 1024);
+    for (uint8_t i = 0; i < stats.class_count; i++) {
+        printf(" %uB x%u", stats.classes[i].block_size, stats.classes[i].block_count);
+    }
+    printf("\n");
     return true;
 }
 
 bool PSRAMManager::destroyPool(PSRAMPoolType type) {
-    if (type >= POOL_COUNT || !m_pools[type].initialized) {
+    if (type >= POOL_COUNT || !m_pools[type].isInitialized()) {
         return false;
     }
     
-    if (m_pools[type].baseAddress) {
-        heap_caps_free(m_pools[type].baseAddress);
+    if (!m_pools[type].deinit()) {
+        printf("[PSRAMManager] 内存池 %s 仍有块在使用，无法销毁\n", getPoolName(type));
+        return false;
     }
     
-    m_pools[type] = MemoryPool();
-    printf("[PSRAMManager] 内存池 %d 已销毁\n", type);
+    printf("[PSRAMManager] 内存池 %s 已销毁\n", getPoolName(type));
     return true;
 }
 
 size_t PSRAMManager::getPoolUsage(PSRAMPoolType type) {
-    if (type >= POOL_COUNT || !m_pools[type].initialized) {
+    SlabPoolStats stats;
+    if (!getPoolStats(type, &stats)) {
         return 0;
     }
     
-    return m_pools[type].usedSize;
+    return stats.used_bytes;
+}
+
+bool PSRAMManager::getPoolStats(PSRAMPoolType type, SlabPoolStats* stats) const {
+    if (type >= POOL_COUNT || !stats || !m_pools[type].isInitialized()) {
+        return false;
+    }
+    
+    m_pools[type].getStats(stats);
+    return true;
+}
+
+bool PSRAMManager::getMemClassStats(MemClass memClass, MemClassStats* stats) const {
+    if (memClass >= MEM_CLASS_COUNT || !stats) {
+        return false;
+    }
+    
+    portENTER_CRITICAL(&m_statsMux);
+    *stats = m_classStats[memClass];
+    portEXIT_CRITICAL(&m_statsMux);
+    return true;
+}
+
+const char* PSRAMManager::getMemClassName(MemClass memClass) {
+    switch (memClass) {
+        case MEM_CLASS_PSRAM_POOL: return "PSRAM内存池";
+        case MEM_CLASS_PSRAM_HEAP: return "PSRAM系统堆";
+        case MEM_CLASS_INTERNAL: return "内部RAM";
+        case MEM_CLASS_DMA: return "内部DMA";
+        case MEM_CLASS_EXEC: return "可执行内存";
+        default: return "未知类别";
+    }
+}
+
+bool PSRAMManager::registerReclaimer(const char* name, MemReclaimPriority priority, uint32_t caps,
+                                     MemReclaimCallback callback, void* userdata) {
+    if (!callback) {
+        return false;
+    }
+    
+    bool registered = false;
+    portENTER_CRITICAL(&m_governorMux);
+    if (m_reclaimerCount < MEM_MAX_RECLAIMERS) {
+        // 按优先级插入，同优先级保持注册顺序
+        int pos = m_reclaimerCount;
+        while (pos > 0 && m_reclaimers[pos - 1].stats.priority > priority) {
+            m_reclaimers[pos] = m_reclaimers[pos - 1];
+            pos--;
+        }
+        Reclaimer& r = m_reclaimers[pos];
+        r.callback = callback;
+        r.userdata = userdata;
+        memset(&r.stats, 0, sizeof(r.stats));
+        r.stats.name = name;
+        r.stats.priority = priority;
+        r.stats.caps = caps;
+        m_reclaimerCount++;
+        registered = true;
+    }
+    portEXIT_CRITICAL(&m_governorMux);
+    
+    if (registered) {
+        printf("[PSRAMManager] 注册内存回收器: %s (优先级 %d)\n", name, priority);
+    } else {
+        printf("[PSRAMManager] ✗ 内存回收器已满，无法注册: %s\n", name);
+    }
+    return registered;
+}
+
+void PSRAMManager::unregisterReclaimer(MemReclaimCallback callback, void* userdata) {
+    portENTER_CRITICAL(&m_governorMux);
+    for (int i = 0; i < m_reclaimerCount; i++) {
+        if (m_reclaimers[i].callback == callback && m_reclaimers[i].userdata == userdata) {
+            for (int j = i; j < m_reclaimerCount - 1; j++) {
+                m_reclaimers[j] = m_reclaimers[j + 1];
+            }
+            m_reclaimerCount--;
+            break;
+        }
+    }
+    portEXIT_CRITICAL(&m_governorMux);
+}
+
+void PSRAMManager::setWatermarks(uint32_t caps, size_t low, size_t critical) {
+    if (critical > low) {
+        critical = low;
+    }
+    portENTER_CRITICAL(&m_governorMux);
+    if (caps & MEM_CAP_INTERNAL) {
+        m_internalLow = low;
+        m_internalCritical = critical;
+    }
+    if (caps & MEM_CAP_SPIRAM) {
+        m_psramLow = low;
+        m_psramCritical = critical;
+    }
+    portEXIT_CRITICAL(&m_governorMux);
+}
+
+MemPressure PSRAMManager::getMemoryPressure(uint32_t caps) const {
+    MemPressure pressure = MEM_PRESSURE_NONE;
+    
+    if (caps & MEM_CAP_INTERNAL) {
+        pressure = pressureOf(heap_caps_get_free_size(MALLOC_CAP_INTERNAL), m_internalLow, m_internalCritical);
+    }
+    if ((caps & MEM_CAP_SPIRAM) && isPSRAMAvailable()) {
+        MemPressure psram = pressureOf(heap_caps_get_free_size(MALLOC_CAP_SPIRAM), m_psramLow, m_psramCritical);
+        if (psram > pressure) {
+            pressure = psram;
+        }
+    }
+    return pressure;
+}
+
+MemPressure PSRAMManager::relieveMemoryPressure() {
+    uint32_t now = millis();
+    
+    // 监控任务和Web服务器任务都会调用，按MEM_GOVERNOR_CHECK_MS限频
+    portENTER_CRITICAL(&m_governorMux);
+    bool due = (now - m_lastPressureCheck) >= MEM_GOVERNOR_CHECK_MS;
+    if (due) {
+        m_lastPressureCheck = now;
+    }
+    uint8_t prevInternal = m_governorStats.internalPressure;
+    uint8_t prevPsram = m_governorStats.psramPressure;
+    portEXIT_CRITICAL(&m_governorMux);
+    
+    if (!due || !m_initialized) {
+        return (MemPressure)(prevInternal > prevPsram ? prevInternal : prevPsram);
+    }
+    
+    size_t internalFree = heap_caps_get_free_size(MALLOC_CAP_INTERNAL);
+    size_t psramFree = isPSRAMAvailable() ? heap_caps_get_free_size(MALLOC_CAP_SPIRAM) : 0;
+    MemPressure internalPressure = pressureOf(internalFree, m_internalLow, m_internalCritical);
+    MemPressure psramPressure = isPSRAMAvailable() ? pressureOf(psramFree, m_psramLow, m_psramCritical)
+                                                   : MEM_PRESSURE_NONE;
+    
+    portENTER_CRITICAL(&m_governorMux);
+    m_governorStats.internalPressure = internalPressure;
+    m_governorStats.psramPressure = psramPressure;
+    m_governorStats.internalFree = internalFree;
+    m_governorStats.psramFree = psramFree;
+    portEXIT_CRITICAL(&m_governorMux);
+    
+    if (internalPressure != prevInternal || psramPressure != prevPsram) {
+        printf("[PSRAMManager] 内存压力: 内部RAM %s (%u KB空闲), PSRAM %s (%u KB空闲)\n",
+               getPressureName(internalPressure), internalFree / 1024,
+               getPressureName(psramPressure), psramFree / 1024);
+    }
+    
+    // 回收到低水位以上
+    if (internalPressure != MEM_PRESSURE_NONE) {
+        reclaimMemory(m_internalLow - internalFree, MEM_CAP_INTERNAL, internalPressure);
+    }
+    if (psramPressure != MEM_PRESSURE_NONE) {
+        reclaimMemory(m_psramLow - psramFree, MEM_CAP_SPIRAM, psramPressure);
+    }
+    
+    return internalPressure > psramPressure ? internalPressure : psramPressure;
+}
+
+size_t PSRAMManager::reclaimMemory(size_t bytes, uint32_t caps, MemPressure pressure) {
+    if (pressure == MEM_PRESSURE_NONE || bytes == 0) {
+        return 0;
+    }
+    
+    // 同一时间只有一次回收；回调里的释放/分配不会再次进入
+    Reclaimer list[MEM_MAX_RECLAIMERS];
+    uint8_t count;
+    portENTER_CRITICAL(&m_governorMux);
+    if (m_reclaiming) {
+        portEXIT_CRITICAL(&m_governorMux);
+        return 0;
+    }
+    m_reclaiming = true;
+    count = m_reclaimerCount;
+    memcpy(list, m_reclaimers, sizeof(Reclaimer) * count);
+    portEXIT_CRITICAL(&m_governorMux);
+    
+    // 低压力只回收缓存和可重新获取的数据
+    uint8_t maxPriority = (pressure == MEM_PRESSURE_CRITICAL) ? MEM_RECLAIM_CRITICAL : MEM_RECLAIM_DATA;
+    size_t total = 0;
+    for (uint8_t i = 0; i < count && total < bytes; i++) {
+        if (!(list[i].stats.caps & caps) || list[i].stats.priority > maxPriority) {
+            continue;
+        }
+        
+        size_t freed = list[i].callback(bytes - total, pressure, list[i].userdata);
+        total += freed;
+        
+        portENTER_CRITICAL(&m_governorMux);
+        for (int j = 0; j < m_reclaimerCount; j++) {
+            if (m_reclaimers[j].callback == list[i].callback && m_reclaimers[j].userdata == list[i].userdata) {
+                m_reclaimers[j].stats.calls++;
+                m_reclaimers[j].stats.reclaimedBytes += freed;
+                break;
+            }
+        }
+        portEXIT_CRITICAL(&m_governorMux);
+        
+        if (freed > 0) {
+            printf("[PSRAMManager] 回收 %s: %u字节\n", list[i].stats.name, freed);
+        }
+    }
+    
+    portENTER_CRITICAL(&m_governorMux);
+    m_reclaiming = false;
+    m_governorStats.reclaimRuns++;
+    m_governorStats.reclaimedBytes += total;
+    portEXIT_CRITICAL(&m_governorMux);
+    
+    return total;
+}
+
+void PSRAMManager::getGovernorStats(MemGovernorStats* stats) const {
+    portENTER_CRITICAL(&m_governorMux);
+    *stats = m_governorStats;
+    portEXIT_CRITICAL(&m_governorMux);
+}
+
+uint8_t PSRAMManager::getReclaimers(MemReclaimerStats* out, uint8_t max) const {
+    portENTER_CRITICAL(&m_governorMux);
+    uint8_t n = m_reclaimerCount < max ? m_reclaimerCount : max;
+    for (uint8_t i = 0; i < n; i++) {
+        out[i] = m_reclaimers[i].stats;
+    }
+    portEXIT_CRITICAL(&m_governorMux);
+    return n;
+}
+
+MemPressure PSRAMManager::pressureOf(size_t free, size_t low, size_t critical) {
+    if (free < critical) {
+        return MEM_PRESSURE_CRITICAL;
+    }
+    return free < low ? MEM_PRESSURE_LOW : MEM_PRESSURE_NONE;
+}
+
+const char* PSRAMManager::getPressureName(MemPressure pressure) {
+    switch (pressure) {
+        case MEM_PRESSURE_LOW:      return "偏低";
+        case MEM_PRESSURE_CRITICAL: return "严重";
+        default:                    return "正常";
+    }
 }
 
 bool PSRAMManager::defragment() {
@@ -522,7 +951,6 @@ bool PSRAMManager::defragment() {
 
 void PSRAMManager::garbageCollect() {
     if (takeMutex()) {
-        cleanupExpiredBlocks();
         updateStatistics();
         giveMutex();
     }
@@ -541,14 +969,12 @@ void PSRAMManager::printMemoryMap() {
     printf("碎片率: %.1f%%\n", getFragmentationRate());
     printf("分配的内存块数量: %u\n", getBlockCount());
     
-    if (takeMutex()) {
-        printf("\n=== 分配的内存块详情 ===\n");
-        for (const auto& block : m_allocatedBlocks) {
-            printf("地址: %p, 大小: %u字节, 任务: %s, 用途: %s\n",
-                   block.address, block.size, 
-                   block.taskName.c_str(), block.purpose.c_str());
-        }
-        giveMutex();
+    printf("\n=== 分配的内存块详情 ===\n");
+    std::vector<PSRAMBlockInfo> blocks = getAllocatedBlocks();
+    for (const auto& block : blocks) {
+        printf("地址: %p, 大小: %u字节, 任务: %s, 池: %s, 用途: %s\n",
+               block.address, block.size, m_tracker.tagName(block.taskTag),
+               getPoolName((PSRAMPoolType)block.pool), m_tracker.tagName(block.purposeTag));
     }
     
     printf("=====================\n\n");
@@ -565,11 +991,42 @@ void PSRAMManager::printStatistics() {
     printf("分配次数: %u\n", stats.allocationCount);
     printf("释放次数: %u\n", stats.freeCount);
     printf("碎片率: %.1f%%\n", stats.fragmentationRate);
+    
+    AllocTrackerStats tracker;
+    m_tracker.getStats(&tracker);
+    printf("跟踪表: %u/%u条 (峰值 %u, 最长探测 %u, 未记录 %u), 标签 %u\n",
+           tracker.count, tracker.capacity, tracker.peak, tracker.maxProbe, tracker.dropped, tracker.tags);
+    
+    for (int i = 0; i < POOL_COUNT; i++) {
+        SlabPoolStats pool;
+        if (getPoolStats((PSRAMPoolType)i, &pool)) {
+            printf("%s: 使用 %u/%u KB, 分配 %u, 释放 %u, 回退 %u\n",
+                   getPoolName((PSRAMPoolType)i), pool.used_bytes / 1024, pool.region_bytes / 1024,
+                   pool.allocs, pool.frees, pool.fallbacks);
+        }
+    }
+    
+    for (int i = 0; i < MEM_CLASS_COUNT; i++) {
+        MemClassStats cls;
+        getMemClassStats((MemClass)i, &cls);
+        if (cls.allocs || cls.failures) {
+            printf("%s: 在用 %u KB (峰值 %u KB), 分配 %u, 释放 %u, 回退 %u, 失败 %u\n",
+                   getMemClassName((MemClass)i), cls.liveBytes / 1024, cls.peakBytes / 1024,
+                   cls.allocs, cls.frees, cls.fallbacks, cls.failures);
+        }
+    }
+    
+    MemGovernorStats governor;
+    getGovernorStats(&governor);
+    printf("内存压力: 内部RAM %s, PSRAM %s, 回收 %u次 共%u KB, 分配重试 %u (成功 %u), 回收器 %u个\n",
+           getPressureName((MemPressure)governor.internalPressure), getPressureName((MemPressure)governor.psramPressure),
+           governor.reclaimRuns, governor.reclaimedBytes / 1024, governor.allocRetries, governor.allocRescued,
+           m_reclaimerCount);
     printf("==================\n\n");
 }
 
 String PSRAMManager::getStatusJSON() {
-    DynamicJsonDocument doc(1024);
+    DynamicJsonDocument doc(4096);
     PSRAMStatistics stats = getStatistics();
     
     doc["available"] = isPSRAMAvailable();
@@ -583,17 +1040,118 @@ String PSRAMManager::getStatusJSON() {
     doc["freeCount"] = stats.freeCount;
     doc["blockCount"] = getBlockCount();
     
-    JsonArray blocks = doc.createNestedArray("allocatedBlocks");
-    if (takeMutex()) {
-        for (const auto& block : m_allocatedBlocks) {
-            JsonObject blockObj = blocks.createNestedObject();
-            blockObj["address"] = String((unsigned long)block.address, HEX);
-            blockObj["size"] = block.size;
-            blockObj["taskName"] = block.taskName;
-            blockObj["purpose"] = block.purpose;
-            blockObj["allocTime"] = block.allocTime;
+    AllocTrackerStats tracker;
+    m_tracker.getStats(&tracker);
+    JsonObject trackerObj = doc.createNestedObject("tracker");
+    trackerObj["capacity"] = tracker.capacity;
+    trackerObj["count"] = tracker.count;
+    trackerObj["peak"] = tracker.peak;
+    trackerObj["maxProbe"] = tracker.maxProbe;
+    trackerObj["dropped"] = tracker.dropped;
+    trackerObj["tags"] = tracker.tags;
+    trackerObj["tagOverflows"] = tracker.tagOverflows;
+    
+    ProfilerSummary profile;
+    m_profiler.getSummary(&profile);
+    JsonObject profilerObj = doc.createNestedObject("profiler");
+    profilerObj["enabled"] = profile.enabled;
+    profilerObj["peakLiveBytes"] = profile.peakLiveBytes;
+    profilerObj["leakSuspects"] = profile.suspects;
+    profilerObj["internalMinFree"] = profile.current.internalMinFree;
+    
+    JsonArray pools = doc.createNestedArray("pools");
+    for (int i = 0; i < POOL_COUNT; i++) {
+        SlabPoolStats pool;
+        if (!getPoolStats((PSRAMPoolType)i, &pool)) {
+            continue;
         }
-        giveMutex();
+        JsonObject poolObj = pools.createNestedObject();
+        poolObj["name"] = getPoolName((PSRAMPoolType)i);
+        poolObj["regionBytes"] = pool.region_bytes;
+        poolObj["usedBytes"] = pool.used_bytes;
+        poolObj["allocs"] = pool.allocs;
+        poolObj["frees"] = pool.frees;
+        poolObj["fallbacks"] = pool.fallbacks;
+        poolObj["badFrees"] = pool.bad_frees;
+        JsonArray classes = poolObj.createNestedArray("classes");
+        for (uint8_t c = 0; c < pool.class_count; c++) {
+            JsonObject classObj = classes.createNestedObject();
+            classObj["blockSize"] = pool.classes[c].block_size;
+            classObj["blocks"] = pool.classes[c].block_count;
+            classObj["inUse"] = pool.classes[c].in_use;
+            classObj["peak"] = pool.classes[c].peak;
+            classObj["exhausted"] = pool.classes[c].exhausted;
+        }
+    }
+    
+    JsonArray memClasses = doc.createNestedArray("memClasses");
+    for (int i = 0; i < MEM_CLASS_COUNT; i++) {
+        MemClassStats cls;
+        getMemClassStats((MemClass)i, &cls);
+        JsonObject classObj = memClasses.createNestedObject();
+        classObj["name"] = getMemClassName((MemClass)i);
+        classObj["liveBytes"] = cls.liveBytes;
+        classObj["peakBytes"] = cls.peakBytes;
+        classObj["allocs"] = cls.allocs;
+        classObj["frees"] = cls.frees;
+        classObj["fallbacks"] = cls.fallbacks;
+        classObj["failures"] = cls.failures;
+    }
+    
+    MemGovernorStats governor;
+    getGovernorStats(&governor);
+    JsonObject governorObj = doc.createNestedObject("governor");
+    governorObj["internalPressure"] = getPressureName((MemPressure)governor.internalPressure);
+    governorObj["psramPressure"] = getPressureName((MemPressure)governor.psramPressure);
+    governorObj["internalFree"] = governor.internalFree;
+    governorObj["psramFree"] = governor.psramFree;
+    governorObj["internalLow"] = m_internalLow;
+    governorObj["internalCritical"] = m_internalCritical;
+    governorObj["psramLow"] = m_psramLow;
+    governorObj["psramCritical"] = m_psramCritical;
+    governorObj["reclaimRuns"] = governor.reclaimRuns;
+    governorObj["reclaimedBytes"] = governor.reclaimedBytes;
+    governorObj["allocRetries"] = governor.allocRetries;
+    governorObj["allocRescued"] = governor.allocRescued;
+    MemReclaimerStats reclaimers[MEM_MAX_RECLAIMERS];
+    uint8_t reclaimerCount = getReclaimers(reclaimers, MEM_MAX_RECLAIMERS);
+    JsonArray reclaimerArray = governorObj.createNestedArray("reclaimers");
+    for (uint8_t i = 0; i < reclaimerCount; i++) {
+        JsonObject reclaimerObj = reclaimerArray.createNestedObject();
+        reclaimerObj["name"] = reclaimers[i].name;
+        reclaimerObj["priority"] = reclaimers[i].priority;
+        reclaimerObj["calls"] = reclaimers[i].calls;
+        reclaimerObj["reclaimedBytes"] = reclaimers[i].reclaimedBytes;
+    }
+    
+    JsonArray arenas = doc.createNestedArray("arenas");
+    for (int i = 0; i < PSRAM_ARENA_MAX_TASKS; i++) {
+        if (!m_taskArenas[i].task) {
+            continue;
+        }
+        PSRAMArenaStats arena;
+        m_taskArenas[i].arena.getStats(&arena);
+        JsonObject arenaObj = arenas.createNestedObject();
+        arenaObj["task"] = m_tracker.tagName(m_taskArenas[i].taskTag);
+        arenaObj["capacity"] = arena.capacity;
+        arenaObj["used"] = arena.used;
+        arenaObj["peak"] = arena.peak;
+        arenaObj["allocs"] = arena.allocs;
+        arenaObj["chunkAllocs"] = arena.chunkAllocs;
+        arenaObj["resets"] = arena.resets;
+    }
+    
+    JsonArray blocks = doc.createNestedArray("allocatedBlocks");
+    std::vector<PSRAMBlockInfo> allocated = getAllocatedBlocks();
+    for (const auto& block : allocated) {
+        JsonObject blockObj = blocks.createNestedObject();
+        blockObj["address"] = String((unsigned long)block.address, HEX);
+        blockObj["size"] = block.size;
+        blockObj["taskName"] = m_tracker.tagName(block.taskTag);
+        blockObj["pool"] = getPoolName((PSRAMPoolType)block.pool);
+        blockObj["memClass"] = getMemClassName((MemClass)block.memClass);
+        blockObj["purpose"] = m_tracker.tagName(block.purposeTag);
+        blockObj["allocTime"] = block.allocTime;
     }
     
     String result;
@@ -606,6 +1164,154 @@ void PSRAMManager::setDebugMode(bool enabled) {
     printf("[PSRAMManager] 调试模式: %s\n", enabled ? "开启" : "关闭");
 }
 
+void PSRAMManager::setProfilerEnabled(bool enabled) {
+    if (enabled == m_profiler.isEnabled() || !m_profiler.isInitialized()) {
+        return;
+    }
+    
+    if (enabled) {
+        // 关闭期间的分配/释放没有计入，按跟踪表重建在用统计后再开启
+        PSRAMBlockInfo batch[16];
+        uint32_t cursor = 0;
+        uint32_t n;
+        m_profiler.beginRebuild();
+        while ((n = m_tracker.snapshotFrom(&cursor, batch, 16)) > 0) {
+            for (uint32_t i = 0; i < n; i++) {
+                m_profiler.rebuildBlock(batch[i]);
+            }
+        }
+    }
+    m_profiler.setEnabled(enabled);
+    printf("[PSRAMManager] 分配剖析: %s\n", enabled ? "开启" : "关闭");
+}
+
+bool PSRAMManager::isProfilerEnabled() const {
+    return m_profiler.isEnabled();
+}
+
+void PSRAMManager::resetProfiler() {
+    m_profiler.resetCounters();
+    printf("[PSRAMManager] 分配剖析计数已清零\n");
+}
+
+void PSRAMManager::getProfileJSON(JsonDocument& doc) {
+    ProfilerSummary summary;
+    m_profiler.getSummary(&summary);
+    
+    doc["enabled"] = summary.enabled;
+    doc["uptimeSec"] = summary.current.uptimeSec;
+    doc["sinceSec"] = summary.sinceSec;
+    doc["allocs"] = summary.allocs;
+    doc["frees"] = summary.frees;
+    doc["liveCount"] = summary.liveCount;
+    doc["liveBytes"] = summary.liveBytes;
+    doc["peakLiveBytes"] = summary.peakLiveBytes;
+    doc["leakScans"] = summary.leakScans;
+    doc["leakSuspects"] = summary.suspects;
+    
+    JsonObject config = doc.createNestedObject("config");
+    config["leakAgeMs"] = PROFILER_LEAK_AGE_MS;
+    config["leakScanMs"] = PROFILER_LEAK_SCAN_MS;
+    config["leakWindow"] = PROFILER_LEAK_WINDOW;
+    config["leakMinGrowth"] = PROFILER_LEAK_MIN_GROWTH;
+    config["heapSampleMs"] = PROFILER_HEAP_SAMPLE_MS;
+    
+    JsonObject heap = doc.createNestedObject("heap");
+    heap["internalFree"] = summary.current.internalFree;
+    heap["internalMinFree"] = summary.current.internalMinFree;
+    heap["internalLargest"] = summary.current.internalLargest;
+    heap["psramFree"] = summary.current.psramFree;
+    heap["psramMinFree"] = summary.psramMinFree;
+    
+    // 尺寸直方图：limit为级别上界，0表示无上界
+    JsonArray sizes = doc.createNestedArray("sizeHistogram");
+    for (uint8_t i = 0; i < PROFILER_SIZE_CLASSES; i++) {
+        if (!summary.sizeAllocs[i] && !summary.sizeLive[i]) {
+            continue;
+        }
+        JsonObject cls = sizes.createNestedObject();
+        cls["limit"] = PSRAMAllocProfiler::sizeClassLimit(i);
+        cls["allocs"] = summary.sizeAllocs[i];
+        cls["live"] = summary.sizeLive[i];
+    }
+    
+    JsonArray lifetimes = doc.createNestedArray("lifetimeHistogram");
+    for (uint8_t i = 0; i < PROFILER_LIFETIME_CLASSES; i++) {
+        JsonObject cls = lifetimes.createNestedObject();
+        cls["limitMs"] = PSRAMAllocProfiler::lifetimeClassLimit(i);
+        cls["frees"] = summary.lifetimes[i];
+    }
+    
+    AllocTrackerStats tracker;
+    m_tracker.getStats(&tracker);
+    JsonArray purposes = doc.createNestedArray("purposes");
+    JsonArray tasks = doc.createNestedArray("tasks");
+    JsonArray suspects = doc.createNestedArray("suspects");
+    for (uint16_t tag = 0; tag < tracker.tags && tag < ALLOC_TAG_MAX; tag++) {
+        ProfilerTagStats stats;
+        ProfilerLeakInfo leak;
+        
+        if (m_profiler.getPurposeStats(tag, &stats) && (stats.allocs || stats.liveCount)) {
+            m_profiler.getLeakInfo(tag, &leak);
+            JsonObject obj = purposes.createNestedObject();
+            obj["name"] = m_tracker.tagName(tag);
+            obj["allocs"] = stats.allocs;
+            obj["frees"] = stats.frees;
+            obj["liveCount"] = stats.liveCount;
+            obj["liveBytes"] = stats.liveBytes;
+            obj["peakBytes"] = stats.peakBytes;
+            obj["avgLifetimeMs"] = stats.frees ? (uint32_t)(stats.lifetimeSumMs / stats.frees) : 0;
+            obj["maxLifetimeMs"] = stats.maxLifetimeMs;
+            obj["oldBytes"] = leak.oldBytes;
+            obj["oldCount"] = leak.oldCount;
+            obj["oldestAgeMs"] = leak.oldestAgeMs;
+            obj["growthBytes"] = leak.growthBytes;
+            obj["suspected"] = leak.suspected;
+            if (leak.suspected) {
+                suspects.add(m_tracker.tagName(tag));
+            }
+        }
+        
+        if (m_profiler.getTaskStats(tag, &stats) && (stats.allocs || stats.liveCount)) {
+            JsonObject obj = tasks.createNestedObject();
+            obj["name"] = m_tracker.tagName(tag);
+            obj["allocs"] = stats.allocs;
+            obj["frees"] = stats.frees;
+            obj["liveCount"] = stats.liveCount;
+            obj["liveBytes"] = stats.liveBytes;
+            obj["peakBytes"] = stats.peakBytes;
+            obj["avgLifetimeMs"] = stats.frees ? (uint32_t)(stats.lifetimeSumMs / stats.frees) : 0;
+            obj["maxLifetimeMs"] = stats.maxLifetimeMs;
+        }
+    }
+    
+    // 堆水位历史按时间先后，每条为[开机秒数, 内部空闲, 内部最低空闲, 内部最大块, PSRAM空闲, 跟踪在用字节]
+    JsonArray history = doc.createNestedArray("heapHistory");
+    PSRAMArenaScope arena(this);
+    ProfilerHeapSample* samples = (ProfilerHeapSample*)arena.alloc(PROFILER_HEAP_SAMPLES * sizeof(ProfilerHeapSample));
+    if (!samples) {
+        return;
+    }
+    uint32_t n = m_profiler.getHeapSamples(samples, PROFILER_HEAP_SAMPLES);
+    for (uint32_t i = 0; i < n; i++) {
+        JsonArray row = history.createNestedArray();
+        row.add(samples[i].uptimeSec);
+        row.add(samples[i].internalFree);
+        row.add(samples[i].internalMinFree);
+        row.add(samples[i].internalLargest);
+        row.add(samples[i].psramFree);
+        row.add(samples[i].liveBytes);
+    }
+}
+
+size_t PSRAMManager::getProfileDumpSize() const {
+    return m_profiler.dumpSize(m_tracker);
+}
+
+size_t PSRAMManager::getProfileDump(uint8_t* out, size_t max) const {
+    return m_profiler.dump(out, max, m_tracker);
+}
+
 void PSRAMManager::setMonitorCallback(PSRAMCallback callback) {
     m_monitorCallback = callback;
 }
@@ -618,7 +1324,6 @@ void PSRAMManager::monitorTask(void* parameter) {
     while (manager->m_running) {
         if (manager->takeMutex()) {
             manager->updateStatistics();
-            manager->cleanupExpiredBlocks();
             
             // 触发监控回调
             if (manager->m_monitorCallback) {
@@ -628,6 +1333,13 @@ void PSRAMManager::monitorTask(void* parameter) {
             manager->giveMutex();
         }
         
+        // 剖析器的堆水位采样和疑似泄漏检查各自按间隔执行
+        manager->updateProfiler();
+        
+#if MEM_GOVERNOR_ENABLED
+        manager->relieveMemoryPressure();
+#endif
+        
         // 每5秒更新一次统计信息
         vTaskDelay(pdMS_TO_TICKS(5000));
     }
@@ -637,40 +1349,65 @@ void PSRAMManager::monitorTask(void* parameter) {
 }
 
 void PSRAMManager::updateStatistics() {
-    m_statistics.totalSize = ESP.getPsramSize();
-    m_statistics.freeSize = ESP.getFreePsram();
-    m_statistics.usedSize = m_statistics.totalSize - m_statistics.freeSize;
-    m_statistics.largestFreeBlock = heap_caps_get_largest_free_block(MALLOC_CAP_SPIRAM);
+    // 先在锁外查询堆，再在统计锁内写入（分配/释放路径同样在统计锁内更新这些字段）
+    size_t totalSize = ESP.getPsramSize();
+    size_t freeSize = ESP.getFreePsram();
+    size_t largestFreeBlock = heap_caps_get_largest_free_block(MALLOC_CAP_SPIRAM);
     
     // 计算碎片率
-    if (m_statistics.freeSize > 0) {
-        m_statistics.fragmentationRate = 
-            (1.0f - ((float)m_statistics.largestFreeBlock / m_statistics.freeSize)) * 100.0f;
-    } else {
-        m_statistics.fragmentationRate = 0.0f;
+    float fragmentationRate = 0.0f;
+    if (freeSize > 0) {
+        fragmentationRate = (1.0f - ((float)largestFreeBlock / freeSize)) * 100.0f;
     }
+    
+    portENTER_CRITICAL(&m_statsMux);
+    m_statistics.totalSize = totalSize;
+    m_statistics.freeSize = freeSize;
+    m_statistics.usedSize = totalSize - freeSize;
+    m_statistics.largestFreeBlock = largestFreeBlock;
+    m_statistics.fragmentationRate = fragmentationRate;
+    portEXIT_CRITICAL(&m_statsMux);
 }
 
-void PSRAMManager::cleanupExpiredBlocks() {
-    // 清理无效的内存块记录
-    m_allocatedBlocks.erase(
-        std::remove_if(m_allocatedBlocks.begin(), m_allocatedBlocks.end(),
-                       [this](const PSRAMBlockInfo& block) {
-                           return !isValidPSRAMAddress(block.address);
-                       }),
-        m_allocatedBlocks.end()
-    );
+void PSRAMManager::updateProfiler() {
+    uint32_t now = millis();
+    
+    if (m_profiler.heapSampleDue(now)) {
+        m_profiler.sampleHeap(now);
+    }
+    
+    if (!m_profiler.leakScanDue(now)) {
+        return;
+    }
+    
+    // 分批遍历跟踪表，每批只短暂持有跟踪表的自旋锁
+    PSRAMBlockInfo batch[16];
+    uint32_t cursor = 0;
+    uint32_t n;
+    m_profiler.beginLeakScan();
+    while ((n = m_tracker.snapshotFrom(&cursor, batch, 16)) > 0) {
+        for (uint32_t i = 0; i < n; i++) {
+            m_profiler.scanBlock(batch[i], now);
+        }
+    }
+    m_profiler.endLeakScan(now);
+    
+    ProfilerSummary summary;
+    m_profiler.getSummary(&summary);
+    if (summary.suspects > 0) {
+        printf("[PSRAMManager] ⚠ 疑似内存泄漏: %u个用途的老块持续增长，详见/api/memory/profile\n", summary.suspects);
+    }
 }
 
-String PSRAMManager::getCurrentTaskName() {
+uint16_t PSRAMManager::getCurrentTaskTag() {
     TaskHandle_t currentTask = xTaskGetCurrentTaskHandle();
     if (currentTask) {
-        return String(pcTaskGetTaskName(currentTask));
+        return m_tracker.internTag(pcTaskGetName(currentTask));
     }
-    return "Unknown";
+    return m_tracker.internTag("Unknown");
 }
 
-String PSRAMManager::getPoolName(PSRAMPoolType pool) {
+const char* PSRAMManager::getPoolName(PSRAMPoolType pool) const {
     switch (pool) {
         case POOL_GENERAL: return "通用池";
         case POOL_GRAPHICS: return "图形池";
@@ -680,9 +1417,128 @@ String PSRAMManager::getPoolName(PSRAMPoolType pool) {
     }
 }
 
-void PSRAMManager::logAllocation(void* ptr, size_t size, const String& purpose) {
+void* PSRAMManager::allocateRaw(size_t size, uint32_t caps, size_t alignment, MemPlacement placement,
+                                PSRAMPoolType pool, uint8_t* memClass) {
+    bool needInternal = (caps & (MEM_CAP_INTERNAL | MEM_CAP_EXEC)) || ((caps & MEM_CAP_DMA) && !(caps & MEM_CAP_SPIRAM));
+    if ((caps & MEM_CAP_SPIRAM) && needInternal) {
+        printf("[PSRAMManager] ✗ 能力需求冲突: 0x%x\n", caps);
+        return nullptr;
+    }
+    
+    // PSRAM经EDMA访问时按缓存行对齐，并占满整行，避免DMA写入与相邻数据共用缓存行
+    if ((caps & MEM_CAP_SPIRAM) && (caps & MEM_CAP_DMA)) {
+        if (alignment < MEM_SPIRAM_DMA_ALIGNMENT) {
+            alignment = MEM_SPIRAM_DMA_ALIGNMENT;
+        }
+        size = (size + alignment - 1) & ~(alignment - 1);
+    }
+    
+    if ((unsigned)placement >= sizeof(PLACEMENT_CHAINS) / sizeof(PLACEMENT_CHAINS[0])) {
+        placement = MEM_PREFER_PSRAM;
+    }
+    
+    // 按放置策略依次尝试，跳过能力需求不允许的类别；第一个可尝试的类别之后的成功计为回退
+    bool fallback = false;
+    for (int i = 0; i < 3; i++) {
+        MemClass cls = PLACEMENT_CHAINS[placement][i];
+        if (cls == MEM_CLASS_COUNT) {
+            break;
+        }
+        if (cls == MEM_CLASS_INTERNAL) {
+            if (caps & MEM_CAP_SPIRAM) {
+                continue;
+            }
+            cls = (caps & MEM_CAP_EXEC) ? MEM_CLASS_EXEC : (caps & MEM_CAP_DMA) ? MEM_CLASS_DMA : MEM_CLASS_INTERNAL;
+        } else if (needInternal) {
+            continue;
+        }
+        if (cls == MEM_CLASS_PSRAM_POOL && !poolEligible(pool, size, alignment)) {
+            // 池放不下（超出最大块或对齐要求）时直接走系统堆，不计为失败
+            if (pool < POOL_COUNT && m_pools[pool].isInitialized()) {
+                m_pools[pool].noteFallback();
+            }
+            continue;
+        }
+        
+        void* ptr = allocateFromClass(cls, size, alignment, pool, fallback);
+        portENTER_CRITICAL(&m_statsMux);
+        if (!ptr) {
+            m_classStats[cls].failures++;
+        } else if (fallback) {
+            m_classStats[cls].fallbacks++;
+        }
+        portEXIT_CRITICAL(&m_statsMux);
+        
+        if (ptr) {
+            *memClass = cls;
+            return ptr;
+        }
+        fallback = true;
+    }
+    return nullptr;
+}
+
+void* PSRAMManager::allocateFromClass(MemClass memClass, size_t size, size_t alignment,
+                                      PSRAMPoolType pool, bool fallback) {
+    uint32_t heapCaps;
+    switch (memClass) {
+        case MEM_CLASS_PSRAM_POOL: {
+            void* ptr = m_pools[pool].alloc(size);
+            if (!ptr) {
+                m_pools[pool].noteFallback();
+            }
+            return ptr;
+        }
+        case MEM_CLASS_PSRAM_HEAP:
+            heapCaps = MALLOC_CAP_SPIRAM | MALLOC_CAP_8BIT;
+            break;
+        case MEM_CLASS_DMA:
+            heapCaps = MALLOC_CAP_DMA | MALLOC_CAP_INTERNAL | MALLOC_CAP_8BIT;
+            break;
+        case MEM_CLASS_EXEC:
+            heapCaps = MALLOC_CAP_EXEC | MALLOC_CAP_INTERNAL | MALLOC_CAP_32BIT;
+            break;
+        default:
+            heapCaps = MALLOC_CAP_INTERNAL | MALLOC_CAP_8BIT;
+            break;
+    }
+    
+    // 回退到内部RAM时保留一部分空闲，避免PSRAM用尽时挤占WiFi/LVGL需要的内部RAM
+    if (fallback && !isPSRAMClass(memClass) &&
+        heap_caps_get_free_size(heapCaps) < size + MEM_INTERNAL_FALLBACK_RESERVE) {
+        return nullptr;
+    }
+    
+    if (alignment > 4) {
+        return heap_caps_aligned_alloc(alignment, size, heapCaps);
+    }
+    return heap_caps_malloc(size, heapCaps);
+}
+
+bool PSRAMManager::poolEligible(PSRAMPoolType pool, size_t size, size_t alignment) const {
+#if PSRAM_POOL_ENABLED
+    // 池内块按SLAB_POOL_ALIGNMENT对齐，更大的对齐直接使用系统堆
+    return pool < POOL_COUNT && m_pools[pool].isInitialized() &&
+           alignment <= SLAB_POOL_ALIGNMENT && size <= m_pools[pool].maxBlockSize();
+#else
+    return false;
+#endif
+}
+
+void PSRAMManager::freeRaw(void* ptr) {
+    // 按地址范围找到所属内存池，不属于任何池的指针来自系统堆（heap_caps_aligned_alloc的地址同样用heap_caps_free释放）
+    for (int i = 0; i < POOL_COUNT; i++) {
+        if (m_pools[i].owns(ptr)) {
+            m_pools[i].free(ptr);
+            return;
+        }
+    }
+    heap_caps_free(ptr);
+}
+
+void PSRAMManager::logAllocation(void* ptr, size_t size, uint16_t purposeTag) {
     if (m_debugMode) {
-        printf("[PSRAMManager] 分配: %p, %u字节, %s\n", ptr, size, purpose.c_str());
+        printf("[PSRAMManager] 分配: %p, %u字节, %s\n", ptr, size, m_tracker.tagName(purposeTag));
     }
 }
 
@@ -700,16 +1556,6 @@ bool PSRAMManager::isValidPSRAMAddress(void* ptr) {
     return (addr >= 0x3D800000 && addr < 0x3E000000); // ESP32S3 PSRAM地址范围
 }
 
-size_t PSRAMManager::alignSize(size_t size, size_t alignment) {
-    return (size + alignment - 1) & ~(alignment - 1);
-}
-
-void* PSRAMManager::alignAddress(void* addr, size_t alignment) {
-    uintptr_t address = (uintptr_t)addr;
-    uintptr_t aligned = (address + alignment - 1) & ~(alignment - 1);
-    return (void*)aligned;
-}
-
 bool PSRAMManager::takeMutex(TickType_t timeout) {
     if (!m_mutex) return false;
     return xSemaphoreTake(m_mutex, timeout) == pdTRUE;
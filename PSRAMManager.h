@@ -12,22 +12,34 @@
 #include "freertos/semphr.h"
 #include "esp_heap_caps.h"
 #include "esp_psram.h"
+#include "PSRAMSlabPool.h"
+#include "PSRAMAllocTracker.h"
+#include "PSRAMAllocProfiler.h"
+#include "PSRAMArena.h"
 #include <vector>
-#include <map>
-
-// PSRAM分配块信息结构体
-struct PSRAMBlockInfo {
-    void* address;          // 内存块地址
-    size_t size;           // 内存块大小
-    String taskName;       // 分配任务名称
-    unsigned long allocTime; // 分配时间戳
-    String purpose;        // 分配用途描述
-    bool isAllocated;      // 是否已分配
-    
-    PSRAMBlockInfo(void* addr, size_t sz, const String& task, const String& desc)
-        : address(addr), size(sz), taskName(task), allocTime(millis()), 
-          purpose(desc), isAllocated(true) {}
-};
+
+// 分级内存池配置（init时预分配，关闭后所有分配直接使用PSRAM系统堆）
+#define PSRAM_POOL_ENABLED          1
+#define PSRAM_POOL_GENERAL_BYTES    (256 * 1024)    // 通用池：小对象、天气数据
+#define PSRAM_POOL_GRAPHICS_BYTES   (512 * 1024)    // 图形池：资源包图片缓存
+#define PSRAM_POOL_BUFFER_BYTES     (512 * 1024)    // 缓冲池：HTTP响应、JSON文档、音频
+#define PSRAM_POOL_TASK_STACK_BYTES (64 * 1024)     // 任务栈池
+
+// 能力分配回退到内部RAM时要保留的最小空闲（只约束回退，明确要求内部RAM/DMA的分配不受限）
+#define MEM_INTERNAL_FALLBACK_RESERVE   (48 * 1024)
+#define MEM_SPIRAM_DMA_ALIGNMENT        64              // PSRAM经EDMA访问时的对齐（缓存行）
+
+// 内存压力调控（空闲低于水位时按优先级回收已注册的缓存，分配失败时回收后重试一次）
+#define MEM_GOVERNOR_ENABLED            1
+#define MEM_INTERNAL_LOW_WATERMARK      (64 * 1024)     // 内部RAM低水位
+#define MEM_INTERNAL_CRITICAL_WATERMARK (32 * 1024)     // 内部RAM严重水位
+#define MEM_PSRAM_LOW_WATERMARK         (1024 * 1024)   // PSRAM低水位
+#define MEM_PSRAM_CRITICAL_WATERMARK    (256 * 1024)    // PSRAM严重水位
+#define MEM_GOVERNOR_CHECK_MS           250             // 水位检查最小间隔
+#define MEM_MAX_RECLAIMERS              8               // 可注册的回收器数
+
+// 任务临时内存区（HTTP处理、JSON解析等按请求分配、整体回收的临时对象）
+#define PSRAM_ARENA_MAX_TASKS       4               // 最多拥有临时内存区的任务数
 
 // PSRAM统计信息结构体
 struct PSRAMStatistics {
@@ -53,6 +65,91 @@ enum PSRAMPoolType {
     POOL_COUNT             // 内存池数量
 };
 
+// 内存能力需求（可组合）
+enum MemCaps {
+    MEM_CAP_ANY      = 0,
+    MEM_CAP_DMA      = 1 << 0,      // DMA可访问（不带MEM_CAP_SPIRAM时为内部DMA内存）
+    MEM_CAP_INTERNAL = 1 << 1,      // 必须位于内部RAM
+    MEM_CAP_SPIRAM   = 1 << 2,      // 必须位于PSRAM
+    MEM_CAP_EXEC     = 1 << 3       // 可执行（IRAM）
+};
+
+// 放置策略：能力需求允许多个位置时的尝试顺序
+enum MemPlacement {
+    MEM_PREFER_PSRAM,       // PSRAM内存池 → PSRAM系统堆 → 内部RAM（保留MEM_INTERNAL_FALLBACK_RESERVE）
+    MEM_PREFER_INTERNAL,    // 内部RAM → PSRAM内存池 → PSRAM系统堆
+    MEM_PSRAM_ONLY,         // PSRAM内存池 → PSRAM系统堆
+    MEM_INTERNAL_ONLY       // 内部RAM
+};
+
+// 实际放置的内存类别（分别统计）
+enum MemClass {
+    MEM_CLASS_PSRAM_POOL,   // PSRAM分级内存池
+    MEM_CLASS_PSRAM_HEAP,   // PSRAM系统堆
+    MEM_CLASS_INTERNAL,     // 内部RAM
+    MEM_CLASS_DMA,          // 内部DMA内存
+    MEM_CLASS_EXEC,         // 可执行内存
+    MEM_CLASS_COUNT
+};
+
+// 单个内存类别的统计
+struct MemClassStats {
+    uint32_t allocs;        // 分配次数
+    uint32_t frees;         // 释放次数
+    uint32_t fallbacks;     // 按放置策略回退到本类别的次数
+    uint32_t failures;      // 本类别分配失败次数（可能随后回退成功）
+    size_t liveBytes;       // 当前在用字节
+    size_t peakBytes;       // 在用字节峰值
+};
+
+// 内存压力级别
+enum MemPressure {
+    MEM_PRESSURE_NONE,      // 空闲高于低水位
+    MEM_PRESSURE_LOW,       // 低于低水位：回收缓存和可重新获取的数据
+    MEM_PRESSURE_CRITICAL   // 低于严重水位或分配失败：回收全部已注册的内存
+};
+
+// 回收优先级（数值小的先回收）
+enum MemReclaimPriority {
+    MEM_RECLAIM_CACHE,      // 纯缓存，随时可以重建
+    MEM_RECLAIM_DATA,       // 可重新加载或获取的数据
+    MEM_RECLAIM_CRITICAL    // 重建代价明显（如正在显示的背景图），只在严重不足时回收
+};
+
+/**
+ * @brief 回收回调
+ * 
+ * 可能在任意任务的分配失败路径上调用：只能零等待尝试加锁，拿不到锁直接返回0；
+ * 回调中不能注册/注销回收器
+ * 
+ * @param bytes 希望释放的字节数
+ * @param pressure 当前压力级别
+ * @param userdata 注册时传入的用户数据
+ * @return 实际释放的字节数
+ */
+typedef size_t (*MemReclaimCallback)(size_t bytes, MemPressure pressure, void* userdata);
+
+// 回收器统计
+struct MemReclaimerStats {
+    const char* name;       // 名称
+    uint8_t priority;       // MemReclaimPriority
+    uint32_t caps;          // 释放的内存类型（MEM_CAP_SPIRAM/MEM_CAP_INTERNAL）
+    uint32_t calls;         // 调用次数
+    uint32_t reclaimedBytes;// 累计释放字节
+};
+
+// 内存压力调控统计
+struct MemGovernorStats {
+    uint8_t internalPressure;   // 内部RAM压力级别（最近一次检查）
+    uint8_t psramPressure;      // PSRAM压力级别（最近一次检查）
+    size_t internalFree;        // 最近一次检查时的内部RAM空闲
+    size_t psramFree;           // 最近一次检查时的PSRAM空闲
+    uint32_t reclaimRuns;       // 回收次数
+    uint32_t reclaimedBytes;    // 累计回收字节
+    uint32_t allocRetries;      // 分配失败后回收重试的次数
+    uint32_t allocRescued;      // 重试成功的次数
+};
+
 class PSRAMManager {
 public:
     PSRAMManager();
@@ -69,9 +166,17 @@ public:
     
     // PSRAM内存分配接口
     void* allocate(size_t size, PSRAMPoolType pool = POOL_GENERAL);
+    void* allocate(size_t size, const char* purpose, PSRAMPoolType pool = POOL_GENERAL);
     void* allocate(size_t size, const String& purpose, PSRAMPoolType pool = POOL_GENERAL);
+    void* allocateTagged(size_t size, uint16_t purposeTag, PSRAMPoolType pool = POOL_GENERAL);
     void* allocateAligned(size_t size, size_t alignment, PSRAMPoolType pool = POOL_GENERAL);
     
+    // 按能力需求分配（caps为MemCaps组合，alignment为0时使用默认对齐，pool为PSRAM内存池类型）
+    void* allocateCaps(size_t size, uint32_t caps, const char* purpose, size_t alignment = 0,
+                       MemPlacement placement = MEM_PREFER_PSRAM, PSRAMPoolType pool = POOL_GENERAL);
+    void* allocateCapsTagged(size_t size, uint32_t caps, uint16_t purposeTag, size_t alignment = 0,
+                             MemPlacement placement = MEM_PREFER_PSRAM, PSRAMPoolType pool = POOL_GENERAL);
+    
     // PSRAM内存释放接口
     bool deallocate(void* ptr);
     bool deallocateAll(const String& taskName);
@@ -79,7 +184,8 @@ public:
     // 专用分配接口
     void* allocateForTask(size_t size, const String& taskName, const String& purpose);
     void* allocateGraphicsBuffer(size_t width, size_t height, size_t bytesPerPixel);
-    void* allocateDataBuffer(size_t size, const String& purpose);
+    void* allocateDataBuffer(size_t size, const char* purpose);
+    void* allocateDMABuffer(size_t size, const char* purpose);
     TaskHandle_t createTaskWithPSRAMStack(TaskFunction_t taskFunction, 
                                           const char* taskName,
                                           uint32_t stackSize,
@@ -99,13 +205,39 @@ public:
     
     // 内存块信息查询
     std::vector<PSRAMBlockInfo> getAllocatedBlocks();
-    PSRAMBlockInfo* getBlockInfo(void* ptr);
+    bool getBlockInfo(void* ptr, PSRAMBlockInfo* info) const;
     uint32_t getBlockCount() const;
+    void getTrackerStats(AllocTrackerStats* stats) const;
+    
+    // 分配标签（用途/任务名驻留为整数ID，热点路径可预先驻留后调用allocateTagged）
+    uint16_t internTag(const char* name);
+    const char* getTagName(uint16_t tag) const;
+    
+    // 任务临时内存区（配合PSRAMArenaScope使用）
+    PSRAMArena* getTaskArena();
+    void releaseTaskArena(TaskHandle_t task, bool taskDeleted = false);  // 任务删除前/后调用，taskDeleted时强制释放
     
     // 内存池管理
     bool createPool(PSRAMPoolType type, size_t size);
     bool destroyPool(PSRAMPoolType type);
     size_t getPoolUsage(PSRAMPoolType type);
+    bool getPoolStats(PSRAMPoolType type, SlabPoolStats* stats) const;
+    
+    // 内存类别统计
+    bool getMemClassStats(MemClass memClass, MemClassStats* stats) const;
+    static const char* getMemClassName(MemClass memClass);
+    
+    // 内存压力调控
+    bool registerReclaimer(const char* name, MemReclaimPriority priority, uint32_t caps,
+                           MemReclaimCallback callback, void* userdata);
+    void unregisterReclaimer(MemReclaimCallback callback, void* userdata);
+    void setWatermarks(uint32_t caps, size_t low, size_t critical);
+    MemPressure getMemoryPressure(uint32_t caps) const;
+    MemPressure relieveMemoryPressure();
+    size_t reclaimMemory(size_t bytes, uint32_t caps, MemPressure pressure);
+    void getGovernorStats(MemGovernorStats* stats) const;
+    uint8_t getReclaimers(MemReclaimerStats* out, uint8_t max) const;
+    static const char* getPressureName(MemPressure pressure);
     
     // 内存优化和维护
     bool defragment();
@@ -118,6 +250,14 @@ public:
     String getStatusJSON();
     void setDebugMode(bool enabled);
     
+    // 分配剖析（尺寸/存活时间直方图、按标签和任务统计、堆水位、疑似泄漏）
+    void setProfilerEnabled(bool enabled);
+    bool isProfilerEnabled() const;
+    void resetProfiler();
+    void getProfileJSON(JsonDocument& doc);
+    size_t getProfileDumpSize() const;
+    size_t getProfileDump(uint8_t* out, size_t max) const;
+    
     // 性能监控回调
     typedef void (*PSRAMCallback)(PSRAMStatistics stats);
     void setMonitorCallback(PSRAMCallback callback);
@@ -129,40 +269,67 @@ private:
     TaskHandle_t m_monitorTaskHandle;
     SemaphoreHandle_t m_mutex;
     
-    // 内存池管理
-    struct MemoryPool {
-        void* baseAddress;
-        size_t totalSize;
-        size_t usedSize;
-        bool initialized;
-        
-        MemoryPool() : baseAddress(nullptr), totalSize(0), usedSize(0), initialized(false) {}
-    };
+    // 分级内存池（每种类型一个预分配区域）
+    PSRAMSlabPool m_pools[POOL_COUNT];
     
-    MemoryPool m_pools[POOL_COUNT];
+    // 分配块跟踪（PSRAM中的固定容量哈希表，分配/释放路径不访问堆）
+    PSRAMAllocTracker m_tracker;
+    uint32_t m_untrackedCount;     // 跟踪表满时未记录的在用块数
+    uint16_t m_defaultPurposeTag;
+    uint16_t m_alignedPurposeTag;
     
-    // 分配块跟踪
-    std::vector<PSRAMBlockInfo> m_allocatedBlocks;
-    std::map<void*, size_t> m_ptrSizeMap;
+    // 分配剖析器（统计表在PSRAM中，扫描和堆水位采样由监控任务驱动）
+    PSRAMAllocProfiler m_profiler;
     
-    // 统计数据
+    // 任务临时内存区（首次使用时按任务占用一个槽位）
+    struct TaskArenaSlot {
+        TaskHandle_t task;
+        uint16_t taskTag;
+        PSRAMArena arena;
+    };
+    TaskArenaSlot m_taskArenas[PSRAM_ARENA_MAX_TASKS];
+    portMUX_TYPE m_arenaMux;
+    
+    // 统计数据（分配计数在自旋锁内更新，堆信息由监控任务在互斥锁内刷新）
     PSRAMStatistics m_statistics;
+    MemClassStats m_classStats[MEM_CLASS_COUNT];
+    mutable portMUX_TYPE m_statsMux;
     PSRAMCallback m_monitorCallback;
     
+    // 内存压力调控（回收器表在m_governorMux内修改，回调在锁外按优先级调用）
+    struct Reclaimer {
+        MemReclaimCallback callback;
+        void* userdata;
+        MemReclaimerStats stats;
+    };
+    Reclaimer m_reclaimers[MEM_MAX_RECLAIMERS];
+    uint8_t m_reclaimerCount;
+    bool m_reclaiming;              // 防止回收重入（回调中的释放/分配、多个任务同时回收）
+    size_t m_internalLow;
+    size_t m_internalCritical;
+    size_t m_psramLow;
+    size_t m_psramCritical;
+    uint32_t m_lastPressureCheck;
+    MemGovernorStats m_governorStats;
+    mutable portMUX_TYPE m_governorMux;
+    
     // 内部方法
     static void monitorTask(void* parameter);
     void updateStatistics();
-    void cleanupExpiredBlocks();
-    String getCurrentTaskName();
-    String getPoolName(PSRAMPoolType pool);
-    void logAllocation(void* ptr, size_t size, const String& purpose);
+    void updateProfiler();
+    uint16_t getCurrentTaskTag();
+    const char* getPoolName(PSRAMPoolType pool) const;
+    void* allocateRaw(size_t size, uint32_t caps, size_t alignment, MemPlacement placement,
+                      PSRAMPoolType pool, uint8_t* memClass);
+    void* allocateFromClass(MemClass memClass, size_t size, size_t alignment,
+                            PSRAMPoolType pool, bool fallback);
+    bool poolEligible(PSRAMPoolType pool, size_t size, size_t alignment) const;
+    void freeRaw(void* ptr);
+    static MemPressure pressureOf(size_t free, size_t low, size_t critical);
+    void logAllocation(void* ptr, size_t size, uint16_t purposeTag);
     void logDeallocation(void* ptr);
     bool isValidPSRAMAddress(void* ptr);
     
-    // 内存对齐辅助函数
-    size_t alignSize(size_t size, size_t alignment);
-    void* alignAddress(void* addr, size_t alignment);
-    
     // 线程安全辅助
     bool takeMutex(TickType_t timeout = pdMS_TO_TICKS(1000));
     void giveMutex();
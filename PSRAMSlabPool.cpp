@@ -0,0 +1,196 @@
+/*
+ * PSRAMSlabPool.cpp - PSRAM分级内存池实现文件
+ * ESP32S3监控项目 - PSRAM内存管理模块
+ */
+
+#include "PSRAMSlabPool.h"
+#include <stdio.h>
+#include <string.h>
+#include "esp_heap_caps.h"
+
+PSRAMSlabPool::PSRAMSlabPool()
+    : m_region(nullptr)
+    , m_regionBytes(0)
+    , m_classCount(0)
+    , m_allocs(0)
+    , m_frees(0)
+    , m_fallbacks(0)
+    , m_badFrees(0)
+    , m_mux(portMUX_INITIALIZER_UNLOCKED) {
+    memset(m_classes, 0, sizeof(m_classes));
+}
+
+PSRAMSlabPool::~PSRAMSlabPool() {
+    if (m_region) {
+        heap_caps_free(m_region);
+        m_region = nullptr;
+    }
+}
+
+bool PSRAMSlabPool::init(size_t bytes, const SlabClassLayout* layout, uint8_t class_count, uint32_t caps) {
+    if (m_region || !layout || class_count == 0 || class_count > SLAB_POOL_MAX_CLASSES) {
+        return false;
+    }
+
+    // 先按百分比计算每级块数（至少1块），再一次性分配整块区域
+    SizeClass classes[SLAB_POOL_MAX_CLASSES];
+    memset(classes, 0, sizeof(classes));
+    size_t total = 0;
+    for (uint8_t i = 0; i < class_count; i++) {
+        uint32_t block = (layout[i].block_size + SLAB_POOL_ALIGNMENT - 1) & ~(uint32_t)(SLAB_POOL_ALIGNMENT - 1);
+        size_t count = bytes * layout[i].share_percent / 100 / block;
+        if (count == 0) {
+            count = 1;
+        } else if (count > UINT16_MAX) {
+            count = UINT16_MAX;
+        }
+        classes[i].blockSize = block;
+        classes[i].blockCount = (uint16_t)count;
+        total += (size_t)block * count;
+    }
+
+    uint8_t* region = (uint8_t*)heap_caps_aligned_alloc(SLAB_POOL_ALIGNMENT, total, caps);
+    if (!region) {
+        return false;
+    }
+
+    // 切分区域并把每级的块串成空闲链表（低地址在前）
+    uint8_t* cursor = region;
+    for (uint8_t i = 0; i < class_count; i++) {
+        SizeClass& c = classes[i];
+        c.begin = cursor;
+        c.end = cursor + (size_t)c.blockSize * c.blockCount;
+        c.freeList = nullptr;
+        for (int b = c.blockCount - 1; b >= 0; b--) {
+            void* block = c.begin + (size_t)b * c.blockSize;
+            *(void**)block = c.freeList;
+            c.freeList = block;
+        }
+        cursor = c.end;
+    }
+
+    portENTER_CRITICAL(&m_mux);
+    memcpy(m_classes, classes, sizeof(m_classes));
+    m_classCount = class_count;
+    m_regionBytes = total;
+    m_region = region;
+    portEXIT_CRITICAL(&m_mux);
+    return true;
+}
+
+bool PSRAMSlabPool::deinit() {
+    if (!m_region) {
+        return true;
+    }
+
+    portENTER_CRITICAL(&m_mux);
+    for (uint8_t i = 0; i < m_classCount; i++) {
+        if (m_classes[i].inUse > 0) {
+            portEXIT_CRITICAL(&m_mux);
+            return false;
+        }
+    }
+    uint8_t* region = m_region;
+    m_region = nullptr;
+    m_regionBytes = 0;
+    m_classCount = 0;
+    portEXIT_CRITICAL(&m_mux);
+
+    heap_caps_free(region);
+    return true;
+}
+
+void* PSRAMSlabPool::alloc(size_t size) {
+    if (!m_region || size == 0) {
+        return nullptr;
+    }
+
+    void* block = nullptr;
+    portENTER_CRITICAL(&m_mux);
+    for (uint8_t i = 0; i < m_classCount; i++) {
+        SizeClass& c = m_classes[i];
+        if (c.blockSize < size) {
+            continue;
+        }
+        if (!c.freeList) {
+            // 本级别已满，向上借用更大的块
+            c.exhausted++;
+            continue;
+        }
+        block = c.freeList;
+        c.freeList = *(void**)block;
+        c.inUse++;
+        if (c.inUse > c.peak) {
+            c.peak = c.inUse;
+        }
+        c.allocs++;
+        m_allocs++;
+        break;
+    }
+    portEXIT_CRITICAL(&m_mux);
+    return block;
+}
+
+bool PSRAMSlabPool::free(void* ptr) {
+    if (!ptr || !owns(ptr)) {
+        return false;
+    }
+
+    uint8_t* p = (uint8_t*)ptr;
+    portENTER_CRITICAL(&m_mux);
+    for (uint8_t i = 0; i < m_classCount; i++) {
+        SizeClass& c = m_classes[i];
+        if (p < c.begin || p >= c.end) {
+            continue;
+        }
+        if ((size_t)(p - c.begin) % c.blockSize != 0 || c.inUse == 0) {
+            m_badFrees++;
+            break;
+        }
+        *(void**)p = c.freeList;
+        c.freeList = p;
+        c.inUse--;
+        m_frees++;
+        break;
+    }
+    portEXIT_CRITICAL(&m_mux);
+
+    // 区域内的指针都由本池负责，不能交给系统堆释放
+    return true;
+}
+
+void PSRAMSlabPool::noteFallback() {
+    portENTER_CRITICAL(&m_mux);
+    m_fallbacks++;
+    portEXIT_CRITICAL(&m_mux);
+}
+
+size_t PSRAMSlabPool::maxBlockSize() const {
+    return m_classCount ? m_classes[m_classCount - 1].blockSize : 0;
+}
+
+void PSRAMSlabPool::getStats(SlabPoolStats* stats) const {
+    if (!stats) {
+        return;
+    }
+    memset(stats, 0, sizeof(SlabPoolStats));
+
+    portENTER_CRITICAL(&m_mux);
+    stats->region_bytes = m_regionBytes;
+    stats->allocs = m_allocs;
+    stats->frees = m_frees;
+    stats->fallbacks = m_fallbacks;
+    stats->bad_frees = m_badFrees;
+    stats->class_count = m_classCount;
+    for (uint8_t i = 0; i < m_classCount; i++) {
+        const SizeClass& c = m_classes[i];
+        stats->classes[i].block_size = c.blockSize;
+        stats->classes[i].block_count = c.blockCount;
+        stats->classes[i].in_use = c.inUse;
+        stats->classes[i].peak = c.peak;
+        stats->classes[i].allocs = c.allocs;
+        stats->classes[i].exhausted = c.exhausted;
+        stats->used_bytes += (size_t)c.blockSize * c.inUse;
+    }
+    portEXIT_CRITICAL(&m_mux);
+}
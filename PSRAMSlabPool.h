@@ -0,0 +1,144 @@
+/*
+ * PSRAMSlabPool.h - PSRAM分级内存池头文件
+ * ESP32S3监控项目 - PSRAM内存管理模块
+ *
+ * 功能特性：
+ * - 一次性预分配一块PSRAM区域，按块大小分级切成若干段，每段等大小块
+ * - 每级空闲块用侵入式单链表串起，分配/释放O(1)，不访问系统堆
+ * - 请求大小对应的级别用完时向上借用更大的级别，全部用完返回nullptr由调用方回退
+ * - 按地址范围判断归属，释放时检查块边界，防止错误指针破坏空闲链表
+ * - 每级统计使用块数、峰值、分配次数、耗尽次数
+ *
+ * 临界区只有链表操作，使用自旋锁，任意任务可调用
+ */
+
+#ifndef PSRAM_SLAB_POOL_H
+#define PSRAM_SLAB_POOL_H
+
+#include <stdint.h>
+#include <stddef.h>
+#include "freertos/FreeRTOS.h"
+
+#define SLAB_POOL_MAX_CLASSES   6       // 每个内存池最多的块大小级别
+#define SLAB_POOL_ALIGNMENT     32      // 区域和块大小的对齐（满足DMA和缓存行对齐）
+
+/**
+ * @brief 内存池级别布局（块大小 + 占内存池容量的百分比）
+ */
+struct SlabClassLayout {
+    uint32_t block_size;        ///< 块大小（字节，按SLAB_POOL_ALIGNMENT向上取整）
+    uint8_t share_percent;      ///< 该级别占内存池容量的百分比
+};
+
+/**
+ * @brief 单个级别的统计
+ */
+struct SlabClassStats {
+    uint32_t block_size;        ///< 块大小
+    uint16_t block_count;       ///< 块总数
+    uint16_t in_use;            ///< 当前使用块数
+    uint16_t peak;              ///< 峰值使用块数
+    uint32_t allocs;            ///< 分配次数
+    uint32_t exhausted;         ///< 该级别已满、向上借用或回退的次数
+};
+
+/**
+ * @brief 内存池统计
+ */
+struct SlabPoolStats {
+    size_t region_bytes;        ///< 预分配区域大小
+    size_t used_bytes;          ///< 已使用字节（按块大小计）
+    uint32_t allocs;            ///< 池内分配次数
+    uint32_t frees;             ///< 池内释放次数
+    uint32_t fallbacks;         ///< 回退到系统堆的次数（由调用方记录）
+    uint32_t bad_frees;         ///< 落在区域内但不是块起始地址的释放
+    uint8_t class_count;        ///< 级别数
+    SlabClassStats classes[SLAB_POOL_MAX_CLASSES];
+};
+
+/**
+ * @brief PSRAM分级内存池
+ */
+class PSRAMSlabPool {
+public:
+    PSRAMSlabPool();
+    ~PSRAMSlabPool();
+
+    /**
+     * @brief 预分配区域并按布局切分
+     *
+     * @param bytes 内存池总容量
+     * @param layout 级别布局（按块大小升序）
+     * @param class_count 级别数（不超过SLAB_POOL_MAX_CLASSES）
+     * @param caps 区域分配能力（MALLOC_CAP_SPIRAM等）
+     * @return true 成功，false 区域分配失败
+     */
+    bool init(size_t bytes, const SlabClassLayout* layout, uint8_t class_count, uint32_t caps);
+
+    /**
+     * @brief 释放预分配区域（仍有块在使用时拒绝）
+     */
+    bool deinit();
+
+    bool isInitialized() const { return m_region != nullptr; }
+
+    /**
+     * @brief 分配一个能容纳size字节的块
+     *
+     * @return 块地址；没有足够大的级别或所有合适级别已满时返回nullptr
+     */
+    void* alloc(size_t size);
+
+    /**
+     * @brief 释放块
+     *
+     * @return true 已归还到池中，false 指针不属于本池
+     */
+    bool free(void* ptr);
+
+    /**
+     * @brief 指针是否位于本池区域内
+     */
+    bool owns(const void* ptr) const {
+        return (const uint8_t*)ptr >= m_region && (const uint8_t*)ptr < m_region + m_regionBytes;
+    }
+
+    /**
+     * @brief 记录一次回退到系统堆（调用方在alloc返回nullptr后调用）
+     */
+    void noteFallback();
+
+    /**
+     * @brief 可分配的最大块大小
+     */
+    size_t maxBlockSize() const;
+
+    void getStats(SlabPoolStats* stats) const;
+
+private:
+    struct SizeClass {
+        uint8_t* begin;             ///< 本级别块区起始
+        uint8_t* end;               ///< 本级别块区结束
+        uint32_t blockSize;
+        uint16_t blockCount;
+        uint16_t inUse;
+        uint16_t peak;
+        void* freeList;             ///< 空闲块单链表（下一块指针存放在空闲块开头）
+        uint32_t allocs;
+        uint32_t exhausted;
+    };
+
+    uint8_t* m_region;
+    size_t m_regionBytes;
+    SizeClass m_classes[SLAB_POOL_MAX_CLASSES];
+    uint8_t m_classCount;
+
+    uint32_t m_allocs;
+    uint32_t m_frees;
+    uint32_t m_fallbacks;
+    uint32_t m_badFrees;
+
+    mutable portMUX_TYPE m_mux;
+};
+
+#endif // PSRAM_SLAB_POOL_H
@@ -0,0 +1,754 @@
+/*
+ * PowerDisplayUpdater.cpp - 功率数据显示更新实现文件
+ * ESP32S3监控项目 - 功率显示模块
+ */
+
+#include "PowerDisplayUpdater.h"
+#include "ui.h"
+#include "ui2.h"
+#include <cstring>
+#include <cstdio>
+
+/**
+ * @brief 更新功率数据显示（总功率、端口功率和端口功率页面）
+ */
+void PowerDisplayUpdater::updatePowerData(const PowerMonitorData& data, bool ui2System) {
+    // 根据当前主题更新相应的功率显示
+    if (!ui2System) {
+        // UI1系统的功率显示
+        if (ui_totalpowerlabel && data.valid) {
+            char total_power_str[16];
+            snprintf(total_power_str, sizeof(total_power_str), "%.1fW", data.total_power / 1000.0f);
+            lv_label_set_text(ui_totalpowerlabel, total_power_str);
+        }
+        
+        if (data.valid) {
+            // 端口1
+            if (ui_port1power && data.ports[0].valid) {
+                char port1_str[16];
+                snprintf(port1_str, sizeof(port1_str), "%.2fW", data.ports[0].power / 1000.0f);
+                lv_label_set_text(ui_port1power, port1_str);
+            }
+            
+            // 端口2
+            if (ui_port2power && data.ports[1].valid) {
+                char port2_str[16];
+                snprintf(port2_str, sizeof(port2_str), "%.2fW", data.ports[1].power / 1000.0f);
+                lv_label_set_text(ui_port2power, port2_str);
+            }
+            
+            // 端口3
+            if (ui_port3power && data.ports[2].valid) {
+                char port3_str[16];
+                snprintf(port3_str, sizeof(port3_str), "%.2fW", data.ports[2].power / 1000.0f);
+                lv_label_set_text(ui_port3power, port3_str);
+            }
+            
+            // 端口4
+            if (ui_port4power && data.ports[3].valid) {
+                char port4_str[16];
+                snprintf(port4_str, sizeof(port4_str), "%.2fW", data.ports[3].power / 1000.0f);
+                lv_label_set_text(ui_port4power, port4_str);
+            }
+            
+            // 更新功率条显示
+            updatePowerBars(data);
+        }
+    } else {
+        // UI2系统的功率显示
+        if (ui2_totalpowerlabel && data.valid) {
+            char total_power_str[16];
+            snprintf(total_power_str, sizeof(total_power_str), "%.1fW", data.total_power / 1000.0f);
+            lv_label_set_text(ui2_totalpowerlabel, total_power_str);
+        }
+        
+        if (data.valid) {
+            // UI2系统的端口功率显示
+            if (ui2_port1power && data.ports[0].valid) {
+                char port1_str[16];
+                snprintf(port1_str, sizeof(port1_str), "%.2fW", data.ports[0].power / 1000.0f);
+                lv_label_set_text(ui2_port1power, port1_str);
+            }
+            
+            if (ui2_port2power && data.ports[1].valid) {
+                char port2_str[16];
+                snprintf(port2_str, sizeof(port2_str), "%.2fW", data.ports[1].power / 1000.0f);
+                lv_label_set_text(ui2_port2power, port2_str);
+            }
+            
+            if (ui2_port3power && data.ports[2].valid) {
+                char port3_str[16];
+                snprintf(port3_str, sizeof(port3_str), "%.2fW", data.ports[2].power / 1000.0f);
+                lv_label_set_text(ui2_port3power, port3_str);
+            }
+            
+            if (ui2_port4power && data.ports[3].valid) {
+                char port4_str[16];
+                snprintf(port4_str, sizeof(port4_str), "%.2fW", data.ports[3].power / 1000.0f);
+                lv_label_set_text(ui2_port4power, port4_str);
+            }
+            
+            // UI2系统的电压和电流显示
+            if (ui2_port1voltage && data.ports[0].valid) {
+                char voltage_str[16];
+                snprintf(voltage_str, sizeof(voltage_str), "%.2fV", data.ports[0].voltage / 1000.0f);
+                lv_label_set_text(ui2_port1voltage, voltage_str);
+            }
+            
+            if (ui2_port1current && data.ports[0].valid) {
+                char current_str[16];
+                snprintf(current_str, sizeof(current_str), "%.2fA", data.ports[0].current / 1000.0f);
+                lv_label_set_text(ui2_port1current, current_str);
+            }
+            
+            if (ui2_port2voltage && data.ports[1].valid) {
+                char voltage_str[16];
+                snprintf(voltage_str, sizeof(voltage_str), "%.2fV", data.ports[1].voltage / 1000.0f);
+                lv_label_set_text(ui2_port2voltage, voltage_str);
+            }
+            
+            if (ui2_port2current && data.ports[1].valid) {
+                char current_str[16];
+                snprintf(current_str, sizeof(current_str), "%.2fA", data.ports[1].current / 1000.0f);
+                lv_label_set_text(ui2_port2current, current_str);
+            }
+            
+            if (ui2_port3voltage && data.ports[2].valid) {
+                char voltage_str[16];
+                snprintf(voltage_str, sizeof(voltage_str), "%.2fV", data.ports[2].voltage / 1000.0f);
+                lv_label_set_text(ui2_port3voltage, voltage_str);
+            }
+            
+            if (ui2_port3current && data.ports[2].valid) {
+                char current_str[16];
+                snprintf(current_str, sizeof(current_str), "%.2fA", data.ports[2].current / 1000.0f);
+                lv_label_set_text(ui2_port3current, current_str);
+            }
+            
+            if (ui2_port4voltage && data.ports[3].valid) {
+                char voltage_str[16];
+                snprintf(voltage_str, sizeof(voltage_str), "%.2fV", data.ports[3].voltage / 1000.0f);
+                lv_label_set_text(ui2_port4voltage, voltage_str);
+            }
+            
+            if (ui2_port4current && data.ports[3].valid) {
+                char current_str[16];
+                snprintf(current_str, sizeof(current_str), "%.2fA", data.ports[3].current / 1000.0f);
+                lv_label_set_text(ui2_port4current, current_str);
+            }
+            
+            // UI2系统端口详细页面的数据更新
+            updateUI2PortDetailPages(data);
+        }
+    }
+    
+    // 更新端口功率页面的详细信息
+    if (data.valid) {
+        // 端口1功率页面
+        if (ui_port1powerlabel && data.ports[0].valid) {
+            char port1_power_str[16];
+            snprintf(port1_power_str, sizeof(port1_power_str), "%.3fW", data.ports[0].power / 1000.0f);
+            lv_label_set_text(ui_port1powerlabel, port1_power_str);
+        }
+        if (ui_port1voltage && data.ports[0].valid) {
+            char port1_voltage_str[16];
+            snprintf(port1_voltage_str, sizeof(port1_voltage_str), "%.3fV", data.ports[0].voltage / 1000.0f);
+            lv_label_set_text(ui_port1voltage, port1_voltage_str);
+        }
+        if (ui_port1current && data.ports[0].valid) {
+            char port1_current_str[16];
+            snprintf(port1_current_str, sizeof(port1_current_str), "%.3fA", data.ports[0].current / 1000.0f);
+            lv_label_set_text(ui_port1current, port1_current_str);
+        }
+        
+        // 端口2功率页面
+        if (ui_port2powerlabel && data.ports[1].valid) {
+            char port2_power_str[16];
+            snprintf(port2_power_str, sizeof(port2_power_str), "%.3fW", data.ports[1].power / 1000.0f);
+            lv_label_set_text(ui_port2powerlabel, port2_power_str);
+        }
+        if (ui_port2voltage && data.ports[1].valid) {
+            char port2_voltage_str[16];
+            snprintf(port2_voltage_str, sizeof(port2_voltage_str), "%.3fV", data.ports[1].voltage / 1000.0f);
+            lv_label_set_text(ui_port2voltage, port2_voltage_str);
+        }
+        if (ui_port2current && data.ports[1].valid) {
+            char port2_current_str[16];
+            snprintf(port2_current_str, sizeof(port2_current_str), "%.3fA", data.ports[1].current / 1000.0f);
+            lv_label_set_text(ui_port2current, port2_current_str);
+        }
+        
+        // 端口3功率页面
+        if (ui_port3powerlabel && data.ports[2].valid) {
+            char port3_power_str[16];
+            snprintf(port3_power_str, sizeof(port3_power_str), "%.3fW", data.ports[2].power / 1000.0f);
+            lv_label_set_text(ui_port3powerlabel, port3_power_str);
+        }
+        if (ui_port3voltage && data.ports[2].valid) {
+            char port3_voltage_str[16];
+            snprintf(port3_voltage_str, sizeof(port3_voltage_str), "%.3fV", data.ports[2].voltage / 1000.0f);
+            lv_label_set_text(ui_port3voltage, port3_voltage_str);
+        }
+        if (ui_port3current && data.ports[2].valid) {
+            char port3_current_str[16];
+            snprintf(port3_current_str, sizeof(port3_current_str), "%.3fA", data.ports[2].current / 1000.0f);
+            lv_label_set_text(ui_port3current, port3_current_str);
+        }
+        
+        // 端口4功率页面
+        if (ui_port4powerlabel && data.ports[3].valid) {
+            char port4_power_str[16];
+            snprintf(port4_power_str, sizeof(port4_power_str), "%.3fW", data.ports[3].power / 1000.0f);
+            lv_label_set_text(ui_port4powerlabel, port4_power_str);
+        }
+        if (ui_port4voltage && data.ports[3].valid) {
+            char port4_voltage_str[16];
+            snprintf(port4_voltage_str, sizeof(port4_voltage_str), "%.3fV", data.ports[3].voltage / 1000.0f);
+            lv_label_set_text(ui_port4voltage, port4_voltage_str);
+        }
+        if (ui_port4current && data.ports[3].valid) {
+            char port4_current_str[16];
+            snprintf(port4_current_str, sizeof(port4_current_str), "%.3fA", data.ports[3].current / 1000.0f);
+            lv_label_set_text(ui_port4current, port4_current_str);
+        }
+    }
+}
+
+/**
+ * @brief 更新功率条显示
+ */
+void PowerDisplayUpdater::updatePowerBars(const PowerMonitorData& data) {
+    // 计算功率条的比例 (基于最大功率100W)
+    const float MAX_POWER = 100000.0f; // 100W in mW
+    
+    if (ui_port1powerbar && data.ports[0].valid) {
+        float ratio = data.ports[0].power / MAX_POWER;
+        if (ratio > 1.0f) ratio = 1.0f;
+        lv_bar_set_value(ui_port1powerbar, (int32_t)(ratio * 100), LV_ANIM_ON);
+    }
+    
+    if (ui_port2powerbar && data.ports[1].valid) {
+        float ratio = data.ports[1].power / MAX_POWER;
+        if (ratio > 1.0f) ratio = 1.0f;
+        lv_bar_set_value(ui_port2powerbar, (int32_t)(ratio * 100), LV_ANIM_ON);
+    }
+    
+    if (ui_port3powerbar && data.ports[2].valid) {
+        float ratio = data.ports[2].power / MAX_POWER;
+        if (ratio > 1.0f) ratio = 1.0f;
+        lv_bar_set_value(ui_port3powerbar, (int32_t)(ratio * 100), LV_ANIM_ON);
+    }
+    
+    if (ui_port4powerbar && data.ports[3].valid) {
+        float ratio = data.ports[3].power / MAX_POWER;
+        if (ratio > 1.0f) ratio = 1.0f;
+        lv_bar_set_value(ui_port4powerbar, (int32_t)(ratio * 100), LV_ANIM_ON);
+    }
+}
+
+/**
+ * @brief 更新端口详细信息显示
+ */
+void PowerDisplayUpdater::updatePortDetail(const PowerMonitorData& data, int port_index) {
+    if (port_index < 0 || port_index >= 4 || !data.ports[port_index].valid) {
+        return;
+    }
+    
+    // 获取当前端口的数据
+    const PortData& portData = data.ports[port_index];
+    
+    // 根据端口索引更新对应的详细屏幕标签
+    lv_obj_t* state_label = nullptr;
+    lv_obj_t* protocol_label = nullptr;
+    lv_obj_t* manufacturer_label = nullptr;
+    lv_obj_t* cable_label = nullptr;
+    lv_obj_t* voltage_label = nullptr;
+    lv_obj_t* current_label = nullptr;
+    
+    // 根据端口索引获取对应的UI组件
+    switch (port_index) {
+        case 0:
+            state_label = ui_port1state;
+            protocol_label = ui_port1protocol;
+            manufacturer_label = ui_port1manufactuervid;
+            cable_label = ui_port1cablevid;
+            voltage_label = ui_port1maxvbusvoltage;
+            current_label = ui_port1maxvbuscurrent;
+            break;
+        case 1:
+            state_label = ui_port2state;
+            protocol_label = ui_port2protocol;
+            manufacturer_label = ui_port2manufactuervid;
+            cable_label = ui_port2cablevid;
+            voltage_label = ui_port2maxvbusvoltage;
+            current_label = ui_port2maxvbuscurrent;
+            break;
+        case 2:
+            state_label = ui_port3state;
+            protocol_label = ui_port3protocol;
+            manufacturer_label = ui_port3manufactuervid;
+            cable_label = ui_port3cablevid;
+            voltage_label = ui_port3maxvbusvoltage;
+            current_label = ui_port3maxvbuscurrent;
+            break;
+        case 3:
+            state_label = ui_port4state;
+            protocol_label = ui_port4protocol;
+            manufacturer_label = ui_port4manufactuervid;
+            cable_label = ui_port4cablevid;
+            voltage_label = ui_port4maxvbusvoltage;
+            current_label = ui_port4maxvbuscurrent;
+            break;
+    }
+    
+    // 更新状态显示
+    if (state_label) {
+        const char* state_text;
+        if (strcmp(portData.state, "ATTACHED") == 0) {
+            state_text = "已开启\n已连接";
+        } else if (strcmp(portData.state, "ACTIVE") == 0) {
+            state_text = "已开启\n未连接";
+        } else {
+            state_text = "未知状态";
+        }
+        lv_label_set_text(state_label, state_text);
+    }
+    
+    // 更新协议显示
+    if (protocol_label) {
+        if (strlen(portData.protocol_name) > 0) {
+            lv_label_set_text(protocol_label, portData.protocol_name);
+        } else {
+            lv_label_set_text(protocol_label, "未知");
+        }
+    }
+    
+    // 更新制造商VID显示
+    if (manufacturer_label) {
+        if (portData.manufacturer_vid > 0) {
+            char manufacturer_str[16];
+            snprintf(manufacturer_str, sizeof(manufacturer_str), "0x%04X", portData.manufacturer_vid);
+            lv_label_set_text(manufacturer_label, manufacturer_str);
+        } else {
+            lv_label_set_text(manufacturer_label, "未知");
+        }
+    }
+    
+    // 更新线缆VID显示
+    if (cable_label) {
+        if (portData.cable_vid > 0) {
+            char cable_str[16];
+            snprintf(cable_str, sizeof(cable_str), "0x%04X", portData.cable_vid);
+            lv_label_set_text(cable_label, cable_str);
+        } else {
+            lv_label_set_text(cable_label, "未知");
+        }
+    }
+    
+    // 更新最大电压显示
+    if (voltage_label) {
+        if (portData.cable_max_vbus_voltage > 0) {
+            char voltage_str[16];
+            snprintf(voltage_str, sizeof(voltage_str), "%.1fV", portData.cable_max_vbus_voltage / 1000.0f);
+            lv_label_set_text(voltage_label, voltage_str);
+        } else {
+            lv_label_set_text(voltage_label, "未知");
+        }
+    }
+    
+    // 更新最大电流显示
+    if (current_label) {
+        if (portData.cable_max_vbus_current > 0) {
+            char current_str[16];
+            snprintf(current_str, sizeof(current_str), "%.2fA", portData.cable_max_vbus_current / 1000.0f);
+            lv_label_set_text(current_label, current_str);
+        } else {
+            lv_label_set_text(current_label, "未知");
+        }
+    }
+}
+
+/**
+ * @brief 更新UI2系统端口详细页面数据
+ */
+void PowerDisplayUpdater::updateUI2PortDetailPages(const PowerMonitorData& data) {
+    if (!data.valid) {
+        return;
+    }
+    
+    // 更新端口1详细页面
+    if (data.ports[0].valid) {
+        // 电压显示
+        if (ui2_port1voltage1) {
+            char voltage_str[16];
+            snprintf(voltage_str, sizeof(voltage_str), "%.3fV", data.ports[0].voltage / 1000.0f);
+            lv_label_set_text(ui2_port1voltage1, voltage_str);
+        }
+        
+        // 电流显示
+        if (ui2_port1current1) {
+            char current_str[16];
+            snprintf(current_str, sizeof(current_str), "%.3fA", data.ports[0].current / 1000.0f);
+            lv_label_set_text(ui2_port1current1, current_str);
+        }
+        
+        // 功率显示
+        if (ui2_port1powerlabel) {
+            char power_str[16];
+            snprintf(power_str, sizeof(power_str), "%.3fW", data.ports[0].power / 1000.0f);
+            lv_label_set_text(ui2_port1powerlabel, power_str);
+        }
+        
+        // 活动状态显示
+        if (ui2_port1active) {
+            lv_label_set_text(ui2_port1active, data.ports[0].state ? "已开启" : "未开启");
+        }
+        
+        // 连接状态显示
+        if (ui2_port1state) {
+            lv_label_set_text(ui2_port1state, data.ports[0].state ? "已连接" : "未连接");
+        }
+        
+        // 协议显示
+        if (ui2_port1protocol) {
+            lv_label_set_text(ui2_port1protocol, strlen(data.ports[0].protocol_name) > 0 ? data.ports[0].protocol_name : "未知");
+        }
+        
+        // 制造商VID
+        if (ui2_port1manufactuervid) {
+            if (data.ports[0].manufacturer_vid > 0) {
+                char vid_str[16];
+                snprintf(vid_str, sizeof(vid_str), "0x%04X", data.ports[0].manufacturer_vid);
+                lv_label_set_text(ui2_port1manufactuervid, vid_str);
+            } else {
+                lv_label_set_text(ui2_port1manufactuervid, "未知");
+            }
+        }
+        
+        // 线缆VID
+        if (ui2_port1cablevid) {
+            if (data.ports[0].cable_vid > 0) {
+                char vid_str[16];
+                snprintf(vid_str, sizeof(vid_str), "0x%04X", data.ports[0].cable_vid);
+                lv_label_set_text(ui2_port1cablevid, vid_str);
+            } else {
+                lv_label_set_text(ui2_port1cablevid, "未知");
+            }
+        }
+        
+        // 协议握手功率显示
+        if (ui2_port1protocolpower) {
+            if (data.ports[0].protocol_handshake_power > 0) {
+                char protocol_power_str[16];
+                snprintf(protocol_power_str, sizeof(protocol_power_str), "%.1fW", data.ports[0].protocol_handshake_power / 1000.0f);
+                lv_label_set_text(ui2_port1protocolpower, protocol_power_str);
+            } else {
+                lv_label_set_text(ui2_port1protocolpower, "--W");
+            }
+        }
+        
+        // 最大电压
+        if (ui2_port1maxvbusvoltage) {
+            if (data.ports[0].cable_max_vbus_voltage > 0) {
+                char voltage_str[16];
+                snprintf(voltage_str, sizeof(voltage_str), "%.1fV", data.ports[0].cable_max_vbus_voltage / 1000.0f);
+                lv_label_set_text(ui2_port1maxvbusvoltage, voltage_str);
+            } else {
+                lv_label_set_text(ui2_port1maxvbusvoltage, "未知");
+            }
+        }
+        
+        // 最大电流
+        if (ui2_port1maxvbuscurrent) {
+            if (data.ports[0].cable_max_vbus_current > 0) {
+                char current_str[16];
+                snprintf(current_str, sizeof(current_str), "%.2fA", data.ports[0].cable_max_vbus_current / 1000.0f);
+                lv_label_set_text(ui2_port1maxvbuscurrent, current_str);
+            } else {
+                lv_label_set_text(ui2_port1maxvbuscurrent, "未知");
+            }
+        }
+    }
+    
+    // 更新端口2详细页面
+    if (data.ports[1].valid) {
+        // 电压显示
+        if (ui2_port2voltage1) {
+            char voltage_str[16];
+            snprintf(voltage_str, sizeof(voltage_str), "%.3fV", data.ports[1].voltage / 1000.0f);
+            lv_label_set_text(ui2_port2voltage1, voltage_str);
+        }
+        
+        // 电流显示
+        if (ui2_port2current1) {
+            char current_str[16];
+            snprintf(current_str, sizeof(current_str), "%.3fA", data.ports[1].current / 1000.0f);
+            lv_label_set_text(ui2_port2current1, current_str);
+        }
+        
+        // 活动状态显示（powerlabel实际上是状态标签）
+        if (ui2_port2powerlabel) {
+            lv_label_set_text(ui2_port2powerlabel, data.ports[1].state ? "已开启" : "未开启");
+        }
+        
+        // 功率显示（powerlabel1才是真正的功率标签）
+        if (ui2_port2powerlabel1) {
+            char power_str[16];
+            snprintf(power_str, sizeof(power_str), "%.3fW", data.ports[1].power / 1000.0f);
+            lv_label_set_text(ui2_port2powerlabel1, power_str);
+        }
+        
+        // 状态显示
+        if (ui2_port2state) {
+            lv_label_set_text(ui2_port2state, data.ports[1].state ? "已连接" : "未连接");
+        }
+        
+        // 协议显示
+        if (ui2_port2protocol) {
+            lv_label_set_text(ui2_port2protocol, strlen(data.ports[1].protocol_name) > 0 ? data.ports[1].protocol_name : "未知");
+        }
+        
+        // 制造商VID
+        if (ui2_port2manufactuervid) {
+            if (data.ports[1].manufacturer_vid > 0) {
+                char vid_str[16];
+                snprintf(vid_str, sizeof(vid_str), "0x%04X", data.ports[1].manufacturer_vid);
+                lv_label_set_text(ui2_port2manufactuervid, vid_str);
+            } else {
+                lv_label_set_text(ui2_port2manufactuervid, "未知");
+            }
+        }
+        
+        // 线缆VID
+        if (ui2_port2cablevid) {
+            if (data.ports[1].cable_vid > 0) {
+                char vid_str[16];
+                snprintf(vid_str, sizeof(vid_str), "0x%04X", data.ports[1].cable_vid);
+                lv_label_set_text(ui2_port2cablevid, vid_str);
+            } else {
+                lv_label_set_text(ui2_port2cablevid, "未知");
+            }
+        }
+        
+        // 协议握手功率显示
+        if (ui2_port2protocolpower) {
+            if (data.ports[1].protocol_handshake_power > 0) {
+                char protocol_power_str[16];
+                snprintf(protocol_power_str, sizeof(protocol_power_str), "%.1fW", data.ports[1].protocol_handshake_power / 1000.0f);
+                lv_label_set_text(ui2_port2protocolpower, protocol_power_str);
+            } else {
+                lv_label_set_text(ui2_port2protocolpower, "--W");
+            }
+        }
+        
+        // 最大电压
+        if (ui2_port2maxvbusvoltage) {
+            if (data.ports[1].cable_max_vbus_voltage > 0) {
+                char voltage_str[16];
+                snprintf(voltage_str, sizeof(voltage_str), "%.1fV", data.ports[1].cable_max_vbus_voltage / 1000.0f);
+                lv_label_set_text(ui2_port2maxvbusvoltage, voltage_str);
+            } else {
+                lv_label_set_text(ui2_port2maxvbusvoltage, "未知");
+            }
+        }
+        
+        // 最大电流
+        if (ui2_port2maxvbuscurrent) {
+            if (data.ports[1].cable_max_vbus_current > 0) {
+                char current_str[16];
+                snprintf(current_str, sizeof(current_str), "%.2fA", data.ports[1].cable_max_vbus_current / 1000.0f);
+                lv_label_set_text(ui2_port2maxvbuscurrent, current_str);
+            } else {
+                lv_label_set_text(ui2_port2maxvbuscurrent, "未知");
+            }
+        }
+    }
+    
+    // 更新端口3详细页面
+    if (data.ports[2].valid) {
+        // 电压显示
+        if (ui2_port3voltage1) {
+            char voltage_str[16];
+            snprintf(voltage_str, sizeof(voltage_str), "%.3fV", data.ports[2].voltage / 1000.0f);
+            lv_label_set_text(ui2_port3voltage1, voltage_str);
+        }
+        
+        // 电流显示
+        if (ui2_port3current1) {
+            char current_str[16];
+            snprintf(current_str, sizeof(current_str), "%.3fA", data.ports[2].current / 1000.0f);
+            lv_label_set_text(ui2_port3current1, current_str);
+        }
+        
+        // 活动状态显示（powerlabel实际上是状态标签）
+        if (ui2_port3powerlabel) {
+            lv_label_set_text(ui2_port3powerlabel, data.ports[2].state ? "已开启" : "未开启");
+        }
+        
+        // 功率显示（powerlabel1才是真正的功率标签）
+        if (ui2_port3powerlabel1) {
+            char power_str[16];
+            snprintf(power_str, sizeof(power_str), "%.3fW", data.ports[2].power / 1000.0f);
+            lv_label_set_text(ui2_port3powerlabel1, power_str);
+        }
+        
+        // 状态显示
+        if (ui2_port3state) {
+            lv_label_set_text(ui2_port3state, data.ports[2].state ? "已连接" : "未连接");
+        }
+        
+        // 协议显示
+        if (ui2_port3protocol) {
+            lv_label_set_text(ui2_port3protocol, strlen(data.ports[2].protocol_name) > 0 ? data.ports[2].protocol_name : "未知");
+        }
+        
+        // 制造商VID
+        if (ui2_port3manufactuervid) {
+            if (data.ports[2].manufacturer_vid > 0) {
+                char vid_str[16];
+                snprintf(vid_str, sizeof(vid_str), "0x%04X", data.ports[2].manufacturer_vid);
+                lv_label_set_text(ui2_port3manufactuervid, vid_str);
+            } else {
+                lv_label_set_text(ui2_port3manufactuervid, "未知");
+            }
+        }
+        
+        // 线缆VID
+        if (ui2_port3cablevid) {
+            if (data.ports[2].cable_vid > 0) {
+                char vid_str[16];
+                snprintf(vid_str, sizeof(vid_str), "0x%04X", data.ports[2].cable_vid);
+                lv_label_set_text(ui2_port3cablevid, vid_str);
+            } else {
+                lv_label_set_text(ui2_port3cablevid, "未知");
+            }
+        }
+        
+        // 协议握手功率显示
+        if (ui2_port3protocolpower) {
+            if (data.ports[2].protocol_handshake_power > 0) {
+                char protocol_power_str[16];
+                snprintf(protocol_power_str, sizeof(protocol_power_str), "%.1fW", data.ports[2].protocol_handshake_power / 1000.0f);
+                lv_label_set_text(ui2_port3protocolpower, protocol_power_str);
+            } else {
+                lv_label_set_text(ui2_port3protocolpower, "--W");
+            }
+        }
+        
+        // 最大电压
+        if (ui2_port3maxvbusvoltage) {
+            if (data.ports[2].cable_max_vbus_voltage > 0) {
+                char voltage_str[16];
+                snprintf(voltage_str, sizeof(voltage_str), "%.1fV", data.ports[2].cable_max_vbus_voltage / 1000.0f);
+                lv_label_set_text(ui2_port3maxvbusvoltage, voltage_str);
+            } else {
+                lv_label_set_text(ui2_port3maxvbusvoltage, "未知");
+            }
+        }
+        
+        // 最大电流
+        if (ui2_port3maxvbuscurrent) {
+            if (data.ports[2].cable_max_vbus_current > 0) {
+                char current_str[16];
+                snprintf(current_str, sizeof(current_str), "%.2fA", data.ports[2].cable_max_vbus_current / 1000.0f);
+                lv_label_set_text(ui2_port3maxvbuscurrent, current_str);
+            } else {
+                lv_label_set_text(ui2_port3maxvbuscurrent, "未知");
+            }
+        }
+    }
+    
+    // 更新端口4详细页面
+    if (data.ports[3].valid) {
+        // 电压显示
+        if (ui2_port4voltage1) {
+            char voltage_str[16];
+            snprintf(voltage_str, sizeof(voltage_str), "%.3fV", data.ports[3].voltage / 1000.0f);
+            lv_label_set_text(ui2_port4voltage1, voltage_str);
+        }
+        
+        // 电流显示
+        if (ui2_port4current1) {
+            char current_str[16];
+            snprintf(current_str, sizeof(current_str), "%.3fA", data.ports[3].current / 1000.0f);
+            lv_label_set_text(ui2_port4current1, current_str);
+        }
+        
+        // 活动状态显示（powerlabel实际上是状态标签）
+        if (ui2_port4powerlabel) {
+            lv_label_set_text(ui2_port4powerlabel, data.ports[3].state ? "已开启" : "未开启");
+        }
+        
+        // 功率显示（powerlabel1才是真正的功率标签）
+        if (ui2_port4powerlabel1) {
+            char power_str[16];
+            snprintf(power_str, sizeof(power_str), "%.3fW", data.ports[3].power / 1000.0f);
+            lv_label_set_text(ui2_port4powerlabel1, power_str);
+        }
+        
+        // 状态显示
+        if (ui2_port4state) {
+            lv_label_set_text(ui2_port4state, data.ports[3].state ? "已连接" : "未连接");
+        }
+        
+        // 协议显示
+        if (ui2_port4protocol) {
+            lv_label_set_text(ui2_port4protocol, strlen(data.ports[3].protocol_name) > 0 ? data.ports[3].protocol_name : "未知");
+        }
+        
+        // 制造商VID
+        if (ui2_port4manufactuervid) {
+            if (data.ports[3].manufacturer_vid > 0) {
+                char vid_str[16];
+                snprintf(vid_str, sizeof(vid_str), "0x%04X", data.ports[3].manufacturer_vid);
+                lv_label_set_text(ui2_port4manufactuervid, vid_str);
+            } else {
+                lv_label_set_text(ui2_port4manufactuervid, "未知");
+            }
+        }
+        
+        // 线缆VID
+        if (ui2_port4cablevid) {
+            if (data.ports[3].cable_vid > 0) {
+                char vid_str[16];
+                snprintf(vid_str, sizeof(vid_str), "0x%04X", data.ports[3].cable_vid);
+                lv_label_set_text(ui2_port4cablevid, vid_str);
+            } else {
+                lv_label_set_text(ui2_port4cablevid, "未知");
+            }
+        }
+        
+        // 协议握手功率显示
+        if (ui2_port4protocolpower) {
+            if (data.ports[3].protocol_handshake_power > 0) {
+                char protocol_power_str[16];
+                snprintf(protocol_power_str, sizeof(protocol_power_str), "%.1fW", data.ports[3].protocol_handshake_power / 1000.0f);
+                lv_label_set_text(ui2_port4protocolpower, protocol_power_str);
+            } else {
+                lv_label_set_text(ui2_port4protocolpower, "--W");
+            }
+        }
+        
+        // 最大电压
+        if (ui2_port4maxvbusvoltage) {
+            if (data.ports[3].cable_max_vbus_voltage > 0) {
+                char voltage_str[16];
+                snprintf(voltage_str, sizeof(voltage_str), "%.1fV", data.ports[3].cable_max_vbus_voltage / 1000.0f);
+                lv_label_set_text(ui2_port4maxvbusvoltage, voltage_str);
+            } else {
+                lv_label_set_text(ui2_port4maxvbusvoltage, "未知");
+            }
+        }
+        
+        // 最大电流
+        if (ui2_port4maxvbuscurrent) {
+            if (data.ports[3].cable_max_vbus_current > 0) {
+                char current_str[16];
+                snprintf(current_str, sizeof(current_str), "%.2fA", data.ports[3].cable_max_vbus_current / 1000.0f);
+                lv_label_set_text(ui2_port4maxvbuscurrent, current_str);
+            } else {
+                lv_label_set_text(ui2_port4maxvbuscurrent, "未知");
+            }
+        }
+    }
+}
@@ -0,0 +1,50 @@
+/*
+ * PowerDisplayUpdater.h - 功率数据显示更新头文件
+ * ESP32S3监控项目 - 功率显示模块
+ *
+ * 功能特性：
+ * - 把功率监控数据写入UI1/UI2各页面的标签和功率条
+ * - 只依赖LVGL和SquareLine生成的UI对象，不依赖FreeRTOS和Arduino，
+ *   设备上由DisplayManager持有LVGL锁后调用，主机渲染基准（host/）直接调用
+ */
+
+#ifndef POWER_DISPLAY_UPDATER_H
+#define POWER_DISPLAY_UPDATER_H
+
+#include "lvgl.h"
+#include "PowerMonitorData.h"
+
+/**
+ * @brief 功率数据显示更新（调用者需持有LVGL锁）
+ */
+class PowerDisplayUpdater {
+public:
+    /**
+     * @brief 更新功率数据显示
+     *
+     * @param data 功率监控数据
+     * @param ui2System true时更新UI2系统，false时更新UI1系统
+     */
+    static void updatePowerData(const PowerMonitorData& data, bool ui2System);
+
+    /**
+     * @brief 更新UI1端口详细信息页面
+     *
+     * @param data 功率监控数据
+     * @param port_index 端口索引（0-3）
+     */
+    static void updatePortDetail(const PowerMonitorData& data, int port_index);
+
+private:
+    /**
+     * @brief 更新功率条显示
+     */
+    static void updatePowerBars(const PowerMonitorData& data);
+
+    /**
+     * @brief 更新UI2系统端口详细页面数据
+     */
+    static void updateUI2PortDetailPages(const PowerMonitorData& data);
+};
+
+#endif // POWER_DISPLAY_UPDATER_H
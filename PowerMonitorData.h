@@ -61,6 +61,44 @@ struct PowerMonitorData {
     bool valid;             ///< 数据有效性
 };
 
+/**
+ * @brief 快充协议编号转换为显示名称
+ *
+ * @param protocol 快充协议编号（0xff表示不充电）
+ * @return 协议名称，未知编号返回"未知"
+ */
+static inline const char* getFastChargeProtocolName(int protocol) {
+    static const char* const protocol_names[] = {
+        "None",         // 0  FC_None
+        "QC2.0",        // 1  FC_QC2
+        "QC3.0",        // 2  FC_QC3
+        "QC3+",         // 3  FC_QC3P
+        "SFCP",         // 4  FC_SFCP
+        "AFC",          // 5  FC_AFC
+        "FCP",          // 6  FC_FCP
+        "SCP",          // 7  FC_SCP
+        "VOOC1.0",      // 8  FC_VOOC1P0
+        "VOOC4.0",      // 9  FC_VOOC4P0
+        "SVOOC2.0",     // 10 FC_SVOOC2P0
+        "TFCP",         // 11 FC_TFCP
+        "UFCS",         // 12 FC_UFCS
+        "PE1.0",        // 13 FC_PE1
+        "PE2.0",        // 14 FC_PE2
+        "PD 3.0",       // 15 FC_PD_Fix5V
+        "PD 3.0",       // 16 FC_PD_FixHV
+        "PD 3.0",       // 17 FC_PD_SPR_AVS
+        "PD PPS",       // 18 FC_PD_PPS
+        "PD 3.1",       // 19 FC_PD_EPR_HV
+        "PD 3.1"        // 20 FC_PD_AVS
+    };
+
+    // 0xff为不充电状态，与越界编号一样显示为未知
+    if (protocol >= 0 && protocol <= 20) {
+        return protocol_names[protocol];
+    }
+    return "未知";
+}
+
 // 功率监控数据回调函数类型
 typedef void (*PowerDataCallback)(const PowerMonitorData& data, void* userData);
 
@@ -0,0 +1,559 @@
+/*
+ * PowerTrend.cpp - 功率趋势图实现文件
+ * ESP32S3监控项目 - 功率历史与趋势图模块
+ */
+
+#include "PowerTrend.h"
+#include "PSRAMManager.h"
+#include <esp_timer.h>
+#include <esp_heap_caps.h>
+#include <string.h>
+
+// 历史分辨率：1秒、10秒、1分钟、5分钟
+const uint16_t PowerTrend::s_levelSeconds[POWER_TREND_LEVELS] = { 1, 10, 60, 300 };
+const uint16_t PowerTrend::s_levelCapacity[POWER_TREND_LEVELS] = { 64, 64, 64, 288 };
+
+// 显示窗口：每个窗口都从刚好够用的分辨率取数，点数不超过60
+const PowerTrend::WindowDesc PowerTrend::s_windows[] = {
+    // 分钟  级别  每点桶数  点数
+    {    1,    0,     1,      60 },   // 1秒一点
+    {   10,    1,     1,      60 },   // 10秒一点
+    {   60,    2,     1,      60 },   // 1分钟一点
+    { 1440,    3,     6,      48 },   // 30分钟一点
+};
+
+const int PowerTrend::s_windowCount = sizeof(s_windows) / sizeof(s_windows[0]);
+
+// 曲线最大值（0.1W），不能达到LV_CHART_POINT_NONE
+static const uint16_t MAX_DECI_WATT = 30000;
+
+/**
+ * @brief mW转换为0.1W并限幅
+ */
+static uint16_t toDeciWatt(int mw) {
+    if (mw <= 0) {
+        return 0;
+    }
+    uint32_t dw = ((uint32_t)mw + 50) / 100;
+    return dw > MAX_DECI_WATT ? MAX_DECI_WATT : (uint16_t)dw;
+}
+
+PowerTrend::PowerTrend()
+    : m_psramManager(nullptr)
+    , m_initialized(false)
+    , m_storage(nullptr)
+    , m_storageBytes(0)
+    , m_lastSampleS(0)
+    , m_mux(portMUX_INITIALIZER_UNLOCKED)
+    , m_window(0)
+    , m_appliedWindow(0)
+    , m_samples(0)
+    , m_mountsTotal(0)
+    , m_incrementalPoints(0)
+    , m_fullRedraws(0)
+    , m_rescales(0)
+    , m_updateCount(0)
+    , m_updateUsTotal(0)
+    , m_maxUpdateUs(0) {
+    memset(m_levels, 0, sizeof(m_levels));
+    memset(m_mounts, 0, sizeof(m_mounts));
+    setWindowMinutes(POWER_TREND_DEFAULT_MIN);
+    m_appliedWindow = m_window;
+}
+
+PowerTrend::~PowerTrend() {
+    if (m_storage) {
+        if (m_psramManager) {
+            m_psramManager->deallocate(m_storage);
+        } else {
+            heap_caps_free(m_storage);
+        }
+        m_storage = nullptr;
+    }
+}
+
+/**
+ * @brief 分配历史缓冲区
+ */
+bool PowerTrend::init(PSRAMManager* psramManager) {
+    if (m_initialized) {
+        return true;
+    }
+
+    size_t buckets = 0;
+    for (int i = 0; i < POWER_TREND_LEVELS; i++) {
+        buckets += s_levelCapacity[i];
+    }
+    m_storageBytes = buckets * POWER_TREND_CHANNELS * sizeof(uint16_t);
+
+    m_psramManager = psramManager;
+    if (m_psramManager) {
+        m_storage = (uint16_t*)m_psramManager->allocate(m_storageBytes, "功率趋势历史", POOL_BUFFER);
+    } else {
+        m_storage = (uint16_t*)heap_caps_malloc(m_storageBytes, MALLOC_CAP_SPIRAM);
+    }
+    if (!m_storage) {
+        printf("[PowerTrend] 错误：历史缓冲区分配失败（%u字节）\n", (unsigned)m_storageBytes);
+        return false;
+    }
+
+    // 全部标记为无数据
+    memset(m_storage, 0xFF, m_storageBytes);
+
+    uint32_t now = nowSeconds();
+    uint16_t* ring = m_storage;
+    for (int i = 0; i < POWER_TREND_LEVELS; i++) {
+        Level& level = m_levels[i];
+        level.bucket_s = s_levelSeconds[i];
+        level.capacity = s_levelCapacity[i];
+        level.ring = ring;
+        level.cur = now / level.bucket_s;
+        level.count = 0;
+        for (int ch = 0; ch < POWER_TREND_CHANNELS; ch++) {
+            level.sums[ch] = 0;
+            level.last[ch] = POWER_TREND_NONE;
+        }
+        ring += level.capacity * POWER_TREND_CHANNELS;
+    }
+
+    m_initialized = true;
+    printf("[PowerTrend] 功率历史已初始化：%u字节，默认窗口%u分钟\n",
+           (unsigned)m_storageBytes, getWindowMinutes());
+    return true;
+}
+
+/**
+ * @brief 写入一次功率采样
+ */
+void PowerTrend::addSample(const PowerMonitorData& data) {
+    if (!m_initialized || !data.valid) {
+        return;
+    }
+
+    uint16_t values[POWER_TREND_CHANNELS];
+    values[0] = toDeciWatt(data.total_power);
+    for (int i = 0; i < 4; i++) {
+        values[i + 1] = data.ports[i].valid ? toDeciWatt(data.ports[i].power) : 0;
+    }
+
+    uint32_t now = nowSeconds();
+
+    portENTER_CRITICAL(&m_mux);
+    for (int i = 0; i < POWER_TREND_LEVELS; i++) {
+        Level& level = m_levels[i];
+        advanceLevel(level, now / level.bucket_s);
+        for (int ch = 0; ch < POWER_TREND_CHANNELS; ch++) {
+            level.sums[ch] += values[ch];
+        }
+        level.count++;
+    }
+    m_lastSampleS = now;
+    m_samples++;
+    portEXIT_CRITICAL(&m_mux);
+}
+
+/**
+ * @brief 在屏幕底部挂载趋势图
+ */
+void PowerTrend::attach(lv_obj_t* screen, uint8_t channel) {
+    if (!m_initialized || !screen || channel >= POWER_TREND_CHANNELS) {
+        return;
+    }
+
+    Mount* mount = nullptr;
+    for (int i = 0; i < POWER_TREND_MAX_MOUNTS; i++) {
+        if (m_mounts[i].chart && m_mounts[i].screen == screen) {
+            return;
+        }
+        if (!mount && !m_mounts[i].chart) {
+            mount = &m_mounts[i];
+        }
+    }
+    if (!mount) {
+        printf("[PowerTrend] 警告：趋势图数量已达上限，跳过挂载\n");
+        return;
+    }
+
+    lv_obj_t* chart = lv_chart_create(screen);
+    lv_obj_set_size(chart, POWER_TREND_WIDTH, POWER_TREND_HEIGHT);
+    lv_obj_align(chart, LV_ALIGN_BOTTOM_MID, 0, -POWER_TREND_BOTTOM_MARGIN);
+    lv_obj_clear_flag(chart, LV_OBJ_FLAG_CLICKABLE | LV_OBJ_FLAG_SCROLLABLE);  // 不拦截屏幕滑动手势
+
+    lv_obj_set_style_bg_color(chart, lv_color_hex(0x000000), LV_PART_MAIN);
+    lv_obj_set_style_bg_opa(chart, LV_OPA_40, LV_PART_MAIN);
+    lv_obj_set_style_border_width(chart, 0, LV_PART_MAIN);
+    lv_obj_set_style_radius(chart, 6, LV_PART_MAIN);
+    lv_obj_set_style_pad_all(chart, 4, LV_PART_MAIN);
+    lv_obj_set_style_line_color(chart, lv_color_hex(0x404040), LV_PART_MAIN);
+    lv_obj_set_style_line_width(chart, 2, LV_PART_ITEMS);
+    lv_obj_set_style_size(chart, 0, LV_PART_INDICATOR);
+
+    // 循环模式：新点覆盖最旧的点，只重绘新点附近的列
+    lv_chart_set_type(chart, LV_CHART_TYPE_LINE);
+    lv_chart_set_update_mode(chart, LV_CHART_UPDATE_MODE_CIRCULAR);
+    lv_chart_set_div_line_count(chart, 3, 0);
+
+    mount->screen = screen;
+    mount->chart = chart;
+    mount->series = lv_chart_add_series(chart, lv_color_hex(0x00D0FF), LV_CHART_AXIS_PRIMARY_Y);
+    mount->channel = channel;
+    mount->range = 0;
+    lv_obj_add_event_cb(chart, chartDeleteCb, LV_EVENT_DELETE, mount);
+
+    refill(*mount, s_windows[m_appliedWindow]);
+    m_mountsTotal++;
+}
+
+/**
+ * @brief 把新完成的点追加到所有趋势图
+ */
+void PowerTrend::update() {
+    if (!m_initialized) {
+        return;
+    }
+
+    int64_t startUs = esp_timer_get_time();
+
+    // 没有新采样时也推进时间，断开的数据显示为断点
+    advanceAll();
+
+    uint8_t windowIndex = m_window;
+    bool windowChanged = windowIndex != m_appliedWindow;
+    m_appliedWindow = windowIndex;
+
+    const WindowDesc& window = s_windows[windowIndex];
+    const Level& level = m_levels[window.level];
+    uint32_t done = completedGroups(window);
+    bool updated = false;
+
+    for (int i = 0; i < POWER_TREND_MAX_MOUNTS; i++) {
+        Mount& mount = m_mounts[i];
+        if (!mount.chart || (!windowChanged && mount.next_group == done)) {
+            continue;
+        }
+        updated = true;
+
+        // 窗口切换或落后超过一屏时整图重绘
+        if (windowChanged || done < mount.next_group || done - mount.next_group >= window.points) {
+            refill(mount, window);
+            continue;
+        }
+
+        while (mount.next_group < done) {
+            uint16_t value = groupValue(level, mount.channel, mount.next_group, window.group);
+            if (value != POWER_TREND_NONE && (lv_coord_t)value > mount.range) {
+                mount.range = niceRange(value);
+                lv_chart_set_range(mount.chart, LV_CHART_AXIS_PRIMARY_Y, 0, mount.range);
+                m_rescales++;
+            }
+
+            lv_chart_set_next_value(mount.chart, mount.series,
+                                    value == POWER_TREND_NONE ? LV_CHART_POINT_NONE : (lv_coord_t)value);
+
+            // 下一个位置（最旧的点）留空作为光标，该列已由lv_chart_set_next_value标记重绘
+            uint16_t cursor = lv_chart_get_x_start_point(mount.chart, mount.series);
+            lv_chart_get_y_array(mount.chart, mount.series)[cursor] = LV_CHART_POINT_NONE;
+
+            mount.next_group++;
+            m_incrementalPoints++;
+
+            if (cursor == 0) {
+                shrinkRange(mount);
+            }
+        }
+    }
+
+    if (updated) {
+        uint32_t elapsed = (uint32_t)(esp_timer_get_time() - startUs);
+        m_updateCount++;
+        m_updateUsTotal += elapsed;
+        if (elapsed > m_maxUpdateUs) {
+            m_maxUpdateUs = elapsed;
+        }
+    }
+}
+
+/**
+ * @brief 距当前窗口下一个点完成的毫秒数
+ */
+uint32_t PowerTrend::getNextPointDelayMs() const {
+    const WindowDesc& window = s_windows[m_window];
+    uint64_t spanUs = (uint64_t)s_levelSeconds[window.level] * window.group * 1000000ULL;
+    uint64_t nowUs = (uint64_t)esp_timer_get_time();
+    uint64_t nextUs = (nowUs / spanUs + 1) * spanUs;
+
+    // 稍晚于边界，确保该点的最后一个桶已完成
+    return (uint32_t)((nextUs - nowUs) / 1000) + 20;
+}
+
+/**
+ * @brief 设置显示窗口
+ */
+bool PowerTrend::setWindowMinutes(uint16_t minutes) {
+    for (int i = 0; i < s_windowCount; i++) {
+        if (s_windows[i].minutes == minutes) {
+            m_window = (uint8_t)i;
+            return true;
+        }
+    }
+    return false;
+}
+
+uint16_t PowerTrend::getWindowMinutes() const {
+    return s_windows[m_window].minutes;
+}
+
+int PowerTrend::getWindowCount() {
+    return s_windowCount;
+}
+
+uint16_t PowerTrend::getWindowMinutesAt(int index) {
+    if (index < 0 || index >= s_windowCount) {
+        return 0;
+    }
+    return s_windows[index].minutes;
+}
+
+/**
+ * @brief 读取当前窗口的曲线数据
+ */
+int PowerTrend::getSeries(uint8_t channel, float* out_w, int max_points) {
+    if (!m_initialized || !out_w || channel >= POWER_TREND_CHANNELS) {
+        return 0;
+    }
+
+    advanceAll();
+
+    const WindowDesc& window = s_windows[m_window];
+    const Level& level = m_levels[window.level];
+    uint32_t done = completedGroups(window);
+
+    // 屏幕上光标占一个点，显示points-1个历史点
+    int count = window.points - 1;
+    if (count > max_points) {
+        count = max_points;
+    }
+
+    for (int i = 0; i < count; i++) {
+        uint32_t back = (uint32_t)(count - i);
+        uint16_t value = back <= done ? groupValue(level, channel, done - back, window.group) : POWER_TREND_NONE;
+        out_w[i] = value == POWER_TREND_NONE ? -1.0f : value / 10.0f;
+    }
+    return count;
+}
+
+/**
+ * @brief 获取统计数据
+ */
+void PowerTrend::getStats(PowerTrendStats* stats) const {
+    if (!stats) {
+        return;
+    }
+
+    uint32_t mounted = 0;
+    for (int i = 0; i < POWER_TREND_MAX_MOUNTS; i++) {
+        if (m_mounts[i].chart) {
+            mounted++;
+        }
+    }
+
+    stats->samples = m_samples;
+    stats->mounted = mounted;
+    stats->mounts_total = m_mountsTotal;
+    stats->incremental_points = m_incrementalPoints;
+    stats->full_redraws = m_fullRedraws;
+    stats->rescales = m_rescales;
+    stats->avg_update_us = m_updateCount ? (uint32_t)(m_updateUsTotal / m_updateCount) : 0;
+    stats->max_update_us = m_maxUpdateUs;
+    stats->history_bytes = m_storageBytes;
+}
+
+/**
+ * @brief 趋势图删除回调（屏幕被释放或主题切换时）
+ */
+void PowerTrend::chartDeleteCb(lv_event_t* e) {
+    Mount* mount = (Mount*)lv_event_get_user_data(e);
+    if (mount) {
+        mount->chart = nullptr;
+        mount->series = nullptr;
+        mount->screen = nullptr;
+    }
+}
+
+/**
+ * @brief 把级别推进到桶序号now_index
+ */
+void PowerTrend::advanceLevel(Level& level, uint32_t now_index) {
+    if (now_index <= level.cur) {
+        return;
+    }
+
+    // 中断超过一整圈，整个环都没有有效数据
+    if (now_index - level.cur > level.capacity) {
+        for (int ch = 0; ch < POWER_TREND_CHANNELS; ch++) {
+            for (int i = 0; i < level.capacity; i++) {
+                level.ring[ch * level.capacity + i] = POWER_TREND_NONE;
+            }
+            level.sums[ch] = 0;
+            level.last[ch] = POWER_TREND_NONE;
+        }
+        level.count = 0;
+        level.cur = now_index;
+        return;
+    }
+
+    while (level.cur < now_index) {
+        commitBucket(level);
+        level.cur++;
+    }
+}
+
+/**
+ * @brief 提交级别的当前桶
+ */
+void PowerTrend::commitBucket(Level& level) {
+    uint32_t slot = level.cur % level.capacity;
+
+    // 没有采样的桶：采样间隔较短时沿用上一个值，否则为断点
+    bool hold = level.count == 0 && m_samples > 0 &&
+                level.cur * level.bucket_s < m_lastSampleS + POWER_TREND_HOLD_S;
+
+    for (int ch = 0; ch < POWER_TREND_CHANNELS; ch++) {
+        uint16_t value;
+        if (level.count > 0) {
+            value = (uint16_t)(level.sums[ch] / level.count);
+        } else if (hold) {
+            value = level.last[ch];
+        } else {
+            value = POWER_TREND_NONE;
+        }
+        level.ring[ch * level.capacity + slot] = value;
+        level.last[ch] = value;
+        level.sums[ch] = 0;
+    }
+    level.count = 0;
+}
+
+/**
+ * @brief 按当前时间推进所有级别
+ */
+void PowerTrend::advanceAll() {
+    uint32_t now = nowSeconds();
+
+    portENTER_CRITICAL(&m_mux);
+    for (int i = 0; i < POWER_TREND_LEVELS; i++) {
+        advanceLevel(m_levels[i], now / m_levels[i].bucket_s);
+    }
+    portEXIT_CRITICAL(&m_mux);
+}
+
+/**
+ * @brief 计算一个点的值
+ */
+uint16_t PowerTrend::groupValue(const Level& level, uint8_t channel, uint32_t group, uint8_t group_size) const {
+    uint32_t sum = 0;
+    uint32_t count = 0;
+
+    portENTER_CRITICAL(&m_mux);
+    uint32_t first = group * group_size;
+    for (uint32_t b = first; b < first + group_size; b++) {
+        // 只取已完成且仍在环内的桶
+        if (b >= level.cur || level.cur - b > level.capacity) {
+            continue;
+        }
+        uint16_t value = level.ring[channel * level.capacity + b % level.capacity];
+        if (value != POWER_TREND_NONE) {
+            sum += value;
+            count++;
+        }
+    }
+    portEXIT_CRITICAL(&m_mux);
+
+    return count ? (uint16_t)(sum / count) : POWER_TREND_NONE;
+}
+
+/**
+ * @brief 获取已完成的点数
+ */
+uint32_t PowerTrend::completedGroups(const WindowDesc& window) const {
+    return m_levels[window.level].cur / window.group;
+}
+
+/**
+ * @brief 整图重绘
+ */
+void PowerTrend::refill(Mount& mount, const WindowDesc& window) {
+    const Level& level = m_levels[window.level];
+    uint32_t done = completedGroups(window);
+
+    if (lv_chart_get_point_count(mount.chart) != window.points) {
+        lv_chart_set_point_count(mount.chart, window.points);
+    }
+
+    // 光标在0号位置，1..points-1依次为从旧到新的点
+    lv_coord_t* y = lv_chart_get_y_array(mount.chart, mount.series);
+    uint16_t maxValue = 0;
+    y[0] = LV_CHART_POINT_NONE;
+    for (int i = 1; i < window.points; i++) {
+        uint32_t back = (uint32_t)(window.points - i);
+        uint16_t value = back <= done ? groupValue(level, mount.channel, done - back, window.group) : POWER_TREND_NONE;
+        if (value == POWER_TREND_NONE) {
+            y[i] = LV_CHART_POINT_NONE;
+        } else {
+            y[i] = (lv_coord_t)value;
+            if (value > maxValue) {
+                maxValue = value;
+            }
+        }
+    }
+    lv_chart_set_x_start_point(mount.chart, mount.series, 0);
+
+    mount.range = niceRange(maxValue);
+    lv_chart_set_range(mount.chart, LV_CHART_AXIS_PRIMARY_Y, 0, mount.range);
+    lv_chart_refresh(mount.chart);
+
+    mount.next_group = done;
+    m_fullRedraws++;
+}
+
+/**
+ * @brief 按一屏内的最大值缩小量程
+ */
+void PowerTrend::shrinkRange(Mount& mount) {
+    const lv_coord_t* y = lv_chart_get_y_array(mount.chart, mount.series);
+    uint16_t count = lv_chart_get_point_count(mount.chart);
+    uint16_t maxValue = 0;
+    for (uint16_t i = 0; i < count; i++) {
+        if (y[i] != LV_CHART_POINT_NONE && y[i] > maxValue) {
+            maxValue = (uint16_t)y[i];
+        }
+    }
+
+    lv_coord_t range = niceRange(maxValue);
+    if (range < mount.range) {
+        mount.range = range;
+        lv_chart_set_range(mount.chart, LV_CHART_AXIS_PRIMARY_Y, 0, range);
+        m_rescales++;
+    }
+}
+
+/**
+ * @brief 按最大值计算纵轴量程
+ */
+lv_coord_t PowerTrend::niceRange(uint16_t max_value) {
+    // 留10%余量，最小5W
+    uint32_t target = max_value + max_value / 10;
+    for (uint32_t step = 50; step < MAX_DECI_WATT; step *= 10) {
+        if (step >= target) return (lv_coord_t)step;
+        if (step * 2 >= target) return (lv_coord_t)(step * 2);
+        if (step * 5 >= target && step * 5 <= MAX_DECI_WATT) return (lv_coord_t)(step * 5);
+    }
+    return (lv_coord_t)MAX_DECI_WATT;
+}
+
+/**
+ * @brief 当前秒数（开机起）
+ */
+uint32_t PowerTrend::nowSeconds() {
+    return (uint32_t)(esp_timer_get_time() / 1000000LL);
+}
@@ -0,0 +1,251 @@
+/*
+ * PowerTrend.h - 功率趋势图头文件
+ * ESP32S3监控项目 - 功率历史与趋势图模块
+ *
+ * 功能特性：
+ * - 按1秒/10秒/1分钟/5分钟四级分辨率保存总功率和4个端口的功率平均值（环形缓冲区，PSRAM）
+ * - 在总功率屏幕和端口详情屏幕底部显示最近N分钟的功率曲线（1分钟/10分钟/1小时/24小时）
+ * - 曲线从对应分辨率的历史中取数，每个窗口最多60个点，显示24小时与显示1分钟的开销相同
+ * - lv_chart使用循环更新模式：新点覆盖最旧的点并后移空隙光标，只重绘新点所在的列，
+ *   不重置整条曲线；只有纵轴量程变化或窗口切换时才整图重绘
+ *
+ * 屏幕由ScreenManager按需创建和释放，趋势图随屏幕创建挂载、随屏幕删除自动解除
+ */
+
+#ifndef POWER_TREND_H
+#define POWER_TREND_H
+
+#include <Arduino.h>
+#include "lvgl.h"
+#include "PowerMonitorData.h"
+
+// 前向声明
+class PSRAMManager;
+
+// 趋势图配置
+#define POWER_TREND_ENABLED       1       // 1：在功率屏幕上显示趋势图
+#define POWER_TREND_CHANNELS      5       // 总功率 + 4个端口
+#define POWER_TREND_LEVELS        4       // 历史分辨率级数
+#define POWER_TREND_MAX_MOUNTS    5       // 同时挂载的趋势图数（单套UI的功率屏幕数）
+#define POWER_TREND_HOLD_S        5       // 采样间隔小于该秒数时空桶沿用上一个值，否则显示为断点
+#define POWER_TREND_WIDTH         320     // 趋势图宽度
+#define POWER_TREND_HEIGHT        64      // 趋势图高度
+#define POWER_TREND_BOTTOM_MARGIN 8       // 趋势图距屏幕底部的距离
+#define POWER_TREND_DEFAULT_MIN   10      // 默认显示窗口（分钟）
+
+#define POWER_TREND_NONE          0xFFFF  // 历史中的无数据标记
+
+/**
+ * @brief 趋势图统计
+ */
+struct PowerTrendStats {
+    uint32_t samples;               ///< 写入的功率采样数
+    uint32_t mounted;               ///< 当前挂载的趋势图数
+    uint32_t mounts_total;          ///< 累计挂载次数
+    uint32_t incremental_points;    ///< 增量追加的点数（只重绘新点所在列）
+    uint32_t full_redraws;          ///< 整图重绘次数（挂载、窗口切换、追赶过多）
+    uint32_t rescales;              ///< 纵轴量程变化次数
+    uint32_t avg_update_us;         ///< 平均每次更新耗时
+    uint32_t max_update_us;         ///< 最大更新耗时
+    uint32_t history_bytes;         ///< 历史缓冲区占用字节数
+};
+
+/**
+ * @brief 功率历史与趋势图管理器
+ *
+ * addSample可在任意任务调用；attach/update需要持有LVGL锁
+ */
+class PowerTrend {
+public:
+    PowerTrend();
+    ~PowerTrend();
+
+    /**
+     * @brief 分配历史缓冲区
+     *
+     * @param psramManager PSRAM管理器，为空时从PSRAM堆直接分配
+     * @return true 成功，false 内存不足
+     */
+    bool init(PSRAMManager* psramManager);
+
+    /**
+     * @brief 写入一次功率采样（任意任务调用）
+     */
+    void addSample(const PowerMonitorData& data);
+
+    /**
+     * @brief 在屏幕底部挂载趋势图，已挂载时不重复创建（需持有LVGL锁）
+     *
+     * @param screen 功率屏幕（为空时忽略）
+     * @param channel 0为总功率，1-4为端口
+     */
+    void attach(lv_obj_t* screen, uint8_t channel);
+
+    /**
+     * @brief 把新完成的点追加到所有趋势图（需持有LVGL锁，显示任务每秒调用）
+     *
+     * 熄屏期间不调用也不会丢点，下次调用时补齐；落后超过一屏时整图重绘
+     */
+    void update();
+
+    /**
+     * @brief 距当前窗口下一个点完成的毫秒数（显示任务据此设置定时器）
+     */
+    uint32_t getNextPointDelayMs() const;
+
+    /**
+     * @brief 设置显示窗口（下次update时生效）
+     *
+     * @param minutes 1、10、60或1440
+     * @return true 成功，false 不支持的窗口
+     */
+    bool setWindowMinutes(uint16_t minutes);
+
+    /**
+     * @brief 获取当前显示窗口（分钟）
+     */
+    uint16_t getWindowMinutes() const;
+
+    /**
+     * @brief 获取支持的窗口数
+     */
+    static int getWindowCount();
+
+    /**
+     * @brief 获取第index个支持的窗口（分钟）
+     */
+    static uint16_t getWindowMinutesAt(int index);
+
+    /**
+     * @brief 读取当前窗口的曲线数据（与屏幕上的曲线一致，按时间顺序）
+     *
+     * @param channel 0为总功率，1-4为端口
+     * @param out_w 输出功率（W），无数据的点为负数
+     * @param max_points 输出缓冲区大小
+     * @return 输出的点数
+     */
+    int getSeries(uint8_t channel, float* out_w, int max_points);
+
+    /**
+     * @brief 获取统计数据
+     */
+    void getStats(PowerTrendStats* stats) const;
+
+    /**
+     * @brief 检查是否已初始化
+     */
+    bool isReady() const { return m_initialized; }
+
+private:
+    /**
+     * @brief 历史分辨率级别
+     */
+    struct Level {
+        uint16_t bucket_s;                      ///< 每个桶的秒数
+        uint16_t capacity;                      ///< 环形缓冲区的桶数
+        uint16_t* ring;                         ///< [channel][capacity]，单位0.1W
+        uint32_t cur;                           ///< 正在累加的桶序号（时间/bucket_s）
+        uint32_t sums[POWER_TREND_CHANNELS];    ///< 当前桶的累加值
+        uint16_t count;                         ///< 当前桶的采样数
+        uint16_t last[POWER_TREND_CHANNELS];    ///< 最近一个已完成桶的值
+    };
+
+    /**
+     * @brief 显示窗口（每个点由group个桶平均得到）
+     */
+    struct WindowDesc {
+        uint16_t minutes;
+        uint8_t level;
+        uint8_t group;
+        uint8_t points;
+    };
+
+    /**
+     * @brief 挂载的趋势图
+     */
+    struct Mount {
+        lv_obj_t* screen;
+        lv_obj_t* chart;
+        lv_chart_series_t* series;
+        uint8_t channel;
+        uint32_t next_group;                    ///< 下一个待追加的点序号
+        lv_coord_t range;                       ///< 当前纵轴量程（0.1W）
+    };
+
+    static const WindowDesc s_windows[];
+    static const int s_windowCount;
+    static const uint16_t s_levelSeconds[POWER_TREND_LEVELS];
+    static const uint16_t s_levelCapacity[POWER_TREND_LEVELS];
+
+    PSRAMManager* m_psramManager;
+    bool m_initialized;
+    uint16_t* m_storage;
+    size_t m_storageBytes;
+    Level m_levels[POWER_TREND_LEVELS];
+    uint32_t m_lastSampleS;
+    mutable portMUX_TYPE m_mux;
+
+    Mount m_mounts[POWER_TREND_MAX_MOUNTS];
+    volatile uint8_t m_window;                  ///< 请求的窗口索引
+    uint8_t m_appliedWindow;                    ///< 趋势图当前使用的窗口索引
+
+    // 统计
+    uint32_t m_samples;
+    uint32_t m_mountsTotal;
+    uint32_t m_incrementalPoints;
+    uint32_t m_fullRedraws;
+    uint32_t m_rescales;
+    uint32_t m_updateCount;
+    uint64_t m_updateUsTotal;
+    uint32_t m_maxUpdateUs;
+
+    // 趋势图删除回调（屏幕被释放时解除挂载）
+    static void chartDeleteCb(lv_event_t* e);
+
+    /**
+     * @brief 把级别推进到桶序号now_index，提交中间完成的桶（需在临界区内调用）
+     */
+    void advanceLevel(Level& level, uint32_t now_index);
+
+    /**
+     * @brief 提交级别的当前桶
+     */
+    void commitBucket(Level& level);
+
+    /**
+     * @brief 按当前时间推进所有级别（没有新采样时也让曲线前进）
+     */
+    void advanceAll();
+
+    /**
+     * @brief 计算一个点的值（group个桶的平均，全部无数据时返回POWER_TREND_NONE）
+     */
+    uint16_t groupValue(const Level& level, uint8_t channel, uint32_t group, uint8_t group_size) const;
+
+    /**
+     * @brief 获取已完成的点数（下一个未完成的点序号）
+     */
+    uint32_t completedGroups(const WindowDesc& window) const;
+
+    /**
+     * @brief 整图重绘：按历史重新填充曲线
+     */
+    void refill(Mount& mount, const WindowDesc& window);
+
+    /**
+     * @brief 曲线光标回到起点时，按一屏内的最大值缩小量程
+     */
+    void shrinkRange(Mount& mount);
+
+    /**
+     * @brief 按最大值计算纵轴量程（1/2/5进制取整）
+     */
+    static lv_coord_t niceRange(uint16_t max_value);
+
+    /**
+     * @brief 当前秒数（开机起）
+     */
+    static uint32_t nowSeconds();
+};
+
+#endif // POWER_TREND_H
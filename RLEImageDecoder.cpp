@@ -0,0 +1,341 @@
+/*
+ * RLE图片解码器实现
+ *
+ * 压缩数据由image_compressor.py生成：
+ *   4字节魔数'R','L','E',1 + uint32行偏移表[h] + 按行编码的像素流
+ *   头字节bit7=1为重复包（(hdr&0x7F)+1个相同像素，后跟1个像素），
+ *   bit7=0为原样包（hdr+1个像素，后跟对应个数的像素）
+ */
+
+#include "RLEImageDecoder.h"
+#include "esp_heap_caps.h"
+#include <string.h>
+#include <stdio.h>
+
+#if LV_COLOR_DEPTH != 16
+#error "RLEImageDecoder只支持16位色深（image_compressor.py按RGB565生成数据）"
+#endif
+
+#define RLE_PIXEL_SIZE   2
+#define RLE_HEADER_SIZE  4
+
+/**
+ * @brief PSRAM解码缓存项
+ */
+typedef struct {
+    const lv_img_dsc_t* img;  // 图片描述符（常量数据，地址即唯一标识）
+    uint8_t* pixels;          // 解码后的像素数据（PSRAM）
+    size_t bytes;             // 像素数据大小
+} rle_cache_entry_t;
+
+static rle_cache_entry_t rle_cache[RLE_IMG_CACHE_MAX_ENTRIES] = {};
+
+lv_img_decoder_t* RLEImageDecoder::s_decoder = nullptr;
+rle_cache_alloc_cb_t RLEImageDecoder::s_allocCb = nullptr;
+rle_cache_free_cb_t RLEImageDecoder::s_freeCb = nullptr;
+bool RLEImageDecoder::s_cacheSuspended = false;
+
+/**
+ * @brief 注册解码器
+ */
+bool RLEImageDecoder::init(rle_cache_alloc_cb_t allocCb, rle_cache_free_cb_t freeCb) {
+    if (s_decoder) {
+        return true;
+    }
+
+    if (allocCb && freeCb) {
+        s_allocCb = allocCb;
+        s_freeCb = freeCb;
+    }
+
+    s_decoder = lv_img_decoder_create();
+    if (!s_decoder) {
+        printf("[RLEImageDecoder] 错误：创建LVGL图片解码器失败\n");
+        return false;
+    }
+
+    lv_img_decoder_set_info_cb(s_decoder, infoCb);
+    lv_img_decoder_set_open_cb(s_decoder, openCb);
+    lv_img_decoder_set_read_line_cb(s_decoder, readLineCb);
+    lv_img_decoder_set_close_cb(s_decoder, closeCb);
+
+    printf("[RLEImageDecoder] RLE图片解码器已注册（PSRAM缓存：%s）\n", RLE_IMG_PSRAM_CACHE ? "启用" : "禁用");
+    return true;
+}
+
+/**
+ * @brief 检查图片是否为有效的RLE格式
+ */
+bool RLEImageDecoder::isRLEImage(const lv_img_dsc_t* img) {
+    if (!img || img->header.cf != LV_IMG_CF_USER_ENCODED_0 || !img->data) {
+        return false;
+    }
+
+    uint32_t min_size = RLE_HEADER_SIZE + img->header.h * sizeof(uint32_t);
+    return img->data_size >= min_size && memcmp(img->data, "RLE\x01", RLE_HEADER_SIZE) == 0;
+}
+
+/**
+ * @brief 解码一行中从x开始的len个像素
+ */
+void RLEImageDecoder::decodeRow(const lv_img_dsc_t* img, lv_coord_t x, lv_coord_t y, lv_coord_t len, uint8_t* out) {
+    const uint8_t* stream = img->data + RLE_HEADER_SIZE + img->header.h * sizeof(uint32_t);
+    uint32_t row_offset;
+    memcpy(&row_offset, img->data + RLE_HEADER_SIZE + y * sizeof(uint32_t), sizeof(row_offset));
+    const uint8_t* p = stream + row_offset;
+
+    // 跳过x之前的数据包
+    lv_coord_t skip = x;
+    while (len > 0) {
+        uint8_t hdr = *p++;
+        lv_coord_t count = (hdr & 0x7F) + 1;
+        bool repeat = (hdr & 0x80) != 0;
+
+        if (skip >= count) {
+            skip -= count;
+            p += repeat ? RLE_PIXEL_SIZE : count * RLE_PIXEL_SIZE;
+            continue;
+        }
+
+        lv_coord_t n = count - skip;
+        if (n > len) {
+            n = len;
+        }
+
+        if (repeat) {
+            uint16_t pixel;
+            memcpy(&pixel, p, RLE_PIXEL_SIZE);
+            uint16_t* dst = (uint16_t*)out;  // out按lv_color_t对齐
+            for (lv_coord_t i = 0; i < n; i++) {
+                dst[i] = pixel;
+            }
+            p += RLE_PIXEL_SIZE;
+        } else {
+            memcpy(out, p + skip * RLE_PIXEL_SIZE, n * RLE_PIXEL_SIZE);
+            p += count * RLE_PIXEL_SIZE;
+        }
+
+        out += n * RLE_PIXEL_SIZE;
+        len -= n;
+        skip = 0;
+    }
+}
+
+/**
+ * @brief 把RLE图片整幅解码到调用者提供的缓冲区
+ */
+bool RLEImageDecoder::decode(const lv_img_dsc_t* img, uint8_t* out) {
+    if (!isRLEImage(img) || !out) {
+        return false;
+    }
+
+    size_t stride = (size_t)img->header.w * RLE_PIXEL_SIZE;
+    for (lv_coord_t y = 0; y < img->header.h; y++) {
+        decodeRow(img, 0, y, img->header.w, out + y * stride);
+    }
+    return true;
+}
+
+/**
+ * @brief 查找或解码图片的PSRAM缓存
+ */
+const uint8_t* RLEImageDecoder::getCachedPixels(const lv_img_dsc_t* img) {
+    if (s_cacheSuspended) {
+        return nullptr;  // 内存回收后暂停缓存，按行解码
+    }
+
+    int free_slot = -1;
+    for (int i = 0; i < RLE_IMG_CACHE_MAX_ENTRIES; i++) {
+        if (rle_cache[i].img == img) {
+            return rle_cache[i].pixels;
+        }
+        if (!rle_cache[i].img && free_slot < 0) {
+            free_slot = i;
+        }
+    }
+
+    if (free_slot < 0) {
+        return nullptr;  // 缓存已满，按行解码
+    }
+
+    size_t bytes = (size_t)img->header.w * img->header.h * RLE_PIXEL_SIZE;
+    uint8_t* pixels = (uint8_t*)(s_allocCb ? s_allocCb(bytes) : heap_caps_malloc(bytes, MALLOC_CAP_SPIRAM));
+    if (!pixels) {
+        printf("[RLEImageDecoder] 警告：PSRAM不足，%dx%d图片改为按行解码\n", img->header.w, img->header.h);
+        return nullptr;
+    }
+
+    uint32_t start_ms = lv_tick_get();
+    decode(img, pixels);
+
+    rle_cache[free_slot].img = img;
+    rle_cache[free_slot].pixels = pixels;
+    rle_cache[free_slot].bytes = bytes;
+
+    printf("[RLEImageDecoder] 已解码%dx%d图片到PSRAM（%u -> %u字节，耗时%lu ms）\n",
+           img->header.w, img->header.h, (unsigned)img->data_size, (unsigned)bytes,
+           (unsigned long)lv_tick_elaps(start_ms));
+    return pixels;
+}
+
+/**
+ * @brief 获取图片信息
+ */
+lv_res_t RLEImageDecoder::infoCb(lv_img_decoder_t* decoder, const void* src, lv_img_header_t* header) {
+    LV_UNUSED(decoder);
+
+    if (lv_img_src_get_type(src) != LV_IMG_SRC_VARIABLE) {
+        return LV_RES_INV;
+    }
+
+    const lv_img_dsc_t* img = (const lv_img_dsc_t*)src;
+    if (!isRLEImage(img)) {
+        return LV_RES_INV;
+    }
+
+    // 解码后为不透明的TRUE_COLOR图片
+    header->always_zero = 0;
+    header->w = img->header.w;
+    header->h = img->header.h;
+    header->cf = LV_IMG_CF_TRUE_COLOR;
+    return LV_RES_OK;
+}
+
+/**
+ * @brief 打开图片
+ */
+lv_res_t RLEImageDecoder::openCb(lv_img_decoder_t* decoder, lv_img_decoder_dsc_t* dsc) {
+    LV_UNUSED(decoder);
+
+    if (dsc->src_type != LV_IMG_SRC_VARIABLE) {
+        return LV_RES_INV;
+    }
+
+    const lv_img_dsc_t* img = (const lv_img_dsc_t*)dsc->src;
+    if (!isRLEImage(img)) {
+        return LV_RES_INV;
+    }
+
+#if RLE_IMG_PSRAM_CACHE
+    // 有缓存时直接给出整幅像素数据，LVGL按普通TRUE_COLOR图片绘制
+    dsc->img_data = getCachedPixels(img);
+#else
+    dsc->img_data = nullptr;
+#endif
+
+    // img_data为空时LVGL通过readLineCb逐行读取
+    return LV_RES_OK;
+}
+
+/**
+ * @brief 按行读取像素
+ */
+lv_res_t RLEImageDecoder::readLineCb(lv_img_decoder_t* decoder, lv_img_decoder_dsc_t* dsc,
+                                     lv_coord_t x, lv_coord_t y, lv_coord_t len, uint8_t* buf) {
+    LV_UNUSED(decoder);
+
+    const lv_img_dsc_t* img = (const lv_img_dsc_t*)dsc->src;
+    if (y < 0 || y >= img->header.h || x < 0 || x + len > img->header.w) {
+        return LV_RES_INV;
+    }
+
+    decodeRow(img, x, y, len, buf);
+    return LV_RES_OK;
+}
+
+/**
+ * @brief 关闭图片（缓存常驻，无需释放）
+ */
+void RLEImageDecoder::closeCb(lv_img_decoder_t* decoder, lv_img_decoder_dsc_t* dsc) {
+    LV_UNUSED(decoder);
+    LV_UNUSED(dsc);
+}
+
+/**
+ * @brief 预解码图片到PSRAM缓存
+ */
+bool RLEImageDecoder::preload(const lv_img_dsc_t* img) {
+#if RLE_IMG_PSRAM_CACHE
+    if (!isRLEImage(img)) {
+        return false;
+    }
+    return getCachedPixels(img) != nullptr;
+#else
+    LV_UNUSED(img);
+    return false;
+#endif
+}
+
+/**
+ * @brief 释放全部PSRAM缓存
+ */
+void RLEImageDecoder::clearCache() {
+    // 已打开的图片可能仍引用缓存数据，丢弃LVGL图片缓存后再释放
+    lv_img_cache_invalidate_src(nullptr);
+
+    for (int i = 0; i < RLE_IMG_CACHE_MAX_ENTRIES; i++) {
+        if (rle_cache[i].pixels) {
+            if (s_freeCb) {
+                s_freeCb(rle_cache[i].pixels);
+            } else {
+                heap_caps_free(rle_cache[i].pixels);
+            }
+        }
+        rle_cache[i] = {};
+    }
+}
+
+/**
+ * @brief 内存回收：释放全部PSRAM缓存并暂停缓存
+ */
+size_t RLEImageDecoder::reclaimCache() {
+    size_t freed = getCacheBytes();
+    clearCache();
+
+    if (!s_cacheSuspended) {
+        s_cacheSuspended = true;
+        printf("[RLEImageDecoder] 内存回收释放%u KB解码缓存，压力解除前按行解码\n", (unsigned)(freed / 1024));
+    }
+    return freed;
+}
+
+/**
+ * @brief 内存压力解除后恢复缓存
+ */
+void RLEImageDecoder::resumeCache() {
+    if (s_cacheSuspended) {
+        s_cacheSuspended = false;
+        printf("[RLEImageDecoder] 内存压力已解除，恢复PSRAM解码缓存\n");
+    }
+}
+
+/**
+ * @brief 缓存是否因内存回收暂停
+ */
+bool RLEImageDecoder::isCacheSuspended() {
+    return s_cacheSuspended;
+}
+
+/**
+ * @brief 获取缓存的图片数
+ */
+int RLEImageDecoder::getCachedCount() {
+    int count = 0;
+    for (int i = 0; i < RLE_IMG_CACHE_MAX_ENTRIES; i++) {
+        if (rle_cache[i].img) {
+            count++;
+        }
+    }
+    return count;
+}
+
+/**
+ * @brief 获取缓存占用的PSRAM字节数
+ */
+size_t RLEImageDecoder::getCacheBytes() {
+    size_t bytes = 0;
+    for (int i = 0; i < RLE_IMG_CACHE_MAX_ENTRIES; i++) {
+        bytes += rle_cache[i].bytes;
+    }
+    return bytes;
+}
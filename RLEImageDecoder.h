@@ -0,0 +1,127 @@
+/*
+ * RLE图片解码器头文件
+ *
+ * 功能特性：
+ * - 解码image_compressor.py生成的按行RLE压缩图片（LV_IMG_CF_USER_ENCODED_0）
+ * - 可选在首次打开时整幅解码到PSRAM缓存，之后按普通TRUE_COLOR图片直接绘制
+ * - 未启用缓存或PSRAM不足时按行解码，每行有独立偏移，支持随机行访问
+ * - 支持开机预解码，避免首次切换页面时的解码延迟
+ * - 缓存可由调用者提供分配函数（计入PSRAMManager统计和压力调控），内存回收后暂停缓存直到压力解除
+ *
+ * 数据格式见image_compressor.py说明
+ */
+
+#ifndef RLE_IMAGE_DECODER_H
+#define RLE_IMAGE_DECODER_H
+
+#include "lvgl.h"
+
+// RLE图片解码配置
+#define RLE_IMG_PSRAM_CACHE       1  // 1：首次打开时整幅解码到PSRAM并常驻，0：每次绘制按行解码
+#define RLE_IMG_CACHE_MAX_ENTRIES 8  // PSRAM缓存的最大图片数
+#define RLE_IMG_PRELOAD_ON_BOOT   1  // 1：创建UI前预解码当前主题的背景图，0：首次绘制时再解码
+
+// 缓存分配函数（为空时直接使用heap_caps）
+typedef void* (*rle_cache_alloc_cb_t)(size_t bytes);
+typedef void (*rle_cache_free_cb_t)(void* ptr);
+
+/**
+ * @brief RLE压缩图片解码器
+ *
+ * 注册为LVGL图片解码器，优先于内置解码器处理LV_IMG_CF_USER_ENCODED_0格式的图片
+ */
+class RLEImageDecoder {
+public:
+    /**
+     * @brief 注册解码器（LVGL初始化后调用一次）
+     *
+     * @param allocCb 缓存分配函数，为空时使用heap_caps_malloc
+     * @param freeCb 缓存释放函数，与allocCb成对提供
+     * @return true 注册成功，false 注册失败
+     */
+    static bool init(rle_cache_alloc_cb_t allocCb = nullptr, rle_cache_free_cb_t freeCb = nullptr);
+
+    /**
+     * @brief 预解码图片到PSRAM缓存（需持有LVGL锁）
+     *
+     * 非RLE格式的图片直接忽略
+     *
+     * @param img 图片描述符
+     * @return true 已在缓存中或解码成功，false 未缓存
+     */
+    static bool preload(const lv_img_dsc_t* img);
+
+    /**
+     * @brief 把RLE图片整幅解码到调用者提供的缓冲区
+     *
+     * @param img 图片描述符
+     * @param out 输出缓冲区，至少w*h*2字节（RGB565）
+     * @return true 解码成功，false 不是有效的RLE图片
+     */
+    static bool decode(const lv_img_dsc_t* img, uint8_t* out);
+
+    /**
+     * @brief 释放全部PSRAM缓存（需持有LVGL锁，之后的绘制会重新解码）
+     */
+    static void clearCache();
+
+    /**
+     * @brief 内存回收：释放全部PSRAM缓存并暂停缓存（需持有LVGL锁）
+     *
+     * 暂停期间打开图片不再分配缓存，改为按行解码，避免刚释放的缓存在下一次重绘时重新分配
+     *
+     * @return 释放的字节数
+     */
+    static size_t reclaimCache();
+
+    /**
+     * @brief 内存压力解除后恢复缓存（需持有LVGL锁）
+     */
+    static void resumeCache();
+
+    /**
+     * @brief 缓存是否因内存回收暂停
+     */
+    static bool isCacheSuspended();
+
+    /**
+     * @brief 获取缓存的图片数
+     */
+    static int getCachedCount();
+
+    /**
+     * @brief 获取缓存占用的PSRAM字节数
+     */
+    static size_t getCacheBytes();
+
+private:
+    static lv_res_t infoCb(lv_img_decoder_t* decoder, const void* src, lv_img_header_t* header);
+    static lv_res_t openCb(lv_img_decoder_t* decoder, lv_img_decoder_dsc_t* dsc);
+    static lv_res_t readLineCb(lv_img_decoder_t* decoder, lv_img_decoder_dsc_t* dsc,
+                               lv_coord_t x, lv_coord_t y, lv_coord_t len, uint8_t* buf);
+    static void closeCb(lv_img_decoder_t* decoder, lv_img_decoder_dsc_t* dsc);
+
+    /**
+     * @brief 检查图片是否为有效的RLE格式
+     */
+    static bool isRLEImage(const lv_img_dsc_t* img);
+
+    /**
+     * @brief 解码一行中从x开始的len个像素
+     */
+    static void decodeRow(const lv_img_dsc_t* img, lv_coord_t x, lv_coord_t y, lv_coord_t len, uint8_t* out);
+
+    /**
+     * @brief 查找或解码图片的PSRAM缓存
+     *
+     * @return 解码后的像素数据，失败返回nullptr
+     */
+    static const uint8_t* getCachedPixels(const lv_img_dsc_t* img);
+
+    static lv_img_decoder_t* s_decoder;   ///< LVGL解码器句柄
+    static rle_cache_alloc_cb_t s_allocCb; ///< 缓存分配函数
+    static rle_cache_free_cb_t s_freeCb;   ///< 缓存释放函数
+    static bool s_cacheSuspended;          ///< 内存回收后暂停缓存
+};
+
+#endif // RLE_IMAGE_DECODER_H
@@ -0,0 +1,341 @@
+/*
+ * ScreenManager.cpp - UI屏幕按需创建管理器实现
+ * ESP32S3监控项目 - 屏幕生命周期模块
+ */
+
+#include "ScreenManager.h"
+#include "ui.h"
+#include "ui2.h"
+#include <esp_timer.h>
+#include <string.h>
+
+// UI1屏幕表（顺序与ui_init一致，待机屏幕常驻）
+const ScreenManager::ScreenDesc ScreenManager::s_ui1Screens[] = {
+    { "standby",    &ui_standbySCREEN,    ui_standbySCREEN_screen_init,    ui_standbySCREEN_screen_destroy,    0,  1, true  },
+    { "totalpower", &ui_totalpowerSCREEN, ui_totalpowerSCREEN_screen_init, ui_totalpowerSCREEN_screen_destroy, 1,  2, false },
+    { "port1",      &ui_prot1SCREEN,      ui_prot1SCREEN_screen_init,      ui_prot1SCREEN_screen_destroy,      2,  3, false },
+    { "port2",      &ui_prot2SCREEN,      ui_prot2SCREEN_screen_init,      ui_prot2SCREEN_screen_destroy,      3,  4, false },
+    { "port3",      &ui_prot3SCREEN,      ui_prot3SCREEN_screen_init,      ui_prot3SCREEN_screen_destroy,      4,  5, false },
+    { "port4",      &ui_prot4SCREEN,      ui_prot4SCREEN_screen_init,      ui_prot4SCREEN_screen_destroy,      5,  1, false },
+    { "port1info",  &ui_port1SCREEN12,    ui_port1SCREEN12_screen_init,    ui_port1SCREEN12_screen_destroy,    -1, 2, false },
+    { "port2info",  &ui_port2SCREEN22,    ui_port2SCREEN22_screen_init,    ui_port2SCREEN22_screen_destroy,    -1, 3, false },
+    { "port3info",  &ui_port3SCREEN32,    ui_port3SCREEN32_screen_init,    ui_port3SCREEN32_screen_destroy,    -1, 4, false },
+    { "port4info",  &ui_port4SCREEN42,    ui_port4SCREEN42_screen_init,    ui_port4SCREEN42_screen_destroy,    -1, 5, false },
+};
+
+// UI2屏幕表（顺序与ui2_init一致，待机屏幕常驻）
+const ScreenManager::ScreenDesc ScreenManager::s_ui2Screens[] = {
+    { "standby",    &ui2_standbySCREEN,    ui2_standbySCREEN_screen_init,    ui2_standbySCREEN_screen_destroy,    0, 1, true  },
+    { "totalpower", &ui2_totalpowerSCREEN, ui2_totalpowerSCREEN_screen_init, ui2_totalpowerSCREEN_screen_destroy, 1, 2, false },
+    { "port1",      &ui2_port1SCREEN,      ui2_port1SCREEN_screen_init,      ui2_port1SCREEN_screen_destroy,      2, 3, false },
+    { "port2",      &ui2_port2SCREEN,      ui2_port2SCREEN_screen_init,      ui2_port2SCREEN_screen_destroy,      3, 4, false },
+    { "port3",      &ui2_port3SCREEN,      ui2_port3SCREEN_screen_init,      ui2_port3SCREEN_screen_destroy,      4, 5, false },
+    { "port4",      &ui2_port4SCREEN,      ui2_port4SCREEN_screen_init,      ui2_port4SCREEN_screen_destroy,      5, 1, false },
+};
+
+ScreenManager::ScreenManager()
+    : m_set(SCREEN_SET_NONE)
+    , m_desc(nullptr)
+    , m_count(0)
+    , m_current(-1)
+    , m_shownAt(0)
+    , m_prewarmDone(true)
+    , m_idleMs(SCREEN_EVICT_IDLE_MS)
+    , m_maxResident(SCREEN_MAX_RESIDENT)
+    , m_prewarm(SCREEN_PREWARM_ENABLED)
+    , m_buildUsTotal(0) {
+    memset(m_slots, 0, sizeof(m_slots));
+    memset(m_transitions, 0, sizeof(m_transitions));
+    memset(&m_stats, 0, sizeof(m_stats));
+}
+
+void ScreenManager::begin(ScreenSet set) {
+    m_set = set;
+    m_desc = (set == SCREEN_SET_UI1) ? s_ui1Screens : (set == SCREEN_SET_UI2) ? s_ui2Screens : nullptr;
+    m_count = (set == SCREEN_SET_UI1) ? (int)(sizeof(s_ui1Screens) / sizeof(s_ui1Screens[0]))
+            : (set == SCREEN_SET_UI2) ? (int)(sizeof(s_ui2Screens) / sizeof(s_ui2Screens[0])) : 0;
+    m_current = -1;
+    m_shownAt = 0;
+    m_prewarmDone = true;
+    m_buildUsTotal = 0;
+    memset(m_slots, 0, sizeof(m_slots));
+    memset(m_transitions, 0, sizeof(m_transitions));
+    memset(&m_stats, 0, sizeof(m_stats));
+
+    if (!m_desc) {
+        return;
+    }
+
+    // 与ui_init/ui2_init相同的主题设置
+    lv_disp_t* dispp = lv_disp_get_default();
+    lv_theme_t* theme = lv_theme_default_init(dispp, lv_palette_main(LV_PALETTE_BLUE), lv_palette_main(LV_PALETTE_RED),
+                                              true, LV_FONT_DEFAULT);
+    lv_disp_set_theme(dispp, theme);
+
+    int64_t startUs = esp_timer_get_time();
+    uint32_t now = lv_tick_get();
+    int built = 0;
+
+    for (int i = 0; i < m_count; i++) {
+        if (!SCREEN_ON_DEMAND || m_desc[i].pinned) {
+            if (*m_desc[i].screen == NULL) {
+                m_desc[i].init();
+                built++;
+            }
+            m_slots[i].last_visit = now;
+        }
+    }
+
+    m_stats.boot_build_us = (uint32_t)(esp_timer_get_time() - startUs);
+    m_stats.builds = built;
+    m_stats.peak_resident = residentCount();
+    sampleMemory();
+
+    printf("[ScreenManager] UI%d启动创建%d/%d个屏幕，耗时 %lu us，LVGL内存占用 %lu KB\n",
+           set == SCREEN_SET_UI1 ? 1 : 2, built, m_count,
+           (unsigned long)m_stats.boot_build_us, (unsigned long)(m_stats.lvgl_mem_used / 1024));
+}
+
+bool ScreenManager::load(int page, lv_scr_load_anim_t anim, uint32_t time_ms) {
+    for (int i = 0; i < m_count; i++) {
+        if (m_desc[i].page != page) {
+            continue;
+        }
+
+        // 未创建的屏幕由_ui_screen_change现场创建，并通过noteCreated记录
+        if (m_set == SCREEN_SET_UI1) {
+            _ui_screen_change(m_desc[i].screen, anim, (int)time_ms, 0, m_desc[i].init);
+        } else {
+            _ui2_screen_change(m_desc[i].screen, anim, (int)time_ms, 0, m_desc[i].init);
+        }
+        return *m_desc[i].screen != NULL;
+    }
+    return false;
+}
+
+void ScreenManager::noteCreated(lv_obj_t* screen, uint32_t build_us) {
+    int index = findSlot(screen);
+    if (index < 0) {
+        return;
+    }
+
+    m_slots[index].last_visit = lv_tick_get();
+    m_slots[index].prewarmed = false;
+    m_stats.on_demand_builds++;
+    recordBuild(build_us);
+
+    printf("[ScreenManager] 现场创建屏幕%s，耗时 %lu us\n", m_desc[index].name, (unsigned long)build_us);
+}
+
+void ScreenManager::noteShown(lv_obj_t* screen) {
+    int index = findSlot(screen);
+    if (index < 0) {
+        return;
+    }
+
+    uint32_t now = lv_tick_get();
+
+    if (m_current >= 0 && m_current != index) {
+        // 离开的屏幕从现在开始计算空闲时间
+        m_slots[m_current].last_visit = now;
+
+        // 记录切换次数，计数饱和时整行减半以保留相对比例
+        uint16_t* row = m_transitions[m_current];
+        if (row[index] == UINT16_MAX) {
+            for (int j = 0; j < SCREEN_SLOT_MAX; j++) {
+                row[j] >>= 1;
+            }
+        }
+        row[index]++;
+    }
+
+    if (m_slots[index].prewarmed) {
+        m_slots[index].prewarmed = false;
+        m_stats.prewarm_hits++;
+    }
+    m_slots[index].last_visit = now;
+
+    if (index != m_current) {
+        m_current = index;
+        m_shownAt = now;
+        m_prewarmDone = false;
+    }
+}
+
+lv_obj_t* ScreenManager::maintain(bool allow_prewarm) {
+    if (!m_desc) {
+        return nullptr;
+    }
+
+    // 切换动画进行中，新旧屏幕都在使用
+    lv_disp_t* disp = lv_disp_get_default();
+    if (!disp || disp->prev_scr || disp->scr_to_load) {
+        return nullptr;
+    }
+
+    sampleMemory();
+
+#if SCREEN_ON_DEMAND
+    uint32_t now = lv_tick_get();
+    int target = (m_prewarm && allow_prewarm && m_current >= 0) ? predictNext(m_current) : -1;
+
+    // 释放空闲屏幕
+    for (int i = 0; i < m_count; i++) {
+        if (isEvictable(i, target) && now - m_slots[i].last_visit >= m_idleMs) {
+            evict(i, "空闲");
+        }
+    }
+
+    // 超出常驻上限时按LRU释放（现场创建的屏幕可能使数量超限）
+    while (residentCount() > m_maxResident) {
+        int lru = findLru(target);
+        if (lru < 0) {
+            break;
+        }
+        evict(lru, "超出常驻上限");
+    }
+
+    // 预创建：每次切换后只尝试一次，等切换动画结束后进行
+    if (target < 0 || m_prewarmDone || now - m_shownAt < SCREEN_PREWARM_DELAY_MS) {
+        return nullptr;
+    }
+    m_prewarmDone = true;
+
+    if (*m_desc[target].screen != NULL) {
+        return nullptr;
+    }
+
+    if (residentCount() >= m_maxResident) {
+        int lru = findLru(target);
+        if (lru < 0) {
+            return nullptr;
+        }
+        evict(lru, "为预创建腾出名额");
+    }
+
+    int64_t startUs = esp_timer_get_time();
+    m_desc[target].init();
+    uint32_t buildUs = (uint32_t)(esp_timer_get_time() - startUs);
+
+    m_slots[target].last_visit = now;
+    m_slots[target].prewarmed = true;
+    m_stats.prewarm_builds++;
+    recordBuild(buildUs);
+
+    printf("[ScreenManager] 预创建屏幕%s（当前%s），耗时 %lu us\n",
+           m_desc[target].name, m_desc[m_current].name, (unsigned long)buildUs);
+    return *m_desc[target].screen;
+#else
+    (void)allow_prewarm;
+    return nullptr;
+#endif
+}
+
+void ScreenManager::setPolicy(uint32_t idle_ms, uint8_t max_resident, bool prewarm) {
+    m_idleMs = idle_ms < 5000 ? 5000 : idle_ms;
+    m_maxResident = max_resident < 2 ? 2 : (max_resident > SCREEN_SLOT_MAX ? SCREEN_SLOT_MAX : max_resident);
+    m_prewarm = prewarm;
+
+    printf("[ScreenManager] 释放策略：空闲 %lu ms，常驻上限 %u，预创建%s\n",
+           (unsigned long)m_idleMs, m_maxResident, m_prewarm ? "开启" : "关闭");
+}
+
+void ScreenManager::getStats(ScreenManagerStats* stats) const {
+    if (!stats) {
+        return;
+    }
+
+    *stats = m_stats;
+    stats->resident_count = residentCount();
+}
+
+int ScreenManager::findSlot(lv_obj_t* screen) const {
+    if (!screen) {
+        return -1;
+    }
+    for (int i = 0; i < m_count; i++) {
+        if (*m_desc[i].screen == screen) {
+            return i;
+        }
+    }
+    return -1;
+}
+
+int ScreenManager::residentCount() const {
+    int count = 0;
+    for (int i = 0; i < m_count; i++) {
+        if (*m_desc[i].screen != NULL) {
+            count++;
+        }
+    }
+    return count;
+}
+
+int ScreenManager::predictNext(int from) const {
+    int best = -1;
+    uint16_t bestCount = 0;
+    for (int i = 0; i < m_count; i++) {
+        if (m_transitions[from][i] > bestCount) {
+            bestCount = m_transitions[from][i];
+            best = i;
+        }
+    }
+    return best >= 0 ? best : m_desc[from].next;
+}
+
+bool ScreenManager::isEvictable(int index, int keep) const {
+    lv_obj_t* screen = *m_desc[index].screen;
+    return screen != NULL
+        && !m_desc[index].pinned
+        && index != m_current
+        && index != keep
+        && screen != lv_scr_act();
+}
+
+int ScreenManager::findLru(int keep) const {
+    int lru = -1;
+    for (int i = 0; i < m_count; i++) {
+        if (isEvictable(i, keep) && (lru < 0 || m_slots[i].last_visit < m_slots[lru].last_visit)) {
+            lru = i;
+        }
+    }
+    return lru;
+}
+
+void ScreenManager::evict(int index, const char* reason) {
+    if (m_slots[index].prewarmed) {
+        m_stats.prewarm_wasted++;
+    }
+    m_slots[index].prewarmed = false;
+
+    // 屏幕变量及其控件变量由SquareLine的destroy函数置空，显示更新会自动跳过
+    m_desc[index].destroy();
+    m_stats.evictions++;
+
+    printf("[ScreenManager] 释放屏幕%s（%s）\n", m_desc[index].name, reason);
+}
+
+void ScreenManager::recordBuild(uint32_t build_us) {
+    m_stats.builds++;
+    m_buildUsTotal += build_us;
+    m_stats.avg_build_us = (uint32_t)(m_buildUsTotal / m_stats.builds);
+    if (build_us > m_stats.max_build_us) {
+        m_stats.max_build_us = build_us;
+    }
+
+    uint32_t resident = residentCount();
+    if (resident > m_stats.peak_resident) {
+        m_stats.peak_resident = resident;
+    }
+    sampleMemory();
+}
+
+void ScreenManager::sampleMemory() {
+    lv_mem_monitor_t mon;
+    lv_mem_monitor(&mon);
+    m_stats.lvgl_mem_total = mon.total_size;
+    m_stats.lvgl_mem_used = mon.total_size - mon.free_size;
+    if (mon.max_used > m_stats.lvgl_mem_peak) {
+        m_stats.lvgl_mem_peak = mon.max_used;
+    }
+}
@@ -0,0 +1,213 @@
+/*
+ * ScreenManager.h - UI屏幕按需创建管理器头文件
+ * ESP32S3监控项目 - 屏幕生命周期模块
+ *
+ * 功能特性：
+ * - 启动时只创建待机屏幕，其余屏幕在第一次显示时才创建，缩短开机到首帧的时间
+ * - 长时间未访问的屏幕自动释放，限制同时常驻的屏幕数，降低LVGL内存峰值
+ * - 记录屏幕间的切换次数，空闲时预创建下一个最可能访问的屏幕，避免切换时现场创建
+ * - 统计创建/释放次数、创建耗时、预创建命中率和LVGL内存占用
+ *
+ * 屏幕仍由SquareLine生成的*_screen_init/*_screen_destroy创建和释放，
+ * 屏幕变量为NULL表示尚未创建，_ui_screen_change会在需要时自动创建
+ */
+
+#ifndef SCREEN_MANAGER_H
+#define SCREEN_MANAGER_H
+
+#include <Arduino.h>
+#include "lvgl.h"
+
+// 屏幕管理配置
+#define SCREEN_ON_DEMAND          1       // 1：按需创建屏幕，0：启动时创建全部屏幕（旧行为）
+#define SCREEN_EVICT_IDLE_MS      60000   // 超过该时间未访问的屏幕被释放
+#define SCREEN_MAX_RESIDENT       4       // 同时常驻的屏幕数上限（含待机屏幕）
+#define SCREEN_PREWARM_ENABLED    1       // 1：空闲时预创建下一个最可能访问的屏幕
+#define SCREEN_PREWARM_DELAY_MS   1000    // 切换后等待多久再预创建（避开切换动画）
+#define SCREEN_SLOT_MAX           10      // 单套UI的最大屏幕数
+
+/**
+ * @brief 屏幕集合（对应UI主题）
+ */
+enum ScreenSet {
+    SCREEN_SET_NONE = 0,    ///< 未创建UI
+    SCREEN_SET_UI1,         ///< UI1（10个屏幕）
+    SCREEN_SET_UI2          ///< UI2（6个屏幕）
+};
+
+/**
+ * @brief 屏幕管理统计
+ */
+struct ScreenManagerStats {
+    uint32_t resident_count;    ///< 当前已创建的屏幕数
+    uint32_t peak_resident;     ///< 已创建屏幕数峰值
+    uint32_t builds;            ///< 屏幕创建总次数
+    uint32_t on_demand_builds;  ///< 切换时现场创建的次数
+    uint32_t prewarm_builds;    ///< 预创建次数
+    uint32_t prewarm_hits;      ///< 预创建后被访问的次数
+    uint32_t prewarm_wasted;    ///< 预创建后未访问就被释放的次数
+    uint32_t evictions;         ///< 释放次数
+    uint32_t avg_build_us;      ///< 平均创建耗时
+    uint32_t max_build_us;      ///< 最大创建耗时
+    uint32_t boot_build_us;     ///< 启动时创建屏幕的耗时
+    uint32_t lvgl_mem_used;     ///< LVGL内存当前占用（字节）
+    uint32_t lvgl_mem_peak;     ///< LVGL内存占用峰值（字节）
+    uint32_t lvgl_mem_total;    ///< LVGL内存池大小（字节）
+};
+
+/**
+ * @brief UI屏幕按需创建管理器
+ *
+ * 除统计查询和策略设置外，所有接口都需要在持有LVGL锁时调用
+ */
+class ScreenManager {
+public:
+    ScreenManager();
+
+    /**
+     * @brief 应用主题并创建启动所需的屏幕（需持有LVGL锁）
+     *
+     * 代替ui_init/ui2_init，不加载屏幕，由调用者显示待机屏幕
+     *
+     * @param set 屏幕集合
+     */
+    void begin(ScreenSet set);
+
+    /**
+     * @brief 获取当前屏幕集合
+     */
+    ScreenSet getSet() const { return m_set; }
+
+    /**
+     * @brief 切换到页面对应的屏幕，未创建时先创建（需持有LVGL锁）
+     *
+     * @param page DisplayPage页面编号
+     * @param anim 切换动画
+     * @param time_ms 动画时长
+     * @return true 切换成功，false 当前UI没有该页面
+     */
+    bool load(int page, lv_scr_load_anim_t anim, uint32_t time_ms);
+
+    /**
+     * @brief 记录屏幕创建（由_ui_screen_change创建屏幕后调用）
+     */
+    void noteCreated(lv_obj_t* screen, uint32_t build_us);
+
+    /**
+     * @brief 记录屏幕被显示（更新访问时间和切换统计）
+     */
+    void noteShown(lv_obj_t* screen);
+
+    /**
+     * @brief 释放空闲屏幕并按需预创建（需持有LVGL锁，显示任务定期调用）
+     *
+     * 屏幕切换动画进行中时不做任何处理
+     *
+     * @param allow_prewarm 是否允许预创建（熄屏时不预创建）
+     * @return 本次预创建的屏幕，没有时返回nullptr
+     */
+    lv_obj_t* maintain(bool allow_prewarm);
+
+    /**
+     * @brief 设置释放策略
+     *
+     * @param idle_ms 空闲多久释放屏幕
+     * @param max_resident 常驻屏幕数上限（至少2）
+     * @param prewarm 是否启用预创建
+     */
+    void setPolicy(uint32_t idle_ms, uint8_t max_resident, bool prewarm);
+
+    uint32_t getIdleTimeout() const { return m_idleMs; }
+    uint8_t getMaxResident() const { return m_maxResident; }
+    bool isPrewarmEnabled() const { return m_prewarm; }
+
+    /**
+     * @brief 获取统计数据
+     */
+    void getStats(ScreenManagerStats* stats) const;
+
+private:
+    /**
+     * @brief 屏幕描述（SquareLine生成的屏幕变量和创建/释放函数）
+     */
+    struct ScreenDesc {
+        const char* name;
+        lv_obj_t** screen;
+        void (*init)(void);
+        void (*destroy)(void);
+        int8_t page;            ///< 对应的DisplayPage，端口详情页为-1
+        int8_t next;            ///< 没有切换记录时预测的下一个屏幕
+        bool pinned;            ///< 常驻不释放
+    };
+
+    /**
+     * @brief 屏幕运行状态
+     */
+    struct ScreenSlot {
+        uint32_t last_visit;    ///< 最后访问（或创建）时间
+        bool prewarmed;         ///< 预创建后尚未访问
+    };
+
+    static const ScreenDesc s_ui1Screens[];
+    static const ScreenDesc s_ui2Screens[];
+
+    ScreenSet m_set;
+    const ScreenDesc* m_desc;
+    int m_count;
+    ScreenSlot m_slots[SCREEN_SLOT_MAX];
+    uint16_t m_transitions[SCREEN_SLOT_MAX][SCREEN_SLOT_MAX];
+    int m_current;
+    uint32_t m_shownAt;
+    bool m_prewarmDone;
+
+    // 策略
+    uint32_t m_idleMs;
+    uint8_t m_maxResident;
+    bool m_prewarm;
+
+    // 统计
+    ScreenManagerStats m_stats;
+    uint64_t m_buildUsTotal;
+
+    /**
+     * @brief 按屏幕对象查找索引
+     */
+    int findSlot(lv_obj_t* screen) const;
+
+    /**
+     * @brief 统计已创建的屏幕数
+     */
+    int residentCount() const;
+
+    /**
+     * @brief 预测下一个最可能访问的屏幕
+     */
+    int predictNext(int from) const;
+
+    /**
+     * @brief 检查屏幕是否可以释放（非常驻、非当前显示、非预测目标）
+     */
+    bool isEvictable(int index, int keep) const;
+
+    /**
+     * @brief 查找最久未访问的可释放屏幕，没有时返回-1
+     */
+    int findLru(int keep) const;
+
+    /**
+     * @brief 释放屏幕
+     */
+    void evict(int index, const char* reason);
+
+    /**
+     * @brief 记录一次创建耗时和LVGL内存占用
+     */
+    void recordBuild(uint32_t build_us);
+
+    /**
+     * @brief 采样LVGL内存占用
+     */
+    void sampleMemory();
+};
+
+#endif // SCREEN_MANAGER_H
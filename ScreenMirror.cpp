@@ -0,0 +1,644 @@
+/*
+ * ScreenMirror.cpp - 屏幕镜像实现文件
+ * ESP32S3监控项目 - 远程屏幕镜像模块
+ */
+
+#include "ScreenMirror.h"
+#include "LVGL_Driver.h"
+#include "PSRAMManager.h"
+#include "esp_timer.h"
+#include "esp_heap_caps.h"
+#include "mbedtls/version.h"
+#include "mbedtls/sha1.h"
+#include "mbedtls/base64.h"
+
+// WebSocket握手GUID（RFC 6455）
+static const char* WS_GUID = "258EAFA5-E914-47DA-95CA-C5AB0DC85B11";
+
+// WebSocket操作码
+#define WS_OP_TEXT    0x1
+#define WS_OP_BINARY  0x2
+#define WS_OP_CLOSE   0x8
+#define WS_OP_PING    0x9
+#define WS_OP_PONG    0xA
+
+static inline uint32_t align4(uint32_t n) {
+    return (n + 3) & ~3u;
+}
+
+ScreenMirror::ScreenMirror()
+    : m_driver(nullptr)
+    , m_psramManager(nullptr)
+    , m_task(nullptr)
+    , m_server(SCREEN_MIRROR_PORT)
+    , m_initialized(false)
+    , m_disconnectRequested(false)
+    , m_ring(nullptr)
+    , m_ringSize(0)
+    , m_head(0)
+    , m_tail(0)
+    , m_streaming(false)
+    , m_resyncPending(false)
+    , m_streamGen(0)
+    , m_mux(portMUX_INITIALIZER_UNLOCKED)
+    , m_connections(0)
+    , m_frames(0)
+    , m_areas(0)
+    , m_droppedAreas(0)
+    , m_resyncs(0)
+    , m_rawBytes(0)
+    , m_encodedBytes(0)
+    , m_sentBytes(0)
+    , m_maxCaptureUs(0)
+    , m_ringPeakUsed(0) {
+}
+
+ScreenMirror::~ScreenMirror() {
+    if (m_driver) {
+        m_driver->setFlushCaptureCallback(nullptr, nullptr);
+    }
+    if (m_task) {
+        vTaskDelete(m_task);
+        m_task = nullptr;
+    }
+    if (m_ring) {
+        if (m_psramManager) {
+            m_psramManager->deallocate(m_ring);
+        } else {
+            heap_caps_free(m_ring);
+        }
+        m_ring = nullptr;
+    }
+}
+
+/**
+ * @brief 注册刷新捕获回调并启动WebSocket发送任务
+ */
+bool ScreenMirror::init(LVGLDriver* driver, PSRAMManager* psramManager) {
+    if (m_initialized) {
+        return true;
+    }
+    if (!driver) {
+        printf("[ScreenMirror] 错误：LVGL驱动为空\n");
+        return false;
+    }
+    m_driver = driver;
+    m_psramManager = psramManager;
+
+    BaseType_t result = xTaskCreatePinnedToCore(
+        taskEntry,
+        "ScreenMirror",
+        SCREEN_MIRROR_TASK_STACK,
+        this,
+        SCREEN_MIRROR_TASK_PRIORITY,
+        &m_task,
+        SCREEN_MIRROR_TASK_CORE
+    );
+    if (result != pdPASS) {
+        printf("[ScreenMirror] 错误：创建发送任务失败\n");
+        return false;
+    }
+
+    m_driver->setFlushCaptureCallback(captureCb, this);
+
+    m_initialized = true;
+    printf("[ScreenMirror] 屏幕镜像已初始化：WebSocket端口%d\n", SCREEN_MIRROR_PORT);
+    return true;
+}
+
+/**
+ * @brief 获取统计数据
+ */
+void ScreenMirror::getStats(ScreenMirrorStats* stats) const {
+    if (!stats) {
+        return;
+    }
+
+    portENTER_CRITICAL(&m_mux);
+    stats->streaming = m_streaming;
+    stats->connections = m_connections;
+    stats->frames = m_frames;
+    stats->areas = m_areas;
+    stats->dropped_areas = m_droppedAreas;
+    stats->resyncs = m_resyncs;
+    stats->raw_bytes = m_rawBytes;
+    stats->encoded_bytes = m_encodedBytes;
+    stats->sent_bytes = m_sentBytes;
+    stats->max_capture_us = m_maxCaptureUs;
+    stats->ring_bytes = m_ringSize;
+    stats->ring_peak_used = m_ringPeakUsed;
+    portEXIT_CRITICAL(&m_mux);
+}
+
+/**
+ * @brief 断开当前客户端（由发送任务执行）
+ */
+void ScreenMirror::disconnect() {
+    m_disconnectRequested = true;
+    if (m_task) {
+        xTaskNotifyGive(m_task);
+    }
+}
+
+void ScreenMirror::captureCb(const lv_area_t* area, const lv_color_t* pixels, int stride,
+                             uint8_t rotation, bool last, void* userdata) {
+    static_cast<ScreenMirror*>(userdata)->capture(area, pixels, stride, rotation, last);
+}
+
+/**
+ * @brief 捕获一个刷新区域
+ *
+ * 在LVGL刷新回调中执行：按行带预留环形缓冲区空间，直接压缩写入，
+ * 空间不足时丢弃并标记需要整屏重绘，从不等待发送任务
+ */
+void ScreenMirror::capture(const lv_area_t* area, const lv_color_t* pixels, int stride, uint8_t rotation, bool last) {
+    if (!m_streaming) {
+        return;
+    }
+
+    int64_t startUs = esp_timer_get_time();
+
+    const int width = area->x2 - area->x1 + 1;
+    const int height = area->y2 - area->y1 + 1;
+
+    uint32_t frame;
+    uint32_t gen;
+    portENTER_CRITICAL(&m_mux);
+    frame = m_frames;
+    if (last) {
+        m_frames++;
+    }
+    gen = m_streamGen;
+    m_areas++;
+    m_rawBytes += (uint64_t)width * height * sizeof(lv_color_t);
+    portEXIT_CRITICAL(&m_mux);
+
+    for (int y = 0; y < height; y += SCREEN_MIRROR_BAND_LINES) {
+        const int lines = (height - y < SCREEN_MIRROR_BAND_LINES) ? (height - y) : SCREEN_MIRROR_BAND_LINES;
+
+        // 最坏情况：每行2字节/像素，加每128像素1个控制字节和行尾的短字面量
+        const uint32_t worst = align4(sizeof(RecordHeader) + lines * (width * 2 + width / 128 + 2));
+
+        // 预留连续空间，尾部不够时写回绕标记从头开始
+        uint32_t pos = 0;
+        bool ok = false;
+        bool wrap = false;
+        portENTER_CRITICAL(&m_mux);
+        uint32_t head = m_head;
+        uint32_t tail = m_tail;
+        if (gen == m_streamGen && m_streaming) {
+            if (tail >= head) {
+                if (m_ringSize - tail > worst) {
+                    pos = tail;
+                    ok = true;
+                } else if (head > worst) {
+                    pos = 0;
+                    ok = true;
+                    wrap = true;
+                }
+            } else if (head - tail > worst) {
+                pos = tail;
+                ok = true;
+            }
+            if (!ok) {
+                m_droppedAreas++;
+                m_resyncPending = true;
+            }
+        }
+        portEXIT_CRITICAL(&m_mux);
+
+        if (!ok) {
+            // 客户端跟不上，丢弃本区域剩余部分，追上后整屏重绘
+            break;
+        }
+
+        if (wrap) {
+            *(uint32_t*)(m_ring + tail) = WRAP_MARKER;
+        }
+
+        uint8_t* record = m_ring + pos;
+        uint32_t length = encodeRLE(pixels + y * stride, width, lines, stride, record + sizeof(RecordHeader));
+
+        RecordHeader header;
+        header.x = area->x1;
+        header.y = area->y1 + y;
+        header.w = width;
+        header.h = lines;
+        header.frame = frame;
+        header.flags = (last && y + lines >= height) ? SCREEN_MIRROR_FLAG_LAST : 0;
+        header.rotation = rotation;
+        header.reserved = 0;
+        header.length = length;
+        memcpy(record, &header, sizeof(header));
+
+        uint32_t total = align4(sizeof(RecordHeader) + length);
+
+        // 发布记录（推流已重新开始时放弃）
+        portENTER_CRITICAL(&m_mux);
+        if (gen == m_streamGen) {
+            m_tail = pos + total;
+            uint32_t used = (m_tail >= m_head) ? (m_tail - m_head) : (m_ringSize - m_head + m_tail);
+            if (used > m_ringPeakUsed) {
+                m_ringPeakUsed = used;
+            }
+            m_encodedBytes += total;
+        }
+        portEXIT_CRITICAL(&m_mux);
+    }
+
+    uint32_t elapsed = (uint32_t)(esp_timer_get_time() - startUs);
+    portENTER_CRITICAL(&m_mux);
+    if (elapsed > m_maxCaptureUs) {
+        m_maxCaptureUs = elapsed;
+    }
+    portEXIT_CRITICAL(&m_mux);
+
+    if (last && m_task) {
+        xTaskNotifyGive(m_task);
+    }
+}
+
+/**
+ * @brief RLE压缩一个矩形区域（逐行压缩，重复段不跨行）
+ */
+uint32_t ScreenMirror::encodeRLE(const lv_color_t* pixels, int width, int height, int stride, uint8_t* out) {
+    uint8_t* o = out;
+
+    for (int y = 0; y < height; y++) {
+        const uint16_t* row = (const uint16_t*)(pixels + y * stride);
+        int i = 0;
+        while (i < width) {
+            int run = 1;
+            while (i + run < width && run < 128 && row[i + run] == row[i]) {
+                run++;
+            }
+
+            if (run >= 2) {
+                *o++ = 0x80 | (run - 1);
+                memcpy(o, &row[i], 2);
+                o += 2;
+                i += run;
+                continue;
+            }
+
+            // 原样像素段，遇到3个以上相同像素时结束
+            int start = i;
+            int count = 0;
+            while (i < width && count < 128) {
+                if (i + 2 < width && row[i] == row[i + 1] && row[i] == row[i + 2]) {
+                    break;
+                }
+                i++;
+                count++;
+            }
+            *o++ = count - 1;
+            memcpy(o, &row[start], count * 2);
+            o += count * 2;
+        }
+    }
+
+    return (uint32_t)(o - out);
+}
+
+void ScreenMirror::taskEntry(void* arg) {
+    static_cast<ScreenMirror*>(arg)->mirrorTask();
+}
+
+/**
+ * @brief 发送任务：接受连接、发送记录、处理客户端消息
+ */
+void ScreenMirror::mirrorTask() {
+    m_server.begin();
+    m_server.setNoDelay(true);
+
+    while (true) {
+        WiFiClient incoming = m_server.available();
+        if (incoming) {
+            if (acceptClient(incoming)) {
+                // 只服务一个客户端，新连接替换旧连接
+                if (m_streaming) {
+                    printf("[ScreenMirror] 新客户端连接，断开上一个客户端\n");
+                    endStream();
+                    m_client.stop();
+                }
+                m_client = incoming;
+                if (!beginStream()) {
+                    m_client.stop();
+                }
+            } else {
+                incoming.stop();
+            }
+        }
+
+        if (!m_streaming) {
+            m_disconnectRequested = false;
+            vTaskDelay(pdMS_TO_TICKS(100));
+            continue;
+        }
+
+        if (m_disconnectRequested || !m_client.connected() || !pollClient()) {
+            printf("[ScreenMirror] 客户端已断开\n");
+            m_disconnectRequested = false;
+            endStream();
+            m_client.stop();
+            continue;
+        }
+
+        if (sendPending()) {
+            continue;
+        }
+
+        // 缓冲区已清空：丢弃过区域时整屏重绘一次使客户端画面恢复一致
+        if (m_resyncPending) {
+            m_resyncPending = false;
+            portENTER_CRITICAL(&m_mux);
+            m_resyncs++;
+            portEXIT_CRITICAL(&m_mux);
+            requestFullRefresh();
+        }
+
+        ulTaskNotifyTake(pdTRUE, pdMS_TO_TICKS(50));
+    }
+}
+
+/**
+ * @brief 完成WebSocket握手
+ */
+bool ScreenMirror::acceptClient(WiFiClient& client) {
+    uint32_t start = millis();
+    while (!client.available()) {
+        if (!client.connected() || millis() - start > 2000) {
+            return false;
+        }
+        vTaskDelay(pdMS_TO_TICKS(10));
+    }
+
+    String key;
+    while (client.connected()) {
+        String line = client.readStringUntil('\n');
+        line.trim();
+        if (line.length() == 0) {
+            break;
+        }
+        int colon = line.indexOf(':');
+        if (colon > 0 && line.substring(0, colon).equalsIgnoreCase("Sec-WebSocket-Key")) {
+            key = line.substring(colon + 1);
+            key.trim();
+        }
+    }
+
+    if (key.length() == 0) {
+        client.print("HTTP/1.1 400 Bad Request\r\nConnection: close\r\n\r\n");
+        printf("[ScreenMirror] 拒绝非WebSocket请求\n");
+        return false;
+    }
+
+    // Sec-WebSocket-Accept = base64(sha1(key + GUID))
+    String source = key + WS_GUID;
+    unsigned char digest[20];
+#if MBEDTLS_VERSION_NUMBER >= 0x03000000
+    mbedtls_sha1((const unsigned char*)source.c_str(), source.length(), digest);
+#else
+    mbedtls_sha1_ret((const unsigned char*)source.c_str(), source.length(), digest);
+#endif
+    unsigned char accept[32];
+    size_t acceptLen = 0;
+    mbedtls_base64_encode(accept, sizeof(accept) - 1, &acceptLen, digest, sizeof(digest));
+    accept[acceptLen] = '\0';
+
+    client.print("HTTP/1.1 101 Switching Protocols\r\n"
+                 "Upgrade: websocket\r\n"
+                 "Connection: Upgrade\r\n"
+                 "Sec-WebSocket-Accept: ");
+    client.print((const char*)accept);
+    client.print("\r\n\r\n");
+    client.setNoDelay(true);
+    return true;
+}
+
+/**
+ * @brief 开始向新客户端推流
+ */
+bool ScreenMirror::beginStream() {
+    if (!m_ring) {
+        if (m_psramManager) {
+            m_ring = (uint8_t*)m_psramManager->allocate(SCREEN_MIRROR_RING_BYTES, "屏幕镜像缓冲区", POOL_BUFFER);
+        } else {
+            m_ring = (uint8_t*)heap_caps_malloc(SCREEN_MIRROR_RING_BYTES, MALLOC_CAP_SPIRAM);
+        }
+        if (!m_ring) {
+            printf("[ScreenMirror] 错误：环形缓冲区分配失败（%u字节）\n", (unsigned)SCREEN_MIRROR_RING_BYTES);
+            return false;
+        }
+        m_ringSize = SCREEN_MIRROR_RING_BYTES;
+    }
+
+    lv_disp_t* disp = lv_disp_get_default();
+    char hello[96];
+    int len = snprintf(hello, sizeof(hello), "{\"w\":%d,\"h\":%d,\"swap\":%d,\"ring\":%u}",
+                       disp ? disp->driver->hor_res : 0, disp ? disp->driver->ver_res : 0,
+                       LV_COLOR_16_SWAP, (unsigned)m_ringSize);
+    if (!writeFrameHeader(WS_OP_TEXT, len) || !writeAll((const uint8_t*)hello, len)) {
+        return false;
+    }
+
+    portENTER_CRITICAL(&m_mux);
+    m_streamGen++;
+    m_head = 0;
+    m_tail = 0;
+    m_resyncPending = false;
+    m_streaming = true;
+    m_connections++;
+    portEXIT_CRITICAL(&m_mux);
+
+    printf("[ScreenMirror] 客户端已连接：%s\n", m_client.remoteIP().toString().c_str());
+
+    // 第一帧为整屏
+    requestFullRefresh();
+    return true;
+}
+
+/**
+ * @brief 停止推流
+ */
+void ScreenMirror::endStream() {
+    portENTER_CRITICAL(&m_mux);
+    m_streaming = false;
+    m_streamGen++;
+    portEXIT_CRITICAL(&m_mux);
+}
+
+/**
+ * @brief 发送缓冲区中的记录，合并为一条WebSocket二进制消息
+ */
+bool ScreenMirror::sendPending() {
+    uint32_t head;
+    uint32_t tail;
+    portENTER_CRITICAL(&m_mux);
+    head = m_head;
+    tail = m_tail;
+    portEXIT_CRITICAL(&m_mux);
+
+    if (head == tail) {
+        return false;
+    }
+
+    if (*(const uint32_t*)(m_ring + head) == WRAP_MARKER) {
+        head = 0;
+        portENTER_CRITICAL(&m_mux);
+        m_head = 0;
+        portEXIT_CRITICAL(&m_mux);
+        if (head == tail) {
+            return false;
+        }
+    }
+
+    // 从head开始合并连续的记录，遇到回绕标记、tail或消息上限时停止
+    uint32_t end = head;
+    while (end != tail && end - head < SCREEN_MIRROR_MSG_BYTES) {
+        if (*(const uint32_t*)(m_ring + end) == WRAP_MARKER) {
+            break;
+        }
+        const RecordHeader* header = (const RecordHeader*)(m_ring + end);
+        end += align4(sizeof(RecordHeader) + header->length);
+    }
+
+    uint32_t length = end - head;
+    if (!writeFrameHeader(WS_OP_BINARY, length) || !writeAll(m_ring + head, length)) {
+        m_disconnectRequested = true;
+        return false;
+    }
+
+    portENTER_CRITICAL(&m_mux);
+    m_head = end;
+    m_sentBytes += length;
+    portEXIT_CRITICAL(&m_mux);
+    return true;
+}
+
+/**
+ * @brief 处理客户端发来的帧
+ */
+bool ScreenMirror::pollClient() {
+    while (m_client.available() >= 2) {
+        uint8_t hdr[2];
+        if (m_client.readBytes(hdr, 2) != 2) {
+            return false;
+        }
+        uint8_t opcode = hdr[0] & 0x0F;
+        bool masked = (hdr[1] & 0x80) != 0;
+        uint64_t length = hdr[1] & 0x7F;
+        if (length == 126) {
+            uint8_t ext[2];
+            if (m_client.readBytes(ext, 2) != 2) {
+                return false;
+            }
+            length = ((uint64_t)ext[0] << 8) | ext[1];
+        } else if (length == 127) {
+            // 客户端只发送短消息
+            return false;
+        }
+
+        uint8_t mask[4] = {0, 0, 0, 0};
+        if (masked && m_client.readBytes(mask, 4) != 4) {
+            return false;
+        }
+
+        // 只保留前125字节（控制帧和命令都很短），其余读出丢弃
+        uint8_t payload[126];
+        size_t kept = length < 125 ? (size_t)length : 125;
+        if (m_client.readBytes(payload, kept) != kept) {
+            return false;
+        }
+        for (uint64_t i = kept; i < length; i++) {
+            uint8_t discard;
+            if (m_client.readBytes(&discard, 1) != 1) {
+                return false;
+            }
+        }
+        for (size_t i = 0; i < kept; i++) {
+            payload[i] ^= mask[i & 3];
+        }
+        payload[kept] = '\0';
+
+        switch (opcode) {
+            case WS_OP_CLOSE:
+                writeFrameHeader(WS_OP_CLOSE, 0);
+                return false;
+
+            case WS_OP_PING:
+                if (!writeFrameHeader(WS_OP_PONG, kept) || !writeAll(payload, kept)) {
+                    return false;
+                }
+                break;
+
+            case WS_OP_TEXT:
+                if (strcmp((const char*)payload, "refresh") == 0) {
+                    requestFullRefresh();
+                }
+                break;
+
+            default:
+                break;
+        }
+    }
+    return true;
+}
+
+/**
+ * @brief 发送一个WebSocket帧头（服务器发送的帧不加掩码）
+ */
+bool ScreenMirror::writeFrameHeader(uint8_t opcode, uint32_t length) {
+    uint8_t header[4];
+    size_t size;
+    header[0] = 0x80 | opcode;
+    if (length < 126) {
+        header[1] = (uint8_t)length;
+        size = 2;
+    } else if (length <= 0xFFFF) {
+        header[1] = 126;
+        header[2] = (uint8_t)(length >> 8);
+        header[3] = (uint8_t)length;
+        size = 4;
+    } else {
+        uint8_t extended[10] = {
+            (uint8_t)(0x80 | opcode), 127, 0, 0, 0, 0,
+            (uint8_t)(length >> 24), (uint8_t)(length >> 16), (uint8_t)(length >> 8), (uint8_t)length
+        };
+        return writeAll(extended, sizeof(extended));
+    }
+    return writeAll(header, size);
+}
+
+/**
+ * @brief 发送全部数据
+ */
+bool ScreenMirror::writeAll(const uint8_t* data, size_t length) {
+    uint32_t lastProgress = millis();
+    while (length > 0) {
+        size_t written = m_client.write(data, length);
+        if (written == 0) {
+            // 客户端长时间不接收时断开（期间刷新回调照常丢弃区域，不受影响）
+            if (!m_client.connected() || millis() - lastProgress > 3000) {
+                return false;
+            }
+            vTaskDelay(pdMS_TO_TICKS(5));
+            continue;
+        }
+        data += written;
+        length -= written;
+        lastProgress = millis();
+    }
+    return true;
+}
+
+/**
+ * @brief 使当前屏幕整屏无效
+ */
+void ScreenMirror::requestFullRefresh() {
+    if (!m_driver || !m_driver->lock(100)) {
+        return;
+    }
+    lv_obj_invalidate(lv_scr_act());
+    m_driver->unlock();
+}
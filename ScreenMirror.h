@@ -0,0 +1,208 @@
+/*
+ * ScreenMirror.h - 屏幕镜像头文件
+ * ESP32S3监控项目 - 远程屏幕镜像模块
+ *
+ * 功能特性：
+ * - 在LVGL刷新回调中只复制本次刷新的脏矩形，按RLE压缩写入PSRAM环形缓冲区
+ * - 刷新回调只做压缩和拷贝，从不等待：缓冲区放不下时直接丢弃该区域，
+ *   客户端追上后请求整屏重绘一次，使浏览器端画面恢复一致
+ * - 独立任务在WebSocket端口上把缓冲区中的记录发送给浏览器，浏览器按矩形还原整帧
+ * - 没有客户端连接时刷新回调只检查一个标志，不占用CPU和内存
+ *
+ * 协议（WebSocket，单客户端）：
+ * - 连接后先发送一条文本消息：{"w":368,"h":448,"swap":1,"ring":N}
+ * - 之后每条二进制消息包含一条或多条记录，记录头为小端序：
+ *   x(2) y(2) w(2) h(2) frame(4) flags(1) rotation(1) reserved(2) length(4)，
+ *   之后是length字节的RLE数据，记录总长度按4字节对齐
+ * - RLE以16位像素为单位：控制字节最高位为1时表示(低7位+1)个重复像素，后跟1个像素；
+ *   最高位为0时表示(低7位+1)个原样像素
+ * - 客户端可发送文本消息"refresh"请求整屏重绘
+ */
+
+#ifndef SCREEN_MIRROR_H
+#define SCREEN_MIRROR_H
+
+#include <Arduino.h>
+#include <WiFi.h>
+#include "freertos/FreeRTOS.h"
+#include "freertos/task.h"
+#include "lvgl.h"
+
+// 前向声明
+class LVGLDriver;
+class PSRAMManager;
+
+// 屏幕镜像配置
+#define SCREEN_MIRROR_ENABLED       1               // 1：启用屏幕镜像WebSocket服务
+#define SCREEN_MIRROR_PORT          81              // WebSocket端口
+#define SCREEN_MIRROR_RING_BYTES    (512 * 1024)    // PSRAM环形缓冲区大小（首次连接客户端时分配）
+#define SCREEN_MIRROR_BAND_LINES    32              // 大区域按该行数拆分为多条记录，限制单条记录的预留空间
+#define SCREEN_MIRROR_MSG_BYTES     (32 * 1024)     // 单条WebSocket消息合并记录的上限（单条记录更大时单独发送）
+#define SCREEN_MIRROR_TASK_STACK    4096            // 发送任务栈大小
+#define SCREEN_MIRROR_TASK_PRIORITY 1               // 发送任务优先级（低于LVGL和显示任务）
+#define SCREEN_MIRROR_TASK_CORE     0               // 发送任务运行核心
+
+#define SCREEN_MIRROR_FLAG_LAST     0x01            // 记录标志：一帧的最后一个区域
+
+/**
+ * @brief 屏幕镜像统计
+ */
+struct ScreenMirrorStats {
+    bool streaming;                 ///< 是否有客户端正在接收
+    uint32_t connections;           ///< 累计连接次数
+    uint32_t frames;                ///< 捕获的帧数
+    uint32_t areas;                 ///< 捕获的区域数
+    uint32_t dropped_areas;         ///< 缓冲区不足丢弃的区域数
+    uint32_t resyncs;               ///< 因丢弃请求整屏重绘的次数
+    uint64_t raw_bytes;             ///< 捕获区域的原始像素字节数
+    uint64_t encoded_bytes;         ///< 压缩后写入缓冲区的字节数
+    uint64_t sent_bytes;            ///< 发送给客户端的字节数
+    uint32_t max_capture_us;        ///< 刷新回调中单次捕获的最大耗时
+    uint32_t ring_bytes;            ///< 环形缓冲区大小
+    uint32_t ring_peak_used;        ///< 环形缓冲区最高占用
+};
+
+/**
+ * @brief 远程屏幕镜像
+ *
+ * capture在LVGL刷新回调中调用（单生产者），发送任务是唯一的消费者
+ */
+class ScreenMirror {
+public:
+    ScreenMirror();
+    ~ScreenMirror();
+
+    /**
+     * @brief 注册刷新捕获回调并启动WebSocket发送任务
+     *
+     * @param driver LVGL驱动
+     * @param psramManager PSRAM管理器（为空时直接从PSRAM堆分配）
+     * @return true 成功，false 失败
+     */
+    bool init(LVGLDriver* driver, PSRAMManager* psramManager);
+
+    /**
+     * @brief 检查是否有客户端正在接收
+     */
+    bool isStreaming() const { return m_streaming; }
+
+    /**
+     * @brief 获取统计数据
+     */
+    void getStats(ScreenMirrorStats* stats) const;
+
+    /**
+     * @brief 断开当前客户端
+     */
+    void disconnect();
+
+private:
+    LVGLDriver* m_driver;
+    PSRAMManager* m_psramManager;
+    TaskHandle_t m_task;
+    WiFiServer m_server;
+    WiFiClient m_client;
+    bool m_initialized;
+    volatile bool m_disconnectRequested;
+
+    // 环形缓冲区（capture写tail，发送任务写head，由m_mux保护索引）
+    uint8_t* m_ring;
+    uint32_t m_ringSize;
+    volatile uint32_t m_head;
+    volatile uint32_t m_tail;
+    volatile bool m_streaming;
+    volatile bool m_resyncPending;
+    uint32_t m_streamGen;           ///< 每次开始推流加一，丢弃上一次推流中未完成的写入
+    mutable portMUX_TYPE m_mux;
+
+    // 统计（由m_mux保护）
+    uint32_t m_connections;
+    uint32_t m_frames;
+    uint32_t m_areas;
+    uint32_t m_droppedAreas;
+    uint32_t m_resyncs;
+    uint64_t m_rawBytes;
+    uint64_t m_encodedBytes;
+    uint64_t m_sentBytes;
+    uint32_t m_maxCaptureUs;
+    uint32_t m_ringPeakUsed;
+
+    /**
+     * @brief 记录头（小端序，20字节）
+     */
+    struct __attribute__((packed)) RecordHeader {
+        uint16_t x;
+        uint16_t y;
+        uint16_t w;
+        uint16_t h;
+        uint32_t frame;
+        uint8_t flags;
+        uint8_t rotation;
+        uint16_t reserved;
+        uint32_t length;
+    };
+
+    static const uint32_t WRAP_MARKER = 0xFFFFFFFF;  ///< 环形缓冲区尾部的回绕标记
+
+    // 刷新回调（LVGL任务中执行，不能阻塞）
+    static void captureCb(const lv_area_t* area, const lv_color_t* pixels, int stride,
+                          uint8_t rotation, bool last, void* userdata);
+    void capture(const lv_area_t* area, const lv_color_t* pixels, int stride, uint8_t rotation, bool last);
+
+    /**
+     * @brief RLE压缩一个矩形区域
+     *
+     * @return 写入的字节数
+     */
+    static uint32_t encodeRLE(const lv_color_t* pixels, int width, int height, int stride, uint8_t* out);
+
+    // 发送任务
+    static void taskEntry(void* arg);
+    void mirrorTask();
+
+    /**
+     * @brief 完成WebSocket握手
+     */
+    bool acceptClient(WiFiClient& client);
+
+    /**
+     * @brief 开始向新客户端推流（分配缓冲区、发送尺寸、请求整屏重绘）
+     */
+    bool beginStream();
+
+    /**
+     * @brief 停止推流（捕获回调不再写入）
+     */
+    void endStream();
+
+    /**
+     * @brief 发送缓冲区中的记录
+     *
+     * @return true 发送了数据，false 缓冲区为空
+     */
+    bool sendPending();
+
+    /**
+     * @brief 处理客户端发来的帧（关闭、ping、refresh命令）
+     *
+     * @return false 客户端已关闭
+     */
+    bool pollClient();
+
+    /**
+     * @brief 发送一个WebSocket帧头
+     */
+    bool writeFrameHeader(uint8_t opcode, uint32_t length);
+
+    /**
+     * @brief 发送全部数据（分段写入直到完成或连接出错）
+     */
+    bool writeAll(const uint8_t* data, size_t length);
+
+    /**
+     * @brief 使当前屏幕整屏无效，下一帧刷新全部像素
+     */
+    void requestFullRefresh();
+};
+
+#endif // SCREEN_MIRROR_H
@@ -0,0 +1,96 @@
+/*
+ * SoftTimerWheel.cpp - 软定时器表实现文件
+ * ESP32S3监控项目 - 显示任务调度模块
+ */
+
+#include "SoftTimerWheel.h"
+
+SoftTimerWheel::SoftTimerWheel()
+    : m_count(0) {
+}
+
+/**
+ * @brief 设置定时器在delay_ms毫秒后到期
+ */
+void SoftTimerWheel::arm(uint8_t id, uint32_t delay_ms) {
+    armAt(id, xTaskGetTickCount() + pdMS_TO_TICKS(delay_ms));
+}
+
+/**
+ * @brief 设置定时器在指定tick到期（插入排序，保持升序）
+ */
+void SoftTimerWheel::armAt(uint8_t id, TickType_t deadline) {
+    cancel(id);
+
+    if (m_count >= SOFT_TIMER_MAX) {
+        printf("[SoftTimerWheel] 错误：定时器表已满，丢弃定时器%d\n", id);
+        return;
+    }
+
+    int pos = m_count;
+    while (pos > 0 && before(deadline, m_entries[pos - 1].deadline)) {
+        m_entries[pos] = m_entries[pos - 1];
+        pos--;
+    }
+    m_entries[pos].deadline = deadline;
+    m_entries[pos].id = id;
+    m_count++;
+}
+
+/**
+ * @brief 取消定时器
+ */
+void SoftTimerWheel::cancel(uint8_t id) {
+    for (int i = 0; i < m_count; i++) {
+        if (m_entries[i].id == id) {
+            for (int j = i; j < m_count - 1; j++) {
+                m_entries[j] = m_entries[j + 1];
+            }
+            m_count--;
+            return;
+        }
+    }
+}
+
+/**
+ * @brief 检查定时器是否已设置
+ */
+bool SoftTimerWheel::isArmed(uint8_t id) const {
+    for (int i = 0; i < m_count; i++) {
+        if (m_entries[i].id == id) {
+            return true;
+        }
+    }
+    return false;
+}
+
+/**
+ * @brief 距最近一次到期的tick数
+ */
+TickType_t SoftTimerWheel::ticksUntilNext() const {
+    if (m_count == 0) {
+        return portMAX_DELAY;
+    }
+
+    TickType_t now = xTaskGetTickCount();
+    if (!before(now, m_entries[0].deadline)) {
+        return 0;
+    }
+    return m_entries[0].deadline - now;
+}
+
+/**
+ * @brief 取出一个已到期的定时器
+ */
+int SoftTimerWheel::popDue() {
+    if (m_count == 0 || before(xTaskGetTickCount(), m_entries[0].deadline)) {
+        return -1;
+    }
+
+    int id = m_entries[0].id;
+    for (int i = 0; i < m_count - 1; i++) {
+        m_entries[i] = m_entries[i + 1];
+    }
+    m_count--;
+    return id;
+}
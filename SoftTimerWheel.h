@@ -0,0 +1,84 @@
+/*
+ * SoftTimerWheel.h - 软定时器表头文件
+ * ESP32S3监控项目 - 显示任务调度模块
+ *
+ * 功能特性：
+ * - 按到期时间排序的固定容量定时器表，最早到期的定时器始终在表头
+ * - 查询距最近一次到期的tick数，任务据此阻塞等待，没有定时器时无限等待
+ * - 定时器以编号区分，重复设置同一编号会替换原到期时间
+ * - tick计数回绕安全
+ *
+ * 只在单个任务中使用，不加锁
+ */
+
+#ifndef SOFT_TIMER_WHEEL_H
+#define SOFT_TIMER_WHEEL_H
+
+#include <Arduino.h>
+#include "freertos/FreeRTOS.h"
+#include "freertos/task.h"
+
+#define SOFT_TIMER_MAX 12   // 定时器表容量
+
+/**
+ * @brief 软定时器表
+ */
+class SoftTimerWheel {
+public:
+    SoftTimerWheel();
+
+    /**
+     * @brief 设置定时器在delay_ms毫秒后到期（已设置时替换）
+     */
+    void arm(uint8_t id, uint32_t delay_ms);
+
+    /**
+     * @brief 设置定时器在指定tick到期（已设置时替换）
+     */
+    void armAt(uint8_t id, TickType_t deadline);
+
+    /**
+     * @brief 取消定时器
+     */
+    void cancel(uint8_t id);
+
+    /**
+     * @brief 检查定时器是否已设置
+     */
+    bool isArmed(uint8_t id) const;
+
+    /**
+     * @brief 距最近一次到期的tick数，已到期返回0，没有定时器返回portMAX_DELAY
+     */
+    TickType_t ticksUntilNext() const;
+
+    /**
+     * @brief 取出一个已到期的定时器（按到期顺序）
+     *
+     * @return 定时器编号，没有到期的定时器时返回-1
+     */
+    int popDue();
+
+    /**
+     * @brief 当前设置的定时器数
+     */
+    uint8_t count() const { return m_count; }
+
+private:
+    struct Entry {
+        TickType_t deadline;
+        uint8_t id;
+    };
+
+    Entry m_entries[SOFT_TIMER_MAX];    ///< 按deadline升序排列
+    uint8_t m_count;
+
+    /**
+     * @brief 回绕安全的时间比较：a早于b
+     */
+    static bool before(TickType_t a, TickType_t b) {
+        return (int32_t)(a - b) < 0;
+    }
+};
+
+#endif // SOFT_TIMER_WHEEL_H
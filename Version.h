@@ -14,12 +14,12 @@
 #define VERSION_H
 
 // 项目版本号定义 - 每次更新只需修改这里
-#define VERSION_STRING "v7.5.16"
+#define VERSION_STRING "v7.5.41"
 
 // 版本号组件分解（可选，用于版本比较等高级功能）
 #define VERSION_MAJOR 7
 #define VERSION_MINOR 5
-#define VERSION_PATCH 16
+#define VERSION_PATCH 41
 
 // 版本信息字符串（包含更多详细信息）
 #define VERSION_INFO VERSION_STRING " - ESP32S3监控项目"
@@ -57,6 +57,10 @@ WeatherManager::WeatherManager() {
 
 // 析构函数
 WeatherManager::~WeatherManager() {
+    if (_psramManager) {
+        _psramManager->unregisterReclaimer(reclaimCallback, this);
+    }
+    
     stop();
     
     // 清理预报数据
@@ -101,6 +105,10 @@ bool WeatherManager::init(PSRAMManager* psramManager, WiFiManager* wifiManager,
         _config = DEFAULT_CONFIG;
     }
     
+    // 预报数据在内存紧张时可以释放，下次更新时重新获取
+    _psramManager->registerReclaimer("天气预报数据", MEM_RECLAIM_DATA, MEM_CAP_SPIRAM | MEM_CAP_INTERNAL,
+                                     reclaimCallback, this);
+    
     // 设置状态
     _state = WEATHER_STATE_READY;
     _isInitialized = true;
@@ -513,6 +521,10 @@ void WeatherManager::weatherUpdateTask(void* parameter) {
     manager->weatherUpdateLoop();
     
     printf("🌤️ 天气更新任务结束\n");
+    // 归还临时内存区槽位，重新创建任务时不会占用新的槽位
+    if (manager->_psramManager) {
+        manager->_psramManager->releaseTaskArena(xTaskGetCurrentTaskHandle());
+    }
     vTaskDelete(NULL);
 }
 
@@ -663,9 +675,10 @@ bool WeatherManager::makeHttpRequest(const String& url, String& response) {
     bool usePSRAM = (contentLength > LARGE_RESPONSE_THRESHOLD || contentLength == -1);
     
     if (usePSRAM && _psramManager && _psramManager->isPSRAMAvailable()) {
-        // 使用PSRAM分配响应缓冲区
+        // 使用当前任务的PSRAM临时内存区作为响应缓冲区，离开作用域时回收
         size_t bufferSize = (contentLength > 0) ? contentLength + 256 : 8192;  // 添加一些缓冲
-        char* responseBuffer = (char*)_psramManager->allocateDataBuffer(bufferSize, "HTTP响应缓冲区");
+        PSRAMArenaScope arena(_psramManager);
+        char* responseBuffer = (char*)arena.alloc(bufferSize);
         
         if (responseBuffer) {
             trackMemoryAllocation(bufferSize, true);
@@ -706,8 +719,6 @@ bool WeatherManager::makeHttpRequest(const String& url, String& response) {
                 response = "";
             }
             
-            // 释放PSRAM缓冲区
-            _psramManager->deallocate(responseBuffer);
             trackMemoryDeallocation(bufferSize, true);
         } else {
             printf("[WeatherManager] PSRAM分配失败，使用标准方法\n");
@@ -743,86 +754,37 @@ bool WeatherManager::parseWeatherResponse(const String& response) {
     
     printf("[WeatherManager] 开始解析天气响应，长度: %d\n", response.length());
     
-    // 使用PSRAM分配JSON解析缓冲区以减少内部RAM使用
+    // JSON文档从当前任务的临时内存区分配，函数返回时整体回收
     const size_t capacity = JSON_OBJECT_SIZE(10) + JSON_ARRAY_SIZE(5) + 1024;
-    DynamicJsonDocument* doc = nullptr;
-    void* docBuffer = nullptr;
-    bool usedPSRAMForJSON = false;
-    
-    if (_psramManager && _psramManager->isPSRAMAvailable()) {
-        // 使用PSRAM分配JSON文档
-        docBuffer = _psramManager->allocateDataBuffer(capacity, "JSON解析缓冲区");
-        if (docBuffer) {
-            doc = new(docBuffer) DynamicJsonDocument(capacity);
-            usedPSRAMForJSON = true;
-            trackMemoryAllocation(capacity, true);
-            _statistics.jsonBufferSize = capacity;
-            printf("[WeatherManager] 使用PSRAM分配JSON解析缓冲区: %u字节\n", capacity);
-        }
-    }
-    
-    // 如果PSRAM分配失败，使用内部RAM
-    if (!doc) {
-        doc = new DynamicJsonDocument(capacity);
-        usedPSRAMForJSON = false;
-        trackMemoryAllocation(capacity, false);
-        _statistics.jsonBufferSize = capacity;
-        printf("[WeatherManager] 使用内部RAM分配JSON解析缓冲区: %u字节\n", capacity);
-    }
-    
-    if (!doc) {
+    PSRAMArenaScope arena(_psramManager);
+    ArenaJsonDocument doc(capacity, arena.jsonAllocator());
+    if (doc.capacity() == 0) {
         printf("❌ [WeatherManager] JSON文档分配失败\n");
         return false;
     }
+    _statistics.jsonBufferSize = capacity;
     
-    DeserializationError error = deserializeJson(*doc, response);
+    DeserializationError error = deserializeJson(doc, response);
     if (error) {
         printf("❌ [WeatherManager] JSON解析失败: %s\n", error.c_str());
-        // 清理JSON文档
-        doc->~DynamicJsonDocument();  // 显式调用析构函数
-        if (usedPSRAMForJSON) {
-            _psramManager->deallocate(docBuffer);
-            trackMemoryDeallocation(capacity, true);
-        } else {
-            delete doc;
-            trackMemoryDeallocation(capacity, false);
-        }
         return false;
     }
     
     // 检查响应状态
-    const char* status = (*doc)["status"];
+    const char* status = doc["status"];
     if (!status || strcmp(status, "1") != 0) {
-        const char* info = (*doc)["info"];
+        const char* info = doc["info"];
         printf("❌ [WeatherManager] API响应错误: %s\n", info ? info : "未知错误");
-        // 清理JSON文档
-        doc->~DynamicJsonDocument();  // 显式调用析构函数
-        if (usedPSRAMForJSON) {
-            _psramManager->deallocate(docBuffer);
-            trackMemoryDeallocation(capacity, true);
-        } else {
-            delete doc;
-            trackMemoryDeallocation(capacity, false);
-        }
         return false;
     }
     
     // 解析天气数据
     if (!lockWeatherData()) {
         printf("❌ [WeatherManager] 获取天气数据锁失败\n");
-        // 清理JSON文档
-        doc->~DynamicJsonDocument();  // 显式调用析构函数
-        if (usedPSRAMForJSON) {
-            _psramManager->deallocate(docBuffer);
-            trackMemoryDeallocation(capacity, true);
-        } else {
-            delete doc;
-            trackMemoryDeallocation(capacity, false);
-        }
         return false;
     }
     
-    JsonArray lives = (*doc)["lives"];
+    JsonArray lives = doc["lives"];
     if (lives.size() > 0) {
         JsonObject weather = lives[0];
         
@@ -851,30 +813,11 @@ bool WeatherManager::parseWeatherResponse(const String& response) {
     } else {
         printf("❌ [WeatherManager] 响应中无天气数据\n");
         unlockWeatherData();
-        // 清理JSON文档
-        doc->~DynamicJsonDocument();  // 显式调用析构函数
-        if (usedPSRAMForJSON) {
-            _psramManager->deallocate(docBuffer);
-            trackMemoryDeallocation(capacity, true);
-        } else {
-            delete doc;
-            trackMemoryDeallocation(capacity, false);
-        }
         return false;
     }
     
     unlockWeatherData();
     
-    // 清理JSON文档
-    doc->~DynamicJsonDocument();  // 显式调用析构函数
-    if (usedPSRAMForJSON) {
-        _psramManager->deallocate(docBuffer);
-        trackMemoryDeallocation(capacity, true);
-    } else {
-        delete doc;
-        trackMemoryDeallocation(capacity, false);
-    }
-    
     printDebugInfo("天气数据解析成功");
     
     return true;
@@ -889,89 +832,40 @@ bool WeatherManager::parseForecastResponse(const String& response) {
     
     printf("[WeatherManager] 开始解析预报响应，长度: %d\n", response.length());
     
-    // 使用PSRAM分配JSON解析缓冲区以减少内部RAM使用
+    // JSON文档从当前任务的临时内存区分配，函数返回时整体回收
     const size_t capacity = JSON_OBJECT_SIZE(20) + JSON_ARRAY_SIZE(10) + 2048;
-    DynamicJsonDocument* doc = nullptr;
-    void* docBuffer = nullptr;
-    bool usedPSRAMForJSON = false;
-    
-    if (_psramManager && _psramManager->isPSRAMAvailable()) {
-        // 使用PSRAM分配JSON文档
-        docBuffer = _psramManager->allocateDataBuffer(capacity, "JSON解析缓冲区");
-        if (docBuffer) {
-            doc = new(docBuffer) DynamicJsonDocument(capacity);
-            usedPSRAMForJSON = true;
-            trackMemoryAllocation(capacity, true);
-            _statistics.jsonBufferSize = capacity;
-            printf("[WeatherManager] 使用PSRAM分配JSON解析缓冲区: %u字节\n", capacity);
-        }
-    }
-    
-    // 如果PSRAM分配失败，使用内部RAM
-    if (!doc) {
-        doc = new DynamicJsonDocument(capacity);
-        usedPSRAMForJSON = false;
-        trackMemoryAllocation(capacity, false);
-        _statistics.jsonBufferSize = capacity;
-        printf("[WeatherManager] 使用内部RAM分配JSON解析缓冲区: %u字节\n", capacity);
-    }
-    
-    if (!doc) {
+    PSRAMArenaScope arena(_psramManager);
+    ArenaJsonDocument doc(capacity, arena.jsonAllocator());
+    if (doc.capacity() == 0) {
         printf("❌ [WeatherManager] JSON文档分配失败\n");
         return false;
     }
+    _statistics.jsonBufferSize = capacity;
     
-    DeserializationError error = deserializeJson(*doc, response);
+    DeserializationError error = deserializeJson(doc, response);
     if (error) {
         printf("❌ [WeatherManager] 预报JSON解析失败: %s\n", error.c_str());
-        // 清理JSON文档
-        doc->~DynamicJsonDocument();  // 显式调用析构函数
-        if (usedPSRAMForJSON) {
-            _psramManager->deallocate(docBuffer);
-            trackMemoryDeallocation(capacity, true);
-        } else {
-            delete doc;
-            trackMemoryDeallocation(capacity, false);
-        }
         return false;
     }
     
     // 检查响应状态
-    const char* status = (*doc)["status"];
+    const char* status = doc["status"];
     if (!status || strcmp(status, "1") != 0) {
-        const char* info = (*doc)["info"];
+        const char* info = doc["info"];
         printf("❌ [WeatherManager] 预报API响应错误: %s\n", info ? info : "未知错误");
-        // 清理JSON文档
-        doc->~DynamicJsonDocument();  // 显式调用析构函数
-        if (usedPSRAMForJSON) {
-            _psramManager->deallocate(docBuffer);
-            trackMemoryDeallocation(capacity, true);
-        } else {
-            delete doc;
-            trackMemoryDeallocation(capacity, false);
-        }
         return false;
     }
     
     // 解析预报数据
     if (!lockWeatherData()) {
         printf("❌ [WeatherManager] 获取预报数据锁失败\n");
-        // 清理JSON文档
-        doc->~DynamicJsonDocument();  // 显式调用析构函数
-        if (usedPSRAMForJSON) {
-            _psramManager->deallocate(docBuffer);
-            trackMemoryDeallocation(capacity, true);
-        } else {
-            delete doc;
-            trackMemoryDeallocation(capacity, false);
-        }
         return false;
     }
     
     // 清理旧数据
     cleanupForecastData();
     
-    JsonArray forecasts = (*doc)["forecasts"];
+    JsonArray forecasts = doc["forecasts"];
     if (forecasts.size() > 0) {
         JsonObject forecast = forecasts[0];
         JsonArray casts = forecast["casts"];
@@ -1056,16 +950,6 @@ bool WeatherManager::parseForecastResponse(const String& response) {
     
     unlockWeatherData();
     
-    // 清理JSON文档
-    doc->~DynamicJsonDocument();  // 显式调用析构函数
-    if (usedPSRAMForJSON) {
-        _psramManager->deallocate(docBuffer);
-        trackMemoryDeallocation(capacity, true);
-    } else {
-        delete doc;
-        trackMemoryDeallocation(capacity, false);
-    }
-    
     printf("✅ [WeatherManager] 预报数据解析成功，条数: %d\n", _forecastCount);
     printDebugInfo("预报数据解析成功，条数: " + String(_forecastCount));
     
@@ -1404,11 +1288,31 @@ void WeatherManager::freeMemory(void* ptr) {
     }
 }
 
+// 内存回收回调：释放预报数据
+size_t WeatherManager::reclaimCallback(size_t bytes, MemPressure pressure, void* userdata) {
+    WeatherManager* manager = static_cast<WeatherManager*>(userdata);
+    
+    if (!manager->lockWeatherData(0)) {
+        return 0;
+    }
+    
+    size_t freed = manager->_statistics.forecastDataSize;
+    manager->cleanupForecastData();
+    
+    manager->unlockWeatherData();
+    return freed;
+}
+
 // 清理预报数据
 void WeatherManager::cleanupForecastData() {
     if (_forecastData) {
         size_t dataSize = _statistics.forecastDataSize;
         
+        // 预报项中的String在内部RAM另有缓冲区，释放数组前先析构
+        for (int i = 0; i < _forecastCount; i++) {
+            _forecastData[i].~WeatherForecast();
+        }
+        
         // 检查数据的完整性
         if (dataSize > 0) {
             // 注意：无法确定内存是在PSRAM还是内部RAM中分配的
@@ -1462,6 +1366,10 @@ bool WeatherManager::createWeatherTask() {
 void WeatherManager::deleteWeatherTask() {
     if (_weatherTaskHandle) {
         vTaskDelete(_weatherTaskHandle);
+        // 任务已被删除，作用域不会再析构，强制归还临时内存区
+        if (_psramManager) {
+            _psramManager->releaseTaskArena(_weatherTaskHandle, true);
+        }
         _weatherTaskHandle = nullptr;
         printDebugInfo("天气任务已删除");
     }
@@ -202,6 +202,7 @@ private:
     void* allocateMemory(size_t size);
     void freeMemory(void* ptr);
     void cleanupForecastData();
+    static size_t reclaimCallback(size_t bytes, MemPressure pressure, void* userdata);
     void updateMemoryStatistics(size_t allocated, bool isPSRAM);  // 新增：更新内存统计
     void trackMemoryAllocation(size_t size, bool isPSRAM);        // 新增：跟踪内存分配
     void trackMemoryDeallocation(size_t size, bool isPSRAM);      // 新增：跟踪内存释放
@@ -7,8 +7,10 @@
 #include "Version.h"
 #include "PSRAMManager.h"
 #include "DisplayManager.h"
+#include "AssetManager.h"
 #include "WeatherManager.h"
 #include "LocationManager.h"
+#include "touch_bsp.h"
 #include "Arduino.h"
 #include <HTTPClient.h>
 #include <WiFiClient.h>
@@ -123,9 +125,39 @@ void WebServerManager::init() {
     server->on("/api/screen/settings", HTTP_POST, [this]() { handleSetScreenSettings(); });
     server->on("/api/screen/rotation", HTTP_GET, [this]() { handleGetCurrentRotation(); });
     
+    // 显示缓冲区路由
+    server->on("/api/display/buffer", HTTP_GET, [this]() { handleGetDisplayBuffer(); });
+    server->on("/api/display/buffer", HTTP_POST, [this]() { handleSetDisplayBuffer(); });
+    server->on("/api/display/benchmark", HTTP_POST, [this]() { handleDisplayBenchmark(); });
+    server->on("/api/display/perf", HTTP_GET, [this]() { handleGetDisplayPerf(); });
+    server->on("/api/display/perf/reset", HTTP_POST, [this]() { handleResetDisplayPerf(); });
+    server->on("/api/display/perf/overlay", HTTP_POST, [this]() { handleSetDisplayPerfOverlay(); });
+    server->on("/api/display/merge", HTTP_POST, [this]() { handleSetDisplayAreaMerge(); });
+    server->on("/api/display/power", HTTP_GET, [this]() { handleGetDisplayPower(); });
+    server->on("/api/display/power", HTTP_POST, [this]() { handleSetDisplayPower(); });
+    server->on("/api/display/screens", HTTP_GET, [this]() { handleGetDisplayScreens(); });
+    server->on("/api/display/screens", HTTP_POST, [this]() { handleSetDisplayScreens(); });
+    server->on("/api/display/trend", HTTP_GET, [this]() { handleGetPowerTrend(); });
+    server->on("/api/display/trend", HTTP_POST, [this]() { handleSetPowerTrend(); });
+    server->on("/api/display/mirror", HTTP_GET, [this]() { handleGetScreenMirror(); });
+    server->on("/api/display/mirror", HTTP_POST, [this]() { handleSetScreenMirror(); });
+    server->on("/mirror", [this]() { handleMirrorPage(); });
+    
+    // UI资源包路由
+    server->on("/api/assets", HTTP_GET, [this]() { handleGetAssets(); });
+    server->on("/api/assets/pack", HTTP_POST, [this]() { handleSetAssetPack(); });
+    server->on("/api/assets/cache", HTTP_POST, [this]() { handleSetAssetCache(); });
+    
     // 主题设置路由
     server->on("/api/theme/settings", HTTP_GET, [this]() { handleGetThemeSettings(); });
     server->on("/api/theme/settings", HTTP_POST, [this]() { handleSetThemeSettings(); });
+    server->on("/api/theme/soak", HTTP_GET, [this]() { handleGetThemeSoak(); });
+    server->on("/api/theme/soak", HTTP_POST, [this]() { handleStartThemeSoak(); });
+    
+    // 内存剖析路由
+    server->on("/api/memory/profile", HTTP_GET, [this]() { handleGetMemoryProfile(); });
+    server->on("/api/memory/profile", HTTP_POST, [this]() { handleSetMemoryProfile(); });
+    server->on("/api/memory/profile.bin", HTTP_GET, [this]() { handleGetMemoryProfileDump(); });
     
     // 服务器设置路由
     server->on("/server-settings", [this]() { handleServerSettingsPage(); });
@@ -208,6 +240,12 @@ void WebServerManager::stop() {
 
 void WebServerManager::handleClient() {
     if (server && isRunning) {
+#if MEM_GOVERNOR_ENABLED
+        // 处理请求前先按水位回收缓存，避免请求处理中途分配失败
+        if (m_psramManager) {
+            m_psramManager->relieveMemoryPressure();
+        }
+#endif
         server->handleClient();
     }
 }
@@ -244,7 +282,8 @@ void WebServerManager::handleOTAPage() {
 void WebServerManager::handleWiFiScan() {
     printf("处理WiFi扫描请求\n");
     
-    DynamicJsonDocument doc(2048);
+    PSRAMArenaScope arena(m_psramManager);
+    ArenaJsonDocument doc(2048, arena.jsonAllocator());
     JsonArray networks = doc.createNestedArray("networks");
     
     int n = WiFi.scanNetworks();
@@ -257,15 +296,14 @@ void WebServerManager::handleWiFiScan() {
         network["secure"] = (WiFi.encryptionType(i) != WIFI_AUTH_OPEN);
     }
     
-    String response;
-    serializeJson(doc, response);
-    server->send(200, "application/json", response);
+    sendJson(200, doc);
 }
 
 void WebServerManager::handleSystemInfo() {
     printf("处理系统信息请求\n");
     
-    DynamicJsonDocument doc(1024);
+    PSRAMArenaScope arena(m_psramManager);
+    ArenaJsonDocument doc(1024, arena.jsonAllocator());
     doc["device"] = "ESP32S3 Monitor";
             doc["version"] = VERSION_STRING;
     doc["chipModel"] = ESP.getChipModel();
@@ -307,9 +345,7 @@ void WebServerManager::handleSystemInfo() {
         doc["wifi"]["ip"] = wifiManager->getAPIP();
     }
     
-    String response;
-    serializeJson(doc, response);
-    server->send(200, "application/json", response);
+    sendJson(200, doc);
 }
 
 void WebServerManager::handleRestart() {
@@ -323,7 +359,8 @@ void WebServerManager::handleRestart() {
 void WebServerManager::handleResetConfig() {
     printf("处理配置重置请求\n");
     
-    DynamicJsonDocument doc(256);
+    PSRAMArenaScope arena(m_psramManager);
+    ArenaJsonDocument doc(256, arena.jsonAllocator());
     
     // 异步执行配置重置
     bool success = configStorage->resetAllConfigAsync(5000);
@@ -333,9 +370,7 @@ void WebServerManager::handleResetConfig() {
     if (success) {
         doc["message"] = "配置已重置为默认值，设备将在3秒后重启";
         
-        String response;
-        serializeJson(doc, response);
-        server->send(200, "application/json", response);
+        sendJson(200, doc);
         
         // 延时3秒后重启设备
         vTaskDelay(pdMS_TO_TICKS(3000));
@@ -343,10 +378,24 @@ void WebServerManager::handleResetConfig() {
     } else {
         doc["message"] = "配置重置失败";
         
+        sendJson(500, doc);
+    }
+}
+
+void WebServerManager::sendJson(int code, const JsonDocument& doc) {
+    PSRAMArenaScope arena(m_psramManager);
+    size_t length = measureJson(doc);
+    char* buffer = (char*)arena.alloc(length + 1);
+    if (!buffer) {
+        // 临时内存区不可用时按原方式构造String
         String response;
         serializeJson(doc, response);
-        server->send(500, "application/json", response);
+        server->send(code, "application/json", response);
+        return;
     }
+    
+    serializeJson(doc, buffer, length + 1);
+    server->send_P(code, "application/json", buffer, length);
 }
 
 void WebServerManager::handleNotFound() {
@@ -357,14 +406,13 @@ void WebServerManager::handleNotFound() {
 void WebServerManager::handleAPI() {
     printf("处理API请求\n");
     
-    DynamicJsonDocument doc(512);
+    PSRAMArenaScope arena(m_psramManager);
+    ArenaJsonDocument doc(512, arena.jsonAllocator());
     doc["status"] = "ok";
     doc["message"] = "ESP32S3 Monitor API";
     doc["endpoints"] = "/scan, /info, /save, /status, /restart, /reset";
     
-    String response;
-    serializeJson(doc, response);
-    server->send(200, "application/json", response);
+    sendJson(200, doc);
 }
 
 void WebServerManager::handleSaveWiFi() {
@@ -383,7 +431,8 @@ void WebServerManager::handleSaveWiFi() {
     // 尝试连接WiFi
     bool connected = wifiManager->connectToWiFi(ssid, password);
     
-    DynamicJsonDocument doc(256);
+    PSRAMArenaScope arena(m_psramManager);
+    ArenaJsonDocument doc(256, arena.jsonAllocator());
     doc["success"] = connected;
     
     if (connected) {
@@ -403,15 +452,14 @@ void WebServerManager::handleSaveWiFi() {
         doc["message"] = "WiFi连接失败";
     }
     
-    String response;
-    serializeJson(doc, response);
-    server->send(200, "application/json", response);
+    sendJson(200, doc);
 }
 
 void WebServerManager::handleGetStatus() {
     printf("处理状态请求\n");
     
-    DynamicJsonDocument doc(512);
+    PSRAMArenaScope arena(m_psramManager);
+    ArenaJsonDocument doc(512, arena.jsonAllocator());
     
     if (wifiManager->isConnected()) {
         doc["wifi"]["connected"] = true;
@@ -427,9 +475,7 @@ void WebServerManager::handleGetStatus() {
     doc["system"]["freeHeap"] = ESP.getFreeHeap();
     doc["system"]["uptime"] = millis();
     
-    String response;
-    serializeJson(doc, response);
-    server->send(200, "application/json", response);
+    sendJson(200, doc);
 }
 
 void WebServerManager::handleGetWiFiConfigs() {
@@ -440,7 +486,8 @@ void WebServerManager::handleGetWiFiConfigs() {
     server->sendHeader("Pragma", "no-cache");
     server->sendHeader("Expires", "0");
     
-    DynamicJsonDocument doc(1024);
+    PSRAMArenaScope arena(m_psramManager);
+    ArenaJsonDocument doc(1024, arena.jsonAllocator());
     JsonArray configs = doc.createNestedArray("configs");
     
     WiFiConfig wifiConfigs[3];
@@ -467,9 +514,7 @@ void WebServerManager::handleGetWiFiConfigs() {
     
     printf("配置数量: %d，最大配置数: %d\n", configCount, ConfigStorage::MAX_WIFI_CONFIGS);
     
-    String response;
-    serializeJson(doc, response);
-    server->send(200, "application/json", response);
+    sendJson(200, doc);
 }
 
 void WebServerManager::handleDeleteWiFiConfig() {
@@ -490,7 +535,8 @@ void WebServerManager::handleDeleteWiFiConfig() {
         return;
     }
     
-    DynamicJsonDocument doc(256);
+    PSRAMArenaScope arena(m_psramManager);
+    ArenaJsonDocument doc(256, arena.jsonAllocator());
     
     // 异步加载现有配置
     WiFiConfig configs[3];
@@ -563,7 +609,8 @@ void WebServerManager::handleConnectWiFiConfig() {
         return;
     }
     
-    DynamicJsonDocument doc(256);
+    PSRAMArenaScope arena(m_psramManager);
+    ArenaJsonDocument doc(256, arena.jsonAllocator());
     
     // 异步加载WiFi配置
     WiFiConfig configs[3];
@@ -591,9 +638,7 @@ void WebServerManager::handleConnectWiFiConfig() {
         doc["message"] = "加载WiFi配置失败";
     }
     
-    String response;
-    serializeJson(doc, response);
-    server->send(200, "application/json", response);
+    sendJson(200, doc);
 }
 
 void WebServerManager::handleOTAUpload() {
@@ -646,15 +691,14 @@ void WebServerManager::handleOTAStatus() {
 void WebServerManager::handleOTAReboot() {
     printf("处理OTA重启请求\n");
     
-    DynamicJsonDocument doc(256);
+    PSRAMArenaScope arena(m_psramManager);
+    ArenaJsonDocument doc(256, arena.jsonAllocator());
     
     if (otaManager->getStatus() == OTAStatus::SUCCESS) {
         doc["success"] = true;
         doc["message"] = "设备将在3秒后重启以应用新固件";
         
-        String response;
-        serializeJson(doc, response);
-        server->send(200, "application/json", response);
+        sendJson(200, doc);
         
         // 延时后重启设备
         otaManager->rebootDevice();
@@ -662,9 +706,7 @@ void WebServerManager::handleOTAReboot() {
         doc["success"] = false;
         doc["message"] = "OTA升级未成功，无法重启";
         
-        String response;
-        serializeJson(doc, response);
-        server->send(400, "application/json", response);
+        sendJson(400, doc);
     }
 }
 
@@ -834,7 +876,8 @@ void WebServerManager::handleFileDelete() {
         return;
     }
     
-    DynamicJsonDocument doc(256);
+    PSRAMArenaScope arena(m_psramManager);
+    ArenaJsonDocument doc(256, arena.jsonAllocator());
     bool success = fileManager->deleteFile(filePath);
     
     doc["success"] = success;
@@ -846,9 +889,7 @@ void WebServerManager::handleFileDelete() {
         printf("文件删除失败: %s\n", filePath.c_str());
     }
     
-    String response;
-    serializeJson(doc, response);
-    server->send(200, "application/json", response);
+    sendJson(200, doc);
 }
 
 void WebServerManager::handleFileRename() {
@@ -867,7 +908,8 @@ void WebServerManager::handleFileRename() {
         return;
     }
     
-    DynamicJsonDocument doc(256);
+    PSRAMArenaScope arena(m_psramManager);
+    ArenaJsonDocument doc(256, arena.jsonAllocator());
     bool success = fileManager->renameFile(oldPath, newPath);
     
     doc["success"] = success;
@@ -879,9 +921,7 @@ void WebServerManager::handleFileRename() {
         printf("文件重命名失败: %s -> %s\n", oldPath.c_str(), newPath.c_str());
     }
     
-    String response;
-    serializeJson(doc, response);
-    server->send(200, "application/json", response);
+    sendJson(200, doc);
 }
 
 void WebServerManager::handleFileCreate() {
@@ -904,7 +944,8 @@ void WebServerManager::handleFileCreate() {
         return;
     }
     
-    DynamicJsonDocument doc(256);
+    PSRAMArenaScope arena(m_psramManager);
+    ArenaJsonDocument doc(256, arena.jsonAllocator());
     bool success = fileManager->writeFileFromString(filePath, content);
     
     doc["success"] = success;
@@ -916,9 +957,7 @@ void WebServerManager::handleFileCreate() {
         printf("文件创建失败: %s\n", filePath.c_str());
     }
     
-    String response;
-    serializeJson(doc, response);
-    server->send(200, "application/json", response);
+    sendJson(200, doc);
 }
 
 void WebServerManager::handleFileSystemStatus() {
@@ -942,7 +981,8 @@ void WebServerManager::handleFileSystemFormat() {
         return;
     }
     
-    DynamicJsonDocument doc(256);
+    PSRAMArenaScope arena(m_psramManager);
+    ArenaJsonDocument doc(256, arena.jsonAllocator());
     
     // 启动异步格式化任务
     bool started = fileManager->startFormatFileSystem();
@@ -956,15 +996,14 @@ void WebServerManager::handleFileSystemFormat() {
         doc["formatting"] = false;
     }
     
-    String response;
-    serializeJson(doc, response);
-    server->send(200, "application/json", response);
+    sendJson(200, doc);
 }
 
 void WebServerManager::handleFileSystemFormatStatus() {
     printf("处理格式化状态查询请求\n");
     
-    DynamicJsonDocument doc(256);
+    PSRAMArenaScope arena(m_psramManager);
+    ArenaJsonDocument doc(256, arena.jsonAllocator());
     
     doc["formatting"] = fileManager->isFormatting();
     
@@ -977,9 +1016,7 @@ void WebServerManager::handleFileSystemFormatStatus() {
         doc["success"] = fileManager->getFormatResult();
     }
     
-        String response;
-    serializeJson(doc, response);
-    server->send(200, "application/json", response);
+        sendJson(200, doc);
 }
 
 // 天气设置相关API实现
@@ -991,7 +1028,8 @@ void WebServerManager::handleWeatherSettings() {
 void WebServerManager::handleGetWeatherConfig() {
     printf("处理获取天气配置请求\n");
     
-    DynamicJsonDocument doc(512);
+    PSRAMArenaScope arena(m_psramManager);
+    ArenaJsonDocument doc(512, arena.jsonAllocator());
     
     if (m_weatherManager) {
         WeatherConfig config = m_weatherManager->getConfig();
@@ -1017,15 +1055,14 @@ void WebServerManager::handleGetWeatherConfig() {
         doc["message"] = "天气管理器未初始化";
     }
     
-    String response;
-    serializeJson(doc, response);
-    server->send(200, "application/json", response);
+    sendJson(200, doc);
 }
 
 void WebServerManager::handleSetWeatherApiKey() {
     printf("处理设置天气API密钥请求\n");
     
-    DynamicJsonDocument doc(512);
+    PSRAMArenaScope arena(m_psramManager);
+    ArenaJsonDocument doc(512, arena.jsonAllocator());
     
     if (!server->hasArg("apiKey")) {
         doc["success"] = false;
@@ -1071,15 +1108,14 @@ void WebServerManager::handleSetWeatherApiKey() {
         doc["details"]["locationManager"] = locationSuccess;
     }
     
-    String response;
-    serializeJson(doc, response);
-    server->send(200, "application/json", response);
+    sendJson(200, doc);
 }
 
 void WebServerManager::handleSetWeatherCity() {
     printf("处理设置城市请求\n");
     
-    DynamicJsonDocument doc(256);
+    PSRAMArenaScope arena(m_psramManager);
+    ArenaJsonDocument doc(256, arena.jsonAllocator());
     
     if (!m_weatherManager) {
         doc["success"] = false;
@@ -1108,15 +1144,14 @@ void WebServerManager::handleSetWeatherCity() {
         }
     }
     
-    String response;
-    serializeJson(doc, response);
-    server->send(200, "application/json", response);
+    sendJson(200, doc);
 }
 
 void WebServerManager::handleSetWeatherUpdateConfig() {
     printf("处理设置天气更新配置请求\n");
     
-    DynamicJsonDocument doc(256);
+    PSRAMArenaScope arena(m_psramManager);
+    ArenaJsonDocument doc(256, arena.jsonAllocator());
     
     if (!m_weatherManager) {
         doc["success"] = false;
@@ -1144,15 +1179,14 @@ void WebServerManager::handleSetWeatherUpdateConfig() {
         doc["message"] = success ? "更新配置设置成功" : "更新配置设置失败";
     }
     
-    String response;
-    serializeJson(doc, response);
-    server->send(200, "application/json", response);
+    sendJson(200, doc);
 }
 
 void WebServerManager::handleGetCurrentWeather() {
     printf("处理获取当前天气请求\n");
     
-    DynamicJsonDocument doc(1024);
+    PSRAMArenaScope arena(m_psramManager);
+    ArenaJsonDocument doc(1024, arena.jsonAllocator());
     
     if (!m_weatherManager) {
         doc["success"] = false;
@@ -1176,15 +1210,14 @@ void WebServerManager::handleGetCurrentWeather() {
         doc["message"] = weather.isValid ? "天气数据获取成功" : "暂无有效天气数据";
     }
     
-    String response;
-    serializeJson(doc, response);
-    server->send(200, "application/json", response);
+    sendJson(200, doc);
 }
 
 void WebServerManager::handleGetWeatherStats() {
     printf("处理获取天气统计请求\n");
     
-    DynamicJsonDocument doc(512);
+    PSRAMArenaScope arena(m_psramManager);
+    ArenaJsonDocument doc(512, arena.jsonAllocator());
     
     if (!m_weatherManager) {
         doc["success"] = false;
@@ -1200,15 +1233,14 @@ void WebServerManager::handleGetWeatherStats() {
         doc["message"] = "统计信息获取成功";
     }
     
-    String response;
-    serializeJson(doc, response);
-    server->send(200, "application/json", response);
+    sendJson(200, doc);
 }
 
 void WebServerManager::handleTestWeatherApi() {
     printf("处理测试天气API请求\n");
     
-    DynamicJsonDocument doc(256);
+    PSRAMArenaScope arena(m_psramManager);
+    ArenaJsonDocument doc(256, arena.jsonAllocator());
     
     if (!m_weatherManager) {
         doc["success"] = false;
@@ -1223,15 +1255,14 @@ void WebServerManager::handleTestWeatherApi() {
         }
     }
     
-    String response;
-    serializeJson(doc, response);
-    server->send(200, "application/json", response);
+    sendJson(200, doc);
 }
 
 void WebServerManager::handleUpdateWeatherNow() {
     printf("处理立即更新天气请求\n");
     
-    DynamicJsonDocument doc(256);
+    PSRAMArenaScope arena(m_psramManager);
+    ArenaJsonDocument doc(256, arena.jsonAllocator());
     
     if (!m_weatherManager) {
         doc["success"] = false;
@@ -1247,9 +1278,7 @@ void WebServerManager::handleUpdateWeatherNow() {
         }
     }
     
-    String response;
-    serializeJson(doc, response);
-    server->send(200, "application/json", response);
+    sendJson(200, doc);
 }
  
 String WebServerManager::getFileManagerHTML() {
@@ -1900,7 +1929,8 @@ void WebServerManager::handleUpdateWiFiPriority() {
         return;
     }
     
-    DynamicJsonDocument doc(256);
+    PSRAMArenaScope arena(m_psramManager);
+    ArenaJsonDocument doc(256, arena.jsonAllocator());
     
     bool success = configStorage->updateWiFiPriorityAsync(index, priority, 3000);
     
@@ -1913,9 +1943,7 @@ void WebServerManager::handleUpdateWiFiPriority() {
         printf("WiFi优先级更新失败\n");
     }
     
-    String response;
-    serializeJson(doc, response);
-    server->send(200, "application/json", response);
+    sendJson(200, doc);
 }
 
 void WebServerManager::handleSetWiFiPriorities() {
@@ -1931,7 +1959,8 @@ void WebServerManager::handleSetWiFiPriorities() {
     printf("接收到优先级数据: %s\n", prioritiesStr.c_str());
     
     // 解析JSON格式的优先级数组
-    DynamicJsonDocument requestDoc(512);
+    PSRAMArenaScope arena(m_psramManager);
+    ArenaJsonDocument requestDoc(512, arena.jsonAllocator());
     DeserializationError error = deserializeJson(requestDoc, prioritiesStr);
     
     if (error) {
@@ -1964,7 +1993,7 @@ void WebServerManager::handleSetWiFiPriorities() {
         printf("设置配置 %d 优先级为 %d\n", i, priorities[i]);
     }
     
-    DynamicJsonDocument doc(256);
+    ArenaJsonDocument doc(256, arena.jsonAllocator());
     
     bool success = configStorage->setWiFiPrioritiesAsync(priorities, 3000);
     
@@ -1977,15 +2006,14 @@ void WebServerManager::handleSetWiFiPriorities() {
         printf("WiFi优先级批量设置失败\n");
     }
     
-    String response;
-    serializeJson(doc, response);
-    server->send(200, "application/json", response);
+    sendJson(200, doc);
 }
 
 void WebServerManager::handleScreenConfig() {
     printf("处理屏幕配置获取请求\n");
     
-    DynamicJsonDocument doc(512);
+    PSRAMArenaScope arena(m_psramManager);
+    ArenaJsonDocument doc(512, arena.jsonAllocator());
     
     if (m_displayManager) {
         // 获取当前亮度（DisplayManager使用0-100范围，转换为0-255）
@@ -2024,9 +2052,7 @@ void WebServerManager::handleScreenConfig() {
         printf("显示管理器未初始化\n");
     }
     
-    String response;
-    serializeJson(doc, response);
-    server->send(200, "application/json", response);
+    sendJson(200, doc);
 }
 
 void WebServerManager::handleSetBrightness() {
@@ -2047,7 +2073,8 @@ void WebServerManager::handleSetBrightness() {
         return;
     }
     
-    DynamicJsonDocument doc(256);
+    PSRAMArenaScope arena(m_psramManager);
+    ArenaJsonDocument doc(256, arena.jsonAllocator());
     
     if (m_displayManager) {
         // 将0-255范围转换为0-100范围
@@ -2070,15 +2097,14 @@ void WebServerManager::handleSetBrightness() {
         printf("❌ 显示管理器未初始化，无法设置亮度\n");
     }
     
-    String response;
-    serializeJson(doc, response);
-    server->send(200, "application/json", response);
+    sendJson(200, doc);
 }
 
 void WebServerManager::handleScreenTest() {
     printf("处理屏幕测试请求\n");
     
-    DynamicJsonDocument doc(256);
+    PSRAMArenaScope arena(m_psramManager);
+    ArenaJsonDocument doc(256, arena.jsonAllocator());
     
     if (m_displayManager) {
         // 执行屏幕测试：循环显示不同亮度
@@ -2097,9 +2123,7 @@ void WebServerManager::handleScreenTest() {
         printf("显示管理器未初始化，无法执行屏幕测试\n");
     }
     
-    String response;
-    serializeJson(doc, response);
-    server->send(200, "application/json", response);
+    sendJson(200, doc);
 }
 
 void WebServerManager::handleScreenSettings() {
@@ -2110,7 +2134,8 @@ void WebServerManager::handleScreenSettings() {
 void WebServerManager::handleGetScreenSettings() {
     printf("处理获取屏幕设置配置请求\n");
     
-    DynamicJsonDocument doc(512);
+    PSRAMArenaScope arena(m_psramManager);
+    ArenaJsonDocument doc(512, arena.jsonAllocator());
     
     if (configStorage) {
         ScreenMode mode;
@@ -2162,23 +2187,20 @@ void WebServerManager::handleGetScreenSettings() {
         printf("配置存储未初始化\n");
     }
     
-    String response;
-    serializeJson(doc, response);
-    server->send(200, "application/json", response);
+    sendJson(200, doc);
 }
 
 void WebServerManager::handleSetScreenSettings() {
     printf("处理设置屏幕设置配置请求\n");
     
-    DynamicJsonDocument doc(256);
+    PSRAMArenaScope arena(m_psramManager);
+    ArenaJsonDocument doc(256, arena.jsonAllocator());
     
     if (!configStorage) {
         doc["success"] = false;
         doc["message"] = "配置存储未初始化";
         printf("配置存储未初始化\n");
-        String response;
-        serializeJson(doc, response);
-        server->send(400, "application/json", response);
+        sendJson(400, doc);
         return;
     }
     
@@ -2187,9 +2209,7 @@ void WebServerManager::handleSetScreenSettings() {
         doc["success"] = false;
         doc["message"] = "缺少mode参数";
         printf("缺少mode参数\n");
-        String response;
-        serializeJson(doc, response);
-        server->send(400, "application/json", response);
+        sendJson(400, doc);
         return;
     }
     
@@ -2210,9 +2230,7 @@ void WebServerManager::handleSetScreenSettings() {
         doc["success"] = false;
         doc["message"] = "无效的屏幕模式";
         printf("无效的屏幕模式: %d\n", mode);
-        String response;
-        serializeJson(doc, response);
-        server->send(400, "application/json", response);
+        sendJson(400, doc);
         return;
     }
     
@@ -2221,9 +2239,7 @@ void WebServerManager::handleSetScreenSettings() {
         doc["success"] = false;
         doc["message"] = "无效的时间设置";
         printf("无效的时间设置\n");
-        String response;
-        serializeJson(doc, response);
-        server->send(400, "application/json", response);
+        sendJson(400, doc);
         return;
     }
     
@@ -2231,9 +2247,7 @@ void WebServerManager::handleSetScreenSettings() {
         doc["success"] = false;
         doc["message"] = "延时时间必须在1-1440分钟之间";
         printf("无效的延时时间: %d\n", timeoutMinutes);
-        String response;
-        serializeJson(doc, response);
-        server->send(400, "application/json", response);
+        sendJson(400, doc);
         return;
     }
     
@@ -2241,9 +2255,7 @@ void WebServerManager::handleSetScreenSettings() {
         doc["success"] = false;
         doc["message"] = "静态旋转角度必须在0-3之间";
         printf("无效的静态旋转角度: %d\n", staticRotation);
-        String response;
-        serializeJson(doc, response);
-        server->send(400, "application/json", response);
+        sendJson(400, doc);
         return;
     }
     
@@ -2268,23 +2280,20 @@ void WebServerManager::handleSetScreenSettings() {
         printf("屏幕设置配置保存失败\n");
     }
     
-    String response;
-    serializeJson(doc, response);
-    server->send(200, "application/json", response);
+    sendJson(200, doc);
 }
 
 void WebServerManager::handleGetCurrentRotation() {
     printf("处理获取当前屏幕旋转角度请求\n");
     
-    DynamicJsonDocument doc(256);
+    PSRAMArenaScope arena(m_psramManager);
+    ArenaJsonDocument doc(256, arena.jsonAllocator());
     
     if (!m_displayManager || !m_displayManager->getLVGLDriver()) {
         doc["success"] = false;
         doc["message"] = "显示管理器未初始化";
         printf("显示管理器未初始化\n");
-        String response;
-        serializeJson(doc, response);
-        server->send(400, "application/json", response);
+        sendJson(400, doc);
         return;
     }
     
@@ -2298,195 +2307,996 @@ void WebServerManager::handleGetCurrentRotation() {
     
     printf("当前屏幕旋转角度: %d (%d度)\n", currentRotation, currentRotation * 90);
     
-    String response;
-    serializeJson(doc, response);
-    server->send(200, "application/json", response);
+    sendJson(200, doc);
 }
 
-void WebServerManager::handleGetThemeSettings() {
-    printf("处理获取主题设置请求\n");
+void WebServerManager::handleGetDisplayBuffer() {
+    printf("处理获取显示缓冲区策略请求\n");
     
-    DynamicJsonDocument doc(256);
+    PSRAMArenaScope arena(m_psramManager);
+    ArenaJsonDocument doc(512, arena.jsonAllocator());
     
-    if (!configStorage) {
+    if (!m_displayManager || !m_displayManager->getLVGLDriver()) {
         doc["success"] = false;
-        doc["message"] = "配置存储未初始化";
-        printf("配置存储未初始化\n");
-        String response;
-        serializeJson(doc, response);
-        server->send(400, "application/json", response);
+        doc["message"] = "显示管理器未初始化";
+        printf("显示管理器未初始化\n");
+        sendJson(400, doc);
         return;
     }
     
-    // 获取当前主题设置
-    if (configStorage->hasThemeConfigAsync(3000)) {
-        int theme = configStorage->loadThemeConfigAsync(3000);
-        doc["success"] = true;
-        doc["theme"] = theme;
-        doc["message"] = "主题配置获取成功";
-        printf("主题配置获取成功: %d\n", theme);
-    } else {
-        doc["success"] = true;
-        doc["theme"] = 0; // 默认UI1主题
-        doc["message"] = "使用默认主题配置";
-        printf("使用默认主题配置\n");
-    }
+    LVGLDriver* driver = m_displayManager->getLVGLDriver();
+    lvgl_buffer_strategy_t strategy = driver->getBufferStrategy();
     
-    String response;
-    serializeJson(doc, response);
-    server->send(200, "application/json", response);
+    doc["success"] = true;
+    doc["strategy"] = (int)strategy;
+    doc["strategyName"] = LVGLDriver::getBufferStrategyName(strategy);
+    doc["lines"] = driver->getBufferLines();
+    doc["internalBytes"] = driver->getBufferInternalBytes();
+    doc["psramBytes"] = driver->getBufferPSRAMBytes();
+    doc["internalFree"] = heap_caps_get_free_size(MALLOC_CAP_INTERNAL);
+    
+    sendJson(200, doc);
 }
 
-void WebServerManager::handleSetThemeSettings() {
-    printf("处理设置主题配置请求\n");
+void WebServerManager::handleSetDisplayBuffer() {
+    printf("处理设置显示缓冲区策略请求\n");
     
-    DynamicJsonDocument doc(256);
+    PSRAMArenaScope arena(m_psramManager);
+    ArenaJsonDocument doc(256, arena.jsonAllocator());
     
-    if (!configStorage) {
+    if (!m_displayManager || !m_displayManager->getLVGLDriver()) {
         doc["success"] = false;
-        doc["message"] = "配置存储未初始化";
-        printf("配置存储未初始化\n");
-        String response;
-        serializeJson(doc, response);
-        server->send(400, "application/json", response);
+        doc["message"] = "显示管理器未初始化";
+        printf("显示管理器未初始化\n");
+        sendJson(400, doc);
         return;
     }
     
-    // 检查必要参数
-    if (!server->hasArg("theme")) {
+    if (!server->hasArg("strategy")) {
         doc["success"] = false;
-        doc["message"] = "缺少theme参数";
-        printf("缺少theme参数\n");
-        String response;
-        serializeJson(doc, response);
-        server->send(400, "application/json", response);
+        doc["message"] = "缺少strategy参数";
+        printf("缺少strategy参数\n");
+        sendJson(400, doc);
         return;
     }
     
-    int theme = server->arg("theme").toInt();
-    
-    printf("接收到主题切换请求：主题=%d\n", theme);
+    int strategy = server->arg("strategy").toInt();
+    int lines = server->hasArg("lines") ? server->arg("lines").toInt() : 0;
     
-    // 参数验证
-    if (theme < 0 || theme > 2) {
+    if (strategy < 0 || strategy >= LVGL_BUF_STRATEGY_COUNT || lines < 0 || lines > 448) {
         doc["success"] = false;
-        doc["message"] = "无效的主题值";
-        printf("无效的主题值: %d\n", theme);
-        String response;
-        serializeJson(doc, response);
-        server->send(400, "application/json", response);
+        doc["message"] = "无效的缓冲区策略或行数";
+        printf("无效的缓冲区策略或行数: %d, %d\n", strategy, lines);
+        sendJson(400, doc);
         return;
     }
     
-    // 检查是否是当前主题
-    if (configStorage->hasThemeConfigAsync(3000)) {
-        int currentTheme = configStorage->loadThemeConfigAsync(3000);
-        if (currentTheme == theme) {
-            doc["success"] = true;
-            doc["message"] = "当前已是选定的主题";
-            doc["theme"] = theme;
-            doc["needRestart"] = false;
-            printf("当前已是选定的主题: %d\n", theme);
-            String response;
-            serializeJson(doc, response);
-            server->send(200, "application/json", response);
-            return;
-        }
-    }
+    LVGLDriver* driver = m_displayManager->getLVGLDriver();
+    bool success = driver->setBufferStrategy((lvgl_buffer_strategy_t)strategy, (uint16_t)lines);
     
-    // 保存主题配置到NVS
-    printf("保存主题配置到NVS: %d\n", theme);
-    bool saveSuccess = configStorage->saveThemeConfigAsync(theme, 3000);
+    doc["success"] = success;
+    doc["message"] = success ? "显示缓冲区策略切换成功" : "显示缓冲区策略切换失败，已回退到原策略";
+    doc["strategy"] = (int)driver->getBufferStrategy();
+    doc["lines"] = driver->getBufferLines();
     
-    if (saveSuccess) {
-        doc["success"] = true;
-        doc["message"] = "主题配置已保存，系统将在3秒后重启以应用新主题";
-        doc["theme"] = theme;
-        doc["needRestart"] = true;
-        doc["restartDelay"] = 3000; // 3秒延迟
-        printf("主题配置保存成功，准备重启系统\n");
-        
-        String response;
-        serializeJson(doc, response);
-        server->send(200, "application/json", response);
-        
-        // 延时3秒后重启设备以应用新主题
-        vTaskDelay(pdMS_TO_TICKS(3000));
-        printf("重启系统以应用新主题...\n");
-        ESP.restart();
-    } else {
-        doc["success"] = false;
-        doc["message"] = "主题配置保存失败";
-        doc["theme"] = theme;
-        doc["needRestart"] = false;
-        printf("主题配置保存失败\n");
-        
-        String response;
-        serializeJson(doc, response);
-        server->send(500, "application/json", response);
-    }
-}
-
-void WebServerManager::handleSystemSettings() {
-    printf("处理系统设置页面请求\n");
-    server->send(200, "text/html", getSystemSettingsHTML());
+    sendJson(200, doc);
 }
 
-void WebServerManager::handleGetTimeConfig() {
-    printf("处理获取时间配置请求\n");
+void WebServerManager::handleDisplayBenchmark() {
+    printf("处理显示缓冲区基准测试请求\n");
     
-    DynamicJsonDocument doc(512);
+    PSRAMArenaScope arena(m_psramManager);
+    ArenaJsonDocument doc(2048, arena.jsonAllocator());
     
-    // 获取当前时间信息
-    time_t now;
-    struct tm timeinfo;
-    time(&now);
-    localtime_r(&now, &timeinfo);
+    if (!m_displayManager || !m_displayManager->getLVGLDriver()) {
+        doc["success"] = false;
+        doc["message"] = "显示管理器未初始化";
+        printf("显示管理器未初始化\n");
+        sendJson(400, doc);
+        return;
+    }
     
-    doc["success"] = true;
-    doc["currentTime"] = asctime(&timeinfo);
-    doc["timestamp"] = now;
-    doc["timezone"] = "UTC+8";
-    doc["ntpEnabled"] = true;
-    doc["ntpServer"] = "pool.ntp.org";
-    doc["message"] = "时间配置获取成功";
+    // 基准测试会占用显示数秒，测试期间屏幕显示测试场景
+    lvgl_buffer_benchmark_result_t results[8];
+    int count = m_displayManager->getLVGLDriver()->runBufferBenchmark(results, 8);
+    if (count > 8) {
+        count = 8;
+    }
     
-    String response;
-    serializeJson(doc, response);
-    server->send(200, "application/json", response);
+    doc["success"] = count > 0;
+    JsonArray items = doc.createNestedArray("results");
+    for (int i = 0; i < count; i++) {
+        JsonObject item = items.createNestedObject();
+        item["strategy"] = (int)results[i].strategy;
+        item["strategyName"] = LVGLDriver::getBufferStrategyName(results[i].strategy);
+        item["lines"] = results[i].stripe_lines;
+        item["success"] = results[i].success;
+        item["frames"] = results[i].frames;
+        item["fps"] = results[i].fps;
+        item["avgFrameMs"] = results[i].avg_frame_ms;
+        item["avgFlushMs"] = results[i].avg_flush_ms;
+        item["flushCount"] = results[i].flush_count;
+        item["internalBytes"] = results[i].internal_buf_bytes;
+        item["psramBytes"] = results[i].psram_buf_bytes;
+        item["internalFree"] = results[i].internal_free_bytes;
+    }
+    
+    sendJson(200, doc);
 }
 
-void WebServerManager::handleSetTimeConfig() {
-    printf("处理设置时间配置请求\n");
+void WebServerManager::handleGetDisplayPerf() {
+    PSRAMArenaScope arena(m_psramManager);
+    ArenaJsonDocument doc(1536, arena.jsonAllocator());
     
-    DynamicJsonDocument doc(256);
-    
-    if (server->hasArg("timezone")) {
-        String timezone = server->arg("timezone");
-        printf("设置时区: %s\n", timezone.c_str());
-        
-        // 这里可以添加时区设置逻辑
-        doc["success"] = true;
-        doc["message"] = "时区设置成功";
-        doc["timezone"] = timezone;
-    } else {
+    if (!m_displayManager || !m_displayManager->getLVGLDriver()) {
         doc["success"] = false;
-        doc["message"] = "缺少时区参数";
+        doc["message"] = "显示管理器未初始化";
+        sendJson(400, doc);
+        return;
     }
     
-    String response;
-    serializeJson(doc, response);
-    server->send(200, "application/json", response);
+    LVGLDriver* driver = m_displayManager->getLVGLDriver();
+    lvgl_perf_stats_t stats;
+    driver->getPerfStats(&stats);
+    
+    doc["success"] = true;
+    doc["frames"] = stats.frames;
+    doc["areas"] = stats.areas;
+    doc["mergedAreas"] = stats.merged_areas;
+    doc["pixels"] = stats.pixels;
+    doc["bytes"] = stats.bytes;
+    doc["fps"] = stats.fps;
+    doc["areasPerFrame"] = stats.areas_per_frame;
+    doc["flushAvgUs"] = stats.flush_avg_us;
+    doc["flushMaxUs"] = stats.flush_max_us;
+    doc["handlerCount"] = stats.handler_count;
+    doc["handlerAvgUs"] = stats.handler_avg_us;
+    doc["handlerMaxUs"] = stats.handler_max_us;
+    doc["lockCount"] = stats.lock_count;
+    doc["lockTimeouts"] = stats.lock_timeouts;
+    doc["lockWaitAvgUs"] = stats.lock_wait_avg_us;
+    doc["lockWaitMaxUs"] = stats.lock_wait_max_us;
+    doc["overlay"] = driver->isPerfOverlayEnabled();
+    doc["mergeEnabled"] = driver->isAreaMergeEnabled();
+    doc["mergeTxnCostPx"] = driver->getAreaMergeTxnCost();
+    
+    // 触摸读取统计（TP_INT中断驱动时空闲期间I2C读取应接近0）
+    touch_stats_t touch;
+    Touch_GetStats(&touch);
+    JsonObject touchObj = doc.createNestedObject("touch");
+    touchObj["interruptMode"] = touch.interrupt_mode;
+    touchObj["irqCount"] = touch.irq_count;
+    touchObj["i2cReads"] = touch.i2c_reads;
+    touchObj["skippedReads"] = touch.skipped_reads;
+    touchObj["readErrors"] = touch.read_errors;
+    touchObj["latencyAvgUs"] = touch.latency_count ? (uint32_t)(touch.latency_total_us / touch.latency_count) : 0;
+    touchObj["latencyMaxUs"] = touch.max_latency_us;
+    
+    sendJson(200, doc);
 }
 
-void WebServerManager::handleSyncTime() {
-    printf("处理时间同步请求\n");
+void WebServerManager::handleResetDisplayPerf() {
+    printf("处理清零显示性能统计请求\n");
     
-    DynamicJsonDocument doc(256);
+    PSRAMArenaScope arena(m_psramManager);
+    ArenaJsonDocument doc(128, arena.jsonAllocator());
     
-    if (wifiManager->isConnected()) {
-        // 执行NTP时间同步
-        printf("开始NTP时间同步...\n");
+    if (!m_displayManager || !m_displayManager->getLVGLDriver()) {
+        doc["success"] = false;
+        doc["message"] = "显示管理器未初始化";
+        sendJson(400, doc);
+        return;
+    }
+    
+    m_displayManager->getLVGLDriver()->resetPerfStats();
+    doc["success"] = true;
+    doc["message"] = "显示性能统计已清零";
+    
+    sendJson(200, doc);
+}
+
+void WebServerManager::handleSetDisplayPerfOverlay() {
+    printf("处理设置显示性能叠加层请求\n");
+    
+    PSRAMArenaScope arena(m_psramManager);
+    ArenaJsonDocument doc(128, arena.jsonAllocator());
+    
+    if (!m_displayManager || !m_displayManager->getLVGLDriver()) {
+        doc["success"] = false;
+        doc["message"] = "显示管理器未初始化";
+        sendJson(400, doc);
+        return;
+    }
+    
+    if (!server->hasArg("enabled")) {
+        doc["success"] = false;
+        doc["message"] = "缺少enabled参数";
+        sendJson(400, doc);
+        return;
+    }
+    
+    bool enabled = server->arg("enabled") == "true";
+    LVGLDriver* driver = m_displayManager->getLVGLDriver();
+    driver->setPerfOverlayEnabled(enabled);
+    
+    doc["success"] = driver->isPerfOverlayEnabled() == enabled;
+    doc["overlay"] = driver->isPerfOverlayEnabled();
+    
+    sendJson(200, doc);
+}
+
+void WebServerManager::handleSetDisplayAreaMerge() {
+    printf("处理设置显示区域合并请求\n");
+    
+    PSRAMArenaScope arena(m_psramManager);
+    ArenaJsonDocument doc(256, arena.jsonAllocator());
+    
+    if (!m_displayManager || !m_displayManager->getLVGLDriver()) {
+        doc["success"] = false;
+        doc["message"] = "显示管理器未初始化";
+        sendJson(400, doc);
+        return;
+    }
+    
+    LVGLDriver* driver = m_displayManager->getLVGLDriver();
+    bool enabled = server->hasArg("enabled") ? (server->arg("enabled") == "true") : driver->isAreaMergeEnabled();
+    int txnCost = server->hasArg("txnCostPx") ? server->arg("txnCostPx").toInt() : (int)driver->getAreaMergeTxnCost();
+    
+    if (txnCost < 0 || txnCost > 368 * 448) {
+        doc["success"] = false;
+        doc["message"] = "无效的事务开销参数";
+        sendJson(400, doc);
+        return;
+    }
+    
+    driver->setAreaMergeConfig(enabled, (uint32_t)txnCost);
+    
+    doc["success"] = true;
+    doc["mergeEnabled"] = driver->isAreaMergeEnabled();
+    doc["mergeTxnCostPx"] = driver->getAreaMergeTxnCost();
+    
+    sendJson(200, doc);
+}
+
+void WebServerManager::handleGetDisplayPower() {
+    PSRAMArenaScope arena(m_psramManager);
+    ArenaJsonDocument doc(1024, arena.jsonAllocator());
+    
+    if (!m_displayManager || !m_displayManager->getLVGLDriver()) {
+        doc["success"] = false;
+        doc["message"] = "显示管理器未初始化";
+        sendJson(400, doc);
+        return;
+    }
+    
+    static const char* stateNames[] = {"active", "dimming", "dark", "waking"};
+    
+    DisplayPowerStats power;
+    m_displayManager->getPowerStats(&power);
+    lvgl_perf_stats_t perf;
+    m_displayManager->getLVGLDriver()->getPerfStats(&perf);
+    
+    doc["success"] = true;
+    doc["state"] = stateNames[power.state];
+    doc["renderSuspendEnabled"] = m_displayManager->isRenderSuspendEnabled();
+    doc["renderSuspended"] = perf.render_suspended;
+    doc["darkCount"] = power.dark_count;
+    doc["darkMs"] = power.dark_ms;
+    doc["skippedUpdates"] = power.skipped_updates;
+    doc["lastCatchupUs"] = power.last_catchup_us;
+    doc["suspendCount"] = perf.suspend_count;
+    doc["suspendedMs"] = perf.suspended_ms;
+    doc["activeLoad"] = perf.active_load;
+    doc["suspendedLoad"] = perf.suspended_load;
+    
+    // 背光渐变（esp_timer驱动）
+    BacklightFadeStats fade;
+    m_displayManager->getFadeStats(&fade);
+    JsonObject fadeObj = doc.createNestedObject("fade");
+    fadeObj["fading"] = m_displayManager->isFading();
+    fadeObj["fades"] = fade.fades;
+    fadeObj["completed"] = fade.completed;
+    fadeObj["cancelled"] = fade.cancelled;
+    fadeObj["ticks"] = fade.ticks;
+    fadeObj["commands"] = fade.commands;
+    fadeObj["coalesced"] = fade.coalesced;
+    fadeObj["maxCommandUs"] = fade.max_command_us;
+    fadeObj["maxTickLateUs"] = fade.max_tick_late_us;
+    
+    // 显示任务调度（任务通知+软定时器）
+    DisplayTaskStats task;
+    m_displayManager->getTaskStats(&task);
+    JsonObject taskObj = doc.createNestedObject("task");
+    taskObj["windowMs"] = task.window_ms;
+    taskObj["wakeups"] = task.wakeups;
+    taskObj["eventWakeups"] = task.event_wakeups;
+    taskObj["timerWakeups"] = task.timer_wakeups;
+    taskObj["timerFires"] = task.timer_fires;
+    taskObj["messages"] = task.messages;
+    taskObj["avgMsgLatencyUs"] = task.avg_msg_latency_us;
+    taskObj["maxMsgLatencyUs"] = task.max_msg_latency_us;
+    taskObj["armedTimers"] = task.armed_timers;
+    
+    sendJson(200, doc);
+}
+
+void WebServerManager::handleSetDisplayPower() {
+    printf("处理设置熄屏渲染挂起请求\n");
+    
+    PSRAMArenaScope arena(m_psramManager);
+    ArenaJsonDocument doc(128, arena.jsonAllocator());
+    
+    if (!m_displayManager) {
+        doc["success"] = false;
+        doc["message"] = "显示管理器未初始化";
+        sendJson(400, doc);
+        return;
+    }
+    
+    if (!server->hasArg("renderSuspend") && !server->hasArg("resetTaskStats")) {
+        doc["success"] = false;
+        doc["message"] = "缺少renderSuspend或resetTaskStats参数";
+        sendJson(400, doc);
+        return;
+    }
+    
+    if (server->hasArg("renderSuspend")) {
+        m_displayManager->setRenderSuspendEnabled(server->arg("renderSuspend") == "true");
+    }
+    if (server->arg("resetTaskStats") == "true") {
+        m_displayManager->resetTaskStats();
+    }
+    
+    doc["success"] = true;
+    doc["renderSuspendEnabled"] = m_displayManager->isRenderSuspendEnabled();
+    
+    sendJson(200, doc);
+}
+
+void WebServerManager::handleGetDisplayScreens() {
+    PSRAMArenaScope arena(m_psramManager);
+    ArenaJsonDocument doc(768, arena.jsonAllocator());
+    
+    if (!m_displayManager) {
+        doc["success"] = false;
+        doc["message"] = "显示管理器未初始化";
+        sendJson(400, doc);
+        return;
+    }
+    
+    ScreenManagerStats stats;
+    m_displayManager->getScreenStats(&stats);
+    const ScreenManager& screens = m_displayManager->getScreenManager();
+    
+    doc["success"] = true;
+    doc["onDemand"] = SCREEN_ON_DEMAND ? true : false;
+    doc["idleSec"] = screens.getIdleTimeout() / 1000;
+    doc["maxResident"] = screens.getMaxResident();
+    doc["prewarm"] = screens.isPrewarmEnabled();
+    doc["resident"] = stats.resident_count;
+    doc["peakResident"] = stats.peak_resident;
+    doc["builds"] = stats.builds;
+    doc["onDemandBuilds"] = stats.on_demand_builds;
+    doc["prewarmBuilds"] = stats.prewarm_builds;
+    doc["prewarmHits"] = stats.prewarm_hits;
+    doc["prewarmWasted"] = stats.prewarm_wasted;
+    doc["evictions"] = stats.evictions;
+    doc["avgBuildUs"] = stats.avg_build_us;
+    doc["maxBuildUs"] = stats.max_build_us;
+    doc["bootBuildUs"] = stats.boot_build_us;
+    doc["lvglMemUsed"] = stats.lvgl_mem_used;
+    doc["lvglMemPeak"] = stats.lvgl_mem_peak;
+    doc["lvglMemTotal"] = stats.lvgl_mem_total;
+    
+    sendJson(200, doc);
+}
+
+void WebServerManager::handleSetDisplayScreens() {
+    printf("处理设置屏幕释放策略请求\n");
+    
+    PSRAMArenaScope arena(m_psramManager);
+    ArenaJsonDocument doc(256, arena.jsonAllocator());
+    
+    if (!m_displayManager) {
+        doc["success"] = false;
+        doc["message"] = "显示管理器未初始化";
+        sendJson(400, doc);
+        return;
+    }
+    
+    // 未提供的参数保持不变
+    const ScreenManager& screens = m_displayManager->getScreenManager();
+    uint32_t idleMs = server->hasArg("idleSec") ? server->arg("idleSec").toInt() * 1000 : screens.getIdleTimeout();
+    int maxResident = server->hasArg("maxResident") ? server->arg("maxResident").toInt() : screens.getMaxResident();
+    bool prewarm = server->hasArg("prewarm") ? server->arg("prewarm") == "true" : screens.isPrewarmEnabled();
+    
+    if (maxResident < 2 || maxResident > SCREEN_SLOT_MAX) {
+        doc["success"] = false;
+        doc["message"] = "maxResident超出范围（2-10）";
+        sendJson(400, doc);
+        return;
+    }
+    
+    m_displayManager->setScreenPolicy(idleMs, (uint8_t)maxResident, prewarm);
+    
+    doc["success"] = true;
+    doc["idleSec"] = screens.getIdleTimeout() / 1000;
+    doc["maxResident"] = screens.getMaxResident();
+    doc["prewarm"] = screens.isPrewarmEnabled();
+    
+    sendJson(200, doc);
+}
+
+void WebServerManager::handleGetPowerTrend() {
+    PSRAMArenaScope arena(m_psramManager);
+    ArenaJsonDocument doc(2048, arena.jsonAllocator());
+    
+    if (!m_displayManager || !m_displayManager->getPowerTrend().isReady()) {
+        doc["success"] = false;
+        doc["message"] = "功率趋势图未初始化";
+        sendJson(400, doc);
+        return;
+    }
+    
+    PowerTrend& trend = m_displayManager->getPowerTrend();
+    PowerTrendStats stats;
+    trend.getStats(&stats);
+    
+    doc["success"] = true;
+    doc["windowMinutes"] = trend.getWindowMinutes();
+    JsonArray windows = doc.createNestedArray("windows");
+    for (int i = 0; i < PowerTrend::getWindowCount(); i++) {
+        windows.add(PowerTrend::getWindowMinutesAt(i));
+    }
+    doc["samples"] = stats.samples;
+    doc["mounted"] = stats.mounted;
+    doc["mountsTotal"] = stats.mounts_total;
+    doc["incrementalPoints"] = stats.incremental_points;
+    doc["fullRedraws"] = stats.full_redraws;
+    doc["rescales"] = stats.rescales;
+    doc["avgUpdateUs"] = stats.avg_update_us;
+    doc["maxUpdateUs"] = stats.max_update_us;
+    doc["historyBytes"] = stats.history_bytes;
+    
+    // 可选：返回某个通道的曲线数据（0为总功率，1-4为端口），无数据的点为null
+    if (server->hasArg("channel")) {
+        int channel = server->arg("channel").toInt();
+        if (channel < 0 || channel >= POWER_TREND_CHANNELS) {
+            doc.clear();
+            doc["success"] = false;
+            doc["message"] = "channel超出范围（0-4）";
+            sendJson(400, doc);
+            return;
+        }
+        
+        float values[64];
+        int count = trend.getSeries((uint8_t)channel, values, 64);
+        doc["channel"] = channel;
+        JsonArray series = doc.createNestedArray("series");
+        for (int i = 0; i < count; i++) {
+            if (values[i] < 0) {
+                series.add(nullptr);
+            } else {
+                series.add(values[i]);
+            }
+        }
+    }
+    
+    sendJson(200, doc);
+}
+
+void WebServerManager::handleSetPowerTrend() {
+    printf("处理设置功率趋势图窗口请求\n");
+    
+    PSRAMArenaScope arena(m_psramManager);
+    ArenaJsonDocument doc(256, arena.jsonAllocator());
+    
+    if (!m_displayManager) {
+        doc["success"] = false;
+        doc["message"] = "显示管理器未初始化";
+        sendJson(400, doc);
+        return;
+    }
+    
+    if (!server->hasArg("minutes") || !m_displayManager->setPowerTrendWindow((uint16_t)server->arg("minutes").toInt())) {
+        doc["success"] = false;
+        doc["message"] = "minutes必须为1、10、60或1440";
+        sendJson(400, doc);
+        return;
+    }
+    
+    doc["success"] = true;
+    doc["windowMinutes"] = m_displayManager->getPowerTrend().getWindowMinutes();
+    
+    sendJson(200, doc);
+}
+
+void WebServerManager::handleMirrorPage() {
+    printf("处理屏幕镜像页面请求\n");
+    server->send(200, "text/html", getMirrorHTML());
+}
+
+void WebServerManager::handleGetScreenMirror() {
+    PSRAMArenaScope arena(m_psramManager);
+    ArenaJsonDocument doc(512, arena.jsonAllocator());
+    
+    if (!m_displayManager) {
+        doc["success"] = false;
+        doc["message"] = "显示管理器未初始化";
+        sendJson(400, doc);
+        return;
+    }
+    
+    ScreenMirrorStats stats;
+    m_displayManager->getScreenMirror().getStats(&stats);
+    
+    doc["success"] = true;
+    doc["enabled"] = SCREEN_MIRROR_ENABLED ? true : false;
+    doc["port"] = SCREEN_MIRROR_PORT;
+    doc["streaming"] = stats.streaming;
+    doc["connections"] = stats.connections;
+    doc["frames"] = stats.frames;
+    doc["areas"] = stats.areas;
+    doc["droppedAreas"] = stats.dropped_areas;
+    doc["resyncs"] = stats.resyncs;
+    doc["rawBytes"] = stats.raw_bytes;
+    doc["encodedBytes"] = stats.encoded_bytes;
+    doc["sentBytes"] = stats.sent_bytes;
+    doc["compressionRatio"] = stats.encoded_bytes ? (float)stats.raw_bytes / stats.encoded_bytes : 0.0f;
+    doc["maxCaptureUs"] = stats.max_capture_us;
+    doc["ringBytes"] = stats.ring_bytes;
+    doc["ringPeakUsed"] = stats.ring_peak_used;
+    
+    sendJson(200, doc);
+}
+
+void WebServerManager::handleSetScreenMirror() {
+    printf("处理屏幕镜像操作请求\n");
+    
+    PSRAMArenaScope arena(m_psramManager);
+    ArenaJsonDocument doc(128, arena.jsonAllocator());
+    
+    if (!m_displayManager) {
+        doc["success"] = false;
+        doc["message"] = "显示管理器未初始化";
+        sendJson(400, doc);
+        return;
+    }
+    
+    if (server->arg("disconnect") != "true") {
+        doc["success"] = false;
+        doc["message"] = "缺少disconnect参数";
+        sendJson(400, doc);
+        return;
+    }
+    
+    m_displayManager->getScreenMirror().disconnect();
+    doc["success"] = true;
+    
+    sendJson(200, doc);
+}
+
+void WebServerManager::handleGetAssets() {
+    PSRAMArenaScope arena(m_psramManager);
+    ArenaJsonDocument doc(768, arena.jsonAllocator());
+    
+    AssetManager* assetManager = m_displayManager ? m_displayManager->getAssetManager() : nullptr;
+    if (!assetManager || !assetManager->isReady()) {
+        doc["success"] = false;
+        doc["message"] = "资源包管理器未初始化";
+        sendJson(400, doc);
+        return;
+    }
+    
+    AssetCacheStats stats;
+    assetManager->getStats(&stats);
+    uint32_t lookups = stats.hits + stats.misses;
+    
+    doc["success"] = true;
+    doc["pack"] = assetManager->getActivePack();
+    doc["packEntries"] = assetManager->getPackEntryCount();
+    doc["budgetBytes"] = stats.budget_bytes;
+    doc["cachedBytes"] = stats.cached_bytes;
+    doc["cachedCount"] = stats.cached_count;
+    doc["pinnedCount"] = stats.pinned_count;
+    doc["hits"] = stats.hits;
+    doc["misses"] = stats.misses;
+    doc["hitRate"] = lookups ? stats.hits * 100.0f / lookups : 0.0f;
+    doc["evictions"] = stats.evictions;
+    doc["loadFailures"] = stats.load_failures;
+    doc["avgLoadUs"] = stats.avg_load_us;
+    doc["bindCount"] = stats.bind_count;
+    doc["lastBindUs"] = stats.last_bind_us;
+    doc["lastBindHits"] = stats.last_bind_hits;
+    doc["lastBindMisses"] = stats.last_bind_misses;
+    doc["avgHitBindUs"] = stats.avg_hit_bind_us;
+    doc["avgMissBindUs"] = stats.avg_miss_bind_us;
+    
+    sendJson(200, doc);
+}
+
+void WebServerManager::handleSetAssetPack() {
+    printf("处理切换UI资源包请求\n");
+    
+    PSRAMArenaScope arena(m_psramManager);
+    ArenaJsonDocument doc(256, arena.jsonAllocator());
+    
+    AssetManager* assetManager = m_displayManager ? m_displayManager->getAssetManager() : nullptr;
+    if (!assetManager || !assetManager->isReady()) {
+        doc["success"] = false;
+        doc["message"] = "资源包管理器未初始化";
+        sendJson(400, doc);
+        return;
+    }
+    
+    // path为空表示恢复内置资源
+    String path = server->hasArg("path") ? server->arg("path") : "";
+    if (path.length() > 0) {
+        path = fileManager->sanitizePath(path);
+        if (path.length() >= 64 || !fileManager->exists(path)) {
+            doc["success"] = false;
+            doc["message"] = "资源包文件不存在或路径过长";
+            sendJson(400, doc);
+            return;
+        }
+    }
+    
+    // 保存到配置，重启后自动加载
+    if (configStorage) {
+        configStorage->putStringAsync("asset_pack", path);
+    }
+    m_displayManager->setAssetPack(path.c_str());
+    
+    doc["success"] = true;
+    doc["pack"] = path;
+    doc["message"] = path.length() > 0 ? "资源包已提交，切换后当前屏幕立即更新" : "已恢复内置资源";
+    
+    sendJson(200, doc);
+}
+
+void WebServerManager::handleSetAssetCache() {
+    printf("处理调整资源缓存请求\n");
+    
+    PSRAMArenaScope arena(m_psramManager);
+    ArenaJsonDocument doc(256, arena.jsonAllocator());
+    
+    AssetManager* assetManager = m_displayManager ? m_displayManager->getAssetManager() : nullptr;
+    if (!assetManager || !assetManager->isReady()) {
+        doc["success"] = false;
+        doc["message"] = "资源包管理器未初始化";
+        sendJson(400, doc);
+        return;
+    }
+    
+    uint32_t budgetBytes = server->hasArg("budgetKB") ? server->arg("budgetKB").toInt() * 1024 : 0;
+    bool clear = server->arg("clear") == "true";
+    
+    if (server->arg("resetStats") == "true") {
+        assetManager->resetStats();
+    }
+    if (budgetBytes > 0 || clear) {
+        m_displayManager->setAssetCache(budgetBytes, clear);
+    }
+    
+    doc["success"] = true;
+    doc["budgetBytes"] = budgetBytes;
+    doc["clear"] = clear;
+    
+    sendJson(200, doc);
+}
+
+void WebServerManager::handleGetThemeSettings() {
+    printf("处理获取主题设置请求\n");
+    
+    PSRAMArenaScope arena(m_psramManager);
+    ArenaJsonDocument doc(256, arena.jsonAllocator());
+    
+    if (!configStorage) {
+        doc["success"] = false;
+        doc["message"] = "配置存储未初始化";
+        printf("配置存储未初始化\n");
+        sendJson(400, doc);
+        return;
+    }
+    
+    // 获取当前主题设置
+    if (configStorage->hasThemeConfigAsync(3000)) {
+        int theme = configStorage->loadThemeConfigAsync(3000);
+        doc["success"] = true;
+        doc["theme"] = theme;
+        doc["message"] = "主题配置获取成功";
+        printf("主题配置获取成功: %d\n", theme);
+    } else {
+        doc["success"] = true;
+        doc["theme"] = 0; // 默认UI1主题
+        doc["message"] = "使用默认主题配置";
+        printf("使用默认主题配置\n");
+    }
+    
+    sendJson(200, doc);
+}
+
+void WebServerManager::handleSetThemeSettings() {
+    printf("处理设置主题配置请求\n");
+    
+    PSRAMArenaScope arena(m_psramManager);
+    ArenaJsonDocument doc(256, arena.jsonAllocator());
+    
+    if (!configStorage) {
+        doc["success"] = false;
+        doc["message"] = "配置存储未初始化";
+        printf("配置存储未初始化\n");
+        sendJson(400, doc);
+        return;
+    }
+    
+    // 检查必要参数
+    if (!server->hasArg("theme")) {
+        doc["success"] = false;
+        doc["message"] = "缺少theme参数";
+        printf("缺少theme参数\n");
+        sendJson(400, doc);
+        return;
+    }
+    
+    int theme = server->arg("theme").toInt();
+    
+    printf("接收到主题切换请求：主题=%d\n", theme);
+    
+    // 参数验证
+    if (theme < 0 || theme > 2) {
+        doc["success"] = false;
+        doc["message"] = "无效的主题值";
+        printf("无效的主题值: %d\n", theme);
+        sendJson(400, doc);
+        return;
+    }
+    
+    // 检查是否是当前主题
+    if (configStorage->hasThemeConfigAsync(3000)) {
+        int currentTheme = configStorage->loadThemeConfigAsync(3000);
+        if (currentTheme == theme) {
+            doc["success"] = true;
+            doc["message"] = "当前已是选定的主题";
+            doc["theme"] = theme;
+            doc["needRestart"] = false;
+            printf("当前已是选定的主题: %d\n", theme);
+            sendJson(200, doc);
+            return;
+        }
+    }
+    
+    // 保存主题配置到NVS
+    printf("保存主题配置到NVS: %d\n", theme);
+    bool saveSuccess = configStorage->saveThemeConfigAsync(theme, 3000);
+    
+    if (saveSuccess) {
+        // 在显示任务中运行时切换，无需重启
+        if (m_displayManager) {
+            m_displayManager->setTheme((DisplayTheme)theme);
+        }
+        
+        doc["success"] = true;
+        doc["message"] = "主题已切换";
+        doc["theme"] = theme;
+        doc["needRestart"] = false;
+        printf("主题配置保存成功，已提交运行时切换\n");
+        
+        sendJson(200, doc);
+    } else {
+        doc["success"] = false;
+        doc["message"] = "主题配置保存失败";
+        doc["theme"] = theme;
+        doc["needRestart"] = false;
+        printf("主题配置保存失败\n");
+        
+        sendJson(500, doc);
+    }
+}
+
+void WebServerManager::handleGetThemeSoak() {
+    PSRAMArenaScope arena(m_psramManager);
+    ArenaJsonDocument doc(768, arena.jsonAllocator());
+    
+    if (!m_displayManager) {
+        doc["success"] = false;
+        doc["message"] = "显示管理器未初始化";
+        sendJson(400, doc);
+        return;
+    }
+    
+    ThemeSoakStats stats;
+    m_displayManager->getThemeSoakStats(&stats);
+    
+    doc["success"] = true;
+    doc["running"] = stats.running;
+    doc["passed"] = stats.passed;
+    doc["cycles"] = stats.cycles;
+    doc["completed"] = stats.completed;
+    doc["avgSwitchUs"] = stats.avg_switch_us;
+    doc["maxSwitchUs"] = stats.max_switch_us;
+    doc["internalFreeBase"] = stats.internal_free_base;
+    doc["internalFreeEnd"] = stats.internal_free_end;
+    doc["internalMinFree"] = stats.internal_min_free;
+    doc["psramFreeBase"] = stats.psram_free_base;
+    doc["psramFreeEnd"] = stats.psram_free_end;
+    doc["psramMinFree"] = stats.psram_min_free;
+    doc["lvglUsedBase"] = stats.lvgl_used_base;
+    doc["lvglUsedEnd"] = stats.lvgl_used_end;
+    doc["lvglUsedPeak"] = stats.lvgl_used_peak;
+    
+    sendJson(200, doc);
+}
+
+void WebServerManager::handleStartThemeSoak() {
+    printf("处理主题切换压力测试请求\n");
+    
+    PSRAMArenaScope arena(m_psramManager);
+    ArenaJsonDocument doc(256, arena.jsonAllocator());
+    
+    if (!m_displayManager) {
+        doc["success"] = false;
+        doc["message"] = "显示管理器未初始化";
+        sendJson(400, doc);
+        return;
+    }
+    
+    if (server->arg("stop") == "true") {
+        m_displayManager->stopThemeSoak();
+        doc["success"] = true;
+        doc["message"] = "压力测试将在当前切换完成后停止";
+        sendJson(200, doc);
+        return;
+    }
+    
+    uint32_t cycles = server->hasArg("cycles") ? server->arg("cycles").toInt() : 1000;
+    if (!m_displayManager->startThemeSoak(cycles)) {
+        doc["success"] = false;
+        doc["message"] = "压力测试已在进行或UI未初始化";
+        sendJson(400, doc);
+        return;
+    }
+    
+    ThemeSoakStats stats;
+    m_displayManager->getThemeSoakStats(&stats);
+    
+    doc["success"] = true;
+    doc["cycles"] = stats.cycles;
+    doc["message"] = "压力测试已开始，通过GET /api/theme/soak查看进度";
+    
+    sendJson(200, doc);
+}
+
+void WebServerManager::handleGetMemoryProfile() {
+    PSRAMArenaScope arena(m_psramManager);
+    ArenaJsonDocument doc(32768, arena.jsonAllocator());
+    
+    if (!m_psramManager) {
+        doc["success"] = false;
+        doc["message"] = "PSRAM管理器未初始化";
+        sendJson(400, doc);
+        return;
+    }
+    
+    doc["success"] = true;
+    m_psramManager->getProfileJSON(doc);
+    
+    sendJson(200, doc);
+}
+
+void WebServerManager::handleGetMemoryProfileDump() {
+    printf("处理内存剖析二进制导出请求\n");
+    
+    if (!m_psramManager) {
+        server->send(400, "text/plain", "PSRAM管理器未初始化");
+        return;
+    }
+    
+    PSRAMArenaScope arena(m_psramManager);
+    size_t capacity = m_psramManager->getProfileDumpSize();
+    uint8_t* buffer = (uint8_t*)arena.alloc(capacity);
+    size_t length = buffer ? m_psramManager->getProfileDump(buffer, capacity) : 0;
+    if (length == 0) {
+        server->send(500, "text/plain", "内存剖析导出失败");
+        return;
+    }
+    
+    server->sendHeader("Content-Disposition", "attachment; filename=memprof.bin");
+    server->send_P(200, "application/octet-stream", (const char*)buffer, length);
+}
+
+void WebServerManager::handleSetMemoryProfile() {
+    printf("处理设置内存剖析请求\n");
+    
+    PSRAMArenaScope arena(m_psramManager);
+    ArenaJsonDocument doc(256, arena.jsonAllocator());
+    
+    if (!m_psramManager) {
+        doc["success"] = false;
+        doc["message"] = "PSRAM管理器未初始化";
+        sendJson(400, doc);
+        return;
+    }
+    
+    if (!server->hasArg("enabled") && !server->hasArg("reset")) {
+        doc["success"] = false;
+        doc["message"] = "缺少enabled或reset参数";
+        sendJson(400, doc);
+        return;
+    }
+    
+    if (server->hasArg("enabled")) {
+        m_psramManager->setProfilerEnabled(server->arg("enabled") == "true");
+    }
+    if (server->arg("reset") == "true") {
+        m_psramManager->resetProfiler();
+    }
+    
+    doc["success"] = true;
+    doc["enabled"] = m_psramManager->isProfilerEnabled();
+    
+    sendJson(200, doc);
+}
+
+void WebServerManager::handleSystemSettings() {
+    printf("处理系统设置页面请求\n");
+    server->send(200, "text/html", getSystemSettingsHTML());
+}
+
+void WebServerManager::handleGetTimeConfig() {
+    printf("处理获取时间配置请求\n");
+    
+    PSRAMArenaScope arena(m_psramManager);
+    ArenaJsonDocument doc(512, arena.jsonAllocator());
+    
+    // 获取当前时间信息
+    time_t now;
+    struct tm timeinfo;
+    time(&now);
+    localtime_r(&now, &timeinfo);
+    
+    doc["success"] = true;
+    doc["currentTime"] = asctime(&timeinfo);
+    doc["timestamp"] = now;
+    doc["timezone"] = "UTC+8";
+    doc["ntpEnabled"] = true;
+    doc["ntpServer"] = "pool.ntp.org";
+    doc["message"] = "时间配置获取成功";
+    
+    sendJson(200, doc);
+}
+
+void WebServerManager::handleSetTimeConfig() {
+    printf("处理设置时间配置请求\n");
+    
+    PSRAMArenaScope arena(m_psramManager);
+    ArenaJsonDocument doc(256, arena.jsonAllocator());
+    
+    if (server->hasArg("timezone")) {
+        String timezone = server->arg("timezone");
+        printf("设置时区: %s\n", timezone.c_str());
+        
+        // 这里可以添加时区设置逻辑
+        doc["success"] = true;
+        doc["message"] = "时区设置成功";
+        doc["timezone"] = timezone;
+    } else {
+        doc["success"] = false;
+        doc["message"] = "缺少时区参数";
+    }
+    
+    sendJson(200, doc);
+}
+
+void WebServerManager::handleSyncTime() {
+    printf("处理时间同步请求\n");
+    
+    PSRAMArenaScope arena(m_psramManager);
+    ArenaJsonDocument doc(256, arena.jsonAllocator());
+    
+    if (wifiManager->isConnected()) {
+        // 执行NTP时间同步
+        printf("开始NTP时间同步...\n");
         
         configTime(8 * 3600, 0, "pool.ntp.org", "time.nist.gov");
         
@@ -2520,24 +3330,21 @@ void WebServerManager::handleSyncTime() {
         printf("设备未连接WiFi，无法同步时间\n");
     }
     
-    String response;
-    serializeJson(doc, response);
-    server->send(200, "application/json", response);
+    sendJson(200, doc);
 }
 
 // 服务器OTA升级相关API处理函数
 void WebServerManager::handleServerOTAStart() {
     printf("处理服务器OTA启动请求\n");
     
-    DynamicJsonDocument doc(512);
+    PSRAMArenaScope arena(m_psramManager);
+    ArenaJsonDocument doc(512, arena.jsonAllocator());
     
     if (!wifiManager->isConnected()) {
         doc["success"] = false;
         doc["message"] = "设备未连接WiFi，无法进行服务器OTA升级";
         printf("设备未连接WiFi，无法进行服务器OTA升级\n");
-        String response;
-        serializeJson(doc, response);
-        server->send(400, "application/json", response);
+        sendJson(400, doc);
         return;
     }
     
@@ -2565,21 +3372,17 @@ void WebServerManager::handleServerOTAStart() {
         doc["success"] = false;
         doc["message"] = "无法获取服务器版本信息，升级已取消";
         printf("无法获取服务器版本信息，升级已取消\n");
-        String response;
-        serializeJson(doc, response);
-        server->send(400, "application/json", response);
+        sendJson(400, doc);
         return;
     }
     
     // 解析服务器版本响应
-    DynamicJsonDocument serverDoc(512);
+    ArenaJsonDocument serverDoc(512, arena.jsonAllocator());
     if (deserializeJson(serverDoc, versionJson) != DeserializationError::Ok) {
         doc["success"] = false;
         doc["message"] = "服务器版本信息解析失败，升级已取消";
         printf("服务器版本信息解析失败，升级已取消\n");
-        String response;
-        serializeJson(doc, response);
-        server->send(400, "application/json", response);
+        sendJson(400, doc);
         return;
     }
     
@@ -2589,9 +3392,7 @@ void WebServerManager::handleServerOTAStart() {
         doc["success"] = false;
         doc["message"] = "服务器版本号为空，升级已取消";
         printf("服务器版本号为空，升级已取消\n");
-        String response;
-        serializeJson(doc, response);
-        server->send(400, "application/json", response);
+        sendJson(400, doc);
         return;
     }
     
@@ -2621,9 +3422,7 @@ void WebServerManager::handleServerOTAStart() {
             printf("当前版本更高，无需升级: %s > %s\n", VERSION_STRING, serverVersion.c_str());
         }
         
-        String response;
-        serializeJson(doc, response);
-        server->send(200, "application/json", response);
+        sendJson(200, doc);
         return;
     }
     
@@ -2638,9 +3437,7 @@ void WebServerManager::handleServerOTAStart() {
         
         printf("服务器OTA升级启动成功\n");
         
-        String response;
-        serializeJson(doc, response);
-        server->send(200, "application/json", response);
+        sendJson(200, doc);
     } else {
         doc["success"] = false;
         doc["message"] = "服务器OTA升级启动失败";
@@ -2648,9 +3445,7 @@ void WebServerManager::handleServerOTAStart() {
         
         printf("服务器OTA升级启动失败: %s\n", otaManager->getError().c_str());
         
-        String response;
-        serializeJson(doc, response);
-        server->send(500, "application/json", response);
+        sendJson(500, doc);
     }
 }
 
@@ -2665,15 +3460,14 @@ void WebServerManager::handleServerOTAStatus() {
 void WebServerManager::handleServerFirmwareList() {
     printf("处理服务器固件列表请求\n");
     
-    DynamicJsonDocument doc(1024);
+    PSRAMArenaScope arena(m_psramManager);
+    ArenaJsonDocument doc(1024, arena.jsonAllocator());
     
     if (!wifiManager->isConnected()) {
         doc["success"] = false;
         doc["message"] = "设备未连接WiFi，无法获取服务器固件列表";
         printf("设备未连接WiFi，无法获取服务器固件列表\n");
-        String response;
-        serializeJson(doc, response);
-        server->send(400, "application/json", response);
+        sendJson(400, doc);
         return;
     }
     
@@ -2692,7 +3486,7 @@ void WebServerManager::handleServerFirmwareList() {
     
     if (firmwareListJson.length() > 0) {
         // 解析服务器响应
-        DynamicJsonDocument serverDoc(1024);
+        ArenaJsonDocument serverDoc(1024, arena.jsonAllocator());
         if (deserializeJson(serverDoc, firmwareListJson) == DeserializationError::Ok) {
             doc["success"] = true;
             doc["message"] = "固件列表获取成功";
@@ -2715,23 +3509,20 @@ void WebServerManager::handleServerFirmwareList() {
         printf("无法连接到服务器或服务器响应为空\n");
     }
     
-    String response;
-    serializeJson(doc, response);
-    server->send(200, "application/json", response);
+    sendJson(200, doc);
 }
 
 void WebServerManager::handleServerFirmwareVersion() {
     printf("处理服务器固件版本查询请求\n");
     
-    DynamicJsonDocument doc(512);
+    PSRAMArenaScope arena(m_psramManager);
+    ArenaJsonDocument doc(512, arena.jsonAllocator());
     
     if (!wifiManager->isConnected()) {
         doc["success"] = false;
         doc["message"] = "设备未连接WiFi，无法查询服务器固件版本";
         printf("设备未连接WiFi，无法查询服务器固件版本\n");
-        String response;
-        serializeJson(doc, response);
-        server->send(400, "application/json", response);
+        sendJson(400, doc);
         return;
     }
     
@@ -2750,7 +3541,7 @@ void WebServerManager::handleServerFirmwareVersion() {
     
     if (versionJson.length() > 0) {
         // 解析服务器响应
-        DynamicJsonDocument serverDoc(512);
+        ArenaJsonDocument serverDoc(512, arena.jsonAllocator());
         if (deserializeJson(serverDoc, versionJson) == DeserializationError::Ok) {
             // 获取服务器版本号进行比较
             String serverVersionStr = serverDoc["version"].as<String>();
@@ -2808,9 +3599,7 @@ void WebServerManager::handleServerFirmwareVersion() {
         printf("无法连接到服务器或服务器响应为空\n");
     }
     
-    String response;
-    serializeJson(doc, response);
-    server->send(200, "application/json", response);
+    sendJson(200, doc);
 }
 
 // 服务器设置相关API处理函数
@@ -2822,7 +3611,8 @@ void WebServerManager::handleServerSettingsPage() {
 void WebServerManager::handleGetServerConfig() {
     printf("处理获取服务器配置请求\n");
     
-    DynamicJsonDocument doc(512);
+    PSRAMArenaScope arena(m_psramManager);
+    ArenaJsonDocument doc(512, arena.jsonAllocator());
     
     if (configStorage) {
         bool hasConfig = configStorage->hasServerConfigAsync(3000);
@@ -2874,23 +3664,20 @@ void WebServerManager::handleGetServerConfig() {
         printf("配置存储未初始化\n");
     }
     
-    String response;
-    serializeJson(doc, response);
-    server->send(200, "application/json", response);
+    sendJson(200, doc);
 }
 
 void WebServerManager::handleSetServerConfig() {
     printf("处理设置服务器配置请求\n");
     
-    DynamicJsonDocument doc(256);
+    PSRAMArenaScope arena(m_psramManager);
+    ArenaJsonDocument doc(256, arena.jsonAllocator());
     
     if (!configStorage) {
         doc["success"] = false;
         doc["message"] = "配置存储未初始化";
         printf("配置存储未初始化\n");
-        String response;
-        serializeJson(doc, response);
-        server->send(400, "application/json", response);
+        sendJson(400, doc);
         return;
     }
     
@@ -2899,9 +3686,7 @@ void WebServerManager::handleSetServerConfig() {
         doc["success"] = false;
         doc["message"] = "缺少serverUrl参数";
         printf("缺少serverUrl参数\n");
-        String response;
-        serializeJson(doc, response);
-        server->send(400, "application/json", response);
+        sendJson(400, doc);
         return;
     }
     
@@ -2923,9 +3708,7 @@ void WebServerManager::handleSetServerConfig() {
         doc["success"] = false;
         doc["message"] = "无效的服务器URL";
         printf("无效的服务器URL: %s\n", serverUrl.c_str());
-        String response;
-        serializeJson(doc, response);
-        server->send(400, "application/json", response);
+        sendJson(400, doc);
         return;
     }
     
@@ -2933,9 +3716,7 @@ void WebServerManager::handleSetServerConfig() {
         doc["success"] = false;
         doc["message"] = "请求间隔必须在100-1000毫秒之间";
         printf("无效的请求间隔: %d\n", requestInterval);
-        String response;
-        serializeJson(doc, response);
-        server->send(400, "application/json", response);
+        sendJson(400, doc);
         return;
     }
     
@@ -2943,9 +3724,7 @@ void WebServerManager::handleSetServerConfig() {
         doc["success"] = false;
         doc["message"] = "连接超时时间必须在1000-60000毫秒之间";
         printf("无效的连接超时时间: %d\n", connectionTimeout);
-        String response;
-        serializeJson(doc, response);
-        server->send(400, "application/json", response);
+        sendJson(400, doc);
         return;
     }
     
@@ -2961,23 +3740,20 @@ void WebServerManager::handleSetServerConfig() {
         printf("服务器配置保存失败\n");
     }
     
-    String response;
-    serializeJson(doc, response);
-    server->send(200, "application/json", response);
+    sendJson(200, doc);
 }
 
 void WebServerManager::handleTestServerConnection() {
     printf("处理测试服务器连接请求\n");
     
-    DynamicJsonDocument doc(512);
+    PSRAMArenaScope arena(m_psramManager);
+    ArenaJsonDocument doc(512, arena.jsonAllocator());
     
     if (!wifiManager->isConnected()) {
         doc["success"] = false;
         doc["message"] = "设备未连接WiFi，无法测试服务器连接";
         printf("设备未连接WiFi，无法测试服务器连接\n");
-        String response;
-        serializeJson(doc, response);
-        server->send(400, "application/json", response);
+        sendJson(400, doc);
         return;
     }
     
@@ -3028,7 +3804,7 @@ void WebServerManager::handleTestServerConnection() {
         doc["responseSize"] = payload.length();
         
         // 尝试解析JSON响应
-        DynamicJsonDocument responseDoc(1024);
+        ArenaJsonDocument responseDoc(1024, arena.jsonAllocator());
         if (deserializeJson(responseDoc, payload) == DeserializationError::Ok) {
             doc["responseValid"] = true;
             doc["responseData"] = responseDoc;
@@ -3049,23 +3825,20 @@ void WebServerManager::handleTestServerConnection() {
     
     http.end();
     
-    String response;
-    serializeJson(doc, response);
-    server->send(200, "application/json", response);
+    sendJson(200, doc);
 }
 
 void WebServerManager::handleGetServerData() {
     printf("处理获取服务器数据请求\n");
     
-    DynamicJsonDocument doc(1024);
+    PSRAMArenaScope arena(m_psramManager);
+    ArenaJsonDocument doc(1024, arena.jsonAllocator());
     
     if (!wifiManager->isConnected()) {
         doc["success"] = false;
         doc["message"] = "设备未连接WiFi，无法获取服务器数据";
         printf("设备未连接WiFi，无法获取服务器数据\n");
-        String response;
-        serializeJson(doc, response);
-        server->send(400, "application/json", response);
+        sendJson(400, doc);
         return;
     }
     
@@ -3110,7 +3883,7 @@ void WebServerManager::handleGetServerData() {
         String payload = http.getString();
         
         // 尝试解析JSON响应
-        DynamicJsonDocument responseDoc(1024);
+        ArenaJsonDocument responseDoc(1024, arena.jsonAllocator());
         if (deserializeJson(responseDoc, payload) == DeserializationError::Ok) {
             doc["success"] = true;
             doc["message"] = "服务器数据获取成功";
@@ -3139,23 +3912,20 @@ void WebServerManager::handleGetServerData() {
     
     http.end();
     
-    String response;
-    serializeJson(doc, response);
-    server->send(200, "application/json", response);
+    sendJson(200, doc);
 }
 
 void WebServerManager::handleMDNSScanServers() {
     printf("处理mDNS扫描服务器请求\n");
     
-    DynamicJsonDocument doc(2048);
+    PSRAMArenaScope arena(m_psramManager);
+    ArenaJsonDocument doc(2048, arena.jsonAllocator());
     
     if (!wifiManager->isConnected()) {
         doc["success"] = false;
         doc["message"] = "设备未连接WiFi，无法进行mDNS扫描";
         printf("设备未连接WiFi，无法进行mDNS扫描\n");
-        String response;
-        serializeJson(doc, response);
-        server->send(400, "application/json", response);
+        sendJson(400, doc);
         return;
     }
     
@@ -3205,9 +3975,7 @@ void WebServerManager::handleMDNSScanServers() {
         printf("小电拼扫描完成，发现 %d 个设备\n", deviceArray.size());
     }
     
-    String response;
-    serializeJson(doc, response);
-    server->send(200, "application/json", response);
+    sendJson(200, doc);
 }
 
 // 定位相关API处理函数
@@ -3221,7 +3989,8 @@ void WebServerManager::handleGetLocationData() {
     
     LocationData locationData = m_locationManager->getCurrentLocation();
     
-    DynamicJsonDocument doc(1024);
+    PSRAMArenaScope arena(m_psramManager);
+    ArenaJsonDocument doc(1024, arena.jsonAllocator());
     doc["success"] = true;
     
     if (locationData.isValid) {
@@ -3240,9 +4009,7 @@ void WebServerManager::handleGetLocationData() {
         doc["message"] = "暂无有效的定位数据";
     }
     
-    String response;
-    serializeJson(doc, response);
-    server->send(200, "application/json", response);
+    sendJson(200, doc);
 }
 
 void WebServerManager::handleSetLocationApiKey() {
@@ -3285,7 +4052,8 @@ void WebServerManager::handleLocationNow() {
         
         LocationData locationData = m_locationManager->getCurrentLocation();
         
-        DynamicJsonDocument doc(1024);
+        PSRAMArenaScope arena(m_psramManager);
+        ArenaJsonDocument doc(1024, arena.jsonAllocator());
         doc["success"] = true;
         
         if (locationData.isValid) {
@@ -3328,9 +4096,7 @@ void WebServerManager::handleLocationNow() {
             doc["message"] = "定位请求已发送，请稍后查看结果";
         }
         
-        String response;
-        serializeJson(doc, response);
-        server->send(200, "application/json", response);
+        sendJson(200, doc);
         
         printf("定位请求处理完成\n");
     } else {
@@ -66,6 +66,9 @@ private:
     // 静态任务函数
     static void serverTask(void* parameter);
     
+    // 把JSON文档序列化到当前任务的临时内存区后发送（不构造响应String）
+    void sendJson(int code, const JsonDocument& doc);
+    
     // HTTP处理函数
     void handleRoot();
     void handleWiFiConfig();
@@ -152,9 +155,39 @@ private:
     void handleSetScreenSettings();
     void handleGetCurrentRotation();
     
+    // 显示缓冲区相关API
+    void handleGetDisplayBuffer();
+    void handleSetDisplayBuffer();
+    void handleDisplayBenchmark();
+    void handleGetDisplayPerf();
+    void handleResetDisplayPerf();
+    void handleSetDisplayPerfOverlay();
+    void handleSetDisplayAreaMerge();
+    void handleGetDisplayPower();
+    void handleSetDisplayPower();
+    void handleGetDisplayScreens();
+    void handleSetDisplayScreens();
+    void handleGetPowerTrend();
+    void handleSetPowerTrend();
+    void handleMirrorPage();
+    void handleGetScreenMirror();
+    void handleSetScreenMirror();
+    
+    // UI资源包相关API
+    void handleGetAssets();
+    void handleSetAssetPack();
+    void handleSetAssetCache();
+    
     // 主题设置相关API
     void handleGetThemeSettings();
     void handleSetThemeSettings();
+    void handleGetThemeSoak();
+    void handleStartThemeSoak();
+    
+    // 内存剖析相关API
+    void handleGetMemoryProfile();
+    void handleGetMemoryProfileDump();
+    void handleSetMemoryProfile();
     
     // 获取主页HTML
     String getIndexHTML();
@@ -215,6 +248,9 @@ private:
     
     // 获取屏幕设置页面JavaScript代码
     String getScreenSettingsJavaScript();
+    
+    // 获取屏幕镜像页面HTML
+    String getMirrorHTML();
 };
 
 #endif // WEBSERVERMANAGER_H 
\ No newline at end of file
@@ -0,0 +1,217 @@
+/*
+ * WebServerManager_Mirror.cpp - Web服务器屏幕镜像页面实现
+ * ESP32S3监控项目 - 远程屏幕镜像模块
+ */
+
+#include "WebServerManager.h"
+#include "ScreenMirror.h"
+
+String WebServerManager::getMirrorHTML() {
+    String html = "<!DOCTYPE html>\n";
+    html += "<html lang=\"zh-CN\">\n";
+    html += "<head>\n";
+    html += "    <meta charset=\"UTF-8\">\n";
+    html += "    <meta name=\"viewport\" content=\"width=device-width, initial-scale=1.0\">\n";
+    html += "    <title>屏幕镜像 - ESP32S3 Monitor</title>\n";
+    html += "    <style>\n";
+    html += getCSS();
+    html += R"(
+        .mirror-view {
+            display: flex;
+            justify-content: center;
+            align-items: center;
+            min-height: 480px;
+            background: #111827;
+            border-radius: 12px;
+            padding: 16px;
+        }
+        #mirrorCanvas {
+            image-rendering: pixelated;
+            transition: transform 0.3s ease;
+            box-shadow: 0 8px 24px rgba(0, 0, 0, 0.4);
+        }
+        .mirror-status {
+            margin: 12px 0;
+            color: #4b5563;
+            font-size: 0.95rem;
+        }
+        .mirror-actions button {
+            margin-right: 8px;
+        }
+)";
+    html += "    </style>\n";
+    html += "</head>\n";
+    html += "<body>\n";
+    html += "    <div class=\"container\">\n";
+    html += "        <header class=\"header\">\n";
+    html += "            <h1>屏幕镜像</h1>\n";
+    html += "            <div class=\"subtitle\">实时查看设备屏幕</div>\n";
+    html += "        </header>\n";
+    html += "        \n";
+    html += "        <div class=\"card\">\n";
+    html += "            <button onclick=\"window.location.href='/'\" class=\"back-home-btn\">\n";
+    html += "                返回首页\n";
+    html += "            </button>\n";
+    html += "            <div class=\"mirror-status\" id=\"mirrorStatus\">正在连接...</div>\n";
+    html += "            <div class=\"mirror-actions\">\n";
+    html += "                <button class=\"primary-btn\" onclick=\"requestRefresh()\">整屏刷新</button>\n";
+    html += "                <button class=\"primary-btn\" onclick=\"rotateView()\">旋转视图</button>\n";
+    html += "            </div>\n";
+    html += "            <div class=\"mirror-view\">\n";
+    html += "                <canvas id=\"mirrorCanvas\" width=\"368\" height=\"448\"></canvas>\n";
+    html += "            </div>\n";
+    html += "        </div>\n";
+    html += "    </div>\n";
+    html += "    \n";
+    html += "    <script>\n";
+    html += "        const MIRROR_PORT = " + String(SCREEN_MIRROR_PORT) + ";\n";
+    html += R"(
+        // 记录格式见ScreenMirror.h：20字节小端序记录头 + RLE像素数据，记录按4字节对齐
+        const canvas = document.getElementById('mirrorCanvas');
+        const ctx = canvas.getContext('2d');
+        const statusEl = document.getElementById('mirrorStatus');
+        let ws = null;
+        let frame = null;
+        let swap = 1;
+        let rotation = 0;
+        let userRotation = 0;
+        let dirty = null;
+        let frames = 0;
+        let bytes = 0;
+        let lastStatus = performance.now();
+
+        function connect() {
+            ws = new WebSocket('ws://' + location.hostname + ':' + MIRROR_PORT + '/');
+            ws.binaryType = 'arraybuffer';
+            ws.onmessage = (ev) => {
+                if (typeof ev.data === 'string') {
+                    const hello = JSON.parse(ev.data);
+                    canvas.width = hello.w;
+                    canvas.height = hello.h;
+                    swap = hello.swap;
+                    frame = ctx.createImageData(hello.w, hello.h);
+                    return;
+                }
+                bytes += ev.data.byteLength;
+                handleRecords(new DataView(ev.data));
+            };
+            ws.onopen = () => { statusEl.textContent = '已连接'; };
+            ws.onclose = () => {
+                statusEl.textContent = '连接已断开，3秒后重连...';
+                setTimeout(connect, 3000);
+            };
+        }
+
+        function handleRecords(view) {
+            let off = 0;
+            while (off + 20 <= view.byteLength) {
+                const x = view.getUint16(off, true);
+                const y = view.getUint16(off + 2, true);
+                const w = view.getUint16(off + 4, true);
+                const h = view.getUint16(off + 6, true);
+                const flags = view.getUint8(off + 12);
+                const rot = view.getUint8(off + 13);
+                const len = view.getUint32(off + 16, true);
+                decodeRLE(view, off + 20, len, x, y, w, h);
+                markDirty(x, y, w, h);
+                if (flags & 1) {
+                    present(rot);
+                }
+                off += (20 + len + 3) & ~3;
+            }
+        }
+
+        function decodeRLE(view, start, len, x, y, w, h) {
+            if (!frame) {
+                return;
+            }
+            const data = frame.data;
+            const stride = frame.width;
+            const end = start + len;
+            let p = start;
+            let px = 0;
+            let row = 0;
+            const put = (v) => {
+                const i = ((y + row) * stride + x + px) * 4;
+                data[i] = ((v >> 11) & 0x1F) * 255 / 31;
+                data[i + 1] = ((v >> 5) & 0x3F) * 255 / 63;
+                data[i + 2] = (v & 0x1F) * 255 / 31;
+                data[i + 3] = 255;
+                if (++px === w) {
+                    px = 0;
+                    row++;
+                }
+            };
+            const read = () => {
+                const v = swap ? view.getUint16(p, false) : view.getUint16(p, true);
+                p += 2;
+                return v;
+            };
+            while (p < end && row < h) {
+                const ctrl = view.getUint8(p++);
+                const count = (ctrl & 0x7F) + 1;
+                if (ctrl & 0x80) {
+                    const v = read();
+                    for (let i = 0; i < count; i++) put(v);
+                } else {
+                    for (let i = 0; i < count; i++) put(read());
+                }
+            }
+        }
+
+        function markDirty(x, y, w, h) {
+            if (!dirty) {
+                dirty = { x1: x, y1: y, x2: x + w, y2: y + h };
+            } else {
+                dirty.x1 = Math.min(dirty.x1, x);
+                dirty.y1 = Math.min(dirty.y1, y);
+                dirty.x2 = Math.max(dirty.x2, x + w);
+                dirty.y2 = Math.max(dirty.y2, y + h);
+            }
+        }
+
+        function present(rot) {
+            if (frame && dirty) {
+                ctx.putImageData(frame, 0, 0, dirty.x1, dirty.y1, dirty.x2 - dirty.x1, dirty.y2 - dirty.y1);
+            }
+            dirty = null;
+            frames++;
+            if (rot !== rotation) {
+                rotation = rot;
+                applyRotation();
+            }
+            const now = performance.now();
+            if (now - lastStatus >= 1000) {
+                const sec = (now - lastStatus) / 1000;
+                statusEl.textContent = '已连接 · ' + (frames / sec).toFixed(1) + ' FPS · ' +
+                    (bytes / 1024 / sec).toFixed(1) + ' KB/s';
+                frames = 0;
+                bytes = 0;
+                lastStatus = now;
+            }
+        }
+
+        function applyRotation() {
+            // LVGL软件旋转时记录为面板坐标，反向旋转后显示为正向
+            canvas.style.transform = 'rotate(' + ((-rotation * 90 + userRotation) % 360) + 'deg)';
+        }
+
+        function rotateView() {
+            userRotation = (userRotation + 90) % 360;
+            applyRotation();
+        }
+
+        function requestRefresh() {
+            if (ws && ws.readyState === WebSocket.OPEN) {
+                ws.send('refresh');
+            }
+        }
+
+        connect();
+)";
+    html += "    </script>\n";
+    html += "</body>\n";
+    html += "</html>\n";
+
+    return html;
+}
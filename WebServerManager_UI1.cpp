@@ -214,6 +214,9 @@ String WebServerManager::getIndexHTML() {
     html += "                    <button onclick=\"window.location.href='/screen-settings'\" class=\"settings-btn\">\n";
     html += "                        屏幕设置\n";
     html += "                    </button>\n";
+    html += "                    <button onclick=\"window.location.href='/mirror'\" class=\"settings-btn\">\n";
+    html += "                        屏幕镜像\n";
+    html += "                    </button>\n";
     html += "                    <button onclick=\"window.location.href='/files'\" class=\"files-btn\">\n";
     html += "                        文件管理器\n";
     html += "                    </button>\n";
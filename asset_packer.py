@@ -0,0 +1,176 @@
+#!/usr/bin/env python3
+"""
+UI资源包打包工具
+把SquareLine导出的图片源文件和lv_font_conv生成的二进制字体打包为资源包（.uap），
+上传到SPIFFS后由固件中的AssetManager在运行时加载，替换同名的内置图片和字体。
+
+用法：
+    python3 asset_packer.py -o dark.uap ui_img_52731097.c ui_img_411710101.c
+    python3 asset_packer.py -o dark.uap ui_img_52731097=new/ui_img_123456.c ui_font_DaoLiti72=DaoLiti72.bin
+    python3 asset_packer.py --list dark.uap
+
+    条目名默认取图片源文件中的变量名，或字体文件名（不含扩展名）；
+    用"名称=文件"可以让新图片/字体替换指定的内置资源（名称需与ui.h/ui2.h中的声明一致）。
+    字体需用lv_font_conv以--format bin生成，例如：
+    lv_font_conv --font xxx.ttf --size 72 --bpp 4 -r 0x20-0x7f --format bin -o DaoLiti72.bin
+
+    生成的资源包通过Web文件管理上传（如/themes/dark.uap），再调用
+    POST /api/assets/pack?path=/themes/dark.uap 启用。
+
+资源包格式（小端）：
+    文件头16字节：  'U' 'I' 'A' 'P'，uint16 版本号(1)，uint16 条目数，uint32 数据区偏移，uint32 保留
+    条目表：        每项52字节
+                    char[32] 名称（以0结尾），uint8 类型（1=图片，2=字体），uint8 格式，uint16 保留，
+                    uint16 宽，uint16 高，uint32 数据偏移（相对文件起点），uint32 数据大小，uint32 CRC32
+    数据区：        各条目数据，按4字节对齐
+    图片格式：      0=TRUE_COLOR（RGB565），1=TRUE_COLOR_ALPHA（RGB565+A8），2=RLE（image_compressor.py格式）
+    字体格式：      0=lv_font_conv二进制字体
+"""
+
+import os
+import struct
+import sys
+import zlib
+
+from image_compressor import parse_image_file, encode_rle, format_size
+
+PACK_MAGIC = b'UIAP'
+PACK_VERSION = 1
+HEADER_FORMAT = '<4sHHII'
+ENTRY_FORMAT = '<32sBBHHHIII'
+NAME_MAX = 31
+
+ASSET_TYPE_IMAGE = 1
+ASSET_TYPE_FONT = 2
+
+IMAGE_FORMAT_NAMES = {0: 'TRUE_COLOR', 1: 'TRUE_COLOR_ALPHA', 2: 'RLE'}
+
+def load_image(filename):
+    """读取图片源文件，返回(变量名, 格式, 宽, 高, 数据)"""
+    with open(filename, 'r', encoding='utf-8') as f:
+        image = parse_image_file(f.read())
+    if not image:
+        raise ValueError(f"{filename}: 无法解析图片源文件")
+
+    width, height, data, cf = image['width'], image['height'], image['data'], image['cf']
+
+    if cf == 'LV_IMG_CF_USER_ENCODED_0':
+        return image['name'], 2, width, height, data
+
+    if cf == 'LV_IMG_CF_TRUE_COLOR_ALPHA':
+        if len(data) != width * height * 3:
+            raise ValueError(f"{filename}: 数据长度与16位色深TRUE_COLOR_ALPHA不符")
+        if any(data[i] != 0xFF for i in range(2, len(data), 3)):
+            return image['name'], 1, width, height, data
+        # 完全不透明，去掉alpha通道
+        rgb565 = b''.join(data[i:i + 2] for i in range(0, len(data), 3))
+    elif cf == 'LV_IMG_CF_TRUE_COLOR':
+        rgb565 = data
+        if len(rgb565) != width * height * 2:
+            raise ValueError(f"{filename}: 数据长度与16位色深TRUE_COLOR不符")
+    else:
+        raise ValueError(f"{filename}: 不支持的颜色格式{cf}")
+
+    blob = encode_rle(width, height, rgb565)
+    if len(blob) < len(rgb565):
+        return image['name'], 2, width, height, blob
+    return image['name'], 0, width, height, rgb565
+
+def load_font(filename):
+    """读取lv_font_conv二进制字体"""
+    with open(filename, 'rb') as f:
+        data = f.read()
+    if len(data) < 8 or data[4:8] != b'head':
+        raise ValueError(f"{filename}: 不是lv_font_conv二进制字体（需要--format bin）")
+    return data
+
+def build_pack(output, specs):
+    """根据"名称=文件"或"文件"列表生成资源包"""
+    entries = []
+    for spec in specs:
+        name, _, filename = spec.rpartition('=')
+
+        if filename.endswith('.c'):
+            symbol, fmt, width, height, data = load_image(filename)
+            entries.append([name or symbol, ASSET_TYPE_IMAGE, fmt, width, height, data])
+            print(f"🖼️  {name or symbol}: {filename} {width}x{height} {IMAGE_FORMAT_NAMES[fmt]} {format_size(len(data))}")
+        elif filename.endswith('.bin'):
+            data = load_font(filename)
+            font_name = name or os.path.splitext(os.path.basename(filename))[0]
+            entries.append([font_name, ASSET_TYPE_FONT, 0, 0, 0, data])
+            print(f"🔤 {font_name}: {filename} {format_size(len(data))}")
+        else:
+            raise ValueError(f"{filename}: 只支持图片源文件(.c)和二进制字体(.bin)")
+
+    names = [e[0] for e in entries]
+    for name in names:
+        if len(name.encode('utf-8')) > NAME_MAX:
+            raise ValueError(f"条目名过长（最多{NAME_MAX}字节）：{name}")
+        if names.count(name) > 1:
+            raise ValueError(f"条目名重复：{name}")
+
+    header_size = struct.calcsize(HEADER_FORMAT)
+    entry_size = struct.calcsize(ENTRY_FORMAT)
+    data_offset = header_size + entry_size * len(entries)
+    data_offset = (data_offset + 3) & ~3
+
+    table = bytearray()
+    body = bytearray()
+    for name, asset_type, fmt, width, height, data in entries:
+        offset = data_offset + len(body)
+        table += struct.pack(ENTRY_FORMAT, name.encode('utf-8'), asset_type, fmt, 0,
+                             width, height, offset, len(data), zlib.crc32(data) & 0xFFFFFFFF)
+        body += data
+        body += b'\x00' * (-len(body) % 4)
+
+    header = struct.pack(HEADER_FORMAT, PACK_MAGIC, PACK_VERSION, len(entries), data_offset, 0)
+    blob = header + table
+    blob += b'\x00' * (data_offset - len(blob))
+    blob += body
+
+    with open(output, 'wb') as f:
+        f.write(blob)
+
+    print("-" * 50)
+    print(f"✅ {output}: {len(entries)}个条目，{format_size(len(blob))}")
+
+def list_pack(filename):
+    """列出资源包内容并校验CRC"""
+    with open(filename, 'rb') as f:
+        blob = f.read()
+
+    magic, version, count, data_offset, _ = struct.unpack_from(HEADER_FORMAT, blob, 0)
+    if magic != PACK_MAGIC or version != PACK_VERSION:
+        raise ValueError(f"{filename}: 不是资源包或版本不支持")
+
+    print(f"📦 {filename}: {count}个条目，{format_size(len(blob))}")
+    header_size = struct.calcsize(HEADER_FORMAT)
+    entry_size = struct.calcsize(ENTRY_FORMAT)
+    for i in range(count):
+        raw_name, asset_type, fmt, _, width, height, offset, size, crc = \
+            struct.unpack_from(ENTRY_FORMAT, blob, header_size + i * entry_size)
+        name = raw_name.rstrip(b'\x00').decode('utf-8')
+        ok = zlib.crc32(blob[offset:offset + size]) & 0xFFFFFFFF == crc
+        if asset_type == ASSET_TYPE_IMAGE:
+            desc = f"图片 {width}x{height} {IMAGE_FORMAT_NAMES.get(fmt, fmt)}"
+        else:
+            desc = "字体"
+        print(f"  {'✅' if ok else '❌'} {name}: {desc} {format_size(size)}")
+
+if __name__ == "__main__":
+    args = sys.argv[1:]
+
+    print("📦 UI资源包打包工具")
+    print("=" * 50)
+
+    try:
+        if args and args[0] == '--list' and len(args) == 2:
+            list_pack(args[1])
+        elif len(args) >= 3 and args[0] == '-o':
+            build_pack(args[1], args[2:])
+        else:
+            print(__doc__)
+            sys.exit(1)
+    except (OSError, ValueError) as e:
+        print(f"❌ {e}")
+        sys.exit(1)
@@ -61,6 +61,8 @@ typedef struct {
     int reset_gpio_num;                      // 复位GPIO引脚号
     int x_gap;                               // X轴偏移量
     int y_gap;                               // Y轴偏移量
+    int caset_x_start;                       // 上次CASET列起始地址（-1表示未知）
+    int caset_x_end;                         // 上次CASET列结束地址
     uint8_t fb_bits_per_pixel;               // 帧缓冲区每像素位数
     uint8_t madctl_val;                      // MADCTL寄存器当前值（内存访问控制）
     uint8_t colmod_val;                      // COLMOD寄存器当前值（像素格式）
@@ -141,6 +143,7 @@ esp_err_t esp_lcd_new_panel_sh8601(const esp_lcd_panel_io_handle_t io, const esp
     sh8601->io = io;
     sh8601->reset_gpio_num = panel_dev_config->reset_gpio_num;
     sh8601->fb_bits_per_pixel = fb_bits_per_pixel;
+    sh8601->caset_x_start = -1;  // 列地址窗口未知，首次绘制时发送CASET
     
     // 处理厂商特定配置
     sh8601_vendor_config_t *vendor_config = (sh8601_vendor_config_t *)panel_dev_config->vendor_config;
@@ -270,6 +273,7 @@ static esp_err_t panel_sh8601_reset(esp_lcd_panel_t *panel)
         ESP_RETURN_ON_ERROR(tx_param(sh8601, io, LCD_CMD_SWRESET, NULL, 0), TAG, "发送复位命令失败");
         vTaskDelay(pdMS_TO_TICKS(80));  // 等待80ms复位完成
     }
+    sh8601->caset_x_start = -1;  // 复位后列地址窗口未知
 
     return ESP_OK;
 }
@@ -355,6 +359,7 @@ static esp_err_t panel_sh8601_init(esp_lcd_panel_t *panel)
                             "发送初始化命令失败");
         vTaskDelay(pdMS_TO_TICKS(init_cmds[i].delay_ms));  // 按要求延迟
     }
+    sh8601->caset_x_start = -1;  // 初始化命令可能修改列地址窗口
     ESP_LOGD(TAG, "发送初始化命令成功");
 
     return ESP_OK;
@@ -364,7 +369,7 @@ static esp_err_t panel_sh8601_init(esp_lcd_panel_t *panel)
  * @brief 在LCD面板上绘制位图
  * 
  * 该函数将像素数据写入LCD的指定区域。步骤包括：
- * 1. 设置列地址范围（CASET命令）
+ * 1. 设置列地址范围（CASET命令，与上次列范围相同时跳过）
  * 2. 设置行地址范围（RASET命令）
  * 3. 写入像素数据（RAMWR命令）
  * 
@@ -389,12 +394,17 @@ static esp_err_t panel_sh8601_draw_bitmap(esp_lcd_panel_t *panel, int x_start, i
     y_end += sh8601->y_gap;
 
     // === 1. 设置列地址范围（X坐标范围）===
-    ESP_RETURN_ON_ERROR(tx_param(sh8601, io, LCD_CMD_CASET, (uint8_t[]) {
-        (x_start >> 8) & 0xFF,    // X起始坐标高字节
-        x_start & 0xFF,           // X起始坐标低字节
-        ((x_end - 1) >> 8) & 0xFF, // X结束坐标高字节
-        (x_end - 1) & 0xFF,       // X结束坐标低字节
-    }, 4), TAG, "发送列地址设置命令失败");
+    // 列地址窗口在RAMWR后保持不变，分块刷新同一列范围时可省去一次命令往返
+    if (x_start != sh8601->caset_x_start || x_end != sh8601->caset_x_end) {
+        ESP_RETURN_ON_ERROR(tx_param(sh8601, io, LCD_CMD_CASET, (uint8_t[]) {
+            (x_start >> 8) & 0xFF,    // X起始坐标高字节
+            x_start & 0xFF,           // X起始坐标低字节
+            ((x_end - 1) >> 8) & 0xFF, // X结束坐标高字节
+            (x_end - 1) & 0xFF,       // X结束坐标低字节
+        }, 4), TAG, "发送列地址设置命令失败");
+        sh8601->caset_x_start = x_start;
+        sh8601->caset_x_end = x_end;
+    }
     
     // === 2. 设置行地址范围（Y坐标范围）===
     ESP_RETURN_ON_ERROR(tx_param(sh8601, io, LCD_CMD_RASET, (uint8_t[]) {
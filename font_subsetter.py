@@ -0,0 +1,640 @@
+#!/usr/bin/env python3
+"""
+SquareLine字体子集化工具
+扫描UI源文件和运行时代码中实际显示的字符，把ui_font_*.c / ui2_font_*.c裁剪为只含用到的字形，
+可选把字形位图压缩存储（LVGL内置的RLE + 行异或预滤波格式）。
+
+每次从SquareLine Studio重新导出UI后运行一次：
+    python3 font_subsetter.py              # 子集化当前目录下所有字体
+    python3 font_subsetter.py --check      # 只统计，不修改文件
+    python3 font_subsetter.py --compress   # 子集化并压缩位图（需要lv_conf.h中LV_USE_FONT_COMPRESSED=1）
+
+字符收集规则：
+    1. UI源文件中通过lv_obj_set_style_text_font为标签指定字体，标签的初始文本计入该字体
+    2. 运行时代码中对这些标签的lv_label_set_text/lv_label_set_text_fmt调用：
+       - 字符串字面量（含三目运算符两侧）直接计入
+       - 由snprintf/sprintf/strftime写入的缓冲区，按格式串展开（%d→数字和负号，%.1f→数字、小数点和负号，
+         %H:%M:%S→数字和冒号等）
+       - 由字面量赋值或字面量数组（如星期表）给出的字符串变量，计入全部候选
+       - 通过局部指针（如state_label = ui_port1state）间接更新的标签按全部候选标签计入
+    3. 内容无法静态确定的标签（%s、协议名、网络下发的天气文字等）所用字体保持完整，不做裁剪
+    4. 字体设置在非标签对象上（会被子对象继承）时保持完整
+    5. EXTRA_GLYPHS中可以为字体手动追加字符
+    6. 运行时代码中对字体变量取地址（&ui_font_*）视为用它显示任意文本，字体保持完整；
+       只按名称登记字体、不显示文本的表放在 // font_subsetter: skip-begin 和 // font_subsetter: skip-end 之间
+"""
+
+import glob
+import re
+import sys
+
+# 手动追加的字符（字体名 -> 字符串），用于静态扫描无法发现的文本
+EXTRA_GLYPHS = {
+}
+
+UI_SOURCE_PATTERNS = ['ui_*.c', 'ui2_*.c']
+RUNTIME_SOURCE_PATTERNS = ['*.cpp']
+FONT_PATTERNS = ['ui_font_*.c', 'ui2_font_*.c']
+
+DIGITS = '0123456789'
+UNKNOWN = None  # 内容无法静态确定
+
+STRING_LITERAL = r'"(?:[^"\\]|\\.)*"'
+
+# 运行时代码中跳过字体引用扫描的区域（如AssetManager的内置字体表）
+SKIP_REGION = re.compile(r'//\s*font_subsetter:\s*skip-begin.*?//\s*font_subsetter:\s*skip-end', re.S)
+
+def format_size(size_bytes):
+    """格式化大小显示"""
+    if size_bytes >= 1024 * 1024:
+        return f"{size_bytes / (1024 * 1024):.1f}MB"
+    elif size_bytes >= 1024:
+        return f"{size_bytes / 1024:.1f}KB"
+    else:
+        return f"{size_bytes}B"
+
+def read_text(filename):
+    with open(filename, 'r', encoding='utf-8', errors='surrogateescape') as f:
+        return f.read()
+
+def unescape_literal(literal):
+    """把C字符串字面量（含引号）转换为实际字符"""
+    body = literal[1:-1]
+    escapes = {'n': '\n', 't': '\t', '\\': '\\', '"': '"', "'": "'", '0': ''}
+    out = []
+    i = 0
+    while i < len(body):
+        c = body[i]
+        if c == '\\' and i + 1 < len(body):
+            out.append(escapes.get(body[i + 1], body[i + 1]))
+            i += 2
+        else:
+            out.append(c)
+            i += 1
+    return ''.join(out)
+
+def literal_chars(text):
+    """提取文本中所有字符串字面量的字符（相邻字面量自动拼接）"""
+    return ''.join(unescape_literal(m) for m in re.findall(STRING_LITERAL, text))
+
+# === 格式串展开 ===
+
+PRINTF_SPEC = re.compile(r'%([-+ #0]*)(\d+|\*)?(?:\.(\d+|\*))?(hh|h|ll|l|L|z|j|t)?([diouxXeEfFgGcspn%])')
+STRFTIME_SPEC = re.compile(r'%[EO]?([a-zA-Z%])')
+
+STRFTIME_CHARS = {
+    'H': DIGITS, 'I': DIGITS, 'M': DIGITS, 'S': DIGITS, 'm': DIGITS, 'd': DIGITS,
+    'y': DIGITS, 'Y': DIGITS, 'j': DIGITS, 'C': DIGITS, 'u': DIGITS, 'w': DIGITS,
+    'U': DIGITS, 'W': DIGITS, 'G': DIGITS, 'g': DIGITS, 'V': DIGITS, 'e': DIGITS + ' ',
+    'D': DIGITS + '/', 'T': DIGITS + ':', 'R': DIGITS + ':', 'F': DIGITS + '-',
+    'n': '\n', 't': '\t', '%': '%',
+}
+
+def expand_printf(fmt):
+    """展开printf格式串可能输出的字符，含%s/%c等无法确定的转换时返回UNKNOWN"""
+    chars = set(PRINTF_SPEC.sub('', fmt))
+    for flags, width, _, _, conv in PRINTF_SPEC.findall(fmt):
+        if conv in 'csp':
+            return UNKNOWN
+        if conv == '%':
+            chars.add('%')
+            continue
+        if conv == 'n':
+            continue
+        if width and '0' not in flags:
+            chars.add(' ')
+        if '+' in flags:
+            chars.add('+')
+        if ' ' in flags:
+            chars.add(' ')
+        if conv in 'di':
+            chars.update(DIGITS + '-')
+        elif conv == 'u':
+            chars.update(DIGITS)
+        elif conv == 'o':
+            chars.update('01234567')
+        elif conv == 'x':
+            chars.update(DIGITS + 'abcdef')
+        elif conv == 'X':
+            chars.update(DIGITS + 'ABCDEF')
+        elif conv in 'fF':
+            chars.update(DIGITS + '.-')
+        else:  # e E g G
+            chars.update(DIGITS + '.-+eE')
+    return chars
+
+def expand_strftime(fmt):
+    """展开strftime格式串可能输出的字符，含星期/月份名称等时返回UNKNOWN"""
+    chars = set(STRFTIME_SPEC.sub('', fmt))
+    for conv in STRFTIME_SPEC.findall(fmt):
+        if conv not in STRFTIME_CHARS:
+            return UNKNOWN
+        chars.update(STRFTIME_CHARS[conv])
+    return chars
+
+def merge(a, b):
+    """合并两个字符集合，任一为UNKNOWN则结果为UNKNOWN"""
+    if a is UNKNOWN or b is UNKNOWN:
+        return UNKNOWN
+    return a | b
+
+# === UI源文件扫描 ===
+
+def scan_ui_sources():
+    """返回 (对象->字体, 标签集合, 标签->初始文本字符)"""
+    obj_font = {}
+    labels = set()
+    label_text = {}
+
+    files = []
+    for pattern in UI_SOURCE_PATTERNS:
+        files += [f for f in glob.glob(pattern) if '_font_' not in f and '_img_' not in f]
+
+    for filename in sorted(files):
+        text = read_text(filename)
+        for obj in re.findall(r'(\w+)\s*=\s*lv_label_create\(', text):
+            labels.add(obj)
+        for obj, font in re.findall(r'lv_obj_set_style_text_font\(\s*(\w+)\s*,\s*&(\w+)', text):
+            obj_font[obj] = font
+        for obj, literal in re.findall(r'lv_label_set_text\(\s*(\w+)\s*,\s*(' + STRING_LITERAL + r')\s*\)', text):
+            label_text.setdefault(obj, set()).update(unescape_literal(literal))
+
+    return obj_font, labels, label_text
+
+# === 运行时代码扫描 ===
+
+def split_functions(text):
+    """按列0开始的函数定义粗略切分源文件"""
+    starts = [m.start() for m in re.finditer(r'^[A-Za-z_][^\n;]*\)\s*(?:const\s*)?\{\s*$', text, re.M)]
+    starts.append(len(text))
+    return [text[starts[i]:starts[i + 1]] for i in range(len(starts) - 1)]
+
+def split_top_level(expr, sep):
+    """在括号外按分隔符切分表达式（跳过字符串字面量）"""
+    parts, depth, current, i = [], 0, '', 0
+    while i < len(expr):
+        m = re.match(STRING_LITERAL, expr[i:])
+        if m:
+            current += m.group(0)
+            i += len(m.group(0))
+            continue
+        c = expr[i]
+        if c in '([{':
+            depth += 1
+        elif c in ')]}':
+            depth -= 1
+        if c == sep and depth == 0:
+            parts.append(current)
+            current = ''
+        else:
+            current += c
+        i += 1
+    parts.append(current)
+    return parts
+
+def analyze_value(expr, string_vars):
+    """分析lv_label_set_text的文本参数，返回可能显示的字符集合或UNKNOWN"""
+    expr = expr.strip()
+
+    # 三目运算符：只分析两个取值分支
+    question = split_top_level(expr, '?')
+    if len(question) == 2:
+        branches = split_top_level(question[1], ':')
+        if len(branches) == 2:
+            return merge(analyze_value(branches[0], string_vars), analyze_value(branches[1], string_vars))
+        return UNKNOWN
+
+    if re.fullmatch(r'(?:' + STRING_LITERAL + r'\s*)+', expr):
+        return set(literal_chars(expr))
+
+    # 单个变量（可带下标），取其全部候选值
+    m = re.fullmatch(r'(\w+)\s*(?:\[[^\]]*\])?', expr)
+    if m and m.group(1) in string_vars:
+        return string_vars[m.group(1)]
+
+    return UNKNOWN
+
+def scan_function(body, obj_font, usage):
+    """扫描一个函数中的标签文本更新，结果累加到usage（对象 -> 字符集合或UNKNOWN）"""
+    # 局部指针别名：xxx_label = ui_port1state;
+    alias = {}
+    for local, target in re.findall(r'\b(\w+)\s*=\s*(ui2?_\w+)\s*;', body):
+        alias.setdefault(local, set()).add(target)
+
+    # 字符串变量的候选值
+    string_vars = {}
+
+    def add_var(name, chars):
+        string_vars[name] = merge(string_vars.get(name, set()), chars)
+
+    for name, literal in re.findall(r'\b(\w+)\s*=\s*(' + STRING_LITERAL + r')\s*;', body):
+        add_var(name, set(unescape_literal(literal)))
+    for name, items in re.findall(r'\b(\w+)\s*\[\s*\d*\s*\]\s*=\s*\{([^}]*)\}', body):
+        add_var(name, set(literal_chars(items)))
+    for name, fmt in re.findall(r'\bs?n?printf\(\s*(\w+)\s*,\s*(?:[^,"]+,\s*)?((?:' + STRING_LITERAL + r'\s*)+)', body):
+        add_var(name, expand_printf(literal_chars(fmt)))
+    for name, fmt in re.findall(r'\bstrftime\(\s*(\w+)\s*,\s*[^,]+,\s*((?:' + STRING_LITERAL + r'\s*)+)', body):
+        add_var(name, expand_strftime(literal_chars(fmt)))
+
+    for func, target, args in re.findall(r'\b(lv_label_set_text(?:_fmt)?)\(\s*([\w\.\->]+)\s*,\s*(.*?)\)\s*;', body):
+        if func == 'lv_label_set_text_fmt':
+            fmt = re.match(r'\s*((?:' + STRING_LITERAL + r'\s*)+)', args)
+            chars = expand_printf(literal_chars(fmt.group(1))) if fmt else UNKNOWN
+        else:
+            chars = analyze_value(args, string_vars)
+
+        targets = alias.get(target, {target})
+        for obj in targets:
+            usage[obj] = merge(usage.get(obj, set()), chars)
+
+def scan_runtime_sources(obj_font):
+    """返回运行时标签文本（对象 -> 字符集合或UNKNOWN）"""
+    usage = {}
+    files = []
+    for pattern in RUNTIME_SOURCE_PATTERNS:
+        files += glob.glob(pattern)
+
+    for filename in sorted(files):
+        text = read_text(filename)
+        # 运行时代码直接引用的字体，显示内容无法确定（标记区域内只登记名称，不显示文本）
+        for font in re.findall(r'&(ui2?_font_\w+)', SKIP_REGION.sub('', text)):
+            usage['&' + font] = UNKNOWN
+        if 'lv_label_set_text' not in text:
+            continue
+        for body in split_functions(text):
+            if 'lv_label_set_text' in body:
+                scan_function(body, obj_font, usage)
+
+    return usage
+
+def collect_font_usage():
+    """返回 字体名 -> 需要的字符集合（UNKNOWN表示保持完整）"""
+    obj_font, labels, label_text = scan_ui_sources()
+    runtime = scan_runtime_sources(obj_font)
+
+    font_chars = {}
+    for obj, font in obj_font.items():
+        if obj not in labels:
+            # 字体设置在容器上会被子对象继承，无法确定显示内容
+            chars = UNKNOWN
+        else:
+            chars = merge(label_text.get(obj, set()), runtime.get(obj, set()))
+        font_chars[font] = merge(font_chars.get(font, set()), chars)
+
+    for key, chars in runtime.items():
+        if key.startswith('&'):
+            font_chars[key[1:]] = UNKNOWN
+
+    for font, extra in EXTRA_GLYPHS.items():
+        if font in font_chars:
+            font_chars[font] = merge(font_chars[font], set(extra))
+
+    return font_chars
+
+# === 字体文件解析与重建 ===
+
+def parse_font(text):
+    """解析lv_font_conv生成的字体文件"""
+    bitmap_match = re.search(r'(static LV_ATTRIBUTE_LARGE_CONST const uint8_t glyph_bitmap\[\] = \{\n)(.*?)(\n\};)', text, re.S)
+    glyphs = []
+    for m in re.finditer(r'/\* U\+([0-9A-F]+) [^\n]*\*/\n(.*?)(?=\n\s*/\* U\+|\Z)', bitmap_match.group(2), re.S):
+        data = bytes(int(x, 16) for x in re.findall(r'0x([0-9a-fA-F]+)', m.group(2)))
+        glyphs.append({'cp': int(m.group(1), 16), 'comment': m.group(0).split('\n', 1)[0].strip(), 'data': data})
+
+    dsc_match = re.search(r'static const lv_font_fmt_txt_glyph_dsc_t glyph_dsc\[\] = \{\n(.*?)\n\};', text, re.S)
+    dsc_lines = [l for l in dsc_match.group(1).split('\n') if l.strip().startswith('{')]
+    dscs = []
+    for line in dsc_lines[1:]:
+        fields = dict(re.findall(r'\.(\w+) = (-?\d+)', line))
+        dscs.append({k: int(v) for k, v in fields.items()})
+
+    if len(dscs) != len(glyphs):
+        raise ValueError(f"字形描述数({len(dscs)})与位图数({len(glyphs)})不一致")
+
+    for g, d in zip(glyphs, dscs):
+        g['dsc'] = d
+
+    return {
+        'glyphs': glyphs,
+        'bpp': int(re.search(r'\.bpp = (\d+)', text).group(1)),
+        'bitmap_format': int(re.search(r'\.bitmap_format = (\d+)', text).group(1)),
+        'kern_classes': int(re.search(r'\.kern_classes = (\d+)', text).group(1)),
+    }
+
+def unpack_pixels(data, count, bpp):
+    """把按位紧密排列的位图展开为像素值列表"""
+    pixels = []
+    for i in range(count):
+        bit = i * bpp
+        byte = data[bit >> 3]
+        shift = 8 - (bit & 7) - bpp
+        pixels.append((byte >> shift) & ((1 << bpp) - 1))
+    return pixels
+
+class BitWriter:
+    def __init__(self):
+        self.bits = []
+
+    def write(self, value, length):
+        for i in range(length - 1, -1, -1):
+            self.bits.append((value >> i) & 1)
+
+    def to_bytes(self):
+        bits = self.bits + [0] * (-len(self.bits) % 8)
+        return bytes(int(''.join(map(str, bits[i:i + 8])), 2) for i in range(0, len(bits), 8))
+
+def compress_glyph(data, w, h, bpp):
+    """按LVGL的字形解压算法（RLE + 行异或预滤波，bitmap_format = 1）压缩一个字形
+
+    解压端状态机：单值状态读取bpp位，与上一个值相同则进入重复状态；重复状态每个像素读1位，
+    1表示重复，0表示后跟新值；连续10个重复后读6位计数器，计数器c表示再重复c-1次后读新值。
+    """
+    if w * h == 0:
+        return b''
+
+    pixels = unpack_pixels(data, w * h, bpp)
+    values = pixels[:w]
+    for y in range(1, h):
+        values += [pixels[y * w + x] ^ pixels[(y - 1) * w + x] for x in range(w)]
+
+    out = BitWriter()
+    state, prev, cnt, i, n = 'single', 0, 0, 0, len(values)
+    while i < n:
+        v = values[i]
+        if state == 'single':
+            out.write(v, bpp)
+            if i > 0 and v == prev:
+                state, cnt = 'repeat', 0
+            prev = v
+            i += 1
+        elif v == prev:
+            out.write(1, 1)
+            cnt += 1
+            i += 1
+            if cnt == 11:
+                run = 0
+                while i + run < n and values[i + run] == prev and run < 62:
+                    run += 1
+                out.write(run + 1, 6)
+                i += run
+                if i < n:
+                    # 计数器结束时读取的新值不触发重复状态
+                    out.write(values[i], bpp)
+                    prev = values[i]
+                    i += 1
+                state = 'single'
+        else:
+            out.write(0, 1)
+            out.write(v, bpp)
+            prev = v
+            i += 1
+            state = 'single'
+
+    return out.to_bytes()
+
+def decompress_glyph(data, w, h, bpp):
+    """LVGL字形解压算法的Python实现，用于校验压缩结果"""
+    padded = data + b'\x00\x00'
+    pos = [0]
+
+    def bits(length):
+        value = 0
+        for _ in range(length):
+            value = (value << 1) | ((padded[pos[0] >> 3] >> (7 - (pos[0] & 7))) & 1)
+            pos[0] += 1
+        return value
+
+    state, prev, cnt, out = 'single', 0, 0, []
+    for _ in range(w * h):
+        if state == 'single':
+            ret = bits(bpp)
+            if pos[0] != bpp and prev == ret:
+                cnt, state = 0, 'repeat'
+            prev = ret
+        elif state == 'repeat':
+            cnt += 1
+            if bits(1):
+                ret = prev
+                if cnt == 11:
+                    cnt = bits(6)
+                    if cnt:
+                        state = 'counter'
+                    else:
+                        ret = prev = bits(bpp)
+                        state = 'single'
+            else:
+                ret = prev = bits(bpp)
+                state = 'single'
+        else:
+            ret = prev
+            cnt -= 1
+            if cnt == 0:
+                ret = prev = bits(bpp)
+                state = 'single'
+        out.append(ret)
+
+    pixels = out[:w]
+    for y in range(1, h):
+        pixels += [out[y * w + x] ^ pixels[(y - 1) * w + x] for x in range(w)]
+    return pixels
+
+def format_bytes(data, indent='    ', per_line=8):
+    lines = []
+    for i in range(0, len(data), per_line):
+        lines.append(indent + ', '.join(f'0x{b:x}' for b in data[i:i + per_line]))
+    return ',\n'.join(lines)
+
+def build_cmaps(cps):
+    """按lv_font_conv的方式生成字符映射：连续区间用FORMAT0_TINY，其余合并为SPARSE_TINY"""
+    groups = []
+    for cp in cps:
+        if groups and cp == groups[-1][-1] + 1:
+            groups[-1].append(cp)
+        else:
+            groups.append([cp])
+
+    # 短的连续区间并入相邻的稀疏表
+    cmaps = []
+    for g in groups:
+        if len(g) >= 8:
+            cmaps.append({'type': 'range', 'cps': g})
+        elif cmaps and cmaps[-1]['type'] == 'sparse' and g[-1] - cmaps[-1]['cps'][0] < 0x10000:
+            cmaps[-1]['cps'] += g
+        else:
+            cmaps.append({'type': 'sparse', 'cps': list(g)})
+
+    lists, entries, glyph_id = [], [], 1
+    for index, cmap in enumerate(cmaps):
+        cps_in = cmap['cps']
+        start = cps_in[0]
+        if cmap['type'] == 'range':
+            entries.append(f"    {{\n        .range_start = {start}, .range_length = {len(cps_in)}, .glyph_id_start = {glyph_id},\n"
+                           f"        .unicode_list = NULL, .glyph_id_ofs_list = NULL, .list_length = 0, .type = LV_FONT_FMT_TXT_CMAP_FORMAT0_TINY\n    }}")
+        else:
+            name = f'unicode_list_{index}'
+            offsets = [cp - start for cp in cps_in]
+            body = ',\n'.join('    ' + ', '.join(f'0x{o:x}' for o in offsets[i:i + 8]) for i in range(0, len(offsets), 8))
+            lists.append(f"static const uint16_t {name}[] = {{\n{body}\n}};\n")
+            entries.append(f"    {{\n        .range_start = {start}, .range_length = {cps_in[-1] - start + 1}, .glyph_id_start = {glyph_id},\n"
+                           f"        .unicode_list = {name}, .glyph_id_ofs_list = NULL, .list_length = {len(cps_in)}, .type = LV_FONT_FMT_TXT_CMAP_SPARSE_TINY\n    }}")
+        glyph_id += len(cps_in)
+
+    section = ('\n'.join(lists) + '\n' if lists else '\n\n') + \
+              '\n/*Collect the unicode lists and glyph_id offsets*/\nstatic const lv_font_fmt_txt_cmap_t cmaps[] =\n{\n' + \
+              ',\n'.join(entries) + '\n};\n'
+    return section, len(cmaps)
+
+def subset_kerning(text, keep_ids, id_map):
+    """裁剪字距数据：类字距按新字形顺序重排映射表，字距对只保留两端都在子集中的项"""
+    def rewrite_mapping(name, txt):
+        m = re.search(r'(static const uint8_t ' + name + r'\[\] =\n\{\n)(.*?)(\n\};)', txt, re.S)
+        if not m:
+            return txt
+        values = [int(x) for x in re.findall(r'\d+', m.group(2))]
+        kept = [values[0]] + [values[i] for i in keep_ids]
+        body = ',\n'.join('    ' + ', '.join(str(v) for v in kept[i:i + 8]) for i in range(0, len(kept), 8))
+        return txt[:m.start(2)] + body + txt[m.end(2):]
+
+    text = rewrite_mapping('kern_left_class_mapping', text)
+    text = rewrite_mapping('kern_right_class_mapping', text)
+
+    ids_match = re.search(r'(static const uint8_t kern_pair_glyph_ids\[\] =\n\{\n)(.*?)(\n\};)', text, re.S)
+    values_match = re.search(r'(static const int8_t kern_pair_values\[\] =\n\{\n)(.*?)(\n\};)', text, re.S)
+    if ids_match and values_match:
+        ids = [int(x) for x in re.findall(r'\d+', ids_match.group(2))]
+        values = [int(x) for x in re.findall(r'-?\d+', values_match.group(2))]
+        pairs = [(id_map[ids[2 * i]], id_map[ids[2 * i + 1]], values[i])
+                 for i in range(len(values)) if ids[2 * i] in id_map and ids[2 * i + 1] in id_map]
+        if not pairs:
+            pairs = [(0, 0, 0)]  # 保持数组非空，字形0不参与排版
+        ids_body = ',\n'.join(f'    {l}, {r}' for l, r, _ in pairs)
+        values_body = ',\n'.join('    ' + ', '.join(str(p[2]) for p in pairs[i:i + 8]) for i in range(0, len(pairs), 8))
+        # 先替换后面的数组，避免偏移失效
+        text = text[:values_match.start(2)] + values_body + text[values_match.end(2):]
+        text = text[:ids_match.start(2)] + ids_body + text[ids_match.end(2):]
+        text = re.sub(r'\.pair_cnt = \d+', f'.pair_cnt = {len(pairs)}', text)
+
+    return text
+
+def subset_font_file(filename, chars, compress, check_only):
+    """子集化单个字体文件，返回(原始位图字节数, 新位图字节数)"""
+    text = read_text(filename)
+    font = parse_font(text)
+    glyphs = font['glyphs']
+    bpp = font['bpp']
+    old_bytes = sum(len(g['data']) for g in glyphs)
+
+    if font['bitmap_format'] != 0:
+        print(f"⏭️  {filename}: 位图已压缩，跳过（请先从SquareLine重新导出）")
+        return (old_bytes, old_bytes)
+
+    if chars is UNKNOWN:
+        kept = glyphs
+        note = '保持完整（含无法静态确定的文本）'
+    else:
+        wanted = {ord(c) for c in chars} | {0x20}
+        kept = [g for g in glyphs if g['cp'] in wanted]
+        missing = sorted(wanted - {g['cp'] for g in glyphs} - {ord('\n'), ord('\t')})
+        note = f'{len(kept)}/{len(glyphs)}个字形'
+        if missing:
+            note += '，字体缺少: ' + ''.join(chr(c) for c in missing)
+
+    if compress and bpp not in (1, 2, 4, 8):
+        print(f"⚠️  {filename}: {bpp}bpp不支持压缩，只做子集化")
+        compress = False
+
+    # 重建位图和字形描述
+    bitmap_parts, dsc_lines, index = [], [], 0
+    for g in kept:
+        d = g['dsc']
+        data = g['data']
+        if compress:
+            data = compress_glyph(data, d['box_w'], d['box_h'], bpp)
+            if decompress_glyph(data, d['box_w'], d['box_h'], bpp) != unpack_pixels(g['data'], d['box_w'] * d['box_h'], bpp):
+                raise ValueError(f"{filename}: U+{g['cp']:04X} 压缩校验失败")
+        bitmap_parts.append(f"    {g['comment']}\n" + (format_bytes(data) + ',' if data else ''))
+        dsc_lines.append(f"    {{.bitmap_index = {index}, .adv_w = {d['adv_w']}, .box_w = {d['box_w']}, .box_h = {d['box_h']}, "
+                         f".ofs_x = {d['ofs_x']}, .ofs_y = {d['ofs_y']}}}")
+        index += len(data)
+
+    new_bytes = index
+    print(f"{'✅' if len(kept) < len(glyphs) or compress else '➖'} {filename}: {note}，"
+          f"位图 {format_size(old_bytes)} -> {format_size(new_bytes)}")
+
+    if check_only or (len(kept) == len(glyphs) and not compress):
+        return (old_bytes, new_bytes)
+
+    bitmap_body = '\n\n'.join(bitmap_parts).rstrip(',')
+    if compress:
+        bitmap_body += ',\n    0x0  /* 解压时可能多读一个字节 */'
+    text = re.sub(r'(static LV_ATTRIBUTE_LARGE_CONST const uint8_t glyph_bitmap\[\] = \{\n)(.*?)(\n\};)',
+                  lambda m: m.group(1) + bitmap_body + m.group(3), text, count=1, flags=re.S)
+
+    dsc_body = ('    {.bitmap_index = 0, .adv_w = 0, .box_w = 0, .box_h = 0, .ofs_x = 0, .ofs_y = 0} /* id = 0 reserved */,\n'
+                + ',\n'.join(dsc_lines))
+    text = re.sub(r'(static const lv_font_fmt_txt_glyph_dsc_t glyph_dsc\[\] = \{\n)(.*?)(\n\};)',
+                  lambda m: m.group(1) + dsc_body + m.group(3), text, count=1, flags=re.S)
+
+    cmap_section, cmap_num = build_cmaps([g['cp'] for g in kept])
+    text = re.sub(r'(\*  CHARACTER MAPPING\n \*--------------------\*/\n)(.*?)(\n/\*-----------------\n \*    KERNING)',
+                  lambda m: m.group(1) + '\n' + cmap_section + m.group(3), text, count=1, flags=re.S)
+    text = re.sub(r'\.cmap_num = \d+', f'.cmap_num = {cmap_num}', text)
+
+    old_ids = [glyphs.index(g) + 1 for g in kept]
+    id_map = {old: new for new, old in enumerate(old_ids, 1)}
+    text = subset_kerning(text, old_ids, id_map)
+
+    if compress:
+        text = re.sub(r'\.bitmap_format = \d+', '.bitmap_format = 1', text)
+        text = text.replace('/*-----------------\n *    BITMAPS',
+                            '#if !LV_USE_FONT_COMPRESSED\n#error "压缩字体需要在lv_conf.h中启用LV_USE_FONT_COMPRESSED"\n#endif\n\n'
+                            '/*-----------------\n *    BITMAPS', 1)
+
+    subset_line = f" * Subset: {len(kept)}/{len(glyphs)} glyphs{', compressed' if compress else ''} (font_subsetter.py)\n"
+    text = re.sub(r'( \* Opts: [^\n]*\n)', lambda m: m.group(1) + subset_line, text, count=1)
+
+    # 保持原文件的换行符（SquareLine在Windows上导出的文件为CRLF）
+    with open(filename, 'rb') as f:
+        newline = '\r\n' if b'\r\n' in f.read() else '\n'
+
+    with open(filename, 'w', encoding='utf-8', errors='surrogateescape', newline=newline) as f:
+        f.write(text)
+
+    return (old_bytes, new_bytes)
+
+if __name__ == "__main__":
+    check_only = '--check' in sys.argv
+    compress = '--compress' in sys.argv
+    args = [a for a in sys.argv[1:] if not a.startswith('--')]
+
+    print("🔤 SquareLine字体子集化工具")
+    print("=" * 50)
+
+    font_chars = collect_font_usage()
+
+    files = args
+    if not files:
+        for pattern in FONT_PATTERNS:
+            files += glob.glob(pattern)
+
+    total_before, total_after = 0, 0
+    for filename in sorted(files):
+        if re.search(r' \* Subset: ', read_text(filename)):
+            print(f"⏭️  {filename}: 已子集化，跳过（请先从SquareLine重新导出）")
+            continue
+        name = re.search(r'const lv_font_t (\w+) = \{', read_text(filename)).group(1)
+        if name not in font_chars:
+            print(f"⚠️  {filename}: UI中未找到使用该字体的对象，跳过")
+            size = sum(len(g['data']) for g in parse_font(read_text(filename))['glyphs'])
+            total_before += size
+            total_after += size
+            continue
+        before, after = subset_font_file(filename, font_chars[name], compress, check_only)
+        total_before += before
+        total_after += after
+
+    print("-" * 50)
+    print(f"字形位图总计: {format_size(total_before)} -> {format_size(total_after)} "
+          f"(节省 {format_size(total_before - total_after)})")
+    if check_only:
+        print("（--check模式，未修改文件）")
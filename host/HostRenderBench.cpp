@@ -0,0 +1,344 @@
+/*
+ * HostRenderBench.cpp - 主机渲染基准
+ * ESP32S3监控项目 - 主机渲染基准
+ *
+ * 功能特性：
+ * - 在Linux上用内存帧缓冲区作为LVGL显示驱动，构建与设备相同的UI1/UI2界面
+ * - 时钟由模拟时间推进（lv_tick_inc），结果与主机负载和实际经过的时间无关
+ * - 回放功率记录，通过PowerDisplayUpdater按设备相同的路径更新标签和功率条
+ * - 逐帧输出渲染耗时、刷新区域数、刷新像素数和LVGL堆占用（CSV，标准输出）
+ * - 可把帧缓冲区导出为PNG，用于优化前后的画面对比
+ *
+ * 由host_render_bench.py编译和运行，用法见该脚本说明
+ */
+
+#include "lvgl.h"
+#include "ui.h"
+#include "ui2.h"
+#include "RLEImageDecoder.h"
+#include "PowerDisplayUpdater.h"
+#include "PowerMonitorData.h"
+#include "PngWriter.h"
+#include "esp_timer.h"
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+#include <vector>
+
+// 与LVGL_Driver.cpp一致的屏幕和缓冲区配置
+#define HOST_LCD_H_RES          368
+#define HOST_LCD_V_RES          448
+#define HOST_STRIPE_LINES       (448 / 4)   // 与LVGL_STRIPE_LINES_DEFAULT一致
+#define HOST_FRAME_MS           16          // 默认模拟帧间隔
+#define HOST_TAIL_MS            1000        // 最后一个样本之后继续渲染的时长（等待动画结束）
+
+/**
+ * @brief 功率记录中的一个样本
+ */
+struct TraceSample {
+    uint32_t t_ms;
+    PowerMonitorData data;
+};
+
+/**
+ * @brief 当前帧的刷新统计（flush回调累加）
+ */
+static struct {
+    uint32_t flushes;
+    uint32_t pixels;
+} s_frame;
+
+static uint16_t s_framebuffer[HOST_LCD_H_RES * HOST_LCD_V_RES];
+
+// UI代码调用的DisplayManager钩子，主机上不需要处理
+extern "C" void updateDisplayManagerCurrentPage(void* screen) {
+    (void)screen;
+}
+
+extern "C" void notifyDisplayManagerScreenCreated(void* screen, uint32_t build_us) {
+    (void)screen;
+    (void)build_us;
+}
+
+extern "C" void showWiFiInfoPageFromUI() {
+}
+
+/**
+ * @brief 刷新回调：复制到帧缓冲区并统计刷新像素
+ */
+static void flushCb(lv_disp_drv_t* drv, const lv_area_t* area, lv_color_t* color_p) {
+    const int width = area->x2 - area->x1 + 1;
+    const int height = area->y2 - area->y1 + 1;
+
+    for (int y = 0; y < height; y++) {
+        memcpy(&s_framebuffer[(area->y1 + y) * HOST_LCD_H_RES + area->x1],
+               color_p + y * width, width * sizeof(lv_color_t));
+    }
+
+    s_frame.flushes++;
+    s_frame.pixels += width * height;
+    lv_disp_flush_ready(drv);
+}
+
+/**
+ * @brief 区域舍入回调（与LVGL_Driver.cpp的lvgl_rounder_cb一致：偶数起点、奇数终点）
+ */
+static void rounderCb(lv_disp_drv_t* drv, lv_area_t* area) {
+    (void)drv;
+    area->x1 = (area->x1 >> 1) << 1;
+    area->y1 = (area->y1 >> 1) << 1;
+    area->x2 = ((area->x2 >> 1) << 1) + 1;
+    area->y2 = ((area->y2 >> 1) << 1) + 1;
+}
+
+/**
+ * @brief 读取功率记录
+ *
+ * 每行一个样本：t_ms，之后每个端口依次为 state fc_protocol voltage(mV) current(mA)，共4个端口；
+ * 以#开头的行为注释（格式与host_render_bench.py record生成的一致）
+ */
+static bool loadTrace(const char* path, std::vector<TraceSample>& samples) {
+    FILE* file = fopen(path, "r");
+    if (!file) {
+        printf("# 错误：无法打开功率记录 %s\n", path);
+        return false;
+    }
+
+    char line[512];
+    int lineNum = 0;
+    while (fgets(line, sizeof(line), file)) {
+        lineNum++;
+        if (line[0] == '#' || line[0] == '\n' || line[0] == '\r') {
+            continue;
+        }
+
+        TraceSample sample;
+        memset(&sample, 0, sizeof(sample));
+        char state[4][16];
+        int fc[4];
+        int mv[4];
+        int ma[4];
+        int fields = sscanf(line, "%u %15s %d %d %d %15s %d %d %d %15s %d %d %d %15s %d %d %d",
+                            &sample.t_ms,
+                            state[0], &fc[0], &mv[0], &ma[0],
+                            state[1], &fc[1], &mv[1], &ma[1],
+                            state[2], &fc[2], &mv[2], &ma[2],
+                            state[3], &fc[3], &mv[3], &ma[3]);
+        if (fields != 17) {
+            printf("# 错误：功率记录第%d行格式错误\n", lineNum);
+            fclose(file);
+            return false;
+        }
+
+        // 与Monitor::processPortData/calculateTotalPower的换算一致
+        PowerMonitorData& data = sample.data;
+        data.port_count = 4;
+        data.timestamp = sample.t_ms;
+        for (int i = 0; i < 4; i++) {
+            PortData& port = data.ports[i];
+            port.id = i + 1;
+            strncpy(port.state, state[i], sizeof(port.state) - 1);
+            port.fc_protocol = fc[i];
+            port.voltage = mv[i];
+            port.current = ma[i];
+            port.power = (mv[i] * ma[i]) / 1000;
+            strncpy(port.protocol_name, getFastChargeProtocolName(fc[i]), sizeof(port.protocol_name) - 1);
+            port.valid = true;
+            data.total_power += port.power;
+        }
+        data.valid = true;
+
+        samples.push_back(sample);
+    }
+
+    fclose(file);
+    return true;
+}
+
+/**
+ * @brief 按名称查找要显示的屏幕
+ */
+static lv_obj_t* findScreen(const char* name, bool ui2System) {
+    struct ScreenEntry {
+        const char* name;
+        lv_obj_t** ui1;
+        lv_obj_t** ui2;
+    };
+    const ScreenEntry screens[] = {
+        {"standby", &ui_standbySCREEN,    &ui2_standbySCREEN},
+        {"total",   &ui_totalpowerSCREEN, &ui2_totalpowerSCREEN},
+        {"port1",   &ui_prot1SCREEN,      &ui2_port1SCREEN},
+        {"port2",   &ui_prot2SCREEN,      &ui2_port2SCREEN},
+        {"port3",   &ui_prot3SCREEN,      &ui2_port3SCREEN},
+        {"port4",   &ui_prot4SCREEN,      &ui2_port4SCREEN},
+        {"detail1", &ui_port1SCREEN12,    nullptr},
+        {"detail2", &ui_port2SCREEN22,    nullptr},
+        {"detail3", &ui_port3SCREEN32,    nullptr},
+        {"detail4", &ui_port4SCREEN42,    nullptr},
+    };
+
+    for (const ScreenEntry& entry : screens) {
+        if (strcmp(entry.name, name) == 0) {
+            lv_obj_t** screen = ui2System ? entry.ui2 : entry.ui1;
+            return screen ? *screen : nullptr;
+        }
+    }
+    return nullptr;
+}
+
+static void printUsage() {
+    printf("用法：host_render_bench <功率记录> [--theme 1|2] [--screen 名称] [--frame-ms N]\n"
+           "                        [--stripe-lines N] [--png-dir 目录] [--png-every N] [--all-frames]\n"
+           "屏幕名称：standby total port1-4 detail1-4（detail仅UI1）\n");
+}
+
+int main(int argc, char** argv) {
+    const char* tracePath = nullptr;
+    const char* screenName = "total";
+    const char* pngDir = nullptr;
+    bool ui2System = false;
+    uint32_t frameMs = HOST_FRAME_MS;
+    int stripeLines = HOST_STRIPE_LINES;
+    uint32_t pngEvery = 0;
+    bool allFrames = false;
+
+    for (int i = 1; i < argc; i++) {
+        const char* arg = argv[i];
+        bool hasValue = i + 1 < argc;
+        if (strcmp(arg, "--theme") == 0 && hasValue) {
+            ui2System = atoi(argv[++i]) == 2;
+        } else if (strcmp(arg, "--screen") == 0 && hasValue) {
+            screenName = argv[++i];
+        } else if (strcmp(arg, "--frame-ms") == 0 && hasValue) {
+            frameMs = (uint32_t)atoi(argv[++i]);
+        } else if (strcmp(arg, "--stripe-lines") == 0 && hasValue) {
+            stripeLines = atoi(argv[++i]);
+        } else if (strcmp(arg, "--png-dir") == 0 && hasValue) {
+            pngDir = argv[++i];
+        } else if (strcmp(arg, "--png-every") == 0 && hasValue) {
+            pngEvery = (uint32_t)atoi(argv[++i]);
+        } else if (strcmp(arg, "--all-frames") == 0) {
+            allFrames = true;
+        } else if (arg[0] != '-' && !tracePath) {
+            tracePath = arg;
+        } else {
+            printUsage();
+            return 2;
+        }
+    }
+
+    if (!tracePath || frameMs == 0 || stripeLines <= 0 || stripeLines > HOST_LCD_V_RES) {
+        printUsage();
+        return 2;
+    }
+
+    std::vector<TraceSample> samples;
+    if (!loadTrace(tracePath, samples) || samples.empty()) {
+        printf("# 错误：功率记录为空\n");
+        return 1;
+    }
+
+    // 显示驱动：与设备默认策略相同的条带双缓冲
+    lv_init();
+    RLEImageDecoder::init();
+
+    static lv_disp_draw_buf_t drawBuf;
+    std::vector<lv_color_t> buf1((size_t)HOST_LCD_H_RES * stripeLines);
+    std::vector<lv_color_t> buf2((size_t)HOST_LCD_H_RES * stripeLines);
+    lv_disp_draw_buf_init(&drawBuf, buf1.data(), buf2.data(), HOST_LCD_H_RES * stripeLines);
+
+    static lv_disp_drv_t dispDrv;
+    lv_disp_drv_init(&dispDrv);
+    dispDrv.hor_res = HOST_LCD_H_RES;
+    dispDrv.ver_res = HOST_LCD_V_RES;
+    dispDrv.flush_cb = flushCb;
+    dispDrv.rounder_cb = rounderCb;
+    dispDrv.draw_buf = &drawBuf;
+    lv_disp_drv_register(&dispDrv);
+
+    // 构建界面
+    int64_t buildStart = esp_timer_get_time();
+    if (ui2System) {
+        ui2_init();
+    } else {
+        ui_init();
+    }
+    uint32_t buildUs = (uint32_t)(esp_timer_get_time() - buildStart);
+
+    lv_obj_t* screen = findScreen(screenName, ui2System);
+    if (!screen) {
+        printf("# 错误：未知屏幕 %s\n", screenName);
+        printUsage();
+        return 2;
+    }
+    lv_disp_load_scr(screen);
+
+    printf("# theme=%d screen=%s frame_ms=%u stripe_lines=%d samples=%u build_us=%u\n",
+           ui2System ? 2 : 1, screenName, frameMs, stripeLines, (unsigned)samples.size(), buildUs);
+    printf("frame,t_ms,sample,render_us,flushes,pixels,mem_used,mem_max_used,mem_frag_pct\n");
+
+    const uint32_t endMs = samples.back().t_ms + HOST_TAIL_MS;
+    size_t nextSample = 0;
+    uint32_t frame = 0;
+    uint32_t pngCount = 0;
+    char pngPath[512];
+
+    // 第一帧为整屏渲染（t=0，样本未应用前的SquareLine默认内容）
+    for (uint32_t t = 0; t <= endMs; t += frameMs) {
+        int sample = -1;
+        while (nextSample < samples.size() && samples[nextSample].t_ms <= t) {
+            // 与DisplayManager::updatePowerData的更新路径一致
+            const PowerMonitorData& data = samples[nextSample].data;
+            PowerDisplayUpdater::updatePowerData(data, ui2System);
+            for (int i = 0; i < 4; i++) {
+                PowerDisplayUpdater::updatePortDetail(data, i);
+            }
+            sample = (int)nextSample;
+            nextSample++;
+        }
+
+        if (t > 0) {
+            lv_tick_inc(frameMs);
+        }
+
+        s_frame.flushes = 0;
+        s_frame.pixels = 0;
+        int64_t start = esp_timer_get_time();
+        if (t == 0) {
+            lv_refr_now(NULL);
+        } else {
+            lv_timer_handler();
+        }
+        uint32_t renderUs = (uint32_t)(esp_timer_get_time() - start);
+
+        if (s_frame.pixels == 0 && !allFrames) {
+            continue;
+        }
+
+        lv_mem_monitor_t mon;
+        lv_mem_monitor(&mon);
+        printf("%u,%u,%d,%u,%u,%u,%u,%u,%u\n",
+               frame, t, sample, renderUs, s_frame.flushes, s_frame.pixels,
+               (unsigned)(mon.total_size - mon.free_size), (unsigned)mon.max_used, (unsigned)mon.frag_pct);
+
+        if (pngDir && pngEvery > 0 && frame % pngEvery == 0) {
+            snprintf(pngPath, sizeof(pngPath), "%s/frame_%05u.png", pngDir, frame);
+            if (writePNG(pngPath, s_framebuffer, HOST_LCD_H_RES, HOST_LCD_V_RES, LV_COLOR_16_SWAP != 0)) {
+                pngCount++;
+            }
+        }
+        frame++;
+    }
+
+    // 最终画面总是导出，作为画面对比的基准
+    if (pngDir) {
+        snprintf(pngPath, sizeof(pngPath), "%s/final.png", pngDir);
+        if (writePNG(pngPath, s_framebuffer, HOST_LCD_H_RES, HOST_LCD_V_RES, LV_COLOR_16_SWAP != 0)) {
+            pngCount++;
+        }
+    }
+
+    printf("# frames=%u png=%u rle_cache_bytes=%u\n",
+           frame, pngCount, (unsigned)RLEImageDecoder::getCacheBytes());
+    return 0;
+}
@@ -0,0 +1,131 @@
+/*
+ * PngWriter.cpp - RGB565帧缓冲区PNG导出实现文件
+ * ESP32S3监控项目 - 主机渲染基准
+ */
+
+#include "PngWriter.h"
+#include <stdio.h>
+#include <string.h>
+#include <vector>
+
+static uint32_t crcTable[256];
+static bool crcTableReady = false;
+
+static void buildCrcTable() {
+    for (uint32_t n = 0; n < 256; n++) {
+        uint32_t c = n;
+        for (int k = 0; k < 8; k++) {
+            c = (c & 1) ? (0xEDB88320u ^ (c >> 1)) : (c >> 1);
+        }
+        crcTable[n] = c;
+    }
+    crcTableReady = true;
+}
+
+static uint32_t crc32(uint32_t crc, const uint8_t* data, size_t length) {
+    crc = ~crc;
+    for (size_t i = 0; i < length; i++) {
+        crc = crcTable[(crc ^ data[i]) & 0xFF] ^ (crc >> 8);
+    }
+    return ~crc;
+}
+
+static void putU32(std::vector<uint8_t>& out, uint32_t v) {
+    out.push_back((uint8_t)(v >> 24));
+    out.push_back((uint8_t)(v >> 16));
+    out.push_back((uint8_t)(v >> 8));
+    out.push_back((uint8_t)v);
+}
+
+/**
+ * @brief 写一个PNG数据块（长度、类型、数据、CRC）
+ */
+static void writeChunk(FILE* file, const char* type, const std::vector<uint8_t>& data) {
+    std::vector<uint8_t> chunk;
+    putU32(chunk, (uint32_t)data.size());
+    chunk.insert(chunk.end(), type, type + 4);
+    chunk.insert(chunk.end(), data.begin(), data.end());
+    uint32_t crc = crc32(0, chunk.data() + 4, chunk.size() - 4);
+    putU32(chunk, crc);
+    fwrite(chunk.data(), 1, chunk.size(), file);
+}
+
+bool writePNG(const char* path, const uint16_t* pixels, int width, int height, bool swapped) {
+    if (!crcTableReady) {
+        buildCrcTable();
+    }
+
+    FILE* file = fopen(path, "wb");
+    if (!file) {
+        printf("[PngWriter] 错误：无法创建文件 %s\n", path);
+        return false;
+    }
+
+    static const uint8_t signature[8] = {0x89, 'P', 'N', 'G', '\r', '\n', 0x1A, '\n'};
+    fwrite(signature, 1, sizeof(signature), file);
+
+    // IHDR：8位RGB，无隔行
+    std::vector<uint8_t> ihdr;
+    putU32(ihdr, (uint32_t)width);
+    putU32(ihdr, (uint32_t)height);
+    ihdr.push_back(8);
+    ihdr.push_back(2);
+    ihdr.push_back(0);
+    ihdr.push_back(0);
+    ihdr.push_back(0);
+    writeChunk(file, "IHDR", ihdr);
+
+    // 原始扫描行：每行前加过滤类型0
+    std::vector<uint8_t> raw;
+    raw.reserve((size_t)height * (width * 3 + 1));
+    for (int y = 0; y < height; y++) {
+        raw.push_back(0);
+        for (int x = 0; x < width; x++) {
+            uint16_t v = pixels[y * width + x];
+            if (swapped) {
+                v = (uint16_t)((v >> 8) | (v << 8));
+            }
+            uint8_t r = (v >> 11) & 0x1F;
+            uint8_t g = (v >> 5) & 0x3F;
+            uint8_t b = v & 0x1F;
+            raw.push_back((uint8_t)((r << 3) | (r >> 2)));
+            raw.push_back((uint8_t)((g << 2) | (g >> 4)));
+            raw.push_back((uint8_t)((b << 3) | (b >> 2)));
+        }
+    }
+
+    // IDAT：zlib头 + 不压缩的deflate块（每块最多65535字节）+ Adler-32
+    std::vector<uint8_t> idat;
+    idat.push_back(0x78);
+    idat.push_back(0x01);
+    size_t offset = 0;
+    do {
+        size_t block = raw.size() - offset;
+        if (block > 65535) {
+            block = 65535;
+        }
+        bool final = offset + block >= raw.size();
+        idat.push_back(final ? 1 : 0);
+        idat.push_back((uint8_t)block);
+        idat.push_back((uint8_t)(block >> 8));
+        idat.push_back((uint8_t)~block);
+        idat.push_back((uint8_t)(~block >> 8));
+        idat.insert(idat.end(), raw.begin() + offset, raw.begin() + offset + block);
+        offset += block;
+    } while (offset < raw.size());
+
+    uint32_t a = 1;
+    uint32_t b = 0;
+    for (size_t i = 0; i < raw.size(); i++) {
+        a = (a + raw[i]) % 65521;
+        b = (b + a) % 65521;
+    }
+    putU32(idat, (b << 16) | a);
+    writeChunk(file, "IDAT", idat);
+
+    writeChunk(file, "IEND", std::vector<uint8_t>());
+
+    bool ok = ferror(file) == 0;
+    fclose(file);
+    return ok;
+}
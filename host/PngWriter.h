@@ -0,0 +1,25 @@
+/*
+ * PngWriter.h - RGB565帧缓冲区PNG导出头文件
+ * ESP32S3监控项目 - 主机渲染基准
+ *
+ * 使用不压缩的deflate块写出PNG，不依赖zlib/libpng，输出供画面对比使用
+ */
+
+#ifndef HOST_PNG_WRITER_H
+#define HOST_PNG_WRITER_H
+
+#include <stdint.h>
+
+/**
+ * @brief 把RGB565帧缓冲区写为24位PNG
+ *
+ * @param path 输出文件路径
+ * @param pixels 像素数据（按行连续存放）
+ * @param width 宽度
+ * @param height 高度
+ * @param swapped true时像素为字节交换的RGB565（LV_COLOR_16_SWAP=1）
+ * @return true 成功，false 文件写入失败
+ */
+bool writePNG(const char* path, const uint16_t* pixels, int width, int height, bool swapped);
+
+#endif // HOST_PNG_WRITER_H
@@ -0,0 +1,223 @@
+/*
+ * AllocTrackerBench.cpp - PSRAM分配跟踪微基准
+ * ESP32S3监控项目 - 主机基准
+ *
+ * 功能特性：
+ * - 对比PSRAMManager原来的跟踪方式（每次分配构造3个字符串、vector记录+map记录、释放时线性查找）
+ *   和PSRAMAllocTracker（开放寻址哈希表 + 整数标签）
+ * - 稳态负载：保持固定数量的在用块，每次随机释放一块再分配一块，只计跟踪开销，不计内存分配本身
+ * - 统计每对分配/释放的平均耗时和跟踪路径上的堆分配次数（替换全局operator new计数）
+ *
+ * 由host_alloc_bench.py编译和运行
+ */
+
+#include "PSRAMAllocTracker.h"
+#include "esp_heap_caps.h"
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+#include <chrono>
+#include <map>
+#include <new>
+#include <string>
+#include <vector>
+
+static size_t s_heapAllocs = 0;
+
+void* operator new(size_t size) {
+    s_heapAllocs++;
+    void* p = malloc(size ? size : 1);
+    if (!p) {
+        throw std::bad_alloc();
+    }
+    return p;
+}
+
+void operator delete(void* p) noexcept {
+    free(p);
+}
+
+void operator delete(void* p, size_t) noexcept {
+    free(p);
+}
+
+// 与设备上调用方相近的用途字符串
+static const char* PURPOSES[] = {
+    "屏幕镜像缓冲区", "功率趋势历史", "HTTP响应缓冲区", "天气JSON文档", "资源包图片", "AudioPCMBuffer"
+};
+static const int PURPOSE_COUNT = sizeof(PURPOSES) / sizeof(PURPOSES[0]);
+
+static const char* TASK_NAMES[] = { "DisplayTask", "WebServer", "WeatherTask", "loopTask" };
+static const int TASK_COUNT = sizeof(TASK_NAMES) / sizeof(TASK_NAMES[0]);
+
+/**
+ * @brief 原跟踪方式（String换成std::string，结构和操作与改动前的PSRAMManager一致）
+ */
+class LegacyTracker {
+public:
+    void onAllocate(void* ptr, size_t size, const char* task, const char* purpose) {
+        std::string taskName(task);
+        std::string poolName("缓冲池");
+        std::string fullPurpose = poolName + " - " + purpose;
+        m_blocks.emplace_back(ptr, size, taskName, fullPurpose);
+        m_sizes[ptr] = size;
+    }
+
+    bool onDeallocate(void* ptr) {
+        bool found = false;
+        for (auto it = m_blocks.begin(); it != m_blocks.end(); ++it) {
+            if (it->address == ptr) {
+                m_blocks.erase(it);
+                found = true;
+                break;
+            }
+        }
+        auto sizeIt = m_sizes.find(ptr);
+        if (sizeIt != m_sizes.end()) {
+            m_sizes.erase(sizeIt);
+            found = true;
+        }
+        return found;
+    }
+
+private:
+    struct BlockInfo {
+        void* address;
+        size_t size;
+        std::string taskName;
+        unsigned long allocTime;
+        std::string purpose;
+        bool isAllocated;
+
+        BlockInfo(void* addr, size_t sz, const std::string& task, const std::string& desc)
+            : address(addr), size(sz), taskName(task), allocTime(0), purpose(desc), isAllocated(true) {}
+    };
+
+    std::vector<BlockInfo> m_blocks;
+    std::map<void*, size_t> m_sizes;
+};
+
+/**
+ * @brief 新跟踪方式（用途字符串每次驻留，与PSRAMManager::allocate(size, const char*)路径一致）
+ */
+class TableTracker {
+public:
+    bool init() {
+        return m_tracker.init(ALLOC_TRACKER_CAPACITY, MALLOC_CAP_SPIRAM);
+    }
+
+    void onAllocate(void* ptr, size_t size, const char* task, const char* purpose) {
+        PSRAMBlockInfo info;
+        info.address = ptr;
+        info.size = size;
+        info.allocTime = 0;
+        info.taskTag = m_tracker.internTag(task);
+        info.purposeTag = m_tracker.internTag(purpose);
+        info.pool = 2;
+        info.memClass = 1;
+        m_tracker.insert(info);
+    }
+
+    bool onDeallocate(void* ptr) {
+        return m_tracker.remove(ptr, nullptr);
+    }
+
+    void getStats(AllocTrackerStats* stats) const {
+        m_tracker.getStats(stats);
+    }
+
+private:
+    PSRAMAllocTracker m_tracker;
+};
+
+struct BenchResult {
+    double nsPerPair;
+    double heapAllocsPerPair;
+};
+
+static uint32_t s_rng = 0x12345678;
+
+static uint32_t nextRandom() {
+    s_rng ^= s_rng << 13;
+    s_rng ^= s_rng >> 17;
+    s_rng ^= s_rng << 5;
+    return s_rng;
+}
+
+/**
+ * @brief 稳态负载：live个在用块，每轮随机释放一块并在原位置分配新块
+ */
+template <typename Tracker>
+static BenchResult runSteadyState(Tracker& tracker, uint8_t* arena, int live, int iterations) {
+    std::vector<void*> slots(live);
+    for (int i = 0; i < live; i++) {
+        slots[i] = arena + (size_t)i * 64;
+        tracker.onAllocate(slots[i], 64, TASK_NAMES[i % TASK_COUNT], PURPOSES[i % PURPOSE_COUNT]);
+    }
+
+    // 地址从一块更大的区域中轮换，模拟释放后重新分配到不同位置
+    size_t nextAddr = live;
+    const size_t arenaSlots = (size_t)live * 4;
+    s_rng = 0x12345678;
+
+    size_t heapBefore = s_heapAllocs;
+    auto start = std::chrono::steady_clock::now();
+    for (int i = 0; i < iterations; i++) {
+        uint32_t r = nextRandom();
+        int victim = r % live;
+        tracker.onDeallocate(slots[victim]);
+        slots[victim] = arena + (nextAddr++ % arenaSlots) * 64;
+        tracker.onAllocate(slots[victim], 64, TASK_NAMES[r % TASK_COUNT], PURPOSES[(r >> 8) % PURPOSE_COUNT]);
+    }
+    auto end = std::chrono::steady_clock::now();
+    size_t heapAllocs = s_heapAllocs - heapBefore;
+
+    for (int i = 0; i < live; i++) {
+        tracker.onDeallocate(slots[i]);
+    }
+
+    BenchResult result;
+    result.nsPerPair = std::chrono::duration<double, std::nano>(end - start).count() / iterations;
+    result.heapAllocsPerPair = (double)heapAllocs / iterations;
+    return result;
+}
+
+int main(int argc, char** argv) {
+    int iterations = argc > 1 ? atoi(argv[1]) : 200000;
+    if (iterations <= 0) {
+        fprintf(stderr, "用法: %s [每组迭代次数]\n", argv[0]);
+        return 2;
+    }
+
+    // 跟踪表装载率上限为75%，在用块数不超过容量的一半
+    const int LIVE_COUNTS[] = { 16, 64, 256, ALLOC_TRACKER_CAPACITY / 2 };
+    const int maxLive = ALLOC_TRACKER_CAPACITY / 2;
+    uint8_t* arena = (uint8_t*)malloc((size_t)maxLive * 4 * 64);
+    if (!arena) {
+        return 1;
+    }
+
+    printf("live,legacy_ns,table_ns,speedup,legacy_heap_allocs,table_heap_allocs\n");
+    for (int live : LIVE_COUNTS) {
+        LegacyTracker legacy;
+        BenchResult a = runSteadyState(legacy, arena, live, iterations);
+
+        TableTracker table;
+        if (!table.init()) {
+            fprintf(stderr, "跟踪表初始化失败\n");
+            return 1;
+        }
+        BenchResult b = runSteadyState(table, arena, live, iterations);
+
+        printf("%d,%.1f,%.1f,%.1fx,%.2f,%.2f\n", live, a.nsPerPair, b.nsPerPair,
+               a.nsPerPair / b.nsPerPair, a.heapAllocsPerPair, b.heapAllocsPerPair);
+
+        AllocTrackerStats stats;
+        table.getStats(&stats);
+        fprintf(stderr, "  [table] live=%d 峰值=%u 最长探测=%u 未记录=%u 标签=%u\n",
+                live, stats.peak, stats.maxProbe, stats.dropped, stats.tags);
+    }
+
+    free(arena);
+    return 0;
+}
@@ -0,0 +1,1026 @@
+/*
+ * AllocatorSuite.cpp - PSRAMManager主机测试和基准
+ * ESP32S3监控项目 - 主机基准
+ *
+ * 功能特性：
+ * - 在Linux上编译真实的PSRAMManager（跟踪表、分级内存池、剖析器、临时内存区），
+ *   heap_caps_*和FreeRTOS由host/shim和HostHeap.cpp的模拟堆提供
+ * - 属性测试：随机分配/释放序列中反复检查getStatistics()、内存类别统计、内存池统计、
+ *   剖析器计数与跟踪表一致，在用块的位置/对齐/内容正确，全部释放后计数归零且模拟堆无泄漏
+ * - 吞吐基准：各尺寸分配/释放对的耗时，对比直接heap_caps_malloc和任务临时内存区
+ * - 多线程竞争：1~8个线程同时分配/释放时的总吞吐，结束后检查统计一致
+ * - 碎片基准：按设备上的真实用法（天气JSON、音频PCM、Web响应、资源包图片、小对象）建模的
+ *   随机负载，输出PSRAM和内部RAM的空闲、最大连续块和碎片率变化，分内存池开启/关闭两组
+ *
+ * 用法：host_alloc_suite test [种子] [步数]
+ *       host_alloc_suite bench [迭代次数]
+ *       host_alloc_suite threads [迭代次数]
+ *       host_alloc_suite frag [种子] [步数]
+ * 结果以CSV输出到标准输出，PSRAMManager自身的日志丢弃（加-v保留），检查失败的详情输出到标准错误。
+ * 由host_alloc_bench.py编译和运行
+ */
+
+#include "HostHeap.h"
+#include "PSRAMManager.h"
+#include "PSRAMArena.h"
+#include "esp_memory_utils.h"
+#include <stdarg.h>
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+#include <unistd.h>
+#include <algorithm>
+#include <atomic>
+#include <chrono>
+#include <deque>
+#include <new>
+#include <random>
+#include <thread>
+#include <vector>
+
+static FILE* s_out = stdout;
+
+// ==================== 检查 ====================
+
+static std::atomic<uint32_t> s_checks(0);
+static std::atomic<uint32_t> s_failures(0);
+static const char* s_case = "";
+
+static void fail(const char* fmt, ...) {
+    if (++s_failures > 20) {
+        return;
+    }
+    va_list args;
+    va_start(args, fmt);
+    fprintf(stderr, "✗ [%s] ", s_case);
+    vfprintf(stderr, fmt, args);
+    fprintf(stderr, "\n");
+    va_end(args);
+}
+
+#define CHECK(cond, ...) do { s_checks++; if (!(cond)) { fail(__VA_ARGS__); } } while (0)
+
+static double nowNs() {
+    return (double)std::chrono::duration_cast<std::chrono::nanoseconds>(
+        std::chrono::steady_clock::now().time_since_epoch()).count();
+}
+
+// ==================== 测试自己记录的在用块 ====================
+
+struct LiveBlock {
+    uint8_t* ptr;
+    size_t size;            // 请求大小
+    size_t alignment;
+    uint32_t caps;
+    MemPlacement placement;
+    uint8_t fill;
+    bool taskOwned;         // 通过allocateForTask分配，可能被deallocateAll整体释放
+};
+
+static const size_t FILL_SPAN = 64;
+
+static void fillBlock(LiveBlock& block) {
+    size_t head = std::min(block.size, FILL_SPAN);
+    memset(block.ptr, block.fill, head);
+    if (block.size > FILL_SPAN) {
+        size_t tail = std::min(block.size - FILL_SPAN, FILL_SPAN);
+        memset(block.ptr + block.size - tail, block.fill, tail);
+    }
+}
+
+static bool blockIntact(const LiveBlock& block) {
+    size_t head = std::min(block.size, FILL_SPAN);
+    for (size_t i = 0; i < head; i++) {
+        if (block.ptr[i] != block.fill) {
+            return false;
+        }
+    }
+    if (block.size > FILL_SPAN) {
+        size_t tail = std::min(block.size - FILL_SPAN, FILL_SPAN);
+        for (size_t i = block.size - tail; i < block.size; i++) {
+            if (block.ptr[i] != block.fill) {
+                return false;
+            }
+        }
+    }
+    return true;
+}
+
+static bool isPSRAMClass(uint8_t memClass) {
+    return memClass == MEM_CLASS_PSRAM_POOL || memClass == MEM_CLASS_PSRAM_HEAP;
+}
+
+// 从剖析报告中读取顶层整数字段（主机ArduinoJson替代保留了节点树）
+static unsigned long long jsonNumber(const JsonDocument& doc, const char* key) {
+    for (const auto& member : doc.root()->members) {
+        if (member.first == key) {
+            const HostJson::Node* node = member.second;
+            return node->kind == HostJson::Node::SIGNED ? (unsigned long long)node->sint : node->uint;
+        }
+    }
+    return (unsigned long long)-1;
+}
+
+/**
+ * @brief 检查管理器的统计与跟踪表、模拟堆以及测试记录的在用块一致
+ */
+static void verifyConsistency(PSRAMManager& manager, const std::vector<LiveBlock>& live, bool checkProfiler) {
+    std::vector<PSRAMBlockInfo> blocks = manager.getAllocatedBlocks();
+    AllocTrackerStats tracker;
+    manager.getTrackerStats(&tracker);
+    CHECK(blocks.size() == tracker.count && tracker.count == manager.getBlockCount(),
+          "跟踪表记录数不一致: 快照%zu, 统计%u, getBlockCount %u",
+          blocks.size(), tracker.count, manager.getBlockCount());
+
+    // getStatistics：分配-释放 = 在用块，PSRAM总量 = 已用 + 空闲，且与堆一致
+    PSRAMStatistics stats = manager.getStatistics();
+    if (tracker.dropped == 0) {
+        CHECK(stats.allocationCount - stats.freeCount == tracker.count,
+              "分配%u - 释放%u != 在用块%u", stats.allocationCount, stats.freeCount, tracker.count);
+    }
+    CHECK(stats.usedSize + stats.freeSize == stats.totalSize,
+          "已用%zu + 空闲%zu != 总量%zu", stats.usedSize, stats.freeSize, stats.totalSize);
+    CHECK(stats.freeSize == heap_caps_get_free_size(MALLOC_CAP_SPIRAM),
+          "统计空闲%zu与堆空闲%zu不一致", stats.freeSize, heap_caps_get_free_size(MALLOC_CAP_SPIRAM));
+    CHECK(stats.largestFreeBlock <= stats.freeSize, "最大连续块大于空闲");
+
+    // 各内存类别：分配-释放 = 该类别在用块数，在用字节 = 记录大小之和
+    uint32_t classCount[MEM_CLASS_COUNT] = {};
+    size_t classBytes[MEM_CLASS_COUNT] = {};
+    uint32_t poolCount[POOL_COUNT] = {};
+    size_t poolBytes[POOL_COUNT] = {};
+    size_t totalBytes = 0;
+    for (const PSRAMBlockInfo& block : blocks) {
+        CHECK(block.memClass < MEM_CLASS_COUNT, "无效内存类别%u", block.memClass);
+        if (block.memClass >= MEM_CLASS_COUNT) {
+            continue;
+        }
+        classCount[block.memClass]++;
+        classBytes[block.memClass] += block.size;
+        totalBytes += block.size;
+        if (block.memClass == MEM_CLASS_PSRAM_POOL && block.pool < POOL_COUNT) {
+            poolCount[block.pool]++;
+            poolBytes[block.pool] += block.size;
+        }
+        bool external = esp_ptr_external_ram(block.address);
+        CHECK(external == isPSRAMClass(block.memClass), "块%p位置与类别%s不符",
+              block.address, PSRAMManager::getMemClassName((MemClass)block.memClass));
+    }
+    for (int i = 0; i < MEM_CLASS_COUNT; i++) {
+        MemClassStats cls;
+        manager.getMemClassStats((MemClass)i, &cls);
+        if (tracker.dropped == 0) {
+            CHECK(cls.allocs - cls.frees == classCount[i], "%s: 分配%u - 释放%u != 在用%u",
+                  PSRAMManager::getMemClassName((MemClass)i), cls.allocs, cls.frees, classCount[i]);
+        }
+        CHECK(cls.liveBytes == classBytes[i], "%s: 在用字节%zu != 记录%zu",
+              PSRAMManager::getMemClassName((MemClass)i), cls.liveBytes, classBytes[i]);
+        CHECK(cls.peakBytes >= cls.liveBytes, "%s: 峰值小于在用", PSRAMManager::getMemClassName((MemClass)i));
+    }
+
+    // 各内存池：池内分配-释放 = 池内在用块，按块大小计的已用不小于请求大小之和
+    for (int i = 0; i < POOL_COUNT; i++) {
+        SlabPoolStats pool;
+        if (!manager.getPoolStats((PSRAMPoolType)i, &pool)) {
+            CHECK(poolCount[i] == 0, "已销毁的内存池%d仍有在用块", i);
+            continue;
+        }
+        CHECK(pool.allocs - pool.frees == poolCount[i], "内存池%d: 分配%u - 释放%u != 在用%u",
+              i, pool.allocs, pool.frees, poolCount[i]);
+        CHECK(pool.used_bytes >= poolBytes[i], "内存池%d: 已用%zu < 请求%zu", i, pool.used_bytes, poolBytes[i]);
+        CHECK(pool.bad_frees == 0, "内存池%d: 无效释放%u次", i, pool.bad_frees);
+    }
+
+    // 测试记录的每一块都在跟踪表中，位置满足能力需求，内容没有被其他分配覆盖
+    for (const LiveBlock& block : live) {
+        PSRAMBlockInfo info;
+        bool found = manager.getBlockInfo(block.ptr, &info);
+        CHECK(found, "在用块%p不在跟踪表中", block.ptr);
+        if (!found) {
+            continue;
+        }
+        CHECK(info.size >= block.size, "块%p记录大小%u < 请求%zu", block.ptr, info.size, block.size);
+        bool external = esp_ptr_external_ram(block.ptr);
+        bool needInternal = (block.caps & (MEM_CAP_INTERNAL | MEM_CAP_EXEC)) ||
+                            ((block.caps & MEM_CAP_DMA) && !(block.caps & MEM_CAP_SPIRAM)) ||
+                            block.placement == MEM_INTERNAL_ONLY;
+        bool needPSRAM = (block.caps & MEM_CAP_SPIRAM) || block.placement == MEM_PSRAM_ONLY;
+        CHECK(!needInternal || !external, "块%p应在内部RAM", block.ptr);
+        CHECK(!needPSRAM || external, "块%p应在PSRAM", block.ptr);
+        if (block.alignment > 0) {
+            CHECK(((uintptr_t)block.ptr & (block.alignment - 1)) == 0, "块%p未按%zu对齐", block.ptr, block.alignment);
+        }
+        if ((block.caps & MEM_CAP_SPIRAM) && (block.caps & MEM_CAP_DMA)) {
+            CHECK(((uintptr_t)block.ptr & (MEM_SPIRAM_DMA_ALIGNMENT - 1)) == 0, "PSRAM DMA块%p未按缓存行对齐", block.ptr);
+        }
+        CHECK(blockIntact(block), "块%p内容被覆盖", block.ptr);
+    }
+
+    // 剖析器只统计进入跟踪表的块
+    if (checkProfiler && manager.isProfilerEnabled()) {
+        DynamicJsonDocument profile(8192);
+        manager.getProfileJSON(profile);
+        CHECK(jsonNumber(profile, "liveCount") == tracker.count, "剖析器在用块%llu != %u",
+              jsonNumber(profile, "liveCount"), tracker.count);
+        CHECK(jsonNumber(profile, "liveBytes") == totalBytes, "剖析器在用字节%llu != %zu",
+              jsonNumber(profile, "liveBytes"), totalBytes);
+    }
+
+    CHECK(heap_caps_check_integrity_all(true), "模拟堆完整性检查失败");
+}
+
+static void verifyHeapClean(HostHeapStats* before) {
+    for (int r = 0; r < HOST_HEAP_REGION_COUNT; r++) {
+        HostHeapStats after;
+        hostHeapGetStats((HostHeapRegion)r, &after);
+        CHECK(after.badFreeCount == 0, "区域%d: %u次无效释放", r, after.badFreeCount);
+        if (before) {
+            CHECK(after.liveBlocks == before[r].liveBlocks && after.freeSize == before[r].freeSize,
+                  "区域%d泄漏: 在用块%u -> %u, 空闲%zu -> %zu", r,
+                  before[r].liveBlocks, after.liveBlocks, before[r].freeSize, after.freeSize);
+        }
+    }
+}
+
+// ==================== 随机操作 ====================
+
+class RandomWorkload {
+public:
+    RandomWorkload(PSRAMManager& manager, uint32_t seed, const char* taskName = "测试任务", bool exclusive = true)
+        : m_manager(manager), m_rng(seed), m_taskName(taskName), m_exclusive(exclusive) {}
+
+    std::vector<LiveBlock>& live() { return m_live; }
+
+    uint32_t below(uint32_t n) { return (uint32_t)(m_rng() % n); }
+
+    // 尺寸分布：六成小对象、三成中等缓冲、一成大块
+    size_t randomSize() {
+        uint32_t r = below(100);
+        if (r < 60) return 1 + below(512);
+        if (r < 90) return 513 + below(16 * 1024);
+        return 16 * 1024 + below(240 * 1024);
+    }
+
+    void record(void* ptr, size_t size, size_t alignment, uint32_t caps, MemPlacement placement, bool taskOwned) {
+        if (!ptr) {
+            return;
+        }
+        LiveBlock block = { (uint8_t*)ptr, size, alignment, caps, placement, (uint8_t)(1 + below(254)), taskOwned };
+        fillBlock(block);
+        m_live.push_back(block);
+    }
+
+    void freeAt(size_t index) {
+        LiveBlock block = m_live[index];
+        CHECK(blockIntact(block), "释放前块%p内容被覆盖", block.ptr);
+        CHECK(m_manager.deallocate(block.ptr), "释放在用块%p失败", block.ptr);
+        m_live[index] = m_live.back();
+        m_live.pop_back();
+    }
+
+    void step(size_t maxLive) {
+        if (m_live.size() >= maxLive) {
+            freeAt(below(m_live.size()));
+            return;
+        }
+
+        static const uint32_t CAPS[] = {
+            MEM_CAP_ANY, MEM_CAP_SPIRAM, MEM_CAP_INTERNAL, MEM_CAP_DMA, MEM_CAP_DMA | MEM_CAP_SPIRAM
+        };
+        static const size_t ALIGNMENTS[] = { 0, 0, 0, 8, 16, 32, 64, 128 };
+        uint32_t r = below(100);
+
+        if (r < 30) {
+            size_t size = randomSize();
+            record(m_manager.allocate(size, "属性测试", (PSRAMPoolType)below(POOL_COUNT)),
+                   size, 0, MEM_CAP_SPIRAM, MEM_PSRAM_ONLY, false);
+        } else if (r < 45) {
+            uint32_t caps = CAPS[below(sizeof(CAPS) / sizeof(CAPS[0]))];
+            MemPlacement placement = (MemPlacement)below(4);
+            size_t alignment = ALIGNMENTS[below(sizeof(ALIGNMENTS) / sizeof(ALIGNMENTS[0]))];
+            // 内部RAM只有几百KB，需要内部RAM的请求限制在小尺寸
+            size_t size = (caps & MEM_CAP_SPIRAM) ? randomSize() : 1 + below(2048);
+            void* ptr = m_manager.allocateCaps(size, caps, "能力分配", alignment, placement,
+                                               (PSRAMPoolType)below(POOL_COUNT));
+            record(ptr, size, alignment, caps, placement, false);
+        } else if (r < 50) {
+            size_t alignment = (size_t)16 << below(9);
+            size_t size = randomSize();
+            record(m_manager.allocateAligned(size, alignment, POOL_BUFFER), size, alignment,
+                   MEM_CAP_SPIRAM, MEM_PSRAM_ONLY, false);
+        } else if (r < 53) {
+            size_t size = 1 + below(4096);
+            record(m_manager.allocateForTask(size, m_taskName, "任务数据"), size, 0,
+                   MEM_CAP_SPIRAM, MEM_PSRAM_ONLY, true);
+        } else if (r < 54) {
+            // 按任务整体释放，测试记录中同步移除
+            m_manager.deallocateAll(m_taskName);
+            m_live.erase(std::remove_if(m_live.begin(), m_live.end(),
+                                        [](const LiveBlock& b) { return b.taskOwned; }), m_live.end());
+        } else if (r < 57) {
+            PSRAMArenaScope scope(&m_manager);
+            uint32_t n = 1 + below(16);
+            for (uint32_t i = 0; i < n; i++) {
+                size_t size = 1 + below(3000);
+                void* p = scope.alloc(size);
+                CHECK(!p || scope.arena()->owns(p), "临时内存区返回了不属于自己的地址");
+                if (p) {
+                    memset(p, 0xA5, size);
+                }
+            }
+            ArenaJsonDocument doc(1024 + below(8192), scope.jsonAllocator());
+            doc["step"] = n;
+        } else if (r < 59) {
+            // 无效释放不改变任何计数（多线程时其他线程会同时改变计数，只检查返回值）
+            PSRAMStatistics before = m_manager.getStatistics();
+            int onStack = 0;
+            CHECK(!m_manager.deallocate(&onStack), "释放栈地址返回成功");
+            CHECK(!m_manager.deallocate(nullptr), "释放空指针返回成功");
+            PSRAMStatistics after = m_manager.getStatistics();
+            CHECK(!m_exclusive || (before.allocationCount == after.allocationCount && before.freeCount == after.freeCount),
+                  "无效释放改变了计数");
+        } else if (r < 62) {
+            // 注入PSRAM系统堆分配失败：PSRAM_ONLY可以失败，PREFER_PSRAM可以回退到内部RAM
+            hostHeapFailNext(HOST_HEAP_PSRAM, 1 + below(3));
+            size_t size = 5000 + below(60000);
+            void* ptr = m_manager.allocateCaps(size, MEM_CAP_ANY, "注入失败", 0, MEM_PREFER_PSRAM, POOL_COUNT);
+            record(ptr, size, 0, MEM_CAP_ANY, MEM_PREFER_PSRAM, false);
+            hostHeapFailNext(HOST_HEAP_PSRAM, 0);
+        } else {
+            if (!m_live.empty()) {
+                freeAt(below(m_live.size()));
+            }
+        }
+    }
+
+    void freeAll() {
+        while (!m_live.empty()) {
+            freeAt(m_live.size() - 1);
+        }
+    }
+
+private:
+    PSRAMManager& m_manager;
+    std::mt19937 m_rng;
+    const char* m_taskName;
+    bool m_exclusive;           // 只有本对象在使用管理器，可以检查计数不变
+    std::vector<LiveBlock> m_live;
+};
+
+// ==================== 属性测试 ====================
+
+static void reportCase(const char* name, uint32_t checksBefore, uint32_t failuresBefore) {
+    fprintf(s_out, "%s,%u,%u\n", name, s_checks - checksBefore, s_failures - failuresBefore);
+}
+
+#define BEGIN_CASE(name) \
+    s_case = name; \
+    uint32_t caseChecks = s_checks; \
+    uint32_t caseFailures = s_failures
+
+#define END_CASE() reportCase(s_case, caseChecks, caseFailures)
+
+static void finishManager(PSRAMManager& manager, RandomWorkload& workload) {
+    workload.freeAll();
+    manager.deallocateAll("测试任务");
+    verifyConsistency(manager, workload.live(), true);
+    // 剖析报告本身使用临时内存区，检查完再释放
+    manager.releaseTaskArena(xTaskGetCurrentTaskHandle());
+
+    PSRAMStatistics stats = manager.getStatistics();
+    CHECK(stats.allocationCount == stats.freeCount, "全部释放后分配%u != 释放%u",
+          stats.allocationCount, stats.freeCount);
+    CHECK(manager.getBlockCount() == 0, "全部释放后仍有%u块", manager.getBlockCount());
+    for (const PSRAMBlockInfo& block : manager.getAllocatedBlocks()) {
+        fprintf(stderr, "  残留: %p %u字节, 任务: %s, 用途: %s\n", block.address, block.size,
+                manager.getTagName(block.taskTag), manager.getTagName(block.purposeTag));
+    }
+    for (int i = 0; i < MEM_CLASS_COUNT; i++) {
+        MemClassStats cls;
+        manager.getMemClassStats((MemClass)i, &cls);
+        CHECK(cls.liveBytes == 0 && cls.allocs == cls.frees, "%s: 全部释放后在用%zu字节",
+              PSRAMManager::getMemClassName((MemClass)i), cls.liveBytes);
+    }
+}
+
+static void testRandomOps(uint32_t seed, uint32_t steps, bool pools) {
+    BEGIN_CASE(pools ? "random_ops" : "random_ops_no_pools");
+    hostHeapReset();
+    HostHeapStats before[HOST_HEAP_REGION_COUNT];
+    hostHeapGetStats(HOST_HEAP_INTERNAL, &before[HOST_HEAP_INTERNAL]);
+    hostHeapGetStats(HOST_HEAP_PSRAM, &before[HOST_HEAP_PSRAM]);
+    {
+        PSRAMManager manager;
+        CHECK(manager.init(), "初始化失败");
+        if (!pools) {
+            for (int i = 0; i < POOL_COUNT; i++) {
+                manager.destroyPool((PSRAMPoolType)i);
+            }
+        }
+
+        RandomWorkload workload(manager, seed);
+        for (uint32_t i = 0; i < steps; i++) {
+            workload.step(400);
+            if (i % 16 == 0) {
+                verifyConsistency(manager, workload.live(), i % 256 == 0);
+            }
+        }
+        finishManager(manager, workload);
+    }
+    // 管理器析构后跟踪表、剖析器、内存池全部归还，模拟堆回到创建前的状态
+    verifyHeapClean(before);
+    END_CASE();
+}
+
+static void testInjectedFailures() {
+    BEGIN_CASE("injected_failures");
+    hostHeapReset();
+    PSRAMManager manager;
+    manager.init();
+    std::vector<LiveBlock> live;
+
+    // 超出内存池的大块：PSRAM系统堆失败后，PREFER_PSRAM回退到内部RAM并计为回退
+    MemClassStats internalBefore, heapBefore;
+    manager.getMemClassStats(MEM_CLASS_INTERNAL, &internalBefore);
+    manager.getMemClassStats(MEM_CLASS_PSRAM_HEAP, &heapBefore);
+    hostHeapFailNext(HOST_HEAP_PSRAM, 1);
+    void* fallback = manager.allocateCaps(100 * 1024, MEM_CAP_ANY, "回退", 0, MEM_PREFER_PSRAM, POOL_BUFFER);
+    CHECK(fallback && esp_ptr_internal(fallback), "PSRAM失败后没有回退到内部RAM");
+    MemClassStats internalAfter, heapAfter;
+    manager.getMemClassStats(MEM_CLASS_INTERNAL, &internalAfter);
+    manager.getMemClassStats(MEM_CLASS_PSRAM_HEAP, &heapAfter);
+    CHECK(internalAfter.fallbacks == internalBefore.fallbacks + 1, "内部RAM回退次数未增加");
+    CHECK(heapAfter.failures == heapBefore.failures + 1, "PSRAM系统堆失败次数未增加");
+    if (fallback) {
+        live.push_back({ (uint8_t*)fallback, 100 * 1024, 0, MEM_CAP_ANY, MEM_PREFER_PSRAM, 0x11, false });
+        fillBlock(live.back());
+    }
+
+    // 回退到内部RAM时保留MEM_INTERNAL_FALLBACK_RESERVE：超过可用-保留的请求直接失败
+    hostHeapFailNext(HOST_HEAP_PSRAM, 1);
+    size_t tooBig = heap_caps_get_free_size(MALLOC_CAP_INTERNAL) - MEM_INTERNAL_FALLBACK_RESERVE / 2;
+    void* reserved = manager.allocateCaps(tooBig, MEM_CAP_ANY, "保留", 0, MEM_PREFER_PSRAM, POOL_COUNT);
+    CHECK(!reserved, "回退挤占了内部RAM保留区");
+    hostHeapFailNext(HOST_HEAP_PSRAM, 0);
+
+    // PSRAM_ONLY失败返回nullptr，计数不变
+    PSRAMStatistics before = manager.getStatistics();
+    hostHeapFailNext(HOST_HEAP_PSRAM, 1);
+    void* none = manager.allocateCaps(300 * 1024, MEM_CAP_SPIRAM, "失败", 0, MEM_PSRAM_ONLY, POOL_COUNT);
+    CHECK(!none, "PSRAM_ONLY在PSRAM失败时仍返回了地址");
+    PSRAMStatistics after = manager.getStatistics();
+    CHECK(after.allocationCount == before.allocationCount, "失败的分配改变了分配计数");
+
+    // 能力冲突和非法对齐
+    CHECK(!manager.allocateCaps(64, MEM_CAP_SPIRAM | MEM_CAP_INTERNAL, "冲突"), "能力冲突的请求返回了地址");
+    CHECK(!manager.allocateCaps(64, MEM_CAP_ANY, "对齐", 24), "非2的幂对齐返回了地址");
+
+    // 主机上不能创建任务：PSRAM栈必须归还
+    uint32_t blocks = manager.getBlockCount();
+    TaskHandle_t task = manager.createTaskWithPSRAMStack([](void*) {}, "主机任务", 4096, nullptr, 1);
+    CHECK(task == nullptr, "主机上创建任务返回了句柄");
+    CHECK(manager.getBlockCount() == blocks, "任务创建失败后PSRAM栈没有释放");
+
+    // 状态JSON中的计数与getStatistics一致
+    PSRAMStatistics stats = manager.getStatistics();
+    String json = manager.getStatusJSON();
+    char expected[64];
+    snprintf(expected, sizeof(expected), "\"allocationCount\":%u", stats.allocationCount);
+    CHECK(strstr(json.c_str(), expected) != nullptr, "状态JSON的分配次数与统计不一致");
+
+    verifyConsistency(manager, live, true);
+    for (const LiveBlock& block : live) {
+        manager.deallocate(block.ptr);
+    }
+    live.clear();
+    verifyConsistency(manager, live, true);
+    END_CASE();
+}
+
+static void testTrackerOverflow() {
+    BEGIN_CASE("tracker_overflow");
+    hostHeapReset();
+    PSRAMManager manager;
+    manager.init();
+
+    // 超过跟踪表装载上限后新分配不再记录，释放后所有计数仍要归零
+    std::vector<void*> ptrs;
+    for (int i = 0; i < ALLOC_TRACKER_CAPACITY; i++) {
+        void* p = manager.allocateCaps(32 + (i % 8) * 16, MEM_CAP_SPIRAM, "填满跟踪表", 0, MEM_PSRAM_ONLY, POOL_COUNT);
+        CHECK(p != nullptr, "第%d次分配失败", i);
+        if (p) {
+            ptrs.push_back(p);
+        }
+    }
+    AllocTrackerStats tracker;
+    manager.getTrackerStats(&tracker);
+    CHECK(tracker.dropped > 0, "跟踪表没有溢出，测试无效");
+
+    std::vector<LiveBlock> none;
+    verifyConsistency(manager, none, true);
+    for (void* p : ptrs) {
+        CHECK(manager.deallocate(p), "释放%p失败", p);
+    }
+    // 剖析报告在表满时申请的临时内存区块同样未记录，释放后一并归零
+    manager.releaseTaskArena(xTaskGetCurrentTaskHandle());
+
+    PSRAMStatistics stats = manager.getStatistics();
+    CHECK(stats.allocationCount == stats.freeCount, "溢出后分配%u != 释放%u", stats.allocationCount, stats.freeCount);
+    for (int i = 0; i < MEM_CLASS_COUNT; i++) {
+        MemClassStats cls;
+        manager.getMemClassStats((MemClass)i, &cls);
+        CHECK(cls.liveBytes == 0 && cls.allocs == cls.frees, "%s: 溢出后在用%zu字节、分配%u、释放%u",
+              PSRAMManager::getMemClassName((MemClass)i), cls.liveBytes, cls.allocs, cls.frees);
+    }
+    verifyConsistency(manager, none, true);
+    END_CASE();
+}
+
+static void testConcurrent(uint32_t seed, uint32_t steps) {
+    BEGIN_CASE("concurrent");
+    hostHeapReset();
+    PSRAMManager manager;
+    manager.init();
+
+    const int THREADS = 4;
+    std::vector<std::thread> threads;
+    for (int t = 0; t < THREADS; t++) {
+        threads.emplace_back([&manager, seed, steps, t]() {
+            // deallocateAll按任务名释放：每个线程使用自己的名字，且不能与线程名相同（线程名是其他分配的任务标签）
+            char name[16];
+            char owner[32];
+            snprintf(name, sizeof(name), "worker%d", t);
+            snprintf(owner, sizeof(owner), "测试任务%d", t);
+            hostTaskSetName(name);
+            RandomWorkload workload(manager, seed * 31 + t, owner, false);
+            for (uint32_t i = 0; i < steps; i++) {
+                workload.step(100);
+            }
+            workload.freeAll();
+            manager.releaseTaskArena(xTaskGetCurrentTaskHandle());
+        });
+    }
+    for (std::thread& thread : threads) {
+        thread.join();
+    }
+
+    std::vector<LiveBlock> none;
+    verifyConsistency(manager, none, true);
+    manager.releaseTaskArena(xTaskGetCurrentTaskHandle());
+    PSRAMStatistics stats = manager.getStatistics();
+    CHECK(stats.allocationCount == stats.freeCount, "并发后分配%u != 释放%u", stats.allocationCount, stats.freeCount);
+    CHECK(manager.getBlockCount() == 0, "并发后仍有%u块", manager.getBlockCount());
+    verifyHeapClean(nullptr);
+    END_CASE();
+}
+
+static void testTaskArenaRecycle() {
+    BEGIN_CASE("task_arena_recycle");
+    hostHeapReset();
+    PSRAMManager manager;
+    manager.init();
+
+    // 任务反复重建（天气、定位任务的restart/OTA停止）：自行退出的任务在删除前归还，
+    // 被强制删除的任务停在作用域内，由删除方强制归还。槽位和内存块都不能泄漏
+    for (int round = 0; round < PSRAM_ARENA_MAX_TASKS * 3; round++) {
+        const bool forced = round % 2 == 1;
+        TaskHandle_t handle = nullptr;
+        std::thread worker([&manager, &handle, forced]() {
+            handle = xTaskGetCurrentTaskHandle();
+            // 被删除的任务栈上的作用域不会析构，用不析构的存储模拟
+            alignas(PSRAMArenaScope) static unsigned char storage[sizeof(PSRAMArenaScope)];
+            PSRAMArenaScope* scope = new (storage) PSRAMArenaScope(&manager);
+            CHECK(scope->alloc(6000) != nullptr, "临时内存区分配失败");
+            if (!forced) {
+                scope->~PSRAMArenaScope();
+                manager.releaseTaskArena(xTaskGetCurrentTaskHandle());
+            }
+        });
+        worker.join();
+        if (forced) {
+            manager.releaseTaskArena(handle, true);
+        }
+        CHECK(manager.getBlockCount() == 0, "第%d轮任务删除后仍有%u块", round, manager.getBlockCount());
+    }
+
+    // 槽位全部归还：新任务仍能拿到内存区，作用域深度从0开始
+    std::thread fresh([&manager]() {
+        PSRAMArena* arena = manager.getTaskArena();
+        CHECK(arena != nullptr, "任务重建后临时内存区槽位耗尽");
+        if (arena) {
+            PSRAMArenaStats stats;
+            arena->getStats(&stats);
+            CHECK(stats.depth == 0, "复用的槽位作用域深度为%u", stats.depth);
+        }
+        manager.releaseTaskArena(xTaskGetCurrentTaskHandle());
+    });
+    fresh.join();
+
+    PSRAMStatistics stats = manager.getStatistics();
+    CHECK(stats.allocationCount == stats.freeCount, "任务重建后分配%u != 释放%u", stats.allocationCount, stats.freeCount);
+    END_CASE();
+}
+
+static int runTests(uint32_t seed, uint32_t steps) {
+    fprintf(s_out, "case,checks,failures\n");
+    testRandomOps(seed, steps, true);
+    testRandomOps(seed + 1, steps / 2, false);
+    testInjectedFailures();
+    testTrackerOverflow();
+    testConcurrent(seed, steps / 8);
+    testTaskArenaRecycle();
+    return s_failures == 0 ? 0 : 1;
+}
+
+// ==================== 吞吐基准 ====================
+
+static int runThroughput(uint32_t iterations) {
+    static const size_t SIZES[] = { 16, 64, 256, 1024, 4096, 16384, 65536 };
+    const size_t LIVE = 128;
+
+    hostHeapReset();
+    PSRAMManager manager;
+    manager.init();
+    manager.setProfilerEnabled(true);
+    uint16_t tag = manager.internTag("吞吐基准");
+    std::mt19937 rng(1);
+
+    fprintf(s_out, "size,heap_ns,manager_ns,pool_pct,arena_ns\n");
+    for (size_t size : SIZES) {
+        PSRAMPoolType pool = size <= 4096 ? POOL_GENERAL : POOL_BUFFER;
+
+        // 直接使用PSRAM系统堆
+        std::vector<void*> live(LIVE);
+        for (size_t i = 0; i < LIVE; i++) {
+            live[i] = heap_caps_malloc(size, MALLOC_CAP_SPIRAM);
+        }
+        double start = nowNs();
+        for (uint32_t i = 0; i < iterations; i++) {
+            size_t slot = rng() % LIVE;
+            heap_caps_free(live[slot]);
+            live[slot] = heap_caps_malloc(size, MALLOC_CAP_SPIRAM);
+        }
+        double heapNs = (nowNs() - start) / iterations;
+        for (void* p : live) {
+            heap_caps_free(p);
+        }
+
+        // PSRAMManager完整路径：放置策略、内存池、跟踪表、剖析器、统计
+        MemClassStats poolBefore;
+        manager.getMemClassStats(MEM_CLASS_PSRAM_POOL, &poolBefore);
+        for (size_t i = 0; i < LIVE; i++) {
+            live[i] = manager.allocateTagged(size, tag, pool);
+        }
+        start = nowNs();
+        for (uint32_t i = 0; i < iterations; i++) {
+            size_t slot = rng() % LIVE;
+            manager.deallocate(live[slot]);
+            live[slot] = manager.allocateTagged(size, tag, pool);
+        }
+        double managerNs = (nowNs() - start) / iterations;
+        MemClassStats poolAfter;
+        manager.getMemClassStats(MEM_CLASS_PSRAM_POOL, &poolAfter);
+        for (void* p : live) {
+            manager.deallocate(p);
+        }
+        double poolPct = 100.0 * (poolAfter.allocs - poolBefore.allocs) / (iterations + LIVE);
+
+        // 任务临时内存区：每个作用域16次分配后整体回收
+        const uint32_t PER_SCOPE = 16;
+        uint32_t scopes = iterations / PER_SCOPE + 1;
+        start = nowNs();
+        for (uint32_t i = 0; i < scopes; i++) {
+            PSRAMArenaScope scope(&manager);
+            for (uint32_t j = 0; j < PER_SCOPE; j++) {
+                scope.alloc(size);
+            }
+        }
+        double arenaNs = (nowNs() - start) / (scopes * PER_SCOPE);
+
+        fprintf(s_out, "%zu,%.1f,%.1f,%.1f,%.1f\n", size, heapNs, managerNs, poolPct, arenaNs);
+    }
+    manager.releaseTaskArena(xTaskGetCurrentTaskHandle());
+    return 0;
+}
+
+// ==================== 多线程竞争 ====================
+
+static int runThreads(uint32_t iterations) {
+    static const int THREAD_COUNTS[] = { 1, 2, 4, 8 };
+    const size_t LIVE = 64;
+
+    fprintf(s_out, "threads,pairs,wall_ms,pairs_per_sec,ns_per_pair,consistent\n");
+    for (int threadCount : THREAD_COUNTS) {
+        hostHeapReset();
+        PSRAMManager manager;
+        manager.init();
+        uint16_t tag = manager.internTag("竞争基准");
+
+        std::vector<std::thread> threads;
+        double start = nowNs();
+        for (int t = 0; t < threadCount; t++) {
+            threads.emplace_back([&manager, tag, iterations, LIVE, t]() {
+                char name[16];
+                snprintf(name, sizeof(name), "bench%d", t);
+                hostTaskSetName(name);
+                std::mt19937 rng(t + 1);
+                std::vector<void*> live(LIVE, nullptr);
+                for (uint32_t i = 0; i < iterations; i++) {
+                    size_t slot = rng() % LIVE;
+                    manager.deallocate(live[slot]);
+                    // 小对象走通用池，偶尔的大缓冲走缓冲池/系统堆
+                    size_t size = (rng() % 16 == 0) ? 4096 + rng() % 32768 : 16 + rng() % 2048;
+                    live[slot] = manager.allocateTagged(size, tag, size > 4096 ? POOL_BUFFER : POOL_GENERAL);
+                }
+                for (void* p : live) {
+                    manager.deallocate(p);
+                }
+            });
+        }
+        for (std::thread& thread : threads) {
+            thread.join();
+        }
+        double wallNs = nowNs() - start;
+
+        uint32_t failuresBefore = s_failures;
+        s_case = "threads";
+        std::vector<LiveBlock> none;
+        verifyConsistency(manager, none, true);
+        manager.releaseTaskArena(xTaskGetCurrentTaskHandle());
+        PSRAMStatistics stats = manager.getStatistics();
+        CHECK(stats.allocationCount == stats.freeCount, "分配%u != 释放%u", stats.allocationCount, stats.freeCount);
+
+        double pairs = (double)iterations * threadCount;
+        fprintf(s_out, "%d,%.0f,%.1f,%.0f,%.1f,%s\n", threadCount, pairs, wallNs / 1e6,
+                pairs / (wallNs / 1e9), wallNs / pairs, s_failures == failuresBefore ? "yes" : "no");
+    }
+    return s_failures == 0 ? 0 : 1;
+}
+
+// ==================== 碎片基准 ====================
+
+/**
+ * @brief 按设备上的真实用法建模的负载
+ *
+ * - 启动时：LVGL两块PSRAM帧缓冲、两块内部DMA行缓冲
+ * - Web请求（最频繁）：临时内存区 + ArenaJsonDocument，偶尔的大响应缓冲
+ * - 天气刷新：HTTP响应体 → JSON解析 → 替换7天预报数组
+ * - 音频：加载/卸载64~480KB的PCM数据
+ * - 资源包图片：20~200KB的解码图片进入2MB的LRU缓存
+ * - 小对象：各任务16~512字节的长短期对象
+ * - 监控：水位检查、统计和状态JSON
+ */
+class DeviceWorkload {
+public:
+    DeviceWorkload(PSRAMManager& manager, uint32_t seed) : m_manager(manager), m_rng(seed) {}
+
+    ~DeviceWorkload() {
+        for (void* p : m_static) m_manager.deallocate(p);
+        for (auto& entry : m_images) m_manager.deallocate(entry.first);
+        for (void* p : m_small) m_manager.deallocate(p);
+        m_manager.deallocate(m_forecast);
+        m_manager.deallocate(m_pcm);
+    }
+
+    uint32_t failures() const { return m_failures; }
+
+    void boot() {
+        hostTaskSetName("loopTask");
+        const size_t frame = 466 * 466 * 2;
+        for (int i = 0; i < 2; i++) {
+            keep(m_static, m_manager.allocateCaps(frame, MEM_CAP_SPIRAM, "LVGL帧缓冲", 64, MEM_PSRAM_ONLY, POOL_GRAPHICS));
+            keep(m_static, m_manager.allocateDMABuffer(466 * 40 * 2, "LVGL DMA缓冲"));
+        }
+    }
+
+    void step() {
+        uint32_t r = below(100);
+        if (r < 40) {
+            webRequest();
+        } else if (r < 45) {
+            weatherRefresh();
+        } else if (r < 48) {
+            audio();
+        } else if (r < 63) {
+            assetImage();
+        } else if (r < 93) {
+            smallObject();
+        } else {
+            monitor();
+        }
+    }
+
+private:
+    uint32_t below(uint32_t n) { return (uint32_t)(m_rng() % n); }
+
+    void keep(std::vector<void*>& list, void* p) {
+        if (p) {
+            list.push_back(p);
+        } else {
+            m_failures++;
+        }
+    }
+
+    void webRequest() {
+        hostTaskSetName("WebServer");
+        PSRAMArenaScope scope(&m_manager);
+        ArenaJsonDocument doc(2048 + below(14 * 1024), scope.jsonAllocator());
+        JsonArray items = doc.createNestedArray("items");
+        for (uint32_t i = 0, n = below(32); i < n; i++) {
+            JsonObject item = items.createNestedObject();
+            item["id"] = i;
+            item["name"] = "item";
+        }
+        String body;
+        serializeJson(doc, body);
+
+        // 屏幕截图、资源列表等大响应使用独立缓冲
+        if (below(10) == 0) {
+            void* response = m_manager.allocate(32 * 1024 + below(64 * 1024), "HTTP响应", POOL_BUFFER);
+            if (!response) {
+                m_failures++;
+            }
+            m_manager.deallocate(response);
+        }
+    }
+
+    void weatherRefresh() {
+        hostTaskSetName("WeatherTask");
+        void* body = m_manager.allocateDataBuffer(8 * 1024 + below(16 * 1024), "天气HTTP响应");
+        if (!body) {
+            m_failures++;
+            return;
+        }
+        {
+            PSRAMArenaScope scope(&m_manager);
+            ArenaJsonDocument doc(16 * 1024, scope.jsonAllocator());
+            doc["status"] = "1";
+        }
+        m_manager.deallocate(m_forecast);
+        m_forecast = m_manager.allocateDataBuffer(7 * 96, "天气预报数据");
+        if (!m_forecast) {
+            m_failures++;
+        }
+        m_manager.deallocate(body);
+    }
+
+    void audio() {
+        hostTaskSetName("AudioTask");
+        m_manager.deallocate(m_pcm);
+        m_pcm = nullptr;
+        if (below(5) != 0) {
+            m_pcm = m_manager.allocateDataBuffer(64 * 1024 + below(416 * 1024), "音频PCM数据");
+            if (!m_pcm) {
+                m_failures++;
+            }
+        }
+    }
+
+    void assetImage() {
+        hostTaskSetName("DisplayTask");
+        const size_t BUDGET = 2 * 1024 * 1024;
+        size_t size = 20 * 1024 + below(180 * 1024);
+        void* image = m_manager.allocateCaps(size, MEM_CAP_SPIRAM, "资源包图片", 0, MEM_PREFER_PSRAM, POOL_GRAPHICS);
+        if (!image) {
+            m_failures++;
+            return;
+        }
+        m_images.push_back(std::make_pair(image, size));
+        m_imageBytes += size;
+        while (m_imageBytes > BUDGET && !m_images.empty()) {
+            m_imageBytes -= m_images.front().second;
+            m_manager.deallocate(m_images.front().first);
+            m_images.pop_front();
+        }
+    }
+
+    void smallObject() {
+        static const char* TASKS[] = { "loopTask", "WebServer", "WeatherTask", "DisplayTask" };
+        hostTaskSetName(TASKS[below(4)]);
+        if (m_small.size() < 64 || (m_small.size() < 256 && below(2) == 0)) {
+            keep(m_small, m_manager.allocate(16 + below(496), "小对象"));
+        } else {
+            size_t index = below(m_small.size());
+            m_manager.deallocate(m_small[index]);
+            m_small[index] = m_small.back();
+            m_small.pop_back();
+        }
+    }
+
+    void monitor() {
+        hostTaskSetName("PSRAMMonitor");
+        m_manager.relieveMemoryPressure();
+        m_manager.getStatistics();
+        if (below(4) == 0) {
+            m_manager.getStatusJSON();
+        }
+    }
+
+    PSRAMManager& m_manager;
+    std::mt19937 m_rng;
+    std::vector<void*> m_static;
+    std::vector<void*> m_small;
+    std::deque<std::pair<void*, size_t>> m_images;
+    size_t m_imageBytes = 0;
+    void* m_forecast = nullptr;
+    void* m_pcm = nullptr;
+    uint32_t m_failures = 0;
+};
+
+static int runFragmentation(uint32_t seed, uint32_t steps) {
+    fprintf(s_out, "variant,step,psram_free_kb,psram_largest_kb,psram_frag_pct,"
+                   "internal_free_kb,internal_largest_kb,internal_min_free_kb,live_blocks,failures,pool_fallbacks\n");
+    for (int variant = 0; variant < 2; variant++) {
+        bool pools = variant == 0;
+        hostHeapReset();
+        PSRAMManager manager;
+        manager.init();
+        if (!pools) {
+            for (int i = 0; i < POOL_COUNT; i++) {
+                manager.destroyPool((PSRAMPoolType)i);
+            }
+        }
+
+        DeviceWorkload workload(manager, seed);
+        workload.boot();
+        uint32_t interval = steps >= 10 ? steps / 10 : 1;
+        for (uint32_t i = 1; i <= steps; i++) {
+            workload.step();
+            if (i % interval != 0 && i != steps) {
+                continue;
+            }
+
+            HostHeapStats psram, internal;
+            hostHeapGetStats(HOST_HEAP_PSRAM, &psram);
+            hostHeapGetStats(HOST_HEAP_INTERNAL, &internal);
+            uint32_t fallbacks = 0;
+            for (int p = 0; p < POOL_COUNT; p++) {
+                SlabPoolStats pool;
+                if (manager.getPoolStats((PSRAMPoolType)p, &pool)) {
+                    fallbacks += pool.fallbacks;
+                }
+            }
+            fprintf(s_out, "%s,%u,%zu,%zu,%.1f,%zu,%zu,%zu,%u,%u,%u\n", pools ? "pools" : "heap", i,
+                    psram.freeSize / 1024, psram.largestFreeBlock / 1024, hostHeapFragmentation(HOST_HEAP_PSRAM),
+                    internal.freeSize / 1024, internal.largestFreeBlock / 1024, internal.minFreeSize / 1024,
+                    manager.getBlockCount(), workload.failures(), fallbacks);
+        }
+
+        s_case = "frag";
+        std::vector<LiveBlock> none;
+        verifyConsistency(manager, none, true);
+        manager.releaseTaskArena(xTaskGetCurrentTaskHandle());
+    }
+    return s_failures == 0 ? 0 : 1;
+}
+
+// ==================== 入口 ====================
+
+int main(int argc, char** argv) {
+    bool verbose = false;
+    std::vector<const char*> args;
+    for (int i = 1; i < argc; i++) {
+        if (strcmp(argv[i], "-v") == 0) {
+            verbose = true;
+        } else {
+            args.push_back(argv[i]);
+        }
+    }
+    if (args.empty()) {
+        fprintf(stderr, "用法: %s test|bench|threads|frag [参数...] [-v]\n", argv[0]);
+        return 2;
+    }
+
+    // 结果写到原标准输出，PSRAMManager的printf日志丢弃
+    if (!verbose) {
+        fflush(stdout);
+        int fd = dup(STDOUT_FILENO);
+        s_out = fdopen(fd, "w");
+        if (!freopen("/dev/null", "w", stdout)) {
+            s_out = stdout;
+        }
+    }
+
+    const char* mode = args[0];
+    uint32_t a = args.size() > 1 ? (uint32_t)strtoul(args[1], nullptr, 10) : 0;
+    uint32_t b = args.size() > 2 ? (uint32_t)strtoul(args[2], nullptr, 10) : 0;
+    int rc;
+    if (strcmp(mode, "test") == 0) {
+        rc = runTests(a ? a : 1, b ? b : 20000);
+    } else if (strcmp(mode, "bench") == 0) {
+        rc = runThroughput(a ? a : 100000);
+    } else if (strcmp(mode, "threads") == 0) {
+        rc = runThreads(a ? a : 100000);
+    } else if (strcmp(mode, "frag") == 0) {
+        rc = runFragmentation(a ? a : 1, b ? b : 20000);
+    } else {
+        fprintf(stderr, "未知模式: %s\n", mode);
+        rc = 2;
+    }
+
+    fflush(s_out);
+    if (s_failures > 0) {
+        fprintf(stderr, "✗ %u/%u项检查失败\n", s_failures.load(), s_checks.load());
+    }
+    return rc;
+}
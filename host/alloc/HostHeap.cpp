@@ -0,0 +1,439 @@
+/*
+ * HostHeap.cpp - 主机分配器测试用的模拟堆实现
+ * ESP32S3监控项目 - 主机基准
+ *
+ * 实现host/shim中声明的heap_caps_*、esp_ptr_*和ESP内存查询。
+ * 区域能力与设备一致：内部RAM满足INTERNAL/DMA/EXEC/8BIT/32BIT，PSRAM满足SPIRAM/8BIT/32BIT；
+ * 两个区域都满足时（MALLOC_CAP_DEFAULT/8BIT），16KB以下优先内部RAM，更大的优先PSRAM
+ */
+
+#include "HostHeap.h"
+#include "Arduino.h"
+#include "esp_heap_caps.h"
+#include "esp_memory_utils.h"
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+#include <map>
+#include <mutex>
+#include <set>
+#include <unordered_map>
+#include <utility>
+
+namespace {
+
+const size_t BLOCK_HEADER = 8;              // 块头开销（设备上TLSF块头加canary量级）
+const size_t GRANULE = 8;                   // 分配粒度
+const size_t MIN_BLOCK = 16;                // 小于此值的剩余部分不再拆分
+const size_t REGION_ALIGNMENT = 4096;       // 区域基址对齐，保证对齐分配结果与偏移无关
+const size_t ALWAYS_INTERNAL_LIMIT = 16384; // 对应CONFIG_SPIRAM_MALLOC_ALWAYSINTERNAL
+
+const uint32_t REGION_CAPS[HOST_HEAP_REGION_COUNT] = {
+    MALLOC_CAP_INTERNAL | MALLOC_CAP_DMA | MALLOC_CAP_EXEC | MALLOC_CAP_8BIT | MALLOC_CAP_32BIT | MALLOC_CAP_DEFAULT,
+    MALLOC_CAP_SPIRAM | MALLOC_CAP_8BIT | MALLOC_CAP_32BIT | MALLOC_CAP_DEFAULT,
+};
+
+inline size_t alignUp(size_t value, size_t alignment) {
+    return (value + alignment - 1) & ~(alignment - 1);
+}
+
+struct Region {
+    uint8_t* base = nullptr;
+    size_t size = 0;
+    std::map<size_t, size_t> freeByOffset;              // 偏移 -> 长度
+    std::set<std::pair<size_t, size_t>> freeBySize;     // (长度, 偏移)
+    size_t usedBytes = 0;                               // 在用块总长度（含块头）
+    size_t minFree = 0;
+    uint32_t liveBlocks = 0;
+    uint32_t allocCount = 0;
+    uint32_t freeCount = 0;
+    uint32_t failCount = 0;
+    uint32_t badFreeCount = 0;
+    uint32_t failNext = 0;
+
+    void reset(size_t bytes) {
+        free(base);
+        base = bytes > 0 ? (uint8_t*)aligned_alloc(REGION_ALIGNMENT, alignUp(bytes, REGION_ALIGNMENT)) : nullptr;
+        size = base ? bytes : 0;
+        freeByOffset.clear();
+        freeBySize.clear();
+        usedBytes = 0;
+        liveBlocks = allocCount = freeCount = failCount = badFreeCount = failNext = 0;
+        if (size > 0) {
+            insertFree(0, size);
+        }
+        minFree = freeSize();
+    }
+
+    size_t freeSize() const {
+        return size - usedBytes;
+    }
+
+    size_t largestFree() const {
+        if (freeBySize.empty()) {
+            return 0;
+        }
+        size_t len = freeBySize.rbegin()->first;
+        return len > BLOCK_HEADER ? ((len - BLOCK_HEADER) & ~(GRANULE - 1)) : 0;
+    }
+
+    bool contains(const void* ptr) const {
+        return base && (const uint8_t*)ptr >= base && (const uint8_t*)ptr < base + size;
+    }
+
+    void insertFree(size_t offset, size_t length) {
+        freeByOffset[offset] = length;
+        freeBySize.insert(std::make_pair(length, offset));
+    }
+
+    void eraseFree(std::map<size_t, size_t>::iterator it) {
+        freeBySize.erase(std::make_pair(it->second, it->first));
+        freeByOffset.erase(it);
+    }
+
+    // 归还一段空间并与前后相邻的空闲块合并
+    void releaseRange(size_t offset, size_t length) {
+        auto next = freeByOffset.lower_bound(offset);
+        if (next != freeByOffset.end() && offset + length == next->first) {
+            length += next->second;
+            eraseFree(next);
+        }
+        auto prev = freeByOffset.lower_bound(offset);
+        if (prev != freeByOffset.begin()) {
+            --prev;
+            if (prev->first + prev->second == offset) {
+                offset = prev->first;
+                length += prev->second;
+                eraseFree(prev);
+            }
+        }
+        insertFree(offset, length);
+    }
+
+    // good-fit：从能放下的最小空闲块开始找，对齐要求可能让较小的块放不下，继续往大找
+    uint8_t* allocate(size_t size, size_t alignment, size_t* blockOffset, size_t* blockLength) {
+        size_t need = alignUp(size + BLOCK_HEADER, GRANULE);
+        if (need < MIN_BLOCK) {
+            need = MIN_BLOCK;
+        }
+
+        for (auto it = freeBySize.lower_bound(std::make_pair(need, (size_t)0)); it != freeBySize.end(); ++it) {
+            size_t offset = it->second;
+            size_t length = it->first;
+            uintptr_t blockStart = (uintptr_t)base + offset;
+            uintptr_t user = alignUp(blockStart + BLOCK_HEADER, alignment);
+            size_t leading = user - BLOCK_HEADER - blockStart;
+            if (leading > 0 && leading < MIN_BLOCK) {
+                user = alignUp(blockStart + BLOCK_HEADER + MIN_BLOCK, alignment);
+                leading = user - BLOCK_HEADER - blockStart;
+            }
+            size_t start = offset + leading;
+            size_t end = alignUp(start + BLOCK_HEADER + size, GRANULE);
+            if (end - start < MIN_BLOCK) {
+                end = start + MIN_BLOCK;
+            }
+            if (end > offset + length) {
+                continue;
+            }
+
+            eraseFree(freeByOffset.find(offset));
+            if (leading > 0) {
+                insertFree(offset, leading);
+            }
+            size_t trailing = offset + length - end;
+            if (trailing >= MIN_BLOCK) {
+                insertFree(end, trailing);
+            } else {
+                end = offset + length;
+            }
+
+            *blockOffset = start;
+            *blockLength = end - start;
+            usedBytes += end - start;
+            if (freeSize() < minFree) {
+                minFree = freeSize();
+            }
+            liveBlocks++;
+            allocCount++;
+            return (uint8_t*)user;
+        }
+        return nullptr;
+    }
+};
+
+struct Block {
+    HostHeapRegion region;
+    size_t offset;
+    size_t length;
+    size_t size;
+};
+
+std::recursive_mutex s_mutex;
+Region s_regions[HOST_HEAP_REGION_COUNT];
+std::unordered_map<uintptr_t, Block> s_blocks;
+bool s_initialized = false;
+
+void ensureInitialized() {
+    if (!s_initialized) {
+        s_regions[HOST_HEAP_INTERNAL].reset(HOST_HEAP_INTERNAL_SIZE);
+        s_regions[HOST_HEAP_PSRAM].reset(HOST_HEAP_PSRAM_SIZE);
+        s_initialized = true;
+    }
+}
+
+bool regionMatches(int region, uint32_t caps) {
+    return (caps & ~REGION_CAPS[region]) == 0;
+}
+
+void* allocateLocked(size_t size, size_t alignment, uint32_t caps) {
+    ensureInitialized();
+    if (size == 0 || size > (SIZE_MAX >> 1)) {
+        return nullptr;
+    }
+
+    // 两个区域都满足能力时按设备malloc的策略排序
+    int order[HOST_HEAP_REGION_COUNT] = { HOST_HEAP_INTERNAL, HOST_HEAP_PSRAM };
+    if (regionMatches(HOST_HEAP_INTERNAL, caps) && regionMatches(HOST_HEAP_PSRAM, caps) &&
+        size > ALWAYS_INTERNAL_LIMIT) {
+        order[0] = HOST_HEAP_PSRAM;
+        order[1] = HOST_HEAP_INTERNAL;
+    }
+
+    for (int i = 0; i < HOST_HEAP_REGION_COUNT; i++) {
+        int index = order[i];
+        if (!regionMatches(index, caps)) {
+            continue;
+        }
+        Region& region = s_regions[index];
+        if (region.failNext > 0) {
+            region.failNext--;
+            region.failCount++;
+            continue;
+        }
+
+        size_t offset = 0;
+        size_t length = 0;
+        uint8_t* ptr = region.allocate(size, alignment, &offset, &length);
+        if (ptr) {
+            Block block = { (HostHeapRegion)index, offset, length, size };
+            s_blocks[(uintptr_t)ptr] = block;
+            return ptr;
+        }
+        region.failCount++;
+    }
+    return nullptr;
+}
+
+bool freeLocked(void* ptr) {
+    auto it = s_blocks.find((uintptr_t)ptr);
+    if (it == s_blocks.end()) {
+        Region& region = s_regions[s_regions[HOST_HEAP_PSRAM].contains(ptr) ? HOST_HEAP_PSRAM : HOST_HEAP_INTERNAL];
+        region.badFreeCount++;
+        printf("[HostHeap] 释放了无效指针 %p\n", ptr);
+        return false;
+    }
+
+    Region& region = s_regions[it->second.region];
+    region.releaseRange(it->second.offset, it->second.length);
+    region.usedBytes -= it->second.length;
+    region.liveBlocks--;
+    region.freeCount++;
+    s_blocks.erase(it);
+    return true;
+}
+
+size_t sumRegions(uint32_t caps, size_t (*value)(const Region&)) {
+    std::lock_guard<std::recursive_mutex> lock(s_mutex);
+    ensureInitialized();
+    size_t total = 0;
+    for (int i = 0; i < HOST_HEAP_REGION_COUNT; i++) {
+        if (regionMatches(i, caps)) {
+            total += value(s_regions[i]);
+        }
+    }
+    return total;
+}
+
+} // namespace
+
+void hostHeapReset(size_t internalSize, size_t psramSize) {
+    std::lock_guard<std::recursive_mutex> lock(s_mutex);
+    s_blocks.clear();
+    s_regions[HOST_HEAP_INTERNAL].reset(internalSize);
+    s_regions[HOST_HEAP_PSRAM].reset(psramSize);
+    s_initialized = true;
+}
+
+void hostHeapGetStats(HostHeapRegion region, HostHeapStats* stats) {
+    std::lock_guard<std::recursive_mutex> lock(s_mutex);
+    ensureInitialized();
+    const Region& r = s_regions[region];
+    stats->totalSize = r.size;
+    stats->freeSize = r.freeSize();
+    stats->minFreeSize = r.minFree;
+    stats->largestFreeBlock = r.largestFree();
+    stats->liveBlocks = r.liveBlocks;
+    stats->freeBlocks = (uint32_t)r.freeByOffset.size();
+    stats->allocCount = r.allocCount;
+    stats->freeCount = r.freeCount;
+    stats->failCount = r.failCount;
+    stats->badFreeCount = r.badFreeCount;
+}
+
+void hostHeapFailNext(HostHeapRegion region, uint32_t count) {
+    std::lock_guard<std::recursive_mutex> lock(s_mutex);
+    s_regions[region].failNext = count;
+}
+
+float hostHeapFragmentation(HostHeapRegion region) {
+    HostHeapStats stats;
+    hostHeapGetStats(region, &stats);
+    if (stats.freeSize == 0) {
+        return 0.0f;
+    }
+    return 100.0f * (1.0f - (float)stats.largestFreeBlock / (float)stats.freeSize);
+}
+
+extern "C" {
+
+void* heap_caps_malloc(size_t size, uint32_t caps) {
+    std::lock_guard<std::recursive_mutex> lock(s_mutex);
+    return allocateLocked(size, GRANULE, caps);
+}
+
+void* heap_caps_calloc(size_t n, size_t size, uint32_t caps) {
+    if (size != 0 && n > SIZE_MAX / size) {
+        return nullptr;
+    }
+    void* ptr = heap_caps_malloc(n * size, caps);
+    if (ptr) {
+        memset(ptr, 0, n * size);
+    }
+    return ptr;
+}
+
+void* heap_caps_realloc(void* ptr, size_t size, uint32_t caps) {
+    std::lock_guard<std::recursive_mutex> lock(s_mutex);
+    if (!ptr) {
+        return allocateLocked(size, GRANULE, caps);
+    }
+    if (size == 0) {
+        freeLocked(ptr);
+        return nullptr;
+    }
+
+    auto it = s_blocks.find((uintptr_t)ptr);
+    if (it == s_blocks.end()) {
+        freeLocked(ptr);
+        return nullptr;
+    }
+    size_t oldSize = it->second.size;
+    void* moved = allocateLocked(size, GRANULE, caps);
+    if (!moved) {
+        return nullptr;
+    }
+    memcpy(moved, ptr, oldSize < size ? oldSize : size);
+    freeLocked(ptr);
+    return moved;
+}
+
+void* heap_caps_aligned_alloc(size_t alignment, size_t size, uint32_t caps) {
+    if (alignment == 0 || (alignment & (alignment - 1)) != 0) {
+        return nullptr;
+    }
+    std::lock_guard<std::recursive_mutex> lock(s_mutex);
+    return allocateLocked(size, alignment < GRANULE ? GRANULE : alignment, caps);
+}
+
+void heap_caps_free(void* ptr) {
+    if (!ptr) {
+        return;
+    }
+    std::lock_guard<std::recursive_mutex> lock(s_mutex);
+    freeLocked(ptr);
+}
+
+size_t heap_caps_get_free_size(uint32_t caps) {
+    return sumRegions(caps, [](const Region& r) { return r.freeSize(); });
+}
+
+size_t heap_caps_get_total_size(uint32_t caps) {
+    return sumRegions(caps, [](const Region& r) { return r.size; });
+}
+
+size_t heap_caps_get_minimum_free_size(uint32_t caps) {
+    return sumRegions(caps, [](const Region& r) { return r.minFree; });
+}
+
+size_t heap_caps_get_largest_free_block(uint32_t caps) {
+    std::lock_guard<std::recursive_mutex> lock(s_mutex);
+    ensureInitialized();
+    size_t largest = 0;
+    for (int i = 0; i < HOST_HEAP_REGION_COUNT; i++) {
+        if (regionMatches(i, caps) && s_regions[i].largestFree() > largest) {
+            largest = s_regions[i].largestFree();
+        }
+    }
+    return largest;
+}
+
+bool heap_caps_check_integrity_all(bool print_errors) {
+    std::lock_guard<std::recursive_mutex> lock(s_mutex);
+    ensureInitialized();
+
+    // 空闲块两个索引一致、不相邻（已合并），空闲 + 在用 = 区域大小
+    bool ok = true;
+    for (int i = 0; i < HOST_HEAP_REGION_COUNT; i++) {
+        const Region& region = s_regions[i];
+        size_t freeTotal = 0;
+        size_t prevEnd = (size_t)-1;
+        for (const auto& entry : region.freeByOffset) {
+            if (entry.first == prevEnd || !region.freeBySize.count(std::make_pair(entry.second, entry.first))) {
+                ok = false;
+            }
+            prevEnd = entry.first + entry.second;
+            freeTotal += entry.second;
+        }
+        if (region.freeBySize.size() != region.freeByOffset.size() || freeTotal + region.usedBytes != region.size) {
+            ok = false;
+        }
+    }
+
+    size_t used[HOST_HEAP_REGION_COUNT] = { 0, 0 };
+    for (const auto& entry : s_blocks) {
+        used[entry.second.region] += entry.second.length;
+    }
+    for (int i = 0; i < HOST_HEAP_REGION_COUNT; i++) {
+        if (used[i] != s_regions[i].usedBytes) {
+            ok = false;
+        }
+    }
+
+    if (!ok && print_errors) {
+        printf("[HostHeap] 堆完整性检查失败\n");
+    }
+    return ok;
+}
+
+bool esp_ptr_external_ram(const void* ptr) {
+    std::lock_guard<std::recursive_mutex> lock(s_mutex);
+    return s_regions[HOST_HEAP_PSRAM].contains(ptr);
+}
+
+bool esp_ptr_internal(const void* ptr) {
+    std::lock_guard<std::recursive_mutex> lock(s_mutex);
+    return s_regions[HOST_HEAP_INTERNAL].contains(ptr);
+}
+
+} // extern "C"
+
+EspClass ESP;
+
+uint32_t EspClass::getHeapSize() { return heap_caps_get_total_size(MALLOC_CAP_INTERNAL); }
+uint32_t EspClass::getFreeHeap() { return heap_caps_get_free_size(MALLOC_CAP_INTERNAL); }
+uint32_t EspClass::getMinFreeHeap() { return heap_caps_get_minimum_free_size(MALLOC_CAP_INTERNAL); }
+uint32_t EspClass::getMaxAllocHeap() { return heap_caps_get_largest_free_block(MALLOC_CAP_INTERNAL); }
+uint32_t EspClass::getPsramSize() { return heap_caps_get_total_size(MALLOC_CAP_SPIRAM); }
+uint32_t EspClass::getFreePsram() { return heap_caps_get_free_size(MALLOC_CAP_SPIRAM); }
+uint32_t EspClass::getMinFreePsram() { return heap_caps_get_minimum_free_size(MALLOC_CAP_SPIRAM); }
+uint32_t EspClass::getMaxAllocPsram() { return heap_caps_get_largest_free_block(MALLOC_CAP_SPIRAM); }
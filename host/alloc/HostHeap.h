@@ -0,0 +1,71 @@
+/*
+ * HostHeap.h - 主机分配器测试用的模拟堆
+ * ESP32S3监控项目 - 主机基准
+ *
+ * 功能特性：
+ * - 模拟内部RAM和PSRAM两个固定大小的区域，heap_caps_*按MALLOC_CAP_SPIRAM选择区域
+ * - 空闲块按地址和大小双索引：分配取能放下的最小空闲块（接近设备上TLSF的good-fit），
+ *   释放时与相邻空闲块合并，碎片和最大连续块的变化与设备同量级
+ * - 每块计入与设备相近的块头开销和8字节粒度，记录最低空闲
+ * - 全局互斥锁保护，多线程测试可直接使用
+ * - 支持注入分配失败，覆盖PSRAMManager的回退和失败分支
+ *
+ * 仅在定义HOST_ALLOC_SIM时编译，接口实现见HostHeap.cpp
+ */
+
+#ifndef HOST_ALLOC_HOST_HEAP_H
+#define HOST_ALLOC_HOST_HEAP_H
+
+#include <stddef.h>
+#include <stdint.h>
+
+// 模拟堆默认大小（ESP32-S3 N16R8：内部RAM可用约320KB，PSRAM 8MB）
+#define HOST_HEAP_INTERNAL_SIZE     (320 * 1024)
+#define HOST_HEAP_PSRAM_SIZE        (8 * 1024 * 1024)
+
+/**
+ * @brief 模拟堆区域
+ */
+enum HostHeapRegion {
+    HOST_HEAP_INTERNAL = 0,
+    HOST_HEAP_PSRAM,
+    HOST_HEAP_REGION_COUNT
+};
+
+/**
+ * @brief 单个区域的统计
+ */
+struct HostHeapStats {
+    size_t totalSize;           // 区域大小
+    size_t freeSize;            // 当前空闲（不含块头）
+    size_t minFreeSize;         // 历史最低空闲
+    size_t largestFreeBlock;    // 最大可分配连续块
+    uint32_t liveBlocks;        // 在用块数
+    uint32_t freeBlocks;        // 空闲块数（碎片段数）
+    uint32_t allocCount;        // 成功分配次数
+    uint32_t freeCount;         // 释放次数
+    uint32_t failCount;         // 分配失败次数（含注入的失败）
+    uint32_t badFreeCount;      // 释放了不属于堆或已释放的指针
+};
+
+/**
+ * @brief 重建模拟堆（释放原有区域，所有旧指针失效）
+ */
+void hostHeapReset(size_t internalSize = HOST_HEAP_INTERNAL_SIZE, size_t psramSize = HOST_HEAP_PSRAM_SIZE);
+
+/**
+ * @brief 获取区域统计
+ */
+void hostHeapGetStats(HostHeapRegion region, HostHeapStats* stats);
+
+/**
+ * @brief 让区域接下来的count次分配失败
+ */
+void hostHeapFailNext(HostHeapRegion region, uint32_t count);
+
+/**
+ * @brief 碎片率（1 - 最大连续块/空闲，百分比）
+ */
+float hostHeapFragmentation(HostHeapRegion region);
+
+#endif // HOST_ALLOC_HOST_HEAP_H
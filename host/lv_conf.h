@@ -0,0 +1,74 @@
+/*
+ * lv_conf.h - 主机渲染基准的LVGL配置
+ * ESP32S3监控项目 - 主机渲染基准
+ *
+ * 只在Linux主机构建（host_render_bench.py）中使用，设备固件仍使用Arduino库目录中的lv_conf.h。
+ * 颜色格式与SquareLine工程设置一致（ui.c会检查），未列出的选项使用LVGL 8.3的默认值。
+ */
+
+#ifndef LV_CONF_H
+#define LV_CONF_H
+
+#include <stdint.h>
+
+/*====================
+   颜色设置（与设备一致）
+ *====================*/
+#define LV_COLOR_DEPTH 16
+#define LV_COLOR_16_SWAP 1
+#define LV_COLOR_SCREEN_TRANSP 0
+
+/*====================
+   内存设置
+ *====================*/
+// 使用LVGL内置堆，基准通过lv_mem_monitor统计占用和碎片
+#define LV_MEM_CUSTOM 0
+#define LV_MEM_SIZE (512U * 1024U)
+#define LV_MEM_BUF_MAX_NUM 16
+#define LV_MEMCPY_MEMSET_STD 1
+
+/*====================
+   HAL设置
+ *====================*/
+#define LV_DISP_DEF_REFR_PERIOD 16      // 与基准的模拟帧间隔默认值一致
+#define LV_INDEV_DEF_READ_PERIOD 30
+// 时钟由基准按模拟时间调用lv_tick_inc推进，不使用系统时钟
+#define LV_TICK_CUSTOM 0
+#define LV_DPI_DEF 130
+
+/*====================
+   绘制设置
+ *====================*/
+#define LV_DRAW_COMPLEX 1
+#define LV_SHADOW_CACHE_SIZE 0
+#define LV_CIRCLE_CACHE_SIZE 4
+#define LV_IMG_CACHE_DEF_SIZE 0
+#define LV_GRADIENT_MAX_STOPS 2
+#define LV_DISP_ROT_MAX_BUF (10 * 1024)
+
+/*====================
+   日志和调试
+ *====================*/
+#define LV_USE_LOG 0
+#define LV_USE_ASSERT_NULL 1
+#define LV_USE_ASSERT_MALLOC 1
+#define LV_USE_PERF_MONITOR 0
+#define LV_USE_MEM_MONITOR 0
+#define LV_USE_USER_DATA 1
+
+/*====================
+   字体
+ *====================*/
+#define LV_FONT_MONTSERRAT_14 1
+#define LV_FONT_MONTSERRAT_18 1
+#define LV_FONT_MONTSERRAT_20 1
+#define LV_FONT_MONTSERRAT_24 1
+#define LV_FONT_MONTSERRAT_26 1
+#define LV_FONT_DEFAULT &lv_font_montserrat_14
+
+/*====================
+   主题
+ *====================*/
+#define LV_USE_THEME_DEFAULT 1
+
+#endif // LV_CONF_H
@@ -0,0 +1,89 @@
+/*
+ * Arduino.h - 主机构建的Arduino核心替代
+ * ESP32S3监控项目 - 主机分配器测试
+ *
+ * 只提供PSRAMManager及其子模块用到的部分：String、millis/micros、HEX和ESP对象。
+ * ESP的内存查询由host/alloc/HostHeap.cpp根据模拟堆实现
+ */
+
+#ifndef HOST_SHIM_ARDUINO_H
+#define HOST_SHIM_ARDUINO_H
+
+#include <stddef.h>
+#include <stdint.h>
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+#include <time.h>
+#include <string>
+#include "freertos/FreeRTOS.h"
+#include "freertos/task.h"
+
+#define DEC 10
+#define HEX 16
+
+class String {
+public:
+    String(const char* text = "") : m_text(text ? text : "") {}
+    String(const std::string& text) : m_text(text) {}
+    String(int value, unsigned char base = DEC) { format(value < 0, value < 0 ? -(long long)value : value, base); }
+    String(unsigned int value, unsigned char base = DEC) { format(false, value, base); }
+    String(long value, unsigned char base = DEC) { format(value < 0, value < 0 ? -(long long)value : value, base); }
+    String(unsigned long value, unsigned char base = DEC) { format(false, value, base); }
+
+    const char* c_str() const { return m_text.c_str(); }
+    size_t length() const { return m_text.size(); }
+    bool isEmpty() const { return m_text.empty(); }
+    void reserve(size_t size) { m_text.reserve(size); }
+
+    String& operator+=(const String& other) { m_text += other.m_text; return *this; }
+    String& operator+=(const char* other) { m_text += other; return *this; }
+    String& operator+=(char c) { m_text += c; return *this; }
+    String operator+(const String& other) const { return String(m_text + other.m_text); }
+    String operator+(const char* other) const { return String(m_text + other); }
+    bool operator==(const String& other) const { return m_text == other.m_text; }
+    bool operator!=(const String& other) const { return m_text != other.m_text; }
+
+private:
+    void format(bool negative, unsigned long long value, unsigned char base) {
+        char buffer[24];
+        snprintf(buffer, sizeof(buffer), base == HEX ? "%llx" : "%llu", value);
+        m_text = negative ? std::string("-") + buffer : buffer;
+    }
+
+    std::string m_text;
+};
+
+inline String operator+(const char* left, const String& right) {
+    return String(left) + right;
+}
+
+static inline unsigned long micros() {
+    struct timespec ts;
+    clock_gettime(CLOCK_MONOTONIC, &ts);
+    return (unsigned long)((uint64_t)ts.tv_sec * 1000000ULL + ts.tv_nsec / 1000);
+}
+
+static inline unsigned long millis() {
+    return micros() / 1000;
+}
+
+static inline void delay(unsigned long ms) {
+    vTaskDelay(ms);
+}
+
+class EspClass {
+public:
+    uint32_t getHeapSize();
+    uint32_t getFreeHeap();
+    uint32_t getMinFreeHeap();
+    uint32_t getMaxAllocHeap();
+    uint32_t getPsramSize();
+    uint32_t getFreePsram();
+    uint32_t getMinFreePsram();
+    uint32_t getMaxAllocPsram();
+};
+
+extern EspClass ESP;
+
+#endif // HOST_SHIM_ARDUINO_H
@@ -0,0 +1,355 @@
+/*
+ * ArduinoJson.h - 主机构建的ArduinoJson替代
+ * ESP32S3监控项目 - 主机分配器测试
+ *
+ * 只实现PSRAMManager输出状态和剖析报告用到的写入接口：
+ * - JsonDocument/JsonObject/JsonArray/JsonVariant的赋值、嵌套创建和add
+ * - serializeJson/measureJson输出紧凑JSON
+ * - BasicJsonDocument<分配器>按容量向分配器申请一块内存池，和设备上一样占用并归还，
+ *   节点本身用主机new保存（测试只关心分配器行为和输出内容，不模拟ArduinoJson的内部布局）
+ */
+
+#ifndef HOST_SHIM_ARDUINOJSON_H
+#define HOST_SHIM_ARDUINOJSON_H
+
+#include <stddef.h>
+#include <stdint.h>
+#include <stdio.h>
+#include <string>
+#include <type_traits>
+#include <utility>
+#include <vector>
+#include "Arduino.h"
+#include "esp_heap_caps.h"
+
+namespace HostJson {
+
+struct Node {
+    enum Kind { NUL, BOOLEAN, SIGNED, UNSIGNED, REAL, TEXT, OBJECT, ARRAY };
+
+    Kind kind = NUL;
+    bool boolean = false;
+    long long sint = 0;
+    unsigned long long uint = 0;
+    double real = 0;
+    std::string text;
+    std::vector<std::pair<std::string, Node*>> members;
+    std::vector<Node*> items;
+
+    Node() {}
+    Node(const Node&) = delete;
+    Node& operator=(const Node&) = delete;
+    ~Node() { reset(NUL); }
+
+    void reset(Kind newKind) {
+        for (auto& member : members) {
+            delete member.second;
+        }
+        for (Node* item : items) {
+            delete item;
+        }
+        members.clear();
+        items.clear();
+        text.clear();
+        kind = newKind;
+    }
+
+    Node* member(const char* key) {
+        if (kind != OBJECT) {
+            reset(OBJECT);
+        }
+        for (auto& member : members) {
+            if (member.first == key) {
+                return member.second;
+            }
+        }
+        members.emplace_back(key, new Node());
+        return members.back().second;
+    }
+
+    Node* append() {
+        if (kind != ARRAY) {
+            reset(ARRAY);
+        }
+        items.push_back(new Node());
+        return items.back();
+    }
+
+    size_t nodeCount() const {
+        size_t count = 1;
+        for (const auto& member : members) {
+            count += member.second->nodeCount();
+        }
+        for (const Node* item : items) {
+            count += item->nodeCount();
+        }
+        return count;
+    }
+};
+
+inline void setValue(Node* node, bool value) { node->reset(Node::BOOLEAN); node->boolean = value; }
+inline void setValue(Node* node, double value) { node->reset(Node::REAL); node->real = value; }
+inline void setValue(Node* node, const char* value) {
+    if (!value) {
+        node->reset(Node::NUL);
+        return;
+    }
+    node->reset(Node::TEXT);
+    node->text = value;
+}
+inline void setValue(Node* node, const String& value) { setValue(node, value.c_str()); }
+
+template <typename T>
+inline typename std::enable_if<std::is_integral<T>::value && !std::is_same<T, bool>::value>::type
+setValue(Node* node, T value) {
+    if (std::is_signed<T>::value) {
+        node->reset(Node::SIGNED);
+        node->sint = (long long)value;
+    } else {
+        node->reset(Node::UNSIGNED);
+        node->uint = (unsigned long long)value;
+    }
+}
+
+inline void writeText(const std::string& text, std::string& out) {
+    out += '"';
+    for (unsigned char c : text) {
+        switch (c) {
+            case '"':  out += "\\\""; break;
+            case '\\': out += "\\\\"; break;
+            case '\n': out += "\\n"; break;
+            case '\r': out += "\\r"; break;
+            case '\t': out += "\\t"; break;
+            default:
+                if (c < 0x20) {
+                    char escaped[8];
+                    snprintf(escaped, sizeof(escaped), "\\u%04x", c);
+                    out += escaped;
+                } else {
+                    out += (char)c;
+                }
+        }
+    }
+    out += '"';
+}
+
+inline void write(const Node* node, std::string& out) {
+    char number[32];
+    switch (node->kind) {
+        case Node::NUL:
+            out += "null";
+            break;
+        case Node::BOOLEAN:
+            out += node->boolean ? "true" : "false";
+            break;
+        case Node::SIGNED:
+            snprintf(number, sizeof(number), "%lld", node->sint);
+            out += number;
+            break;
+        case Node::UNSIGNED:
+            snprintf(number, sizeof(number), "%llu", node->uint);
+            out += number;
+            break;
+        case Node::REAL:
+            if (node->real != node->real) {
+                out += "null";
+            } else {
+                snprintf(number, sizeof(number), "%.9g", node->real);
+                out += number;
+            }
+            break;
+        case Node::TEXT:
+            writeText(node->text, out);
+            break;
+        case Node::OBJECT:
+            out += '{';
+            for (size_t i = 0; i < node->members.size(); i++) {
+                if (i > 0) {
+                    out += ',';
+                }
+                writeText(node->members[i].first, out);
+                out += ':';
+                write(node->members[i].second, out);
+            }
+            out += '}';
+            break;
+        case Node::ARRAY:
+            out += '[';
+            for (size_t i = 0; i < node->items.size(); i++) {
+                if (i > 0) {
+                    out += ',';
+                }
+                write(node->items[i], out);
+            }
+            out += ']';
+            break;
+    }
+}
+
+} // namespace HostJson
+
+class JsonObject;
+class JsonArray;
+
+class JsonVariant {
+public:
+    explicit JsonVariant(HostJson::Node* node = nullptr) : m_node(node) {}
+
+    template <typename T>
+    JsonVariant& operator=(const T& value) {
+        HostJson::setValue(m_node, value);
+        return *this;
+    }
+
+    JsonVariant operator[](const char* key) const { return JsonVariant(m_node->member(key)); }
+    JsonObject createNestedObject(const char* key) const;
+    JsonArray createNestedArray(const char* key) const;
+    bool isNull() const { return !m_node || m_node->kind == HostJson::Node::NUL; }
+
+private:
+    HostJson::Node* m_node;
+};
+
+class JsonObject {
+public:
+    explicit JsonObject(HostJson::Node* node = nullptr) : m_node(node) {}
+
+    JsonVariant operator[](const char* key) const { return JsonVariant(m_node->member(key)); }
+    JsonObject createNestedObject(const char* key) const {
+        HostJson::Node* child = m_node->member(key);
+        child->reset(HostJson::Node::OBJECT);
+        return JsonObject(child);
+    }
+    JsonArray createNestedArray(const char* key) const;
+    size_t size() const { return m_node->members.size(); }
+
+private:
+    HostJson::Node* m_node;
+};
+
+class JsonArray {
+public:
+    explicit JsonArray(HostJson::Node* node = nullptr) : m_node(node) {}
+
+    template <typename T>
+    bool add(const T& value) const {
+        HostJson::setValue(m_node->append(), value);
+        return true;
+    }
+    JsonObject createNestedObject() const {
+        HostJson::Node* child = m_node->append();
+        child->reset(HostJson::Node::OBJECT);
+        return JsonObject(child);
+    }
+    JsonArray createNestedArray() const {
+        HostJson::Node* child = m_node->append();
+        child->reset(HostJson::Node::ARRAY);
+        return JsonArray(child);
+    }
+    size_t size() const { return m_node->items.size(); }
+
+private:
+    HostJson::Node* m_node;
+};
+
+inline JsonArray JsonObject::createNestedArray(const char* key) const {
+    HostJson::Node* child = m_node->member(key);
+    child->reset(HostJson::Node::ARRAY);
+    return JsonArray(child);
+}
+
+inline JsonObject JsonVariant::createNestedObject(const char* key) const {
+    return JsonObject(m_node).createNestedObject(key);
+}
+
+inline JsonArray JsonVariant::createNestedArray(const char* key) const {
+    return JsonObject(m_node).createNestedArray(key);
+}
+
+class JsonDocument {
+public:
+    JsonDocument(const JsonDocument&) = delete;
+    JsonDocument& operator=(const JsonDocument&) = delete;
+    virtual ~JsonDocument() {}
+
+    JsonVariant operator[](const char* key) { return JsonVariant(m_root.member(key)); }
+    JsonObject createNestedObject(const char* key) { return JsonObject(&m_root).createNestedObject(key); }
+    JsonArray createNestedArray(const char* key) { return JsonObject(&m_root).createNestedArray(key); }
+    void clear() { m_root.reset(HostJson::Node::NUL); }
+
+    size_t capacity() const { return m_capacity; }
+    size_t memoryUsage() const { return m_root.kind == HostJson::Node::NUL ? 0 : m_root.nodeCount() * 16; }
+    bool overflowed() const { return memoryUsage() > m_capacity; }
+
+    const HostJson::Node* root() const { return &m_root; }
+
+protected:
+    JsonDocument() : m_capacity(0) {}
+
+    HostJson::Node m_root;
+    size_t m_capacity;
+};
+
+template <typename TAllocator>
+class BasicJsonDocument : public JsonDocument {
+public:
+    explicit BasicJsonDocument(size_t capacity, TAllocator allocator = TAllocator())
+        : m_allocator(allocator) {
+        m_pool = m_allocator.allocate(capacity);
+        m_capacity = m_pool ? capacity : 0;
+    }
+
+    ~BasicJsonDocument() override {
+        m_allocator.deallocate(m_pool);
+    }
+
+    void shrinkToFit() {
+        size_t used = memoryUsage();
+        if (m_pool && used > 0 && used < m_capacity) {
+            void* shrunk = m_allocator.reallocate(m_pool, used);
+            if (shrunk) {
+                m_pool = shrunk;
+                m_capacity = used;
+            }
+        }
+    }
+
+private:
+    TAllocator m_allocator;
+    void* m_pool;
+};
+
+struct DefaultAllocator {
+    void* allocate(size_t size) { return heap_caps_malloc(size, MALLOC_CAP_DEFAULT); }
+    void deallocate(void* ptr) { heap_caps_free(ptr); }
+    void* reallocate(void* ptr, size_t size) { return heap_caps_realloc(ptr, size, MALLOC_CAP_DEFAULT); }
+};
+
+typedef BasicJsonDocument<DefaultAllocator> DynamicJsonDocument;
+
+inline size_t serializeJson(const JsonDocument& doc, String& output) {
+    std::string text;
+    HostJson::write(doc.root(), text);
+    output = String(text);
+    return text.size();
+}
+
+inline size_t serializeJson(const JsonDocument& doc, char* buffer, size_t size) {
+    std::string text;
+    HostJson::write(doc.root(), text);
+    if (size == 0) {
+        return 0;
+    }
+    size_t length = text.size() < size - 1 ? text.size() : size - 1;
+    memcpy(buffer, text.data(), length);
+    buffer[length] = '\0';
+    return length;
+}
+
+inline size_t measureJson(const JsonDocument& doc) {
+    std::string text;
+    HostJson::write(doc.root(), text);
+    return text.size();
+}
+
+#endif // HOST_SHIM_ARDUINOJSON_H
@@ -0,0 +1,64 @@
+/*
+ * esp_heap_caps.h - 主机构建的heap_caps替代
+ * ESP32S3监控项目 - 主机基准
+ *
+ * 渲染基准：主机上没有PSRAM和内部RAM之分，全部转发到malloc/free。
+ * 分配器测试套件（定义HOST_ALLOC_SIM）：转发到host/alloc/HostHeap.cpp的模拟堆，
+ * 按MALLOC_CAP_SPIRAM区分内部RAM和PSRAM两个区域，空闲大小和最大连续块都是真实计算的
+ */
+
+#ifndef HOST_SHIM_ESP_HEAP_CAPS_H
+#define HOST_SHIM_ESP_HEAP_CAPS_H
+
+#include <stddef.h>
+#include <stdint.h>
+#include <stdlib.h>
+
+#define MALLOC_CAP_EXEC      (1 << 0)
+#define MALLOC_CAP_32BIT     (1 << 1)
+#define MALLOC_CAP_8BIT      (1 << 2)
+#define MALLOC_CAP_DMA       (1 << 3)
+#define MALLOC_CAP_SPIRAM    (1 << 10)
+#define MALLOC_CAP_INTERNAL  (1 << 11)
+#define MALLOC_CAP_DEFAULT   (1 << 12)
+
+#ifdef __cplusplus
+extern "C" {
+#endif
+
+#ifdef HOST_ALLOC_SIM
+
+void* heap_caps_malloc(size_t size, uint32_t caps);
+void* heap_caps_calloc(size_t n, size_t size, uint32_t caps);
+void* heap_caps_realloc(void* ptr, size_t size, uint32_t caps);
+void* heap_caps_aligned_alloc(size_t alignment, size_t size, uint32_t caps);
+void heap_caps_free(void* ptr);
+size_t heap_caps_get_free_size(uint32_t caps);
+size_t heap_caps_get_total_size(uint32_t caps);
+size_t heap_caps_get_minimum_free_size(uint32_t caps);
+size_t heap_caps_get_largest_free_block(uint32_t caps);
+bool heap_caps_check_integrity_all(bool print_errors);
+
+#else
+
+static inline void* heap_caps_malloc(size_t size, unsigned caps) {
+    (void)caps;
+    return malloc(size);
+}
+
+static inline void* heap_caps_calloc(size_t n, size_t size, unsigned caps) {
+    (void)caps;
+    return calloc(n, size);
+}
+
+static inline void heap_caps_free(void* ptr) {
+    free(ptr);
+}
+
+#endif // HOST_ALLOC_SIM
+
+#ifdef __cplusplus
+}
+#endif
+
+#endif // HOST_SHIM_ESP_HEAP_CAPS_H
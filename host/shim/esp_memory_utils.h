@@ -0,0 +1,22 @@
+/*
+ * esp_memory_utils.h - 主机构建的地址范围判断替代
+ * ESP32S3监控项目 - 主机分配器测试
+ *
+ * 按模拟堆的内部RAM/PSRAM区域判断指针归属（实现在host/alloc/HostHeap.cpp）
+ */
+
+#ifndef HOST_SHIM_ESP_MEMORY_UTILS_H
+#define HOST_SHIM_ESP_MEMORY_UTILS_H
+
+#ifdef __cplusplus
+extern "C" {
+#endif
+
+bool esp_ptr_external_ram(const void* ptr);
+bool esp_ptr_internal(const void* ptr);
+
+#ifdef __cplusplus
+}
+#endif
+
+#endif // HOST_SHIM_ESP_MEMORY_UTILS_H
@@ -0,0 +1,11 @@
+/*
+ * esp_psram.h - 主机构建的esp_psram替代
+ * ESP32S3监控项目 - 主机分配器测试
+ *
+ * PSRAMManager只需要头文件存在，PSRAM大小通过ESP.getPsramSize()获取
+ */
+
+#ifndef HOST_SHIM_ESP_PSRAM_H
+#define HOST_SHIM_ESP_PSRAM_H
+
+#endif // HOST_SHIM_ESP_PSRAM_H
@@ -0,0 +1,28 @@
+/*
+ * esp_timer.h - 主机构建的esp_timer替代
+ * ESP32S3监控项目 - 主机渲染基准
+ *
+ * 只提供UI代码用到的esp_timer_get_time，返回单调时钟（微秒）
+ */
+
+#ifndef HOST_SHIM_ESP_TIMER_H
+#define HOST_SHIM_ESP_TIMER_H
+
+#include <stdint.h>
+#include <time.h>
+
+#ifdef __cplusplus
+extern "C" {
+#endif
+
+static inline int64_t esp_timer_get_time(void) {
+    struct timespec ts;
+    clock_gettime(CLOCK_MONOTONIC, &ts);
+    return (int64_t)ts.tv_sec * 1000000 + ts.tv_nsec / 1000;
+}
+
+#ifdef __cplusplus
+}
+#endif
+
+#endif // HOST_SHIM_ESP_TIMER_H
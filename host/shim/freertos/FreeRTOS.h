@@ -0,0 +1,53 @@
+/*
+ * FreeRTOS.h - 主机构建的FreeRTOS替代
+ * ESP32S3监控项目 - 主机基准
+ *
+ * 渲染基准为单线程，只提供自旋锁相关的类型和空操作宏。
+ * 定义HOST_ALLOC_SIM时（分配器测试套件）临界区改为pthread递归互斥锁，
+ * 多线程竞争测试才能真实地串行化PSRAMManager的各把锁
+ */
+
+#ifndef HOST_SHIM_FREERTOS_H
+#define HOST_SHIM_FREERTOS_H
+
+#include <stdint.h>
+
+#ifdef HOST_ALLOC_SIM
+
+#include <pthread.h>
+
+typedef struct {
+    pthread_mutex_t mutex;
+} portMUX_TYPE;
+
+#define portMUX_INITIALIZER_UNLOCKED    { PTHREAD_RECURSIVE_MUTEX_INITIALIZER_NP }
+#define portENTER_CRITICAL(mux)         pthread_mutex_lock(&(mux)->mutex)
+#define portEXIT_CRITICAL(mux)          pthread_mutex_unlock(&(mux)->mutex)
+#define portENTER_CRITICAL_ISR(mux)     portENTER_CRITICAL(mux)
+#define portEXIT_CRITICAL_ISR(mux)      portEXIT_CRITICAL(mux)
+
+typedef uint32_t TickType_t;
+typedef int BaseType_t;
+typedef unsigned int UBaseType_t;
+typedef uint8_t StackType_t;
+
+#define pdFALSE                         0
+#define pdTRUE                          1
+#define pdFAIL                          0
+#define pdPASS                          1
+#define portMAX_DELAY                   ((TickType_t)0xffffffffUL)
+#define portTICK_PERIOD_MS              1
+#define pdMS_TO_TICKS(ms)               ((TickType_t)(ms))
+#define tskNO_AFFINITY                  0x7FFFFFFF
+
+#else
+
+typedef int portMUX_TYPE;
+
+#define portMUX_INITIALIZER_UNLOCKED    0
+#define portENTER_CRITICAL(mux)         ((void)(mux))
+#define portEXIT_CRITICAL(mux)          ((void)(mux))
+
+#endif // HOST_ALLOC_SIM
+
+#endif // HOST_SHIM_FREERTOS_H
@@ -0,0 +1,85 @@
+/*
+ * task.h - 主机构建的FreeRTOS任务替代
+ * ESP32S3监控项目 - 主机分配器测试
+ *
+ * 每个线程对应一个"任务"，任务句柄是线程局部的描述块，名字可由测试设置
+ * （分配跟踪按任务名打标签，任务内存区按句柄区分）。
+ * 主机上不创建真正的任务：创建函数一律返回失败，调用方走失败分支
+ */
+
+#ifndef HOST_SHIM_FREERTOS_TASK_H
+#define HOST_SHIM_FREERTOS_TASK_H
+
+#include "freertos/FreeRTOS.h"
+#include <stdio.h>
+#include <unistd.h>
+
+typedef void* TaskHandle_t;
+typedef void (*TaskFunction_t)(void*);
+
+typedef struct {
+    uint8_t reserved[352];                  // 与设备上TCB大小相近
+} StaticTask_t;
+
+typedef struct {
+    char name[16];
+} HostTask;
+
+// 非static的inline函数在所有编译单元中是同一个实体，线程局部的任务描述块才唯一
+inline HostTask* hostCurrentTask(void) {
+    static thread_local HostTask task = { "loopTask" };
+    return &task;
+}
+
+/**
+ * @brief 设置当前线程的任务名（测试用）
+ */
+static inline void hostTaskSetName(const char* name) {
+    snprintf(hostCurrentTask()->name, sizeof(hostCurrentTask()->name), "%s", name);
+}
+
+static inline TaskHandle_t xTaskGetCurrentTaskHandle(void) {
+    return hostCurrentTask();
+}
+
+static inline const char* pcTaskGetName(TaskHandle_t task) {
+    return task ? ((HostTask*)task)->name : hostCurrentTask()->name;
+}
+
+static inline BaseType_t xTaskCreatePinnedToCore(TaskFunction_t fn, const char* name, uint32_t stackDepth,
+                                                 void* param, UBaseType_t priority, TaskHandle_t* handle,
+                                                 BaseType_t core) {
+    (void)fn; (void)name; (void)stackDepth; (void)param; (void)priority; (void)core;
+    if (handle) {
+        *handle = nullptr;
+    }
+    return pdFAIL;
+}
+
+static inline BaseType_t xTaskCreate(TaskFunction_t fn, const char* name, uint32_t stackDepth,
+                                     void* param, UBaseType_t priority, TaskHandle_t* handle) {
+    return xTaskCreatePinnedToCore(fn, name, stackDepth, param, priority, handle, tskNO_AFFINITY);
+}
+
+static inline TaskHandle_t xTaskCreateStaticPinnedToCore(TaskFunction_t fn, const char* name, uint32_t stackDepth,
+                                                         void* param, UBaseType_t priority, StackType_t* stack,
+                                                         StaticTask_t* tcb, BaseType_t core) {
+    (void)fn; (void)name; (void)stackDepth; (void)param; (void)priority; (void)stack; (void)tcb; (void)core;
+    return nullptr;
+}
+
+static inline TaskHandle_t xTaskCreateStatic(TaskFunction_t fn, const char* name, uint32_t stackDepth,
+                                             void* param, UBaseType_t priority, StackType_t* stack,
+                                             StaticTask_t* tcb) {
+    return xTaskCreateStaticPinnedToCore(fn, name, stackDepth, param, priority, stack, tcb, tskNO_AFFINITY);
+}
+
+static inline void vTaskDelete(TaskHandle_t task) {
+    (void)task;
+}
+
+static inline void vTaskDelay(TickType_t ticks) {
+    usleep((useconds_t)ticks * 1000);
+}
+
+#endif // HOST_SHIM_FREERTOS_TASK_H
@@ -0,0 +1,156 @@
+#!/usr/bin/env python3
+"""
+主机分配器测试和基准工具
+在Linux上编译PSRAM分配相关代码并运行，共五种模式：
+
+- tracker（默认）：编译PSRAMAllocTracker和host/alloc/AllocTrackerBench.cpp，对比PSRAMManager原来的
+  分配跟踪方式（3个字符串 + vector + map，释放时线性查找）和固定容量哈希表 + 整数标签的开销
+- test：编译完整的PSRAMManager（heap_caps_*和FreeRTOS使用host/shim + 模拟堆），运行属性测试，
+  检查随机分配/释放过程中getStatistics()、内存类别/内存池/剖析器统计与跟踪表一致，失败时返回非0
+- bench：各尺寸分配/释放对的耗时（PSRAM系统堆、PSRAMManager、任务临时内存区）
+- threads：1~8个线程同时分配/释放的吞吐，结束后检查统计一致
+- frag：按天气JSON、音频PCM、Web响应、资源包图片等真实用法建模的随机负载，输出碎片变化（内存池开/关）
+
+用法：
+    python3 host_alloc_bench.py [--mode tracker|test|bench|threads|frag|all] [--iterations 200000]
+                                [--seed 1] [--steps 20000] [--sanitize address|thread] [--json 报告.json]
+"""
+
+import csv
+import io
+import json
+import os
+import subprocess
+import sys
+
+ROOT = os.path.dirname(os.path.abspath(__file__))
+HOST_DIR = os.path.join(ROOT, 'host')
+BUILD_DIR = os.path.join(HOST_DIR, 'build')
+SHIM_DIR = os.path.join(HOST_DIR, 'shim')
+
+TRACKER_BINARY = os.path.join(BUILD_DIR, 'host_alloc_bench')
+TRACKER_SOURCES = [
+    os.path.join(HOST_DIR, 'alloc', 'AllocTrackerBench.cpp'),
+    os.path.join(ROOT, 'PSRAMAllocTracker.cpp'),
+]
+
+SUITE_BINARY = os.path.join(BUILD_DIR, 'host_alloc_suite')
+SUITE_SOURCES = [
+    os.path.join(HOST_DIR, 'alloc', 'AllocatorSuite.cpp'),
+    os.path.join(HOST_DIR, 'alloc', 'HostHeap.cpp'),
+    os.path.join(ROOT, 'PSRAMManager.cpp'),
+    os.path.join(ROOT, 'PSRAMSlabPool.cpp'),
+    os.path.join(ROOT, 'PSRAMAllocTracker.cpp'),
+    os.path.join(ROOT, 'PSRAMAllocProfiler.cpp'),
+    os.path.join(ROOT, 'PSRAMArena.cpp'),
+]
+
+CXXFLAGS = ['-O2', '-g', '-std=c++11', '-Wall']
+# 设备代码按32位size_t写printf格式，主机64位下的格式警告不处理
+# PSRAMManager构造函数中的memset(&m_statistics, ...)清零带构造函数的PSRAMStatistics，主机g++报class-memaccess
+SUITE_FLAGS = ['-DHOST_ALLOC_SIM', '-pthread', '-Wno-format', '-Wno-class-memaccess']
+
+MODES = ['tracker', 'test', 'bench', 'threads', 'frag']
+
+def parse_options(args, defaults):
+    """解析--key value形式的参数"""
+    options = dict(defaults)
+    i = 0
+    while i < len(args):
+        arg = args[i]
+        key = arg[2:].replace('-', '_') if arg.startswith('--') else None
+        if key not in options:
+            raise SystemExit(f"❌ 未知参数 {arg}")
+        i += 1
+        if i >= len(args):
+            raise SystemExit(f"❌ 参数 {arg} 缺少值")
+        options[key] = args[i]
+        i += 1
+    return options
+
+def build(name, sources, binary, extra_flags):
+    """编译主机程序"""
+    os.makedirs(BUILD_DIR, exist_ok=True)
+    cmd = ['g++'] + CXXFLAGS + extra_flags + ['-I', ROOT, '-I', SHIM_DIR] + sources + ['-o', binary]
+    print(f"🔨 编译{name}...")
+    if subprocess.run(cmd).returncode != 0:
+        raise SystemExit("❌ 编译失败")
+
+def run(binary, args):
+    """运行并解析CSV输出，返回(行, 是否成功)"""
+    result = subprocess.run([binary] + args, capture_output=True, text=True)
+    sys.stderr.write(result.stderr)
+    rows = list(csv.DictReader(io.StringIO(result.stdout)))
+    return rows, result.returncode == 0
+
+def print_table(rows, columns):
+    """按(字段, 标题, 宽度)列表输出表格"""
+    print()
+    print(' '.join(f"{title:>{width}}" for _, title, width in columns))
+    for row in rows:
+        print(' '.join(f"{row[key]:>{width}}" for key, _, width in columns))
+
+def run_tracker(options):
+    build('分配跟踪基准', TRACKER_SOURCES, TRACKER_BINARY, [])
+    rows, ok = run(TRACKER_BINARY, [options['iterations']])
+    if not ok:
+        raise SystemExit("❌ 基准运行失败")
+    print_table(rows, [('live', '在用块', 8), ('legacy_ns', '原方式(ns)', 12), ('table_ns', '哈希表(ns)', 12),
+                       ('speedup', '加速', 8), ('legacy_heap_allocs', '原堆分配/次', 12),
+                       ('table_heap_allocs', '新堆分配/次', 12)])
+    return rows, ok
+
+def run_suite(mode, options):
+    if mode == 'test':
+        rows, ok = run(SUITE_BINARY, ['test', options['seed'], options['steps']])
+        print_table(rows, [('case', '用例', 22), ('checks', '检查项', 10), ('failures', '失败', 6)])
+        print(f"\n{'✅ 属性测试全部通过' if ok else '❌ 属性测试失败'}")
+    elif mode == 'bench':
+        rows, ok = run(SUITE_BINARY, ['bench', options['iterations']])
+        print_table(rows, [('size', '大小', 8), ('heap_ns', '系统堆(ns)', 12), ('manager_ns', '管理器(ns)', 12),
+                           ('pool_pct', '池命中%', 9), ('arena_ns', '临时区(ns)', 12)])
+    elif mode == 'threads':
+        rows, ok = run(SUITE_BINARY, ['threads', options['iterations']])
+        print_table(rows, [('threads', '线程', 6), ('pairs', '分配/释放对', 12), ('wall_ms', '耗时(ms)', 10),
+                           ('pairs_per_sec', '对/秒', 12), ('ns_per_pair', 'ns/对', 9), ('consistent', '统计一致', 8)])
+    else:
+        rows, ok = run(SUITE_BINARY, ['frag', options['seed'], options['steps']])
+        print_table(rows, [('variant', '方案', 6), ('step', '步数', 7), ('psram_free_kb', 'PSRAM空闲KB', 12),
+                           ('psram_largest_kb', '最大块KB', 9), ('psram_frag_pct', '碎片%', 7),
+                           ('internal_free_kb', '内部空闲KB', 11), ('internal_largest_kb', '内部最大KB', 11),
+                           ('live_blocks', '在用块', 7), ('failures', '失败', 5), ('pool_fallbacks', '池回退', 7)])
+    if not ok and mode != 'test':
+        print(f"❌ {mode}运行失败或统计不一致")
+    return rows, ok
+
+def main():
+    options = parse_options(sys.argv[1:], {'mode': 'tracker', 'iterations': '200000', 'seed': '1',
+                                           'steps': '20000', 'sanitize': '', 'json': ''})
+    modes = MODES if options['mode'] == 'all' else [options['mode']]
+    for mode in modes:
+        if mode not in MODES:
+            raise SystemExit(f"❌ 未知模式 {mode}")
+
+    if any(mode != 'tracker' for mode in modes):
+        flags = list(SUITE_FLAGS)
+        if options['sanitize']:
+            flags += ['-O1', f"-fsanitize={options['sanitize']}"]
+        build('分配器测试套件', SUITE_SOURCES, SUITE_BINARY, flags)
+
+    report = {}
+    all_ok = True
+    for mode in modes:
+        rows, ok = run_tracker(options) if mode == 'tracker' else run_suite(mode, options)
+        report[mode] = rows
+        all_ok = all_ok and ok
+
+    if options['json']:
+        with open(options['json'], 'w', encoding='utf-8') as f:
+            json.dump(report if len(modes) > 1 else report[modes[0]], f, ensure_ascii=False, indent=2)
+        print(f"📄 报告已保存: {options['json']}")
+
+    if not all_ok:
+        sys.exit(1)
+
+if __name__ == '__main__':
+    main()
@@ -0,0 +1,262 @@
+#!/usr/bin/env python3
+"""
+内存剖析快照分析工具
+解析设备 /api/memory/profile.bin 导出的二进制快照（格式见PSRAMAllocProfiler.cpp），打印尺寸/存活时间直方图、
+按用途和任务的统计、疑似泄漏和堆水位历史；对比两份快照时按用途列出在用字节和老块的变化，用于定位长时间运行的缓慢泄漏。
+
+用法：
+    python3 host_memprof.py 快照.bin [--json 报告.json]
+    python3 host_memprof.py http://设备IP [--save 快照.bin] [--json 报告.json]
+    python3 host_memprof.py diff 旧快照.bin 新快照.bin
+"""
+
+import json
+import struct
+import sys
+import urllib.request
+
+MAGIC = 0x4650524D
+VERSION = 1
+
+HEADER = struct.Struct('<IHHII7I6IBBHHH')
+TAG_STATS = struct.Struct('<6IQ')
+LEAK = struct.Struct('<4IBB')
+HEAP_SAMPLE = struct.Struct('<6I')
+
+STAT_FIELDS = ('allocs', 'frees', 'liveCount', 'liveBytes', 'peakBytes', 'maxLifetimeMs', 'lifetimeSumMs')
+HEAP_FIELDS = ('uptimeSec', 'internalFree', 'internalMinFree', 'internalLargest', 'psramFree', 'liveBytes')
+LIFETIME_LABELS = ('<10ms', '<100ms', '<1s', '<10s', '<1分钟', '<10分钟', '<1小时', '<1天', '≥1天')
+
+def parse_options(args, defaults):
+    """解析位置参数和--key value形式的参数"""
+    options = dict(defaults)
+    positional = []
+    i = 0
+    while i < len(args):
+        arg = args[i]
+        if not arg.startswith('--'):
+            positional.append(arg)
+            i += 1
+            continue
+        key = arg[2:].replace('-', '_')
+        if key not in options:
+            raise SystemExit(f"❌ 未知参数 {arg}")
+        if i + 1 >= len(args):
+            raise SystemExit(f"❌ 参数 {arg} 缺少值")
+        options[key] = args[i + 1]
+        i += 2
+    return positional, options
+
+def load(source, save=''):
+    """读取快照文件，或从设备下载"""
+    if source.startswith('http://') or source.startswith('https://'):
+        url = source.rstrip('/')
+        if not url.endswith('.bin'):
+            url += '/api/memory/profile.bin'
+        print(f"📥 下载快照: {url}")
+        with urllib.request.urlopen(url, timeout=10) as resp:
+            data = resp.read()
+        if save:
+            with open(save, 'wb') as f:
+                f.write(data)
+            print(f"💾 快照已保存: {save}")
+        return data
+    with open(source, 'rb') as f:
+        return f.read()
+
+def size_label(cls, count):
+    """尺寸级别标签：≤16B, ≤32B ... ≤1MB, >1MB"""
+    if cls == count - 1:
+        return f">{fmt_bytes(16 << (cls - 1))}"
+    return f"≤{fmt_bytes(16 << cls)}"
+
+def fmt_bytes(n):
+    if n >= 1024 * 1024:
+        return f"{n / 1024 / 1024:.1f}MB" if n % (1024 * 1024) else f"{n // 1024 // 1024}MB"
+    if n >= 1024:
+        return f"{n / 1024:.1f}KB" if n % 1024 else f"{n // 1024}KB"
+    return f"{n}B"
+
+def fmt_ms(ms):
+    if ms >= 86400000:
+        return f"{ms / 86400000:.1f}天"
+    if ms >= 3600000:
+        return f"{ms / 3600000:.1f}小时"
+    if ms >= 60000:
+        return f"{ms / 60000:.1f}分钟"
+    if ms >= 1000:
+        return f"{ms / 1000:.1f}秒"
+    return f"{ms}ms"
+
+def decode(data):
+    """解析二进制快照"""
+    if len(data) < HEADER.size:
+        raise SystemExit("❌ 快照长度不足")
+    h = HEADER.unpack_from(data, 0)
+    if h[0] != MAGIC:
+        raise SystemExit(f"❌ 快照标识错误: 0x{h[0]:08x}")
+    if h[1] != VERSION:
+        raise SystemExit(f"❌ 不支持的快照版本: {h[1]}")
+
+    (_, _, flags, uptime, since, allocs, frees, live_count, live_bytes, peak, scans, psram_min) = h[:12]
+    current = dict(zip(HEAP_FIELDS, h[12:18]))
+    size_classes, lifetime_classes, tag_count, sample_count, leak_window = h[18:23]
+    off = HEADER.size
+
+    def u32s(n):
+        nonlocal off
+        values = list(struct.unpack_from(f'<{n}I', data, off))
+        off += 4 * n
+        return values
+
+    size_allocs = u32s(size_classes)
+    size_live = u32s(size_classes)
+    lifetimes = u32s(lifetime_classes)
+
+    tags = []
+    for _ in range(tag_count):
+        tag, name_len = struct.unpack_from('<HB', data, off)
+        off += 3
+        name = data[off:off + name_len].decode('utf-8', errors='replace')
+        off += name_len
+        purpose = dict(zip(STAT_FIELDS, TAG_STATS.unpack_from(data, off)))
+        off += TAG_STATS.size
+        task = dict(zip(STAT_FIELDS, TAG_STATS.unpack_from(data, off)))
+        off += TAG_STATS.size
+        old_bytes, old_count, oldest, growth, fill, suspected = LEAK.unpack_from(data, off)
+        off += LEAK.size
+        tags.append({
+            'tag': tag, 'name': name, 'purpose': purpose, 'task': task,
+            'leak': {'oldBytes': old_bytes, 'oldCount': old_count, 'oldestAgeMs': oldest,
+                     'growthBytes': growth, 'windowFill': fill, 'suspected': bool(suspected)},
+        })
+
+    samples = []
+    for _ in range(sample_count):
+        samples.append(dict(zip(HEAP_FIELDS, HEAP_SAMPLE.unpack_from(data, off))))
+        off += HEAP_SAMPLE.size
+
+    return {
+        'enabled': bool(flags & 1), 'uptimeSec': uptime, 'sinceSec': since,
+        'allocs': allocs, 'frees': frees, 'liveCount': live_count, 'liveBytes': live_bytes,
+        'peakLiveBytes': peak, 'leakScans': scans, 'leakWindow': leak_window, 'psramMinFree': psram_min,
+        'current': current,
+        'sizeHistogram': [{'label': size_label(i, size_classes), 'allocs': size_allocs[i], 'live': size_live[i]}
+                          for i in range(size_classes)],
+        'lifetimeHistogram': [{'label': LIFETIME_LABELS[i] if i < len(LIFETIME_LABELS) else str(i), 'frees': lifetimes[i]}
+                              for i in range(lifetime_classes)],
+        'tags': tags, 'heapHistory': samples,
+    }
+
+def avg_lifetime(stats):
+    return stats['lifetimeSumMs'] // stats['frees'] if stats['frees'] else 0
+
+def report(p):
+    """打印单份快照"""
+    up = p['uptimeSec']
+    print(f"\n📊 运行 {up // 86400}天{up % 86400 // 3600}小时{up % 3600 // 60}分钟，剖析{'开启' if p['enabled'] else '关闭'}，"
+          f"计数自 {p['sinceSec']}s 起")
+    print(f"   分配 {p['allocs']}  释放 {p['frees']}  在用 {p['liveCount']}块/{fmt_bytes(p['liveBytes'])}  "
+          f"峰值 {fmt_bytes(p['peakLiveBytes'])}  泄漏检查 {p['leakScans']}次")
+    c = p['current']
+    print(f"   内部RAM 空闲 {fmt_bytes(c['internalFree'])}  最低 {fmt_bytes(c['internalMinFree'])}  "
+          f"最大块 {fmt_bytes(c['internalLargest'])}  |  PSRAM 空闲 {fmt_bytes(c['psramFree'])}  最低 {fmt_bytes(p['psramMinFree'])}")
+
+    print(f"\n{'尺寸':>8} {'累计分配':>10} {'在用':>8}")
+    for cls in p['sizeHistogram']:
+        if cls['allocs'] or cls['live']:
+            print(f"{cls['label']:>8} {cls['allocs']:>10} {cls['live']:>8}")
+
+    print(f"\n{'存活时间':>8} {'释放数':>10}")
+    for cls in p['lifetimeHistogram']:
+        print(f"{cls['label']:>8} {cls['frees']:>10}")
+
+    purposes = sorted((t for t in p['tags'] if t['purpose']['allocs'] or t['purpose']['liveCount']),
+                      key=lambda t: t['purpose']['liveBytes'], reverse=True)
+    print(f"\n{'用途':<20} {'在用':>12} {'峰值':>9} {'分配':>8} {'释放':>8} {'平均存活':>9} {'老块':>12} {'增长':>9}")
+    for t in purposes:
+        s, leak = t['purpose'], t['leak']
+        flag = ' ⚠' if leak['suspected'] else ''
+        print(f"{t['name']:<20} {s['liveCount']:>4}/{fmt_bytes(s['liveBytes']):>7} {fmt_bytes(s['peakBytes']):>9} "
+              f"{s['allocs']:>8} {s['frees']:>8} {fmt_ms(avg_lifetime(s)):>9} "
+              f"{leak['oldCount']:>4}/{fmt_bytes(leak['oldBytes']):>7} {fmt_bytes(leak['growthBytes']):>9}{flag}")
+
+    tasks = sorted((t for t in p['tags'] if t['task']['allocs'] or t['task']['liveCount']),
+                   key=lambda t: t['task']['liveBytes'], reverse=True)
+    print(f"\n{'任务':<20} {'在用':>12} {'峰值':>9} {'分配':>8} {'释放':>8}")
+    for t in tasks:
+        s = t['task']
+        print(f"{t['name']:<20} {s['liveCount']:>4}/{fmt_bytes(s['liveBytes']):>7} {fmt_bytes(s['peakBytes']):>9} "
+              f"{s['allocs']:>8} {s['frees']:>8}")
+
+    suspects = [t for t in p['tags'] if t['leak']['suspected']]
+    if suspects:
+        print(f"\n⚠ 疑似泄漏（老块连续{p['leakWindow']}次检查只增不减）:")
+        for t in suspects:
+            leak = t['leak']
+            print(f"   {t['name']}: 老块 {leak['oldCount']}块/{fmt_bytes(leak['oldBytes'])}，"
+                  f"窗口内增长 {fmt_bytes(leak['growthBytes'])}，最老 {fmt_ms(leak['oldestAgeMs'])}")
+    else:
+        print("\n✅ 没有疑似泄漏")
+
+    history = p['heapHistory']
+    if len(history) >= 2:
+        first, last = history[0], history[-1]
+        hours = max(last['uptimeSec'] - first['uptimeSec'], 1) / 3600
+        print(f"\n📉 堆水位历史 {len(history)}条，跨度 {hours:.1f}小时：")
+        for key, label in (('internalFree', '内部RAM空闲'), ('internalLargest', '内部RAM最大块'),
+                           ('psramFree', 'PSRAM空闲'), ('liveBytes', '跟踪在用')):
+            delta = last[key] - first[key]
+            print(f"   {label:<10} {fmt_bytes(first[key]):>9} → {fmt_bytes(last[key]):>9}  "
+                  f"({'+' if delta >= 0 else '-'}{fmt_bytes(abs(delta))}, {delta / hours:+.0f}B/小时)")
+
+def diff(old, new):
+    """对比两份快照：按用途列出在用字节和老块的变化"""
+    hours = max(new['uptimeSec'] - old['uptimeSec'], 1) / 3600
+    print(f"\n🔍 快照间隔 {hours:.1f}小时（{old['uptimeSec']}s → {new['uptimeSec']}s）")
+    if new['uptimeSec'] < old['uptimeSec']:
+        print("⚠ 新快照的运行时间更短，两次快照之间设备已重启")
+
+    old_tags = {t['name']: t for t in old['tags']}
+    rows = []
+    for t in new['tags']:
+        prev = old_tags.get(t['name'])
+        live_before = prev['purpose']['liveBytes'] if prev else 0
+        old_before = prev['leak']['oldBytes'] if prev else 0
+        rows.append((t['name'], live_before, t['purpose']['liveBytes'], old_before, t['leak']['oldBytes']))
+    rows.sort(key=lambda r: r[2] - r[1], reverse=True)
+
+    print(f"\n{'用途':<20} {'在用(旧)':>10} {'在用(新)':>10} {'变化':>10} {'每小时':>10} {'老块变化':>10}")
+    for name, a, b, oa, ob in rows:
+        if a == b and oa == ob:
+            continue
+        d = b - a
+        print(f"{name:<20} {fmt_bytes(a):>10} {fmt_bytes(b):>10} {('+' if d >= 0 else '-') + fmt_bytes(abs(d)):>10} "
+              f"{d / hours:>+9.0f}B {('+' if ob >= oa else '-') + fmt_bytes(abs(ob - oa)):>10}")
+
+    for key, label in (('internalFree', '内部RAM空闲'), ('internalMinFree', '内部RAM最低空闲'), ('psramFree', 'PSRAM空闲')):
+        d = new['current'][key] - old['current'][key]
+        print(f"   {label:<12} {fmt_bytes(old['current'][key]):>9} → {fmt_bytes(new['current'][key]):>9}  "
+              f"({d / hours:+.0f}B/小时)")
+
+def main():
+    positional, options = parse_options(sys.argv[1:], {'json': '', 'save': ''})
+    if not positional:
+        raise SystemExit(__doc__)
+
+    if positional[0] == 'diff':
+        if len(positional) != 3:
+            raise SystemExit("❌ 用法: host_memprof.py diff 旧快照.bin 新快照.bin")
+        diff(decode(load(positional[1])), decode(load(positional[2])))
+        return
+
+    profile = decode(load(positional[0], options['save']))
+    report(profile)
+
+    if options['json']:
+        with open(options['json'], 'w', encoding='utf-8') as f:
+            json.dump(profile, f, ensure_ascii=False, indent=2)
+        print(f"📄 报告已保存: {options['json']}")
+
+if __name__ == '__main__':
+    main()
@@ -0,0 +1,388 @@
+#!/usr/bin/env python3
+"""
+主机渲染基准工具
+在Linux上编译UI（ui*.c、ui2*.c、字体、图片）、RLEImageDecoder和PowerDisplayUpdater，
+链接LVGL 8.3和内存帧缓冲区显示驱动（host/HostRenderBench.cpp），回放功率记录并统计每帧的
+渲染耗时、刷新面积和LVGL堆占用，用于在相同条件下比较渲染优化前后的效果。
+
+需要LVGL 8.3.11源码（与设备相同的版本），通过--lvgl或环境变量LVGL_DIR指定：
+    git clone -b v8.3.11 https://github.com/lvgl/lvgl.git ../lvgl
+
+用法：
+    python3 host_render_bench.py build [--lvgl DIR]
+    python3 host_render_bench.py run 功率记录.csv [--theme 1|2] [--screen total] [--frame-ms 16]
+                                     [--stripe-lines 112] [--png-dir DIR] [--png-every N] [--json 报告.json]
+    python3 host_render_bench.py compare 基准.json 新报告.json [--threshold 10]
+    python3 host_render_bench.py diff a.png b.png
+    python3 host_render_bench.py record http://小电拼地址/metrics.json 功率记录.csv [--interval 1] [--count 300]
+
+功率记录格式（文本，每行一个样本，#开头为注释）：
+    t_ms  state fc_protocol voltage(mV) current(mA)  ×4个端口
+    例：1000 ATTACHED 18 9000 2000 ACTIVE 255 0 0 ACTIVE 255 0 0 ACTIVE 255 0 0
+host/traces/下有示例记录。
+
+compare在渲染耗时p95或平均刷新像素增加超过阈值时返回1，可直接用于CI。
+"""
+
+import glob
+import json
+import math
+import os
+import struct
+import subprocess
+import sys
+import time
+import urllib.request
+import zlib
+from concurrent.futures import ThreadPoolExecutor
+
+ROOT = os.path.dirname(os.path.abspath(__file__))
+HOST_DIR = os.path.join(ROOT, 'host')
+BUILD_DIR = os.path.join(HOST_DIR, 'build')
+BINARY = os.path.join(BUILD_DIR, 'host_render_bench')
+
+# 参与主机构建的工程源文件（设备相关的bsp驱动不参与）
+PROJECT_SOURCES = [
+    'ui.c', 'ui_*.c', 'ui2.c', 'ui2_*.c', 'lv_i18n.c',
+    'RLEImageDecoder.cpp', 'PowerDisplayUpdater.cpp',
+    'host/*.cpp',
+]
+
+CFLAGS = ['-O2', '-g', '-DLV_CONF_INCLUDE_SIMPLE', '-Wno-unused-parameter']
+CXXFLAGS = CFLAGS + ['-std=c++11']
+
+def parse_options(args, defaults):
+    """解析--key value形式的参数，返回(选项, 位置参数)"""
+    options = dict(defaults)
+    positional = []
+    i = 0
+    while i < len(args):
+        arg = args[i]
+        if arg.startswith('--'):
+            key = arg[2:].replace('-', '_')
+            if key not in options:
+                raise SystemExit(f"❌ 未知参数 {arg}")
+            if isinstance(options[key], bool):
+                options[key] = True
+            else:
+                i += 1
+                if i >= len(args):
+                    raise SystemExit(f"❌ 参数 {arg} 缺少值")
+                options[key] = args[i]
+        else:
+            positional.append(arg)
+        i += 1
+    return options, positional
+
+def find_lvgl(lvgl_dir):
+    """查找LVGL源码目录（包含lvgl.h和src/）"""
+    candidates = [lvgl_dir, os.environ.get('LVGL_DIR'),
+                  os.path.join(ROOT, '..', 'lvgl'),
+                  os.path.expanduser('~/Arduino/libraries/lvgl')]
+    for path in candidates:
+        if path and os.path.isfile(os.path.join(path, 'lvgl.h')) and os.path.isdir(os.path.join(path, 'src')):
+            return os.path.abspath(path)
+    return None
+
+def collect_sources(lvgl):
+    """收集LVGL和工程源文件"""
+    sources = []
+    for pattern in PROJECT_SOURCES:
+        sources.extend(sorted(glob.glob(os.path.join(ROOT, pattern))))
+    for dirpath, _, filenames in os.walk(os.path.join(lvgl, 'src')):
+        for name in sorted(filenames):
+            if name.endswith('.c'):
+                sources.append(os.path.join(dirpath, name))
+    return sources
+
+def compile_one(source, lvgl):
+    """编译单个源文件（目标文件比源文件新时跳过），返回(目标文件, 错误信息)"""
+    rel = os.path.relpath(source, ROOT if source.startswith(ROOT) else lvgl)
+    prefix = 'project' if source.startswith(ROOT) else 'lvgl'
+    obj = os.path.join(BUILD_DIR, prefix, rel.replace(os.sep, '_') + '.o')
+    if os.path.exists(obj) and os.path.getmtime(obj) >= os.path.getmtime(source):
+        return obj, None
+
+    is_cpp = source.endswith('.cpp')
+    compiler = os.environ.get('CXX', 'c++') if is_cpp else os.environ.get('CC', 'cc')
+    flags = CXXFLAGS if is_cpp else CFLAGS
+    # host/shim和host/lv_conf.h优先于工程目录，替代ESP-IDF头文件
+    includes = ['-I' + os.path.join(HOST_DIR, 'shim'), '-I' + HOST_DIR, '-I' + ROOT,
+                '-I' + lvgl, '-I' + os.path.dirname(lvgl)]
+    os.makedirs(os.path.dirname(obj), exist_ok=True)
+    result = subprocess.run([compiler] + flags + includes + ['-c', source, '-o', obj],
+                            capture_output=True, text=True)
+    if result.returncode != 0:
+        return obj, result.stderr
+    return obj, None
+
+def build(lvgl_dir=None):
+    """编译主机基准程序，返回可执行文件路径"""
+    lvgl = find_lvgl(lvgl_dir)
+    if not lvgl:
+        raise SystemExit("❌ 未找到LVGL源码，请用--lvgl或LVGL_DIR指定LVGL 8.3.11目录")
+
+    # lv_conf.h变化时全部重新编译
+    conf_mtime = os.path.getmtime(os.path.join(HOST_DIR, 'lv_conf.h'))
+    if os.path.exists(BINARY) and os.path.getmtime(BINARY) < conf_mtime:
+        for obj in glob.glob(os.path.join(BUILD_DIR, '*', '*.o')):
+            os.remove(obj)
+
+    sources = collect_sources(lvgl)
+    print(f"🔨 编译 {len(sources)} 个源文件（LVGL: {lvgl}）")
+    start = time.time()
+    with ThreadPoolExecutor(max_workers=os.cpu_count() or 4) as pool:
+        results = list(pool.map(lambda s: compile_one(s, lvgl), sources))
+
+    errors = [err for _, err in results if err]
+    if errors:
+        print(errors[0])
+        raise SystemExit(f"❌ 编译失败（{len(errors)}个文件）")
+
+    objects = [obj for obj, _ in results]
+    linker = os.environ.get('CXX', 'c++')
+    result = subprocess.run([linker] + objects + ['-o', BINARY, '-lm'], capture_output=True, text=True)
+    if result.returncode != 0:
+        print(result.stderr)
+        raise SystemExit("❌ 链接失败")
+
+    print(f"✅ 编译完成：{os.path.relpath(BINARY, ROOT)}（{time.time() - start:.1f}s）")
+    return BINARY
+
+def percentile(values, p):
+    """计算百分位数（最近秩）"""
+    if not values:
+        return 0
+    ordered = sorted(values)
+    index = min(len(ordered) - 1, max(0, math.ceil(p / 100.0 * len(ordered)) - 1))
+    return ordered[index]
+
+def summarize(frames, meta):
+    """汇总逐帧结果"""
+    render = [f['render_us'] for f in frames]
+    pixels = [f['pixels'] for f in frames]
+    # 第一帧为整屏渲染，单独统计，不计入增量帧
+    updates = frames[1:] if len(frames) > 1 else frames
+    update_render = [f['render_us'] for f in updates]
+    update_pixels = [f['pixels'] for f in updates]
+    return {
+        'config': meta,
+        'frames': len(frames),
+        'first_frame_us': render[0] if render else 0,
+        'render_us': {
+            'avg': round(sum(update_render) / len(update_render), 1) if update_render else 0,
+            'p50': percentile(update_render, 50),
+            'p95': percentile(update_render, 95),
+            'max': max(update_render) if update_render else 0,
+        },
+        'pixels': {
+            'avg': round(sum(update_pixels) / len(update_pixels), 1) if update_pixels else 0,
+            'max': max(update_pixels) if update_pixels else 0,
+            'total': sum(pixels),
+        },
+        'flushes_avg': round(sum(f['flushes'] for f in updates) / len(updates), 2) if updates else 0,
+        'mem_peak': max((f['mem_max_used'] for f in frames), default=0),
+        'mem_frag_max': max((f['mem_frag_pct'] for f in frames), default=0),
+    }
+
+def run(args):
+    """编译并运行基准，打印汇总，可选写出JSON报告"""
+    options, positional = parse_options(args, {
+        'lvgl': None, 'theme': '1', 'screen': 'total', 'frame_ms': '16', 'stripe_lines': '112',
+        'png_dir': None, 'png_every': '0', 'json': None, 'all_frames': False,
+    })
+    if len(positional) != 1:
+        raise SystemExit("❌ 用法：host_render_bench.py run 功率记录.csv [选项]")
+
+    binary = build(options['lvgl'])
+    cmd = [binary, positional[0], '--theme', options['theme'], '--screen', options['screen'],
+           '--frame-ms', options['frame_ms'], '--stripe-lines', options['stripe_lines']]
+    if options['png_dir']:
+        os.makedirs(options['png_dir'], exist_ok=True)
+        cmd += ['--png-dir', options['png_dir'], '--png-every', options['png_every']]
+    if options['all_frames']:
+        cmd.append('--all-frames')
+
+    result = subprocess.run(cmd, capture_output=True, text=True)
+    if result.returncode != 0:
+        print(result.stdout + result.stderr)
+        raise SystemExit("❌ 基准运行失败")
+
+    frames = []
+    meta = {}
+    header = None
+    for line in result.stdout.splitlines():
+        if line.startswith('#'):
+            for item in line[1:].split():
+                if '=' in item:
+                    key, value = item.split('=', 1)
+                    meta[key] = int(value) if value.isdigit() else value
+            continue
+        if header is None:
+            header = line.split(',')
+            continue
+        frames.append(dict(zip(header, (int(v) for v in line.split(',')))))
+
+    report = summarize(frames, meta)
+    print(f"📊 主题UI{meta.get('theme')} / {meta.get('screen')}：{report['frames']}帧，"
+          f"构建界面 {meta.get('build_us', 0) / 1000:.1f}ms，首帧 {report['first_frame_us'] / 1000:.2f}ms")
+    print(f"   渲染耗时 avg {report['render_us']['avg']:.0f}us  p50 {report['render_us']['p50']}us  "
+          f"p95 {report['render_us']['p95']}us  max {report['render_us']['max']}us")
+    print(f"   刷新像素 avg {report['pixels']['avg']:.0f}  max {report['pixels']['max']}  "
+          f"平均刷新次数 {report['flushes_avg']}")
+    print(f"   LVGL堆峰值 {report['mem_peak'] / 1024:.1f}KB  最大碎片 {report['mem_frag_max']}%")
+
+    if options['json']:
+        report['frames_detail'] = frames
+        with open(options['json'], 'w', encoding='utf-8') as f:
+            json.dump(report, f, ensure_ascii=False, indent=2)
+        print(f"💾 报告已写入 {options['json']}")
+    return 0
+
+def compare(args):
+    """比较两份报告，渲染耗时p95或平均刷新像素增加超过阈值时返回1"""
+    options, positional = parse_options(args, {'threshold': '10'})
+    if len(positional) != 2:
+        raise SystemExit("❌ 用法：host_render_bench.py compare 基准.json 新报告.json")
+    threshold = float(options['threshold'])
+    with open(positional[0], encoding='utf-8') as f:
+        base = json.load(f)
+    with open(positional[1], encoding='utf-8') as f:
+        new = json.load(f)
+
+    metrics = [
+        ('渲染耗时avg(us)', base['render_us']['avg'], new['render_us']['avg'], False),
+        ('渲染耗时p95(us)', base['render_us']['p95'], new['render_us']['p95'], True),
+        ('渲染耗时max(us)', base['render_us']['max'], new['render_us']['max'], False),
+        ('首帧(us)', base['first_frame_us'], new['first_frame_us'], False),
+        ('刷新像素avg', base['pixels']['avg'], new['pixels']['avg'], True),
+        ('刷新次数avg', base['flushes_avg'], new['flushes_avg'], False),
+        ('LVGL堆峰值(B)', base['mem_peak'], new['mem_peak'], False),
+    ]
+
+    regressed = False
+    print(f"{'指标':<16}{'基准':>12}{'新':>12}{'变化':>10}")
+    for name, old, cur, gated in metrics:
+        change = (cur - old) * 100.0 / old if old else 0.0
+        flag = ''
+        if gated and change > threshold:
+            flag = ' ❌'
+            regressed = True
+        print(f"{name:<16}{round(old, 1):>12}{round(cur, 1):>12}{change:>+9.1f}%{flag}")
+
+    if regressed:
+        print(f"❌ 超过阈值{threshold}%")
+        return 1
+    print("✅ 未超过阈值")
+    return 0
+
+def read_png(path):
+    """读取host_render_bench生成的8位RGB PNG（过滤类型0），返回(宽, 高, 像素字节)"""
+    with open(path, 'rb') as f:
+        data = f.read()
+    if data[:8] != b'\x89PNG\r\n\x1a\n':
+        raise SystemExit(f"❌ {path} 不是PNG文件")
+    pos = 8
+    idat = b''
+    width = height = 0
+    while pos < len(data):
+        length, kind = struct.unpack('>I4s', data[pos:pos + 8])
+        body = data[pos + 8:pos + 8 + length]
+        if kind == b'IHDR':
+            width, height, depth, color = struct.unpack('>IIBB', body[:10])
+            if depth != 8 or color != 2:
+                raise SystemExit(f"❌ {path} 不是8位RGB格式")
+        elif kind == b'IDAT':
+            idat += body
+        pos += 12 + length
+    raw = zlib.decompress(idat)
+    stride = width * 3 + 1
+    rows = []
+    for y in range(height):
+        row = raw[y * stride:(y + 1) * stride]
+        if row[0] != 0:
+            raise SystemExit(f"❌ {path} 使用了不支持的过滤类型")
+        rows.append(row[1:])
+    return width, height, b''.join(rows)
+
+def diff(args):
+    """比较两张PNG，输出不同像素数和外接矩形"""
+    if len(args) != 2:
+        raise SystemExit("❌ 用法：host_render_bench.py diff a.png b.png")
+    w1, h1, a = read_png(args[0])
+    w2, h2, b = read_png(args[1])
+    if (w1, h1) != (w2, h2):
+        print(f"❌ 尺寸不同：{w1}x{h1} / {w2}x{h2}")
+        return 1
+
+    count = 0
+    x1, y1, x2, y2 = w1, h1, -1, -1
+    for i in range(0, len(a), 3):
+        if a[i:i + 3] != b[i:i + 3]:
+            count += 1
+            x, y = (i // 3) % w1, (i // 3) // w1
+            x1, y1, x2, y2 = min(x1, x), min(y1, y), max(x2, x), max(y2, y)
+
+    if count == 0:
+        print("✅ 画面一致")
+        return 0
+    print(f"❌ {count}个像素不同（{count * 100.0 / (w1 * h1):.2f}%），区域 ({x1},{y1})-({x2},{y2})")
+    return 1
+
+def record(args):
+    """轮询小电拼的metrics.json，按功率记录格式写出"""
+    options, positional = parse_options(args, {'interval': '1', 'count': '0'})
+    if len(positional) != 2:
+        raise SystemExit("❌ 用法：host_render_bench.py record URL 功率记录.csv")
+    url, out_path = positional
+    interval = float(options['interval'])
+    count = int(options['count'])
+
+    start = time.time()
+    samples = 0
+    with open(out_path, 'w', encoding='utf-8') as out:
+        out.write(f"# 录制自 {url}，间隔{interval}s\n")
+        out.write("# t_ms  state fc_protocol voltage(mV) current(mA) x4\n")
+        try:
+            while count == 0 or samples < count:
+                tick = time.time()
+                try:
+                    with urllib.request.urlopen(url, timeout=5) as resp:
+                        metrics = json.load(resp)
+                except (OSError, ValueError) as e:
+                    print(f"⚠️ 读取失败：{e}")
+                    time.sleep(interval)
+                    continue
+
+                # 端口ID与Monitor::processPortData一致（1-4）
+                ports = {p.get('id'): p for p in metrics.get('ports', [])}
+                fields = [str(int((tick - start) * 1000))]
+                for port_id in range(1, 5):
+                    port = ports.get(port_id, {})
+                    fields += [str(port.get('state') or 'UNKNOWN'), str(port.get('fc_protocol', 255)),
+                               str(port.get('voltage', 0)), str(port.get('current', 0))]
+                out.write(' '.join(fields) + '\n')
+                out.flush()
+                samples += 1
+                print(f"\r📥 已录制 {samples} 个样本", end='', flush=True)
+                time.sleep(max(0.0, interval - (time.time() - tick)))
+        except KeyboardInterrupt:
+            pass
+    print(f"\n✅ 已写入 {out_path}")
+    return 0
+
+def main():
+    commands = {
+        'build': lambda args: (build(parse_options(args, {'lvgl': None})[0]['lvgl']), 0)[1],
+        'run': run,
+        'compare': compare,
+        'diff': diff,
+        'record': record,
+    }
+    if len(sys.argv) < 2 or sys.argv[1] not in commands:
+        print(__doc__)
+        return 2
+    return commands[sys.argv[1]](sys.argv[2:])
+
+if __name__ == '__main__':
+    sys.exit(main())
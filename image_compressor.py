@@ -0,0 +1,232 @@
+#!/usr/bin/env python3
+"""
+SquareLine图片资源压缩工具
+将SquareLine Studio导出的ui_img_*.c / ui2_img_*.c图片数组转换为按行RLE压缩格式，
+由固件中的RLEImageDecoder解码（LV_IMG_CF_USER_ENCODED_0）。
+
+每次从SquareLine Studio重新导出UI后运行一次：
+    python3 image_compressor.py            # 压缩当前目录下所有图片文件
+    python3 image_compressor.py --check    # 只统计，不修改文件
+    python3 image_compressor.py ui_img_411710101.c ...
+
+压缩数据格式（小端）：
+    [0..3]   'R' 'L' 'E' 版本号(1)
+    [4..]    uint32 行偏移表，共h项（相对像素流起点）
+    [...]    像素流，每行独立编码，由若干数据包组成：
+             头字节bit7=1：重复包，(头字节&0x7F)+1个相同像素，后跟1个像素
+             头字节bit7=0：原样包，头字节+1个像素，后跟对应个数的像素
+    像素为2字节RGB565，字节序与SquareLine导出的数据一致（已包含LV_COLOR_16_SWAP处理）
+
+只处理完全不透明的TRUE_COLOR_ALPHA图片（丢弃alpha通道）；含透明像素的图片保持原样。
+压缩后不小于原始数据的图片转换为不带alpha的LV_IMG_CF_TRUE_COLOR。
+"""
+
+import glob
+import re
+import struct
+import sys
+
+RLE_MAGIC = b'RLE\x01'
+RLE_MAX_PACKET = 128
+BYTES_PER_LINE = 48
+
+def format_size(size_bytes):
+    """格式化大小显示"""
+    if size_bytes >= 1024 * 1024:
+        return f"{size_bytes / (1024 * 1024):.1f}MB"
+    elif size_bytes >= 1024:
+        return f"{size_bytes / 1024:.1f}KB"
+    else:
+        return f"{size_bytes}B"
+
+def parse_image_file(text):
+    """解析SquareLine图片源文件，返回名称、宽高、颜色格式和数据"""
+    name_match = re.search(r'const\s+lv_img_dsc_t\s+(\w+)\s*=', text)
+    data_match = re.search(r'uint8_t\s+(\w+)_data\[\]\s*=\s*\{(.*?)\};', text, re.S)
+    w_match = re.search(r'\.header\.w\s*=\s*(\d+)', text)
+    h_match = re.search(r'\.header\.h\s*=\s*(\d+)', text)
+    cf_match = re.search(r'\.header\.cf\s*=\s*(\w+)', text)
+
+    if not (name_match and data_match and w_match and h_match and cf_match):
+        return None
+
+    data = bytes(int(x, 16) for x in re.findall(r'0x([0-9A-Fa-f]{2})', data_match.group(2)))
+
+    return {
+        'name': name_match.group(1),
+        'width': int(w_match.group(1)),
+        'height': int(h_match.group(1)),
+        'cf': cf_match.group(1),
+        'data': data,
+        'header': text[:data_match.start()],
+    }
+
+def encode_row(pixels):
+    """按PackBits方式编码一行像素（像素为2字节bytes）"""
+    out = bytearray()
+    literal = []
+    i = 0
+    n = len(pixels)
+
+    def flush_literal():
+        while literal:
+            chunk = literal[:RLE_MAX_PACKET]
+            del literal[:RLE_MAX_PACKET]
+            out.append(len(chunk) - 1)
+            for p in chunk:
+                out.extend(p)
+
+    while i < n:
+        run = 1
+        while i + run < n and run < RLE_MAX_PACKET and pixels[i + run] == pixels[i]:
+            run += 1
+
+        # 两个相同像素的重复包（3字节）不比原样包（4字节，可与相邻原样包合并）划算太多，
+        # 至少3个才单独成包
+        if run >= 3:
+            flush_literal()
+            out.append(0x80 | (run - 1))
+            out.extend(pixels[i])
+            i += run
+        else:
+            literal.append(pixels[i])
+            i += 1
+
+    flush_literal()
+    return bytes(out)
+
+def encode_rle(width, height, rgb565):
+    """压缩整幅图片，返回完整的RLE数据"""
+    offsets = []
+    stream = bytearray()
+    row_bytes = width * 2
+
+    for y in range(height):
+        row = rgb565[y * row_bytes:(y + 1) * row_bytes]
+        pixels = [row[x * 2:x * 2 + 2] for x in range(width)]
+        offsets.append(len(stream))
+        stream.extend(encode_row(pixels))
+
+    return RLE_MAGIC + struct.pack(f'<{height}I', *offsets) + bytes(stream)
+
+def decode_rle(width, height, blob):
+    """解码RLE数据（用于校验）"""
+    stream_start = 4 + height * 4
+    offsets = struct.unpack_from(f'<{height}I', blob, 4)
+    out = bytearray()
+
+    for y in range(height):
+        pos = stream_start + offsets[y]
+        remaining = width
+        while remaining > 0:
+            hdr = blob[pos]
+            pos += 1
+            count = (hdr & 0x7F) + 1
+            if hdr & 0x80:
+                out.extend(blob[pos:pos + 2] * count)
+                pos += 2
+            else:
+                out.extend(blob[pos:pos + count * 2])
+                pos += count * 2
+            remaining -= count
+
+    return bytes(out)
+
+def format_array(data):
+    """按SquareLine的数组风格格式化字节数据"""
+    lines = []
+    for i in range(0, len(data), BYTES_PER_LINE):
+        chunk = data[i:i + BYTES_PER_LINE]
+        lines.append('    ' + ''.join(f'0x{b:02X},' for b in chunk))
+    return '\n'.join(lines)
+
+def write_image_file(filename, image, cf, data, comment):
+    """生成图片源文件，保留原文件头部（注释、include和源图片说明）"""
+    name = image['name']
+    text = (f"{image['header']}uint8_t {name}_data[] = {{\n"
+            f"{format_array(data)}\n"
+            f"}};\n"
+            f"const lv_img_dsc_t {name} = {{\n"
+            f"    .header.always_zero = 0,\n"
+            f"    .header.w = {image['width']},\n"
+            f"    .header.h = {image['height']},\n"
+            f"    .data_size = sizeof({name}_data),\n"
+            f"    .header.cf = {cf},    // {comment}\n"
+            f"    .data = {name}_data\n"
+            f"}};\n")
+
+    with open(filename, 'w', encoding='utf-8') as f:
+        f.write(text)
+
+def compress_image_file(filename, check_only):
+    """压缩单个图片文件，返回(原始大小, 压缩后大小)"""
+    with open(filename, 'r', encoding='utf-8') as f:
+        text = f.read()
+
+    image = parse_image_file(text)
+    if not image:
+        print(f"⚠️  {filename}: 无法解析，跳过")
+        return None
+
+    original_size = len(image['data'])
+
+    if image['cf'] != 'LV_IMG_CF_TRUE_COLOR_ALPHA':
+        print(f"⏭️  {filename}: 格式为{image['cf']}，已处理或不支持，跳过")
+        return (original_size, original_size)
+
+    width, height, data = image['width'], image['height'], image['data']
+    if len(data) != width * height * 3:
+        print(f"⚠️  {filename}: 数据长度与16位色深TRUE_COLOR_ALPHA不符，跳过")
+        return (original_size, original_size)
+
+    if any(data[i] != 0xFF for i in range(2, len(data), 3)):
+        print(f"⏭️  {filename}: 含透明像素，保持原样")
+        return (original_size, original_size)
+
+    # 丢弃alpha通道
+    rgb565 = bytearray()
+    for i in range(0, len(data), 3):
+        rgb565 += data[i:i + 2]
+    rgb565 = bytes(rgb565)
+
+    blob = encode_rle(width, height, rgb565)
+    if decode_rle(width, height, blob) != rgb565:
+        print(f"❌ {filename}: RLE校验失败，保持原样")
+        return (original_size, original_size)
+
+    if len(blob) < len(rgb565):
+        cf, out, comment = 'LV_IMG_CF_USER_ENCODED_0', blob, 'RLE压缩，由RLEImageDecoder解码'
+    else:
+        cf, out, comment = 'LV_IMG_CF_TRUE_COLOR', rgb565, '不透明图片，已去除alpha通道'
+
+    print(f"✅ {filename}: {width}x{height} {format_size(original_size)} -> {format_size(len(out))} "
+          f"({len(out) * 100.0 / original_size:.1f}%, {cf})")
+
+    if not check_only:
+        write_image_file(filename, image, cf, out, comment)
+
+    return (original_size, len(out))
+
+if __name__ == "__main__":
+    args = [a for a in sys.argv[1:] if not a.startswith('--')]
+    check_only = '--check' in sys.argv
+
+    files = args if args else sorted(glob.glob('ui_img_*.c') + glob.glob('ui2_img_*.c'))
+
+    print("🗜️  SquareLine图片资源压缩工具")
+    print("=" * 50)
+
+    total_before = 0
+    total_after = 0
+    for filename in files:
+        result = compress_image_file(filename, check_only)
+        if result:
+            total_before += result[0]
+            total_after += result[1]
+
+    print("-" * 50)
+    if total_before:
+        print(f"图片数据总计: {format_size(total_before)} -> {format_size(total_after)} "
+              f"(节省 {format_size(total_before - total_after)})")
+    if check_only:
+        print("（--check模式，未修改文件）")
@@ -6,11 +6,12 @@
  * - 提供触摸状态检测和坐标读取功能
  * - 支持单点触摸检测
  * - 适配368x448分辨率的LCD显示屏
+ * - TP_INT中断驱动：无触摸时不访问I2C，中断到来后才读取坐标
  * 
  * 硬件连接：
  * - SCL: GPIO_14 (I2C时钟线)
  * - SDA: GPIO_15 (I2C数据线)  
- * - INT: GPIO_21 (中断引脚，可选)
+ * - INT: GPIO_21 (中断引脚，触摸期间保持低电平)
  * - RST: 未使用
  */
 
@@ -19,6 +20,8 @@
 #include "touch_bsp.h"           // 触摸BSP头文件
 #include "I2CBusManager.h"       // 使用统一的I2C总线管理器
 #include "esp_log.h"             // ESP日志系统
+#include "esp_timer.h"           // 中断延迟统计
+#include "driver/gpio.h"         // TP_INT中断引脚
 
 // === 硬件配置定义 ===
 #define EXAMPLE_PIN_NUM_TOUCH_INT (GPIO_NUM_21)  // 中断引脚
@@ -29,6 +32,22 @@
 
 // === FT3168触摸控制器参数 ===
 #define I2C_ADDR_FT3168 0x38                     // FT3168的I2C设备地址
+#define FT3168_REG_DEV_MODE   0x00               // 工作模式寄存器
+#define FT3168_REG_TD_STATUS  0x02               // 触摸点数寄存器（0x02开始连续读出一次报点）
+#define FT3168_REG_G_MODE     0xA4               // 中断模式：0查询模式（触摸期间INT保持低电平），1触发模式
+#define FT3168_REPORT_LEN     5                  // TD_STATUS + P1_XH/XL/YH/YL
+#define FT3168_EVENT_LIFT_UP  1                  // P1_XH[7:6]事件标志：抬起
+
+// === 中断驱动读取状态 ===
+static volatile bool s_irq_enabled = false;      // TP_INT中断是否配置成功（失败时退回I2C轮询）
+static volatile bool s_irq_pending = false;      // 中断到来后尚未读取坐标
+static volatile int64_t s_irq_time_us = 0;       // 最近一次中断时间（延迟统计用）
+static touch_irq_callback_t s_irq_callback = NULL;  // 回调和参数成对修改，受s_irq_spinlock保护
+static void *s_irq_callback_arg = NULL;
+static portMUX_TYPE s_irq_spinlock = portMUX_INITIALIZER_UNLOCKED;
+static touch_report_t s_last_report = {0};       // 最近一次读到的报点
+static touch_stats_t s_stats = {0};
+static portMUX_TYPE s_stats_spinlock = portMUX_INITIALIZER_UNLOCKED;
 
 // === 日志标签 ===
 static const char *TAG = "TOUCH_BSP";
@@ -37,6 +56,9 @@ static const char *TAG = "TOUCH_BSP";
 uint8_t I2C_writr_buff(uint8_t addr, uint8_t reg, uint8_t *buf, uint8_t len);
 uint8_t I2C_read_buff(uint8_t addr, uint8_t reg, uint8_t *buf, uint8_t len);
 uint8_t I2C_master_write_read_device(uint8_t addr, uint8_t *writeBuf, uint8_t writeLen, uint8_t *readBuf, uint8_t readLen);
+#if TOUCH_USE_INTERRUPT
+static void Touch_InitInterrupt(void);
+#endif
 
 /**
  * @brief 初始化触摸屏接口
@@ -73,7 +95,124 @@ void Touch_Init(void)
     ESP_LOGE(TAG, "FT3168触摸控制器初始化失败: %s", esp_err_to_name(ret));
   }
   
-  ESP_LOGI(TAG, "触摸屏初始化完成（使用I2CBusManager）");
+#if TOUCH_USE_INTERRUPT
+  Touch_InitInterrupt();
+#endif
+  
+  ESP_LOGI(TAG, "触摸屏初始化完成（使用I2CBusManager，%s）", s_irq_enabled ? "TP_INT中断驱动" : "I2C轮询");
+}
+
+#if TOUCH_USE_INTERRUPT
+/**
+ * @brief TP_INT中断服务函数
+ * 
+ * 只记录"有新报点"并通知等待的任务，坐标在任务上下文中读取（I2C不能在ISR中访问）。
+ */
+static void IRAM_ATTR touch_int_isr(void *arg)
+{
+  if (!s_irq_pending) {
+    s_irq_time_us = esp_timer_get_time();
+    s_irq_pending = true;
+  }
+  portENTER_CRITICAL_ISR(&s_stats_spinlock);
+  s_stats.irq_count++;
+  portEXIT_CRITICAL_ISR(&s_stats_spinlock);
+  
+  // 在锁内调用：另一个核上的Touch_SetIrqCallback()返回后，不会再有中断使用旧的回调和参数
+  portENTER_CRITICAL_ISR(&s_irq_spinlock);
+  if (s_irq_callback) {
+    s_irq_callback(s_irq_callback_arg);
+  }
+  portEXIT_CRITICAL_ISR(&s_irq_spinlock);
+}
+
+/**
+ * @brief 配置FT3168中断模式和TP_INT引脚
+ * 
+ * FT3168切换到查询中断模式（G_MODE=0）：有手指时INT保持低电平，抬起后恢复高电平，
+ * 因此引脚电平本身就能判断触摸状态，按下沿触发中断唤醒LVGL任务。
+ * 写入失败或回读不一致时保持原有的I2C轮询方式。
+ */
+static void Touch_InitInterrupt(void)
+{
+  uint8_t g_mode[2] = {FT3168_REG_G_MODE, 0x00};
+  uint8_t readback = 0xFF;
+  esp_err_t ret = I2CBus_Write(I2C_ADDR_FT3168, g_mode, 2, 1000);
+  if (ret == ESP_OK) {
+    ret = I2CBus_WriteRead(I2C_ADDR_FT3168, (uint8_t[]){FT3168_REG_G_MODE}, 1, &readback, 1, 1000);
+  }
+  if (ret != ESP_OK || readback != 0x00) {
+    ESP_LOGW(TAG, "FT3168中断模式设置失败（%s，回读0x%02X），使用I2C轮询", esp_err_to_name(ret), readback);
+    return;
+  }
+  
+  gpio_config_t io_conf = {
+    .pin_bit_mask = 1ULL << EXAMPLE_PIN_NUM_TOUCH_INT,
+    .mode = GPIO_MODE_INPUT,
+    .pull_up_en = GPIO_PULLUP_ENABLE,
+    .pull_down_en = GPIO_PULLDOWN_DISABLE,
+    .intr_type = GPIO_INTR_NEGEDGE,
+  };
+  ret = gpio_config(&io_conf);
+  if (ret == ESP_OK) {
+    // ISR服务可能已被其他驱动安装
+    ret = gpio_install_isr_service(ESP_INTR_FLAG_IRAM);
+    if (ret == ESP_ERR_INVALID_STATE) {
+      ret = ESP_OK;
+    }
+  }
+  if (ret == ESP_OK) {
+    ret = gpio_isr_handler_add(EXAMPLE_PIN_NUM_TOUCH_INT, touch_int_isr, NULL);
+  }
+  if (ret != ESP_OK) {
+    ESP_LOGW(TAG, "TP_INT中断配置失败: %s，使用I2C轮询", esp_err_to_name(ret));
+    return;
+  }
+  
+  // 初始化时手指可能已在屏幕上，补一次读取
+  s_irq_pending = (gpio_get_level(EXAMPLE_PIN_NUM_TOUCH_INT) == 0);
+  s_irq_enabled = true;
+  s_stats.interrupt_mode = true;
+  ESP_LOGI(TAG, "✓ TP_INT中断已启用（GPIO%d，查询中断模式）", EXAMPLE_PIN_NUM_TOUCH_INT);
+}
+#endif
+
+/**
+ * @brief 设置TP_INT中断回调（在ISR中调用，必须位于IRAM且不能阻塞）
+ * 
+ * 回调和参数在自旋锁内一起替换，ISR在同一把锁内读取并调用；函数返回后旧的回调不会再被调用，
+ * 调用者可以立即释放旧参数（如删除被通知的任务）
+ * 
+ * @param callback 回调函数，NULL表示取消
+ * @param arg 回调参数
+ */
+void Touch_SetIrqCallback(touch_irq_callback_t callback, void *arg)
+{
+  portENTER_CRITICAL(&s_irq_spinlock);
+  s_irq_callback = callback;
+  s_irq_callback_arg = arg;
+  portEXIT_CRITICAL(&s_irq_spinlock);
+}
+
+/**
+ * @brief 查询触摸是否工作在中断驱动模式
+ */
+bool Touch_IsInterruptMode(void)
+{
+  return s_irq_enabled;
+}
+
+/**
+ * @brief 获取触摸读取统计
+ */
+void Touch_GetStats(touch_stats_t *stats)
+{
+  if (!stats) {
+    return;
+  }
+  portENTER_CRITICAL(&s_stats_spinlock);
+  *stats = s_stats;
+  portEXIT_CRITICAL(&s_stats_spinlock);
 }
 
 /**
@@ -108,56 +247,104 @@ SemaphoreHandle_t I2C_GetMutex(void)
 }
 
 /**
- * @brief 读取触摸状态和坐标
+ * @brief 一次I2C读出FT3168报点（寄存器0x02-0x06）
  * 
- * 检测是否有触摸事件发生，如果有触摸则读取触摸坐标。
- * FT3168的坐标数据格式：
- * - 寄存器0x02: 触摸点数量
+ * 不读GEST_ID（0x01）：FT3168只在低功耗手势唤醒模式下填写手势ID，正常工作模式下恒为0，
+ * 滑动手势由GestureEngine根据坐标识别。
+ * 
+ * FT3168的报点数据格式：
+ * - 寄存器0x02: 触摸点数量（低4位）
  * - 寄存器0x03-0x06: 第一个触摸点的坐标数据
- *   - 0x03: Y坐标高4位 + 标志位
+ *   - 0x03: 事件标志(bit7:6) + Y坐标高4位
  *   - 0x04: Y坐标低8位
- *   - 0x05: X坐标高4位 + 标志位  
+ *   - 0x05: X坐标高4位
  *   - 0x06: X坐标低8位
  * 
+ * @param report 返回的报点
+ * @return ESP_OK 成功，其他值表示I2C通信错误
+ */
+static esp_err_t Touch_ReadReport(touch_report_t *report)
+{
+  uint8_t buf[FT3168_REPORT_LEN];
+  
+  esp_err_t ret = I2CBus_WriteRead(I2C_ADDR_FT3168, (uint8_t[]){FT3168_REG_TD_STATUS}, 1, buf, FT3168_REPORT_LEN, TOUCH_I2C_TIMEOUT_MS);
+  
+  portENTER_CRITICAL(&s_stats_spinlock);
+  s_stats.i2c_reads++;
+  if (ret != ESP_OK) {
+    s_stats.read_errors++;
+  }
+  portEXIT_CRITICAL(&s_stats_spinlock);
+  
+  if (ret != ESP_OK) {
+    return ret;
+  }
+  
+  uint8_t points = buf[0] & 0x0f;
+  uint8_t event = buf[1] >> 6;
+  report->pressed = (points > 0 && points <= 2 && event != FT3168_EVENT_LIFT_UP);
+  if (report->pressed) {
+    // Y坐标 = (buf[1]低4位 << 8) | buf[2]，X坐标 = (buf[3]低4位 << 8) | buf[4]
+    report->y = (((uint16_t)buf[1] & 0x0f) << 8) | (uint16_t)buf[2];
+    report->x = (((uint16_t)buf[3] & 0x0f) << 8) | (uint16_t)buf[4];
+  }
+  return ESP_OK;
+}
+
+/**
+ * @brief 读取触摸状态和坐标
+ * 
+ * 中断驱动模式下：TP_INT为高且没有未处理的中断时直接返回未触摸，不访问I2C；
+ * 中断到来后（或手指仍在屏幕上，INT保持低电平）才读取坐标。
+ * 中断未启用时退回每次都读取的轮询方式。
+ * 
  * @param x 返回的X坐标指针
  * @param y 返回的Y坐标指针
  * @return 1 有触摸事件，0 无触摸事件
  */
 uint8_t getTouch(uint16_t *x, uint16_t *y)
 {
-  uint8_t data;     // 触摸点数量
-  uint8_t buf[4];   // 坐标数据缓冲区
-  uint8_t result = 0;
-
-  // === 1. 读取触摸点数量 ===
-  esp_err_t ret = I2CBus_WriteRead(I2C_ADDR_FT3168, (uint8_t[]){0x02}, 1, &data, 1, 1000);
-  if (ret == ESP_OK && data > 0) {  // 如果有触摸点
-    // === 2. 读取第一个触摸点的坐标数据 ===
-    ret = I2CBus_WriteRead(I2C_ADDR_FT3168, (uint8_t[]){0x03}, 1, buf, 4, 1000);
-    if (ret == ESP_OK) {
-      // === 3. 解析坐标数据 ===
-      // Y坐标 = (buf[0]低4位 << 8) | buf[1]
-      *y = (((uint16_t)buf[0] & 0x0f) << 8) | (uint16_t)buf[1];
-      
-      // X坐标 = (buf[2]低4位 << 8) | buf[3]  
-      *x = (((uint16_t)buf[2] & 0x0f) << 8) | (uint16_t)buf[3];
-      
-      // 坐标范围检查和转换（已注释掉的代码，可根据需要启用）
-      // if(*x > EXAMPLE_LCD_H_RES)
-      // *x = EXAMPLE_LCD_H_RES;
-      // if(*y > EXAMPLE_LCD_V_RES)
-      // *y = EXAMPLE_LCD_V_RES;
-      // *y = EXAMPLE_LCD_V_RES - *y;  // Y轴翻转
-      
-      result = 1;  // 返回有触摸事件
-    } else {
-      ESP_LOGW(TAG, "读取触摸坐标失败: %s", esp_err_to_name(ret));
+  if (s_irq_enabled) {
+    bool pending = s_irq_pending;
+    bool int_low = (gpio_get_level(EXAMPLE_PIN_NUM_TOUCH_INT) == 0);
+    
+    if (!pending && !int_low) {
+      // INT为高：没有手指，也没有新报点
+      s_last_report.pressed = false;
+      portENTER_CRITICAL(&s_stats_spinlock);
+      s_stats.skipped_reads++;
+      portEXIT_CRITICAL(&s_stats_spinlock);
+      return 0;
     }
-  } else if (ret != ESP_OK) {
-    ESP_LOGW(TAG, "读取触摸点数量失败: %s", esp_err_to_name(ret));
+    
+    if (pending) {
+      s_irq_pending = false;
+      uint32_t latency_us = (uint32_t)(esp_timer_get_time() - s_irq_time_us);
+      portENTER_CRITICAL(&s_stats_spinlock);
+      if (latency_us > s_stats.max_latency_us) {
+        s_stats.max_latency_us = latency_us;
+      }
+      s_stats.latency_total_us += latency_us;
+      s_stats.latency_count++;
+      portEXIT_CRITICAL(&s_stats_spinlock);
+    }
+  }
+  
+  touch_report_t report = s_last_report;
+  esp_err_t ret = Touch_ReadReport(&report);
+  if (ret != ESP_OK) {
+    ESP_LOGW(TAG, "读取触摸报点失败: %s", esp_err_to_name(ret));
+    // 读取失败时沿用上一次的状态，避免一次总线错误被当成抬起
+    report = s_last_report;
   }
+  s_last_report = report;
   
-  return result;
+  if (report.pressed) {
+    *x = report.x;
+    *y = report.y;
+    return 1;
+  }
+  return 0;
 }
 
 /**
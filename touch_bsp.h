@@ -4,14 +4,52 @@
 #include "freertos/FreeRTOS.h"
 #include "freertos/semphr.h"
 #include <stdbool.h>
+#include <stdint.h>
+
+// === 触摸读取配置 ===
+#define TOUCH_USE_INTERRUPT   1    // 1：TP_INT中断驱动读取（无触摸时不访问I2C），0：每次都I2C轮询
+#define TOUCH_I2C_TIMEOUT_MS  20   // 读取报点的I2C超时（LVGL任务中调用，不能长时间阻塞）
 
 #ifdef __cplusplus
 extern "C" {
 #endif
 
+/**
+ * @brief FT3168单点报点
+ */
+typedef struct {
+    uint16_t x;             ///< X坐标（控制器原始坐标）
+    uint16_t y;             ///< Y坐标（控制器原始坐标）
+    bool pressed;           ///< 是否按下
+} touch_report_t;
+
+/**
+ * @brief 触摸读取统计
+ */
+typedef struct {
+    uint32_t irq_count;         ///< TP_INT中断次数
+    uint32_t i2c_reads;         ///< 实际I2C报点读取次数
+    uint32_t skipped_reads;     ///< INT为高而跳过的读取次数
+    uint32_t read_errors;       ///< I2C读取失败次数
+    uint32_t latency_count;     ///< 中断后完成读取的次数
+    uint64_t latency_total_us;  ///< 中断到读取的累计延迟
+    uint32_t max_latency_us;    ///< 中断到读取的最大延迟
+    bool interrupt_mode;        ///< 是否工作在中断驱动模式
+} touch_stats_t;
+
+/**
+ * @brief TP_INT中断回调（在ISR中执行）
+ */
+typedef void (*touch_irq_callback_t)(void *arg);
+
 void Touch_Init(void);
 uint8_t getTouch(uint16_t *x,uint16_t *y);
 
+// 中断驱动相关函数
+void Touch_SetIrqCallback(touch_irq_callback_t callback, void *arg);
+bool Touch_IsInterruptMode(void);
+void Touch_GetStats(touch_stats_t *stats);
+
 // I2C总线互斥锁相关函数
 bool I2C_Lock(uint32_t timeout_ms);
 void I2C_Unlock(void);
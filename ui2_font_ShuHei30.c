@@ -2,6 +2,7 @@
  * Size: 30 px
  * Bpp: 2
  * Opts: --bpp 2 --size 30 --font C:/Users/north/Documents/nainiu_ui/assets/AlimamaShuHeiTi-Bold.otf -o C:/Users/north/Documents/nainiu_ui/assets\ui2_font_ShuHei30.c --format lvgl -r 0x20-0x7f --symbols 已经连接开启关�?--no-compress --no-prefilter
+ * Subset: 20/103 glyphs (font_subsetter.py)
  ******************************************************************************/
 
 #include "ui2.h"
@@ -20,168 +21,6 @@
 static LV_ATTRIBUTE_LARGE_CONST const uint8_t glyph_bitmap[] = {
     /* U+0020 " " */
 
-    /* U+0021 "!" */
-    0xff, 0xcf, 0xfc, 0xbf, 0xcb, 0xfc, 0xbf, 0xcb,
-    0xf8, 0xbf, 0x8b, 0xf8, 0xbf, 0x87, 0xf8, 0x7f,
-    0x87, 0xf4, 0x7f, 0x47, 0xf4, 0x15, 0x0, 0x0,
-    0x0, 0xf, 0xfc, 0xff, 0xcf, 0xfc, 0xff, 0xcf,
-    0xfc,
-
-    /* U+0022 "\"" */
-    0x0, 0x0, 0x2, 0xfd, 0x3f, 0xcb, 0xf4, 0xff,
-    0x1f, 0xd3, 0xfc, 0x7f, 0xf, 0xf1, 0xfc, 0x2f,
-    0xc3, 0xf0, 0xbe, 0xf, 0xc2, 0xf8, 0x3f, 0x7,
-    0xd0, 0xfc, 0x1f, 0x40,
-
-    /* U+0023 "#" */
-    0x0, 0x3f, 0x80, 0x7f, 0x40, 0x3, 0xf4, 0x7,
-    0xf0, 0x0, 0x7f, 0x0, 0xbf, 0x0, 0xb, 0xf0,
-    0xf, 0xf0, 0x0, 0xbf, 0x0, 0xfe, 0xb, 0xff,
-    0xff, 0xff, 0xfe, 0xbf, 0xff, 0xff, 0xff, 0xeb,
-    0xff, 0xff, 0xff, 0xfe, 0x1, 0xfd, 0x2, 0xfc,
-    0x0, 0x1f, 0xc0, 0x2f, 0xc0, 0x2, 0xfc, 0x3,
-    0xf8, 0x0, 0x3f, 0xc0, 0x3f, 0x80, 0x3, 0xf8,
-    0x3, 0xf4, 0xb, 0xff, 0xff, 0xff, 0xfe, 0xbf,
-    0xff, 0xff, 0xff, 0xeb, 0xff, 0xff, 0xff, 0xfe,
-    0xb, 0xf0, 0xf, 0xf0, 0x0, 0xbf, 0x0, 0xfe,
-    0x0, 0xf, 0xe0, 0xf, 0xd0, 0x0, 0xfe, 0x0,
-    0xfd, 0x0, 0xf, 0xd0, 0x1f, 0xc0, 0x1, 0xfd,
-    0x2, 0xfc, 0x0,
-
-    /* U+0024 "$" */
-    0x0, 0x7, 0xc0, 0x0, 0x0, 0x7, 0xc0, 0x0,
-    0x1, 0xbf, 0xff, 0x90, 0xf, 0xff, 0xff, 0xf0,
-    0x2f, 0xff, 0xff, 0xf0, 0x3f, 0xff, 0xef, 0xf0,
-    0x3f, 0xc7, 0xc0, 0x0, 0x7f, 0x87, 0xc0, 0x0,
-    0x7f, 0x87, 0xc0, 0x0, 0x7f, 0xc7, 0xc0, 0x0,
-    0x3f, 0xff, 0xc0, 0x0, 0x2f, 0xff, 0xf8, 0x0,
-    0xf, 0xff, 0xff, 0xc0, 0x1, 0xff, 0xff, 0xf0,
-    0x0, 0xb, 0xff, 0xf8, 0x0, 0x7, 0xdf, 0xfc,
-    0x0, 0x7, 0xc3, 0xfc, 0x0, 0x7, 0xc3, 0xfc,
-    0x0, 0x7, 0xc3, 0xfc, 0x50, 0x7, 0xc7, 0xfc,
-    0x7f, 0xff, 0xff, 0xf8, 0x7f, 0xff, 0xff, 0xf0,
-    0x7f, 0xff, 0xff, 0xd0, 0x2b, 0xff, 0xf9, 0x0,
-    0x0, 0x7, 0xc0, 0x0, 0x0, 0x7, 0xc0, 0x0,
-    0x0, 0x7, 0xc0, 0x0, 0x0, 0x7, 0xc0, 0x0,
-    0x0, 0x3, 0xc0, 0x0,
-
-    /* U+0025 "%" */
-    0x2, 0xfd, 0x0, 0x2, 0xfc, 0x0, 0x3f, 0xfe,
-    0x0, 0xf, 0xd0, 0x2, 0xff, 0xfc, 0x0, 0xbe,
-    0x0, 0xf, 0xc1, 0xf4, 0x7, 0xf0, 0x0, 0x3e,
-    0x3, 0xe0, 0x3f, 0x80, 0x0, 0xf8, 0xf, 0x81,
-    0xfc, 0x0, 0x3, 0xe0, 0x3e, 0xf, 0xe0, 0x0,
-    0xf, 0xc0, 0xf8, 0x7f, 0x0, 0x0, 0x3f, 0xb,
-    0xd3, 0xf8, 0x0, 0x0, 0x7f, 0xff, 0x1f, 0xc0,
-    0x0, 0x0, 0xff, 0xf4, 0xfd, 0x1b, 0x90, 0x0,
-    0xae, 0x4b, 0xf2, 0xff, 0xf0, 0x0, 0x0, 0x3f,
-    0x4f, 0xff, 0xd0, 0x0, 0x2, 0xfc, 0x7e, 0x1f,
-    0xc0, 0x0, 0xf, 0xd2, 0xf0, 0x3f, 0x0, 0x0,
-    0xbf, 0xb, 0xc0, 0xbc, 0x0, 0x3, 0xf4, 0x2f,
-    0x2, 0xf0, 0x0, 0x2f, 0xc0, 0xbc, 0xb, 0xc0,
-    0x0, 0xfc, 0x2, 0xf4, 0x3f, 0x0, 0xf, 0xe0,
-    0x3, 0xff, 0xf8, 0x0, 0x7f, 0x0, 0xb, 0xff,
-    0xc0, 0x3, 0xf8, 0x0, 0xb, 0xf8, 0x0,
-
-    /* U+0026 "&" */
-    0x0, 0x6, 0xfe, 0x0, 0x0, 0x0, 0x3f, 0xff,
-    0xe0, 0x0, 0x0, 0xbf, 0xff, 0xf0, 0x0, 0x0,
-    0xff, 0x9f, 0xf8, 0x0, 0x1, 0xff, 0x7, 0xf8,
-    0x0, 0x1, 0xfe, 0x3, 0xf8, 0x0, 0x1, 0xff,
-    0xb, 0xf8, 0x0, 0x0, 0xff, 0x6f, 0xf0, 0x0,
-    0x0, 0xff, 0xff, 0xd0, 0x0, 0x0, 0x7f, 0xff,
-    0x40, 0x0, 0x0, 0xbf, 0xfc, 0x3, 0xf8, 0x3,
-    0xff, 0xfd, 0x7, 0xf4, 0xf, 0xff, 0xff, 0xb,
-    0xf4, 0x2f, 0xf0, 0xff, 0xcf, 0xf0, 0x3f, 0xd0,
-    0x3f, 0xff, 0xf0, 0x3f, 0xc0, 0x1f, 0xff, 0xd0,
-    0x3f, 0xd0, 0x7, 0xff, 0xc0, 0x3f, 0xf0, 0x7,
-    0xff, 0x40, 0x3f, 0xfe, 0xbf, 0xff, 0xc0, 0xf,
-    0xff, 0xff, 0xff, 0xe0, 0x7, 0xff, 0xff, 0xef,
-    0xf4, 0x0, 0x6f, 0xf9, 0xb, 0xfc,
-
-    /* U+0027 "'" */
-    0x0, 0x2f, 0xdb, 0xf5, 0xfd, 0x7f, 0x1f, 0xc3,
-    0xf0, 0xfc, 0x3f, 0xf, 0xc0,
-
-    /* U+0028 "(" */
-    0x0, 0x15, 0x40, 0xf, 0xf8, 0x1, 0xff, 0x0,
-    0x3f, 0xe0, 0x7, 0xfc, 0x0, 0xbf, 0x80, 0xf,
-    0xf4, 0x1, 0xff, 0x0, 0x3f, 0xe0, 0x3, 0xfe,
-    0x0, 0x7f, 0xd0, 0xb, 0xfc, 0x0, 0xbf, 0xc0,
-    0xb, 0xfc, 0x0, 0xff, 0xc0, 0xf, 0xfc, 0x0,
-    0xff, 0xc0, 0xb, 0xfc, 0x0, 0xbf, 0xc0, 0x7,
-    0xfc, 0x0, 0x3f, 0xd0, 0x3, 0xfe, 0x0, 0x3f,
-    0xf0, 0x1, 0xff, 0x0, 0xf, 0xf8, 0x0, 0xbf,
-    0xc0, 0x3, 0xfd, 0x0, 0x2f, 0xf0, 0x0, 0xff,
-    0x40, 0xb, 0xfc,
-
-    /* U+0029 ")" */
-    0x15, 0x40, 0x2, 0xff, 0x0, 0xf, 0xf4, 0x0,
-    0xbf, 0xc0, 0x3, 0xfd, 0x0, 0x2f, 0xe0, 0x1,
-    0xff, 0x0, 0xf, 0xf8, 0x0, 0xbf, 0xc0, 0x7,
-    0xfc, 0x0, 0x7f, 0xd0, 0x3, 0xfe, 0x0, 0x3f,
-    0xe0, 0x3, 0xfe, 0x0, 0x3f, 0xf0, 0x3, 0xff,
-    0x0, 0x3f, 0xf0, 0x3, 0xfe, 0x0, 0x3f, 0xe0,
-    0x3, 0xfe, 0x0, 0x7f, 0xd0, 0xb, 0xfc, 0x0,
-    0xff, 0xc0, 0xf, 0xf4, 0x2, 0xff, 0x0, 0x3f,
-    0xe0, 0x7, 0xfc, 0x0, 0xff, 0x80, 0x1f, 0xf0,
-    0x3, 0xfe, 0x0,
-
-    /* U+002A "*" */
-    0x0, 0x3f, 0x80, 0x0, 0xb, 0xe0, 0x0, 0x82,
-    0xf4, 0x20, 0x7e, 0x7d, 0xbc, 0x2f, 0xff, 0xff,
-    0x8f, 0xff, 0xff, 0xf0, 0x1b, 0xfe, 0x40, 0x3,
-    0xff, 0xc0, 0x3, 0xfb, 0xfc, 0x2, 0xfc, 0x7f,
-    0x80, 0x2e, 0xf, 0x80, 0x1, 0x1, 0x40,
-
-    /* U+002B "+" */
-    0x0, 0x3, 0xf8, 0x0, 0x0, 0x0, 0xfe, 0x0,
-    0x0, 0x0, 0x3f, 0x80, 0x0, 0x0, 0xf, 0xe0,
-    0x0, 0x0, 0x3, 0xf8, 0x0, 0x0, 0x0, 0xfe,
-    0x0, 0x3, 0xff, 0xff, 0xff, 0xf4, 0xff, 0xff,
-    0xff, 0xfd, 0x3f, 0xff, 0xff, 0xff, 0x4f, 0xff,
-    0xff, 0xff, 0xd0, 0x0, 0x3f, 0x80, 0x0, 0x0,
-    0xf, 0xe0, 0x0, 0x0, 0x3, 0xf8, 0x0, 0x0,
-    0x0, 0xfe, 0x0, 0x0, 0x0, 0x3f, 0x80, 0x0,
-    0x0, 0xf, 0xe0, 0x0,
-
-    /* U+002C "," */
-    0x0, 0x0, 0x2, 0xfe, 0x3, 0xfc, 0x7, 0xfc,
-    0xb, 0xf4, 0xf, 0xf0, 0xf, 0xe0, 0x1f, 0xd0,
-    0x2f, 0xc0, 0x3f, 0x80,
-
-    /* U+002D "-" */
-    0x2a, 0xaa, 0xa0, 0xff, 0xff, 0xc3, 0xff, 0xff,
-    0xf, 0xff, 0xfc,
-
-    /* U+002E "." */
-    0x0, 0xb, 0xfd, 0xbf, 0xdb, 0xfd, 0xbf, 0xdb,
-    0xfd,
-
-    /* U+002F "/" */
-    0x0, 0x0, 0xbf, 0x0, 0x0, 0x3f, 0x80, 0x0,
-    0x1f, 0xd0, 0x0, 0xb, 0xf0, 0x0, 0x3, 0xf8,
-    0x0, 0x1, 0xfd, 0x0, 0x0, 0xbf, 0x0, 0x0,
-    0x3f, 0x80, 0x0, 0x1f, 0xd0, 0x0, 0xb, 0xf0,
-    0x0, 0x3, 0xf8, 0x0, 0x1, 0xfd, 0x0, 0x0,
-    0xbf, 0x0, 0x0, 0x3f, 0x80, 0x0, 0x1f, 0xd0,
-    0x0, 0xb, 0xf0, 0x0, 0x3, 0xf8, 0x0, 0x1,
-    0xfd, 0x0, 0x0, 0xbf, 0x0, 0x0, 0x3f, 0x80,
-    0x0, 0x1f, 0xd0, 0x0, 0xb, 0xf0, 0x0, 0x3,
-    0xf8, 0x0, 0x0,
-
-    /* U+0030 "0" */
-    0x0, 0x2f, 0xf8, 0x0, 0x2, 0xff, 0xff, 0x40,
-    0xb, 0xff, 0xff, 0xd0, 0xf, 0xff, 0xff, 0xf0,
-    0x2f, 0xf0, 0x2f, 0xf4, 0x3f, 0xe0, 0xf, 0xf8,
-    0x7f, 0xd0, 0xb, 0xfc, 0x7f, 0xc0, 0x7, 0xfc,
-    0xbf, 0xc0, 0x3, 0xfc, 0xbf, 0xc0, 0x3, 0xfd,
-    0xbf, 0xc0, 0x3, 0xfd, 0xbf, 0xc0, 0x3, 0xfd,
-    0xbf, 0xc0, 0x3, 0xfd, 0xbf, 0xc0, 0x3, 0xfc,
-    0x7f, 0xc0, 0x7, 0xfc, 0x7f, 0xd0, 0xb, 0xfc,
-    0x3f, 0xe0, 0xf, 0xf8, 0x2f, 0xf0, 0x2f, 0xf4,
-    0xf, 0xff, 0xff, 0xf0, 0xb, 0xff, 0xff, 0xd0,
-    0x2, 0xff, 0xff, 0x40, 0x0, 0x2f, 0xf8, 0x0,
 
     /* U+0031 "1" */
     0x0, 0xbf, 0x82, 0xff, 0xe3, 0xff, 0xfa, 0xff,
@@ -230,152 +69,6 @@ static LV_ATTRIBUTE_LARGE_CONST const uint8_t glyph_bitmap[] = {
     0x0, 0x0, 0x3f, 0xd0, 0x0, 0x0, 0x3f, 0xd0,
     0x0, 0x0, 0x3f, 0xd0, 0x0, 0x0, 0x3f, 0xd0,
 
-    /* U+0035 "5" */
-    0xf, 0xff, 0xff, 0xf0, 0xf, 0xff, 0xff, 0xf0,
-    0xf, 0xff, 0xff, 0xf0, 0xf, 0xfe, 0xaa, 0xa0,
-    0xf, 0xf4, 0x0, 0x0, 0xf, 0xf4, 0x0, 0x0,
-    0xf, 0xf4, 0x0, 0x0, 0xf, 0xf4, 0x0, 0x0,
-    0xf, 0xff, 0xfd, 0x0, 0xf, 0xff, 0xff, 0xc0,
-    0x1f, 0xff, 0xff, 0xf0, 0x1e, 0x40, 0x7f, 0xf4,
-    0x0, 0x0, 0xf, 0xfc, 0x0, 0x0, 0xb, 0xfc,
-    0x0, 0x0, 0x7, 0xfc, 0x0, 0x0, 0x7, 0xfc,
-    0x0, 0x0, 0xf, 0xfc, 0x38, 0x0, 0x2f, 0xf8,
-    0x3f, 0xfb, 0xff, 0xf0, 0x3f, 0xff, 0xff, 0xd0,
-    0x3f, 0xff, 0xff, 0x40, 0x6, 0xff, 0xe4, 0x0,
-
-    /* U+0036 "6" */
-    0x0, 0x6, 0xff, 0x90, 0x0, 0x7f, 0xff, 0xf0,
-    0x2, 0xff, 0xff, 0xf0, 0xb, 0xff, 0xfb, 0xf0,
-    0xf, 0xfd, 0x0, 0x10, 0x2f, 0xf0, 0x0, 0x0,
-    0x3f, 0xd0, 0x0, 0x0, 0x3f, 0xcb, 0xfe, 0x0,
-    0x7f, 0xff, 0xff, 0xd0, 0x7f, 0xff, 0xff, 0xf0,
-    0xbf, 0xfd, 0x6f, 0xf8, 0xbf, 0xe0, 0xb, 0xfc,
-    0xbf, 0xd0, 0x7, 0xfc, 0x7f, 0xc0, 0x3, 0xfc,
-    0x7f, 0xc0, 0x3, 0xfc, 0x7f, 0xc0, 0x3, 0xfc,
-    0x3f, 0xd0, 0x7, 0xfc, 0x2f, 0xf0, 0xf, 0xf8,
-    0xf, 0xff, 0xff, 0xf0, 0xb, 0xff, 0xff, 0xe0,
-    0x2, 0xff, 0xff, 0x40, 0x0, 0x2f, 0xf8, 0x0,
-
-    /* U+0037 "7" */
-    0x7f, 0xff, 0xff, 0xfc, 0x7f, 0xff, 0xff, 0xfc,
-    0x7f, 0xff, 0xff, 0xfc, 0x6a, 0xaa, 0xaf, 0xfc,
-    0x0, 0x0, 0x1f, 0xf4, 0x0, 0x0, 0x3f, 0xe0,
-    0x0, 0x0, 0xbf, 0xc0, 0x0, 0x0, 0xff, 0x40,
-    0x0, 0x2, 0xff, 0x0, 0x0, 0x3, 0xfd, 0x0,
-    0x0, 0xb, 0xfc, 0x0, 0x0, 0xf, 0xf4, 0x0,
-    0x0, 0x1f, 0xf0, 0x0, 0x0, 0x2f, 0xf0, 0x0,
-    0x0, 0x3f, 0xd0, 0x0, 0x0, 0x7f, 0xc0, 0x0,
-    0x0, 0xbf, 0xc0, 0x0, 0x0, 0xff, 0x80, 0x0,
-    0x0, 0xff, 0x80, 0x0, 0x0, 0xff, 0x40, 0x0,
-    0x1, 0xff, 0x0, 0x0, 0x1, 0xff, 0x0, 0x0,
-
-    /* U+0038 "8" */
-    0x0, 0x6f, 0xf9, 0x0, 0x7, 0xff, 0xff, 0xc0,
-    0xf, 0xff, 0xff, 0xf0, 0x2f, 0xfe, 0xff, 0xf4,
-    0x3f, 0xe0, 0xf, 0xf8, 0x3f, 0xd0, 0xb, 0xfc,
-    0x3f, 0xd0, 0xb, 0xf8, 0x2f, 0xf4, 0x1f, 0xf0,
-    0xf, 0xff, 0xff, 0xe0, 0x2, 0xff, 0xff, 0x40,
-    0x2, 0xff, 0xff, 0x40, 0xf, 0xff, 0xff, 0xe0,
-    0x3f, 0xf9, 0x7f, 0xf8, 0x7f, 0xd0, 0xb, 0xfc,
-    0xbf, 0xc0, 0x3, 0xfd, 0xbf, 0xc0, 0x3, 0xfd,
-    0xbf, 0xc0, 0x3, 0xfd, 0xbf, 0xe0, 0xf, 0xfc,
-    0x3f, 0xfe, 0xff, 0xfc, 0x1f, 0xff, 0xff, 0xf0,
-    0x7, 0xff, 0xff, 0xc0, 0x0, 0x6f, 0xf9, 0x0,
-
-    /* U+0039 "9" */
-    0x0, 0x6f, 0xf4, 0x0, 0x3, 0xff, 0xff, 0x40,
-    0xf, 0xff, 0xff, 0xd0, 0x2f, 0xfe, 0xff, 0xf0,
-    0x3f, 0xe0, 0x1f, 0xf4, 0x7f, 0xc0, 0xb, 0xf8,
-    0x7f, 0xc0, 0x7, 0xfc, 0xbf, 0xc0, 0x7, 0xfc,
-    0xbf, 0xc0, 0xb, 0xfc, 0x7f, 0xc0, 0xf, 0xfc,
-    0x3f, 0xf0, 0x2f, 0xfd, 0x2f, 0xff, 0xff, 0xfc,
-    0xf, 0xff, 0xff, 0xfc, 0x2, 0xff, 0xfb, 0xfc,
-    0x0, 0x4, 0x7, 0xfc, 0x0, 0x0, 0xf, 0xf8,
-    0x0, 0x0, 0x1f, 0xf4, 0x8, 0x0, 0xbf, 0xf0,
-    0xf, 0xef, 0xff, 0xc0, 0xf, 0xff, 0xff, 0x40,
-    0xf, 0xff, 0xfd, 0x0, 0xb, 0xff, 0x90, 0x0,
-
-    /* U+003A ":" */
-    0x7f, 0xe7, 0xfe, 0x7f, 0xe7, 0xfe, 0x7f, 0xe0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x7f, 0xe7, 0xfe, 0x7f, 0xe7, 0xfe,
-    0x7f, 0xe0,
-
-    /* U+003B ";" */
-    0x7, 0xfe, 0x7, 0xfe, 0x7, 0xfe, 0x7, 0xfe,
-    0x7, 0xfe, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x3, 0xfc, 0x7, 0xfc, 0xb, 0xf4, 0xf, 0xf0,
-    0xf, 0xe0, 0x1f, 0xd0, 0x3f, 0xc0, 0x3f, 0x80,
-    0x7f, 0x0,
-
-    /* U+003C "<" */
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x90, 0x0, 0x0, 0x7, 0xf4, 0x0, 0x0, 0x2f,
-    0xfd, 0x0, 0x1, 0xbf, 0xff, 0x40, 0x7, 0xff,
-    0xfe, 0x40, 0x2f, 0xff, 0xf8, 0x0, 0xff, 0xff,
-    0x90, 0x0, 0x3f, 0xfe, 0x0, 0x0, 0xf, 0xf4,
-    0x0, 0x0, 0x3, 0xfe, 0x0, 0x0, 0x0, 0xff,
-    0xfd, 0x0, 0x0, 0x1f, 0xff, 0xf8, 0x0, 0x0,
-    0x6f, 0xff, 0xf4, 0x0, 0x0, 0xbf, 0xff, 0xe0,
-    0x0, 0x1, 0xff, 0xfd, 0x0, 0x0, 0x2, 0xff,
-    0x40, 0x0, 0x0, 0x7, 0xd0, 0x0, 0x0, 0x0,
-    0x14,
-
-    /* U+003D "=" */
-    0x3f, 0xff, 0xff, 0xff, 0x4f, 0xff, 0xff, 0xff,
-    0xd3, 0xff, 0xff, 0xff, 0xf4, 0xff, 0xff, 0xff,
-    0xfd, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x3f, 0xff, 0xff, 0xff, 0x4f, 0xff,
-    0xff, 0xff, 0xd3, 0xff, 0xff, 0xff, 0xf4, 0xff,
-    0xff, 0xff, 0xfd,
-
-    /* U+003E ">" */
-    0x0, 0x0, 0x0, 0x0, 0xd, 0x0, 0x0, 0x0,
-    0x3, 0xf8, 0x0, 0x0, 0x0, 0xff, 0xe4, 0x0,
-    0x0, 0x3f, 0xff, 0xd0, 0x0, 0x2, 0xff, 0xff,
-    0x80, 0x0, 0x7, 0xff, 0xff, 0x40, 0x0, 0xb,
-    0xff, 0xfd, 0x0, 0x0, 0x1f, 0xff, 0x40, 0x0,
-    0x0, 0x2f, 0xd0, 0x0, 0x0, 0x1f, 0xf4, 0x0,
-    0x1, 0xbf, 0xfd, 0x0, 0x7, 0xff, 0xfe, 0x0,
-    0x6f, 0xff, 0xf4, 0x1, 0xff, 0xff, 0x90, 0x0,
-    0xff, 0xfe, 0x0, 0x0, 0x3f, 0xf4, 0x0, 0x0,
-    0xf, 0x80, 0x0, 0x0, 0x1, 0x0, 0x0, 0x0,
-    0x0,
-
-    /* U+003F "?" */
-    0x6f, 0xff, 0x80, 0xff, 0xff, 0xf4, 0xff, 0xff,
-    0xfc, 0xff, 0xff, 0xfd, 0x0, 0xb, 0xfe, 0x0,
-    0x3, 0xfe, 0x0, 0x3, 0xfe, 0x0, 0x7, 0xfd,
-    0x0, 0xf, 0xfc, 0x0, 0x3f, 0xf8, 0x0, 0xff,
-    0xe0, 0x1, 0xff, 0x80, 0x3, 0xfd, 0x0, 0x3,
-    0xfc, 0x0, 0x3, 0xf8, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x7, 0xfd, 0x0, 0x7, 0xfd,
-    0x0, 0x7, 0xfd, 0x0, 0x7, 0xfd, 0x0, 0x7,
-    0xfd, 0x0,
-
-    /* U+0040 "@" */
-    0x0, 0x0, 0x2f, 0xfe, 0x80, 0x0, 0x0, 0x7,
-    0xff, 0xff, 0xfd, 0x0, 0x0, 0x2f, 0xff, 0xff,
-    0xff, 0x80, 0x0, 0xff, 0xfe, 0xab, 0xff, 0xd0,
-    0x3, 0xff, 0x80, 0x0, 0x2f, 0xf4, 0xb, 0xfd,
-    0x0, 0x0, 0x7, 0xf8, 0xf, 0xf0, 0xb, 0xe2,
-    0xa2, 0xfc, 0x2f, 0xd0, 0x7f, 0xff, 0xf0, 0xfd,
-    0x3f, 0xc0, 0xff, 0xff, 0xf0, 0xfe, 0x7f, 0x43,
-    0xfe, 0x7f, 0xe0, 0xbe, 0xbf, 0x7, 0xf8, 0x1f,
-    0xd0, 0xbe, 0xff, 0xb, 0xf0, 0xf, 0xd0, 0xbe,
-    0xff, 0xb, 0xf0, 0x1f, 0xc0, 0xfd, 0xff, 0xf,
-    0xe0, 0x2f, 0xc0, 0xfd, 0xff, 0xf, 0xf0, 0x3f,
-    0xc0, 0xfc, 0xff, 0xb, 0xf9, 0xff, 0xd3, 0xf4,
-    0xbf, 0x7, 0xff, 0xff, 0xff, 0xf0, 0x7f, 0x43,
-    0xff, 0xf7, 0xff, 0xd0, 0x3f, 0xc0, 0x7e, 0x40,
-    0xbe, 0x0, 0x2f, 0xf0, 0x0, 0x0, 0x0, 0x0,
-    0xf, 0xfd, 0x0, 0x0, 0x0, 0x0, 0x7, 0xff,
-    0xfa, 0x40, 0x0, 0x0, 0x1, 0xff, 0xff, 0x80,
-    0x0, 0x0, 0x0, 0x2f, 0xff, 0x80, 0x0, 0x0,
-    0x0, 0x1, 0xbf, 0x40, 0x0, 0x0,
-
     /* U+0041 "A" */
     0x0, 0x7, 0xff, 0xfc, 0x0, 0x0, 0x0, 0xbf,
     0xff, 0xd0, 0x0, 0x0, 0xf, 0xff, 0xfe, 0x0,
@@ -394,22 +87,6 @@ static LV_ATTRIBUTE_LARGE_CONST const uint8_t glyph_bitmap[] = {
     0x0, 0x2, 0xff, 0x83, 0xff, 0x0, 0x0, 0x1f,
     0xfc,
 
-    /* U+0042 "B" */
-    0x3f, 0xff, 0xff, 0x90, 0x0, 0xff, 0xff, 0xff,
-    0xf0, 0x3, 0xff, 0xff, 0xff, 0xf0, 0xf, 0xfc,
-    0x6, 0xff, 0xd0, 0x3f, 0xe0, 0x2, 0xff, 0x80,
-    0xff, 0x80, 0x7, 0xfe, 0x3, 0xfe, 0x0, 0x1f,
-    0xf8, 0xf, 0xf8, 0x0, 0xbf, 0xc0, 0x3f, 0xe0,
-    0x7, 0xfe, 0x0, 0xff, 0xff, 0xff, 0xe0, 0x3,
-    0xff, 0xff, 0xff, 0x80, 0xf, 0xff, 0xff, 0xff,
-    0xc0, 0x3f, 0xe0, 0x2, 0xff, 0xc0, 0xff, 0x80,
-    0x1, 0xff, 0x83, 0xfe, 0x0, 0x3, 0xff, 0xf,
-    0xf8, 0x0, 0xf, 0xfc, 0x3f, 0xe0, 0x0, 0x7f,
-    0xf0, 0xff, 0x80, 0x3, 0xff, 0x83, 0xff, 0xaa,
-    0xff, 0xfd, 0xf, 0xff, 0xff, 0xff, 0xe0, 0x3f,
-    0xff, 0xff, 0xfe, 0x0, 0xff, 0xff, 0xff, 0x80,
-    0x0,
-
     /* U+0043 "C" */
     0x0, 0x1, 0xbf, 0xfa, 0x40, 0x0, 0x7f, 0xff,
     0xff, 0xc0, 0xf, 0xff, 0xff, 0xff, 0x0, 0xff,
@@ -426,22 +103,6 @@ static LV_ATTRIBUTE_LARGE_CONST const uint8_t glyph_bitmap[] = {
     0x2f, 0xff, 0xff, 0xf0, 0x0, 0x6, 0xff, 0xf9,
     0x0,
 
-    /* U+0044 "D" */
-    0x3f, 0xff, 0xfe, 0x40, 0x0, 0xff, 0xff, 0xff,
-    0xe0, 0x3, 0xff, 0xff, 0xff, 0xf0, 0xf, 0xff,
-    0xff, 0xff, 0xe0, 0x3f, 0xe0, 0x7, 0xff, 0xd0,
-    0xff, 0x80, 0x3, 0xff, 0xc3, 0xfe, 0x0, 0x7,
-    0xff, 0xf, 0xf8, 0x0, 0xf, 0xfd, 0x3f, 0xe0,
-    0x0, 0x2f, 0xf8, 0xff, 0x80, 0x0, 0x7f, 0xf3,
-    0xfe, 0x0, 0x1, 0xff, 0xcf, 0xf8, 0x0, 0x3,
-    0xff, 0x3f, 0xe0, 0x0, 0x1f, 0xfc, 0xff, 0x80,
-    0x0, 0xbf, 0xe3, 0xfe, 0x0, 0x3, 0xff, 0x8f,
-    0xf8, 0x0, 0x1f, 0xfd, 0x3f, 0xe0, 0x0, 0xff,
-    0xf0, 0xff, 0x80, 0x1f, 0xff, 0x43, 0xff, 0xff,
-    0xff, 0xfc, 0xf, 0xff, 0xff, 0xff, 0xc0, 0x3f,
-    0xff, 0xff, 0xf8, 0x0, 0xff, 0xff, 0xf9, 0x0,
-    0x0,
-
     /* U+0045 "E" */
     0x3f, 0xff, 0xff, 0xfe, 0x3f, 0xff, 0xff, 0xfe,
     0x3f, 0xff, 0xff, 0xfe, 0x3f, 0xff, 0xff, 0xfe,
@@ -455,51 +116,6 @@ static LV_ATTRIBUTE_LARGE_CONST const uint8_t glyph_bitmap[] = {
     0x3f, 0xff, 0xff, 0xfe, 0x3f, 0xff, 0xff, 0xfe,
     0x3f, 0xff, 0xff, 0xfe, 0x3f, 0xff, 0xff, 0xfe,
 
-    /* U+0046 "F" */
-    0x3f, 0xff, 0xff, 0xf8, 0xff, 0xff, 0xff, 0xe3,
-    0xff, 0xff, 0xff, 0x8f, 0xff, 0xff, 0xfe, 0x3f,
-    0xf0, 0x0, 0x0, 0xff, 0x80, 0x0, 0x3, 0xfe,
-    0x0, 0x0, 0xf, 0xf8, 0x0, 0x0, 0x3f, 0xe0,
-    0x0, 0x0, 0xff, 0xff, 0xff, 0x43, 0xff, 0xff,
-    0xfd, 0xf, 0xff, 0xff, 0xf4, 0x3f, 0xff, 0xff,
-    0xd0, 0xff, 0x80, 0x0, 0x3, 0xfe, 0x0, 0x0,
-    0xf, 0xf8, 0x0, 0x0, 0x3f, 0xe0, 0x0, 0x0,
-    0xff, 0x80, 0x0, 0x3, 0xfe, 0x0, 0x0, 0xf,
-    0xf8, 0x0, 0x0, 0x3f, 0xe0, 0x0, 0x0, 0xff,
-    0x80, 0x0, 0x0,
-
-    /* U+0047 "G" */
-    0x0, 0x0, 0xaf, 0xfa, 0x40, 0x0, 0x7f, 0xff,
-    0xff, 0xc0, 0xb, 0xff, 0xff, 0xff, 0x0, 0xbf,
-    0xff, 0xff, 0xfc, 0xb, 0xff, 0xd0, 0x0, 0x60,
-    0x7f, 0xf4, 0x0, 0x0, 0x2, 0xff, 0x80, 0x0,
-    0x0, 0xf, 0xfc, 0x0, 0x0, 0x0, 0x7f, 0xe0,
-    0x0, 0x0, 0x2, 0xff, 0x40, 0x3, 0xff, 0xeb,
-    0xfc, 0x0, 0xf, 0xff, 0xbf, 0xf0, 0x0, 0x3f,
-    0xfe, 0xbf, 0xd0, 0x0, 0xff, 0xfa, 0xff, 0x40,
-    0x0, 0x2f, 0xe7, 0xff, 0x0, 0x0, 0xbf, 0x8f,
-    0xfe, 0x0, 0x2, 0xfe, 0x2f, 0xfe, 0x0, 0xb,
-    0xf8, 0x3f, 0xff, 0x40, 0x2f, 0xe0, 0x3f, 0xff,
-    0xff, 0xff, 0x80, 0x3f, 0xff, 0xff, 0xfe, 0x0,
-    0x1f, 0xff, 0xff, 0xf4, 0x0, 0x6, 0xff, 0xf9,
-    0x0,
-
-    /* U+0048 "H" */
-    0x3f, 0xe0, 0x0, 0xf, 0xfc, 0xff, 0x80, 0x0,
-    0x3f, 0xf3, 0xfe, 0x0, 0x0, 0xff, 0xcf, 0xf8,
-    0x0, 0x3, 0xff, 0x3f, 0xe0, 0x0, 0xf, 0xfc,
-    0xff, 0x80, 0x0, 0x3f, 0xf3, 0xfe, 0x0, 0x0,
-    0xff, 0xcf, 0xf8, 0x0, 0x3, 0xff, 0x3f, 0xf0,
-    0x0, 0x1f, 0xfc, 0xff, 0xff, 0xff, 0xff, 0xf3,
-    0xff, 0xff, 0xff, 0xff, 0xcf, 0xff, 0xff, 0xff,
-    0xff, 0x3f, 0xff, 0xff, 0xff, 0xfc, 0xff, 0x80,
-    0x0, 0x3f, 0xf3, 0xfe, 0x0, 0x0, 0xff, 0xcf,
-    0xf8, 0x0, 0x3, 0xff, 0x3f, 0xe0, 0x0, 0xf,
-    0xfc, 0xff, 0x80, 0x0, 0x3f, 0xf3, 0xfe, 0x0,
-    0x0, 0xff, 0xcf, 0xf8, 0x0, 0x3, 0xff, 0x3f,
-    0xe0, 0x0, 0xf, 0xfc, 0xff, 0x80, 0x0, 0x3f,
-    0xf0,
-
     /* U+0049 "I" */
     0x3f, 0xf3, 0xff, 0x3f, 0xf3, 0xff, 0x3f, 0xf3,
     0xff, 0x3f, 0xf3, 0xff, 0x3f, 0xf3, 0xff, 0x3f,
@@ -507,81 +123,6 @@ static LV_ATTRIBUTE_LARGE_CONST const uint8_t glyph_bitmap[] = {
     0x3f, 0xf3, 0xff, 0x3f, 0xf3, 0xff, 0x3f, 0xf3,
     0xff,
 
-    /* U+004A "J" */
-    0x0, 0xff, 0xc0, 0xf, 0xfc, 0x0, 0xff, 0xc0,
-    0xf, 0xfc, 0x0, 0xff, 0xc0, 0xf, 0xfc, 0x0,
-    0xff, 0xc0, 0xf, 0xfc, 0x0, 0xff, 0xc0, 0xf,
-    0xfc, 0x0, 0xff, 0xc0, 0xf, 0xfc, 0x0, 0xff,
-    0xc0, 0xf, 0xfc, 0x0, 0xff, 0xc0, 0xf, 0xfc,
-    0x0, 0xff, 0xc0, 0xf, 0xfc, 0x0, 0xff, 0xc0,
-    0xf, 0xfc, 0x2, 0xff, 0xc6, 0xbf, 0xf8, 0xbf,
-    0xff, 0xb, 0xff, 0xd0, 0xbf, 0xf4, 0xb, 0xe4,
-    0x0,
-
-    /* U+004B "K" */
-    0x3f, 0xe0, 0x0, 0xbf, 0xf0, 0x3f, 0xe0, 0x1,
-    0xff, 0xc0, 0x3f, 0xe0, 0x3, 0xff, 0x40, 0x3f,
-    0xe0, 0xb, 0xff, 0x0, 0x3f, 0xe0, 0xf, 0xfc,
-    0x0, 0x3f, 0xe0, 0x3f, 0xf4, 0x0, 0x3f, 0xe0,
-    0xbf, 0xf0, 0x0, 0x3f, 0xe0, 0xff, 0xc0, 0x0,
-    0x3f, 0xe3, 0xff, 0x40, 0x0, 0x3f, 0xff, 0xff,
-    0x0, 0x0, 0x3f, 0xff, 0xfc, 0x0, 0x0, 0x3f,
-    0xff, 0xfe, 0x0, 0x0, 0x3f, 0xff, 0xff, 0x80,
-    0x0, 0x3f, 0xf0, 0xff, 0xd0, 0x0, 0x3f, 0xe0,
-    0x3f, 0xf4, 0x0, 0x3f, 0xe0, 0x1f, 0xfc, 0x0,
-    0x3f, 0xe0, 0xb, 0xfe, 0x0, 0x3f, 0xe0, 0x3,
-    0xff, 0x40, 0x3f, 0xe0, 0x0, 0xff, 0xc0, 0x3f,
-    0xe0, 0x0, 0x7f, 0xe0, 0x3f, 0xe0, 0x0, 0x3f,
-    0xf4, 0x3f, 0xe0, 0x0, 0x1f, 0xfc,
-
-    /* U+004C "L" */
-    0x3f, 0xe0, 0x0, 0x0, 0xff, 0x80, 0x0, 0x3,
-    0xfe, 0x0, 0x0, 0xf, 0xf8, 0x0, 0x0, 0x3f,
-    0xe0, 0x0, 0x0, 0xff, 0x80, 0x0, 0x3, 0xfe,
-    0x0, 0x0, 0xf, 0xf8, 0x0, 0x0, 0x3f, 0xe0,
-    0x0, 0x0, 0xff, 0x80, 0x0, 0x3, 0xfe, 0x0,
-    0x0, 0xf, 0xf8, 0x0, 0x0, 0x3f, 0xe0, 0x0,
-    0x0, 0xff, 0x80, 0x0, 0x3, 0xfe, 0x0, 0x0,
-    0xf, 0xf8, 0x0, 0x0, 0x3f, 0xe0, 0x0, 0x0,
-    0xff, 0xc0, 0x0, 0x3, 0xff, 0xff, 0xff, 0xf,
-    0xff, 0xff, 0xfc, 0x3f, 0xff, 0xff, 0xf0, 0xff,
-    0xff, 0xff, 0xc0,
-
-    /* U+004D "M" */
-    0x3f, 0xff, 0xd0, 0x3, 0xff, 0xff, 0x3f, 0xff,
-    0xe0, 0x3, 0xff, 0xff, 0x3f, 0xff, 0xf0, 0x3,
-    0xff, 0xff, 0x3f, 0xff, 0xf0, 0x7, 0xff, 0xff,
-    0x3f, 0xef, 0xf0, 0xb, 0xfb, 0xff, 0x3f, 0xef,
-    0xf4, 0xf, 0xf7, 0xff, 0x3f, 0xeb, 0xf8, 0xf,
-    0xf7, 0xff, 0x3f, 0xe7, 0xfc, 0xf, 0xf3, 0xff,
-    0x3f, 0xe3, 0xfc, 0x1f, 0xf3, 0xff, 0x3f, 0xe3,
-    0xfc, 0x1f, 0xe3, 0xff, 0x3f, 0xe3, 0xfd, 0x2f,
-    0xe3, 0xff, 0x3f, 0xe2, 0xfd, 0x3f, 0xd3, 0xff,
-    0x3f, 0xe1, 0xfe, 0x3f, 0xc3, 0xff, 0x3f, 0xe1,
-    0xff, 0x3f, 0xc3, 0xff, 0x3f, 0xe0, 0xff, 0x7f,
-    0x83, 0xff, 0x3f, 0xe0, 0xff, 0xff, 0x83, 0xff,
-    0x3f, 0xe0, 0xbf, 0xff, 0x43, 0xff, 0x3f, 0xe0,
-    0x7f, 0xff, 0x3, 0xff, 0x3f, 0xe0, 0x7f, 0xff,
-    0x3, 0xff, 0x3f, 0xe0, 0x3f, 0xfe, 0x3, 0xff,
-    0x3f, 0xe0, 0x3f, 0xfe, 0x3, 0xff, 0x3f, 0xe0,
-    0x2f, 0xfd, 0x3, 0xff,
-
-    /* U+004E "N" */
-    0x3f, 0xff, 0xc0, 0xf, 0xfc, 0xff, 0xff, 0x0,
-    0x3f, 0xf3, 0xff, 0xfd, 0x0, 0xff, 0xcf, 0xff,
-    0xf8, 0x3, 0xff, 0x3f, 0xff, 0xf0, 0xf, 0xfc,
-    0xff, 0xbf, 0xd0, 0x3f, 0xf3, 0xfe, 0xbf, 0x80,
-    0xff, 0xcf, 0xf9, 0xff, 0x3, 0xff, 0x3f, 0xe3,
-    0xfc, 0xf, 0xfc, 0xff, 0x8f, 0xf4, 0x3f, 0xf3,
-    0xfe, 0x2f, 0xe0, 0xff, 0xcf, 0xf8, 0x3f, 0xc3,
-    0xff, 0x3f, 0xe0, 0xff, 0x4f, 0xfc, 0xff, 0x82,
-    0xfe, 0x3f, 0xf3, 0xfe, 0x7, 0xfc, 0xff, 0xcf,
-    0xf8, 0xf, 0xf3, 0xff, 0x3f, 0xe0, 0x2f, 0xdf,
-    0xfc, 0xff, 0x80, 0x7f, 0xff, 0xf3, 0xfe, 0x0,
-    0xff, 0xff, 0xcf, 0xf8, 0x3, 0xff, 0xff, 0x3f,
-    0xe0, 0xb, 0xff, 0xfc, 0xff, 0x80, 0x1f, 0xff,
-    0xf0,
-
     /* U+004F "O" */
     0x0, 0x2, 0xff, 0xe4, 0x0, 0x0, 0x2, 0xff,
     0xff, 0xf8, 0x0, 0x1, 0xff, 0xff, 0xff, 0xf0,
@@ -615,26 +156,6 @@ static LV_ATTRIBUTE_LARGE_CONST const uint8_t glyph_bitmap[] = {
     0x0, 0x0, 0x3f, 0xe0, 0x0, 0x0, 0x3, 0xfe,
     0x0, 0x0, 0x0,
 
-    /* U+0051 "Q" */
-    0x0, 0x1, 0xbf, 0xe4, 0x0, 0x0, 0x2, 0xff,
-    0xff, 0xf8, 0x0, 0x0, 0xff, 0xff, 0xff, 0xf0,
-    0x0, 0x3f, 0xff, 0xff, 0xff, 0xc0, 0xf, 0xff,
-    0x40, 0x1f, 0xff, 0x1, 0xff, 0xc0, 0x0, 0x3f,
-    0xf4, 0x3f, 0xf4, 0x0, 0x1, 0xff, 0xc7, 0xff,
-    0x0, 0x0, 0xf, 0xfd, 0xbf, 0xd0, 0x0, 0x0,
-    0x7f, 0xeb, 0xfc, 0x0, 0x0, 0x3, 0xfe, 0xbf,
-    0xc0, 0x0, 0x0, 0x3f, 0xff, 0xfc, 0x0, 0x0,
-    0x3, 0xff, 0xbf, 0xc0, 0x0, 0x0, 0x3f, 0xeb,
-    0xfd, 0x0, 0x0, 0x7, 0xfe, 0x7f, 0xe0, 0x0,
-    0x0, 0xbf, 0xd3, 0xff, 0x0, 0x0, 0xf, 0xfc,
-    0x2f, 0xfc, 0x0, 0x3, 0xff, 0x80, 0xff, 0xf4,
-    0x1, 0xff, 0xf0, 0x7, 0xff, 0xff, 0xff, 0xfd,
-    0x0, 0x1f, 0xff, 0xff, 0xff, 0x40, 0x0, 0x2f,
-    0xff, 0xff, 0x80, 0x0, 0x0, 0x1b, 0xff, 0xf4,
-    0x0, 0x0, 0x0, 0x0, 0xbf, 0xc0, 0x0, 0x0,
-    0x0, 0x3, 0xfd, 0x0, 0x0, 0x0, 0x0, 0x15,
-    0x50, 0x0,
-
     /* U+0052 "R" */
     0x3f, 0xff, 0xff, 0x90, 0x0, 0xff, 0xff, 0xff,
     0xf0, 0x3, 0xff, 0xff, 0xff, 0xf0, 0xf, 0xfe,
@@ -694,536 +215,6 @@ static LV_ATTRIBUTE_LARGE_CONST const uint8_t glyph_bitmap[] = {
     0xff, 0xff, 0xff, 0xc0, 0x0, 0xbf, 0xff, 0xfe,
     0x0, 0x0, 0x6, 0xff, 0x90, 0x0,
 
-    /* U+0056 "V" */
-    0xbf, 0xf0, 0x0, 0x1, 0xff, 0xc7, 0xff, 0x0,
-    0x0, 0x2f, 0xfc, 0x3f, 0xf4, 0x0, 0x3, 0xff,
-    0x42, 0xff, 0x80, 0x0, 0x3f, 0xf0, 0x1f, 0xfc,
-    0x0, 0x7, 0xff, 0x0, 0xff, 0xc0, 0x0, 0xbf,
-    0xe0, 0xf, 0xfd, 0x0, 0xf, 0xfd, 0x0, 0x7f,
-    0xe0, 0x0, 0xff, 0xc0, 0x3, 0xff, 0x0, 0x1f,
-    0xf8, 0x0, 0x3f, 0xf4, 0x2, 0xff, 0x40, 0x2,
-    0xff, 0x80, 0x3f, 0xf0, 0x0, 0x1f, 0xfc, 0x7,
-    0xff, 0x0, 0x0, 0xff, 0xc0, 0xbf, 0xe0, 0x0,
-    0xb, 0xfd, 0xf, 0xfd, 0x0, 0x0, 0x7f, 0xe0,
-    0xff, 0xc0, 0x0, 0x3, 0xff, 0x1f, 0xf8, 0x0,
-    0x0, 0x3f, 0xf2, 0xff, 0x40, 0x0, 0x2, 0xff,
-    0x7f, 0xf0, 0x0, 0x0, 0x1f, 0xff, 0xff, 0x0,
-    0x0, 0x0, 0xff, 0xff, 0xd0, 0x0, 0x0, 0xb,
-    0xff, 0xfc, 0x0, 0x0, 0x0, 0x7f, 0xff, 0xc0,
-    0x0,
-
-    /* U+0057 "W" */
-    0x7f, 0xe0, 0x1, 0xff, 0x40, 0xb, 0xfd, 0x3f,
-    0xf0, 0x2, 0xff, 0x80, 0xf, 0xfc, 0x3f, 0xf0,
-    0x2, 0xff, 0x80, 0xf, 0xfc, 0x2f, 0xf0, 0x3,
-    0xff, 0xc0, 0x1f, 0xf8, 0x2f, 0xf4, 0x3, 0xff,
-    0xc0, 0x1f, 0xf4, 0x1f, 0xf8, 0x7, 0xff, 0xd0,
-    0x2f, 0xf4, 0xf, 0xfc, 0x7, 0xff, 0xd0, 0x3f,
-    0xf0, 0xf, 0xfc, 0xb, 0xff, 0xe0, 0x3f, 0xf0,
-    0xb, 0xfc, 0xf, 0xff, 0xf0, 0x3f, 0xe0, 0x7,
-    0xfd, 0xf, 0xeb, 0xf0, 0x7f, 0xd0, 0x3, 0xfe,
-    0xf, 0xd7, 0xf0, 0xbf, 0xc0, 0x3, 0xfe, 0x1f,
-    0xd7, 0xf4, 0xbf, 0xc0, 0x2, 0xff, 0x2f, 0xc3,
-    0xf8, 0xff, 0x80, 0x1, 0xff, 0x2f, 0xc3, 0xf8,
-    0xff, 0x40, 0x0, 0xff, 0x3f, 0xc3, 0xfc, 0xff,
-    0x0, 0x0, 0xff, 0x7f, 0x82, 0xfd, 0xff, 0x0,
-    0x0, 0xbf, 0xff, 0x41, 0xff, 0xfe, 0x0, 0x0,
-    0x7f, 0xff, 0x41, 0xff, 0xfd, 0x0, 0x0, 0x7f,
-    0xff, 0x0, 0xff, 0xfc, 0x0, 0x0, 0x3f, 0xff,
-    0x0, 0xff, 0xfc, 0x0, 0x0, 0x3f, 0xff, 0x0,
-    0xff, 0xfc, 0x0, 0x0, 0x2f, 0xfe, 0x0, 0xbf,
-    0xf8, 0x0,
-
-    /* U+0058 "X" */
-    0x3f, 0xf4, 0x0, 0x2, 0xff, 0xc2, 0xff, 0xc0,
-    0x0, 0x3f, 0xf4, 0xf, 0xff, 0x0, 0xf, 0xff,
-    0x0, 0x3f, 0xf4, 0x2, 0xff, 0xc0, 0x2, 0xff,
-    0xc0, 0x3f, 0xf4, 0x0, 0xf, 0xff, 0xf, 0xff,
-    0x0, 0x0, 0x3f, 0xf6, 0xff, 0xc0, 0x0, 0x1,
-    0xff, 0xff, 0xf4, 0x0, 0x0, 0xf, 0xff, 0xfe,
-    0x0, 0x0, 0x0, 0x3f, 0xff, 0xc0, 0x0, 0x0,
-    0x1, 0xff, 0xf4, 0x0, 0x0, 0x0, 0x1f, 0xff,
-    0x40, 0x0, 0x0, 0x3, 0xff, 0xfc, 0x0, 0x0,
-    0x0, 0xbf, 0xff, 0xe0, 0x0, 0x0, 0x1f, 0xff,
-    0xff, 0x40, 0x0, 0x3, 0xff, 0xaf, 0xfc, 0x0,
-    0x0, 0xbf, 0xf0, 0xff, 0xe0, 0x0, 0x1f, 0xfd,
-    0x7, 0xff, 0x40, 0x3, 0xff, 0x80, 0x2f, 0xfc,
-    0x0, 0xbf, 0xf0, 0x0, 0xff, 0xe0, 0x1f, 0xfd,
-    0x0, 0x7, 0xff, 0x43, 0xff, 0x80, 0x0, 0x3f,
-    0xfc,
-
-    /* U+0059 "Y" */
-    0x7f, 0xf0, 0x0, 0x2f, 0xfc, 0x3f, 0xf4, 0x0,
-    0x3f, 0xf4, 0x1f, 0xfc, 0x0, 0x7f, 0xf0, 0xf,
-    0xfd, 0x0, 0xff, 0xd0, 0x7, 0xff, 0x1, 0xff,
-    0xc0, 0x3, 0xff, 0x43, 0xff, 0x0, 0x1, 0xff,
-    0xc7, 0xfe, 0x0, 0x0, 0xbf, 0xdf, 0xfc, 0x0,
-    0x0, 0x3f, 0xff, 0xf8, 0x0, 0x0, 0x2f, 0xff,
-    0xf0, 0x0, 0x0, 0xf, 0xff, 0xe0, 0x0, 0x0,
-    0xb, 0xff, 0xc0, 0x0, 0x0, 0x3, 0xff, 0x80,
-    0x0, 0x0, 0x2, 0xff, 0x0, 0x0, 0x0, 0x2,
-    0xff, 0x0, 0x0, 0x0, 0x2, 0xff, 0x0, 0x0,
-    0x0, 0x2, 0xff, 0x0, 0x0, 0x0, 0x2, 0xff,
-    0x0, 0x0, 0x0, 0x2, 0xff, 0x0, 0x0, 0x0,
-    0x2, 0xff, 0x0, 0x0, 0x0, 0x2, 0xff, 0x0,
-    0x0, 0x0, 0x2, 0xff, 0x0, 0x0,
-
-    /* U+005A "Z" */
-    0x7f, 0xff, 0xff, 0xff, 0xd7, 0xff, 0xff, 0xff,
-    0xfd, 0x7f, 0xff, 0xff, 0xff, 0xd7, 0xff, 0xff,
-    0xff, 0xfd, 0x0, 0x0, 0x3, 0xff, 0xc0, 0x0,
-    0x0, 0xff, 0xf4, 0x0, 0x0, 0x2f, 0xfd, 0x0,
-    0x0, 0x7, 0xff, 0x80, 0x0, 0x1, 0xff, 0xf0,
-    0x0, 0x0, 0x3f, 0xfc, 0x0, 0x0, 0xf, 0xff,
-    0x40, 0x0, 0x2, 0xff, 0xd0, 0x0, 0x0, 0xbf,
-    0xf8, 0x0, 0x0, 0x1f, 0xff, 0x0, 0x0, 0x3,
-    0xff, 0xc0, 0x0, 0x0, 0xff, 0xf0, 0x0, 0x0,
-    0x3f, 0xfd, 0x0, 0x0, 0xb, 0xff, 0x80, 0x0,
-    0x0, 0xff, 0xff, 0xff, 0xff, 0xef, 0xff, 0xff,
-    0xff, 0xfe, 0xff, 0xff, 0xff, 0xff, 0xef, 0xff,
-    0xff, 0xff, 0xfe,
-
-    /* U+005B "[" */
-    0x55, 0x54, 0xff, 0xfd, 0xff, 0xfd, 0xff, 0xfd,
-    0xff, 0xfd, 0xff, 0x40, 0xff, 0x40, 0xff, 0x40,
-    0xff, 0x40, 0xff, 0x40, 0xff, 0x40, 0xff, 0x40,
-    0xff, 0x40, 0xff, 0x40, 0xff, 0x40, 0xff, 0x40,
-    0xff, 0x40, 0xff, 0x40, 0xff, 0x40, 0xff, 0x40,
-    0xff, 0x40, 0xff, 0x40, 0xff, 0x40, 0xff, 0x40,
-    0xff, 0x40, 0xff, 0x94, 0xff, 0xfd, 0xff, 0xfd,
-    0xff, 0xfd, 0xff, 0xfd,
-
-    /* U+005C "\\" */
-    0x7f, 0x40, 0x0, 0x0, 0xff, 0x0, 0x0, 0x2,
-    0xfd, 0x0, 0x0, 0x3, 0xf8, 0x0, 0x0, 0xf,
-    0xf0, 0x0, 0x0, 0x1f, 0xd0, 0x0, 0x0, 0x3f,
-    0xc0, 0x0, 0x0, 0xbf, 0x40, 0x0, 0x0, 0xfe,
-    0x0, 0x0, 0x3, 0xfc, 0x0, 0x0, 0x7, 0xf4,
-    0x0, 0x0, 0xf, 0xf0, 0x0, 0x0, 0x2f, 0xc0,
-    0x0, 0x0, 0x3f, 0x80, 0x0, 0x0, 0xff, 0x0,
-    0x0, 0x1, 0xfd, 0x0, 0x0, 0x3, 0xfc, 0x0,
-    0x0, 0xb, 0xf0, 0x0, 0x0, 0x1f, 0xe0, 0x0,
-    0x0, 0x3f, 0xc0, 0x0, 0x0, 0x7f, 0x40, 0x0,
-    0x0, 0xff, 0x0, 0x0, 0x2, 0xfc, 0x0, 0x0,
-    0x7, 0xf8, 0x0, 0x0, 0xf, 0xf0, 0x0, 0x0,
-    0x2f, 0xd0, 0x0, 0x0, 0x15, 0x40,
-
-    /* U+005D "]" */
-    0x15, 0x55, 0x7f, 0xff, 0x7f, 0xff, 0x7f, 0xff,
-    0x7f, 0xff, 0x2, 0xff, 0x2, 0xff, 0x2, 0xff,
-    0x2, 0xff, 0x2, 0xff, 0x2, 0xff, 0x2, 0xff,
-    0x2, 0xff, 0x2, 0xff, 0x2, 0xff, 0x2, 0xff,
-    0x2, 0xff, 0x2, 0xff, 0x2, 0xff, 0x2, 0xff,
-    0x2, 0xff, 0x2, 0xff, 0x2, 0xff, 0x2, 0xff,
-    0x2, 0xff, 0x17, 0xff, 0x7f, 0xff, 0x7f, 0xff,
-    0x7f, 0xff, 0x7f, 0xff,
-
-    /* U+005E "^" */
-    0x0, 0x15, 0x50, 0x0, 0x0, 0xff, 0xd0, 0x0,
-    0x7, 0xff, 0xc0, 0x0, 0x3f, 0xff, 0x0, 0x0,
-    0xfe, 0xfe, 0x0, 0xb, 0xf2, 0xfc, 0x0, 0x3f,
-    0x87, 0xf4, 0x1, 0xfd, 0xf, 0xf0, 0xf, 0xf0,
-    0x2f, 0xc0, 0x3f, 0x80, 0x3f, 0x82, 0xfc, 0x0,
-    0xff, 0xf, 0xf0, 0x1, 0xfd,
-
-    /* U+005F "_" */
-    0x0, 0x0, 0x0, 0x3, 0xff, 0xff, 0xff, 0xff,
-    0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
-
-    /* U+0060 "`" */
-    0x15, 0x40, 0x7, 0xfc, 0x0, 0x7f, 0x80, 0x7,
-    0xf4, 0x0, 0x7f, 0x0,
-
-    /* U+0061 "a" */
-    0x0, 0x1f, 0xf8, 0xbf, 0xc0, 0xf, 0xff, 0xff,
-    0xfc, 0x3, 0xff, 0xff, 0xff, 0xc0, 0xbf, 0xfe,
-    0xff, 0xfc, 0x1f, 0xfd, 0x0, 0xff, 0xc2, 0xff,
-    0x40, 0x7, 0xfc, 0x3f, 0xf0, 0x0, 0x7f, 0xc3,
-    0xfe, 0x0, 0x7, 0xfc, 0x3f, 0xe0, 0x0, 0x7f,
-    0xc3, 0xfe, 0x0, 0x7, 0xfc, 0x3f, 0xf0, 0x0,
-    0x7f, 0xc2, 0xff, 0x40, 0x7, 0xfc, 0x1f, 0xfd,
-    0x0, 0xff, 0xc0, 0xbf, 0xfe, 0xbf, 0xfc, 0x3,
-    0xff, 0xff, 0xff, 0xc0, 0xf, 0xff, 0xff, 0xfd,
-    0x0, 0x1f, 0xf9, 0x3f, 0xe0,
-
-    /* U+0062 "b" */
-    0x1f, 0xf4, 0x0, 0x0, 0x1, 0xff, 0x40, 0x0,
-    0x0, 0x1f, 0xf4, 0x0, 0x0, 0x1, 0xff, 0x40,
-    0x0, 0x0, 0x1f, 0xf4, 0x0, 0x0, 0x1, 0xff,
-    0x40, 0x0, 0x0, 0x1f, 0xf4, 0x0, 0x0, 0x1,
-    0xff, 0x4b, 0xf9, 0x0, 0x1f, 0xff, 0xff, 0xf8,
-    0x1, 0xff, 0xff, 0xff, 0xe0, 0x1f, 0xff, 0xaf,
-    0xff, 0x41, 0xff, 0x80, 0x2f, 0xfc, 0x1f, 0xf0,
-    0x0, 0xff, 0xc1, 0xff, 0x0, 0x7, 0xfd, 0x1f,
-    0xf0, 0x0, 0x3f, 0xe1, 0xff, 0x0, 0x3, 0xfe,
-    0x1f, 0xf0, 0x0, 0x3f, 0xe1, 0xff, 0x0, 0x7,
-    0xfd, 0x1f, 0xf0, 0x0, 0xff, 0xd1, 0xff, 0x80,
-    0x2f, 0xfc, 0x2f, 0xff, 0xaf, 0xff, 0x42, 0xff,
-    0xff, 0xff, 0xe0, 0x2f, 0xff, 0xff, 0xf8, 0x3,
-    0xfe, 0x2f, 0xf9, 0x0,
-
-    /* U+0063 "c" */
-    0x0, 0x6, 0xff, 0x90, 0x1, 0xff, 0xff, 0xf0,
-    0x2f, 0xff, 0xff, 0xc2, 0xff, 0xff, 0xff, 0xf,
-    0xff, 0x40, 0x4, 0xbf, 0xe0, 0x0, 0x3, 0xff,
-    0x0, 0x0, 0xf, 0xfc, 0x0, 0x0, 0x3f, 0xe0,
-    0x0, 0x0, 0xff, 0xc0, 0x0, 0x3, 0xff, 0x0,
-    0x0, 0xb, 0xff, 0x0, 0x0, 0xf, 0xff, 0x40,
-    0x1c, 0x1f, 0xff, 0xff, 0xf0, 0x2f, 0xff, 0xff,
-    0xc0, 0x1f, 0xff, 0xff, 0x0, 0x6, 0xff, 0xe0,
-
-    /* U+0064 "d" */
-    0x0, 0x0, 0x0, 0xbf, 0xc0, 0x0, 0x0, 0xb,
-    0xfc, 0x0, 0x0, 0x0, 0xbf, 0xc0, 0x0, 0x0,
-    0xb, 0xfc, 0x0, 0x0, 0x0, 0xbf, 0xc0, 0x0,
-    0x0, 0xb, 0xfc, 0x0, 0x0, 0x0, 0xbf, 0xc0,
-    0x1, 0xff, 0x8b, 0xfc, 0x0, 0xff, 0xff, 0xff,
-    0xc0, 0x3f, 0xff, 0xff, 0xfc, 0xb, 0xff, 0xeb,
-    0xff, 0xc0, 0xff, 0xd0, 0xf, 0xfc, 0x2f, 0xf4,
-    0x0, 0x7f, 0xc3, 0xff, 0x0, 0x3, 0xfc, 0x3f,
-    0xe0, 0x0, 0x3f, 0xc3, 0xfe, 0x0, 0x3, 0xfc,
-    0x3f, 0xe0, 0x0, 0x3f, 0xc3, 0xff, 0x0, 0x3,
-    0xfc, 0x2f, 0xf4, 0x0, 0x3f, 0xc1, 0xff, 0xd0,
-    0xf, 0xfc, 0xb, 0xff, 0xeb, 0xff, 0xc0, 0x3f,
-    0xff, 0xff, 0xfc, 0x1, 0xff, 0xff, 0xff, 0xd0,
-    0x1, 0xff, 0x93, 0xfe,
-
-    /* U+0065 "e" */
-    0x0, 0x1b, 0xfe, 0x40, 0x0, 0xf, 0xff, 0xff,
-    0x40, 0x3, 0xff, 0xff, 0xfd, 0x0, 0xff, 0xfa,
-    0xbf, 0xf0, 0x1f, 0xf8, 0x0, 0xff, 0x82, 0xff,
-    0x0, 0x7, 0xfc, 0x3f, 0xff, 0xff, 0xff, 0xc3,
-    0xff, 0xff, 0xff, 0xfd, 0x3f, 0xff, 0xff, 0xff,
-    0xd3, 0xff, 0x55, 0x55, 0x54, 0x3f, 0xf0, 0x0,
-    0x0, 0x2, 0xff, 0x40, 0x0, 0x0, 0xf, 0xfd,
-    0x0, 0xb, 0x0, 0xbf, 0xfe, 0xaf, 0xf0, 0x3,
-    0xff, 0xff, 0xff, 0x0, 0xb, 0xff, 0xff, 0xf0,
-    0x0, 0x6, 0xff, 0xe4, 0x0,
-
-    /* U+0066 "f" */
-    0x0, 0x2f, 0xfd, 0x0, 0xff, 0xfd, 0x2, 0xff,
-    0xfd, 0x3, 0xff, 0xfd, 0x3, 0xff, 0x0, 0x3,
-    0xff, 0x0, 0x3, 0xff, 0x0, 0xff, 0xff, 0xff,
-    0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xab, 0xff,
-    0xaa, 0x3, 0xff, 0x0, 0x3, 0xff, 0x0, 0x3,
-    0xff, 0x0, 0x3, 0xff, 0x0, 0x3, 0xff, 0x0,
-    0x3, 0xff, 0x0, 0x3, 0xff, 0x0, 0x3, 0xff,
-    0x0, 0x3, 0xff, 0x0, 0x3, 0xff, 0x0, 0x3,
-    0xff, 0x0, 0x3, 0xff, 0x0, 0x3, 0xff, 0x0,
-
-    /* U+0067 "g" */
-    0x0, 0x1f, 0xf8, 0xff, 0xc0, 0x3f, 0xff, 0xff,
-    0xf0, 0x3f, 0xff, 0xff, 0xfc, 0x2f, 0xff, 0xaf,
-    0xff, 0x1f, 0xfd, 0x0, 0xff, 0xcb, 0xfd, 0x0,
-    0x1f, 0xf3, 0xff, 0x0, 0x3, 0xfc, 0xff, 0x80,
-    0x0, 0xff, 0x3f, 0xe0, 0x0, 0x3f, 0xcf, 0xf8,
-    0x0, 0xf, 0xf3, 0xff, 0x0, 0x3, 0xfc, 0xbf,
-    0xd0, 0x1, 0xff, 0x1f, 0xfd, 0x0, 0xff, 0xc2,
-    0xff, 0xfb, 0xff, 0xf0, 0x3f, 0xff, 0xff, 0xfc,
-    0x3, 0xff, 0xff, 0xff, 0x0, 0x1f, 0xf8, 0xff,
-    0xc0, 0x0, 0x0, 0x3f, 0xf0, 0x0, 0x0, 0x2f,
-    0xf8, 0x7a, 0x55, 0x7f, 0xfd, 0x1f, 0xff, 0xff,
-    0xff, 0x7, 0xff, 0xff, 0xff, 0x41, 0xff, 0xff,
-    0xff, 0x40, 0x6, 0xff, 0xf9, 0x0,
-
-    /* U+0068 "h" */
-    0x7f, 0xd0, 0x0, 0x0, 0x7f, 0xd0, 0x0, 0x0,
-    0x7f, 0xd0, 0x0, 0x0, 0x7f, 0xd0, 0x0, 0x0,
-    0x7f, 0xd0, 0x0, 0x0, 0x7f, 0xd0, 0x0, 0x0,
-    0x7f, 0xd0, 0x0, 0x0, 0x7f, 0xd1, 0xbf, 0x80,
-    0x7f, 0xdf, 0xff, 0xf0, 0x7f, 0xff, 0xff, 0xf8,
-    0x7f, 0xff, 0xff, 0xfc, 0x7f, 0xf4, 0xf, 0xfd,
-    0x7f, 0xd0, 0x7, 0xfd, 0x7f, 0xd0, 0x7, 0xfd,
-    0x7f, 0xd0, 0x7, 0xfd, 0x7f, 0xd0, 0x7, 0xfd,
-    0x7f, 0xd0, 0x7, 0xfd, 0x7f, 0xd0, 0x7, 0xfd,
-    0x7f, 0xd0, 0x7, 0xfd, 0x7f, 0xd0, 0x7, 0xfd,
-    0x7f, 0xd0, 0x7, 0xfd, 0x7f, 0xd0, 0x7, 0xfd,
-    0x7f, 0xd0, 0x7, 0xfd, 0x7f, 0xd0, 0x7, 0xfd,
-
-    /* U+0069 "i" */
-    0x3f, 0xe3, 0xfe, 0x3f, 0xe3, 0xfe, 0x3f, 0xe0,
-    0x0, 0x0, 0x3, 0xfe, 0x3f, 0xe3, 0xfe, 0x3f,
-    0xe3, 0xfe, 0x3f, 0xe3, 0xfe, 0x3f, 0xe3, 0xfe,
-    0x3f, 0xe3, 0xfe, 0x3f, 0xe3, 0xfe, 0x3f, 0xe3,
-    0xfe, 0x3f, 0xe3, 0xfe,
-
-    /* U+006A "j" */
-    0x0, 0xff, 0xc0, 0xf, 0xfc, 0x0, 0xff, 0xc0,
-    0xf, 0xfc, 0x0, 0xbf, 0xc0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0xf, 0xfc, 0x0, 0xff, 0xc0, 0xf,
-    0xfc, 0x0, 0xff, 0xc0, 0xf, 0xfc, 0x0, 0xff,
-    0xc0, 0xf, 0xfc, 0x0, 0xff, 0xc0, 0xf, 0xfc,
-    0x0, 0xff, 0xc0, 0xf, 0xfc, 0x0, 0xff, 0xc0,
-    0xf, 0xfc, 0x0, 0xff, 0xc0, 0xf, 0xfc, 0x0,
-    0xff, 0xc0, 0xf, 0xfc, 0x0, 0xff, 0xc0, 0x1f,
-    0xf8, 0x1b, 0xff, 0x4b, 0xff, 0xf0, 0xbf, 0xfd,
-    0xb, 0xff, 0x40, 0xbe, 0x40, 0x0,
-
-    /* U+006B "k" */
-    0x7f, 0xd0, 0x0, 0x0, 0x7f, 0xd0, 0x0, 0x0,
-    0x7f, 0xd0, 0x0, 0x0, 0x7f, 0xd0, 0x0, 0x0,
-    0x7f, 0xd0, 0x0, 0x0, 0x7f, 0xd0, 0x0, 0x0,
-    0x7f, 0xd0, 0x0, 0x0, 0x7f, 0xd0, 0x2f, 0xf4,
-    0x7f, 0xd0, 0x3f, 0xf0, 0x7f, 0xd0, 0xff, 0xc0,
-    0x7f, 0xd1, 0xff, 0x40, 0x7f, 0xd3, 0xff, 0x0,
-    0x7f, 0xdb, 0xfc, 0x0, 0x7f, 0xff, 0xf4, 0x0,
-    0x7f, 0xff, 0xf0, 0x0, 0x7f, 0xff, 0xf0, 0x0,
-    0x7f, 0xff, 0xfc, 0x0, 0x7f, 0xd7, 0xfe, 0x0,
-    0x7f, 0xd1, 0xff, 0x40, 0x7f, 0xd0, 0xbf, 0xc0,
-    0x7f, 0xd0, 0x3f, 0xe0, 0x7f, 0xd0, 0x2f, 0xf0,
-    0x7f, 0xd0, 0xf, 0xf4, 0x7f, 0xd0, 0xb, 0xfc,
-
-    /* U+006C "l" */
-    0x7f, 0xd0, 0x1f, 0xf4, 0x7, 0xfd, 0x1, 0xff,
-    0x40, 0x7f, 0xd0, 0x1f, 0xf4, 0x7, 0xfd, 0x1,
-    0xff, 0x40, 0x7f, 0xd0, 0x1f, 0xf4, 0x7, 0xfd,
-    0x1, 0xff, 0x40, 0x7f, 0xd0, 0x1f, 0xf4, 0x7,
-    0xfd, 0x1, 0xff, 0x40, 0x7f, 0xd0, 0x1f, 0xf4,
-    0x7, 0xfe, 0x1, 0xff, 0xd0, 0x3f, 0xff, 0xb,
-    0xff, 0xc0, 0xff, 0xf0, 0xb, 0xfc,
-
-    /* U+006D "m" */
-    0x7f, 0xd1, 0xbf, 0x80, 0x6f, 0xe0, 0x1f, 0xfb,
-    0xff, 0xfd, 0xff, 0xff, 0x7, 0xff, 0xff, 0xff,
-    0xff, 0xff, 0xd1, 0xff, 0xff, 0xff, 0xff, 0xff,
-    0xfc, 0x7f, 0xf4, 0x1f, 0xfd, 0x7, 0xff, 0x1f,
-    0xf4, 0x3, 0xff, 0x0, 0xff, 0xc7, 0xfd, 0x0,
-    0xbf, 0xc0, 0x2f, 0xf1, 0xff, 0x40, 0x2f, 0xf0,
-    0xb, 0xfc, 0x7f, 0xd0, 0xb, 0xfc, 0x2, 0xff,
-    0x1f, 0xf4, 0x2, 0xff, 0x0, 0xbf, 0xc7, 0xfd,
-    0x0, 0xbf, 0xc0, 0x2f, 0xf1, 0xff, 0x40, 0x2f,
-    0xf0, 0xb, 0xfc, 0x7f, 0xd0, 0xb, 0xfc, 0x2,
-    0xff, 0x1f, 0xf4, 0x2, 0xff, 0x0, 0xbf, 0xc7,
-    0xfd, 0x0, 0xbf, 0xc0, 0x2f, 0xf1, 0xff, 0x40,
-    0x2f, 0xf0, 0xb, 0xfc, 0x7f, 0xd0, 0xb, 0xfc,
-    0x2, 0xff, 0x0,
-
-    /* U+006E "n" */
-    0x7f, 0xd0, 0xbf, 0x80, 0x7f, 0xdb, 0xff, 0xf4,
-    0x7f, 0xff, 0xff, 0xfc, 0x7f, 0xff, 0xff, 0xfd,
-    0x7f, 0xf4, 0xb, 0xfe, 0x7f, 0xd0, 0x3, 0xfe,
-    0x7f, 0xd0, 0x3, 0xfe, 0x7f, 0xd0, 0x3, 0xfe,
-    0x7f, 0xd0, 0x3, 0xfe, 0x7f, 0xd0, 0x3, 0xfe,
-    0x7f, 0xd0, 0x3, 0xfe, 0x7f, 0xd0, 0x3, 0xfe,
-    0x7f, 0xd0, 0x3, 0xfe, 0x7f, 0xd0, 0x3, 0xfe,
-    0x7f, 0xd0, 0x3, 0xfe, 0x7f, 0xd0, 0x3, 0xfe,
-    0x7f, 0xd0, 0x3, 0xfe,
-
-    /* U+006F "o" */
-    0x0, 0x1b, 0xff, 0x80, 0x0, 0xf, 0xff, 0xff,
-    0x80, 0x3, 0xff, 0xff, 0xff, 0x0, 0xff, 0xfa,
-    0xff, 0xf8, 0x1f, 0xfc, 0x1, 0xff, 0xc2, 0xff,
-    0x40, 0x7, 0xfd, 0x3f, 0xf0, 0x0, 0x3f, 0xe3,
-    0xff, 0x0, 0x3, 0xff, 0x3f, 0xe0, 0x0, 0x3f,
-    0xf3, 0xff, 0x0, 0x3, 0xff, 0x3f, 0xf0, 0x0,
-    0x3f, 0xe2, 0xff, 0x40, 0xb, 0xfd, 0xf, 0xfd,
-    0x1, 0xff, 0xc0, 0xbf, 0xfe, 0xff, 0xf4, 0x3,
-    0xff, 0xff, 0xfe, 0x0, 0xb, 0xff, 0xff, 0x80,
-    0x0, 0xb, 0xff, 0x80, 0x0,
-
-    /* U+0070 "p" */
-    0x1f, 0xf4, 0xaf, 0xd0, 0x0, 0x7f, 0xef, 0xff,
-    0xf4, 0x1, 0xff, 0xff, 0xff, 0xf4, 0x7, 0xff,
-    0xfb, 0xff, 0xf0, 0x1f, 0xfc, 0x0, 0xff, 0xd0,
-    0x7f, 0xd0, 0x1, 0xff, 0xc1, 0xff, 0x40, 0x2,
-    0xff, 0x7, 0xfd, 0x0, 0xb, 0xfc, 0x1f, 0xf4,
-    0x0, 0x1f, 0xf0, 0x7f, 0xd0, 0x0, 0xbf, 0xc1,
-    0xff, 0x40, 0x2, 0xff, 0x7, 0xfd, 0x0, 0x1f,
-    0xfc, 0x1f, 0xfc, 0x0, 0xff, 0xd0, 0x7f, 0xff,
-    0xbf, 0xff, 0x1, 0xff, 0xff, 0xff, 0xf4, 0x7,
-    0xfe, 0xff, 0xff, 0x40, 0x1f, 0xf4, 0xbf, 0xe0,
-    0x0, 0xbf, 0xd0, 0x0, 0x0, 0x2, 0xff, 0x0,
-    0x0, 0x0, 0xb, 0xfc, 0x0, 0x0, 0x0, 0x2f,
-    0xf0, 0x0, 0x0, 0x0, 0xbf, 0xc0, 0x0, 0x0,
-    0x3, 0xff, 0x0, 0x0, 0x0, 0xf, 0xfc, 0x0,
-    0x0, 0x0,
-
-    /* U+0071 "q" */
-    0x0, 0x1f, 0xf8, 0x3f, 0xe0, 0x3, 0xff, 0xfe,
-    0xff, 0x80, 0x3f, 0xff, 0xff, 0xfe, 0x2, 0xff,
-    0xfb, 0xff, 0xf8, 0x1f, 0xfd, 0x0, 0xff, 0xe0,
-    0xbf, 0xd0, 0x1, 0xff, 0x83, 0xff, 0x0, 0x3,
-    0xfe, 0xf, 0xf8, 0x0, 0xf, 0xf8, 0x3f, 0xe0,
-    0x0, 0x3f, 0xe0, 0xff, 0x80, 0x0, 0xff, 0x83,
-    0xff, 0x0, 0x3, 0xfe, 0xb, 0xfd, 0x0, 0x1f,
-    0xf8, 0x1f, 0xfd, 0x0, 0xff, 0xe0, 0x2f, 0xff,
-    0xbf, 0xff, 0x80, 0x3f, 0xff, 0xff, 0xfe, 0x0,
-    0x3f, 0xff, 0xef, 0xf8, 0x0, 0x1f, 0xf8, 0x3f,
-    0xe0, 0x0, 0x0, 0x0, 0xff, 0x80, 0x0, 0x0,
-    0x3, 0xfe, 0x0, 0x0, 0x0, 0xf, 0xf8, 0x0,
-    0x0, 0x0, 0x3f, 0xe0, 0x0, 0x0, 0x0, 0xff,
-    0xc0, 0x0, 0x0, 0x3, 0xff, 0x0, 0x0, 0x0,
-    0xb, 0xfc,
-
-    /* U+0072 "r" */
-    0x7f, 0xd2, 0xf9, 0xff, 0xbf, 0xf7, 0xff, 0xff,
-    0xdf, 0xff, 0xfe, 0x7f, 0xf8, 0x1, 0xff, 0x40,
-    0x7, 0xfd, 0x0, 0x1f, 0xf4, 0x0, 0x7f, 0xd0,
-    0x1, 0xff, 0x40, 0x7, 0xfd, 0x0, 0x1f, 0xf4,
-    0x0, 0x7f, 0xd0, 0x1, 0xff, 0x40, 0x7, 0xfd,
-    0x0, 0x1f, 0xf4, 0x0, 0x7f, 0xd0, 0x0,
-
-    /* U+0073 "s" */
-    0x1, 0xbf, 0xe4, 0x7, 0xff, 0xff, 0x43, 0xff,
-    0xff, 0xd2, 0xff, 0xef, 0xf4, 0xff, 0xc0, 0x9,
-    0x3f, 0xf0, 0x0, 0xb, 0xff, 0x80, 0x0, 0xff,
-    0xff, 0x40, 0xb, 0xff, 0xfc, 0x0, 0x2f, 0xff,
-    0xc0, 0x0, 0x3f, 0xf6, 0x0, 0x3, 0xfe, 0xf9,
-    0x1, 0xff, 0xbf, 0xff, 0xff, 0xdf, 0xff, 0xff,
-    0xf2, 0xff, 0xff, 0xf0, 0x6, 0xff, 0xe0, 0x0,
-
-    /* U+0074 "t" */
-    0x3, 0xfd, 0x0, 0xf, 0xf4, 0x0, 0x3f, 0xd0,
-    0x0, 0xff, 0x40, 0x3, 0xfd, 0x2, 0xff, 0xff,
-    0xdb, 0xff, 0xff, 0x6f, 0xff, 0xfd, 0x6f, 0xff,
-    0xa4, 0xf, 0xf4, 0x0, 0x3f, 0xd0, 0x0, 0xff,
-    0x40, 0x3, 0xfd, 0x0, 0xf, 0xf4, 0x0, 0x3f,
-    0xd0, 0x0, 0xff, 0x40, 0x3, 0xfd, 0x0, 0xf,
-    0xf8, 0x0, 0x3f, 0xff, 0x0, 0xff, 0xfd, 0x1,
-    0xff, 0xf4, 0x1, 0xbf, 0xc0,
-
-    /* U+0075 "u" */
-    0xbf, 0xd0, 0x3, 0xfe, 0x2f, 0xf4, 0x0, 0xff,
-    0x8b, 0xfd, 0x0, 0x3f, 0xe2, 0xff, 0x40, 0xf,
-    0xf8, 0xbf, 0xd0, 0x3, 0xfe, 0x2f, 0xf4, 0x0,
-    0xff, 0x8b, 0xfd, 0x0, 0x3f, 0xe2, 0xff, 0x40,
-    0xf, 0xf8, 0xbf, 0xd0, 0x3, 0xfe, 0x2f, 0xf4,
-    0x0, 0xff, 0x8b, 0xfd, 0x0, 0x3f, 0xe2, 0xff,
-    0x40, 0xf, 0xf8, 0x7f, 0xe0, 0x1f, 0xfe, 0x1f,
-    0xff, 0xff, 0xff, 0x83, 0xff, 0xff, 0xff, 0xe0,
-    0x3f, 0xff, 0xcb, 0xfc, 0x2, 0xfe, 0x41, 0xff,
-    0x0,
-
-    /* U+0076 "v" */
-    0xbf, 0xc0, 0x0, 0x3f, 0xe7, 0xfd, 0x0, 0x7,
-    0xfd, 0x3f, 0xe0, 0x0, 0xff, 0xc3, 0xff, 0x0,
-    0xf, 0xf8, 0x1f, 0xf4, 0x1, 0xff, 0x40, 0xff,
-    0x80, 0x2f, 0xf0, 0xf, 0xfc, 0x3, 0xff, 0x0,
-    0xbf, 0xc0, 0x3f, 0xd0, 0x7, 0xfd, 0x7, 0xfc,
-    0x0, 0x3f, 0xe0, 0xbf, 0xc0, 0x2, 0xff, 0xf,
-    0xf8, 0x0, 0x1f, 0xf1, 0xff, 0x40, 0x0, 0xff,
-    0x6f, 0xf0, 0x0, 0xf, 0xff, 0xfe, 0x0, 0x0,
-    0x7f, 0xff, 0xd0, 0x0, 0x3, 0xff, 0xfc, 0x0,
-    0x0, 0x3f, 0xff, 0xc0, 0x0,
-
-    /* U+0077 "w" */
-    0x7f, 0xd0, 0x3, 0xfd, 0x0, 0x3f, 0xf3, 0xfe,
-    0x0, 0x7f, 0xe0, 0x3, 0xfe, 0x3f, 0xf0, 0x7,
-    0xff, 0x0, 0x7f, 0xc2, 0xff, 0x0, 0xbf, 0xf0,
-    0xb, 0xfc, 0x1f, 0xf0, 0xf, 0xff, 0x40, 0xff,
-    0x80, 0xff, 0x40, 0xff, 0xf8, 0xf, 0xf4, 0xb,
-    0xf8, 0x1f, 0xef, 0xc1, 0xff, 0x0, 0x7f, 0xc2,
-    0xfd, 0xfc, 0x2f, 0xf0, 0x3, 0xfc, 0x3f, 0x8f,
-    0xc3, 0xfe, 0x0, 0x3f, 0xd3, 0xf4, 0xfd, 0x3f,
-    0xd0, 0x2, 0xfe, 0x3f, 0xf, 0xe3, 0xfc, 0x0,
-    0x1f, 0xf7, 0xf0, 0xbf, 0x7f, 0x80, 0x0, 0xff,
-    0xff, 0x7, 0xff, 0xf4, 0x0, 0xb, 0xff, 0xe0,
-    0x3f, 0xff, 0x0, 0x0, 0x7f, 0xfd, 0x3, 0xff,
-    0xf0, 0x0, 0x3, 0xff, 0xc0, 0x3f, 0xfe, 0x0,
-    0x0, 0x3f, 0xfc, 0x2, 0xff, 0xd0, 0x0,
-
-    /* U+0078 "x" */
-    0x3f, 0xf0, 0x0, 0xbf, 0xc1, 0xff, 0x40, 0xf,
-    0xf8, 0xb, 0xfc, 0x3, 0xff, 0x0, 0x3f, 0xe0,
-    0xbf, 0xc0, 0x1, 0xff, 0x4f, 0xf8, 0x0, 0xb,
-    0xff, 0xff, 0x0, 0x0, 0x3f, 0xff, 0xc0, 0x0,
-    0x1, 0xff, 0xf8, 0x0, 0x0, 0xf, 0xff, 0x0,
-    0x0, 0x0, 0xff, 0xf4, 0x0, 0x0, 0x3f, 0xff,
-    0xc0, 0x0, 0xb, 0xff, 0xff, 0x0, 0x1, 0xff,
-    0x5f, 0xf4, 0x0, 0x3f, 0xf0, 0xbf, 0xc0, 0xb,
-    0xfc, 0x3, 0xff, 0x1, 0xff, 0x80, 0x1f, 0xf4,
-    0x3f, 0xf0, 0x0, 0xff, 0xc0,
-
-    /* U+0079 "y" */
-    0xff, 0xc0, 0x0, 0xbf, 0xd7, 0xfd, 0x0, 0xf,
-    0xfc, 0x3f, 0xf0, 0x0, 0xff, 0x82, 0xff, 0x0,
-    0x1f, 0xf4, 0xf, 0xf8, 0x3, 0xff, 0x0, 0xff,
-    0xc0, 0x3f, 0xf0, 0x7, 0xfd, 0x7, 0xfe, 0x0,
-    0x3f, 0xe0, 0xbf, 0xc0, 0x2, 0xff, 0xf, 0xfc,
-    0x0, 0x1f, 0xf4, 0xff, 0x80, 0x0, 0xff, 0xdf,
-    0xf4, 0x0, 0x7, 0xff, 0xff, 0x0, 0x0, 0x3f,
-    0xff, 0xe0, 0x0, 0x2, 0xff, 0xfd, 0x0, 0x0,
-    0x1f, 0xff, 0xc0, 0x0, 0x0, 0xb, 0xfc, 0x0,
-    0x0, 0x0, 0xff, 0x80, 0x0, 0x0, 0x1f, 0xf0,
-    0x0, 0x0, 0x3, 0xfe, 0x0, 0x0, 0x6, 0xff,
-    0xd0, 0x0, 0x1f, 0xff, 0xf8, 0x0, 0x1, 0xff,
-    0xfe, 0x0, 0x0, 0x1f, 0xff, 0x40, 0x0, 0x1,
-    0xfe, 0x40, 0x0, 0x0,
-
-    /* U+007A "z" */
-    0x1f, 0xff, 0xff, 0xf8, 0x7f, 0xff, 0xff, 0xe1,
-    0xff, 0xff, 0xff, 0x86, 0xaa, 0xaf, 0xfd, 0x0,
-    0x0, 0x7f, 0xf0, 0x0, 0x7, 0xff, 0x0, 0x0,
-    0x3f, 0xf0, 0x0, 0x3, 0xff, 0x0, 0x0, 0x3f,
-    0xf4, 0x0, 0x2, 0xff, 0x40, 0x0, 0x2f, 0xf8,
-    0x0, 0x2, 0xff, 0x80, 0x0, 0x1f, 0xfc, 0x0,
-    0x0, 0xff, 0xfa, 0xaa, 0xa3, 0xff, 0xff, 0xff,
-    0x8f, 0xff, 0xff, 0xfe, 0x3f, 0xff, 0xff, 0xf8,
-
-    /* U+007B "{" */
-    0x0, 0x6, 0xf0, 0x3, 0xff, 0x0, 0xff, 0xf0,
-    0x1f, 0xff, 0x2, 0xff, 0x0, 0x3f, 0xe0, 0x3,
-    0xfd, 0x0, 0x3f, 0xd0, 0x3, 0xfd, 0x0, 0x3f,
-    0xd0, 0x3, 0xfd, 0x0, 0x3f, 0xd0, 0x3, 0xfd,
-    0x1, 0xbf, 0xc0, 0x3f, 0xf4, 0x3, 0xfd, 0x0,
-    0x3f, 0xf8, 0x0, 0x7f, 0xc0, 0x3, 0xfd, 0x0,
-    0x3f, 0xd0, 0x3, 0xfd, 0x0, 0x3f, 0xd0, 0x3,
-    0xfd, 0x0, 0x3f, 0xd0, 0x3, 0xfe, 0x0, 0x2f,
-    0xf0, 0x2, 0xff, 0xf0, 0xf, 0xff, 0x0, 0x7f,
-    0xf0, 0x0, 0x6f,
-
-    /* U+007C "|" */
-    0x15, 0x1f, 0xc7, 0xf1, 0xfc, 0x7f, 0x1f, 0xc7,
-    0xf1, 0xfc, 0x7f, 0x1f, 0xc7, 0xf1, 0xfc, 0x7f,
-    0x1f, 0xc7, 0xf1, 0xfc, 0x7f, 0x1f, 0xc7, 0xf1,
-    0xfc, 0x7f, 0x1f, 0xc7, 0xf1, 0xfc, 0x7f, 0x1f,
-    0xc7, 0xf1, 0xfc, 0x7f, 0x1f, 0xc0,
-
-    /* U+007D "}" */
-    0x7a, 0x0, 0x7, 0xfe, 0x0, 0x7f, 0xf4, 0x7,
-    0xff, 0xc0, 0xb, 0xfc, 0x0, 0x3f, 0xd0, 0x3,
-    0xfd, 0x0, 0x3f, 0xd0, 0x3, 0xfd, 0x0, 0x3f,
-    0xd0, 0x3, 0xfd, 0x0, 0x3f, 0xd0, 0x3, 0xfe,
-    0x0, 0x2f, 0xf4, 0x0, 0xff, 0xe0, 0x2, 0xfe,
-    0x0, 0xff, 0xe0, 0x3f, 0xf0, 0x3, 0xfd, 0x0,
-    0x3f, 0xd0, 0x3, 0xfd, 0x0, 0x3f, 0xd0, 0x3,
-    0xfd, 0x0, 0x3f, 0xd0, 0x3, 0xfd, 0x0, 0xbf,
-    0xc0, 0x7f, 0xfc, 0x7, 0xff, 0x40, 0x7f, 0xe0,
-    0x7, 0xe0, 0x0,
-
-    /* U+007E "~" */
-    0x6, 0xf9, 0x0, 0x0, 0xb, 0xff, 0xf0, 0x0,
-    0x13, 0xff, 0xff, 0x80, 0xb4, 0xff, 0xff, 0xff,
-    0xfd, 0x39, 0x7, 0xff, 0xff, 0x48, 0x0, 0x2f,
-    0xff, 0xc0, 0x0, 0x0, 0xbf, 0x80,
-
-    /* U+5173 "�? */
-    0x0, 0x7f, 0xc0, 0x0, 0x3, 0xfc, 0x0, 0x0,
-    0x3f, 0xc0, 0x0, 0xb, 0xf8, 0x0, 0x0, 0x2f,
-    0xe0, 0x0, 0xf, 0xf0, 0x0, 0x3f, 0xff, 0xff,
-    0xff, 0xff, 0xff, 0xf8, 0x3f, 0xff, 0xff, 0xff,
-    0xff, 0xff, 0xf8, 0x3f, 0xff, 0xff, 0xff, 0xff,
-    0xff, 0xf8, 0x3f, 0xff, 0xff, 0xff, 0xff, 0xff,
-    0xf4, 0x0, 0x0, 0x0, 0xff, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0xff, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0xff, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0xff, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0xff, 0x0, 0x0, 0x0, 0xff, 0xff, 0xff, 0xff,
-    0xff, 0xff, 0xfd, 0xff, 0xff, 0xff, 0xff, 0xff,
-    0xff, 0xfd, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
-    0xfd, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xfd,
-    0x0, 0x0, 0xf, 0xff, 0xd0, 0x0, 0x0, 0x0,
-    0x0, 0x2f, 0xff, 0xf0, 0x0, 0x0, 0x0, 0x0,
-    0x7f, 0xef, 0xfc, 0x0, 0x0, 0x0, 0x1, 0xff,
-    0xc3, 0xff, 0x0, 0x0, 0x0, 0xb, 0xff, 0x2,
-    0xff, 0xd0, 0x0, 0x0, 0x7f, 0xfd, 0x0, 0xbf,
-    0xfc, 0x0, 0xb, 0xff, 0xf0, 0x0, 0x2f, 0xff,
-    0xd0, 0xbf, 0xff, 0xc0, 0x0, 0x7, 0xff, 0xfc,
-    0xbf, 0xfe, 0x0, 0x0, 0x0, 0xbf, 0xfd, 0xbf,
-    0xe0, 0x0, 0x0, 0x0, 0xf, 0xfd, 0xbd, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0xbd, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0,
-
     /* U+542F "�? */
     0x0, 0x0, 0x0, 0x3f, 0xc0, 0x0, 0x0, 0x3,
     0xff, 0xff, 0xff, 0xff, 0xff, 0xfc, 0x3, 0xff,
@@ -1327,34 +318,6 @@ static LV_ATTRIBUTE_LARGE_CONST const uint8_t glyph_bitmap[] = {
     0x3, 0xf9, 0x0, 0x0, 0x19, 0x0, 0x0, 0x0,
     0x0, 0x0, 0x0, 0x0,
 
-    /* U+7ECF "�? */
-    0x0, 0x3f, 0xc1, 0xff, 0xff, 0xff, 0xf8, 0x0,
-    0xf, 0xe0, 0x7f, 0xff, 0xff, 0xfc, 0x0, 0xb,
-    0xf4, 0x1f, 0xff, 0xff, 0xfe, 0x0, 0x3, 0xfc,
-    0x6, 0xaa, 0xab, 0xff, 0x40, 0x1, 0xfd, 0x0,
-    0x0, 0x1, 0xff, 0xc0, 0x0, 0xff, 0x0, 0x0,
-    0x1, 0xff, 0xc0, 0x0, 0x7f, 0x9f, 0xc0, 0x3,
-    0xff, 0xd0, 0x0, 0x3f, 0xcf, 0xe0, 0xb, 0xff,
-    0xfe, 0x0, 0xf, 0xf7, 0xf5, 0xbf, 0xff, 0xff,
-    0xfd, 0xb, 0xff, 0xfc, 0xff, 0xff, 0xff, 0xff,
-    0xd3, 0xff, 0xfd, 0x3f, 0xff, 0x40, 0xbf, 0xf4,
-    0x2f, 0xff, 0xf, 0xf8, 0x0, 0x1, 0xbd, 0x0,
-    0xff, 0x81, 0x0, 0x0, 0x0, 0x1, 0x0, 0x3f,
-    0xc0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x1f, 0xf0,
-    0x1f, 0xff, 0xff, 0xff, 0xe0, 0xf, 0xf4, 0x7,
-    0xff, 0xff, 0xff, 0xf8, 0x3, 0xff, 0xf5, 0xff,
-    0xff, 0xff, 0xfe, 0x2, 0xff, 0xfd, 0x15, 0x5b,
-    0xf9, 0x55, 0x40, 0xff, 0xff, 0x40, 0x1, 0xfd,
-    0x0, 0x0, 0x7f, 0xff, 0xd0, 0x0, 0x7f, 0x40,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x1f, 0xd0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x7, 0xf4, 0x0, 0x0,
-    0x1, 0x6b, 0x0, 0x1, 0xfd, 0x0, 0x0, 0xbf,
-    0xff, 0xda, 0xaa, 0xff, 0xea, 0xa9, 0x2f, 0xff,
-    0xf7, 0xff, 0xff, 0xff, 0xff, 0x8b, 0xff, 0xfd,
-    0xff, 0xff, 0xff, 0xff, 0xe2, 0xfe, 0x94, 0x7f,
-    0xff, 0xff, 0xff, 0xf8, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x0,
-
     /* U+8FDE "�? */
     0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x3,
     0xfc, 0x0, 0x0, 0xff, 0x0, 0x0, 0x0, 0x7f,
@@ -1381,31 +344,7 @@ static LV_ATTRIBUTE_LARGE_CONST const uint8_t glyph_bitmap[] = {
     0xff, 0xfa, 0xaa, 0xaa, 0xaa, 0x42, 0xff, 0xff,
     0xff, 0xff, 0xff, 0xff, 0xd0, 0xff, 0xff, 0xff,
     0xff, 0xff, 0xff, 0xf4, 0x7f, 0xc1, 0xbf, 0xff,
-    0xff, 0xff, 0xfd,
-
-    /* U+95ED "�? */
-    0xf, 0xf0, 0xf, 0xff, 0xff, 0xff, 0xf0, 0xbf,
-    0x80, 0xff, 0xff, 0xff, 0xff, 0x3, 0xfc, 0xf,
-    0xff, 0xff, 0xff, 0xf0, 0x2f, 0xe0, 0xff, 0xff,
-    0xff, 0xff, 0x0, 0xff, 0x0, 0x0, 0x0, 0xf,
-    0xf0, 0xa, 0xa0, 0x0, 0x0, 0x0, 0xff, 0xaa,
-    0x0, 0x0, 0x1f, 0xe0, 0xf, 0xff, 0xf0, 0x0,
-    0x1, 0xfe, 0x0, 0xff, 0xff, 0x0, 0x0, 0x1f,
-    0xe0, 0xf, 0xff, 0xf0, 0xff, 0xff, 0xff, 0xf0,
-    0xff, 0xff, 0xf, 0xff, 0xff, 0xff, 0xf, 0xff,
-    0xf0, 0xff, 0xff, 0xff, 0xf0, 0xff, 0xff, 0xa,
-    0xaa, 0xbf, 0xfa, 0xf, 0xff, 0xf0, 0x0, 0x1,
-    0xfe, 0x0, 0xff, 0xff, 0x0, 0x1, 0xbf, 0xe0,
-    0xf, 0xff, 0xf0, 0x1, 0xff, 0xfe, 0x0, 0xff,
-    0xff, 0x1, 0xff, 0xff, 0xe0, 0xf, 0xff, 0xf0,
-    0xff, 0xff, 0xfe, 0x0, 0xff, 0xff, 0xf, 0xff,
-    0x5f, 0xe0, 0xf, 0xff, 0xf0, 0xff, 0x41, 0xfe,
-    0x0, 0xff, 0xff, 0xe, 0x0, 0x1f, 0xe0, 0xf,
-    0xff, 0xf0, 0x0, 0x3f, 0xfe, 0x0, 0xff, 0xff,
-    0x0, 0x3, 0xff, 0xe0, 0xf, 0xff, 0xf0, 0x0,
-    0x3f, 0xfe, 0x2f, 0xff, 0xff, 0x0, 0x3, 0xff,
-    0xd2, 0xff, 0xff, 0xf0, 0x0, 0x0, 0x0, 0x2f,
-    0xff, 0xff, 0x0, 0x0, 0x0, 0x2, 0xff, 0xf0
+    0xff, 0xff, 0xfd
 };
 
 
@@ -1416,128 +355,44 @@ static LV_ATTRIBUTE_LARGE_CONST const uint8_t glyph_bitmap[] = {
 static const lv_font_fmt_txt_glyph_dsc_t glyph_dsc[] = {
     {.bitmap_index = 0, .adv_w = 0, .box_w = 0, .box_h = 0, .ofs_x = 0, .ofs_y = 0} /* id = 0 reserved */,
     {.bitmap_index = 0, .adv_w = 125, .box_w = 0, .box_h = 0, .ofs_x = 0, .ofs_y = 0},
-    {.bitmap_index = 0, .adv_w = 179, .box_w = 6, .box_h = 22, .ofs_x = 3, .ofs_y = 0},
-    {.bitmap_index = 33, .adv_w = 200, .box_w = 11, .box_h = 10, .ofs_x = 1, .ofs_y = 15},
-    {.bitmap_index = 61, .adv_w = 288, .box_w = 18, .box_h = 22, .ofs_x = 0, .ofs_y = 0},
-    {.bitmap_index = 160, .adv_w = 283, .box_w = 16, .box_h = 29, .ofs_x = 1, .ofs_y = -5},
-    {.bitmap_index = 276, .adv_w = 399, .box_w = 23, .box_h = 22, .ofs_x = 1, .ofs_y = 0},
-    {.bitmap_index = 403, .adv_w = 316, .box_w = 20, .box_h = 22, .ofs_x = 0, .ofs_y = 0},
-    {.bitmap_index = 513, .adv_w = 110, .box_w = 5, .box_h = 10, .ofs_x = 1, .ofs_y = 15},
-    {.bitmap_index = 526, .adv_w = 190, .box_w = 10, .box_h = 30, .ofs_x = 2, .ofs_y = -4},
-    {.bitmap_index = 601, .adv_w = 190, .box_w = 10, .box_h = 30, .ofs_x = 0, .ofs_y = -4},
-    {.bitmap_index = 676, .adv_w = 222, .box_w = 13, .box_h = 12, .ofs_x = 0, .ofs_y = 12},
-    {.bitmap_index = 715, .adv_w = 278, .box_w = 17, .box_h = 16, .ofs_x = 0, .ofs_y = 2},
-    {.bitmap_index = 783, .adv_w = 158, .box_w = 8, .box_h = 10, .ofs_x = 0, .ofs_y = -4},
-    {.bitmap_index = 803, .adv_w = 211, .box_w = 11, .box_h = 4, .ofs_x = 1, .ofs_y = 8},
-    {.bitmap_index = 814, .adv_w = 158, .box_w = 6, .box_h = 6, .ofs_x = 2, .ofs_y = 0},
-    {.bitmap_index = 823, .adv_w = 240, .box_w = 13, .box_h = 23, .ofs_x = 1, .ofs_y = -1},
-    {.bitmap_index = 898, .adv_w = 283, .box_w = 16, .box_h = 22, .ofs_x = 1, .ofs_y = 0},
-    {.bitmap_index = 986, .adv_w = 202, .box_w = 9, .box_h = 22, .ofs_x = 1, .ofs_y = 0},
-    {.bitmap_index = 1036, .adv_w = 283, .box_w = 15, .box_h = 22, .ofs_x = 1, .ofs_y = 0},
-    {.bitmap_index = 1119, .adv_w = 283, .box_w = 14, .box_h = 22, .ofs_x = 2, .ofs_y = 0},
-    {.bitmap_index = 1196, .adv_w = 283, .box_w = 16, .box_h = 22, .ofs_x = 1, .ofs_y = 0},
-    {.bitmap_index = 1284, .adv_w = 283, .box_w = 16, .box_h = 22, .ofs_x = 1, .ofs_y = 0},
-    {.bitmap_index = 1372, .adv_w = 283, .box_w = 16, .box_h = 22, .ofs_x = 1, .ofs_y = 0},
-    {.bitmap_index = 1460, .adv_w = 264, .box_w = 16, .box_h = 22, .ofs_x = 1, .ofs_y = 0},
-    {.bitmap_index = 1548, .adv_w = 283, .box_w = 16, .box_h = 22, .ofs_x = 1, .ofs_y = 0},
-    {.bitmap_index = 1636, .adv_w = 283, .box_w = 16, .box_h = 22, .ofs_x = 1, .ofs_y = 0},
-    {.bitmap_index = 1724, .adv_w = 194, .box_w = 6, .box_h = 17, .ofs_x = 3, .ofs_y = 0},
-    {.bitmap_index = 1750, .adv_w = 194, .box_w = 8, .box_h = 21, .ofs_x = 1, .ofs_y = -4},
-    {.bitmap_index = 1792, .adv_w = 278, .box_w = 17, .box_h = 19, .ofs_x = 0, .ofs_y = 1},
-    {.bitmap_index = 1873, .adv_w = 278, .box_w = 17, .box_h = 12, .ofs_x = 0, .ofs_y = 4},
-    {.bitmap_index = 1924, .adv_w = 278, .box_w = 17, .box_h = 19, .ofs_x = 0, .ofs_y = 1},
-    {.bitmap_index = 2005, .adv_w = 216, .box_w = 12, .box_h = 22, .ofs_x = 1, .ofs_y = 0},
-    {.bitmap_index = 2071, .adv_w = 410, .box_w = 24, .box_h = 25, .ofs_x = 1, .ofs_y = -3},
-    {.bitmap_index = 2221, .adv_w = 348, .box_w = 22, .box_h = 22, .ofs_x = 0, .ofs_y = 0},
-    {.bitmap_index = 2342, .adv_w = 324, .box_w = 19, .box_h = 22, .ofs_x = 1, .ofs_y = 0},
-    {.bitmap_index = 2447, .adv_w = 328, .box_w = 19, .box_h = 22, .ofs_x = 1, .ofs_y = 0},
-    {.bitmap_index = 2552, .adv_w = 337, .box_w = 19, .box_h = 22, .ofs_x = 1, .ofs_y = 0},
-    {.bitmap_index = 2657, .adv_w = 279, .box_w = 16, .box_h = 22, .ofs_x = 1, .ofs_y = 0},
-    {.bitmap_index = 2745, .adv_w = 266, .box_w = 15, .box_h = 22, .ofs_x = 1, .ofs_y = 0},
-    {.bitmap_index = 2828, .adv_w = 338, .box_w = 19, .box_h = 22, .ofs_x = 1, .ofs_y = 0},
-    {.bitmap_index = 2933, .adv_w = 345, .box_w = 19, .box_h = 22, .ofs_x = 1, .ofs_y = 0},
-    {.bitmap_index = 3038, .adv_w = 140, .box_w = 6, .box_h = 22, .ofs_x = 1, .ofs_y = 0},
-    {.bitmap_index = 3071, .adv_w = 158, .box_w = 10, .box_h = 26, .ofs_x = -1, .ofs_y = -4},
-    {.bitmap_index = 3136, .adv_w = 323, .box_w = 20, .box_h = 22, .ofs_x = 1, .ofs_y = 0},
-    {.bitmap_index = 3246, .adv_w = 251, .box_w = 15, .box_h = 22, .ofs_x = 1, .ofs_y = 0},
-    {.bitmap_index = 3329, .adv_w = 426, .box_w = 24, .box_h = 22, .ofs_x = 1, .ofs_y = 0},
-    {.bitmap_index = 3461, .adv_w = 348, .box_w = 19, .box_h = 22, .ofs_x = 1, .ofs_y = 0},
-    {.bitmap_index = 3566, .adv_w = 381, .box_w = 22, .box_h = 22, .ofs_x = 1, .ofs_y = 0},
-    {.bitmap_index = 3687, .adv_w = 318, .box_w = 18, .box_h = 22, .ofs_x = 1, .ofs_y = 0},
-    {.bitmap_index = 3786, .adv_w = 384, .box_w = 22, .box_h = 25, .ofs_x = 1, .ofs_y = -3},
-    {.bitmap_index = 3924, .adv_w = 317, .box_w = 19, .box_h = 22, .ofs_x = 1, .ofs_y = 0},
-    {.bitmap_index = 4029, .adv_w = 273, .box_w = 16, .box_h = 22, .ofs_x = 1, .ofs_y = 0},
-    {.bitmap_index = 4117, .adv_w = 269, .box_w = 17, .box_h = 22, .ofs_x = 0, .ofs_y = 0},
-    {.bitmap_index = 4211, .adv_w = 353, .box_w = 20, .box_h = 22, .ofs_x = 1, .ofs_y = 0},
-    {.bitmap_index = 4321, .adv_w = 345, .box_w = 22, .box_h = 22, .ofs_x = 0, .ofs_y = 0},
-    {.bitmap_index = 4442, .adv_w = 448, .box_w = 28, .box_h = 22, .ofs_x = 0, .ofs_y = 0},
-    {.bitmap_index = 4596, .adv_w = 350, .box_w = 22, .box_h = 22, .ofs_x = 0, .ofs_y = 0},
-    {.bitmap_index = 4717, .adv_w = 311, .box_w = 20, .box_h = 22, .ofs_x = 0, .ofs_y = 0},
-    {.bitmap_index = 4827, .adv_w = 313, .box_w = 18, .box_h = 22, .ofs_x = 1, .ofs_y = 0},
-    {.bitmap_index = 4926, .adv_w = 159, .box_w = 8, .box_h = 30, .ofs_x = 2, .ofs_y = -4},
-    {.bitmap_index = 4986, .adv_w = 242, .box_w = 15, .box_h = 27, .ofs_x = 0, .ofs_y = -3},
-    {.bitmap_index = 5088, .adv_w = 159, .box_w = 8, .box_h = 30, .ofs_x = 0, .ofs_y = -4},
-    {.bitmap_index = 5148, .adv_w = 278, .box_w = 15, .box_h = 12, .ofs_x = 1, .ofs_y = 10},
-    {.bitmap_index = 5193, .adv_w = 240, .box_w = 15, .box_h = 4, .ofs_x = 0, .ofs_y = -6},
-    {.bitmap_index = 5208, .adv_w = 208, .box_w = 9, .box_h = 5, .ofs_x = 1, .ofs_y = 20},
-    {.bitmap_index = 5220, .adv_w = 297, .box_w = 18, .box_h = 17, .ofs_x = 0, .ofs_y = 0},
-    {.bitmap_index = 5297, .adv_w = 297, .box_w = 18, .box_h = 24, .ofs_x = 0, .ofs_y = 0},
-    {.bitmap_index = 5405, .adv_w = 254, .box_w = 15, .box_h = 17, .ofs_x = 0, .ofs_y = 0},
-    {.bitmap_index = 5469, .adv_w = 297, .box_w = 18, .box_h = 24, .ofs_x = 0, .ofs_y = 0},
-    {.bitmap_index = 5577, .adv_w = 291, .box_w = 18, .box_h = 17, .ofs_x = 0, .ofs_y = 0},
-    {.bitmap_index = 5654, .adv_w = 192, .box_w = 12, .box_h = 24, .ofs_x = 0, .ofs_y = 0},
-    {.bitmap_index = 5726, .adv_w = 294, .box_w = 17, .box_h = 24, .ofs_x = 0, .ofs_y = -7},
-    {.bitmap_index = 5828, .adv_w = 287, .box_w = 16, .box_h = 24, .ofs_x = 1, .ofs_y = 0},
-    {.bitmap_index = 5924, .adv_w = 137, .box_w = 6, .box_h = 24, .ofs_x = 1, .ofs_y = 0},
-    {.bitmap_index = 5960, .adv_w = 152, .box_w = 10, .box_h = 31, .ofs_x = -1, .ofs_y = -7},
-    {.bitmap_index = 6038, .adv_w = 264, .box_w = 16, .box_h = 24, .ofs_x = 1, .ofs_y = 0},
-    {.bitmap_index = 6134, .adv_w = 153, .box_w = 9, .box_h = 24, .ofs_x = 1, .ofs_y = 0},
-    {.bitmap_index = 6188, .adv_w = 426, .box_w = 25, .box_h = 17, .ofs_x = 1, .ofs_y = 0},
-    {.bitmap_index = 6295, .adv_w = 291, .box_w = 16, .box_h = 17, .ofs_x = 1, .ofs_y = 0},
-    {.bitmap_index = 6363, .adv_w = 301, .box_w = 18, .box_h = 17, .ofs_x = 0, .ofs_y = 0},
-    {.bitmap_index = 6440, .adv_w = 304, .box_w = 19, .box_h = 24, .ofs_x = 0, .ofs_y = -7},
-    {.bitmap_index = 6554, .adv_w = 306, .box_w = 19, .box_h = 24, .ofs_x = 0, .ofs_y = -7},
-    {.bitmap_index = 6668, .adv_w = 196, .box_w = 11, .box_h = 17, .ofs_x = 1, .ofs_y = 0},
-    {.bitmap_index = 6715, .adv_w = 230, .box_w = 13, .box_h = 17, .ofs_x = 1, .ofs_y = 0},
-    {.bitmap_index = 6771, .adv_w = 176, .box_w = 11, .box_h = 22, .ofs_x = 0, .ofs_y = 0},
-    {.bitmap_index = 6832, .adv_w = 291, .box_w = 17, .box_h = 17, .ofs_x = 1, .ofs_y = 0},
-    {.bitmap_index = 6905, .adv_w = 287, .box_w = 18, .box_h = 17, .ofs_x = 0, .ofs_y = 0},
-    {.bitmap_index = 6982, .adv_w = 422, .box_w = 26, .box_h = 17, .ofs_x = 0, .ofs_y = 0},
-    {.bitmap_index = 7093, .adv_w = 291, .box_w = 18, .box_h = 17, .ofs_x = 0, .ofs_y = 0},
-    {.bitmap_index = 7170, .adv_w = 279, .box_w = 18, .box_h = 24, .ofs_x = 0, .ofs_y = -7},
-    {.bitmap_index = 7278, .adv_w = 248, .box_w = 15, .box_h = 17, .ofs_x = 0, .ofs_y = 0},
-    {.bitmap_index = 7342, .adv_w = 168, .box_w = 10, .box_h = 30, .ofs_x = 0, .ofs_y = -4},
-    {.bitmap_index = 7417, .adv_w = 108, .box_w = 5, .box_h = 30, .ofs_x = 1, .ofs_y = -5},
-    {.bitmap_index = 7455, .adv_w = 168, .box_w = 10, .box_h = 30, .ofs_x = 0, .ofs_y = -4},
-    {.bitmap_index = 7530, .adv_w = 278, .box_w = 17, .box_h = 7, .ofs_x = 0, .ofs_y = 7},
-    {.bitmap_index = 7560, .adv_w = 480, .box_w = 28, .box_h = 28, .ofs_x = 1, .ofs_y = -4},
-    {.bitmap_index = 7756, .adv_w = 480, .box_w = 28, .box_h = 27, .ofs_x = 0, .ofs_y = -3},
-    {.bitmap_index = 7945, .adv_w = 480, .box_w = 26, .box_h = 27, .ofs_x = 3, .ofs_y = -3},
-    {.bitmap_index = 8121, .adv_w = 480, .box_w = 28, .box_h = 27, .ofs_x = 1, .ofs_y = -3},
-    {.bitmap_index = 8310, .adv_w = 480, .box_w = 28, .box_h = 28, .ofs_x = 1, .ofs_y = -4},
-    {.bitmap_index = 8506, .adv_w = 480, .box_w = 29, .box_h = 28, .ofs_x = 0, .ofs_y = -4},
-    {.bitmap_index = 8709, .adv_w = 480, .box_w = 29, .box_h = 28, .ofs_x = 0, .ofs_y = -3},
-    {.bitmap_index = 8912, .adv_w = 480, .box_w = 26, .box_h = 27, .ofs_x = 2, .ofs_y = -3}
+    {.bitmap_index = 0, .adv_w = 202, .box_w = 9, .box_h = 22, .ofs_x = 1, .ofs_y = 0},
+    {.bitmap_index = 50, .adv_w = 283, .box_w = 15, .box_h = 22, .ofs_x = 1, .ofs_y = 0},
+    {.bitmap_index = 133, .adv_w = 283, .box_w = 14, .box_h = 22, .ofs_x = 2, .ofs_y = 0},
+    {.bitmap_index = 210, .adv_w = 283, .box_w = 16, .box_h = 22, .ofs_x = 1, .ofs_y = 0},
+    {.bitmap_index = 298, .adv_w = 348, .box_w = 22, .box_h = 22, .ofs_x = 0, .ofs_y = 0},
+    {.bitmap_index = 419, .adv_w = 328, .box_w = 19, .box_h = 22, .ofs_x = 1, .ofs_y = 0},
+    {.bitmap_index = 524, .adv_w = 279, .box_w = 16, .box_h = 22, .ofs_x = 1, .ofs_y = 0},
+    {.bitmap_index = 612, .adv_w = 140, .box_w = 6, .box_h = 22, .ofs_x = 1, .ofs_y = 0},
+    {.bitmap_index = 645, .adv_w = 381, .box_w = 22, .box_h = 22, .ofs_x = 1, .ofs_y = 0},
+    {.bitmap_index = 766, .adv_w = 318, .box_w = 18, .box_h = 22, .ofs_x = 1, .ofs_y = 0},
+    {.bitmap_index = 865, .adv_w = 317, .box_w = 19, .box_h = 22, .ofs_x = 1, .ofs_y = 0},
+    {.bitmap_index = 970, .adv_w = 273, .box_w = 16, .box_h = 22, .ofs_x = 1, .ofs_y = 0},
+    {.bitmap_index = 1058, .adv_w = 269, .box_w = 17, .box_h = 22, .ofs_x = 0, .ofs_y = 0},
+    {.bitmap_index = 1152, .adv_w = 353, .box_w = 20, .box_h = 22, .ofs_x = 1, .ofs_y = 0},
+    {.bitmap_index = 1262, .adv_w = 480, .box_w = 28, .box_h = 27, .ofs_x = 0, .ofs_y = -3},
+    {.bitmap_index = 1451, .adv_w = 480, .box_w = 26, .box_h = 27, .ofs_x = 3, .ofs_y = -3},
+    {.bitmap_index = 1627, .adv_w = 480, .box_w = 28, .box_h = 27, .ofs_x = 1, .ofs_y = -3},
+    {.bitmap_index = 1816, .adv_w = 480, .box_w = 28, .box_h = 28, .ofs_x = 1, .ofs_y = -4},
+    {.bitmap_index = 2012, .adv_w = 480, .box_w = 29, .box_h = 28, .ofs_x = 0, .ofs_y = -3}
 };
 
 /*---------------------
  *  CHARACTER MAPPING
  *--------------------*/
 
-static const uint16_t unicode_list_1[] = {
-    0x0, 0x2bc, 0xc7f, 0xd8d, 0x1232, 0x2d5c, 0x3e6b, 0x447a
+static const uint16_t unicode_list_0[] = {
+    0x0, 0x11, 0x12, 0x13, 0x14, 0x21, 0x23, 0x25,
+    0x29, 0x2f, 0x30, 0x32, 0x33, 0x34, 0x35, 0x540f,
+    0x5dd2, 0x5ee0, 0x6385, 0x8fbe
 };
 
+
 /*Collect the unicode lists and glyph_id offsets*/
 static const lv_font_fmt_txt_cmap_t cmaps[] =
 {
     {
-        .range_start = 32, .range_length = 95, .glyph_id_start = 1,
-        .unicode_list = NULL, .glyph_id_ofs_list = NULL, .list_length = 0, .type = LV_FONT_FMT_TXT_CMAP_FORMAT0_TINY
-    },
-    {
-        .range_start = 20851, .range_length = 17531, .glyph_id_start = 96,
-        .unicode_list = unicode_list_1, .glyph_id_ofs_list = NULL, .list_length = 8, .type = LV_FONT_FMT_TXT_CMAP_SPARSE_TINY
+        .range_start = 32, .range_length = 36799, .glyph_id_start = 1,
+        .unicode_list = unicode_list_0, .glyph_id_ofs_list = NULL, .list_length = 20, .type = LV_FONT_FMT_TXT_CMAP_SPARSE_TINY
     }
 };
 
@@ -1549,305 +404,19 @@ static const lv_font_fmt_txt_cmap_t cmaps[] =
 /*Pair left and right glyphs for kerning*/
 static const uint8_t kern_pair_glyph_ids[] =
 {
-    7, 43,
-    9, 75,
-    19, 21,
-    19, 23,
-    19, 26,
-    21, 26,
-    34, 43,
-    34, 53,
-    34, 55,
-    34, 56,
-    34, 58,
-    34, 66,
-    34, 68,
-    34, 70,
-    34, 72,
-    34, 80,
-    34, 82,
-    36, 43,
-    37, 43,
-    37, 53,
-    37, 55,
-    37, 56,
-    37, 57,
-    37, 58,
-    37, 59,
-    38, 43,
-    39, 15,
-    39, 34,
-    39, 66,
-    39, 68,
-    39, 70,
-    39, 72,
-    39, 80,
-    39, 82,
-    40, 43,
-    41, 43,
-    42, 43,
-    44, 43,
-    44, 48,
-    44, 66,
-    44, 68,
-    44, 70,
-    44, 72,
-    44, 80,
-    44, 82,
-    45, 34,
-    45, 43,
-    45, 48,
-    45, 53,
-    45, 55,
-    45, 56,
-    45, 58,
-    46, 43,
-    47, 43,
-    48, 43,
-    48, 53,
-    48, 55,
-    48, 56,
-    48, 57,
-    48, 58,
-    48, 59,
-    49, 15,
-    49, 34,
-    49, 57,
-    50, 43,
-    50, 53,
-    50, 55,
-    50, 56,
-    50, 57,
-    50, 58,
-    50, 59,
-    51, 43,
-    51, 58,
-    51, 66,
-    51, 68,
-    51, 70,
-    51, 72,
-    51, 80,
-    51, 82,
-    53, 15,
-    53, 34,
-    53, 40,
-    53, 48,
-    53, 50,
-    53, 66,
-    53, 68,
-    53, 70,
-    53, 72,
-    53, 75,
-    53, 78,
-    53, 79,
-    53, 80,
-    53, 81,
-    53, 82,
-    53, 83,
-    53, 84,
-    53, 86,
-    55, 15,
-    55, 34,
-    55, 40,
-    55, 48,
-    55, 50,
-    55, 66,
-    55, 68,
-    55, 70,
-    55, 72,
-    55, 75,
-    55, 78,
-    55, 79,
-    55, 80,
-    55, 81,
-    55, 82,
-    55, 83,
-    55, 84,
-    55, 86,
-    56, 15,
-    56, 34,
-    56, 40,
-    56, 48,
-    56, 50,
-    56, 66,
-    56, 68,
-    56, 70,
-    56, 72,
-    56, 75,
-    56, 78,
-    56, 79,
-    56, 80,
-    56, 81,
-    56, 82,
-    56, 83,
-    56, 84,
-    56, 86,
-    57, 15,
-    57, 40,
-    57, 43,
-    57, 48,
-    57, 50,
-    57, 66,
-    57, 68,
-    57, 70,
-    57, 72,
-    57, 80,
-    57, 82,
-    57, 84,
-    58, 15,
-    58, 34,
-    58, 40,
-    58, 48,
-    58, 50,
-    58, 66,
-    58, 68,
-    58, 69,
-    58, 70,
-    58, 72,
-    58, 75,
-    58, 78,
-    58, 79,
-    58, 80,
-    58, 81,
-    58, 82,
-    58, 83,
-    58, 84,
-    58, 85,
-    58, 86,
-    59, 40,
-    59, 43,
-    59, 48,
-    59, 50,
-    60, 43,
-    60, 75,
-    61, 43,
-    61, 75,
-    66, 43,
-    67, 53,
-    67, 55,
-    67, 56,
-    67, 57,
-    67, 58,
-    67, 87,
-    67, 88,
-    67, 89,
-    67, 90,
-    68, 43,
-    69, 43,
-    70, 53,
-    70, 55,
-    70, 56,
-    70, 57,
-    70, 58,
-    70, 87,
-    70, 88,
-    70, 89,
-    70, 90,
-    72, 43,
-    76, 43,
-    76, 66,
-    76, 68,
-    76, 70,
-    76, 72,
-    76, 80,
-    76, 82,
-    77, 43,
-    79, 43,
-    80, 43,
-    80, 53,
-    80, 55,
-    80, 56,
-    80, 57,
-    80, 58,
-    80, 87,
-    80, 88,
-    80, 89,
-    80, 90,
-    81, 53,
-    81, 55,
-    81, 56,
-    81, 57,
-    81, 58,
-    81, 87,
-    81, 88,
-    81, 89,
-    81, 90,
-    82, 43,
-    82, 75,
-    83, 66,
-    83, 68,
-    83, 70,
-    83, 72,
-    83, 80,
-    83, 82,
-    84, 53,
-    84, 55,
-    84, 56,
-    84, 57,
-    84, 58,
-    85, 43,
-    86, 43,
-    88, 66,
-    88, 68,
-    88, 70,
-    88, 72,
-    88, 80,
-    88, 82,
-    89, 43,
-    89, 66,
-    89, 68,
-    89, 70,
-    89, 72,
-    89, 80,
-    89, 82,
-    90, 66,
-    90, 68,
-    90, 70,
-    90, 72,
-    90, 80,
-    90, 82,
-    91, 43,
-    92, 43,
-    92, 75
+    3, 5,
+    6, 14,
+    10, 14,
+    11, 6,
+    14, 6,
+    14, 10
 };
 
 /* Kerning between the respective left and right glyphs
  * 4.4 format which needs to scaled with `kern_scale`*/
 static const int8_t kern_pair_values[] =
 {
-    24, 19, -10, -10, -10, -5, 10, -29,
-    -34, -24, -29, -10, -10, -10, -10, -10,
-    -10, 10, -10, -10, -5, -5, -14, -14,
-    -5, 10, -48, -19, -10, -10, -10, -10,
-    -10, -10, 10, 10, 10, 14, -19, -19,
-    -19, -19, -19, -19, -19, 5, 14, -10,
-    -48, -34, -24, -48, 10, 10, -10, -10,
-    -5, -5, -14, -14, -5, -53, -14, -10,
-    -10, -10, -5, -5, -14, -14, -5, 14,
-    -5, -5, -5, -5, -5, -5, -5, -58,
-    -29, -10, -10, -10, -29, -29, -29, -29,
-    -19, -19, -19, -29, -19, -29, -19, -24,
-    -19, -38, -34, -5, -5, -5, -19, -19,
-    -19, -14, -14, -10, -10, -19, -10, -19,
-    -10, -10, -10, -29, -24, -5, -5, -5,
-    -14, -14, -14, -14, -14, -10, -10, -14,
-    -10, -14, -10, -10, -10, -10, -14, 14,
-    -14, -14, -19, -19, -19, -19, -19, -19,
-    -14, -48, -29, -14, -14, -14, -43, -43,
-    -43, -43, -43, -19, -19, -19, -43, -19,
-    -43, -19, -34, -19, -19, -5, 14, -5,
-    -5, 24, 19, 24, 19, 10, -29, -14,
-    -14, -19, -43, -10, -5, -10, -10, 10,
-    10, -29, -14, -14, -19, -43, -10, -5,
-    -10, -10, 10, 10, -10, -10, -10, -10,
-    -10, -10, 14, 5, -10, -29, -19, -14,
-    -19, -43, -10, -5, -10, -10, -29, -14,
-    -14, -19, -43, -10, -5, -10, -10, 10,
-    19, -10, -10, -10, -10, -10, -10, -24,
-    -10, -10, -14, -34, 10, 5, -5, -5,
-    -5, -5, -5, -5, 10, -5, -5, -5,
-    -5, -5, -5, -5, -5, -5, -5, -5,
-    -5, 10, 24, 19
+    -10, -29, -10, -14, -29, -10
 };
 
 /*Collect the kern pair's data in one place*/
@@ -1855,7 +424,7 @@ static const lv_font_fmt_txt_kern_pair_t kern_pairs =
 {
     .glyph_ids = kern_pair_glyph_ids,
     .values = kern_pair_values,
-    .pair_cnt = 260,
+    .pair_cnt = 6,
     .glyph_ids_size = 0
 };
 
@@ -1878,7 +447,7 @@ static lv_font_fmt_txt_dsc_t font_dsc = {
     .cmaps = cmaps,
     .kern_dsc = &kern_pairs,
     .kern_scale = 16,
-    .cmap_num = 2,
+    .cmap_num = 1,
     .bpp = 2,
     .kern_classes = 0,
     .bitmap_format = 0,
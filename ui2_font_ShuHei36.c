@@ -2,6 +2,7 @@
  * Size: 36 px
  * Bpp: 2
  * Opts: --bpp 2 --size 36 --font C:/Users/north/Documents/nainiu_ui/assets/AlimamaShuHeiTi-Bold.otf -o C:/Users/north/Documents/nainiu_ui/assets\ui2_font_ShuHei36.c --format lvgl -r 0x20-0x7f --no-compress --no-prefilter
+ * Subset: 16/95 glyphs (font_subsetter.py)
  ******************************************************************************/
 
 #include "ui2.h"
@@ -20,172 +21,6 @@
 static LV_ATTRIBUTE_LARGE_CONST const uint8_t glyph_bitmap[] = {
     /* U+0020 " " */
 
-    /* U+0021 "!" */
-    0x3f, 0xf8, 0xff, 0xd3, 0xff, 0x4f, 0xfd, 0x3f,
-    0xf4, 0xff, 0xd3, 0xff, 0x4f, 0xfc, 0x3f, 0xf0,
-    0xff, 0xc3, 0xff, 0xf, 0xfc, 0x2f, 0xf0, 0xbf,
-    0xc2, 0xff, 0xb, 0xfc, 0x1f, 0xf0, 0x0, 0x0,
-    0x0, 0xf, 0xfe, 0x3f, 0xf8, 0xff, 0xe3, 0xff,
-    0x8f, 0xfe, 0x3f, 0xf8,
-
-    /* U+0022 "\"" */
-    0x6a, 0x91, 0xaa, 0x5f, 0xf8, 0xbf, 0xd3, 0xfd,
-    0x2f, 0xf0, 0xff, 0x47, 0xfc, 0x3f, 0xd1, 0xff,
-    0xf, 0xf0, 0x3f, 0xc3, 0xfc, 0xf, 0xf0, 0xff,
-    0x3, 0xfc, 0x2f, 0xc0, 0xfe, 0xb, 0xf0, 0x3f,
-    0x81, 0xfc, 0xf, 0xd0,
-
-    /* U+0023 "#" */
-    0x0, 0xf, 0xf4, 0x3, 0xfe, 0x0, 0x0, 0xff,
-    0x0, 0x3f, 0xd0, 0x0, 0x1f, 0xf0, 0x3, 0xfc,
-    0x0, 0x2, 0xfe, 0x0, 0x7f, 0xc0, 0x0, 0x3f,
-    0xd0, 0xb, 0xf8, 0x7, 0xff, 0xff, 0xff, 0xff,
-    0xfc, 0x7f, 0xff, 0xff, 0xff, 0xff, 0xc7, 0xff,
-    0xff, 0xff, 0xff, 0xfc, 0x7f, 0xff, 0xff, 0xff,
-    0xff, 0xc0, 0xb, 0xf8, 0x1, 0xff, 0x0, 0x0,
-    0xff, 0x80, 0x1f, 0xf0, 0x0, 0xf, 0xf4, 0x2,
-    0xfe, 0x0, 0x0, 0xff, 0x40, 0x2f, 0xe0, 0x0,
-    0xf, 0xf0, 0x3, 0xfd, 0x0, 0x1, 0xff, 0x0,
-    0x3f, 0xd0, 0x7, 0xff, 0xff, 0xff, 0xff, 0xfc,
-    0x7f, 0xff, 0xff, 0xff, 0xff, 0xc7, 0xff, 0xff,
-    0xff, 0xff, 0xfc, 0x6b, 0xff, 0xaa, 0xff, 0xea,
-    0x80, 0x3f, 0xc0, 0xf, 0xf4, 0x0, 0x7, 0xfc,
-    0x0, 0xff, 0x40, 0x0, 0x7f, 0xc0, 0xf, 0xf0,
-    0x0, 0xb, 0xf8, 0x1, 0xff, 0x0, 0x0, 0xff,
-    0x40, 0x1f, 0xf0, 0x0, 0xf, 0xf4, 0x2, 0xfe,
-    0x0, 0x0,
-
-    /* U+0024 "$" */
-    0x0, 0x0, 0xbc, 0x0, 0x0, 0x0, 0x2, 0xf0,
-    0x0, 0x0, 0x0, 0xb, 0xc0, 0x0, 0x0, 0x0,
-    0x2f, 0x0, 0x0, 0x0, 0x6f, 0xff, 0xfa, 0x40,
-    0xf, 0xff, 0xff, 0xff, 0x0, 0xff, 0xff, 0xff,
-    0xfc, 0x7, 0xff, 0xff, 0xff, 0xf0, 0x3f, 0xfd,
-    0xfd, 0x6b, 0xc0, 0xff, 0xc2, 0xf0, 0x0, 0x3,
-    0xfe, 0xb, 0xc0, 0x0, 0xf, 0xfc, 0x2f, 0x0,
-    0x0, 0x3f, 0xf0, 0xbc, 0x0, 0x0, 0xff, 0xfb,
-    0xf0, 0x0, 0x1, 0xff, 0xff, 0xe4, 0x0, 0x2,
-    0xff, 0xff, 0xfe, 0x0, 0x2, 0xff, 0xff, 0xff,
-    0x40, 0x0, 0x7f, 0xff, 0xff, 0x40, 0x0, 0xf,
-    0xff, 0xff, 0x0, 0x0, 0x2f, 0x2f, 0xfc, 0x0,
-    0x0, 0xbc, 0x2f, 0xf4, 0x0, 0x2, 0xf0, 0x7f,
-    0xd0, 0x0, 0xb, 0xc1, 0xff, 0x40, 0x0, 0x2f,
-    0xf, 0xfc, 0x3f, 0xaa, 0xfe, 0xff, 0xf0, 0xff,
-    0xff, 0xff, 0xff, 0x83, 0xff, 0xff, 0xff, 0xfc,
-    0xf, 0xff, 0xff, 0xff, 0xc0, 0x1a, 0xff, 0xff,
-    0xe4, 0x0, 0x0, 0x2, 0xf0, 0x0, 0x0, 0x0,
-    0xb, 0xc0, 0x0, 0x0, 0x0, 0x2f, 0x0, 0x0,
-    0x0, 0x0, 0xbc, 0x0, 0x0, 0x0, 0x2, 0xf0,
-    0x0, 0x0,
-
-    /* U+0025 "%" */
-    0x2, 0xfe, 0x0, 0x0, 0x1f, 0xf0, 0x1, 0xff,
-    0xfd, 0x0, 0x3, 0xfc, 0x0, 0x3f, 0xff, 0xf0,
-    0x0, 0x7f, 0x80, 0x7, 0xf9, 0xbf, 0x40, 0xf,
-    0xf0, 0x0, 0xbf, 0x2, 0xf8, 0x2, 0xfe, 0x0,
-    0xb, 0xe0, 0x2f, 0xc0, 0x3f, 0xc0, 0x0, 0xfe,
-    0x2, 0xfc, 0xb, 0xf4, 0x0, 0xb, 0xe0, 0x2f,
-    0xc1, 0xff, 0x0, 0x0, 0xbf, 0x2, 0xf8, 0x3f,
-    0xd0, 0x0, 0x7, 0xf9, 0xbf, 0x47, 0xf8, 0x0,
-    0x0, 0x3f, 0xff, 0xf0, 0xff, 0x0, 0x0, 0x1,
-    0xff, 0xfd, 0x2f, 0xe0, 0xbf, 0x80, 0x2, 0xfe,
-    0x3, 0xfc, 0x7f, 0xff, 0x40, 0x0, 0x0, 0xbf,
-    0x4f, 0xff, 0xfc, 0x0, 0x0, 0xf, 0xf1, 0xfe,
-    0x6f, 0xd0, 0x0, 0x3, 0xfd, 0x2f, 0xc0, 0xfe,
-    0x0, 0x0, 0x7f, 0xc3, 0xf8, 0xb, 0xe0, 0x0,
-    0xf, 0xf0, 0x3f, 0x40, 0xbe, 0x0, 0x1, 0xfe,
-    0x3, 0xf4, 0xb, 0xe0, 0x0, 0x3f, 0xc0, 0x3f,
-    0x80, 0xbe, 0x0, 0xb, 0xf8, 0x2, 0xf8, 0xf,
-    0xe0, 0x0, 0xff, 0x0, 0x1f, 0xe6, 0xfd, 0x0,
-    0x2f, 0xd0, 0x0, 0xff, 0xff, 0xc0, 0x7, 0xfc,
-    0x0, 0x7, 0xff, 0xf4, 0x0, 0xff, 0x40, 0x0,
-    0xb, 0xf8, 0x0,
-
-    /* U+0026 "&" */
-    0x0, 0x0, 0xaf, 0xe4, 0x0, 0x0, 0x0, 0xb,
-    0xff, 0xff, 0x0, 0x0, 0x0, 0x2f, 0xff, 0xff,
-    0xc0, 0x0, 0x0, 0x7f, 0xff, 0xff, 0xd0, 0x0,
-    0x0, 0xbf, 0xe0, 0x7f, 0xe0, 0x0, 0x0, 0xff,
-    0xd0, 0x3f, 0xe0, 0x0, 0x0, 0xbf, 0xd0, 0x3f,
-    0xe0, 0x0, 0x0, 0xbf, 0xe0, 0xbf, 0xd0, 0x0,
-    0x0, 0x7f, 0xf7, 0xff, 0xc0, 0x0, 0x0, 0x3f,
-    0xff, 0xff, 0x0, 0x0, 0x0, 0xf, 0xff, 0xf8,
-    0x0, 0x0, 0x0, 0x2f, 0xff, 0xd0, 0xf, 0xf4,
-    0x1, 0xff, 0xff, 0xe0, 0x1f, 0xf4, 0x7, 0xff,
-    0xff, 0xf4, 0x2f, 0xf0, 0xf, 0xff, 0x3f, 0xfc,
-    0x3f, 0xf0, 0x2f, 0xfc, 0xf, 0xff, 0x7f, 0xe0,
-    0x3f, 0xf4, 0x3, 0xff, 0xff, 0xd0, 0x3f, 0xf0,
-    0x1, 0xff, 0xff, 0xc0, 0x3f, 0xf4, 0x0, 0x7f,
-    0xff, 0x80, 0x3f, 0xfc, 0x0, 0x3f, 0xff, 0x0,
-    0x2f, 0xff, 0x56, 0xff, 0xff, 0x0, 0x1f, 0xff,
-    0xff, 0xff, 0xff, 0x80, 0xb, 0xff, 0xff, 0xff,
-    0xff, 0xd0, 0x1, 0xff, 0xff, 0xfe, 0x7f, 0xf0,
-    0x0, 0x1b, 0xfe, 0x90, 0x2f, 0xfc,
-
-    /* U+0027 "'" */
-    0x6a, 0x97, 0xfe, 0x3f, 0xd3, 0xfd, 0x3f, 0xd3,
-    0xfc, 0x3f, 0xc3, 0xfc, 0x2f, 0xc2, 0xfc, 0x1f,
-    0xc0,
-
-    /* U+0028 "(" */
-    0x0, 0xa, 0xa8, 0x0, 0x2f, 0xf8, 0x0, 0x3f,
-    0xf0, 0x0, 0xbf, 0xe0, 0x0, 0xff, 0xc0, 0x2,
-    0xff, 0x80, 0x3, 0xff, 0x40, 0x7, 0xff, 0x0,
-    0xf, 0xfe, 0x0, 0xf, 0xfd, 0x0, 0x1f, 0xfc,
-    0x0, 0x2f, 0xfc, 0x0, 0x3f, 0xf8, 0x0, 0x3f,
-    0xf4, 0x0, 0x3f, 0xf4, 0x0, 0x3f, 0xf4, 0x0,
-    0x7f, 0xf0, 0x0, 0x7f, 0xf0, 0x0, 0x7f, 0xf0,
-    0x0, 0x7f, 0xf4, 0x0, 0x3f, 0xf4, 0x0, 0x3f,
-    0xf4, 0x0, 0x3f, 0xf8, 0x0, 0x3f, 0xfc, 0x0,
-    0x2f, 0xfc, 0x0, 0x1f, 0xfd, 0x0, 0xf, 0xfe,
-    0x0, 0xb, 0xff, 0x0, 0x3, 0xff, 0x40, 0x3,
-    0xff, 0x80, 0x1, 0xff, 0xc0, 0x0, 0xff, 0xe0,
-    0x0, 0x7f, 0xf0, 0x0, 0x3f, 0xf4, 0x0, 0x1f,
-    0xfc,
-
-    /* U+0029 ")" */
-    0x6a, 0x90, 0x0, 0xff, 0xc0, 0x2, 0xff, 0x80,
-    0x3, 0xff, 0x0, 0xb, 0xfe, 0x0, 0x1f, 0xfc,
-    0x0, 0x3f, 0xf4, 0x0, 0xbf, 0xf0, 0x0, 0xff,
-    0xc0, 0x3, 0xff, 0x80, 0xb, 0xff, 0x0, 0x1f,
-    0xfc, 0x0, 0x3f, 0xf4, 0x0, 0xff, 0xd0, 0x3,
-    0xff, 0x80, 0xf, 0xfe, 0x0, 0x3f, 0xf8, 0x0,
-    0xbf, 0xf0, 0x3, 0xff, 0xc0, 0xf, 0xfe, 0x0,
-    0x3f, 0xf8, 0x0, 0xff, 0xe0, 0x3, 0xff, 0x40,
-    0x1f, 0xfc, 0x0, 0xbf, 0xf0, 0x3, 0xff, 0x80,
-    0xf, 0xfd, 0x0, 0x7f, 0xf0, 0x3, 0xff, 0x80,
-    0xf, 0xfd, 0x0, 0xbf, 0xf0, 0x3, 0xff, 0x40,
-    0x2f, 0xfc, 0x0, 0xff, 0xd0, 0xb, 0xfe, 0x0,
-    0x0,
-
-    /* U+002A "*" */
-    0x0, 0x3f, 0xd0, 0x0, 0x0, 0xbf, 0x40, 0x0,
-    0x2, 0xfc, 0x0, 0xf, 0x47, 0xf0, 0x74, 0x3f,
-    0xef, 0xef, 0xf1, 0xff, 0xff, 0xff, 0xcf, 0xff,
-    0xff, 0xff, 0x41, 0x6f, 0xfe, 0x50, 0x0, 0xff,
-    0xf8, 0x0, 0xf, 0xff, 0xf4, 0x0, 0xff, 0xcf,
-    0xf4, 0x3, 0xfd, 0x2f, 0xe0, 0x2, 0xf0, 0x3d,
-    0x0, 0x1, 0x0, 0x40, 0x0,
-
-    /* U+002B "+" */
-    0x0, 0x2, 0xfe, 0x0, 0x0, 0x0, 0xf, 0xf8,
-    0x0, 0x0, 0x0, 0x3f, 0xe0, 0x0, 0x0, 0x0,
-    0xff, 0x80, 0x0, 0x0, 0x3, 0xfe, 0x0, 0x0,
-    0x0, 0xf, 0xf8, 0x0, 0x0, 0x0, 0x3f, 0xe0,
-    0x0, 0x2a, 0xaa, 0xff, 0xea, 0xa9, 0xff, 0xff,
-    0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
-    0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
-    0xff, 0x0, 0x3, 0xfe, 0x0, 0x0, 0x0, 0xf,
-    0xf8, 0x0, 0x0, 0x0, 0x3f, 0xe0, 0x0, 0x0,
-    0x0, 0xff, 0x80, 0x0, 0x0, 0x3, 0xfe, 0x0,
-    0x0, 0x0, 0xf, 0xf8, 0x0, 0x0, 0x0, 0x3f,
-    0xe0, 0x0, 0x0,
-
-    /* U+002C "," */
-    0x2, 0xaa, 0x0, 0xff, 0xc0, 0x7f, 0xe0, 0x3f,
-    0xf0, 0xf, 0xfc, 0x7, 0xfd, 0x2, 0xff, 0x0,
-    0xff, 0x80, 0x3f, 0xc0, 0x2f, 0xf0, 0xf, 0xf4,
-    0x0,
 
     /* U+002D "-" */
     0x0, 0x0, 0x0, 0xbf, 0xff, 0xfd, 0xbf, 0xff,
@@ -195,21 +30,6 @@ static LV_ATTRIBUTE_LARGE_CONST const uint8_t glyph_bitmap[] = {
     0x3f, 0xfc, 0xff, 0xf3, 0xff, 0xcf, 0xff, 0x3f,
     0xfc, 0xff, 0xf0,
 
-    /* U+002F "/" */
-    0x0, 0x0, 0x15, 0x50, 0x0, 0x3, 0xfd, 0x0,
-    0x0, 0x3f, 0xc0, 0x0, 0xb, 0xfc, 0x0, 0x0,
-    0xff, 0x40, 0x0, 0xf, 0xf0, 0x0, 0x2, 0xff,
-    0x0, 0x0, 0x3f, 0xd0, 0x0, 0x3, 0xfc, 0x0,
-    0x0, 0xbf, 0x80, 0x0, 0xf, 0xf4, 0x0, 0x0,
-    0xff, 0x0, 0x0, 0x2f, 0xe0, 0x0, 0x3, 0xfd,
-    0x0, 0x0, 0x3f, 0xc0, 0x0, 0xb, 0xf8, 0x0,
-    0x0, 0xff, 0x40, 0x0, 0xf, 0xf0, 0x0, 0x2,
-    0xfe, 0x0, 0x0, 0x3f, 0xd0, 0x0, 0x7, 0xfc,
-    0x0, 0x0, 0xbf, 0x80, 0x0, 0xf, 0xf4, 0x0,
-    0x1, 0xff, 0x0, 0x0, 0x2f, 0xe0, 0x0, 0x3,
-    0xfd, 0x0, 0x0, 0x7f, 0xc0, 0x0, 0xb, 0xf8,
-    0x0, 0x0,
-
     /* U+0030 "0" */
     0x0, 0x7, 0xff, 0x80, 0x0, 0x1, 0xff, 0xff,
     0xe0, 0x0, 0x2f, 0xff, 0xff, 0xf0, 0x1, 0xff,
@@ -374,110 +194,6 @@ static LV_ATTRIBUTE_LARGE_CONST const uint8_t glyph_bitmap[] = {
     0x0, 0xbf, 0xff, 0xff, 0x80, 0x2, 0xff, 0xff,
     0xf4, 0x0, 0x2, 0xbf, 0xe9, 0x0, 0x0,
 
-    /* U+003A ":" */
-    0xbf, 0xf2, 0xff, 0xcb, 0xff, 0x2f, 0xfc, 0xbf,
-    0xf2, 0xff, 0xc0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0xb, 0xff, 0x2f, 0xfc, 0xbf, 0xf2, 0xff, 0xcb,
-    0xff, 0x2f, 0xfc,
-
-    /* U+003B ";" */
-    0x2, 0xff, 0xd0, 0x2f, 0xfd, 0x2, 0xff, 0xd0,
-    0x2f, 0xfd, 0x2, 0xff, 0xd0, 0x2f, 0xfc, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0xa, 0xa8, 0x1, 0xff, 0x80, 0x2f, 0xf4,
-    0x3, 0xff, 0x0, 0x7f, 0xe0, 0xb, 0xfc, 0x0,
-    0xff, 0xc0, 0xf, 0xf4, 0x1, 0xff, 0x0, 0x3f,
-    0xe0, 0x3, 0xfc, 0x0,
-
-    /* U+003C "<" */
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x1, 0xf0, 0x0, 0x0, 0x0, 0xbf, 0xc0, 0x0,
-    0x0, 0x7f, 0xff, 0x0, 0x0, 0x2f, 0xff, 0xfc,
-    0x0, 0x1f, 0xff, 0xff, 0xd0, 0xb, 0xff, 0xff,
-    0xe0, 0x6, 0xff, 0xff, 0xe4, 0x0, 0xff, 0xff,
-    0xf8, 0x0, 0x3, 0xff, 0xf9, 0x0, 0x0, 0xf,
-    0xfd, 0x0, 0x0, 0x0, 0x3f, 0xe4, 0x0, 0x0,
-    0x0, 0xff, 0xfe, 0x0, 0x0, 0x3, 0xff, 0xff,
-    0xd0, 0x0, 0x1, 0xff, 0xff, 0xf8, 0x0, 0x0,
-    0x6f, 0xff, 0xff, 0x40, 0x0, 0x7, 0xff, 0xff,
-    0xe0, 0x0, 0x1, 0xbf, 0xff, 0xf0, 0x0, 0x0,
-    0x2f, 0xff, 0xc0, 0x0, 0x0, 0x7, 0xff, 0x0,
-    0x0, 0x0, 0x0, 0xbc, 0x0, 0x0, 0x0, 0x0,
-    0x10,
-
-    /* U+003D "=" */
-    0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
-    0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
-    0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xf8,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x3, 0xff, 0xff, 0xff, 0xff, 0xef,
-    0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
-    0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
-    0xff, 0xff, 0xf0,
-
-    /* U+003E ">" */
-    0x0, 0x0, 0x0, 0x0, 0x3, 0xd0, 0x0, 0x0,
-    0x0, 0xf, 0xf8, 0x0, 0x0, 0x0, 0x3f, 0xfe,
-    0x40, 0x0, 0x0, 0xff, 0xff, 0xe0, 0x0, 0x1,
-    0xff, 0xff, 0xf9, 0x0, 0x0, 0x2f, 0xff, 0xff,
-    0x40, 0x0, 0x7, 0xff, 0xff, 0xe0, 0x0, 0x0,
-    0xbf, 0xff, 0xf8, 0x0, 0x0, 0x1f, 0xff, 0xf0,
-    0x0, 0x0, 0x2, 0xff, 0xc0, 0x0, 0x0, 0x7,
-    0xff, 0x0, 0x0, 0x2, 0xff, 0xfc, 0x0, 0x1,
-    0xff, 0xff, 0xf0, 0x1, 0xbf, 0xff, 0xfd, 0x0,
-    0xbf, 0xff, 0xfe, 0x0, 0x6f, 0xff, 0xff, 0x40,
-    0x3, 0xff, 0xff, 0x80, 0x0, 0xf, 0xff, 0xd0,
-    0x0, 0x0, 0x3f, 0xe4, 0x0, 0x0, 0x0, 0xf8,
-    0x0, 0x0, 0x0, 0x1, 0x0, 0x0, 0x0, 0x0,
-    0x0,
-
-    /* U+003F "?" */
-    0x6f, 0xff, 0xe4, 0x2, 0xff, 0xff, 0xfd, 0xb,
-    0xff, 0xff, 0xfd, 0x2f, 0xff, 0xff, 0xf8, 0xba,
-    0xab, 0xff, 0xf0, 0x0, 0x3, 0xff, 0xc0, 0x0,
-    0xb, 0xff, 0x0, 0x0, 0x2f, 0xfc, 0x0, 0x0,
-    0xbf, 0xf0, 0x0, 0x7, 0xff, 0x80, 0x0, 0x7f,
-    0xfc, 0x0, 0x7, 0xff, 0xc0, 0x0, 0x7f, 0xfc,
-    0x0, 0x3, 0xff, 0x80, 0x0, 0xf, 0xfc, 0x0,
-    0x0, 0x3f, 0xd0, 0x0, 0x0, 0xff, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0xbf, 0xf0, 0x0, 0x3, 0xff, 0xc0, 0x0, 0xf,
-    0xff, 0x0, 0x0, 0x3f, 0xfc, 0x0, 0x0, 0xff,
-    0xf0, 0x0, 0x3, 0xff, 0xc0, 0x0,
-
-    /* U+0040 "@" */
-    0x0, 0x0, 0x1, 0xbf, 0xfa, 0x40, 0x0, 0x0,
-    0x0, 0x1f, 0xff, 0xff, 0xfe, 0x0, 0x0, 0x0,
-    0x3f, 0xff, 0xff, 0xff, 0xf4, 0x0, 0x0, 0x7f,
-    0xff, 0xff, 0xff, 0xff, 0x80, 0x0, 0x7f, 0xff,
-    0x90, 0x6, 0xff, 0xf4, 0x0, 0x7f, 0xfd, 0x0,
-    0x0, 0x7, 0xff, 0x0, 0x3f, 0xf8, 0x0, 0x0,
-    0x0, 0x3f, 0xe0, 0x2f, 0xf8, 0x1, 0xbe, 0x1a,
-    0x87, 0xfc, 0xf, 0xfc, 0x3, 0xff, 0xef, 0xf0,
-    0xff, 0x4b, 0xfc, 0x3, 0xff, 0xff, 0xf8, 0x2f,
-    0xd3, 0xff, 0x3, 0xff, 0xff, 0xfd, 0x7, 0xf8,
-    0xff, 0x41, 0xff, 0x82, 0xff, 0x41, 0xfe, 0x7f,
-    0xc0, 0xff, 0xc0, 0x7f, 0xc0, 0x7f, 0xaf, 0xf0,
-    0x3f, 0xd0, 0xf, 0xf0, 0x1f, 0xeb, 0xfc, 0x1f,
-    0xf0, 0x7, 0xf8, 0x7, 0xf6, 0xfe, 0x7, 0xfc,
-    0x2, 0xfe, 0x2, 0xfc, 0xbf, 0x81, 0xff, 0x0,
-    0xff, 0x40, 0xff, 0x2f, 0xf0, 0x7f, 0xd0, 0xff,
-    0xe0, 0x7f, 0x8b, 0xfc, 0xf, 0xff, 0xff, 0xfe,
-    0xbf, 0xc1, 0xff, 0x2, 0xff, 0xff, 0xff, 0xff,
-    0xd0, 0x3f, 0xe0, 0x3f, 0xff, 0x8b, 0xff, 0xd0,
-    0xb, 0xfc, 0x2, 0xfe, 0x40, 0x7f, 0x80, 0x0,
-    0xff, 0xc0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x2f,
-    0xfd, 0x0, 0x0, 0x0, 0x0, 0x0, 0x3, 0xff,
-    0xf9, 0x0, 0x0, 0x0, 0x0, 0x0, 0x3f, 0xff,
-    0xff, 0x40, 0x0, 0x0, 0x0, 0x2, 0xff, 0xff,
-    0xc0, 0x0, 0x0, 0x0, 0x0, 0xb, 0xff, 0xf0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x1b, 0xfc, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0,
-
     /* U+0041 "A" */
     0x0, 0x0, 0xff, 0xff, 0xf0, 0x0, 0x0, 0x0,
     0x1f, 0xff, 0xff, 0x40, 0x0, 0x0, 0x2, 0xff,
@@ -501,383 +217,6 @@ static LV_ATTRIBUTE_LARGE_CONST const uint8_t glyph_bitmap[] = {
     0x0, 0x0, 0x7f, 0xfc, 0x3f, 0xfc, 0x0, 0x0,
     0x3, 0xff, 0xc0,
 
-    /* U+0042 "B" */
-    0xff, 0xff, 0xff, 0xf9, 0x0, 0x3f, 0xff, 0xff,
-    0xff, 0xe0, 0xf, 0xff, 0xff, 0xff, 0xff, 0x3,
-    0xff, 0xfa, 0xff, 0xff, 0xe0, 0xff, 0xf0, 0x0,
-    0xff, 0xfc, 0x3f, 0xfc, 0x0, 0xf, 0xff, 0xf,
-    0xff, 0x0, 0x3, 0xff, 0xc3, 0xff, 0xc0, 0x0,
-    0xff, 0xf0, 0xff, 0xf0, 0x0, 0x3f, 0xf8, 0x3f,
-    0xfc, 0x0, 0x7f, 0xfc, 0xf, 0xff, 0xff, 0xff,
-    0xf8, 0x3, 0xff, 0xff, 0xff, 0xfe, 0x0, 0xff,
-    0xff, 0xff, 0xff, 0xf0, 0x3f, 0xfe, 0x5a, 0xbf,
-    0xff, 0xf, 0xff, 0x0, 0x1, 0xff, 0xf3, 0xff,
-    0xc0, 0x0, 0x2f, 0xfd, 0xff, 0xf0, 0x0, 0x7,
-    0xff, 0xbf, 0xfc, 0x0, 0x1, 0xff, 0xff, 0xff,
-    0x0, 0x0, 0xbf, 0xfb, 0xff, 0xc0, 0x0, 0x3f,
-    0xfe, 0xff, 0xf5, 0x55, 0xbf, 0xff, 0x7f, 0xff,
-    0xff, 0xff, 0xff, 0xcf, 0xff, 0xff, 0xff, 0xff,
-    0xc3, 0xff, 0xff, 0xff, 0xff, 0x80, 0xff, 0xff,
-    0xff, 0xfe, 0x0, 0x0,
-
-    /* U+0043 "C" */
-    0x0, 0x0, 0x1a, 0xff, 0xe9, 0x0, 0x0, 0x2f,
-    0xff, 0xff, 0xfe, 0x0, 0x1f, 0xff, 0xff, 0xff,
-    0xf0, 0xb, 0xff, 0xff, 0xff, 0xff, 0x2, 0xff,
-    0xff, 0xea, 0xbf, 0xf0, 0x7f, 0xff, 0x80, 0x0,
-    0x6, 0xf, 0xff, 0xc0, 0x0, 0x0, 0x1, 0xff,
-    0xf4, 0x0, 0x0, 0x0, 0x3f, 0xfe, 0x0, 0x0,
-    0x0, 0x3, 0xff, 0xc0, 0x0, 0x0, 0x0, 0x7f,
-    0xfc, 0x0, 0x0, 0x0, 0x7, 0xff, 0xc0, 0x0,
-    0x0, 0x0, 0xbf, 0xf8, 0x0, 0x0, 0x0, 0x7,
-    0xff, 0xc0, 0x0, 0x0, 0x0, 0x7f, 0xfc, 0x0,
-    0x0, 0x0, 0x7, 0xff, 0xc0, 0x0, 0x0, 0x0,
-    0x3f, 0xfe, 0x0, 0x0, 0x0, 0x2, 0xff, 0xf4,
-    0x0, 0x0, 0x0, 0xf, 0xff, 0xe0, 0x0, 0x0,
-    0x0, 0xbf, 0xff, 0xd0, 0x0, 0x1b, 0x3, 0xff,
-    0xff, 0xfa, 0xff, 0xf0, 0xf, 0xff, 0xff, 0xff,
-    0xff, 0x0, 0x2f, 0xff, 0xff, 0xff, 0xf0, 0x0,
-    0x2f, 0xff, 0xff, 0xfe, 0x0, 0x0, 0x1b, 0xff,
-    0xf9, 0x0,
-
-    /* U+0044 "D" */
-    0xff, 0xff, 0xff, 0xe4, 0x0, 0xf, 0xff, 0xff,
-    0xff, 0xf4, 0x0, 0xff, 0xff, 0xff, 0xff, 0xe0,
-    0xf, 0xff, 0xff, 0xff, 0xff, 0xc0, 0xff, 0xf9,
-    0x5b, 0xff, 0xfe, 0xf, 0xff, 0x0, 0x7, 0xff,
-    0xf4, 0xff, 0xf0, 0x0, 0x1f, 0xff, 0x8f, 0xff,
-    0x0, 0x0, 0xbf, 0xfc, 0xff, 0xf0, 0x0, 0x3,
-    0xff, 0xdf, 0xff, 0x0, 0x0, 0x2f, 0xfe, 0xff,
-    0xf0, 0x0, 0x2, 0xff, 0xef, 0xff, 0x0, 0x0,
-    0x1f, 0xff, 0xff, 0xf0, 0x0, 0x1, 0xff, 0xff,
-    0xff, 0x0, 0x0, 0x1f, 0xff, 0xff, 0xf0, 0x0,
-    0x1, 0xff, 0xef, 0xff, 0x0, 0x0, 0x2f, 0xfe,
-    0xff, 0xf0, 0x0, 0x3, 0xff, 0xdf, 0xff, 0x0,
-    0x0, 0xbf, 0xfc, 0xff, 0xf0, 0x0, 0xf, 0xff,
-    0xcf, 0xff, 0x0, 0x7, 0xff, 0xf4, 0xff, 0xf9,
-    0x5b, 0xff, 0xff, 0xf, 0xff, 0xff, 0xff, 0xff,
-    0xc0, 0xff, 0xff, 0xff, 0xff, 0xf0, 0xf, 0xff,
-    0xff, 0xff, 0xf4, 0x0, 0xff, 0xff, 0xff, 0xe4,
-    0x0, 0x0,
-
-    /* U+0045 "E" */
-    0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
-    0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
-    0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
-    0x0, 0x0, 0x0, 0xff, 0xf0, 0x0, 0x0, 0xf,
-    0xff, 0x0, 0x0, 0x0, 0xff, 0xf0, 0x0, 0x0,
-    0xf, 0xff, 0x0, 0x0, 0x0, 0xff, 0xff, 0xff,
-    0xff, 0x4f, 0xff, 0xff, 0xff, 0xf4, 0xff, 0xff,
-    0xff, 0xff, 0x4f, 0xff, 0xff, 0xff, 0xf4, 0xff,
-    0xfa, 0xaa, 0xaa, 0xf, 0xff, 0x0, 0x0, 0x0,
-    0xff, 0xf0, 0x0, 0x0, 0xf, 0xff, 0x0, 0x0,
-    0x0, 0xff, 0xf0, 0x0, 0x0, 0xf, 0xff, 0x0,
-    0x0, 0x0, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
-    0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
-    0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
-    0xf0,
-
-    /* U+0046 "F" */
-    0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
-    0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
-    0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xfc, 0x0,
-    0x0, 0xf, 0xff, 0x0, 0x0, 0x3, 0xff, 0xc0,
-    0x0, 0x0, 0xff, 0xf0, 0x0, 0x0, 0x3f, 0xfc,
-    0x0, 0x0, 0xf, 0xff, 0xff, 0xff, 0xd3, 0xff,
-    0xff, 0xff, 0xf4, 0xff, 0xff, 0xff, 0xfd, 0x3f,
-    0xff, 0xff, 0xff, 0x4f, 0xff, 0xaa, 0xaa, 0x83,
-    0xff, 0xc0, 0x0, 0x0, 0xff, 0xf0, 0x0, 0x0,
-    0x3f, 0xfc, 0x0, 0x0, 0xf, 0xff, 0x0, 0x0,
-    0x3, 0xff, 0xc0, 0x0, 0x0, 0xff, 0xf0, 0x0,
-    0x0, 0x3f, 0xfc, 0x0, 0x0, 0xf, 0xff, 0x0,
-    0x0, 0x3, 0xff, 0xc0, 0x0, 0x0, 0xff, 0xf0,
-    0x0, 0x0, 0x0,
-
-    /* U+0047 "G" */
-    0x0, 0x0, 0xa, 0xff, 0xe9, 0x0, 0x0, 0x7,
-    0xff, 0xff, 0xff, 0x80, 0x0, 0xff, 0xff, 0xff,
-    0xff, 0x0, 0x1f, 0xff, 0xff, 0xff, 0xfc, 0x1,
-    0xff, 0xff, 0xea, 0xaf, 0xf0, 0xf, 0xff, 0xd0,
-    0x0, 0x0, 0x40, 0xff, 0xfc, 0x0, 0x0, 0x0,
-    0x7, 0xff, 0xc0, 0x0, 0x0, 0x0, 0x2f, 0xfd,
-    0x0, 0x0, 0x0, 0x0, 0xff, 0xf0, 0x0, 0x0,
-    0x0, 0x7, 0xff, 0x80, 0x0, 0x7f, 0xff, 0x9f,
-    0xfd, 0x0, 0x1, 0xff, 0xfe, 0xbf, 0xf4, 0x0,
-    0x7, 0xff, 0xfa, 0xff, 0xd0, 0x0, 0x1f, 0xff,
-    0xe7, 0xff, 0x80, 0x0, 0x2a, 0xff, 0x9f, 0xff,
-    0x0, 0x0, 0x7, 0xfe, 0x3f, 0xfd, 0x0, 0x0,
-    0x1f, 0xf8, 0xbf, 0xfc, 0x0, 0x0, 0x7f, 0xe0,
-    0xff, 0xfc, 0x0, 0x1, 0xff, 0x82, 0xff, 0xfe,
-    0x40, 0x7, 0xfe, 0x3, 0xff, 0xff, 0xff, 0xff,
-    0xf8, 0x3, 0xff, 0xff, 0xff, 0xff, 0xe0, 0x1,
-    0xff, 0xff, 0xff, 0xff, 0x80, 0x0, 0xbf, 0xff,
-    0xff, 0xfd, 0x0, 0x0, 0x1b, 0xff, 0xf9, 0x0,
-
-    /* U+0048 "H" */
-    0xff, 0xf0, 0x0, 0x0, 0xff, 0xef, 0xff, 0x0,
-    0x0, 0xf, 0xfe, 0xff, 0xf0, 0x0, 0x0, 0xff,
-    0xef, 0xff, 0x0, 0x0, 0xf, 0xfe, 0xff, 0xf0,
-    0x0, 0x0, 0xff, 0xef, 0xff, 0x0, 0x0, 0xf,
-    0xfe, 0xff, 0xf0, 0x0, 0x0, 0xff, 0xef, 0xff,
-    0x0, 0x0, 0xf, 0xfe, 0xff, 0xf0, 0x0, 0x0,
-    0xff, 0xef, 0xff, 0xff, 0xff, 0xff, 0xfe, 0xff,
-    0xff, 0xff, 0xff, 0xff, 0xef, 0xff, 0xff, 0xff,
-    0xff, 0xfe, 0xff, 0xff, 0xff, 0xff, 0xff, 0xef,
-    0xff, 0xff, 0xff, 0xff, 0xfe, 0xff, 0xf0, 0x0,
-    0x0, 0xff, 0xef, 0xff, 0x0, 0x0, 0xf, 0xfe,
-    0xff, 0xf0, 0x0, 0x0, 0xff, 0xef, 0xff, 0x0,
-    0x0, 0xf, 0xfe, 0xff, 0xf0, 0x0, 0x0, 0xff,
-    0xef, 0xff, 0x0, 0x0, 0xf, 0xfe, 0xff, 0xf0,
-    0x0, 0x0, 0xff, 0xef, 0xff, 0x0, 0x0, 0xf,
-    0xfe, 0xff, 0xf0, 0x0, 0x0, 0xff, 0xef, 0xff,
-    0x0, 0x0, 0xf, 0xfe, 0xff, 0xf0, 0x0, 0x0,
-    0xff, 0xe0,
-
-    /* U+0049 "I" */
-    0xbf, 0xf2, 0xff, 0xcb, 0xff, 0x2f, 0xfc, 0xbf,
-    0xf2, 0xff, 0xcb, 0xff, 0x2f, 0xfc, 0xbf, 0xf2,
-    0xff, 0xcb, 0xff, 0x2f, 0xfc, 0xbf, 0xf2, 0xff,
-    0xcb, 0xff, 0x2f, 0xfc, 0xbf, 0xf2, 0xff, 0xcb,
-    0xff, 0x2f, 0xfc, 0xbf, 0xf2, 0xff, 0xcb, 0xff,
-    0x2f, 0xfc, 0xbf, 0xf0,
-
-    /* U+004A "J" */
-    0x0, 0x3f, 0xf8, 0x0, 0xff, 0xe0, 0x3, 0xff,
-    0x80, 0xf, 0xfe, 0x0, 0x3f, 0xf8, 0x0, 0xff,
-    0xe0, 0x3, 0xff, 0x80, 0xf, 0xfe, 0x0, 0x3f,
-    0xf8, 0x0, 0xff, 0xe0, 0x3, 0xff, 0x80, 0xf,
-    0xfe, 0x0, 0x3f, 0xf8, 0x0, 0xff, 0xe0, 0x3,
-    0xff, 0x80, 0xf, 0xfe, 0x0, 0x3f, 0xf8, 0x0,
-    0xff, 0xe0, 0x3, 0xff, 0x80, 0xf, 0xfe, 0x0,
-    0x3f, 0xf8, 0x1, 0xff, 0xe0, 0x7, 0xff, 0x80,
-    0x3f, 0xfd, 0x2, 0xff, 0xf2, 0xff, 0xff, 0xcb,
-    0xff, 0xfd, 0x2f, 0xff, 0xe0, 0xbf, 0xfd, 0x2,
-    0xff, 0x40, 0x0, 0x0, 0x0, 0x0,
-
-    /* U+004B "K" */
-    0xff, 0xf0, 0x0, 0xf, 0xff, 0x83, 0xff, 0xc0,
-    0x0, 0xbf, 0xfc, 0xf, 0xff, 0x0, 0x7, 0xff,
-    0xc0, 0x3f, 0xfc, 0x0, 0x3f, 0xfd, 0x0, 0xff,
-    0xf0, 0x2, 0xff, 0xe0, 0x3, 0xff, 0xc0, 0x1f,
-    0xff, 0x0, 0xf, 0xff, 0x0, 0xff, 0xf4, 0x0,
-    0x3f, 0xfc, 0xf, 0xff, 0x80, 0x0, 0xff, 0xf0,
-    0xbf, 0xfc, 0x0, 0x3, 0xff, 0xc3, 0xff, 0xc0,
-    0x0, 0xf, 0xff, 0xff, 0xfd, 0x0, 0x0, 0x3f,
-    0xff, 0xff, 0xe0, 0x0, 0x0, 0xff, 0xff, 0xff,
-    0x80, 0x0, 0x3, 0xff, 0xff, 0xff, 0x80, 0x0,
-    0xf, 0xff, 0xff, 0xff, 0x80, 0x0, 0x3f, 0xfc,
-    0xf, 0xff, 0x80, 0x0, 0xff, 0xf0, 0xf, 0xff,
-    0x40, 0x3, 0xff, 0xc0, 0xf, 0xff, 0x40, 0xf,
-    0xff, 0x0, 0x1f, 0xff, 0x0, 0x3f, 0xfc, 0x0,
-    0x2f, 0xfe, 0x0, 0xff, 0xf0, 0x0, 0x3f, 0xfd,
-    0x3, 0xff, 0xc0, 0x0, 0x3f, 0xfc, 0xf, 0xff,
-    0x0, 0x0, 0xbf, 0xf8, 0x3f, 0xfc, 0x0, 0x0,
-    0xff, 0xf4, 0xff, 0xf0, 0x0, 0x1, 0xff, 0xf0,
-
-    /* U+004C "L" */
-    0xff, 0xf0, 0x0, 0x0, 0x3f, 0xfc, 0x0, 0x0,
-    0xf, 0xff, 0x0, 0x0, 0x3, 0xff, 0xc0, 0x0,
-    0x0, 0xff, 0xf0, 0x0, 0x0, 0x3f, 0xfc, 0x0,
-    0x0, 0xf, 0xff, 0x0, 0x0, 0x3, 0xff, 0xc0,
-    0x0, 0x0, 0xff, 0xf0, 0x0, 0x0, 0x3f, 0xfc,
-    0x0, 0x0, 0xf, 0xff, 0x0, 0x0, 0x3, 0xff,
-    0xc0, 0x0, 0x0, 0xff, 0xf0, 0x0, 0x0, 0x3f,
-    0xfc, 0x0, 0x0, 0xf, 0xff, 0x0, 0x0, 0x3,
-    0xff, 0xc0, 0x0, 0x0, 0xff, 0xf0, 0x0, 0x0,
-    0x3f, 0xfc, 0x0, 0x0, 0xf, 0xff, 0x0, 0x0,
-    0x3, 0xff, 0xc0, 0x0, 0x0, 0xff, 0xff, 0xff,
-    0xff, 0x7f, 0xff, 0xff, 0xff, 0xdf, 0xff, 0xff,
-    0xff, 0xf7, 0xff, 0xff, 0xff, 0xfd, 0xff, 0xff,
-    0xff, 0xff, 0x40,
-
-    /* U+004D "M" */
-    0xff, 0xff, 0xf8, 0x0, 0x2f, 0xff, 0xff, 0xff,
-    0xff, 0xfc, 0x0, 0x3f, 0xff, 0xff, 0xff, 0xff,
-    0xfc, 0x0, 0x3f, 0xff, 0xff, 0xff, 0xff, 0xfc,
-    0x0, 0x3f, 0xff, 0xff, 0xff, 0xff, 0xfd, 0x0,
-    0x7f, 0xff, 0xff, 0xff, 0xfb, 0xfe, 0x0, 0xbf,
-    0xef, 0xff, 0xff, 0xf7, 0xfe, 0x0, 0xff, 0xdf,
-    0xff, 0xff, 0xf3, 0xff, 0x0, 0xff, 0xcf, 0xff,
-    0xff, 0xf3, 0xff, 0x0, 0xff, 0xcf, 0xff, 0xff,
-    0xf3, 0xff, 0x41, 0xff, 0x8f, 0xff, 0xff, 0xf2,
-    0xff, 0x42, 0xff, 0x8f, 0xff, 0xff, 0xf1, 0xff,
-    0x82, 0xff, 0x4f, 0xff, 0xff, 0xf0, 0xff, 0xc3,
-    0xff, 0xf, 0xff, 0xff, 0xf0, 0xff, 0xc3, 0xff,
-    0xf, 0xff, 0xff, 0xf0, 0xbf, 0xd7, 0xfe, 0xf,
-    0xff, 0xff, 0xf0, 0x7f, 0xd7, 0xfd, 0xf, 0xff,
-    0xff, 0xf0, 0x7f, 0xeb, 0xfd, 0xf, 0xff, 0xff,
-    0xf0, 0x3f, 0xff, 0xfc, 0xf, 0xff, 0xff, 0xf0,
-    0x3f, 0xff, 0xfc, 0xf, 0xff, 0xff, 0xf0, 0x2f,
-    0xff, 0xf8, 0xf, 0xff, 0xff, 0xf0, 0x1f, 0xff,
-    0xf4, 0xf, 0xff, 0xff, 0xf0, 0xf, 0xff, 0xf0,
-    0xf, 0xff, 0xff, 0xf0, 0xf, 0xff, 0xf0, 0xf,
-    0xff, 0xff, 0xf0, 0xf, 0xff, 0xf0, 0xf, 0xff,
-    0xff, 0xf0, 0xb, 0xff, 0xe0, 0xf, 0xff,
-
-    /* U+004E "N" */
-    0xff, 0xff, 0xf0, 0x0, 0xff, 0xff, 0xff, 0xff,
-    0x0, 0xf, 0xff, 0xff, 0xff, 0xf4, 0x0, 0xff,
-    0xff, 0xff, 0xff, 0x80, 0xf, 0xff, 0xff, 0xff,
-    0xfc, 0x0, 0xff, 0xff, 0xff, 0xff, 0xd0, 0xf,
-    0xff, 0xff, 0xfb, 0xfe, 0x0, 0xff, 0xff, 0xff,
-    0x3f, 0xf0, 0xf, 0xff, 0xff, 0xf3, 0xff, 0x0,
-    0xff, 0xff, 0xff, 0x2f, 0xf8, 0xf, 0xff, 0xff,
-    0xf1, 0xff, 0xc0, 0xff, 0xff, 0xff, 0xf, 0xfc,
-    0xf, 0xff, 0xff, 0xf0, 0xbf, 0xd0, 0xff, 0xff,
-    0xff, 0x7, 0xfe, 0xf, 0xff, 0xff, 0xf0, 0x3f,
-    0xf0, 0xff, 0xff, 0xff, 0x2, 0xff, 0x4f, 0xff,
-    0xff, 0xf0, 0x1f, 0xf8, 0xff, 0xff, 0xff, 0x0,
-    0xff, 0xcf, 0xff, 0xff, 0xf0, 0xf, 0xfd, 0xff,
-    0xff, 0xff, 0x0, 0x7f, 0xef, 0xff, 0xff, 0xf0,
-    0x3, 0xff, 0xff, 0xff, 0xff, 0x0, 0x3f, 0xff,
-    0xff, 0xff, 0xf0, 0x2, 0xff, 0xff, 0xff, 0xff,
-    0x0, 0xf, 0xff, 0xff, 0xff, 0xf0, 0x0, 0xff,
-    0xff, 0xf0,
-
-    /* U+004F "O" */
-    0x0, 0x0, 0x6f, 0xff, 0x90, 0x0, 0x0, 0x0,
-    0x1f, 0xff, 0xff, 0xf8, 0x0, 0x0, 0x3, 0xff,
-    0xff, 0xff, 0xfe, 0x0, 0x0, 0x3f, 0xff, 0xff,
-    0xff, 0xfe, 0x0, 0x3, 0xff, 0xff, 0xab, 0xff,
-    0xfe, 0x0, 0x2f, 0xff, 0xc0, 0x1, 0xff, 0xfd,
-    0x0, 0xff, 0xfc, 0x0, 0x1, 0xff, 0xf8, 0xb,
-    0xff, 0xc0, 0x0, 0x2, 0xff, 0xf0, 0x3f, 0xfe,
-    0x0, 0x0, 0x3, 0xff, 0xd0, 0xff, 0xf0, 0x0,
-    0x0, 0xb, 0xff, 0xc7, 0xff, 0xc0, 0x0, 0x0,
-    0x1f, 0xff, 0x1f, 0xff, 0x0, 0x0, 0x0, 0x7f,
-    0xfc, 0xbf, 0xfc, 0x0, 0x0, 0x0, 0xff, 0xf2,
-    0xff, 0xf0, 0x0, 0x0, 0x7, 0xff, 0xc7, 0xff,
-    0xc0, 0x0, 0x0, 0x1f, 0xff, 0x1f, 0xff, 0x0,
-    0x0, 0x0, 0xbf, 0xfc, 0x3f, 0xfd, 0x0, 0x0,
-    0x3, 0xff, 0xe0, 0xff, 0xfc, 0x0, 0x0, 0x1f,
-    0xff, 0x41, 0xff, 0xf8, 0x0, 0x0, 0xff, 0xfc,
-    0x3, 0xff, 0xf8, 0x0, 0x1f, 0xff, 0xd0, 0x3,
-    0xff, 0xfe, 0x5b, 0xff, 0xff, 0x0, 0x7, 0xff,
-    0xff, 0xff, 0xff, 0xf0, 0x0, 0x7, 0xff, 0xff,
-    0xff, 0xfe, 0x0, 0x0, 0x2, 0xff, 0xff, 0xff,
-    0xd0, 0x0, 0x0, 0x0, 0x6f, 0xff, 0x90, 0x0,
-    0x0,
-
-    /* U+0050 "P" */
-    0xff, 0xff, 0xff, 0xfe, 0x0, 0x3f, 0xff, 0xff,
-    0xff, 0xf8, 0xf, 0xff, 0xff, 0xff, 0xff, 0xc3,
-    0xff, 0xff, 0xff, 0xff, 0xf8, 0xff, 0xff, 0xff,
-    0xff, 0xff, 0x3f, 0xfc, 0x0, 0x3, 0xff, 0xdf,
-    0xff, 0x0, 0x0, 0x3f, 0xfb, 0xff, 0xc0, 0x0,
-    0xb, 0xfe, 0xff, 0xf0, 0x0, 0x2, 0xff, 0xbf,
-    0xfc, 0x0, 0x0, 0xff, 0xef, 0xff, 0x0, 0x0,
-    0xff, 0xf7, 0xff, 0xff, 0xff, 0xff, 0xfc, 0xff,
-    0xff, 0xff, 0xff, 0xfe, 0x3f, 0xff, 0xff, 0xff,
-    0xff, 0xf, 0xff, 0xff, 0xff, 0xfd, 0x3, 0xff,
-    0xff, 0xff, 0xf8, 0x0, 0xff, 0xf0, 0x0, 0x0,
-    0x0, 0x3f, 0xfc, 0x0, 0x0, 0x0, 0xf, 0xff,
-    0x0, 0x0, 0x0, 0x3, 0xff, 0xc0, 0x0, 0x0,
-    0x0, 0xff, 0xf0, 0x0, 0x0, 0x0, 0x3f, 0xfc,
-    0x0, 0x0, 0x0, 0xf, 0xff, 0x0, 0x0, 0x0,
-    0x3, 0xff, 0xc0, 0x0, 0x0, 0x0, 0xff, 0xf0,
-    0x0, 0x0, 0x0, 0x0,
-
-    /* U+0051 "Q" */
-    0x0, 0x0, 0x1b, 0xff, 0x90, 0x0, 0x0, 0x0,
-    0x1f, 0xff, 0xff, 0xf8, 0x0, 0x0, 0x2, 0xff,
-    0xff, 0xff, 0xfe, 0x0, 0x0, 0x3f, 0xff, 0xff,
-    0xff, 0xfe, 0x0, 0x3, 0xff, 0xfe, 0x5a, 0xff,
-    0xfe, 0x0, 0x2f, 0xff, 0x80, 0x0, 0xff, 0xfd,
-    0x0, 0xff, 0xf4, 0x0, 0x0, 0xbf, 0xfc, 0xb,
-    0xff, 0xc0, 0x0, 0x0, 0xff, 0xf4, 0x3f, 0xfc,
-    0x0, 0x0, 0x1, 0xff, 0xe0, 0xff, 0xe0, 0x0,
-    0x0, 0x3, 0xff, 0xc7, 0xff, 0x40, 0x0, 0x0,
-    0xb, 0xff, 0x1f, 0xfc, 0x0, 0x0, 0x0, 0x1f,
-    0xfd, 0xbf, 0xf0, 0x0, 0x0, 0x0, 0x7f, 0xf5,
-    0xff, 0xc0, 0x0, 0x0, 0x1, 0xff, 0xd7, 0xff,
-    0x40, 0x0, 0x0, 0xb, 0xff, 0xf, 0xfe, 0x0,
-    0x0, 0x0, 0x3f, 0xfc, 0x3f, 0xfc, 0x0, 0x0,
-    0x0, 0xff, 0xf0, 0xbf, 0xf8, 0x0, 0x0, 0xf,
-    0xff, 0x41, 0xff, 0xf4, 0x0, 0x0, 0xbf, 0xfc,
-    0x2, 0xff, 0xf8, 0x0, 0xf, 0xff, 0xe0, 0x3,
-    0xff, 0xfe, 0xab, 0xff, 0xfe, 0x0, 0x3, 0xff,
-    0xff, 0xff, 0xff, 0xf0, 0x0, 0x2, 0xff, 0xff,
-    0xff, 0xfe, 0x0, 0x0, 0x1, 0xff, 0xff, 0xff,
-    0xc0, 0x0, 0x0, 0x0, 0x2b, 0xff, 0xff, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0xf, 0xfe, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x1f, 0xfc, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x15, 0x50, 0x0,
-
-    /* U+0052 "R" */
-    0xff, 0xff, 0xff, 0xf9, 0x0, 0xf, 0xff, 0xff,
-    0xff, 0xfc, 0x0, 0xff, 0xff, 0xff, 0xff, 0xf4,
-    0xf, 0xff, 0xff, 0xff, 0xff, 0xc0, 0xff, 0xf0,
-    0x0, 0x6f, 0xfe, 0xf, 0xff, 0x0, 0x0, 0x7f,
-    0xf0, 0xff, 0xf0, 0x0, 0x3, 0xff, 0xf, 0xff,
-    0x0, 0x0, 0x3f, 0xf0, 0xff, 0xf0, 0x0, 0x3,
-    0xff, 0xf, 0xff, 0x0, 0x0, 0xbf, 0xf0, 0xff,
-    0xf0, 0x0, 0x6f, 0xfd, 0xf, 0xff, 0xff, 0xff,
-    0xff, 0xc0, 0xff, 0xff, 0xff, 0xff, 0xf4, 0xf,
-    0xff, 0xff, 0xff, 0xfc, 0x0, 0xff, 0xff, 0xff,
-    0xf9, 0x0, 0xf, 0xff, 0xb, 0xff, 0xc0, 0x0,
-    0xff, 0xf0, 0x2f, 0xfe, 0x0, 0xf, 0xff, 0x0,
-    0xff, 0xf4, 0x0, 0xff, 0xf0, 0x3, 0xff, 0xc0,
-    0xf, 0xff, 0x0, 0x1f, 0xff, 0x0, 0xff, 0xf0,
-    0x0, 0xbf, 0xf8, 0xf, 0xff, 0x0, 0x3, 0xff,
-    0xc0, 0xff, 0xf0, 0x0, 0x1f, 0xff, 0xf, 0xff,
-    0x0, 0x0, 0xff, 0xf4, 0xff, 0xf0, 0x0, 0x7,
-    0xff, 0xc0,
-
-    /* U+0053 "S" */
-    0x0, 0x2f, 0xff, 0xa4, 0x0, 0xb, 0xff, 0xff,
-    0xfe, 0x0, 0xff, 0xff, 0xff, 0xf8, 0xb, 0xff,
-    0xff, 0xff, 0xe0, 0x3f, 0xff, 0x96, 0xbf, 0x81,
-    0xff, 0xe0, 0x0, 0x5, 0x7, 0xff, 0x40, 0x0,
-    0x0, 0x1f, 0xfd, 0x0, 0x0, 0x0, 0x3f, 0xfd,
-    0x0, 0x0, 0x0, 0xff, 0xfe, 0x0, 0x0, 0x0,
-    0xff, 0xff, 0xe0, 0x0, 0x1, 0xff, 0xff, 0xfd,
-    0x0, 0x0, 0x7f, 0xff, 0xfe, 0x0, 0x0, 0x1b,
-    0xff, 0xff, 0x0, 0x0, 0x1, 0xff, 0xfd, 0x0,
-    0x0, 0x0, 0xbf, 0xfc, 0x0, 0x0, 0x0, 0xff,
-    0xf0, 0x0, 0x0, 0x2, 0xff, 0xca, 0x0, 0x0,
-    0xb, 0xff, 0x2f, 0xd0, 0x0, 0x7f, 0xfc, 0xbf,
-    0xfe, 0xaf, 0xff, 0xf2, 0xff, 0xff, 0xff, 0xff,
-    0x4b, 0xff, 0xff, 0xff, 0xf8, 0x7, 0xff, 0xff,
-    0xff, 0x40, 0x0, 0x6b, 0xff, 0x90, 0x0,
-
-    /* U+0054 "T" */
-    0x7f, 0xff, 0xff, 0xff, 0xfe, 0x7f, 0xff, 0xff,
-    0xff, 0xfe, 0x7f, 0xff, 0xff, 0xff, 0xfe, 0x7f,
-    0xff, 0xff, 0xff, 0xfe, 0x7f, 0xff, 0xff, 0xff,
-    0xfd, 0x0, 0x3, 0xff, 0xc0, 0x0, 0x0, 0x3,
-    0xff, 0xc0, 0x0, 0x0, 0x3, 0xff, 0xc0, 0x0,
-    0x0, 0x3, 0xff, 0xc0, 0x0, 0x0, 0x3, 0xff,
-    0xc0, 0x0, 0x0, 0x3, 0xff, 0xc0, 0x0, 0x0,
-    0x3, 0xff, 0xc0, 0x0, 0x0, 0x3, 0xff, 0xc0,
-    0x0, 0x0, 0x3, 0xff, 0xc0, 0x0, 0x0, 0x3,
-    0xff, 0xc0, 0x0, 0x0, 0x3, 0xff, 0xc0, 0x0,
-    0x0, 0x3, 0xff, 0xc0, 0x0, 0x0, 0x3, 0xff,
-    0xc0, 0x0, 0x0, 0x3, 0xff, 0xc0, 0x0, 0x0,
-    0x3, 0xff, 0xc0, 0x0, 0x0, 0x3, 0xff, 0xc0,
-    0x0, 0x0, 0x3, 0xff, 0xc0, 0x0, 0x0, 0x3,
-    0xff, 0xc0, 0x0, 0x0, 0x3, 0xff, 0xc0, 0x0,
-    0x0, 0x3, 0xff, 0xc0, 0x0,
-
-    /* U+0055 "U" */
-    0xff, 0xf0, 0x0, 0x0, 0xbf, 0xf7, 0xff, 0xc0,
-    0x0, 0x2, 0xff, 0xdf, 0xff, 0x0, 0x0, 0xb,
-    0xff, 0x7f, 0xfc, 0x0, 0x0, 0x2f, 0xfd, 0xff,
-    0xf0, 0x0, 0x0, 0xbf, 0xf7, 0xff, 0xc0, 0x0,
-    0x2, 0xff, 0xdf, 0xff, 0x0, 0x0, 0xb, 0xff,
-    0x7f, 0xfc, 0x0, 0x0, 0x2f, 0xfd, 0xff, 0xf0,
-    0x0, 0x0, 0xbf, 0xf7, 0xff, 0xc0, 0x0, 0x2,
-    0xff, 0xdf, 0xff, 0x0, 0x0, 0xb, 0xff, 0x7f,
-    0xfc, 0x0, 0x0, 0x2f, 0xfd, 0xff, 0xf0, 0x0,
-    0x0, 0xbf, 0xf7, 0xff, 0xc0, 0x0, 0x2, 0xff,
-    0xdf, 0xff, 0x0, 0x0, 0xb, 0xff, 0x7f, 0xfc,
-    0x0, 0x0, 0x3f, 0xfc, 0xbf, 0xf4, 0x0, 0x0,
-    0xff, 0xf2, 0xff, 0xf0, 0x0, 0x7, 0xff, 0xc7,
-    0xff, 0xe0, 0x0, 0x7f, 0xfe, 0xf, 0xff, 0xf5,
-    0x1b, 0xff, 0xf4, 0x1f, 0xff, 0xff, 0xff, 0xff,
-    0xc0, 0x2f, 0xff, 0xff, 0xff, 0xfc, 0x0, 0x2f,
-    0xff, 0xff, 0xff, 0xc0, 0x0, 0x1f, 0xff, 0xff,
-    0xf8, 0x0, 0x0, 0x2, 0xbf, 0xf9, 0x0, 0x0,
-
     /* U+0056 "V" */
     0x7f, 0xfc, 0x0, 0x0, 0x3, 0xff, 0xd3, 0xff,
     0xc0, 0x0, 0x0, 0x7f, 0xfc, 0x3f, 0xfe, 0x0,
@@ -928,611 +267,7 @@ static LV_ATTRIBUTE_LARGE_CONST const uint8_t glyph_bitmap[] = {
     0xff, 0xf0, 0x0, 0x0, 0xf, 0xff, 0xf4, 0x2,
     0xff, 0xfe, 0x0, 0x0, 0x0, 0xbf, 0xff, 0x0,
     0x2f, 0xff, 0xd0, 0x0, 0x0, 0x7, 0xff, 0xf0,
-    0x1, 0xff, 0xfc, 0x0, 0x0,
-
-    /* U+0058 "X" */
-    0x3f, 0xfe, 0x0, 0x0, 0x7, 0xff, 0xd1, 0xff,
-    0xf4, 0x0, 0x0, 0xff, 0xf8, 0xb, 0xff, 0xc0,
-    0x0, 0x3f, 0xff, 0x0, 0x3f, 0xff, 0x0, 0xb,
-    0xff, 0xd0, 0x1, 0xff, 0xf4, 0x0, 0xff, 0xf8,
-    0x0, 0xb, 0xff, 0xc0, 0x3f, 0xff, 0x0, 0x0,
-    0x3f, 0xff, 0xb, 0xff, 0xc0, 0x0, 0x0, 0xff,
-    0xf9, 0xff, 0xf4, 0x0, 0x0, 0x7, 0xff, 0xff,
-    0xfe, 0x0, 0x0, 0x0, 0x2f, 0xff, 0xff, 0xc0,
-    0x0, 0x0, 0x0, 0xff, 0xff, 0xf4, 0x0, 0x0,
-    0x0, 0x7, 0xff, 0xfe, 0x0, 0x0, 0x0, 0x0,
-    0x2f, 0xff, 0xc0, 0x0, 0x0, 0x0, 0x3, 0xff,
-    0xfd, 0x0, 0x0, 0x0, 0x0, 0xff, 0xff, 0xf0,
-    0x0, 0x0, 0x0, 0x2f, 0xff, 0xff, 0xc0, 0x0,
-    0x0, 0x7, 0xff, 0xff, 0xfe, 0x0, 0x0, 0x0,
-    0xff, 0xf9, 0xff, 0xf4, 0x0, 0x0, 0x2f, 0xff,
-    0xf, 0xff, 0xc0, 0x0, 0x7, 0xff, 0xd0, 0x3f,
-    0xfe, 0x0, 0x0, 0xff, 0xf8, 0x1, 0xff, 0xf4,
-    0x0, 0x3f, 0xff, 0x0, 0xb, 0xff, 0xc0, 0xb,
-    0xff, 0xd0, 0x0, 0x3f, 0xff, 0x0, 0xff, 0xf8,
-    0x0, 0x1, 0xff, 0xf8, 0x3f, 0xff, 0x0, 0x0,
-    0xb, 0xff, 0xc0,
-
-    /* U+0059 "Y" */
-    0x7f, 0xfc, 0x0, 0x0, 0xff, 0xf8, 0xff, 0xf8,
-    0x0, 0x7, 0xff, 0xc0, 0xff, 0xf0, 0x0, 0x3f,
-    0xfe, 0x2, 0xff, 0xe0, 0x1, 0xff, 0xf0, 0x3,
-    0xff, 0xc0, 0xf, 0xff, 0x40, 0xb, 0xff, 0x80,
-    0x7f, 0xfc, 0x0, 0xf, 0xff, 0x3, 0xff, 0xd0,
-    0x0, 0x1f, 0xfe, 0x1f, 0xff, 0x0, 0x0, 0x3f,
-    0xfc, 0xff, 0xf0, 0x0, 0x0, 0x7f, 0xff, 0xff,
-    0x80, 0x0, 0x0, 0xff, 0xff, 0xfc, 0x0, 0x0,
-    0x0, 0xff, 0xff, 0xe0, 0x0, 0x0, 0x2, 0xff,
-    0xff, 0x0, 0x0, 0x0, 0x3, 0xff, 0xf4, 0x0,
-    0x0, 0x0, 0xb, 0xff, 0xc0, 0x0, 0x0, 0x0,
-    0x1f, 0xfe, 0x0, 0x0, 0x0, 0x0, 0x7f, 0xf8,
-    0x0, 0x0, 0x0, 0x1, 0xff, 0xe0, 0x0, 0x0,
-    0x0, 0x7, 0xff, 0x80, 0x0, 0x0, 0x0, 0x1f,
-    0xfe, 0x0, 0x0, 0x0, 0x0, 0x7f, 0xf8, 0x0,
-    0x0, 0x0, 0x1, 0xff, 0xe0, 0x0, 0x0, 0x0,
-    0x7, 0xff, 0x80, 0x0, 0x0, 0x0, 0x1f, 0xfe,
-    0x0, 0x0, 0x0, 0x0, 0x7f, 0xf8, 0x0, 0x0,
-
-    /* U+005A "Z" */
-    0x3f, 0xff, 0xff, 0xff, 0xff, 0xc3, 0xff, 0xff,
-    0xff, 0xff, 0xfc, 0x3f, 0xff, 0xff, 0xff, 0xff,
-    0xc3, 0xff, 0xff, 0xff, 0xff, 0xfc, 0x3f, 0xff,
-    0xff, 0xff, 0xff, 0xc0, 0x0, 0x0, 0x3, 0xff,
-    0xf4, 0x0, 0x0, 0x0, 0xbf, 0xfe, 0x0, 0x0,
-    0x0, 0x2f, 0xff, 0x80, 0x0, 0x0, 0x7, 0xff,
-    0xf0, 0x0, 0x0, 0x1, 0xff, 0xfc, 0x0, 0x0,
-    0x0, 0x3f, 0xff, 0x0, 0x0, 0x0, 0xf, 0xff,
-    0xd0, 0x0, 0x0, 0x3, 0xff, 0xf4, 0x0, 0x0,
-    0x0, 0xff, 0xfe, 0x0, 0x0, 0x0, 0x2f, 0xff,
-    0x80, 0x0, 0x0, 0xb, 0xff, 0xf0, 0x0, 0x0,
-    0x2, 0xff, 0xfc, 0x0, 0x0, 0x0, 0x7f, 0xff,
-    0x0, 0x0, 0x0, 0x1f, 0xff, 0xc0, 0x0, 0x0,
-    0x3, 0xff, 0xf4, 0x0, 0x0, 0x0, 0xbf, 0xff,
-    0xff, 0xff, 0xff, 0xdb, 0xff, 0xff, 0xff, 0xff,
-    0xfd, 0xbf, 0xff, 0xff, 0xff, 0xff, 0xdb, 0xff,
-    0xff, 0xff, 0xff, 0xfd, 0xbf, 0xff, 0xff, 0xff,
-    0xff, 0xd0,
-
-    /* U+005B "[" */
-    0x7f, 0xff, 0xc7, 0xff, 0xfc, 0x7f, 0xff, 0xc7,
-    0xff, 0xfc, 0x7f, 0xff, 0xc7, 0xff, 0x54, 0x7f,
-    0xe0, 0x7, 0xfe, 0x0, 0x7f, 0xe0, 0x7, 0xfe,
-    0x0, 0x7f, 0xe0, 0x7, 0xfe, 0x0, 0x7f, 0xe0,
-    0x7, 0xfe, 0x0, 0x7f, 0xe0, 0x7, 0xfe, 0x0,
-    0x7f, 0xe0, 0x7, 0xfe, 0x0, 0x7f, 0xe0, 0x7,
-    0xfe, 0x0, 0x7f, 0xe0, 0x7, 0xfe, 0x0, 0x7f,
-    0xe0, 0x7, 0xfe, 0x0, 0x7f, 0xe0, 0x7, 0xfe,
-    0x0, 0x7f, 0xe0, 0x7, 0xfe, 0x0, 0x7f, 0xe0,
-    0x7, 0xff, 0x54, 0x7f, 0xff, 0xc7, 0xff, 0xfc,
-    0x7f, 0xff, 0xc7, 0xff, 0xfc, 0x7f, 0xff, 0xc0,
-
-    /* U+005C "\\" */
-    0x7f, 0xd0, 0x0, 0x0, 0x3, 0xfe, 0x0, 0x0,
-    0x0, 0x1f, 0xf0, 0x0, 0x0, 0x0, 0xff, 0x80,
-    0x0, 0x0, 0xb, 0xfc, 0x0, 0x0, 0x0, 0x7f,
-    0xd0, 0x0, 0x0, 0x3, 0xff, 0x0, 0x0, 0x0,
-    0x1f, 0xf0, 0x0, 0x0, 0x0, 0xff, 0x80, 0x0,
-    0x0, 0xb, 0xfc, 0x0, 0x0, 0x0, 0x3f, 0xd0,
-    0x0, 0x0, 0x3, 0xff, 0x0, 0x0, 0x0, 0x1f,
-    0xf0, 0x0, 0x0, 0x0, 0xff, 0x80, 0x0, 0x0,
-    0xb, 0xfc, 0x0, 0x0, 0x0, 0x3f, 0xd0, 0x0,
-    0x0, 0x3, 0xff, 0x0, 0x0, 0x0, 0x1f, 0xf0,
-    0x0, 0x0, 0x0, 0xff, 0x80, 0x0, 0x0, 0xb,
-    0xfc, 0x0, 0x0, 0x0, 0x3f, 0xd0, 0x0, 0x0,
-    0x3, 0xff, 0x0, 0x0, 0x0, 0x1f, 0xf4, 0x0,
-    0x0, 0x0, 0xff, 0x80, 0x0, 0x0, 0xb, 0xfc,
-    0x0, 0x0, 0x0, 0x3f, 0xd0, 0x0, 0x0, 0x3,
-    0xff, 0x0, 0x0, 0x0, 0x1f, 0xf4, 0x0, 0x0,
-    0x0, 0xff, 0x80, 0x0, 0x0, 0xb, 0xfc, 0x0,
-    0x0, 0x0, 0x3f, 0xe0,
-
-    /* U+005D "]" */
-    0x3f, 0xff, 0xd3, 0xff, 0xfd, 0x3f, 0xff, 0xd3,
-    0xff, 0xfd, 0x3f, 0xff, 0xd1, 0x5f, 0xfd, 0x0,
-    0xff, 0xd0, 0xf, 0xfd, 0x0, 0xff, 0xd0, 0xf,
-    0xfd, 0x0, 0xff, 0xd0, 0xf, 0xfd, 0x0, 0xff,
-    0xd0, 0xf, 0xfd, 0x0, 0xff, 0xd0, 0xf, 0xfd,
-    0x0, 0xff, 0xd0, 0xf, 0xfd, 0x0, 0xff, 0xd0,
-    0xf, 0xfd, 0x0, 0xff, 0xd0, 0xf, 0xfd, 0x0,
-    0xff, 0xd0, 0xf, 0xfd, 0x0, 0xff, 0xd0, 0xf,
-    0xfd, 0x0, 0xff, 0xd0, 0xf, 0xfd, 0x0, 0xff,
-    0xd1, 0x5f, 0xfd, 0x3f, 0xff, 0xd3, 0xff, 0xfd,
-    0x3f, 0xff, 0xd3, 0xff, 0xfd, 0x3f, 0xff, 0xd0,
-
-    /* U+005E "^" */
-    0x0, 0x2f, 0xfd, 0x0, 0x0, 0xf, 0xff, 0xc0,
-    0x0, 0x7, 0xff, 0xf0, 0x0, 0x3, 0xff, 0xfe,
-    0x0, 0x0, 0xff, 0xbf, 0xc0, 0x0, 0xbf, 0xcf,
-    0xf4, 0x0, 0x3f, 0xe2, 0xff, 0x0, 0x1f, 0xf0,
-    0x7f, 0xc0, 0xb, 0xfc, 0xf, 0xf8, 0x3, 0xfd,
-    0x2, 0xff, 0x2, 0xff, 0x0, 0x3f, 0xd0, 0xff,
-    0x80, 0xf, 0xfc, 0x7f, 0xd0, 0x1, 0xff, 0x2f,
-    0xf0, 0x0, 0x3f, 0xe0,
-
-    /* U+005F "_" */
-    0xaa, 0xaa, 0xaa, 0xaa, 0xaf, 0xff, 0xff, 0xff,
-    0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
-    0xff, 0xff,
-
-    /* U+0060 "`" */
-    0x0, 0x0, 0x3, 0xff, 0x0, 0xf, 0xfc, 0x0,
-    0x3f, 0xe0, 0x0, 0xff, 0x0, 0x3, 0xfc,
-
-    /* U+0061 "a" */
-    0x0, 0x1b, 0xfe, 0x1f, 0xfd, 0x0, 0x3f, 0xff,
-    0xff, 0xff, 0x40, 0x3f, 0xff, 0xff, 0xff, 0xd0,
-    0x3f, 0xff, 0xff, 0xff, 0xf4, 0x2f, 0xff, 0x91,
-    0xbf, 0xfd, 0xf, 0xff, 0x40, 0x7, 0xff, 0x47,
-    0xff, 0x80, 0x0, 0xff, 0xd2, 0xff, 0xc0, 0x0,
-    0x3f, 0xf4, 0xff, 0xf0, 0x0, 0xf, 0xfd, 0x3f,
-    0xf8, 0x0, 0x3, 0xff, 0x4f, 0xfe, 0x0, 0x0,
-    0xff, 0xd3, 0xff, 0xc0, 0x0, 0x3f, 0xf4, 0xbf,
-    0xf0, 0x0, 0xf, 0xfd, 0x1f, 0xfe, 0x0, 0x3,
-    0xff, 0x43, 0xff, 0xd0, 0x1, 0xff, 0xd0, 0xbf,
-    0xfe, 0x46, 0xff, 0xf4, 0xf, 0xff, 0xff, 0xff,
-    0xfe, 0x0, 0xff, 0xff, 0xff, 0xff, 0x80, 0xf,
-    0xff, 0xff, 0xff, 0xf0, 0x0, 0x6f, 0xf9, 0x1f,
-    0xfc,
-
-    /* U+0062 "b" */
-    0x3f, 0xf8, 0x0, 0x0, 0x0, 0xf, 0xfe, 0x0,
-    0x0, 0x0, 0x3, 0xff, 0x80, 0x0, 0x0, 0x0,
-    0xff, 0xe0, 0x0, 0x0, 0x0, 0x3f, 0xf8, 0x0,
-    0x0, 0x0, 0xf, 0xfe, 0x0, 0x0, 0x0, 0x3,
-    0xff, 0x80, 0x0, 0x0, 0x0, 0xff, 0xe0, 0x0,
-    0x0, 0x0, 0x3f, 0xf8, 0x6f, 0xe4, 0x0, 0xf,
-    0xfe, 0xff, 0xff, 0xd0, 0x3, 0xff, 0xff, 0xff,
-    0xfd, 0x0, 0xff, 0xff, 0xff, 0xff, 0xd0, 0x3f,
-    0xff, 0x46, 0xff, 0xfc, 0xf, 0xfe, 0x0, 0x1f,
-    0xff, 0x43, 0xff, 0x0, 0x1, 0xff, 0xe0, 0xff,
-    0xc0, 0x0, 0x3f, 0xfc, 0x3f, 0xf0, 0x0, 0xb,
-    0xff, 0xf, 0xfc, 0x0, 0x1, 0xff, 0xc3, 0xff,
-    0x0, 0x0, 0x7f, 0xf0, 0xff, 0xc0, 0x0, 0x2f,
-    0xfc, 0x3f, 0xf0, 0x0, 0xf, 0xff, 0xf, 0xfc,
-    0x0, 0x7, 0xff, 0x83, 0xff, 0x80, 0x3, 0xff,
-    0xd0, 0xff, 0xfd, 0x1b, 0xff, 0xf0, 0x7f, 0xff,
-    0xff, 0xff, 0xf4, 0x1f, 0xff, 0xff, 0xff, 0xf8,
-    0xb, 0xff, 0xff, 0xff, 0xf4, 0x3, 0xff, 0x82,
-    0xff, 0x90, 0x0,
-
-    /* U+0063 "c" */
-    0x0, 0x1, 0xbf, 0xf9, 0x0, 0xb, 0xff, 0xff,
-    0xe0, 0x1f, 0xff, 0xff, 0xf8, 0x1f, 0xff, 0xff,
-    0xfe, 0x1f, 0xff, 0xfa, 0xaf, 0x8f, 0xff, 0xd0,
-    0x0, 0x7, 0xff, 0xc0, 0x0, 0x2, 0xff, 0xd0,
-    0x0, 0x0, 0xff, 0xf0, 0x0, 0x0, 0x3f, 0xfc,
-    0x0, 0x0, 0xf, 0xfe, 0x0, 0x0, 0x3, 0xff,
-    0xc0, 0x0, 0x0, 0xbf, 0xf4, 0x0, 0x0, 0x1f,
-    0xff, 0x0, 0x0, 0x3, 0xff, 0xf8, 0x0, 0x8,
-    0x7f, 0xff, 0xfa, 0xbf, 0x7, 0xff, 0xff, 0xff,
-    0xc0, 0x7f, 0xff, 0xff, 0xf0, 0x2, 0xff, 0xff,
-    0xfc, 0x0, 0x6, 0xff, 0xe4,
-
-    /* U+0064 "d" */
-    0x0, 0x0, 0x0, 0x1f, 0xfd, 0x0, 0x0, 0x0,
-    0x7, 0xff, 0x40, 0x0, 0x0, 0x1, 0xff, 0xd0,
-    0x0, 0x0, 0x0, 0x7f, 0xf4, 0x0, 0x0, 0x0,
-    0x1f, 0xfd, 0x0, 0x0, 0x0, 0x7, 0xff, 0x40,
-    0x0, 0x0, 0x1, 0xff, 0xd0, 0x0, 0x0, 0x0,
-    0x7f, 0xf4, 0x0, 0x1b, 0xf9, 0x1f, 0xfd, 0x0,
-    0x3f, 0xff, 0xfb, 0xff, 0x40, 0x3f, 0xff, 0xff,
-    0xff, 0xd0, 0x3f, 0xff, 0xff, 0xff, 0xf4, 0x2f,
-    0xff, 0x91, 0xbf, 0xfd, 0xf, 0xff, 0x40, 0x7,
-    0xff, 0x47, 0xff, 0x80, 0x0, 0xbf, 0xd2, 0xff,
-    0xc0, 0x0, 0x2f, 0xf4, 0xff, 0xf0, 0x0, 0xb,
-    0xfd, 0x3f, 0xf8, 0x0, 0x2, 0xff, 0x4f, 0xfe,
-    0x0, 0x0, 0xbf, 0xd3, 0xff, 0xc0, 0x0, 0x2f,
-    0xf4, 0xbf, 0xf0, 0x0, 0xb, 0xfd, 0x1f, 0xfe,
-    0x0, 0x2, 0xff, 0x43, 0xff, 0xd0, 0x1, 0xff,
-    0xd0, 0xbf, 0xfe, 0x46, 0xff, 0xf4, 0xf, 0xff,
-    0xff, 0xff, 0xfe, 0x1, 0xff, 0xff, 0xff, 0xff,
-    0x80, 0xf, 0xff, 0xff, 0xff, 0xf0, 0x0, 0x6f,
-    0xf9, 0x1f, 0xfc,
-
-    /* U+0065 "e" */
-    0x0, 0xb, 0xff, 0x90, 0x0, 0x0, 0xbf, 0xff,
-    0xfe, 0x0, 0x3, 0xff, 0xff, 0xff, 0xc0, 0xf,
-    0xff, 0xff, 0xff, 0xf0, 0x2f, 0xff, 0x41, 0xbf,
-    0xf8, 0x3f, 0xf8, 0x0, 0x2f, 0xfc, 0x7f, 0xf0,
-    0x0, 0xf, 0xfd, 0xbf, 0xff, 0xff, 0xff, 0xfe,
-    0xff, 0xff, 0xff, 0xff, 0xfe, 0xff, 0xff, 0xff,
-    0xff, 0xfe, 0xff, 0xff, 0xff, 0xff, 0xfe, 0xff,
-    0xf0, 0x0, 0x0, 0x0, 0xbf, 0xf0, 0x0, 0x0,
-    0x0, 0x7f, 0xf8, 0x0, 0x0, 0x0, 0x3f, 0xfe,
-    0x0, 0x0, 0x74, 0x1f, 0xff, 0xe5, 0x5b, 0xf4,
-    0xb, 0xff, 0xff, 0xff, 0xf4, 0x2, 0xff, 0xff,
-    0xff, 0xf4, 0x0, 0x7f, 0xff, 0xff, 0xf0, 0x0,
-    0x1, 0xbf, 0xfa, 0x0,
-
-    /* U+0066 "f" */
-    0x0, 0xa, 0xff, 0xe0, 0x0, 0xff, 0xff, 0x80,
-    0xf, 0xff, 0xfe, 0x0, 0x3f, 0xff, 0xf8, 0x0,
-    0xff, 0xf9, 0x50, 0x7, 0xff, 0x80, 0x0, 0x1f,
-    0xfd, 0x0, 0x0, 0x7f, 0xf4, 0x0, 0xbf, 0xff,
-    0xff, 0xf2, 0xff, 0xff, 0xff, 0xcb, 0xff, 0xff,
-    0xff, 0x2f, 0xff, 0xff, 0xfc, 0x56, 0xff, 0xe5,
-    0x50, 0x7, 0xff, 0x40, 0x0, 0x1f, 0xfd, 0x0,
-    0x0, 0x7f, 0xf4, 0x0, 0x1, 0xff, 0xd0, 0x0,
-    0x7, 0xff, 0x40, 0x0, 0x1f, 0xfd, 0x0, 0x0,
-    0x7f, 0xf4, 0x0, 0x1, 0xff, 0xd0, 0x0, 0x7,
-    0xff, 0x40, 0x0, 0x1f, 0xfd, 0x0, 0x0, 0x7f,
-    0xf4, 0x0, 0x1, 0xff, 0xd0, 0x0, 0x7, 0xff,
-    0x40, 0x0, 0x1f, 0xfd, 0x0, 0x0, 0x7f, 0xf4,
-    0x0,
-
-    /* U+0067 "g" */
-    0x0, 0x1b, 0xfe, 0x1f, 0xfd, 0x0, 0xff, 0xff,
-    0xff, 0xfd, 0x3, 0xff, 0xff, 0xff, 0xfd, 0xf,
-    0xff, 0xff, 0xff, 0xfd, 0x2f, 0xff, 0x91, 0xbf,
-    0xfd, 0x3f, 0xfd, 0x0, 0x1f, 0xfd, 0x7f, 0xf8,
-    0x0, 0xb, 0xfd, 0xbf, 0xf0, 0x0, 0xb, 0xfd,
-    0xff, 0xf0, 0x0, 0xb, 0xfd, 0xff, 0xe0, 0x0,
-    0xb, 0xfd, 0xff, 0xe0, 0x0, 0xb, 0xfd, 0xff,
-    0xf0, 0x0, 0xb, 0xfd, 0xbf, 0xf0, 0x0, 0xb,
-    0xfd, 0x7f, 0xf8, 0x0, 0xb, 0xfd, 0x3f, 0xfd,
-    0x0, 0x1f, 0xfd, 0x2f, 0xff, 0x91, 0xbf, 0xfd,
-    0xf, 0xff, 0xff, 0xff, 0xfd, 0x7, 0xff, 0xff,
-    0xff, 0xfd, 0x0, 0xff, 0xff, 0xff, 0xfd, 0x0,
-    0x1b, 0xfe, 0x1f, 0xfd, 0x0, 0x0, 0x0, 0x2f,
-    0xfc, 0x0, 0x0, 0x0, 0x7f, 0xfc, 0x39, 0x40,
-    0x2, 0xff, 0xfc, 0x3f, 0xff, 0xff, 0xff, 0xf8,
-    0x3f, 0xff, 0xff, 0xff, 0xf0, 0x3f, 0xff, 0xff,
-    0xff, 0xc0, 0x3f, 0xff, 0xff, 0xfe, 0x0, 0x1,
-    0xaf, 0xff, 0xa0, 0x0,
-
-    /* U+0068 "h" */
-    0x3f, 0xf8, 0x0, 0x0, 0x0, 0xff, 0xe0, 0x0,
-    0x0, 0x3, 0xff, 0x80, 0x0, 0x0, 0xf, 0xfe,
-    0x0, 0x0, 0x0, 0x3f, 0xf8, 0x0, 0x0, 0x0,
-    0xff, 0xe0, 0x0, 0x0, 0x3, 0xff, 0x80, 0x0,
-    0x0, 0xf, 0xfe, 0x0, 0x0, 0x0, 0x3f, 0xf8,
-    0x1b, 0xf9, 0x0, 0xff, 0xe7, 0xff, 0xfe, 0x3,
-    0xff, 0xff, 0xff, 0xfe, 0xf, 0xff, 0xff, 0xff,
-    0xfc, 0x3f, 0xff, 0xeb, 0xff, 0xf4, 0xff, 0xf4,
-    0x2, 0xff, 0xe3, 0xff, 0x80, 0x3, 0xff, 0x8f,
-    0xfe, 0x0, 0xf, 0xfe, 0x3f, 0xf8, 0x0, 0x3f,
-    0xf8, 0xff, 0xe0, 0x0, 0xff, 0xe3, 0xff, 0x80,
-    0x3, 0xff, 0x8f, 0xfe, 0x0, 0xf, 0xfe, 0x3f,
-    0xf8, 0x0, 0x3f, 0xf8, 0xff, 0xe0, 0x0, 0xff,
-    0xe3, 0xff, 0x80, 0x3, 0xff, 0x8f, 0xfe, 0x0,
-    0xf, 0xfe, 0x3f, 0xf8, 0x0, 0x3f, 0xf8, 0xff,
-    0xe0, 0x0, 0xff, 0xe3, 0xff, 0x80, 0x3, 0xff,
-    0x8f, 0xfe, 0x0, 0xf, 0xfe,
-
-    /* U+0069 "i" */
-    0xbf, 0xf2, 0xff, 0xcb, 0xff, 0x2f, 0xfc, 0xbf,
-    0xf2, 0xff, 0xc0, 0x0, 0x0, 0x0, 0xbf, 0xf2,
-    0xff, 0xcb, 0xff, 0x2f, 0xfc, 0xbf, 0xf2, 0xff,
-    0xcb, 0xff, 0x2f, 0xfc, 0xbf, 0xf2, 0xff, 0xcb,
-    0xff, 0x2f, 0xfc, 0xbf, 0xf2, 0xff, 0xcb, 0xff,
-    0x2f, 0xfc, 0xbf, 0xf2, 0xff, 0xcb, 0xff, 0x2f,
-    0xfc,
-
-    /* U+006A "j" */
-    0x0, 0x3f, 0xf8, 0x0, 0xff, 0xe0, 0x3, 0xff,
-    0x80, 0xf, 0xfe, 0x0, 0x3f, 0xf8, 0x0, 0xff,
-    0xd0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x3f,
-    0xf8, 0x0, 0xff, 0xe0, 0x3, 0xff, 0x80, 0xf,
-    0xfe, 0x0, 0x3f, 0xf8, 0x0, 0xff, 0xe0, 0x3,
-    0xff, 0x80, 0xf, 0xfe, 0x0, 0x3f, 0xf8, 0x0,
-    0xff, 0xe0, 0x3, 0xff, 0x80, 0xf, 0xfe, 0x0,
-    0x3f, 0xf8, 0x0, 0xff, 0xe0, 0x3, 0xff, 0x80,
-    0xf, 0xfe, 0x0, 0x3f, 0xf8, 0x0, 0xff, 0xe0,
-    0x3, 0xff, 0x80, 0x1f, 0xfe, 0x0, 0x7f, 0xf4,
-    0x3, 0xff, 0xd0, 0x3f, 0xff, 0x2f, 0xff, 0xf8,
-    0xbf, 0xff, 0xc2, 0xff, 0xfd, 0xb, 0xff, 0xc0,
-    0x2f, 0xa0, 0x0,
-
-    /* U+006B "k" */
-    0x3f, 0xf8, 0x0, 0x0, 0x0, 0xff, 0xe0, 0x0,
-    0x0, 0x3, 0xff, 0x80, 0x0, 0x0, 0xf, 0xfe,
-    0x0, 0x0, 0x0, 0x3f, 0xf8, 0x0, 0x0, 0x0,
-    0xff, 0xe0, 0x0, 0x0, 0x3, 0xff, 0x80, 0x0,
-    0x0, 0xf, 0xfe, 0x0, 0x0, 0x0, 0x3f, 0xf8,
-    0x1, 0xff, 0xe0, 0xff, 0xe0, 0xf, 0xff, 0x3,
-    0xff, 0x80, 0xbf, 0xf0, 0xf, 0xfe, 0x7, 0xff,
-    0x80, 0x3f, 0xf8, 0x3f, 0xfc, 0x0, 0xff, 0xe2,
-    0xff, 0xc0, 0x3, 0xff, 0x9f, 0xfd, 0x0, 0xf,
-    0xff, 0xff, 0xf0, 0x0, 0x3f, 0xff, 0xff, 0x0,
-    0x0, 0xff, 0xff, 0xfc, 0x0, 0x3, 0xff, 0xff,
-    0xfc, 0x0, 0xf, 0xff, 0xbf, 0xf8, 0x0, 0x3f,
-    0xf8, 0x7f, 0xf4, 0x0, 0xff, 0xe0, 0xbf, 0xf0,
-    0x3, 0xff, 0x80, 0xff, 0xe0, 0xf, 0xfe, 0x1,
-    0xff, 0xc0, 0x3f, 0xf8, 0x3, 0xff, 0xc0, 0xff,
-    0xe0, 0x3, 0xff, 0x43, 0xff, 0x80, 0xf, 0xfe,
-    0xf, 0xfe, 0x0, 0x1f, 0xfc,
-
-    /* U+006C "l" */
-    0x3f, 0xf8, 0x0, 0xff, 0xe0, 0x3, 0xff, 0x80,
-    0xf, 0xfe, 0x0, 0x3f, 0xf8, 0x0, 0xff, 0xe0,
-    0x3, 0xff, 0x80, 0xf, 0xfe, 0x0, 0x3f, 0xf8,
-    0x0, 0xff, 0xe0, 0x3, 0xff, 0x80, 0xf, 0xfe,
-    0x0, 0x3f, 0xf8, 0x0, 0xff, 0xe0, 0x3, 0xff,
-    0x80, 0xf, 0xfe, 0x0, 0x3f, 0xf8, 0x0, 0xff,
-    0xe0, 0x3, 0xff, 0x80, 0xf, 0xfe, 0x0, 0x3f,
-    0xf8, 0x0, 0xff, 0xf0, 0x3, 0xff, 0xd0, 0xf,
-    0xff, 0xfc, 0x1f, 0xff, 0xf0, 0x3f, 0xff, 0xc0,
-    0x3f, 0xff, 0x0, 0x1b, 0xfc,
-
-    /* U+006D "m" */
-    0x3f, 0xf8, 0x1b, 0xf9, 0x0, 0x7f, 0xe0, 0x3,
-    0xff, 0x9f, 0xff, 0xf8, 0xbf, 0xff, 0xd0, 0x3f,
-    0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0x3, 0xff,
-    0xff, 0xff, 0xff, 0xff, 0xff, 0xf8, 0x3f, 0xff,
-    0xeb, 0xff, 0xff, 0xaf, 0xff, 0xc3, 0xff, 0xd0,
-    0xf, 0xff, 0x40, 0x3f, 0xfc, 0x3f, 0xf8, 0x0,
-    0x7f, 0xf4, 0x2, 0xff, 0xc3, 0xff, 0x80, 0x7,
-    0xff, 0x40, 0x2f, 0xfc, 0x3f, 0xf8, 0x0, 0x7f,
-    0xf4, 0x2, 0xff, 0xc3, 0xff, 0x80, 0x7, 0xff,
-    0x40, 0x2f, 0xfc, 0x3f, 0xf8, 0x0, 0x7f, 0xf4,
-    0x2, 0xff, 0xc3, 0xff, 0x80, 0x7, 0xff, 0x40,
-    0x2f, 0xfc, 0x3f, 0xf8, 0x0, 0x7f, 0xf4, 0x2,
-    0xff, 0xc3, 0xff, 0x80, 0x7, 0xff, 0x40, 0x2f,
-    0xfc, 0x3f, 0xf8, 0x0, 0x7f, 0xf4, 0x2, 0xff,
-    0xc3, 0xff, 0x80, 0x7, 0xff, 0x40, 0x2f, 0xfc,
-    0x3f, 0xf8, 0x0, 0x7f, 0xf4, 0x2, 0xff, 0xc3,
-    0xff, 0x80, 0x7, 0xff, 0x40, 0x2f, 0xfc, 0x3f,
-    0xf8, 0x0, 0x7f, 0xf4, 0x2, 0xff, 0xc3, 0xff,
-    0x80, 0x7, 0xff, 0x40, 0x2f, 0xfc,
-
-    /* U+006E "n" */
-    0x3f, 0xf8, 0x1b, 0xfa, 0x0, 0x3f, 0xf8, 0xff,
-    0xff, 0xc0, 0x3f, 0xff, 0xff, 0xff, 0xf0, 0x3f,
-    0xff, 0xff, 0xff, 0xf8, 0x3f, 0xff, 0xe6, 0xff,
-    0xfc, 0x3f, 0xfe, 0x0, 0x7f, 0xfc, 0x3f, 0xf8,
-    0x0, 0x3f, 0xfc, 0x3f, 0xf8, 0x0, 0x2f, 0xfc,
-    0x3f, 0xf8, 0x0, 0x2f, 0xfc, 0x3f, 0xf8, 0x0,
-    0x2f, 0xfc, 0x3f, 0xf8, 0x0, 0x2f, 0xfc, 0x3f,
-    0xf8, 0x0, 0x2f, 0xfc, 0x3f, 0xf8, 0x0, 0x2f,
-    0xfc, 0x3f, 0xf8, 0x0, 0x2f, 0xfc, 0x3f, 0xf8,
-    0x0, 0x2f, 0xfc, 0x3f, 0xf8, 0x0, 0x2f, 0xfc,
-    0x3f, 0xf8, 0x0, 0x2f, 0xfc, 0x3f, 0xf8, 0x0,
-    0x2f, 0xfc, 0x3f, 0xf8, 0x0, 0x2f, 0xfc, 0x3f,
-    0xf8, 0x0, 0x2f, 0xfc,
-
-    /* U+006F "o" */
-    0x0, 0x6, 0xff, 0xe4, 0x0, 0x0, 0x2f, 0xff,
-    0xff, 0xd0, 0x0, 0x3f, 0xff, 0xff, 0xfe, 0x0,
-    0x3f, 0xff, 0xff, 0xff, 0xe0, 0x2f, 0xff, 0x91,
-    0xff, 0xfc, 0xf, 0xff, 0x40, 0xb, 0xff, 0x87,
-    0xff, 0x80, 0x0, 0xff, 0xf2, 0xff, 0xc0, 0x0,
-    0x2f, 0xfd, 0xff, 0xf0, 0x0, 0x7, 0xff, 0x7f,
-    0xfc, 0x0, 0x1, 0xff, 0xdf, 0xff, 0x0, 0x0,
-    0x7f, 0xf7, 0xff, 0xc0, 0x0, 0x1f, 0xfd, 0xbf,
-    0xf0, 0x0, 0xb, 0xff, 0x1f, 0xfe, 0x0, 0x3,
-    0xff, 0xc3, 0xff, 0xd0, 0x3, 0xff, 0xe0, 0x7f,
-    0xfe, 0x57, 0xff, 0xf0, 0xb, 0xff, 0xff, 0xff,
-    0xf4, 0x0, 0xff, 0xff, 0xff, 0xf4, 0x0, 0x7,
-    0xff, 0xff, 0xf0, 0x0, 0x0, 0x1b, 0xff, 0x90,
-    0x0,
-
-    /* U+0070 "p" */
-    0x3f, 0xf8, 0x2f, 0xf9, 0x0, 0xf, 0xfe, 0xbf,
-    0xff, 0xf0, 0x3, 0xff, 0xff, 0xff, 0xff, 0x0,
-    0xff, 0xff, 0xff, 0xff, 0xf0, 0x3f, 0xff, 0x91,
-    0xbf, 0xfe, 0xf, 0xff, 0x40, 0xb, 0xff, 0xc3,
-    0xff, 0x80, 0x0, 0xbf, 0xf4, 0xff, 0xe0, 0x0,
-    0xf, 0xfe, 0x3f, 0xf8, 0x0, 0x3, 0xff, 0xcf,
-    0xfe, 0x0, 0x0, 0xbf, 0xf3, 0xff, 0x80, 0x0,
-    0x2f, 0xfc, 0xff, 0xe0, 0x0, 0xf, 0xff, 0x3f,
-    0xf8, 0x0, 0x3, 0xff, 0x8f, 0xfe, 0x0, 0x2,
-    0xff, 0xd3, 0xff, 0xd0, 0x1, 0xff, 0xf0, 0xff,
-    0xfe, 0x46, 0xff, 0xf8, 0x3f, 0xff, 0xff, 0xff,
-    0xfc, 0xf, 0xff, 0xff, 0xff, 0xfc, 0x3, 0xff,
-    0xaf, 0xff, 0xfc, 0x0, 0xff, 0xe0, 0xbf, 0xe4,
-    0x0, 0x3f, 0xf8, 0x0, 0x0, 0x0, 0xf, 0xfe,
-    0x0, 0x0, 0x0, 0x7, 0xff, 0x40, 0x0, 0x0,
-    0x1, 0xff, 0xd0, 0x0, 0x0, 0x0, 0x7f, 0xf4,
-    0x0, 0x0, 0x0, 0x1f, 0xfc, 0x0, 0x0, 0x0,
-    0xb, 0xff, 0x0, 0x0, 0x0, 0x3, 0xff, 0xc0,
-    0x0, 0x0, 0x0,
-
-    /* U+0071 "q" */
-    0x0, 0x1b, 0xfe, 0xb, 0xff, 0x0, 0x3f, 0xff,
-    0xf6, 0xff, 0xc0, 0x3f, 0xff, 0xff, 0xff, 0xf0,
-    0x3f, 0xff, 0xff, 0xff, 0xfc, 0x2f, 0xff, 0x91,
-    0xbf, 0xff, 0xf, 0xff, 0x40, 0x7, 0xff, 0xc7,
-    0xff, 0x80, 0x0, 0xbf, 0xf2, 0xff, 0xc0, 0x0,
-    0x2f, 0xfc, 0xff, 0xf0, 0x0, 0xb, 0xff, 0x3f,
-    0xf8, 0x0, 0x2, 0xff, 0xcf, 0xfe, 0x0, 0x0,
-    0xbf, 0xf3, 0xff, 0xc0, 0x0, 0x2f, 0xfc, 0xbf,
-    0xf0, 0x0, 0xb, 0xff, 0x1f, 0xfe, 0x0, 0x2,
-    0xff, 0xc3, 0xff, 0xd0, 0x1, 0xff, 0xf0, 0xbf,
-    0xfe, 0x46, 0xff, 0xfc, 0xf, 0xff, 0xff, 0xff,
-    0xff, 0x1, 0xff, 0xff, 0xff, 0xff, 0xc0, 0xf,
-    0xff, 0xfe, 0xbf, 0xf0, 0x0, 0x6f, 0xf8, 0x2f,
-    0xfc, 0x0, 0x0, 0x0, 0xb, 0xff, 0x0, 0x0,
-    0x0, 0x2, 0xff, 0xc0, 0x0, 0x0, 0x0, 0x7f,
-    0xf0, 0x0, 0x0, 0x0, 0x1f, 0xfd, 0x0, 0x0,
-    0x0, 0x7, 0xff, 0x40, 0x0, 0x0, 0x1, 0xff,
-    0xd0, 0x0, 0x0, 0x0, 0x3f, 0xf8, 0x0, 0x0,
-    0x0, 0xf, 0xff,
-
-    /* U+0072 "r" */
-    0x3f, 0xf8, 0x2f, 0xc3, 0xff, 0xaf, 0xfc, 0x3f,
-    0xff, 0xff, 0xc3, 0xff, 0xff, 0xfc, 0x3f, 0xff,
-    0xe9, 0x83, 0xff, 0xe0, 0x0, 0x3f, 0xf8, 0x0,
-    0x3, 0xff, 0x80, 0x0, 0x3f, 0xf8, 0x0, 0x3,
-    0xff, 0x80, 0x0, 0x3f, 0xf8, 0x0, 0x3, 0xff,
-    0x80, 0x0, 0x3f, 0xf8, 0x0, 0x3, 0xff, 0x80,
-    0x0, 0x3f, 0xf8, 0x0, 0x3, 0xff, 0x80, 0x0,
-    0x3f, 0xf8, 0x0, 0x3, 0xff, 0x80, 0x0, 0x3f,
-    0xf8, 0x0, 0x3, 0xff, 0x80, 0x0,
-
-    /* U+0073 "s" */
-    0x0, 0x6f, 0xfe, 0x40, 0x7, 0xff, 0xff, 0xf0,
-    0x1f, 0xff, 0xff, 0xf0, 0x3f, 0xff, 0xff, 0xf0,
-    0x7f, 0xfd, 0x5b, 0xf0, 0xbf, 0xf0, 0x0, 0x20,
-    0xbf, 0xf0, 0x0, 0x0, 0x7f, 0xfe, 0x0, 0x0,
-    0x3f, 0xff, 0xf8, 0x0, 0xb, 0xff, 0xff, 0x80,
-    0x1, 0xff, 0xff, 0xf0, 0x0, 0x7, 0xff, 0xfc,
-    0x0, 0x0, 0x3f, 0xfc, 0x40, 0x0, 0x1f, 0xfd,
-    0xb9, 0x0, 0x2f, 0xfd, 0xbf, 0xea, 0xbf, 0xfc,
-    0xbf, 0xff, 0xff, 0xfc, 0xbf, 0xff, 0xff, 0xf0,
-    0x7f, 0xff, 0xff, 0xd0, 0x1, 0xaf, 0xf9, 0x0,
-
-    /* U+0074 "t" */
-    0x2, 0xff, 0x80, 0x0, 0xbf, 0xe0, 0x0, 0x2f,
-    0xf8, 0x0, 0xb, 0xfe, 0x0, 0x2, 0xff, 0x80,
-    0x1f, 0xff, 0xff, 0xd7, 0xff, 0xff, 0xf5, 0xff,
-    0xff, 0xfd, 0x7f, 0xff, 0xff, 0x45, 0xff, 0xf5,
-    0x40, 0x2f, 0xf8, 0x0, 0xb, 0xfe, 0x0, 0x2,
-    0xff, 0x80, 0x0, 0xbf, 0xe0, 0x0, 0x2f, 0xf8,
-    0x0, 0xb, 0xfe, 0x0, 0x2, 0xff, 0x80, 0x0,
-    0xbf, 0xe0, 0x0, 0x2f, 0xfc, 0x0, 0xb, 0xff,
-    0x0, 0x2, 0xff, 0xfa, 0x0, 0x7f, 0xff, 0xd0,
-    0xf, 0xff, 0xf4, 0x1, 0xff, 0xfd, 0x0, 0x1b,
-    0xff, 0x40,
-
-    /* U+0075 "u" */
-    0x3f, 0xf8, 0x0, 0x2f, 0xfc, 0x3f, 0xf8, 0x0,
-    0x2f, 0xfc, 0x3f, 0xf8, 0x0, 0x2f, 0xfc, 0x3f,
-    0xf8, 0x0, 0x2f, 0xfc, 0x3f, 0xf8, 0x0, 0x2f,
-    0xfc, 0x3f, 0xf8, 0x0, 0x2f, 0xfc, 0x3f, 0xf8,
-    0x0, 0x2f, 0xfc, 0x3f, 0xf8, 0x0, 0x2f, 0xfc,
-    0x3f, 0xf8, 0x0, 0x2f, 0xfc, 0x3f, 0xf8, 0x0,
-    0x2f, 0xfc, 0x3f, 0xf8, 0x0, 0x2f, 0xfc, 0x3f,
-    0xf8, 0x0, 0x2f, 0xfc, 0x3f, 0xf8, 0x0, 0x2f,
-    0xfc, 0x3f, 0xf8, 0x0, 0x3f, 0xfc, 0x3f, 0xfc,
-    0x0, 0xbf, 0xfc, 0x3f, 0xff, 0x9b, 0xff, 0xfc,
-    0x3f, 0xff, 0xff, 0xff, 0xfc, 0xf, 0xff, 0xff,
-    0xff, 0xfc, 0x7, 0xff, 0xff, 0xf, 0xfd, 0x0,
-    0xbf, 0xe0, 0xf, 0xfe,
-
-    /* U+0076 "v" */
-    0xbf, 0xf0, 0x0, 0x2, 0xff, 0xc7, 0xff, 0x40,
-    0x0, 0x3f, 0xfc, 0x3f, 0xf8, 0x0, 0x3, 0xff,
-    0x82, 0xff, 0xc0, 0x0, 0x7f, 0xf0, 0x1f, 0xfd,
-    0x0, 0xf, 0xff, 0x0, 0xff, 0xe0, 0x0, 0xff,
-    0xe0, 0xf, 0xff, 0x0, 0x1f, 0xfd, 0x0, 0xbf,
-    0xf0, 0x2, 0xff, 0xc0, 0x3, 0xff, 0x40, 0x3f,
-    0xf8, 0x0, 0x3f, 0xf8, 0x3, 0xff, 0x40, 0x2,
-    0xff, 0xc0, 0x7f, 0xf0, 0x0, 0x1f, 0xfd, 0xf,
-    0xff, 0x0, 0x0, 0xff, 0xe0, 0xff, 0xd0, 0x0,
-    0xb, 0xff, 0x1f, 0xfc, 0x0, 0x0, 0x7f, 0xf2,
-    0xff, 0xc0, 0x0, 0x3, 0xff, 0x7f, 0xf8, 0x0,
-    0x0, 0x2f, 0xff, 0xff, 0x0, 0x0, 0x1, 0xff,
-    0xff, 0xf0, 0x0, 0x0, 0xf, 0xff, 0xfe, 0x0,
-    0x0, 0x0, 0xff, 0xff, 0xd0, 0x0,
-
-    /* U+0077 "w" */
-    0x7f, 0xf4, 0x0, 0x3f, 0xf8, 0x0, 0x2f, 0xfc,
-    0x3f, 0xf8, 0x0, 0x3f, 0xfc, 0x0, 0x3f, 0xf8,
-    0x2f, 0xfc, 0x0, 0x7f, 0xfc, 0x0, 0x3f, 0xf4,
-    0x1f, 0xfc, 0x0, 0xbf, 0xfc, 0x0, 0x7f, 0xf0,
-    0xf, 0xfd, 0x0, 0xbf, 0xfd, 0x0, 0xbf, 0xf0,
-    0xf, 0xfe, 0x0, 0xff, 0xfe, 0x0, 0xff, 0xe0,
-    0xb, 0xff, 0x0, 0xff, 0xff, 0x0, 0xff, 0xd0,
-    0x7, 0xff, 0x1, 0xfe, 0xff, 0x1, 0xff, 0xc0,
-    0x3, 0xff, 0x2, 0xfd, 0xff, 0x42, 0xff, 0x80,
-    0x2, 0xff, 0x43, 0xfc, 0xbf, 0x83, 0xff, 0x40,
-    0x1, 0xff, 0x83, 0xfc, 0x7f, 0xc3, 0xff, 0x0,
-    0x0, 0xff, 0xc7, 0xfc, 0x3f, 0xc3, 0xff, 0x0,
-    0x0, 0xff, 0xcb, 0xf8, 0x3f, 0xc7, 0xfe, 0x0,
-    0x0, 0xbf, 0xdf, 0xf4, 0x2f, 0xdb, 0xfc, 0x0,
-    0x0, 0x7f, 0xef, 0xf0, 0x2f, 0xef, 0xfc, 0x0,
-    0x0, 0x3f, 0xff, 0xf0, 0x1f, 0xff, 0xf8, 0x0,
-    0x0, 0x2f, 0xff, 0xf0, 0xf, 0xff, 0xf4, 0x0,
-    0x0, 0x1f, 0xff, 0xe0, 0xf, 0xff, 0xf0, 0x0,
-    0x0, 0xf, 0xff, 0xd0, 0xb, 0xff, 0xf0, 0x0,
-    0x0, 0xf, 0xff, 0xc0, 0xb, 0xff, 0xe0, 0x0,
-
-    /* U+0078 "x" */
-    0x3f, 0xfc, 0x0, 0x3, 0xff, 0x81, 0xff, 0xe0,
-    0x0, 0xbf, 0xf0, 0xb, 0xff, 0x0, 0x1f, 0xfd,
-    0x0, 0x3f, 0xfc, 0x3, 0xff, 0x80, 0x0, 0xff,
-    0xd0, 0xbf, 0xf0, 0x0, 0x7, 0xff, 0x1f, 0xfd,
-    0x0, 0x0, 0x3f, 0xff, 0xff, 0x80, 0x0, 0x0,
-    0xff, 0xff, 0xf0, 0x0, 0x0, 0x7, 0xff, 0xfc,
-    0x0, 0x0, 0x0, 0x2f, 0xff, 0x80, 0x0, 0x0,
-    0x2, 0xff, 0xf4, 0x0, 0x0, 0x0, 0x7f, 0xff,
-    0xc0, 0x0, 0x0, 0xf, 0xff, 0xff, 0x0, 0x0,
-    0x2, 0xff, 0xff, 0xf4, 0x0, 0x0, 0x7f, 0xf5,
-    0xff, 0xc0, 0x0, 0xf, 0xfe, 0xf, 0xff, 0x0,
-    0x2, 0xff, 0xc0, 0x3f, 0xf8, 0x0, 0x7f, 0xf4,
-    0x2, 0xff, 0xc0, 0xf, 0xfe, 0x0, 0xf, 0xff,
-    0x3, 0xff, 0xc0, 0x0, 0x7f, 0xf8,
-
-    /* U+0079 "y" */
-    0xff, 0xf0, 0x0, 0x3, 0xff, 0xdf, 0xfd, 0x0,
-    0x1, 0xff, 0xd3, 0xff, 0xc0, 0x0, 0xff, 0xf0,
-    0xbf, 0xf0, 0x0, 0x3f, 0xfc, 0xf, 0xfe, 0x0,
-    0x1f, 0xfe, 0x3, 0xff, 0xc0, 0xb, 0xff, 0x0,
-    0x7f, 0xf4, 0x3, 0xff, 0xc0, 0xf, 0xfe, 0x0,
-    0xff, 0xe0, 0x2, 0xff, 0xc0, 0x7f, 0xf4, 0x0,
-    0x3f, 0xf4, 0x2f, 0xfc, 0x0, 0xb, 0xff, 0xf,
-    0xfe, 0x0, 0x1, 0xff, 0xc3, 0xff, 0x40, 0x0,
-    0x3f, 0xf9, 0xff, 0xc0, 0x0, 0xb, 0xff, 0xff,
-    0xf0, 0x0, 0x0, 0xff, 0xff, 0xf8, 0x0, 0x0,
-    0x2f, 0xff, 0xfc, 0x0, 0x0, 0x7, 0xff, 0xff,
-    0x0, 0x0, 0x0, 0x57, 0xff, 0x80, 0x0, 0x0,
-    0x0, 0xff, 0xd0, 0x0, 0x0, 0x0, 0x7f, 0xf0,
-    0x0, 0x0, 0x0, 0x3f, 0xf8, 0x0, 0x0, 0x0,
-    0x2f, 0xfc, 0x0, 0x0, 0x0, 0x7f, 0xfe, 0x0,
-    0x0, 0x2b, 0xff, 0xff, 0x0, 0x0, 0xf, 0xff,
-    0xff, 0x0, 0x0, 0x3, 0xff, 0xff, 0x0, 0x0,
-    0x0, 0xff, 0xfe, 0x0, 0x0, 0x0, 0x3f, 0xa4,
-    0x0, 0x0, 0x0,
-
-    /* U+007A "z" */
-    0x3f, 0xff, 0xff, 0xff, 0x4f, 0xff, 0xff, 0xff,
-    0xd3, 0xff, 0xff, 0xff, 0xf4, 0xff, 0xff, 0xff,
-    0xfd, 0x15, 0x55, 0x5f, 0xff, 0x40, 0x0, 0xf,
-    0xff, 0x40, 0x0, 0xb, 0xff, 0x80, 0x0, 0xb,
-    0xff, 0x80, 0x0, 0xb, 0xff, 0x80, 0x0, 0x7,
-    0xff, 0xc0, 0x0, 0x7, 0xff, 0xc0, 0x0, 0x3,
-    0xff, 0xc0, 0x0, 0x3, 0xff, 0xc0, 0x0, 0x3,
-    0xff, 0xd0, 0x0, 0x3, 0xff, 0xd0, 0x0, 0x2,
-    0xff, 0xf5, 0x55, 0x55, 0xff, 0xff, 0xff, 0xff,
-    0xbf, 0xff, 0xff, 0xff, 0xef, 0xff, 0xff, 0xff,
-    0xfb, 0xff, 0xff, 0xff, 0xfe,
-
-    /* U+007B "{" */
-    0x0, 0x1, 0x68, 0x0, 0x7f, 0xf0, 0xb, 0xff,
-    0xc0, 0x7f, 0xff, 0x3, 0xff, 0xfc, 0xf, 0xfe,
-    0x0, 0x3f, 0xf0, 0x0, 0xff, 0xc0, 0x3, 0xff,
-    0x0, 0xf, 0xfc, 0x0, 0x3f, 0xf0, 0x0, 0xff,
-    0xc0, 0x3, 0xff, 0x0, 0x1f, 0xfc, 0x0, 0x7f,
-    0xf0, 0x3, 0xff, 0x80, 0xff, 0xfc, 0x3, 0xff,
-    0x80, 0xf, 0xfe, 0x0, 0x2f, 0xff, 0x0, 0xb,
-    0xfe, 0x0, 0x1f, 0xfc, 0x0, 0x7f, 0xf0, 0x0,
-    0xff, 0xc0, 0x3, 0xff, 0x0, 0xf, 0xfc, 0x0,
-    0x3f, 0xf0, 0x0, 0xff, 0xc0, 0x3, 0xff, 0x0,
-    0xf, 0xfd, 0x0, 0x3f, 0xff, 0x80, 0xbf, 0xff,
-    0x0, 0xff, 0xfc, 0x0, 0xff, 0xf0, 0x0, 0x6f,
-    0xc0,
-
-    /* U+007C "|" */
-    0x2a, 0x83, 0xfd, 0x3f, 0xd3, 0xfd, 0x3f, 0xd3,
-    0xfd, 0x3f, 0xd3, 0xfd, 0x3f, 0xd3, 0xfd, 0x3f,
-    0xd3, 0xfd, 0x3f, 0xd3, 0xfd, 0x3f, 0xd3, 0xfd,
-    0x3f, 0xd3, 0xfd, 0x3f, 0xd3, 0xfd, 0x3f, 0xd3,
-    0xfd, 0x3f, 0xd3, 0xfd, 0x3f, 0xd3, 0xfd, 0x3f,
-    0xd3, 0xfd, 0x3f, 0xd3, 0xfd, 0x3f, 0xd3, 0xfd,
-    0x3f, 0xd3, 0xfd, 0x3f, 0xd0,
-
-    /* U+007D "}" */
-    0x29, 0x0, 0x0, 0x3f, 0xf0, 0x0, 0x3f, 0xfd,
-    0x0, 0x3f, 0xff, 0x0, 0x3f, 0xff, 0x40, 0x7,
-    0xff, 0x80, 0x2, 0xff, 0x80, 0x1, 0xff, 0xc0,
-    0x1, 0xff, 0xc0, 0x1, 0xff, 0xc0, 0x1, 0xff,
-    0xc0, 0x1, 0xff, 0xc0, 0x1, 0xff, 0xc0, 0x1,
-    0xff, 0xc0, 0x1, 0xff, 0xc0, 0x0, 0xff, 0xe0,
-    0x0, 0x7f, 0xfd, 0x0, 0x1b, 0xfd, 0x0, 0x2f,
-    0xfd, 0x0, 0xbf, 0xfd, 0x0, 0xff, 0xd0, 0x1,
-    0xff, 0xc0, 0x1, 0xff, 0xc0, 0x1, 0xff, 0xc0,
-    0x1, 0xff, 0xc0, 0x1, 0xff, 0xc0, 0x1, 0xff,
-    0xc0, 0x1, 0xff, 0xc0, 0x1, 0xff, 0xc0, 0x3,
-    0xff, 0x80, 0x2f, 0xff, 0x40, 0x3f, 0xff, 0x0,
-    0x3f, 0xfe, 0x0, 0x3f, 0xf8, 0x0, 0x3f, 0x80,
-    0x0,
-
-    /* U+007E "~" */
-    0x1, 0xa5, 0x0, 0x0, 0x0, 0xff, 0xff, 0x40,
-    0x0, 0x1f, 0xff, 0xff, 0xd0, 0x7, 0xff, 0xff,
-    0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
-    0xe0, 0x1b, 0xff, 0xff, 0xf8, 0x0, 0x7, 0xff,
-    0xff, 0x40, 0x0, 0x1, 0xbf, 0x90
+    0x1, 0xff, 0xfc, 0x0, 0x0
 };
 
 
@@ -1543,114 +278,50 @@ static LV_ATTRIBUTE_LARGE_CONST const uint8_t glyph_bitmap[] = {
 static const lv_font_fmt_txt_glyph_dsc_t glyph_dsc[] = {
     {.bitmap_index = 0, .adv_w = 0, .box_w = 0, .box_h = 0, .ofs_x = 0, .ofs_y = 0} /* id = 0 reserved */,
     {.bitmap_index = 0, .adv_w = 150, .box_w = 0, .box_h = 0, .ofs_x = 0, .ofs_y = 0},
-    {.bitmap_index = 0, .adv_w = 214, .box_w = 7, .box_h = 25, .ofs_x = 3, .ofs_y = 0},
-    {.bitmap_index = 44, .adv_w = 240, .box_w = 13, .box_h = 11, .ofs_x = 1, .ofs_y = 18},
-    {.bitmap_index = 80, .adv_w = 346, .box_w = 22, .box_h = 25, .ofs_x = 0, .ofs_y = 0},
-    {.bitmap_index = 218, .adv_w = 340, .box_w = 19, .box_h = 34, .ofs_x = 1, .ofs_y = -5},
-    {.bitmap_index = 380, .adv_w = 479, .box_w = 26, .box_h = 25, .ofs_x = 2, .ofs_y = 0},
-    {.bitmap_index = 543, .adv_w = 380, .box_w = 24, .box_h = 25, .ofs_x = 0, .ofs_y = 0},
-    {.bitmap_index = 693, .adv_w = 132, .box_w = 6, .box_h = 11, .ofs_x = 1, .ofs_y = 18},
-    {.bitmap_index = 710, .adv_w = 228, .box_w = 12, .box_h = 35, .ofs_x = 2, .ofs_y = -5},
-    {.bitmap_index = 815, .adv_w = 228, .box_w = 11, .box_h = 35, .ofs_x = 1, .ofs_y = -5},
-    {.bitmap_index = 912, .adv_w = 266, .box_w = 15, .box_h = 14, .ofs_x = 1, .ofs_y = 14},
-    {.bitmap_index = 965, .adv_w = 334, .box_w = 19, .box_h = 19, .ofs_x = 1, .ofs_y = 3},
-    {.bitmap_index = 1056, .adv_w = 190, .box_w = 9, .box_h = 11, .ofs_x = 1, .ofs_y = -5},
-    {.bitmap_index = 1081, .adv_w = 253, .box_w = 12, .box_h = 5, .ofs_x = 2, .ofs_y = 9},
-    {.bitmap_index = 1096, .adv_w = 190, .box_w = 7, .box_h = 6, .ofs_x = 2, .ofs_y = 0},
-    {.bitmap_index = 1107, .adv_w = 289, .box_w = 14, .box_h = 28, .ofs_x = 2, .ofs_y = -1},
-    {.bitmap_index = 1205, .adv_w = 340, .box_w = 19, .box_h = 25, .ofs_x = 1, .ofs_y = 0},
-    {.bitmap_index = 1324, .adv_w = 242, .box_w = 11, .box_h = 25, .ofs_x = 1, .ofs_y = 0},
-    {.bitmap_index = 1393, .adv_w = 340, .box_w = 19, .box_h = 25, .ofs_x = 1, .ofs_y = 0},
-    {.bitmap_index = 1512, .adv_w = 340, .box_w = 18, .box_h = 25, .ofs_x = 2, .ofs_y = 0},
-    {.bitmap_index = 1625, .adv_w = 340, .box_w = 19, .box_h = 25, .ofs_x = 1, .ofs_y = 0},
-    {.bitmap_index = 1744, .adv_w = 340, .box_w = 18, .box_h = 25, .ofs_x = 2, .ofs_y = 0},
-    {.bitmap_index = 1857, .adv_w = 340, .box_w = 19, .box_h = 25, .ofs_x = 1, .ofs_y = 0},
-    {.bitmap_index = 1976, .adv_w = 317, .box_w = 19, .box_h = 25, .ofs_x = 1, .ofs_y = 0},
-    {.bitmap_index = 2095, .adv_w = 340, .box_w = 19, .box_h = 25, .ofs_x = 1, .ofs_y = 0},
-    {.bitmap_index = 2214, .adv_w = 340, .box_w = 19, .box_h = 25, .ofs_x = 1, .ofs_y = 0},
-    {.bitmap_index = 2333, .adv_w = 233, .box_w = 7, .box_h = 20, .ofs_x = 4, .ofs_y = 0},
-    {.bitmap_index = 2368, .adv_w = 233, .box_w = 10, .box_h = 24, .ofs_x = 1, .ofs_y = -4},
-    {.bitmap_index = 2428, .adv_w = 334, .box_w = 19, .box_h = 22, .ofs_x = 1, .ofs_y = 1},
-    {.bitmap_index = 2533, .adv_w = 334, .box_w = 19, .box_h = 14, .ofs_x = 1, .ofs_y = 5},
-    {.bitmap_index = 2600, .adv_w = 334, .box_w = 19, .box_h = 22, .ofs_x = 1, .ofs_y = 1},
-    {.bitmap_index = 2705, .adv_w = 259, .box_w = 15, .box_h = 25, .ofs_x = 1, .ofs_y = 0},
-    {.bitmap_index = 2799, .adv_w = 492, .box_w = 29, .box_h = 30, .ofs_x = 1, .ofs_y = -5},
-    {.bitmap_index = 3017, .adv_w = 418, .box_w = 26, .box_h = 25, .ofs_x = 0, .ofs_y = 0},
-    {.bitmap_index = 3180, .adv_w = 388, .box_w = 21, .box_h = 25, .ofs_x = 2, .ofs_y = 0},
-    {.bitmap_index = 3312, .adv_w = 394, .box_w = 22, .box_h = 25, .ofs_x = 1, .ofs_y = 0},
-    {.bitmap_index = 3450, .adv_w = 405, .box_w = 22, .box_h = 25, .ofs_x = 2, .ofs_y = 0},
-    {.bitmap_index = 3588, .adv_w = 335, .box_w = 18, .box_h = 25, .ofs_x = 2, .ofs_y = 0},
-    {.bitmap_index = 3701, .adv_w = 319, .box_w = 17, .box_h = 25, .ofs_x = 2, .ofs_y = 0},
-    {.bitmap_index = 3808, .adv_w = 406, .box_w = 23, .box_h = 25, .ofs_x = 1, .ofs_y = 0},
-    {.bitmap_index = 3952, .adv_w = 414, .box_w = 22, .box_h = 25, .ofs_x = 2, .ofs_y = 0},
-    {.bitmap_index = 4090, .adv_w = 168, .box_w = 7, .box_h = 25, .ofs_x = 2, .ofs_y = 0},
-    {.bitmap_index = 4134, .adv_w = 190, .box_w = 11, .box_h = 31, .ofs_x = -1, .ofs_y = -6},
-    {.bitmap_index = 4220, .adv_w = 388, .box_w = 23, .box_h = 25, .ofs_x = 2, .ofs_y = 0},
-    {.bitmap_index = 4364, .adv_w = 301, .box_w = 17, .box_h = 25, .ofs_x = 2, .ofs_y = 0},
-    {.bitmap_index = 4471, .adv_w = 511, .box_w = 28, .box_h = 25, .ofs_x = 2, .ofs_y = 0},
-    {.bitmap_index = 4646, .adv_w = 418, .box_w = 22, .box_h = 25, .ofs_x = 2, .ofs_y = 0},
-    {.bitmap_index = 4784, .adv_w = 457, .box_w = 27, .box_h = 25, .ofs_x = 1, .ofs_y = 0},
-    {.bitmap_index = 4953, .adv_w = 381, .box_w = 21, .box_h = 25, .ofs_x = 2, .ofs_y = 0},
-    {.bitmap_index = 5085, .adv_w = 461, .box_w = 27, .box_h = 28, .ofs_x = 1, .ofs_y = -3},
-    {.bitmap_index = 5274, .adv_w = 380, .box_w = 22, .box_h = 25, .ofs_x = 2, .ofs_y = 0},
-    {.bitmap_index = 5412, .adv_w = 327, .box_w = 19, .box_h = 25, .ofs_x = 1, .ofs_y = 0},
-    {.bitmap_index = 5531, .adv_w = 323, .box_w = 20, .box_h = 25, .ofs_x = 0, .ofs_y = 0},
-    {.bitmap_index = 5656, .adv_w = 423, .box_w = 23, .box_h = 25, .ofs_x = 2, .ofs_y = 0},
-    {.bitmap_index = 5800, .adv_w = 414, .box_w = 26, .box_h = 25, .ofs_x = 0, .ofs_y = 0},
-    {.bitmap_index = 5963, .adv_w = 537, .box_w = 34, .box_h = 25, .ofs_x = 0, .ofs_y = 0},
-    {.bitmap_index = 6176, .adv_w = 420, .box_w = 26, .box_h = 25, .ofs_x = 0, .ofs_y = 0},
-    {.bitmap_index = 6339, .adv_w = 373, .box_w = 23, .box_h = 25, .ofs_x = 0, .ofs_y = 0},
-    {.bitmap_index = 6483, .adv_w = 376, .box_w = 22, .box_h = 25, .ofs_x = 1, .ofs_y = 0},
-    {.bitmap_index = 6621, .adv_w = 191, .box_w = 10, .box_h = 35, .ofs_x = 2, .ofs_y = -5},
-    {.bitmap_index = 6709, .adv_w = 291, .box_w = 18, .box_h = 31, .ofs_x = 0, .ofs_y = -3},
-    {.bitmap_index = 6849, .adv_w = 191, .box_w = 10, .box_h = 35, .ofs_x = 0, .ofs_y = -5},
-    {.bitmap_index = 6937, .adv_w = 334, .box_w = 17, .box_h = 14, .ofs_x = 2, .ofs_y = 12},
-    {.bitmap_index = 6997, .adv_w = 288, .box_w = 18, .box_h = 4, .ofs_x = 0, .ofs_y = -7},
-    {.bitmap_index = 7015, .adv_w = 249, .box_w = 10, .box_h = 6, .ofs_x = 2, .ofs_y = 24},
-    {.bitmap_index = 7030, .adv_w = 357, .box_w = 21, .box_h = 20, .ofs_x = 1, .ofs_y = 0},
-    {.bitmap_index = 7135, .adv_w = 357, .box_w = 21, .box_h = 28, .ofs_x = 1, .ofs_y = 0},
-    {.bitmap_index = 7282, .adv_w = 305, .box_w = 17, .box_h = 20, .ofs_x = 1, .ofs_y = 0},
-    {.bitmap_index = 7367, .adv_w = 357, .box_w = 21, .box_h = 28, .ofs_x = 1, .ofs_y = 0},
-    {.bitmap_index = 7514, .adv_w = 350, .box_w = 20, .box_h = 20, .ofs_x = 1, .ofs_y = 0},
-    {.bitmap_index = 7614, .adv_w = 230, .box_w = 15, .box_h = 28, .ofs_x = 0, .ofs_y = 0},
-    {.bitmap_index = 7719, .adv_w = 353, .box_w = 20, .box_h = 28, .ofs_x = 1, .ofs_y = -8},
-    {.bitmap_index = 7859, .adv_w = 344, .box_w = 19, .box_h = 28, .ofs_x = 1, .ofs_y = 0},
-    {.bitmap_index = 7992, .adv_w = 165, .box_w = 7, .box_h = 28, .ofs_x = 2, .ofs_y = 0},
-    {.bitmap_index = 8041, .adv_w = 183, .box_w = 11, .box_h = 36, .ofs_x = -1, .ofs_y = -8},
-    {.bitmap_index = 8140, .adv_w = 316, .box_w = 19, .box_h = 28, .ofs_x = 1, .ofs_y = 0},
-    {.bitmap_index = 8273, .adv_w = 183, .box_w = 11, .box_h = 28, .ofs_x = 1, .ofs_y = 0},
-    {.bitmap_index = 8350, .adv_w = 511, .box_w = 30, .box_h = 20, .ofs_x = 1, .ofs_y = 0},
-    {.bitmap_index = 8500, .adv_w = 350, .box_w = 20, .box_h = 20, .ofs_x = 1, .ofs_y = 0},
-    {.bitmap_index = 8600, .adv_w = 361, .box_w = 21, .box_h = 20, .ofs_x = 1, .ofs_y = 0},
-    {.bitmap_index = 8705, .adv_w = 365, .box_w = 21, .box_h = 28, .ofs_x = 1, .ofs_y = -8},
-    {.bitmap_index = 8852, .adv_w = 367, .box_w = 21, .box_h = 28, .ofs_x = 1, .ofs_y = -8},
-    {.bitmap_index = 8999, .adv_w = 235, .box_w = 14, .box_h = 20, .ofs_x = 1, .ofs_y = 0},
-    {.bitmap_index = 9069, .adv_w = 276, .box_w = 16, .box_h = 20, .ofs_x = 1, .ofs_y = 0},
-    {.bitmap_index = 9149, .adv_w = 211, .box_w = 13, .box_h = 25, .ofs_x = 0, .ofs_y = 0},
-    {.bitmap_index = 9231, .adv_w = 349, .box_w = 20, .box_h = 20, .ofs_x = 1, .ofs_y = 0},
-    {.bitmap_index = 9331, .adv_w = 344, .box_w = 22, .box_h = 20, .ofs_x = 0, .ofs_y = 0},
-    {.bitmap_index = 9441, .adv_w = 507, .box_w = 32, .box_h = 20, .ofs_x = 0, .ofs_y = 0},
-    {.bitmap_index = 9601, .adv_w = 349, .box_w = 22, .box_h = 20, .ofs_x = 0, .ofs_y = 0},
-    {.bitmap_index = 9711, .adv_w = 335, .box_w = 21, .box_h = 28, .ofs_x = 0, .ofs_y = -8},
-    {.bitmap_index = 9858, .adv_w = 297, .box_w = 17, .box_h = 20, .ofs_x = 1, .ofs_y = 0},
-    {.bitmap_index = 9943, .adv_w = 201, .box_w = 11, .box_h = 35, .ofs_x = 1, .ofs_y = -5},
-    {.bitmap_index = 10040, .adv_w = 129, .box_w = 6, .box_h = 35, .ofs_x = 1, .ofs_y = -5},
-    {.bitmap_index = 10093, .adv_w = 201, .box_w = 12, .box_h = 35, .ofs_x = 0, .ofs_y = -5},
-    {.bitmap_index = 10198, .adv_w = 334, .box_w = 19, .box_h = 8, .ofs_x = 1, .ofs_y = 8}
+    {.bitmap_index = 0, .adv_w = 253, .box_w = 12, .box_h = 5, .ofs_x = 2, .ofs_y = 9},
+    {.bitmap_index = 15, .adv_w = 190, .box_w = 7, .box_h = 6, .ofs_x = 2, .ofs_y = 0},
+    {.bitmap_index = 26, .adv_w = 340, .box_w = 19, .box_h = 25, .ofs_x = 1, .ofs_y = 0},
+    {.bitmap_index = 145, .adv_w = 242, .box_w = 11, .box_h = 25, .ofs_x = 1, .ofs_y = 0},
+    {.bitmap_index = 214, .adv_w = 340, .box_w = 19, .box_h = 25, .ofs_x = 1, .ofs_y = 0},
+    {.bitmap_index = 333, .adv_w = 340, .box_w = 18, .box_h = 25, .ofs_x = 2, .ofs_y = 0},
+    {.bitmap_index = 446, .adv_w = 340, .box_w = 19, .box_h = 25, .ofs_x = 1, .ofs_y = 0},
+    {.bitmap_index = 565, .adv_w = 340, .box_w = 18, .box_h = 25, .ofs_x = 2, .ofs_y = 0},
+    {.bitmap_index = 678, .adv_w = 340, .box_w = 19, .box_h = 25, .ofs_x = 1, .ofs_y = 0},
+    {.bitmap_index = 797, .adv_w = 317, .box_w = 19, .box_h = 25, .ofs_x = 1, .ofs_y = 0},
+    {.bitmap_index = 916, .adv_w = 340, .box_w = 19, .box_h = 25, .ofs_x = 1, .ofs_y = 0},
+    {.bitmap_index = 1035, .adv_w = 340, .box_w = 19, .box_h = 25, .ofs_x = 1, .ofs_y = 0},
+    {.bitmap_index = 1154, .adv_w = 418, .box_w = 26, .box_h = 25, .ofs_x = 0, .ofs_y = 0},
+    {.bitmap_index = 1317, .adv_w = 414, .box_w = 26, .box_h = 25, .ofs_x = 0, .ofs_y = 0},
+    {.bitmap_index = 1480, .adv_w = 537, .box_w = 34, .box_h = 25, .ofs_x = 0, .ofs_y = 0}
 };
 
 /*---------------------
  *  CHARACTER MAPPING
  *--------------------*/
 
+static const uint16_t unicode_list_0[] = {
+    0x0, 0xd, 0xe
+};
+
+static const uint16_t unicode_list_2[] = {
+    0x0, 0x15, 0x16
+};
 
 
 /*Collect the unicode lists and glyph_id offsets*/
 static const lv_font_fmt_txt_cmap_t cmaps[] =
 {
     {
-        .range_start = 32, .range_length = 95, .glyph_id_start = 1,
+        .range_start = 32, .range_length = 15, .glyph_id_start = 1,
+        .unicode_list = unicode_list_0, .glyph_id_ofs_list = NULL, .list_length = 3, .type = LV_FONT_FMT_TXT_CMAP_SPARSE_TINY
+    },
+    {
+        .range_start = 48, .range_length = 10, .glyph_id_start = 4,
         .unicode_list = NULL, .glyph_id_ofs_list = NULL, .list_length = 0, .type = LV_FONT_FMT_TXT_CMAP_FORMAT0_TINY
+    },
+    {
+        .range_start = 65, .range_length = 23, .glyph_id_start = 14,
+        .unicode_list = unicode_list_2, .glyph_id_ofs_list = NULL, .list_length = 3, .type = LV_FONT_FMT_TXT_CMAP_SPARSE_TINY
     }
 };
 
@@ -1662,305 +333,24 @@ static const lv_font_fmt_txt_cmap_t cmaps[] =
 /*Pair left and right glyphs for kerning*/
 static const uint8_t kern_pair_glyph_ids[] =
 {
-    7, 43,
-    9, 75,
-    19, 21,
-    19, 23,
-    19, 26,
-    21, 26,
-    34, 43,
-    34, 53,
-    34, 55,
-    34, 56,
-    34, 58,
-    34, 66,
-    34, 68,
-    34, 70,
-    34, 72,
-    34, 80,
-    34, 82,
-    36, 43,
-    37, 43,
-    37, 53,
-    37, 55,
-    37, 56,
-    37, 57,
-    37, 58,
-    37, 59,
-    38, 43,
-    39, 15,
-    39, 34,
-    39, 66,
-    39, 68,
-    39, 70,
-    39, 72,
-    39, 80,
-    39, 82,
-    40, 43,
-    41, 43,
-    42, 43,
-    44, 43,
-    44, 48,
-    44, 66,
-    44, 68,
-    44, 70,
-    44, 72,
-    44, 80,
-    44, 82,
-    45, 34,
-    45, 43,
-    45, 48,
-    45, 53,
-    45, 55,
-    45, 56,
-    45, 58,
-    46, 43,
-    47, 43,
-    48, 43,
-    48, 53,
-    48, 55,
-    48, 56,
-    48, 57,
-    48, 58,
-    48, 59,
-    49, 15,
-    49, 34,
-    49, 57,
-    50, 43,
-    50, 53,
-    50, 55,
-    50, 56,
-    50, 57,
-    50, 58,
-    50, 59,
-    51, 43,
-    51, 58,
-    51, 66,
-    51, 68,
-    51, 70,
-    51, 72,
-    51, 80,
-    51, 82,
-    53, 15,
-    53, 34,
-    53, 40,
-    53, 48,
-    53, 50,
-    53, 66,
-    53, 68,
-    53, 70,
-    53, 72,
-    53, 75,
-    53, 78,
-    53, 79,
-    53, 80,
-    53, 81,
-    53, 82,
-    53, 83,
-    53, 84,
-    53, 86,
-    55, 15,
-    55, 34,
-    55, 40,
-    55, 48,
-    55, 50,
-    55, 66,
-    55, 68,
-    55, 70,
-    55, 72,
-    55, 75,
-    55, 78,
-    55, 79,
-    55, 80,
-    55, 81,
-    55, 82,
-    55, 83,
-    55, 84,
-    55, 86,
-    56, 15,
-    56, 34,
-    56, 40,
-    56, 48,
-    56, 50,
-    56, 66,
-    56, 68,
-    56, 70,
-    56, 72,
-    56, 75,
-    56, 78,
-    56, 79,
-    56, 80,
-    56, 81,
-    56, 82,
-    56, 83,
-    56, 84,
-    56, 86,
-    57, 15,
-    57, 40,
-    57, 43,
-    57, 48,
-    57, 50,
-    57, 66,
-    57, 68,
-    57, 70,
-    57, 72,
-    57, 80,
-    57, 82,
-    57, 84,
-    58, 15,
-    58, 34,
-    58, 40,
-    58, 48,
-    58, 50,
-    58, 66,
-    58, 68,
-    58, 69,
-    58, 70,
-    58, 72,
-    58, 75,
-    58, 78,
-    58, 79,
-    58, 80,
-    58, 81,
-    58, 82,
-    58, 83,
-    58, 84,
-    58, 85,
-    58, 86,
-    59, 40,
-    59, 43,
-    59, 48,
-    59, 50,
-    60, 43,
-    60, 75,
-    61, 43,
-    61, 75,
-    66, 43,
-    67, 53,
-    67, 55,
-    67, 56,
-    67, 57,
-    67, 58,
-    67, 87,
-    67, 88,
-    67, 89,
-    67, 90,
-    68, 43,
-    69, 43,
-    70, 53,
-    70, 55,
-    70, 56,
-    70, 57,
-    70, 58,
-    70, 87,
-    70, 88,
-    70, 89,
-    70, 90,
-    72, 43,
-    76, 43,
-    76, 66,
-    76, 68,
-    76, 70,
-    76, 72,
-    76, 80,
-    76, 82,
-    77, 43,
-    79, 43,
-    80, 43,
-    80, 53,
-    80, 55,
-    80, 56,
-    80, 57,
-    80, 58,
-    80, 87,
-    80, 88,
-    80, 89,
-    80, 90,
-    81, 53,
-    81, 55,
-    81, 56,
-    81, 57,
-    81, 58,
-    81, 87,
-    81, 88,
-    81, 89,
-    81, 90,
-    82, 43,
-    82, 75,
-    83, 66,
-    83, 68,
-    83, 70,
-    83, 72,
-    83, 80,
-    83, 82,
-    84, 53,
-    84, 55,
-    84, 56,
-    84, 57,
-    84, 58,
-    85, 43,
-    86, 43,
-    88, 66,
-    88, 68,
-    88, 70,
-    88, 72,
-    88, 80,
-    88, 82,
-    89, 43,
-    89, 66,
-    89, 68,
-    89, 70,
-    89, 72,
-    89, 80,
-    89, 82,
-    90, 66,
-    90, 68,
-    90, 70,
-    90, 72,
-    90, 80,
-    90, 82,
-    91, 43,
-    92, 43,
-    92, 75
+    6, 8,
+    6, 10,
+    6, 13,
+    8, 13,
+    14, 15,
+    14, 16,
+    15, 3,
+    15, 14,
+    16, 3,
+    16, 14
 };
 
 /* Kerning between the respective left and right glyphs
  * 4.4 format which needs to scaled with `kern_scale`*/
 static const int8_t kern_pair_values[] =
 {
-    29, 23, -12, -12, -12, -6, 12, -35,
-    -40, -29, -35, -12, -12, -12, -12, -12,
-    -12, 12, -12, -12, -6, -6, -17, -17,
-    -6, 12, -58, -23, -12, -12, -12, -12,
-    -12, -12, 12, 12, 12, 17, -23, -23,
-    -23, -23, -23, -23, -23, 6, 17, -12,
-    -58, -40, -29, -58, 12, 12, -12, -12,
-    -6, -6, -17, -17, -6, -63, -17, -12,
-    -12, -12, -6, -6, -17, -17, -6, 17,
-    -6, -6, -6, -6, -6, -6, -6, -69,
-    -35, -12, -12, -12, -35, -35, -35, -35,
-    -23, -23, -23, -35, -23, -35, -23, -29,
-    -23, -46, -40, -6, -6, -6, -23, -23,
-    -23, -17, -17, -12, -12, -23, -12, -23,
-    -12, -12, -12, -35, -29, -6, -6, -6,
-    -17, -17, -17, -17, -17, -12, -12, -17,
-    -12, -17, -12, -12, -12, -12, -17, 17,
-    -17, -17, -23, -23, -23, -23, -23, -23,
-    -17, -58, -35, -17, -17, -17, -52, -52,
-    -52, -52, -52, -23, -23, -23, -52, -23,
-    -52, -23, -40, -23, -23, -6, 17, -6,
-    -6, 29, 23, 29, 23, 12, -35, -17,
-    -17, -23, -52, -12, -6, -12, -12, 12,
-    12, -35, -17, -17, -23, -52, -12, -6,
-    -12, -12, 12, 12, -12, -12, -12, -12,
-    -12, -12, 17, 6, -12, -35, -23, -17,
-    -23, -52, -12, -6, -12, -12, -35, -17,
-    -17, -23, -52, -12, -6, -12, -12, 12,
-    23, -12, -12, -12, -12, -12, -12, -29,
-    -12, -12, -17, -40, 12, 6, -6, -6,
-    -6, -6, -6, -6, 12, -6, -6, -6,
-    -6, -6, -6, -6, -6, -6, -6, -6,
-    -6, 12, 29, 23
+    -12, -12, -12, -6, -40, -29, -46, -40,
+    -35, -29
 };
 
 /*Collect the kern pair's data in one place*/
@@ -1968,7 +358,7 @@ static const lv_font_fmt_txt_kern_pair_t kern_pairs =
 {
     .glyph_ids = kern_pair_glyph_ids,
     .values = kern_pair_values,
-    .pair_cnt = 260,
+    .pair_cnt = 10,
     .glyph_ids_size = 0
 };
 
@@ -1991,7 +381,7 @@ static lv_font_fmt_txt_dsc_t font_dsc = {
     .cmaps = cmaps,
     .kern_dsc = &kern_pairs,
     .kern_scale = 16,
-    .cmap_num = 1,
+    .cmap_num = 3,
     .bpp = 2,
     .kern_classes = 0,
     .bitmap_format = 0,
@@ -2,6 +2,7 @@
  * Size: 72 px
  * Bpp: 2
  * Opts: --bpp 2 --size 72 --font C:/Users/north/Documents/nainiu_ui/assets/AlimamaShuHeiTi-Bold.otf -o C:/Users/north/Documents/nainiu_ui/assets\ui2_font_ShuHei72.c --format lvgl -r 0x20-0x7f --no-compress --no-prefilter
+ * Subset: 15/95 glyphs (font_subsetter.py)
  ******************************************************************************/
 
 #include "ui2.h"
@@ -20,564 +21,6 @@
 static LV_ATTRIBUTE_LARGE_CONST const uint8_t glyph_bitmap[] = {
     /* U+0020 " " */
 
-    /* U+0021 "!" */
-    0x7f, 0xff, 0xff, 0x1f, 0xff, 0xff, 0xc7, 0xff,
-    0xff, 0xf1, 0xff, 0xff, 0xfc, 0x7f, 0xff, 0xff,
-    0xf, 0xff, 0xff, 0xc3, 0xff, 0xff, 0xf0, 0xff,
-    0xff, 0xfc, 0x3f, 0xff, 0xfe, 0xf, 0xff, 0xff,
-    0x83, 0xff, 0xff, 0xe0, 0xff, 0xff, 0xf8, 0x3f,
-    0xff, 0xfe, 0xf, 0xff, 0xff, 0x83, 0xff, 0xff,
-    0xe0, 0xff, 0xff, 0xf4, 0x3f, 0xff, 0xfd, 0xb,
-    0xff, 0xff, 0x42, 0xff, 0xff, 0xd0, 0xbf, 0xff,
-    0xf4, 0x2f, 0xff, 0xfd, 0xb, 0xff, 0xff, 0x2,
-    0xff, 0xff, 0xc0, 0xbf, 0xff, 0xf0, 0x1f, 0xff,
-    0xfc, 0x7, 0xff, 0xff, 0x1, 0xff, 0xff, 0xc0,
-    0x7f, 0xff, 0xf0, 0x1f, 0xff, 0xfc, 0x7, 0xff,
-    0xff, 0x0, 0xff, 0xff, 0xc0, 0x3f, 0xff, 0xf0,
-    0xf, 0xff, 0xfc, 0x3, 0xff, 0xfe, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x1, 0xff,
-    0xff, 0xfd, 0xbf, 0xff, 0xff, 0x6f, 0xff, 0xff,
-    0xdb, 0xff, 0xff, 0xf6, 0xff, 0xff, 0xfd, 0xbf,
-    0xff, 0xff, 0x6f, 0xff, 0xff, 0xdb, 0xff, 0xff,
-    0xf6, 0xff, 0xff, 0xfd, 0xbf, 0xff, 0xff, 0x6f,
-    0xff, 0xff, 0xdb, 0xff, 0xff, 0xf4,
-
-    /* U+0022 "\"" */
-    0x55, 0x55, 0x50, 0x5, 0x55, 0x55, 0xbf, 0xff,
-    0xf0, 0x1f, 0xff, 0xfe, 0xbf, 0xff, 0xf0, 0x1f,
-    0xff, 0xfe, 0xbf, 0xff, 0xf0, 0xf, 0xff, 0xfe,
-    0x7f, 0xff, 0xf0, 0xf, 0xff, 0xfd, 0x7f, 0xff,
-    0xf0, 0xf, 0xff, 0xfd, 0x7f, 0xff, 0xf0, 0xf,
-    0xff, 0xfd, 0x3f, 0xff, 0xe0, 0xf, 0xff, 0xfc,
-    0x3f, 0xff, 0xe0, 0xb, 0xff, 0xfc, 0x3f, 0xff,
-    0xe0, 0xb, 0xff, 0xfc, 0x3f, 0xff, 0xd0, 0xb,
-    0xff, 0xfc, 0x3f, 0xff, 0xd0, 0x7, 0xff, 0xfc,
-    0x3f, 0xff, 0xd0, 0x7, 0xff, 0xf8, 0x2f, 0xff,
-    0xc0, 0x7, 0xff, 0xf8, 0x2f, 0xff, 0xc0, 0x3,
-    0xff, 0xf8, 0x1f, 0xff, 0xc0, 0x3, 0xff, 0xf4,
-    0x1f, 0xff, 0xc0, 0x3, 0xff, 0xf4, 0x1f, 0xff,
-    0xc0, 0x3, 0xff, 0xf4, 0xf, 0xff, 0xc0, 0x3,
-    0xff, 0xf0, 0xf, 0xff, 0x80, 0x2, 0xff, 0xf0,
-    0xf, 0xff, 0x80, 0x2, 0xff, 0xf0, 0xf, 0xff,
-    0x40, 0x2, 0xff, 0xf0,
-
-    /* U+0023 "#" */
-    0x0, 0x0, 0x1, 0x55, 0x55, 0x0, 0x0, 0x5,
-    0x55, 0x50, 0x0, 0x0, 0x0, 0x3f, 0xff, 0xe0,
-    0x0, 0x1, 0xff, 0xff, 0x0, 0x0, 0x0, 0x3,
-    0xff, 0xfd, 0x0, 0x0, 0x2f, 0xff, 0xf0, 0x0,
-    0x0, 0x0, 0x7f, 0xff, 0xc0, 0x0, 0x3, 0xff,
-    0xff, 0x0, 0x0, 0x0, 0xb, 0xff, 0xfc, 0x0,
-    0x0, 0x3f, 0xff, 0xe0, 0x0, 0x0, 0x0, 0xbf,
-    0xff, 0xc0, 0x0, 0x3, 0xff, 0xfd, 0x0, 0x0,
-    0x0, 0xf, 0xff, 0xf8, 0x0, 0x0, 0x7f, 0xff,
-    0xd0, 0x0, 0x0, 0x0, 0xff, 0xff, 0x80, 0x0,
-    0x7, 0xff, 0xfc, 0x0, 0x0, 0x0, 0xf, 0xff,
-    0xf4, 0x0, 0x0, 0xbf, 0xff, 0xc0, 0x0, 0x0,
-    0x1, 0xff, 0xff, 0x0, 0x0, 0xf, 0xff, 0xfc,
-    0x0, 0x0, 0x0, 0x2f, 0xff, 0xf0, 0x0, 0x0,
-    0xff, 0xff, 0x80, 0x0, 0x0, 0x2, 0xff, 0xff,
-    0x0, 0x0, 0xf, 0xff, 0xf4, 0x0, 0xaa, 0xaa,
-    0xbf, 0xff, 0xfa, 0xaa, 0xaa, 0xff, 0xff, 0xaa,
-    0x8f, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
-    0xff, 0xff, 0xfc, 0xff, 0xff, 0xff, 0xff, 0xff,
-    0xff, 0xff, 0xff, 0xff, 0xff, 0xcf, 0xff, 0xff,
-    0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xfc,
-    0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
-    0xff, 0xff, 0xcf, 0xff, 0xff, 0xff, 0xff, 0xff,
-    0xff, 0xff, 0xff, 0xff, 0xfc, 0xff, 0xff, 0xff,
-    0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xcf,
-    0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
-    0xff, 0xfc, 0x0, 0x0, 0xff, 0xff, 0x40, 0x0,
-    0xb, 0xff, 0xfc, 0x0, 0x0, 0x0, 0x1f, 0xff,
-    0xf4, 0x0, 0x0, 0xbf, 0xff, 0xc0, 0x0, 0x0,
-    0x1, 0xff, 0xff, 0x0, 0x0, 0xf, 0xff, 0xf8,
-    0x0, 0x0, 0x0, 0x2f, 0xff, 0xf0, 0x0, 0x0,
-    0xff, 0xff, 0x80, 0x0, 0x0, 0x3, 0xff, 0xff,
-    0x0, 0x0, 0xf, 0xff, 0xf4, 0x0, 0x0, 0x0,
-    0x3f, 0xff, 0xe0, 0x0, 0x1, 0xff, 0xff, 0x0,
-    0x0, 0x0, 0x3, 0xff, 0xfd, 0x0, 0x0, 0x2f,
-    0xff, 0xf0, 0x0, 0x0, 0x0, 0x7f, 0xff, 0xd0,
-    0x0, 0x2, 0xff, 0xff, 0x0, 0x0, 0x0, 0x7,
-    0xff, 0xfc, 0x0, 0x0, 0x3f, 0xff, 0xe0, 0x0,
-    0x0, 0x0, 0xbf, 0xff, 0xc0, 0x0, 0x3, 0xff,
-    0xfe, 0x0, 0x0, 0x55, 0x5f, 0xff, 0xfd, 0x55,
-    0x55, 0xbf, 0xff, 0xe5, 0x55, 0x4f, 0xff, 0xff,
-    0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xfc,
-    0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
-    0xff, 0xff, 0xcf, 0xff, 0xff, 0xff, 0xff, 0xff,
-    0xff, 0xff, 0xff, 0xff, 0xfc, 0xff, 0xff, 0xff,
-    0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xcf,
-    0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
-    0xff, 0xfc, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
-    0xff, 0xff, 0xff, 0xff, 0xcf, 0xff, 0xff, 0xff,
-    0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xfc, 0x0,
-    0x3f, 0xff, 0xd0, 0x0, 0x1, 0xff, 0xff, 0x0,
-    0x0, 0x0, 0x3, 0xff, 0xfd, 0x0, 0x0, 0x2f,
-    0xff, 0xf0, 0x0, 0x0, 0x0, 0x7f, 0xff, 0xc0,
-    0x0, 0x3, 0xff, 0xfe, 0x0, 0x0, 0x0, 0xb,
-    0xff, 0xfc, 0x0, 0x0, 0x3f, 0xff, 0xe0, 0x0,
-    0x0, 0x0, 0xbf, 0xff, 0xc0, 0x0, 0x3, 0xff,
-    0xfd, 0x0, 0x0, 0x0, 0xf, 0xff, 0xf8, 0x0,
-    0x0, 0x7f, 0xff, 0xc0, 0x0, 0x0, 0x0, 0xff,
-    0xff, 0x40, 0x0, 0x7, 0xff, 0xfc, 0x0, 0x0,
-    0x0, 0xf, 0xff, 0xf4, 0x0, 0x0, 0xbf, 0xff,
-    0xc0, 0x0, 0x0, 0x1, 0xff, 0xff, 0x0, 0x0,
-    0xb, 0xff, 0xfc, 0x0, 0x0, 0x0, 0x1f, 0xff,
-    0xf0, 0x0, 0x0, 0xff, 0xff, 0x80, 0x0, 0x0,
-    0x2, 0xff, 0xff, 0x0, 0x0, 0xf, 0xff, 0xf4,
-    0x0, 0x0, 0x0, 0x3f, 0xff, 0xe0, 0x0, 0x0,
-    0xff, 0xff, 0x40, 0x0, 0x0, 0x3, 0xff, 0xfe,
-    0x0, 0x0, 0x1f, 0xff, 0xf0, 0x0, 0x0, 0x0,
-
-    /* U+0024 "$" */
-    0x0, 0x0, 0x0, 0x1, 0xff, 0x80, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x1, 0xff, 0xc0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x1, 0xff, 0xc0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x1, 0xff,
-    0xc0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x1,
-    0xff, 0xc0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x1, 0xff, 0xc0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x1, 0xff, 0xc0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x16, 0xff, 0xff, 0xff, 0xfa, 0x40, 0x0,
-    0x0, 0x2, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
-    0x40, 0x0, 0x1f, 0xff, 0xff, 0xff, 0xff, 0xff,
-    0xff, 0x80, 0x0, 0xbf, 0xff, 0xff, 0xff, 0xff,
-    0xff, 0xff, 0x80, 0x2, 0xff, 0xff, 0xff, 0xff,
-    0xff, 0xff, 0xff, 0x80, 0x7, 0xff, 0xff, 0xff,
-    0xff, 0xff, 0xff, 0xff, 0x80, 0xf, 0xff, 0xff,
-    0xff, 0xff, 0xff, 0xff, 0xff, 0x80, 0xf, 0xff,
-    0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0x80, 0x2f,
-    0xff, 0xff, 0xfb, 0xff, 0xea, 0xff, 0xff, 0x80,
-    0x3f, 0xff, 0xff, 0x41, 0xff, 0xc0, 0x0, 0x5b,
-    0x80, 0x3f, 0xff, 0xfc, 0x1, 0xff, 0xc0, 0x0,
-    0x0, 0x0, 0x3f, 0xff, 0xf8, 0x1, 0xff, 0xc0,
-    0x0, 0x0, 0x0, 0x3f, 0xff, 0xf8, 0x1, 0xff,
-    0xc0, 0x0, 0x0, 0x0, 0x3f, 0xff, 0xf4, 0x1,
-    0xff, 0xc0, 0x0, 0x0, 0x0, 0x3f, 0xff, 0xf4,
-    0x1, 0xff, 0xc0, 0x0, 0x0, 0x0, 0x3f, 0xff,
-    0xf8, 0x1, 0xff, 0xc0, 0x0, 0x0, 0x0, 0x3f,
-    0xff, 0xfc, 0x1, 0xff, 0xc0, 0x0, 0x0, 0x0,
-    0x3f, 0xff, 0xfe, 0x1, 0xff, 0xc0, 0x0, 0x0,
-    0x0, 0x2f, 0xff, 0xff, 0xd1, 0xff, 0xc0, 0x0,
-    0x0, 0x0, 0x1f, 0xff, 0xff, 0xff, 0xff, 0xc0,
-    0x0, 0x0, 0x0, 0xf, 0xff, 0xff, 0xff, 0xff,
-    0xd0, 0x0, 0x0, 0x0, 0xb, 0xff, 0xff, 0xff,
-    0xff, 0xff, 0x90, 0x0, 0x0, 0x3, 0xff, 0xff,
-    0xff, 0xff, 0xff, 0xfe, 0x0, 0x0, 0x0, 0xff,
-    0xff, 0xff, 0xff, 0xff, 0xff, 0xe0, 0x0, 0x0,
-    0x2f, 0xff, 0xff, 0xff, 0xff, 0xff, 0xfd, 0x0,
-    0x0, 0x7, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
-    0x80, 0x0, 0x0, 0x7f, 0xff, 0xff, 0xff, 0xff,
-    0xff, 0xd0, 0x0, 0x0, 0x1, 0xbf, 0xff, 0xff,
-    0xff, 0xff, 0xf0, 0x0, 0x0, 0x0, 0x2, 0xff,
-    0xff, 0xff, 0xff, 0xf8, 0x0, 0x0, 0x0, 0x1,
-    0xff, 0xff, 0xff, 0xff, 0xfc, 0x0, 0x0, 0x0,
-    0x1, 0xff, 0xc6, 0xff, 0xff, 0xfc, 0x0, 0x0,
-    0x0, 0x1, 0xff, 0xc0, 0x7f, 0xff, 0xfe, 0x0,
-    0x0, 0x0, 0x1, 0xff, 0xc0, 0x2f, 0xff, 0xfe,
-    0x0, 0x0, 0x0, 0x1, 0xff, 0xc0, 0xf, 0xff,
-    0xfe, 0x0, 0x0, 0x0, 0x1, 0xff, 0xc0, 0xf,
-    0xff, 0xff, 0x0, 0x0, 0x0, 0x1, 0xff, 0xc0,
-    0xf, 0xff, 0xff, 0x0, 0x0, 0x0, 0x1, 0xff,
-    0xc0, 0xf, 0xff, 0xff, 0x0, 0x0, 0x0, 0x1,
-    0xff, 0xc0, 0xf, 0xff, 0xfe, 0x0, 0x0, 0x0,
-    0x1, 0xff, 0xc0, 0x1f, 0xff, 0xfe, 0x64, 0x0,
-    0x0, 0x1, 0xff, 0xc0, 0x7f, 0xff, 0xfe, 0x7f,
-    0xf9, 0x50, 0x1, 0xff, 0xc6, 0xff, 0xff, 0xfd,
-    0x7f, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
-    0xfc, 0x7f, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
-    0xff, 0xf8, 0x7f, 0xff, 0xff, 0xff, 0xff, 0xff,
-    0xff, 0xff, 0xf0, 0x7f, 0xff, 0xff, 0xff, 0xff,
-    0xff, 0xff, 0xff, 0xe0, 0x7f, 0xff, 0xff, 0xff,
-    0xff, 0xff, 0xff, 0xff, 0xc0, 0x7f, 0xff, 0xff,
-    0xff, 0xff, 0xff, 0xff, 0xfe, 0x0, 0x7f, 0xff,
-    0xff, 0xff, 0xff, 0xff, 0xff, 0xf4, 0x0, 0x2f,
-    0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0x40, 0x0,
-    0x0, 0x5a, 0xbf, 0xff, 0xff, 0xfe, 0x90, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x1, 0xff, 0xc0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x1, 0xff, 0xc0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x1, 0xff,
-    0xc0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x1,
-    0xff, 0xc0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x1, 0xff, 0xc0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x1, 0xff, 0xc0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x1, 0xff, 0xc0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x1, 0xff, 0xc0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x1, 0xff, 0xc0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x1, 0xff, 0xc0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x1, 0xff,
-    0xc0, 0x0, 0x0, 0x0,
-
-    /* U+0025 "%" */
-    0x0, 0x0, 0x6a, 0x90, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x1f, 0xff,
-    0xff, 0x40, 0x0, 0x0, 0x0, 0x1, 0xff, 0xff,
-    0x0, 0x0, 0x0, 0xff, 0xff, 0xff, 0xf0, 0x0,
-    0x0, 0x0, 0x3, 0xff, 0xfd, 0x0, 0x0, 0x3,
-    0xff, 0xff, 0xff, 0xfc, 0x0, 0x0, 0x0, 0xb,
-    0xff, 0xf8, 0x0, 0x0, 0xb, 0xff, 0xff, 0xff,
-    0xfe, 0x0, 0x0, 0x0, 0xf, 0xff, 0xf0, 0x0,
-    0x0, 0xf, 0xff, 0xff, 0xff, 0xff, 0x0, 0x0,
-    0x0, 0x2f, 0xff, 0xe0, 0x0, 0x0, 0x1f, 0xff,
-    0xff, 0xff, 0xff, 0x80, 0x0, 0x0, 0x3f, 0xff,
-    0xc0, 0x0, 0x0, 0x3f, 0xff, 0xd0, 0x7f, 0xff,
-    0xc0, 0x0, 0x0, 0xff, 0xff, 0x80, 0x0, 0x0,
-    0x3f, 0xff, 0x0, 0xf, 0xff, 0xc0, 0x0, 0x1,
-    0xff, 0xff, 0x0, 0x0, 0x0, 0x3f, 0xfe, 0x0,
-    0x7, 0xff, 0xd0, 0x0, 0x3, 0xff, 0xfd, 0x0,
-    0x0, 0x0, 0x7f, 0xfd, 0x0, 0x3, 0xff, 0xe0,
-    0x0, 0x7, 0xff, 0xfc, 0x0, 0x0, 0x0, 0x7f,
-    0xfc, 0x0, 0x3, 0xff, 0xe0, 0x0, 0xf, 0xff,
-    0xf4, 0x0, 0x0, 0x0, 0x7f, 0xfc, 0x0, 0x3,
-    0xff, 0xe0, 0x0, 0x2f, 0xff, 0xe0, 0x0, 0x0,
-    0x0, 0xbf, 0xfc, 0x0, 0x3, 0xff, 0xe0, 0x0,
-    0x3f, 0xff, 0xc0, 0x0, 0x0, 0x0, 0xbf, 0xfc,
-    0x0, 0x3, 0xff, 0xe0, 0x0, 0xbf, 0xff, 0x80,
-    0x0, 0x0, 0x0, 0x7f, 0xfc, 0x0, 0x3, 0xff,
-    0xe0, 0x0, 0xff, 0xff, 0x0, 0x0, 0x0, 0x0,
-    0x7f, 0xfc, 0x0, 0x3, 0xff, 0xe0, 0x3, 0xff,
-    0xfd, 0x0, 0x0, 0x0, 0x0, 0x7f, 0xfd, 0x0,
-    0x3, 0xff, 0xe0, 0x7, 0xff, 0xfc, 0x0, 0x0,
-    0x0, 0x0, 0x3f, 0xfd, 0x0, 0x7, 0xff, 0xd0,
-    0xf, 0xff, 0xf4, 0x0, 0x0, 0x0, 0x0, 0x3f,
-    0xff, 0x0, 0xb, 0xff, 0xc0, 0x1f, 0xff, 0xf0,
-    0x0, 0x0, 0x0, 0x0, 0x3f, 0xff, 0x80, 0x1f,
-    0xff, 0xc0, 0x3f, 0xff, 0xd0, 0x0, 0x0, 0x0,
-    0x0, 0x2f, 0xff, 0xfe, 0xff, 0xff, 0x80, 0xbf,
-    0xff, 0x80, 0x0, 0x0, 0x0, 0x0, 0xf, 0xff,
-    0xff, 0xff, 0xff, 0x40, 0xff, 0xff, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0xf, 0xff, 0xff, 0xff, 0xff,
-    0x2, 0xff, 0xfe, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x3, 0xff, 0xff, 0xff, 0xfd, 0x7, 0xff, 0xfc,
-    0x0, 0x16, 0xa9, 0x0, 0x0, 0x1, 0xff, 0xff,
-    0xff, 0xf4, 0xf, 0xff, 0xf4, 0x2, 0xff, 0xff,
-    0xf4, 0x0, 0x0, 0x3f, 0xff, 0xff, 0xd0, 0x1f,
-    0xff, 0xf0, 0xf, 0xff, 0xff, 0xfe, 0x0, 0x0,
-    0x6, 0xff, 0xf9, 0x0, 0x3f, 0xff, 0xd0, 0x3f,
-    0xff, 0xff, 0xff, 0xc0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x7f, 0xff, 0xc0, 0xff, 0xff, 0xff, 0xff,
-    0xd0, 0x0, 0x0, 0x0, 0x0, 0x0, 0xff, 0xff,
-    0x1, 0xff, 0xff, 0xff, 0xff, 0xf0, 0x0, 0x0,
-    0x0, 0x0, 0x2, 0xff, 0xfe, 0x2, 0xff, 0xff,
-    0xff, 0xff, 0xf4, 0x0, 0x0, 0x0, 0x0, 0x3,
-    0xff, 0xfc, 0x3, 0xff, 0xf8, 0x7, 0xff, 0xf8,
-    0x0, 0x0, 0x0, 0x0, 0xb, 0xff, 0xf8, 0x7,
-    0xff, 0xf0, 0x0, 0xff, 0xfc, 0x0, 0x0, 0x0,
-    0x0, 0x1f, 0xff, 0xf0, 0x7, 0xff, 0xd0, 0x0,
-    0xbf, 0xfc, 0x0, 0x0, 0x0, 0x0, 0x3f, 0xff,
-    0xd0, 0xb, 0xff, 0xc0, 0x0, 0x7f, 0xfd, 0x0,
-    0x0, 0x0, 0x0, 0x7f, 0xff, 0xc0, 0xb, 0xff,
-    0xc0, 0x0, 0x7f, 0xfd, 0x0, 0x0, 0x0, 0x0,
-    0xff, 0xff, 0x40, 0xb, 0xff, 0xc0, 0x0, 0x3f,
-    0xfd, 0x0, 0x0, 0x0, 0x2, 0xff, 0xff, 0x0,
-    0xf, 0xff, 0xc0, 0x0, 0x3f, 0xfd, 0x0, 0x0,
-    0x0, 0x3, 0xff, 0xfc, 0x0, 0xf, 0xff, 0xc0,
-    0x0, 0x3f, 0xfd, 0x0, 0x0, 0x0, 0xb, 0xff,
-    0xf8, 0x0, 0xb, 0xff, 0xc0, 0x0, 0x3f, 0xfd,
-    0x0, 0x0, 0x0, 0xf, 0xff, 0xf0, 0x0, 0xb,
-    0xff, 0xc0, 0x0, 0x7f, 0xfd, 0x0, 0x0, 0x0,
-    0x2f, 0xff, 0xe0, 0x0, 0xb, 0xff, 0xc0, 0x0,
-    0x7f, 0xfd, 0x0, 0x0, 0x0, 0x7f, 0xff, 0xc0,
-    0x0, 0xb, 0xff, 0xc0, 0x0, 0xbf, 0xfc, 0x0,
-    0x0, 0x0, 0xff, 0xff, 0x40, 0x0, 0x7, 0xff,
-    0xe0, 0x0, 0xff, 0xfc, 0x0, 0x0, 0x1, 0xff,
-    0xff, 0x0, 0x0, 0x3, 0xff, 0xf4, 0x2, 0xff,
-    0xfc, 0x0, 0x0, 0x3, 0xff, 0xfd, 0x0, 0x0,
-    0x3, 0xff, 0xff, 0xaf, 0xff, 0xf8, 0x0, 0x0,
-    0xb, 0xff, 0xfc, 0x0, 0x0, 0x2, 0xff, 0xff,
-    0xff, 0xff, 0xf0, 0x0, 0x0, 0xf, 0xff, 0xf0,
-    0x0, 0x0, 0x0, 0xff, 0xff, 0xff, 0xff, 0xe0,
-    0x0, 0x0, 0x2f, 0xff, 0xe0, 0x0, 0x0, 0x0,
-    0x7f, 0xff, 0xff, 0xff, 0xc0, 0x0, 0x0, 0x3f,
-    0xff, 0xc0, 0x0, 0x0, 0x0, 0x2f, 0xff, 0xff,
-    0xff, 0x0, 0x0, 0x0, 0xff, 0xff, 0x80, 0x0,
-    0x0, 0x0, 0x7, 0xff, 0xff, 0xf8, 0x0, 0x0,
-    0x0, 0x55, 0x55, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x6f, 0xff, 0x80, 0x0,
-
-    /* U+0026 "&" */
-    0x0, 0x0, 0x0, 0x0, 0x16, 0xaa, 0x90, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x7f,
-    0xff, 0xff, 0xf4, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x7f, 0xff, 0xff, 0xff, 0xf0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x2f, 0xff, 0xff,
-    0xff, 0xff, 0xd0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0xb, 0xff, 0xff, 0xff, 0xff, 0xff, 0x40, 0x0,
-    0x0, 0x0, 0x0, 0x2, 0xff, 0xff, 0xff, 0xff,
-    0xff, 0xfc, 0x0, 0x0, 0x0, 0x0, 0x0, 0x3f,
-    0xff, 0xff, 0xff, 0xff, 0xff, 0xd0, 0x0, 0x0,
-    0x0, 0x0, 0xb, 0xff, 0xff, 0xff, 0xff, 0xff,
-    0xff, 0x0, 0x0, 0x0, 0x0, 0x0, 0xff, 0xff,
-    0xfe, 0x2, 0xff, 0xff, 0xf0, 0x0, 0x0, 0x0,
-    0x0, 0x1f, 0xff, 0xff, 0x40, 0xb, 0xff, 0xff,
-    0x40, 0x0, 0x0, 0x0, 0x2, 0xff, 0xff, 0xf0,
-    0x0, 0x3f, 0xff, 0xf4, 0x0, 0x0, 0x0, 0x0,
-    0x2f, 0xff, 0xfe, 0x0, 0x3, 0xff, 0xff, 0x80,
-    0x0, 0x0, 0x0, 0x2, 0xff, 0xff, 0xd0, 0x0,
-    0x3f, 0xff, 0xf8, 0x0, 0x0, 0x0, 0x0, 0x2f,
-    0xff, 0xfe, 0x0, 0x3, 0xff, 0xff, 0x40, 0x0,
-    0x0, 0x0, 0x2, 0xff, 0xff, 0xe0, 0x0, 0x7f,
-    0xff, 0xf4, 0x0, 0x0, 0x0, 0x0, 0x1f, 0xff,
-    0xff, 0x0, 0xf, 0xff, 0xff, 0x0, 0x0, 0x0,
-    0x0, 0x1, 0xff, 0xff, 0xf4, 0x2, 0xff, 0xff,
-    0xe0, 0x0, 0x0, 0x0, 0x0, 0xf, 0xff, 0xff,
-    0xc0, 0xbf, 0xff, 0xfd, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0xbf, 0xff, 0xfd, 0x7f, 0xff, 0xff, 0x80,
-    0x0, 0x0, 0x0, 0x0, 0x7, 0xff, 0xff, 0xff,
-    0xff, 0xff, 0xf0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x3f, 0xff, 0xff, 0xff, 0xff, 0xfc, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x1, 0xff, 0xff, 0xff, 0xff,
-    0xff, 0x40, 0x0, 0x0, 0x0, 0x0, 0x0, 0xb,
-    0xff, 0xff, 0xff, 0xff, 0xc0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x3f, 0xff, 0xff, 0xff, 0xe0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0xf, 0xff,
-    0xff, 0xff, 0xf4, 0x0, 0x7, 0xff, 0xfe, 0x0,
-    0x0, 0xb, 0xff, 0xff, 0xff, 0xfc, 0x0, 0x0,
-    0xbf, 0xff, 0xf0, 0x0, 0x3, 0xff, 0xff, 0xff,
-    0xff, 0xe0, 0x0, 0xb, 0xff, 0xfe, 0x0, 0x0,
-    0xff, 0xff, 0xff, 0xff, 0xff, 0x40, 0x0, 0xbf,
-    0xff, 0xe0, 0x0, 0x3f, 0xff, 0xff, 0xff, 0xff,
-    0xfc, 0x0, 0xf, 0xff, 0xfd, 0x0, 0xf, 0xff,
-    0xff, 0xff, 0xff, 0xff, 0xf0, 0x0, 0xff, 0xff,
-    0xd0, 0x3, 0xff, 0xff, 0xff, 0xbf, 0xff, 0xff,
-    0x80, 0x1f, 0xff, 0xfc, 0x0, 0x7f, 0xff, 0xff,
-    0x82, 0xff, 0xff, 0xfe, 0x2, 0xff, 0xff, 0xc0,
-    0xf, 0xff, 0xff, 0xe0, 0xf, 0xff, 0xff, 0xf4,
-    0x3f, 0xff, 0xf8, 0x1, 0xff, 0xff, 0xf8, 0x0,
-    0x3f, 0xff, 0xff, 0xc7, 0xff, 0xff, 0x40, 0x2f,
-    0xff, 0xff, 0x0, 0x0, 0xff, 0xff, 0xff, 0xff,
-    0xff, 0xf0, 0x3, 0xff, 0xff, 0xe0, 0x0, 0x7,
-    0xff, 0xff, 0xff, 0xff, 0xff, 0x0, 0x3f, 0xff,
-    0xfd, 0x0, 0x0, 0x2f, 0xff, 0xff, 0xff, 0xff,
-    0xd0, 0x7, 0xff, 0xff, 0xd0, 0x0, 0x0, 0xbf,
-    0xff, 0xff, 0xff, 0xfc, 0x0, 0x7f, 0xff, 0xfd,
-    0x0, 0x0, 0x3, 0xff, 0xff, 0xff, 0xff, 0x80,
-    0x7, 0xff, 0xff, 0xe0, 0x0, 0x0, 0xf, 0xff,
-    0xff, 0xff, 0xf0, 0x0, 0x3f, 0xff, 0xff, 0x0,
-    0x0, 0x0, 0x7f, 0xff, 0xff, 0xfe, 0x0, 0x3,
-    0xff, 0xff, 0xf4, 0x0, 0x0, 0x1, 0xff, 0xff,
-    0xff, 0xc0, 0x0, 0x3f, 0xff, 0xff, 0xc0, 0x0,
-    0x0, 0x7f, 0xff, 0xff, 0xf4, 0x0, 0x2, 0xff,
-    0xff, 0xff, 0x40, 0x0, 0x7f, 0xff, 0xff, 0xff,
-    0x40, 0x0, 0xf, 0xff, 0xff, 0xff, 0xa6, 0xbf,
-    0xff, 0xff, 0xff, 0xfd, 0x0, 0x0, 0xbf, 0xff,
-    0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xf0,
-    0x0, 0x3, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
-    0xff, 0xff, 0xff, 0xc0, 0x0, 0x1f, 0xff, 0xff,
-    0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0x0,
-    0x0, 0x7f, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
-    0xff, 0xff, 0xf8, 0x0, 0x1, 0xff, 0xff, 0xff,
-    0xff, 0xff, 0xff, 0x8b, 0xff, 0xff, 0xe0, 0x0,
-    0x2, 0xff, 0xff, 0xff, 0xff, 0xff, 0x80, 0x3f,
-    0xff, 0xff, 0x40, 0x0, 0x2, 0xff, 0xff, 0xff,
-    0xfe, 0x40, 0x0, 0xff, 0xff, 0xfd, 0x0, 0x0,
-    0x1, 0xaf, 0xff, 0xe4, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0,
-
-    /* U+0027 "'" */
-    0x55, 0x55, 0x52, 0xff, 0xff, 0xcb, 0xff, 0xff,
-    0x2f, 0xff, 0xfc, 0x7f, 0xff, 0xf1, 0xff, 0xff,
-    0xc7, 0xff, 0xff, 0xf, 0xff, 0xf8, 0x3f, 0xff,
-    0xe0, 0xff, 0xff, 0x83, 0xff, 0xfd, 0xf, 0xff,
-    0xf4, 0x3f, 0xff, 0xd0, 0xbf, 0xff, 0x2, 0xff,
-    0xfc, 0x7, 0xff, 0xf0, 0x1f, 0xff, 0xc0, 0x7f,
-    0xff, 0x0, 0xff, 0xfc, 0x3, 0xff, 0xe0, 0xf,
-    0xff, 0x80, 0x3f, 0xfd, 0x0,
-
-    /* U+0028 "(" */
-    0x0, 0x0, 0x1, 0x55, 0x55, 0x40, 0x0, 0x0,
-    0xbf, 0xff, 0xfc, 0x0, 0x0, 0xf, 0xff, 0xff,
-    0x40, 0x0, 0x2, 0xff, 0xff, 0xf0, 0x0, 0x0,
-    0x3f, 0xff, 0xfd, 0x0, 0x0, 0xb, 0xff, 0xff,
-    0xc0, 0x0, 0x0, 0xff, 0xff, 0xf4, 0x0, 0x0,
-    0x2f, 0xff, 0xff, 0x0, 0x0, 0x3, 0xff, 0xff,
-    0xe0, 0x0, 0x0, 0xbf, 0xff, 0xfc, 0x0, 0x0,
-    0xf, 0xff, 0xff, 0x80, 0x0, 0x1, 0xff, 0xff,
-    0xf0, 0x0, 0x0, 0x3f, 0xff, 0xff, 0x0, 0x0,
-    0x7, 0xff, 0xff, 0xd0, 0x0, 0x0, 0xbf, 0xff,
-    0xfc, 0x0, 0x0, 0xf, 0xff, 0xff, 0x80, 0x0,
-    0x1, 0xff, 0xff, 0xf4, 0x0, 0x0, 0x3f, 0xff,
-    0xff, 0x0, 0x0, 0x3, 0xff, 0xff, 0xf0, 0x0,
-    0x0, 0x7f, 0xff, 0xfd, 0x0, 0x0, 0xb, 0xff,
-    0xff, 0xc0, 0x0, 0x0, 0xff, 0xff, 0xfc, 0x0,
-    0x0, 0xf, 0xff, 0xff, 0x80, 0x0, 0x1, 0xff,
-    0xff, 0xf8, 0x0, 0x0, 0x2f, 0xff, 0xff, 0x40,
-    0x0, 0x3, 0xff, 0xff, 0xf0, 0x0, 0x0, 0x3f,
-    0xff, 0xff, 0x0, 0x0, 0x3, 0xff, 0xff, 0xf0,
-    0x0, 0x0, 0x7f, 0xff, 0xfe, 0x0, 0x0, 0x7,
-    0xff, 0xff, 0xe0, 0x0, 0x0, 0xbf, 0xff, 0xfd,
-    0x0, 0x0, 0xb, 0xff, 0xff, 0xd0, 0x0, 0x0,
-    0xbf, 0xff, 0xfd, 0x0, 0x0, 0xb, 0xff, 0xff,
-    0xd0, 0x0, 0x0, 0xff, 0xff, 0xfd, 0x0, 0x0,
-    0xf, 0xff, 0xff, 0xd0, 0x0, 0x0, 0xff, 0xff,
-    0xfd, 0x0, 0x0, 0xb, 0xff, 0xff, 0xd0, 0x0,
-    0x0, 0xbf, 0xff, 0xfd, 0x0, 0x0, 0xb, 0xff,
-    0xff, 0xd0, 0x0, 0x0, 0xbf, 0xff, 0xfe, 0x0,
-    0x0, 0x7, 0xff, 0xff, 0xe0, 0x0, 0x0, 0x7f,
-    0xff, 0xff, 0x0, 0x0, 0x3, 0xff, 0xff, 0xf0,
-    0x0, 0x0, 0x3f, 0xff, 0xff, 0x0, 0x0, 0x3,
-    0xff, 0xff, 0xf0, 0x0, 0x0, 0x2f, 0xff, 0xff,
-    0x40, 0x0, 0x2, 0xff, 0xff, 0xf8, 0x0, 0x0,
-    0x1f, 0xff, 0xff, 0xc0, 0x0, 0x0, 0xff, 0xff,
-    0xfc, 0x0, 0x0, 0xf, 0xff, 0xff, 0xd0, 0x0,
-    0x0, 0x7f, 0xff, 0xfe, 0x0, 0x0, 0x3, 0xff,
-    0xff, 0xf0, 0x0, 0x0, 0x3f, 0xff, 0xff, 0x0,
-    0x0, 0x2, 0xff, 0xff, 0xf8, 0x0, 0x0, 0xf,
-    0xff, 0xff, 0xc0, 0x0, 0x0, 0xff, 0xff, 0xfc,
-    0x0, 0x0, 0x7, 0xff, 0xff, 0xe0, 0x0, 0x0,
-    0x3f, 0xff, 0xff, 0x0, 0x0, 0x2, 0xff, 0xff,
-    0xf4, 0x0, 0x0, 0xf, 0xff, 0xff, 0xc0, 0x0,
-    0x0, 0xbf, 0xff, 0xfc, 0x0, 0x0, 0x3, 0xff,
-    0xff, 0xe0, 0x0, 0x0, 0x2f, 0xff, 0xff, 0x0,
-    0x0, 0x0, 0xff, 0xff, 0xf8, 0x0, 0x0, 0xb,
-    0xff, 0xff, 0xc0, 0x0, 0x0, 0x3f, 0xff, 0xfe,
-    0x0, 0x0, 0x1, 0xff, 0xff, 0xf0, 0x0, 0x0,
-    0xf, 0xff, 0xff, 0x80, 0x0, 0x0, 0x7f, 0xff,
-    0xfc,
-
-    /* U+0029 ")" */
-    0x15, 0x55, 0x54, 0x0, 0x0, 0x3, 0xff, 0xff,
-    0xd0, 0x0, 0x0, 0x2f, 0xff, 0xff, 0x0, 0x0,
-    0x0, 0xff, 0xff, 0xf4, 0x0, 0x0, 0xb, 0xff,
-    0xff, 0xc0, 0x0, 0x0, 0x3f, 0xff, 0xfe, 0x0,
-    0x0, 0x2, 0xff, 0xff, 0xf0, 0x0, 0x0, 0xf,
-    0xff, 0xff, 0x80, 0x0, 0x0, 0xbf, 0xff, 0xfc,
-    0x0, 0x0, 0x3, 0xff, 0xff, 0xd0, 0x0, 0x0,
-    0x3f, 0xff, 0xff, 0x0, 0x0, 0x1, 0xff, 0xff,
-    0xf4, 0x0, 0x0, 0xf, 0xff, 0xff, 0xc0, 0x0,
-    0x0, 0xbf, 0xff, 0xfc, 0x0, 0x0, 0x3, 0xff,
-    0xff, 0xe0, 0x0, 0x0, 0x3f, 0xff, 0xff, 0x0,
-    0x0, 0x2, 0xff, 0xff, 0xf4, 0x0, 0x0, 0xf,
-    0xff, 0xff, 0x80, 0x0, 0x0, 0xff, 0xff, 0xfc,
-    0x0, 0x0, 0xb, 0xff, 0xff, 0xd0, 0x0, 0x0,
-    0x7f, 0xff, 0xfe, 0x0, 0x0, 0x3, 0xff, 0xff,
-    0xf0, 0x0, 0x0, 0x3f, 0xff, 0xff, 0x0, 0x0,
-    0x2, 0xff, 0xff, 0xf4, 0x0, 0x0, 0x1f, 0xff,
-    0xff, 0x80, 0x0, 0x1, 0xff, 0xff, 0xf8, 0x0,
-    0x0, 0xf, 0xff, 0xff, 0xc0, 0x0, 0x0, 0xff,
-    0xff, 0xfc, 0x0, 0x0, 0xf, 0xff, 0xff, 0xc0,
-    0x0, 0x0, 0xbf, 0xff, 0xfd, 0x0, 0x0, 0xb,
-    0xff, 0xff, 0xd0, 0x0, 0x0, 0xbf, 0xff, 0xfe,
-    0x0, 0x0, 0xb, 0xff, 0xff, 0xe0, 0x0, 0x0,
-    0x7f, 0xff, 0xfe, 0x0, 0x0, 0x7, 0xff, 0xff,
-    0xe0, 0x0, 0x0, 0x7f, 0xff, 0xfe, 0x0, 0x0,
-    0x7, 0xff, 0xff, 0xe0, 0x0, 0x0, 0x7f, 0xff,
-    0xfe, 0x0, 0x0, 0xb, 0xff, 0xff, 0xe0, 0x0,
-    0x0, 0xbf, 0xff, 0xfe, 0x0, 0x0, 0xb, 0xff,
-    0xff, 0xd0, 0x0, 0x0, 0xff, 0xff, 0xfd, 0x0,
-    0x0, 0xf, 0xff, 0xff, 0xc0, 0x0, 0x0, 0xff,
-    0xff, 0xfc, 0x0, 0x0, 0xf, 0xff, 0xff, 0xc0,
-    0x0, 0x1, 0xff, 0xff, 0xfc, 0x0, 0x0, 0x2f,
-    0xff, 0xff, 0x80, 0x0, 0x2, 0xff, 0xff, 0xf4,
-    0x0, 0x0, 0x3f, 0xff, 0xff, 0x0, 0x0, 0x3,
-    0xff, 0xff, 0xf0, 0x0, 0x0, 0x7f, 0xff, 0xfe,
-    0x0, 0x0, 0xb, 0xff, 0xff, 0xd0, 0x0, 0x0,
-    0xff, 0xff, 0xfc, 0x0, 0x0, 0x1f, 0xff, 0xff,
-    0xc0, 0x0, 0x2, 0xff, 0xff, 0xf4, 0x0, 0x0,
-    0x3f, 0xff, 0xff, 0x0, 0x0, 0x7, 0xff, 0xff,
-    0xe0, 0x0, 0x0, 0xbf, 0xff, 0xfd, 0x0, 0x0,
-    0xf, 0xff, 0xff, 0xc0, 0x0, 0x2, 0xff, 0xff,
-    0xf4, 0x0, 0x0, 0x3f, 0xff, 0xff, 0x0, 0x0,
-    0x7, 0xff, 0xff, 0xe0, 0x0, 0x0, 0xff, 0xff,
-    0xfc, 0x0, 0x0, 0x1f, 0xff, 0xff, 0x80, 0x0,
-    0x3, 0xff, 0xff, 0xf0, 0x0, 0x0, 0x3f, 0xff,
-    0xfd, 0x0, 0x0, 0xf, 0xff, 0xff, 0xc0, 0x0,
-    0x1, 0xff, 0xff, 0xf4, 0x0, 0x0, 0x3f, 0xff,
-    0xff, 0x0, 0x0, 0x7, 0xff, 0xff, 0xc0, 0x0,
-    0x0,
-
-    /* U+002A "*" */
-    0x0, 0x0, 0xb, 0xff, 0xfc, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0xbf, 0xff, 0xc0, 0x0, 0x0, 0x0,
-    0x0, 0x7, 0xff, 0xf8, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x7f, 0xff, 0x80, 0x0, 0x0, 0x0, 0x0,
-    0x3, 0xff, 0xf4, 0x0, 0x0, 0x0, 0x10, 0x0,
-    0x3f, 0xff, 0x0, 0x0, 0x40, 0x7, 0xd0, 0x3,
-    0xff, 0xf0, 0x0, 0xb8, 0x0, 0xff, 0xd0, 0x2f,
-    0xff, 0x1, 0xff, 0xc0, 0xf, 0xff, 0xd2, 0xff,
-    0xf1, 0xff, 0xfd, 0x1, 0xff, 0xff, 0xef, 0xff,
-    0xff, 0xff, 0xe0, 0x3f, 0xff, 0xff, 0xff, 0xff,
-    0xff, 0xff, 0x3, 0xff, 0xff, 0xff, 0xff, 0xff,
-    0xff, 0xf4, 0x7f, 0xff, 0xff, 0xff, 0xff, 0xff,
-    0xff, 0x8b, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
-    0xfc, 0x1, 0xaf, 0xff, 0xff, 0xff, 0xfe, 0x90,
-    0x0, 0x0, 0x2, 0xff, 0xff, 0xf4, 0x0, 0x0,
-    0x0, 0x0, 0x7f, 0xff, 0xff, 0x80, 0x0, 0x0,
-    0x0, 0x1f, 0xff, 0xff, 0xfe, 0x0, 0x0, 0x0,
-    0x7, 0xff, 0xff, 0xff, 0xf4, 0x0, 0x0, 0x0,
-    0xff, 0xff, 0xbf, 0xff, 0xd0, 0x0, 0x0, 0x3f,
-    0xff, 0xf2, 0xff, 0xff, 0x40, 0x0, 0xf, 0xff,
-    0xfd, 0xf, 0xff, 0xfd, 0x0, 0x2, 0xff, 0xff,
-    0xc0, 0xbf, 0xff, 0xf0, 0x0, 0xb, 0xff, 0xf4,
-    0x3, 0xff, 0xfc, 0x0, 0x0, 0x1f, 0xff, 0x0,
-    0x2f, 0xfe, 0x0, 0x0, 0x0, 0x3f, 0xc0, 0x0,
-    0xff, 0x40, 0x0, 0x0, 0x0, 0xb8, 0x0, 0x7,
-    0x80, 0x0, 0x0, 0x0, 0x1, 0x0, 0x0, 0x10,
-    0x0, 0x0,
-
-    /* U+002B "+" */
-    0x0, 0x0, 0x0, 0x6, 0xaa, 0xa9, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0xbf, 0xff, 0xd0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0xb, 0xff,
-    0xfd, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0xbf, 0xff, 0xd0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0xb, 0xff, 0xfd, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0xbf, 0xff, 0xd0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0xb, 0xff, 0xfd, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0xbf, 0xff,
-    0xd0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0xb,
-    0xff, 0xfd, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0xbf, 0xff, 0xd0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0xb, 0xff, 0xfd, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0xbf, 0xff, 0xd0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0xb, 0xff, 0xfd,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0xbf,
-    0xff, 0xd0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0xf, 0xff, 0xfe, 0x0, 0x0, 0x0, 0xf, 0xff,
-    0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xfe,
-    0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
-    0xff, 0xef, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
-    0xff, 0xff, 0xfe, 0xff, 0xff, 0xff, 0xff, 0xff,
-    0xff, 0xff, 0xff, 0xff, 0xef, 0xff, 0xff, 0xff,
-    0xff, 0xff, 0xff, 0xff, 0xff, 0xfe, 0xff, 0xff,
-    0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xef,
-    0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
-    0xfe, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
-    0xff, 0xff, 0xef, 0xff, 0xff, 0xff, 0xff, 0xff,
-    0xff, 0xff, 0xff, 0xfe, 0x0, 0x0, 0x0, 0xb,
-    0xff, 0xfd, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0xbf, 0xff, 0xd0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0xb, 0xff, 0xfd, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0xbf, 0xff, 0xd0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0xb, 0xff, 0xfd,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0xbf,
-    0xff, 0xd0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0xb, 0xff, 0xfd, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0xbf, 0xff, 0xd0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0xb, 0xff, 0xfd, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0xbf, 0xff, 0xd0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0xb, 0xff,
-    0xfd, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0xbf, 0xff, 0xd0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0xb, 0xff, 0xfd, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0xbf, 0xff, 0xd0, 0x0, 0x0,
-    0x0,
-
-    /* U+002C "," */
-    0x0, 0x5, 0x55, 0x55, 0x40, 0x3, 0xff, 0xff,
-    0xd0, 0x0, 0xff, 0xff, 0xf0, 0x0, 0x7f, 0xff,
-    0xf8, 0x0, 0x3f, 0xff, 0xfd, 0x0, 0xf, 0xff,
-    0xff, 0x0, 0x7, 0xff, 0xff, 0x80, 0x2, 0xff,
-    0xff, 0xc0, 0x0, 0xff, 0xff, 0xe0, 0x0, 0x3f,
-    0xff, 0xf4, 0x0, 0x2f, 0xff, 0xfc, 0x0, 0xf,
-    0xff, 0xfe, 0x0, 0x3, 0xff, 0xff, 0x0, 0x1,
-    0xff, 0xff, 0xc0, 0x0, 0xbf, 0xff, 0xd0, 0x0,
-    0x3f, 0xff, 0xf0, 0x0, 0x1f, 0xff, 0xf8, 0x0,
-    0xb, 0xff, 0xfd, 0x0, 0x3, 0xff, 0xff, 0x0,
-    0x0, 0xff, 0xff, 0x40, 0x0, 0x7f, 0xff, 0xc0,
-    0x0, 0x3f, 0xff, 0xe0, 0x0, 0x0,
 
     /* U+002D "-" */
     0x15, 0x55, 0x55, 0x55, 0x55, 0x54, 0xff, 0xff,
@@ -595,57 +38,6 @@ static LV_ATTRIBUTE_LARGE_CONST const uint8_t glyph_bitmap[] = {
     0xff, 0xfe, 0x3f, 0xff, 0xff, 0x8f, 0xff, 0xff,
     0xe3, 0xff, 0xff, 0xf8, 0xff, 0xff, 0xfe,
 
-    /* U+002F "/" */
-    0x0, 0x0, 0x0, 0x0, 0x1, 0x55, 0x54, 0x0,
-    0x0, 0x0, 0x0, 0x7, 0xff, 0xfc, 0x0, 0x0,
-    0x0, 0x0, 0xf, 0xff, 0xfc, 0x0, 0x0, 0x0,
-    0x0, 0xf, 0xff, 0xf8, 0x0, 0x0, 0x0, 0x0,
-    0x1f, 0xff, 0xf0, 0x0, 0x0, 0x0, 0x0, 0x3f,
-    0xff, 0xf0, 0x0, 0x0, 0x0, 0x0, 0x3f, 0xff,
-    0xe0, 0x0, 0x0, 0x0, 0x0, 0x7f, 0xff, 0xc0,
-    0x0, 0x0, 0x0, 0x0, 0xff, 0xff, 0xc0, 0x0,
-    0x0, 0x0, 0x0, 0xff, 0xff, 0x40, 0x0, 0x0,
-    0x0, 0x1, 0xff, 0xff, 0x0, 0x0, 0x0, 0x0,
-    0x3, 0xff, 0xff, 0x0, 0x0, 0x0, 0x0, 0x3,
-    0xff, 0xfd, 0x0, 0x0, 0x0, 0x0, 0xb, 0xff,
-    0xfc, 0x0, 0x0, 0x0, 0x0, 0xf, 0xff, 0xfc,
-    0x0, 0x0, 0x0, 0x0, 0xf, 0xff, 0xf4, 0x0,
-    0x0, 0x0, 0x0, 0x2f, 0xff, 0xf0, 0x0, 0x0,
-    0x0, 0x0, 0x3f, 0xff, 0xf0, 0x0, 0x0, 0x0,
-    0x0, 0x3f, 0xff, 0xd0, 0x0, 0x0, 0x0, 0x0,
-    0xbf, 0xff, 0xc0, 0x0, 0x0, 0x0, 0x0, 0xff,
-    0xff, 0xc0, 0x0, 0x0, 0x0, 0x0, 0xff, 0xff,
-    0x40, 0x0, 0x0, 0x0, 0x2, 0xff, 0xff, 0x0,
-    0x0, 0x0, 0x0, 0x3, 0xff, 0xff, 0x0, 0x0,
-    0x0, 0x0, 0x3, 0xff, 0xfd, 0x0, 0x0, 0x0,
-    0x0, 0xb, 0xff, 0xfc, 0x0, 0x0, 0x0, 0x0,
-    0xf, 0xff, 0xf8, 0x0, 0x0, 0x0, 0x0, 0xf,
-    0xff, 0xf4, 0x0, 0x0, 0x0, 0x0, 0x2f, 0xff,
-    0xf0, 0x0, 0x0, 0x0, 0x0, 0x3f, 0xff, 0xe0,
-    0x0, 0x0, 0x0, 0x0, 0x7f, 0xff, 0xd0, 0x0,
-    0x0, 0x0, 0x0, 0xbf, 0xff, 0xc0, 0x0, 0x0,
-    0x0, 0x0, 0xff, 0xff, 0x80, 0x0, 0x0, 0x0,
-    0x1, 0xff, 0xff, 0x40, 0x0, 0x0, 0x0, 0x2,
-    0xff, 0xff, 0x0, 0x0, 0x0, 0x0, 0x3, 0xff,
-    0xfe, 0x0, 0x0, 0x0, 0x0, 0x7, 0xff, 0xfd,
-    0x0, 0x0, 0x0, 0x0, 0xb, 0xff, 0xfc, 0x0,
-    0x0, 0x0, 0x0, 0xf, 0xff, 0xf8, 0x0, 0x0,
-    0x0, 0x0, 0x1f, 0xff, 0xf4, 0x0, 0x0, 0x0,
-    0x0, 0x2f, 0xff, 0xf0, 0x0, 0x0, 0x0, 0x0,
-    0x3f, 0xff, 0xe0, 0x0, 0x0, 0x0, 0x0, 0x7f,
-    0xff, 0xd0, 0x0, 0x0, 0x0, 0x0, 0xbf, 0xff,
-    0xc0, 0x0, 0x0, 0x0, 0x0, 0xff, 0xff, 0x80,
-    0x0, 0x0, 0x0, 0x1, 0xff, 0xff, 0x40, 0x0,
-    0x0, 0x0, 0x2, 0xff, 0xff, 0x0, 0x0, 0x0,
-    0x0, 0x3, 0xff, 0xfe, 0x0, 0x0, 0x0, 0x0,
-    0x7, 0xff, 0xfd, 0x0, 0x0, 0x0, 0x0, 0xb,
-    0xff, 0xfc, 0x0, 0x0, 0x0, 0x0, 0xf, 0xff,
-    0xf8, 0x0, 0x0, 0x0, 0x0, 0x1f, 0xff, 0xf4,
-    0x0, 0x0, 0x0, 0x0, 0x2f, 0xff, 0xf0, 0x0,
-    0x0, 0x0, 0x0, 0x3f, 0xff, 0xe0, 0x0, 0x0,
-    0x0, 0x0, 0x7f, 0xff, 0xd0, 0x0, 0x0, 0x0,
-    0x0,
-
     /* U+0030 "0" */
     0x0, 0x0, 0x0, 0x5, 0xaa, 0x50, 0x0, 0x0,
     0x0, 0x0, 0x0, 0x0, 0x7f, 0xff, 0xff, 0xe0,
@@ -1260,4186 +652,166 @@ static LV_ATTRIBUTE_LARGE_CONST const uint8_t glyph_bitmap[] = {
     0xff, 0xf5, 0xff, 0xff, 0xfd, 0x7f, 0xff, 0xff,
     0x5f, 0xff, 0xff, 0xd7, 0xff, 0xff, 0xf4,
 
-    /* U+003B ";" */
-    0x0, 0xf, 0xff, 0xff, 0xd0, 0x1, 0xff, 0xff,
-    0xfe, 0x0, 0x1f, 0xff, 0xff, 0xe0, 0x1, 0xff,
-    0xff, 0xfe, 0x0, 0x1f, 0xff, 0xff, 0xe0, 0x1,
-    0xff, 0xff, 0xfe, 0x0, 0x1f, 0xff, 0xff, 0xe0,
-    0x1, 0xff, 0xff, 0xfe, 0x0, 0x1f, 0xff, 0xff,
-    0xe0, 0x1, 0xff, 0xff, 0xfe, 0x0, 0x1f, 0xff,
-    0xff, 0xe0, 0x1, 0xff, 0xff, 0xfe, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x15, 0x55, 0x54, 0x0, 0x7,
-    0xff, 0xff, 0xc0, 0x0, 0xbf, 0xff, 0xf8, 0x0,
-    0xf, 0xff, 0xff, 0x0, 0x1, 0xff, 0xff, 0xf0,
-    0x0, 0x2f, 0xff, 0xfd, 0x0, 0x3, 0xff, 0xff,
-    0xc0, 0x0, 0x3f, 0xff, 0xf8, 0x0, 0x7, 0xff,
-    0xff, 0x0, 0x0, 0xbf, 0xff, 0xf0, 0x0, 0xf,
-    0xff, 0xfd, 0x0, 0x1, 0xff, 0xff, 0xc0, 0x0,
-    0x2f, 0xff, 0xf8, 0x0, 0x3, 0xff, 0xff, 0x40,
-    0x0, 0x3f, 0xff, 0xf0, 0x0, 0xb, 0xff, 0xfe,
-    0x0, 0x0, 0xff, 0xff, 0xc0, 0x0, 0xf, 0xff,
-    0xfc, 0x0, 0x1, 0xff, 0xff, 0x40, 0x0, 0x2f,
-    0xff, 0xf0, 0x0, 0x3, 0xff, 0xfe, 0x0, 0x0,
-    0x7f, 0xff, 0xc0, 0x0, 0x0,
-
-    /* U+003C "<" */
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x50, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0xbe, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x1, 0xbf, 0xe0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x1, 0xff, 0xfe, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x2, 0xff, 0xff, 0xe0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x7, 0xff, 0xff,
-    0xfe, 0x0, 0x0, 0x0, 0x0, 0x0, 0xb, 0xff,
-    0xff, 0xff, 0xe0, 0x0, 0x0, 0x0, 0x0, 0x1f,
-    0xff, 0xff, 0xff, 0xfe, 0x0, 0x0, 0x0, 0x0,
-    0x2f, 0xff, 0xff, 0xff, 0xff, 0xe0, 0x0, 0x0,
-    0x0, 0x6f, 0xff, 0xff, 0xff, 0xff, 0xfd, 0x0,
-    0x0, 0x0, 0xbf, 0xff, 0xff, 0xff, 0xff, 0xfd,
-    0x0, 0x0, 0x1, 0xbf, 0xff, 0xff, 0xff, 0xff,
-    0xf8, 0x0, 0x0, 0x1, 0xff, 0xff, 0xff, 0xff,
-    0xff, 0xe4, 0x0, 0x0, 0x2, 0xff, 0xff, 0xff,
-    0xff, 0xff, 0xd0, 0x0, 0x0, 0x7, 0xff, 0xff,
-    0xff, 0xff, 0xff, 0x90, 0x0, 0x0, 0xb, 0xff,
-    0xff, 0xff, 0xff, 0xff, 0x40, 0x0, 0x0, 0x0,
-    0xff, 0xff, 0xff, 0xff, 0xfe, 0x0, 0x0, 0x0,
-    0x0, 0xf, 0xff, 0xff, 0xff, 0xfd, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0xff, 0xff, 0xff, 0xf8, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0xf, 0xff, 0xff, 0xf4,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0xff, 0xff,
-    0xe0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0xf,
-    0xff, 0xf9, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0xff, 0xff, 0xfe, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0xf, 0xff, 0xff, 0xfe, 0x40, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0xff, 0xff, 0xff, 0xff,
-    0x80, 0x0, 0x0, 0x0, 0x0, 0xf, 0xff, 0xff,
-    0xff, 0xff, 0xd0, 0x0, 0x0, 0x0, 0x0, 0xff,
-    0xff, 0xff, 0xff, 0xff, 0xe0, 0x0, 0x0, 0x0,
-    0x1, 0xbf, 0xff, 0xff, 0xff, 0xff, 0xf4, 0x0,
-    0x0, 0x0, 0x0, 0xbf, 0xff, 0xff, 0xff, 0xff,
-    0xf8, 0x0, 0x0, 0x0, 0x0, 0x6f, 0xff, 0xff,
-    0xff, 0xff, 0xfd, 0x0, 0x0, 0x0, 0x0, 0x2f,
-    0xff, 0xff, 0xff, 0xff, 0xfe, 0x40, 0x0, 0x0,
-    0x0, 0x1f, 0xff, 0xff, 0xff, 0xff, 0xff, 0x80,
-    0x0, 0x0, 0x0, 0xb, 0xff, 0xff, 0xff, 0xff,
-    0xff, 0x80, 0x0, 0x0, 0x0, 0x7, 0xff, 0xff,
-    0xff, 0xff, 0xfe, 0x0, 0x0, 0x0, 0x0, 0x2,
-    0xff, 0xff, 0xff, 0xff, 0xe0, 0x0, 0x0, 0x0,
-    0x0, 0x1, 0xff, 0xff, 0xff, 0xfe, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x1, 0xbf, 0xff, 0xff, 0xe0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x7f, 0xff,
-    0xfe, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x6f, 0xff, 0xe0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x2f, 0xfe, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x1f, 0xe0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0xa, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x0,
+    /* U+0057 "W" */
+    0x55, 0x55, 0x55, 0x40, 0x0, 0x0, 0x1, 0x55,
+    0x55, 0x50, 0x0, 0x0, 0x0, 0x15, 0x55, 0x55,
+    0x4b, 0xff, 0xff, 0xf8, 0x0, 0x0, 0x0, 0x3f,
+    0xff, 0xff, 0x0, 0x0, 0x0, 0x7, 0xff, 0xff,
+    0xfc, 0x7f, 0xff, 0xff, 0xc0, 0x0, 0x0, 0x3,
+    0xff, 0xff, 0xf4, 0x0, 0x0, 0x0, 0xbf, 0xff,
+    0xff, 0x83, 0xff, 0xff, 0xfc, 0x0, 0x0, 0x0,
+    0x7f, 0xff, 0xff, 0x80, 0x0, 0x0, 0xf, 0xff,
+    0xff, 0xf4, 0x3f, 0xff, 0xff, 0xc0, 0x0, 0x0,
+    0xb, 0xff, 0xff, 0xfc, 0x0, 0x0, 0x0, 0xff,
+    0xff, 0xff, 0x2, 0xff, 0xff, 0xfd, 0x0, 0x0,
+    0x0, 0xff, 0xff, 0xff, 0xc0, 0x0, 0x0, 0xf,
+    0xff, 0xff, 0xf0, 0x1f, 0xff, 0xff, 0xe0, 0x0,
+    0x0, 0xf, 0xff, 0xff, 0xfc, 0x0, 0x0, 0x1,
+    0xff, 0xff, 0xfe, 0x0, 0xff, 0xff, 0xff, 0x0,
+    0x0, 0x0, 0xff, 0xff, 0xff, 0xd0, 0x0, 0x0,
+    0x2f, 0xff, 0xff, 0xd0, 0xf, 0xff, 0xff, 0xf0,
+    0x0, 0x0, 0x1f, 0xff, 0xff, 0xfe, 0x0, 0x0,
+    0x3, 0xff, 0xff, 0xfc, 0x0, 0xbf, 0xff, 0xff,
+    0x0, 0x0, 0x2, 0xff, 0xff, 0xff, 0xe0, 0x0,
+    0x0, 0x3f, 0xff, 0xff, 0xc0, 0x7, 0xff, 0xff,
+    0xf4, 0x0, 0x0, 0x2f, 0xff, 0xff, 0xff, 0x0,
+    0x0, 0x3, 0xff, 0xff, 0xf8, 0x0, 0x7f, 0xff,
+    0xff, 0x80, 0x0, 0x3, 0xff, 0xff, 0xff, 0xf0,
+    0x0, 0x0, 0x7f, 0xff, 0xff, 0x40, 0x3, 0xff,
+    0xff, 0xf8, 0x0, 0x0, 0x3f, 0xff, 0xff, 0xff,
+    0x40, 0x0, 0xb, 0xff, 0xff, 0xf0, 0x0, 0x3f,
+    0xff, 0xff, 0xc0, 0x0, 0x7, 0xff, 0xff, 0xff,
+    0xf4, 0x0, 0x0, 0xbf, 0xff, 0xff, 0x0, 0x2,
+    0xff, 0xff, 0xfc, 0x0, 0x0, 0x7f, 0xff, 0xff,
+    0xff, 0x80, 0x0, 0xf, 0xff, 0xff, 0xe0, 0x0,
+    0x1f, 0xff, 0xff, 0xd0, 0x0, 0xb, 0xff, 0xff,
+    0xff, 0xfc, 0x0, 0x0, 0xff, 0xff, 0xfd, 0x0,
+    0x0, 0xff, 0xff, 0xfd, 0x0, 0x0, 0xff, 0xff,
+    0xff, 0xff, 0xc0, 0x0, 0x1f, 0xff, 0xff, 0xc0,
+    0x0, 0xf, 0xff, 0xff, 0xe0, 0x0, 0xf, 0xff,
+    0xff, 0xff, 0xfc, 0x0, 0x1, 0xff, 0xff, 0xfc,
+    0x0, 0x0, 0xbf, 0xff, 0xff, 0x0, 0x0, 0xff,
+    0xff, 0xbf, 0xff, 0xd0, 0x0, 0x2f, 0xff, 0xff,
+    0x80, 0x0, 0x7, 0xff, 0xff, 0xf0, 0x0, 0x1f,
+    0xff, 0xf7, 0xff, 0xfe, 0x0, 0x3, 0xff, 0xff,
+    0xf4, 0x0, 0x0, 0x3f, 0xff, 0xff, 0x0, 0x2,
+    0xff, 0xff, 0x3f, 0xff, 0xf0, 0x0, 0x3f, 0xff,
+    0xff, 0x0, 0x0, 0x3, 0xff, 0xff, 0xf4, 0x0,
+    0x3f, 0xff, 0xf2, 0xff, 0xff, 0x0, 0x7, 0xff,
+    0xff, 0xf0, 0x0, 0x0, 0x2f, 0xff, 0xff, 0x80,
+    0x3, 0xff, 0xff, 0x2f, 0xff, 0xf0, 0x0, 0x7f,
+    0xff, 0xff, 0x0, 0x0, 0x1, 0xff, 0xff, 0xfc,
+    0x0, 0x3f, 0xff, 0xe1, 0xff, 0xff, 0x40, 0xb,
+    0xff, 0xff, 0xe0, 0x0, 0x0, 0xf, 0xff, 0xff,
+    0xc0, 0x7, 0xff, 0xfd, 0xf, 0xff, 0xf8, 0x0,
+    0xff, 0xff, 0xfd, 0x0, 0x0, 0x0, 0xff, 0xff,
+    0xfc, 0x0, 0xbf, 0xff, 0xc0, 0xff, 0xff, 0x80,
+    0xf, 0xff, 0xff, 0xc0, 0x0, 0x0, 0xb, 0xff,
+    0xff, 0xd0, 0xf, 0xff, 0xfc, 0xf, 0xff, 0xfc,
+    0x0, 0xff, 0xff, 0xfc, 0x0, 0x0, 0x0, 0x7f,
+    0xff, 0xfe, 0x0, 0xff, 0xff, 0xc0, 0xbf, 0xff,
+    0xc0, 0x1f, 0xff, 0xff, 0x80, 0x0, 0x0, 0x3,
+    0xff, 0xff, 0xe0, 0xf, 0xff, 0xf8, 0x7, 0xff,
+    0xfd, 0x2, 0xff, 0xff, 0xf4, 0x0, 0x0, 0x0,
+    0x3f, 0xff, 0xff, 0x1, 0xff, 0xff, 0x80, 0x7f,
+    0xff, 0xd0, 0x3f, 0xff, 0xff, 0x0, 0x0, 0x0,
+    0x2, 0xff, 0xff, 0xf0, 0x2f, 0xff, 0xf4, 0x3,
+    0xff, 0xfe, 0x3, 0xff, 0xff, 0xf0, 0x0, 0x0,
+    0x0, 0x1f, 0xff, 0xff, 0x42, 0xff, 0xff, 0x0,
+    0x3f, 0xff, 0xf0, 0x3f, 0xff, 0xfe, 0x0, 0x0,
+    0x0, 0x0, 0xff, 0xff, 0xf8, 0x3f, 0xff, 0xf0,
+    0x3, 0xff, 0xff, 0x7, 0xff, 0xff, 0xd0, 0x0,
+    0x0, 0x0, 0xf, 0xff, 0xff, 0x83, 0xff, 0xff,
+    0x0, 0x2f, 0xff, 0xf4, 0xbf, 0xff, 0xfc, 0x0,
+    0x0, 0x0, 0x0, 0xbf, 0xff, 0xfc, 0x7f, 0xff,
+    0xe0, 0x1, 0xff, 0xff, 0x4b, 0xff, 0xff, 0xc0,
+    0x0, 0x0, 0x0, 0x7, 0xff, 0xff, 0xc7, 0xff,
+    0xfd, 0x0, 0x1f, 0xff, 0xf8, 0xff, 0xff, 0xf8,
+    0x0, 0x0, 0x0, 0x0, 0x3f, 0xff, 0xfd, 0xbf,
+    0xff, 0xd0, 0x0, 0xff, 0xff, 0xcf, 0xff, 0xff,
+    0x40, 0x0, 0x0, 0x0, 0x3, 0xff, 0xff, 0xdf,
+    0xff, 0xfc, 0x0, 0xf, 0xff, 0xfd, 0xff, 0xff,
+    0xf0, 0x0, 0x0, 0x0, 0x0, 0x2f, 0xff, 0xff,
+    0xff, 0xff, 0xc0, 0x0, 0xff, 0xff, 0xff, 0xff,
+    0xff, 0x0, 0x0, 0x0, 0x0, 0x1, 0xff, 0xff,
+    0xff, 0xff, 0xfc, 0x0, 0xb, 0xff, 0xff, 0xff,
+    0xff, 0xe0, 0x0, 0x0, 0x0, 0x0, 0xf, 0xff,
+    0xff, 0xff, 0xff, 0x80, 0x0, 0x7f, 0xff, 0xff,
+    0xff, 0xfd, 0x0, 0x0, 0x0, 0x0, 0x0, 0xff,
+    0xff, 0xff, 0xff, 0xf4, 0x0, 0x3, 0xff, 0xff,
+    0xff, 0xff, 0xc0, 0x0, 0x0, 0x0, 0x0, 0xb,
+    0xff, 0xff, 0xff, 0xff, 0x40, 0x0, 0x3f, 0xff,
+    0xff, 0xff, 0xfc, 0x0, 0x0, 0x0, 0x0, 0x0,
+    0xbf, 0xff, 0xff, 0xff, 0xf0, 0x0, 0x3, 0xff,
+    0xff, 0xff, 0xff, 0x80, 0x0, 0x0, 0x0, 0x0,
+    0x7, 0xff, 0xff, 0xff, 0xff, 0x0, 0x0, 0x2f,
+    0xff, 0xff, 0xff, 0xf4, 0x0, 0x0, 0x0, 0x0,
+    0x0, 0x3f, 0xff, 0xff, 0xff, 0xf0, 0x0, 0x2,
+    0xff, 0xff, 0xff, 0xff, 0x0, 0x0, 0x0, 0x0,
+    0x0, 0x3, 0xff, 0xff, 0xff, 0xfe, 0x0, 0x0,
+    0x1f, 0xff, 0xff, 0xff, 0xf0, 0x0, 0x0, 0x0,
+    0x0, 0x0, 0x2f, 0xff, 0xff, 0xff, 0xd0, 0x0,
+    0x0, 0xff, 0xff, 0xff, 0xfe, 0x0, 0x0, 0x0,
+    0x0, 0x0, 0x1, 0xff, 0xff, 0xff, 0xfc, 0x0,
+    0x0, 0xf, 0xff, 0xff, 0xff, 0xd0, 0x0, 0x0,
+    0x0, 0x0, 0x0, 0xf, 0xff, 0xff, 0xff, 0xc0,
+    0x0, 0x0, 0xff, 0xff, 0xff, 0xfc, 0x0, 0x0,
+    0x0, 0x0, 0x0, 0x0, 0xff, 0xff, 0xff, 0xfc,
+    0x0, 0x0, 0xb, 0xff, 0xff, 0xff, 0xc0, 0x0,
+    0x0, 0x0
+};
 
-    /* U+003D "=" */
-    0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
-    0xff, 0xef, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
-    0xff, 0xff, 0xfe, 0xff, 0xff, 0xff, 0xff, 0xff,
-    0xff, 0xff, 0xff, 0xff, 0xef, 0xff, 0xff, 0xff,
-    0xff, 0xff, 0xff, 0xff, 0xff, 0xfe, 0xff, 0xff,
-    0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xef,
-    0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
-    0xfe, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
-    0xff, 0xff, 0xef, 0xff, 0xff, 0xff, 0xff, 0xff,
-    0xff, 0xff, 0xff, 0xfe, 0xff, 0xff, 0xff, 0xff,
-    0xff, 0xff, 0xff, 0xff, 0xff, 0xea, 0xaa, 0xaa,
-    0xaa, 0xaa, 0xaa, 0xaa, 0xaa, 0xaa, 0xa9, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0xaa, 0xaa, 0xaa, 0xaa, 0xaa,
-    0xaa, 0xaa, 0xaa, 0xaa, 0x9f, 0xff, 0xff, 0xff,
-    0xff, 0xff, 0xff, 0xff, 0xff, 0xfe, 0xff, 0xff,
-    0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xef,
-    0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
-    0xfe, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
-    0xff, 0xff, 0xef, 0xff, 0xff, 0xff, 0xff, 0xff,
-    0xff, 0xff, 0xff, 0xfe, 0xff, 0xff, 0xff, 0xff,
-    0xff, 0xff, 0xff, 0xff, 0xff, 0xef, 0xff, 0xff,
-    0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xfe, 0xff,
-    0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
-    0xef, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
-    0xff, 0xfe,
 
-    /* U+003E ">" */
-    0x80, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0xf, 0xd0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0xff, 0xe0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0xf, 0xff, 0xe4, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0xff, 0xff,
-    0xf8, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0xf,
-    0xff, 0xff, 0xf9, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0xff, 0xff, 0xff, 0xfd, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0xf, 0xff, 0xff, 0xff, 0xfe, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0xff, 0xff, 0xff, 0xff,
-    0xff, 0x40, 0x0, 0x0, 0x0, 0xb, 0xff, 0xff,
-    0xff, 0xff, 0xff, 0x80, 0x0, 0x0, 0x0, 0x7,
-    0xff, 0xff, 0xff, 0xff, 0xff, 0xd0, 0x0, 0x0,
-    0x0, 0x6, 0xff, 0xff, 0xff, 0xff, 0xff, 0xe0,
-    0x0, 0x0, 0x0, 0x1, 0xff, 0xff, 0xff, 0xff,
-    0xff, 0xe4, 0x0, 0x0, 0x0, 0x0, 0xbf, 0xff,
-    0xff, 0xff, 0xff, 0xf8, 0x0, 0x0, 0x0, 0x0,
-    0x7f, 0xff, 0xff, 0xff, 0xff, 0xf9, 0x0, 0x0,
-    0x0, 0x0, 0x2f, 0xff, 0xff, 0xff, 0xff, 0xfd,
-    0x0, 0x0, 0x0, 0x0, 0x1b, 0xff, 0xff, 0xff,
-    0xff, 0xe0, 0x0, 0x0, 0x0, 0x0, 0xb, 0xff,
-    0xff, 0xff, 0xfe, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x6, 0xff, 0xff, 0xff, 0xe0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x1, 0xff, 0xff, 0xfe, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x1, 0xbf, 0xff, 0xe0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x7, 0xff,
-    0xfe, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0xb,
-    0xff, 0xff, 0xe0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x1f, 0xff, 0xff, 0xfe, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x6f, 0xff, 0xff, 0xff, 0xe0, 0x0, 0x0,
-    0x0, 0x0, 0x7f, 0xff, 0xff, 0xff, 0xfe, 0x0,
-    0x0, 0x0, 0x1, 0xbf, 0xff, 0xff, 0xff, 0xff,
-    0xd0, 0x0, 0x0, 0x2, 0xff, 0xff, 0xff, 0xff,
-    0xff, 0xe0, 0x0, 0x0, 0x7, 0xff, 0xff, 0xff,
-    0xff, 0xff, 0xd0, 0x0, 0x0, 0xb, 0xff, 0xff,
-    0xff, 0xff, 0xff, 0x80, 0x0, 0x0, 0x1f, 0xff,
-    0xff, 0xff, 0xff, 0xff, 0x40, 0x0, 0x0, 0x2f,
-    0xff, 0xff, 0xff, 0xff, 0xfe, 0x0, 0x0, 0x0,
-    0x7f, 0xff, 0xff, 0xff, 0xff, 0xfd, 0x0, 0x0,
-    0x0, 0xf, 0xff, 0xff, 0xff, 0xff, 0xf9, 0x0,
-    0x0, 0x0, 0x0, 0xff, 0xff, 0xff, 0xff, 0xf8,
-    0x0, 0x0, 0x0, 0x0, 0xf, 0xff, 0xff, 0xff,
-    0xe4, 0x0, 0x0, 0x0, 0x0, 0x0, 0xff, 0xff,
-    0xff, 0xe0, 0x0, 0x0, 0x0, 0x0, 0x0, 0xf,
-    0xff, 0xff, 0xd0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0xff, 0xff, 0x80, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0xf, 0xff, 0x40, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0xfe, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0xd, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x0,
+/*---------------------
+ *  GLYPH DESCRIPTION
+ *--------------------*/
 
-    /* U+003F "?" */
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x6b, 0xff, 0xff, 0xfa, 0x40, 0x0, 0x3, 0xff,
-    0xff, 0xff, 0xff, 0xff, 0x40, 0x1, 0xff, 0xff,
-    0xff, 0xff, 0xff, 0xfd, 0x0, 0x7f, 0xff, 0xff,
-    0xff, 0xff, 0xff, 0xd0, 0x1f, 0xff, 0xff, 0xff,
-    0xff, 0xff, 0xfc, 0x7, 0xff, 0xff, 0xff, 0xff,
-    0xff, 0xff, 0xc1, 0xff, 0xff, 0xff, 0xff, 0xff,
-    0xff, 0xf4, 0x7f, 0xff, 0xff, 0xff, 0xff, 0xff,
-    0xfe, 0x1f, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
-    0xc7, 0xe5, 0x0, 0x1, 0xbf, 0xff, 0xff, 0xf0,
-    0x0, 0x0, 0x0, 0x3, 0xff, 0xff, 0xfc, 0x0,
-    0x0, 0x0, 0x0, 0x7f, 0xff, 0xff, 0x40, 0x0,
-    0x0, 0x0, 0xf, 0xff, 0xff, 0xd0, 0x0, 0x0,
-    0x0, 0x3, 0xff, 0xff, 0xf4, 0x0, 0x0, 0x0,
-    0x0, 0xff, 0xff, 0xfc, 0x0, 0x0, 0x0, 0x0,
-    0x3f, 0xff, 0xff, 0x0, 0x0, 0x0, 0x0, 0xf,
-    0xff, 0xff, 0xc0, 0x0, 0x0, 0x0, 0x7, 0xff,
-    0xff, 0xf0, 0x0, 0x0, 0x0, 0x3, 0xff, 0xff,
-    0xf8, 0x0, 0x0, 0x0, 0x3, 0xff, 0xff, 0xfd,
-    0x0, 0x0, 0x0, 0x3, 0xff, 0xff, 0xff, 0x0,
-    0x0, 0x0, 0x3, 0xff, 0xff, 0xff, 0x0, 0x0,
-    0x0, 0x3, 0xff, 0xff, 0xff, 0x40, 0x0, 0x0,
-    0x3, 0xff, 0xff, 0xff, 0x40, 0x0, 0x0, 0x3,
-    0xff, 0xff, 0xff, 0x40, 0x0, 0x0, 0x2, 0xff,
-    0xff, 0xff, 0x0, 0x0, 0x0, 0x0, 0xff, 0xff,
-    0xff, 0x0, 0x0, 0x0, 0x0, 0xbf, 0xff, 0xfe,
-    0x0, 0x0, 0x0, 0x0, 0x3f, 0xff, 0xfe, 0x0,
-    0x0, 0x0, 0x0, 0xf, 0xff, 0xfe, 0x0, 0x0,
-    0x0, 0x0, 0x3, 0xff, 0xff, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0xff, 0xff, 0x80, 0x0, 0x0, 0x0,
-    0x0, 0x3f, 0xff, 0xe0, 0x0, 0x0, 0x0, 0x0,
-    0xf, 0xff, 0xf8, 0x0, 0x0, 0x0, 0x0, 0x1,
-    0x55, 0x55, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x6, 0xaa, 0xaa, 0xa0, 0x0,
-    0x0, 0x0, 0x2, 0xff, 0xff, 0xfc, 0x0, 0x0,
-    0x0, 0x0, 0xbf, 0xff, 0xff, 0x0, 0x0, 0x0,
-    0x0, 0x2f, 0xff, 0xff, 0xc0, 0x0, 0x0, 0x0,
-    0xb, 0xff, 0xff, 0xf0, 0x0, 0x0, 0x0, 0x2,
-    0xff, 0xff, 0xfc, 0x0, 0x0, 0x0, 0x0, 0xbf,
-    0xff, 0xff, 0x0, 0x0, 0x0, 0x0, 0x2f, 0xff,
-    0xff, 0xc0, 0x0, 0x0, 0x0, 0xb, 0xff, 0xff,
-    0xf0, 0x0, 0x0, 0x0, 0x2, 0xff, 0xff, 0xfc,
-    0x0, 0x0, 0x0, 0x0, 0xbf, 0xff, 0xff, 0x0,
-    0x0, 0x0, 0x0, 0x2f, 0xff, 0xff, 0xc0, 0x0,
-    0x0,
+static const lv_font_fmt_txt_glyph_dsc_t glyph_dsc[] = {
+    {.bitmap_index = 0, .adv_w = 0, .box_w = 0, .box_h = 0, .ofs_x = 0, .ofs_y = 0} /* id = 0 reserved */,
+    {.bitmap_index = 0, .adv_w = 300, .box_w = 0, .box_h = 0, .ofs_x = 0, .ofs_y = 0},
+    {.bitmap_index = 0, .adv_w = 507, .box_w = 23, .box_h = 9, .ofs_x = 4, .ofs_y = 18},
+    {.bitmap_index = 52, .adv_w = 379, .box_w = 13, .box_h = 12, .ofs_x = 5, .ofs_y = 0},
+    {.bitmap_index = 91, .adv_w = 680, .box_w = 37, .box_h = 53, .ofs_x = 3, .ofs_y = -1},
+    {.bitmap_index = 582, .adv_w = 484, .box_w = 21, .box_h = 51, .ofs_x = 3, .ofs_y = 0},
+    {.bitmap_index = 850, .adv_w = 680, .box_w = 36, .box_h = 52, .ofs_x = 3, .ofs_y = 0},
+    {.bitmap_index = 1318, .adv_w = 680, .box_w = 35, .box_h = 53, .ofs_x = 4, .ofs_y = -1},
+    {.bitmap_index = 1782, .adv_w = 680, .box_w = 38, .box_h = 51, .ofs_x = 2, .ofs_y = 0},
+    {.bitmap_index = 2267, .adv_w = 680, .box_w = 35, .box_h = 52, .ofs_x = 4, .ofs_y = -1},
+    {.bitmap_index = 2722, .adv_w = 680, .box_w = 37, .box_h = 53, .ofs_x = 3, .ofs_y = -1},
+    {.bitmap_index = 3213, .adv_w = 634, .box_w = 36, .box_h = 51, .ofs_x = 3, .ofs_y = 0},
+    {.bitmap_index = 3672, .adv_w = 680, .box_w = 38, .box_h = 53, .ofs_x = 2, .ofs_y = -1},
+    {.bitmap_index = 4176, .adv_w = 680, .box_w = 37, .box_h = 53, .ofs_x = 3, .ofs_y = -1},
+    {.bitmap_index = 4667, .adv_w = 465, .box_w = 13, .box_h = 39, .ofs_x = 8, .ofs_y = 0},
+    {.bitmap_index = 4794, .adv_w = 1075, .box_w = 66, .box_h = 51, .ofs_x = 1, .ofs_y = 0}
+};
 
-    /* U+0040 "@" */
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x5b, 0xff,
-    0xff, 0x94, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x2, 0xff, 0xff, 0xff, 0xff,
-    0xfe, 0x40, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x7, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
-    0x40, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x7,
-    0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0x40,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x7, 0xff, 0xff,
-    0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x2, 0xff, 0xff, 0xff, 0xff,
-    0xff, 0xff, 0xff, 0xff, 0xfd, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
-    0xff, 0xff, 0xff, 0xf8, 0x0, 0x0, 0x0, 0x0,
-    0x3f, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
-    0xff, 0xff, 0xd0, 0x0, 0x0, 0x0, 0x1f, 0xff,
-    0xff, 0xff, 0xf9, 0x50, 0x15, 0xbf, 0xff, 0xff,
-    0xff, 0x40, 0x0, 0x0, 0x3, 0xff, 0xff, 0xff,
-    0xe0, 0x0, 0x0, 0x0, 0x1b, 0xff, 0xff, 0xfc,
-    0x0, 0x0, 0x0, 0xff, 0xff, 0xff, 0xd0, 0x0,
-    0x0, 0x0, 0x0, 0xb, 0xff, 0xff, 0xf0, 0x0,
-    0x0, 0x2f, 0xff, 0xff, 0xe0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x1f, 0xff, 0xff, 0x40, 0x0, 0xb,
-    0xff, 0xff, 0xf0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x3f, 0xff, 0xfc, 0x0, 0x1, 0xff, 0xff,
-    0xfc, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0xff, 0xff, 0xd0, 0x0, 0x3f, 0xff, 0xff, 0x0,
-    0x0, 0x6, 0xba, 0x40, 0x0, 0x0, 0x7, 0xff,
-    0xfe, 0x0, 0x7, 0xff, 0xff, 0xc0, 0x0, 0xb,
-    0xff, 0xff, 0x7, 0xff, 0xf0, 0x2f, 0xff, 0xf0,
-    0x0, 0xff, 0xff, 0xf0, 0x0, 0x7, 0xff, 0xff,
-    0xfc, 0xbf, 0xff, 0x0, 0xff, 0xff, 0x40, 0x1f,
-    0xff, 0xfd, 0x0, 0x2, 0xff, 0xff, 0xff, 0xfb,
-    0xff, 0xe0, 0xf, 0xff, 0xf8, 0x3, 0xff, 0xff,
-    0xc0, 0x0, 0xbf, 0xff, 0xff, 0xff, 0xff, 0xfd,
-    0x0, 0x7f, 0xff, 0xc0, 0x7f, 0xff, 0xf0, 0x0,
-    0x2f, 0xff, 0xff, 0xff, 0xff, 0xff, 0xd0, 0x3,
-    0xff, 0xfc, 0xb, 0xff, 0xff, 0x0, 0x7, 0xff,
-    0xff, 0xff, 0xff, 0xff, 0xfc, 0x0, 0x3f, 0xff,
-    0xc0, 0xff, 0xff, 0xd0, 0x0, 0xff, 0xff, 0xff,
-    0xff, 0xff, 0xff, 0xc0, 0x3, 0xff, 0xfc, 0xf,
-    0xff, 0xfc, 0x0, 0x2f, 0xff, 0xff, 0x41, 0xff,
-    0xff, 0xfc, 0x0, 0x3f, 0xff, 0xc1, 0xff, 0xff,
-    0x80, 0x3, 0xff, 0xff, 0xc0, 0x3, 0xff, 0xff,
-    0x80, 0x2, 0xff, 0xfc, 0x2f, 0xff, 0xf4, 0x0,
-    0x7f, 0xff, 0xf0, 0x0, 0x2f, 0xff, 0xf4, 0x0,
-    0x2f, 0xff, 0xc3, 0xff, 0xff, 0x0, 0xf, 0xff,
-    0xfd, 0x0, 0x1, 0xff, 0xff, 0x0, 0x2, 0xff,
-    0xfc, 0x3f, 0xff, 0xf0, 0x0, 0xff, 0xff, 0xc0,
-    0x0, 0x1f, 0xff, 0xf0, 0x0, 0x2f, 0xff, 0xc3,
-    0xff, 0xfe, 0x0, 0x1f, 0xff, 0xf8, 0x0, 0x1,
-    0xff, 0xff, 0x0, 0x3, 0xff, 0xfc, 0x7f, 0xff,
-    0xe0, 0x2, 0xff, 0xff, 0x0, 0x0, 0x2f, 0xff,
-    0xe0, 0x0, 0x3f, 0xff, 0xc7, 0xff, 0xfe, 0x0,
-    0x2f, 0xff, 0xf0, 0x0, 0x3, 0xff, 0xfe, 0x0,
-    0x3, 0xff, 0xf8, 0x7f, 0xff, 0xd0, 0x3, 0xff,
-    0xff, 0x0, 0x0, 0x3f, 0xff, 0xd0, 0x0, 0x3f,
-    0xff, 0x87, 0xff, 0xfd, 0x0, 0x3f, 0xff, 0xf0,
-    0x0, 0x7, 0xff, 0xfc, 0x0, 0x7, 0xff, 0xf4,
-    0x7f, 0xff, 0xd0, 0x3, 0xff, 0xfe, 0x0, 0x0,
-    0xbf, 0xff, 0xc0, 0x0, 0x7f, 0xff, 0x7, 0xff,
-    0xfd, 0x0, 0x3f, 0xff, 0xf0, 0x0, 0xf, 0xff,
-    0xfc, 0x0, 0xf, 0xff, 0xf0, 0x7f, 0xff, 0xe0,
-    0x3, 0xff, 0xff, 0x0, 0x2, 0xff, 0xff, 0xc0,
-    0x0, 0xff, 0xfe, 0x3, 0xff, 0xfe, 0x0, 0x3f,
-    0xff, 0xf4, 0x0, 0x7f, 0xff, 0xfc, 0x0, 0x2f,
-    0xff, 0xc0, 0x3f, 0xff, 0xe0, 0x2, 0xff, 0xff,
-    0xd0, 0x2f, 0xff, 0xff, 0xe0, 0x7, 0xff, 0xf8,
-    0x3, 0xff, 0xff, 0x0, 0x1f, 0xff, 0xff, 0xff,
-    0xff, 0xff, 0xff, 0x41, 0xff, 0xff, 0x0, 0x3f,
-    0xff, 0xf0, 0x0, 0xff, 0xff, 0xff, 0xff, 0xff,
-    0xff, 0xff, 0xff, 0xff, 0xe0, 0x2, 0xff, 0xff,
-    0x40, 0xb, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
-    0xff, 0xff, 0xfc, 0x0, 0x1f, 0xff, 0xf8, 0x0,
-    0x3f, 0xff, 0xff, 0xff, 0xfe, 0xff, 0xff, 0xff,
-    0xff, 0x0, 0x0, 0xff, 0xff, 0xc0, 0x1, 0xff,
-    0xff, 0xff, 0xff, 0xf, 0xff, 0xff, 0xff, 0xd0,
-    0x0, 0xf, 0xff, 0xfe, 0x0, 0x7, 0xff, 0xff,
-    0xff, 0x80, 0x3f, 0xff, 0xff, 0xf4, 0x0, 0x0,
-    0xbf, 0xff, 0xf0, 0x0, 0x1f, 0xff, 0xff, 0xd0,
-    0x0, 0xbf, 0xff, 0xf8, 0x0, 0x0, 0x3, 0xff,
-    0xff, 0xc0, 0x0, 0x1b, 0xff, 0x90, 0x0, 0x0,
-    0xaf, 0xe4, 0x0, 0x0, 0x0, 0x2f, 0xff, 0xff,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0xff, 0xff, 0xf8, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0xb, 0xff, 0xff, 0xf4, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x3f, 0xff, 0xff, 0xe4, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0xff, 0xff, 0xff, 0xf4, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x3, 0xff,
-    0xff, 0xff, 0xff, 0x95, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x1f, 0xff, 0xff,
-    0xff, 0xff, 0xff, 0x80, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x7f, 0xff, 0xff, 0xff,
-    0xff, 0xf8, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0xbf, 0xff, 0xff, 0xff, 0xff,
-    0x40, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x1, 0xff, 0xff, 0xff, 0xff, 0xf4, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x2, 0xff, 0xff, 0xff, 0xff, 0x40, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x1,
-    0xff, 0xff, 0xff, 0xf4, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x6f,
-    0xff, 0xff, 0x40, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x6, 0xaf,
-    0xf4, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
+/*---------------------
+ *  CHARACTER MAPPING
+ *--------------------*/
 
-    /* U+0041 "A" */
-    0x0, 0x0, 0x0, 0x1, 0x55, 0x55, 0x55, 0x55,
-    0x54, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x3f, 0xff, 0xff, 0xff, 0xff, 0xd0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x7, 0xff, 0xff, 0xff,
-    0xff, 0xfe, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0xbf, 0xff, 0xff, 0xff, 0xff, 0xf0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0xf, 0xff, 0xff,
-    0xff, 0xff, 0xff, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0xff, 0xff, 0xff, 0xff, 0xff, 0xf4,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x2f, 0xff,
-    0xff, 0xff, 0xff, 0xff, 0x80, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x3, 0xff, 0xff, 0xfe, 0xff, 0xff,
-    0xfc, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x3f,
-    0xff, 0xff, 0x9f, 0xff, 0xff, 0xd0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x7, 0xff, 0xff, 0xf4, 0xff,
-    0xff, 0xfe, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0xbf, 0xff, 0xff, 0xf, 0xff, 0xff, 0xf0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0xf, 0xff, 0xff, 0xf0,
-    0xbf, 0xff, 0xff, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0xff, 0xff, 0xfe, 0x7, 0xff, 0xff, 0xf4,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x2f, 0xff, 0xff,
-    0xc0, 0x3f, 0xff, 0xff, 0x80, 0x0, 0x0, 0x0,
-    0x0, 0x3, 0xff, 0xff, 0xfc, 0x3, 0xff, 0xff,
-    0xfc, 0x0, 0x0, 0x0, 0x0, 0x0, 0x3f, 0xff,
-    0xff, 0x80, 0x2f, 0xff, 0xff, 0xd0, 0x0, 0x0,
-    0x0, 0x0, 0x7, 0xff, 0xff, 0xf4, 0x1, 0xff,
-    0xff, 0xfe, 0x0, 0x0, 0x0, 0x0, 0x0, 0xbf,
-    0xff, 0xff, 0x0, 0xf, 0xff, 0xff, 0xf0, 0x0,
-    0x0, 0x0, 0x0, 0xf, 0xff, 0xff, 0xf0, 0x0,
-    0xff, 0xff, 0xff, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0xff, 0xff, 0xfe, 0x0, 0xb, 0xff, 0xff, 0xf4,
-    0x0, 0x0, 0x0, 0x0, 0x2f, 0xff, 0xff, 0xd0,
-    0x0, 0x7f, 0xff, 0xff, 0x80, 0x0, 0x0, 0x0,
-    0x3, 0xff, 0xff, 0xfc, 0x0, 0x3, 0xff, 0xff,
-    0xfc, 0x0, 0x0, 0x0, 0x0, 0x3f, 0xff, 0xff,
-    0xc0, 0x0, 0x2f, 0xff, 0xff, 0xd0, 0x0, 0x0,
-    0x0, 0x7, 0xff, 0xff, 0xf8, 0x0, 0x1, 0xff,
-    0xff, 0xfe, 0x0, 0x0, 0x0, 0x0, 0xbf, 0xff,
-    0xff, 0x40, 0x0, 0xf, 0xff, 0xff, 0xf0, 0x0,
-    0x0, 0x0, 0xf, 0xff, 0xff, 0xf0, 0x0, 0x0,
-    0xff, 0xff, 0xff, 0x0, 0x0, 0x0, 0x1, 0xff,
-    0xff, 0xff, 0x0, 0x0, 0xb, 0xff, 0xff, 0xf4,
-    0x0, 0x0, 0x0, 0x2f, 0xff, 0xff, 0xe0, 0x0,
-    0x0, 0x7f, 0xff, 0xff, 0x80, 0x0, 0x0, 0x3,
-    0xff, 0xff, 0xff, 0xaa, 0xaa, 0xab, 0xff, 0xff,
-    0xfc, 0x0, 0x0, 0x0, 0x3f, 0xff, 0xff, 0xff,
-    0xff, 0xff, 0xff, 0xff, 0xff, 0xd0, 0x0, 0x0,
-    0x7, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
-    0xff, 0xfe, 0x0, 0x0, 0x0, 0xbf, 0xff, 0xff,
-    0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xf0, 0x0,
-    0x0, 0xf, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
-    0xff, 0xff, 0xff, 0x0, 0x0, 0x1, 0xff, 0xff,
-    0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xf4,
-    0x0, 0x0, 0x2f, 0xff, 0xff, 0xff, 0xff, 0xff,
-    0xff, 0xff, 0xff, 0xff, 0x80, 0x0, 0x3, 0xff,
-    0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
-    0xfc, 0x0, 0x0, 0x3f, 0xff, 0xff, 0xff, 0xff,
-    0xff, 0xff, 0xff, 0xff, 0xff, 0xd0, 0x0, 0x7,
-    0xff, 0xff, 0xfc, 0x0, 0x0, 0x0, 0x2, 0xff,
-    0xff, 0xfe, 0x0, 0x0, 0xbf, 0xff, 0xff, 0x80,
-    0x0, 0x0, 0x0, 0x1f, 0xff, 0xff, 0xf0, 0x0,
-    0xf, 0xff, 0xff, 0xf4, 0x0, 0x0, 0x0, 0x0,
-    0xff, 0xff, 0xff, 0x0, 0x1, 0xff, 0xff, 0xff,
-    0x0, 0x0, 0x0, 0x0, 0xf, 0xff, 0xff, 0xf4,
-    0x0, 0x2f, 0xff, 0xff, 0xf0, 0x0, 0x0, 0x0,
-    0x0, 0xbf, 0xff, 0xff, 0x80, 0x3, 0xff, 0xff,
-    0xfe, 0x0, 0x0, 0x0, 0x0, 0x7, 0xff, 0xff,
-    0xfc, 0x0, 0x3f, 0xff, 0xff, 0xd0, 0x0, 0x0,
-    0x0, 0x0, 0x3f, 0xff, 0xff, 0xd0, 0x7, 0xff,
-    0xff, 0xfc, 0x0, 0x0, 0x0, 0x0, 0x3, 0xff,
-    0xff, 0xfe, 0x0, 0xbf, 0xff, 0xff, 0xc0, 0x0,
-    0x0, 0x0, 0x0, 0x2f, 0xff, 0xff, 0xf0, 0xf,
-    0xff, 0xff, 0xf4, 0x0, 0x0, 0x0, 0x0, 0x1,
-    0xff, 0xff, 0xff, 0x1, 0xff, 0xff, 0xff, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0xf, 0xff, 0xff, 0xf4,
-    0x2f, 0xff, 0xff, 0xf0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0xff, 0xff, 0xff, 0x83, 0xff, 0xff, 0xfe,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0xb, 0xff, 0xff,
-    0xfc, 0x3f, 0xff, 0xff, 0xd0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x7f, 0xff, 0xff, 0xd1, 0x55, 0x55,
-    0x54, 0x0, 0x0, 0x0, 0x0, 0x0, 0x1, 0x55,
-    0x55, 0x55,
-
-    /* U+0042 "B" */
-    0x6a, 0xaa, 0xaa, 0xaa, 0xaa, 0xaa, 0x54, 0x0,
-    0x0, 0x0, 0xb, 0xff, 0xff, 0xff, 0xff, 0xff,
-    0xff, 0xfe, 0x40, 0x0, 0x0, 0xbf, 0xff, 0xff,
-    0xff, 0xff, 0xff, 0xff, 0xff, 0x40, 0x0, 0xb,
-    0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
-    0x0, 0x0, 0xbf, 0xff, 0xff, 0xff, 0xff, 0xff,
-    0xff, 0xff, 0xfc, 0x0, 0xb, 0xff, 0xff, 0xff,
-    0xff, 0xff, 0xff, 0xff, 0xff, 0xf0, 0x0, 0xbf,
-    0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
-    0x80, 0xb, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
-    0xff, 0xff, 0xfd, 0x0, 0xbf, 0xff, 0xff, 0x0,
-    0x0, 0x1b, 0xff, 0xff, 0xff, 0xe0, 0xb, 0xff,
-    0xff, 0xf0, 0x0, 0x0, 0xb, 0xff, 0xff, 0xff,
-    0x0, 0xbf, 0xff, 0xff, 0x0, 0x0, 0x0, 0x3f,
-    0xff, 0xff, 0xf4, 0xb, 0xff, 0xff, 0xf0, 0x0,
-    0x0, 0x0, 0xff, 0xff, 0xff, 0x40, 0xbf, 0xff,
-    0xff, 0x0, 0x0, 0x0, 0xf, 0xff, 0xff, 0xf4,
-    0xb, 0xff, 0xff, 0xf0, 0x0, 0x0, 0x0, 0xbf,
-    0xff, 0xff, 0x80, 0xbf, 0xff, 0xff, 0x0, 0x0,
-    0x0, 0x7, 0xff, 0xff, 0xf4, 0xb, 0xff, 0xff,
-    0xf0, 0x0, 0x0, 0x0, 0xbf, 0xff, 0xff, 0x0,
-    0xbf, 0xff, 0xff, 0x0, 0x0, 0x0, 0xb, 0xff,
-    0xff, 0xf0, 0xb, 0xff, 0xff, 0xf0, 0x0, 0x0,
-    0x0, 0xff, 0xff, 0xfd, 0x0, 0xbf, 0xff, 0xff,
-    0x0, 0x0, 0x0, 0x2f, 0xff, 0xff, 0xc0, 0xb,
-    0xff, 0xff, 0xf0, 0x0, 0x0, 0xb, 0xff, 0xff,
-    0xf0, 0x0, 0xbf, 0xff, 0xff, 0x0, 0x0, 0x7,
-    0xff, 0xff, 0xfc, 0x0, 0xb, 0xff, 0xff, 0xff,
-    0xff, 0xff, 0xff, 0xff, 0xff, 0x40, 0x0, 0xbf,
-    0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xc0,
-    0x0, 0xb, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
-    0xff, 0xf4, 0x0, 0x0, 0xbf, 0xff, 0xff, 0xff,
-    0xff, 0xff, 0xff, 0xff, 0xf0, 0x0, 0xb, 0xff,
-    0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xe0,
-    0x0, 0xbf, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
-    0xff, 0xff, 0xc0, 0xb, 0xff, 0xff, 0xff, 0xff,
-    0xff, 0xff, 0xff, 0xff, 0xff, 0x0, 0xbf, 0xff,
-    0xff, 0x0, 0x0, 0x1, 0xbf, 0xff, 0xff, 0xfc,
-    0xb, 0xff, 0xff, 0xf0, 0x0, 0x0, 0x0, 0x7f,
-    0xff, 0xff, 0xe0, 0xbf, 0xff, 0xff, 0x0, 0x0,
-    0x0, 0x0, 0xff, 0xff, 0xff, 0xb, 0xff, 0xff,
-    0xf0, 0x0, 0x0, 0x0, 0x3, 0xff, 0xff, 0xf8,
-    0xbf, 0xff, 0xff, 0x0, 0x0, 0x0, 0x0, 0x2f,
-    0xff, 0xff, 0xcb, 0xff, 0xff, 0xf0, 0x0, 0x0,
-    0x0, 0x1, 0xff, 0xff, 0xfd, 0xbf, 0xff, 0xff,
-    0x0, 0x0, 0x0, 0x0, 0x1f, 0xff, 0xff, 0xdb,
-    0xff, 0xff, 0xf0, 0x0, 0x0, 0x0, 0x1, 0xff,
-    0xff, 0xfe, 0xbf, 0xff, 0xff, 0x0, 0x0, 0x0,
-    0x0, 0x2f, 0xff, 0xff, 0xeb, 0xff, 0xff, 0xf0,
-    0x0, 0x0, 0x0, 0x3, 0xff, 0xff, 0xfe, 0xbf,
-    0xff, 0xff, 0x0, 0x0, 0x0, 0x0, 0x7f, 0xff,
-    0xff, 0xdb, 0xff, 0xff, 0xf0, 0x0, 0x0, 0x0,
-    0xf, 0xff, 0xff, 0xfd, 0xbf, 0xff, 0xff, 0x0,
-    0x0, 0x0, 0x3, 0xff, 0xff, 0xff, 0xcb, 0xff,
-    0xff, 0xf0, 0x0, 0x0, 0x1, 0xff, 0xff, 0xff,
-    0xf8, 0xbf, 0xff, 0xff, 0xea, 0xaa, 0xaf, 0xff,
-    0xff, 0xff, 0xff, 0x4b, 0xff, 0xff, 0xff, 0xff,
-    0xff, 0xff, 0xff, 0xff, 0xff, 0xf0, 0xbf, 0xff,
-    0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xfc,
-    0xb, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
-    0xff, 0xff, 0x40, 0xbf, 0xff, 0xff, 0xff, 0xff,
-    0xff, 0xff, 0xff, 0xff, 0xe0, 0xb, 0xff, 0xff,
-    0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xf4, 0x0,
-    0xbf, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
-    0xfc, 0x0, 0xb, 0xff, 0xff, 0xff, 0xff, 0xff,
-    0xff, 0xff, 0xf9, 0x0, 0x0, 0xbf, 0xff, 0xff,
-    0xff, 0xff, 0xff, 0xff, 0xa4, 0x0, 0x0, 0x0,
-
-    /* U+0043 "C" */
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x1a, 0xff, 0xff, 0xfa, 0x40, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x1b, 0xff, 0xff, 0xff, 0xff, 0xfe,
-    0x40, 0x0, 0x0, 0x0, 0x1, 0xff, 0xff, 0xff,
-    0xff, 0xff, 0xff, 0xf9, 0x0, 0x0, 0x0, 0x1f,
-    0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xfe, 0x0,
-    0x0, 0x1, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
-    0xff, 0xfe, 0x0, 0x0, 0xb, 0xff, 0xff, 0xff,
-    0xff, 0xff, 0xff, 0xff, 0xfe, 0x0, 0x0, 0x2f,
-    0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xfe,
-    0x0, 0x0, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
-    0xff, 0xff, 0xfe, 0x0, 0x3, 0xff, 0xff, 0xff,
-    0xff, 0xff, 0xff, 0xff, 0xff, 0xfe, 0x0, 0xb,
-    0xff, 0xff, 0xff, 0xff, 0xe4, 0x0, 0x5, 0xbf,
-    0xfe, 0x0, 0x1f, 0xff, 0xff, 0xff, 0xf4, 0x0,
-    0x0, 0x0, 0x1, 0xbe, 0x0, 0x3f, 0xff, 0xff,
-    0xff, 0x40, 0x0, 0x0, 0x0, 0x0, 0x5, 0x0,
-    0xbf, 0xff, 0xff, 0xfc, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0xff, 0xff, 0xff, 0xf0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x2, 0xff, 0xff,
-    0xff, 0xc0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x3, 0xff, 0xff, 0xff, 0x40, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x7, 0xff, 0xff, 0xfe, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0xf, 0xff,
-    0xff, 0xfc, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0xf, 0xff, 0xff, 0xfc, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x1f, 0xff, 0xff, 0xf4,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x2f,
-    0xff, 0xff, 0xf0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x2f, 0xff, 0xff, 0xf0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x3f, 0xff, 0xff,
-    0xe0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x3f, 0xff, 0xff, 0xe0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x3f, 0xff, 0xff, 0xe0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x3f, 0xff,
-    0xff, 0xd0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x3f, 0xff, 0xff, 0xd0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x3f, 0xff, 0xff, 0xd0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x3f,
-    0xff, 0xff, 0xd0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x3f, 0xff, 0xff, 0xe0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x3f, 0xff, 0xff,
-    0xf0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x2f, 0xff, 0xff, 0xf0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x1f, 0xff, 0xff, 0xf4, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0xf, 0xff,
-    0xff, 0xfc, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0xf, 0xff, 0xff, 0xfd, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0xb, 0xff, 0xff, 0xff,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x7,
-    0xff, 0xff, 0xff, 0xc0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x3, 0xff, 0xff, 0xff, 0xe0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x1, 0xff, 0xff,
-    0xff, 0xf8, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0xff, 0xff, 0xff, 0xff, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x1, 0x0, 0x3f, 0xff, 0xff, 0xff,
-    0xd0, 0x0, 0x0, 0x0, 0x0, 0x2e, 0x0, 0x2f,
-    0xff, 0xff, 0xff, 0xfe, 0x0, 0x0, 0x0, 0x7,
-    0xfe, 0x0, 0xb, 0xff, 0xff, 0xff, 0xff, 0xfa,
-    0x55, 0x5a, 0xff, 0xfe, 0x0, 0x3, 0xff, 0xff,
-    0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xfe, 0x0,
-    0x0, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
-    0xff, 0xfe, 0x0, 0x0, 0x2f, 0xff, 0xff, 0xff,
-    0xff, 0xff, 0xff, 0xff, 0xfe, 0x0, 0x0, 0x7,
-    0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xfe,
-    0x0, 0x0, 0x0, 0xff, 0xff, 0xff, 0xff, 0xff,
-    0xff, 0xff, 0xfe, 0x0, 0x0, 0x0, 0x1f, 0xff,
-    0xff, 0xff, 0xff, 0xff, 0xff, 0xfe, 0x0, 0x0,
-    0x0, 0x1, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
-    0xfd, 0x0, 0x0, 0x0, 0x0, 0x6, 0xff, 0xff,
-    0xff, 0xff, 0xff, 0x80, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x6, 0xaf, 0xff, 0xfa, 0x90, 0x0,
-
-    /* U+0044 "D" */
-    0xbf, 0xff, 0xff, 0xff, 0xff, 0xfa, 0x90, 0x0,
-    0x0, 0x0, 0x0, 0xbf, 0xff, 0xff, 0xff, 0xff,
-    0xff, 0xff, 0x90, 0x0, 0x0, 0x0, 0xbf, 0xff,
-    0xff, 0xff, 0xff, 0xff, 0xff, 0xfd, 0x0, 0x0,
-    0x0, 0xbf, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
-    0xff, 0xd0, 0x0, 0x0, 0xbf, 0xff, 0xff, 0xff,
-    0xff, 0xff, 0xff, 0xff, 0xf8, 0x0, 0x0, 0xbf,
-    0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
-    0x0, 0x0, 0xbf, 0xff, 0xff, 0xff, 0xff, 0xff,
-    0xff, 0xff, 0xff, 0xc0, 0x0, 0xbf, 0xff, 0xff,
-    0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xf0, 0x0,
-    0xbf, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
-    0xff, 0xfc, 0x0, 0xbf, 0xff, 0xff, 0x0, 0x0,
-    0x1b, 0xff, 0xff, 0xff, 0xfe, 0x0, 0xbf, 0xff,
-    0xff, 0x0, 0x0, 0x0, 0x7f, 0xff, 0xff, 0xff,
-    0x0, 0xbf, 0xff, 0xff, 0x0, 0x0, 0x0, 0x1f,
-    0xff, 0xff, 0xff, 0x80, 0xbf, 0xff, 0xff, 0x0,
-    0x0, 0x0, 0x3, 0xff, 0xff, 0xff, 0xc0, 0xbf,
-    0xff, 0xff, 0x0, 0x0, 0x0, 0x1, 0xff, 0xff,
-    0xff, 0xe0, 0xbf, 0xff, 0xff, 0x0, 0x0, 0x0,
-    0x0, 0xbf, 0xff, 0xff, 0xf0, 0xbf, 0xff, 0xff,
-    0x0, 0x0, 0x0, 0x0, 0x3f, 0xff, 0xff, 0xf4,
-    0xbf, 0xff, 0xff, 0x0, 0x0, 0x0, 0x0, 0x1f,
-    0xff, 0xff, 0xf8, 0xbf, 0xff, 0xff, 0x0, 0x0,
-    0x0, 0x0, 0xf, 0xff, 0xff, 0xfc, 0xbf, 0xff,
-    0xff, 0x0, 0x0, 0x0, 0x0, 0xb, 0xff, 0xff,
-    0xfc, 0xbf, 0xff, 0xff, 0x0, 0x0, 0x0, 0x0,
-    0x7, 0xff, 0xff, 0xfc, 0xbf, 0xff, 0xff, 0x0,
-    0x0, 0x0, 0x0, 0x3, 0xff, 0xff, 0xfd, 0xbf,
-    0xff, 0xff, 0x0, 0x0, 0x0, 0x0, 0x3, 0xff,
-    0xff, 0xfd, 0xbf, 0xff, 0xff, 0x0, 0x0, 0x0,
-    0x0, 0x2, 0xff, 0xff, 0xfe, 0xbf, 0xff, 0xff,
-    0x0, 0x0, 0x0, 0x0, 0x2, 0xff, 0xff, 0xfe,
-    0xbf, 0xff, 0xff, 0x0, 0x0, 0x0, 0x0, 0x2,
-    0xff, 0xff, 0xfe, 0xbf, 0xff, 0xff, 0x0, 0x0,
-    0x0, 0x0, 0x2, 0xff, 0xff, 0xfe, 0xbf, 0xff,
-    0xff, 0x0, 0x0, 0x0, 0x0, 0x2, 0xff, 0xff,
-    0xfe, 0xbf, 0xff, 0xff, 0x0, 0x0, 0x0, 0x0,
-    0x2, 0xff, 0xff, 0xfe, 0xbf, 0xff, 0xff, 0x0,
-    0x0, 0x0, 0x0, 0x3, 0xff, 0xff, 0xfe, 0xbf,
-    0xff, 0xff, 0x0, 0x0, 0x0, 0x0, 0x3, 0xff,
-    0xff, 0xfd, 0xbf, 0xff, 0xff, 0x0, 0x0, 0x0,
-    0x0, 0x3, 0xff, 0xff, 0xfd, 0xbf, 0xff, 0xff,
-    0x0, 0x0, 0x0, 0x0, 0x7, 0xff, 0xff, 0xfd,
-    0xbf, 0xff, 0xff, 0x0, 0x0, 0x0, 0x0, 0xb,
-    0xff, 0xff, 0xfc, 0xbf, 0xff, 0xff, 0x0, 0x0,
-    0x0, 0x0, 0xf, 0xff, 0xff, 0xfc, 0xbf, 0xff,
-    0xff, 0x0, 0x0, 0x0, 0x0, 0x1f, 0xff, 0xff,
-    0xf8, 0xbf, 0xff, 0xff, 0x0, 0x0, 0x0, 0x0,
-    0x3f, 0xff, 0xff, 0xf4, 0xbf, 0xff, 0xff, 0x0,
-    0x0, 0x0, 0x0, 0x7f, 0xff, 0xff, 0xf0, 0xbf,
-    0xff, 0xff, 0x0, 0x0, 0x0, 0x0, 0xff, 0xff,
-    0xff, 0xf0, 0xbf, 0xff, 0xff, 0x0, 0x0, 0x0,
-    0x3, 0xff, 0xff, 0xff, 0xd0, 0xbf, 0xff, 0xff,
-    0x0, 0x0, 0x0, 0xf, 0xff, 0xff, 0xff, 0xc0,
-    0xbf, 0xff, 0xff, 0x0, 0x0, 0x0, 0x7f, 0xff,
-    0xff, 0xff, 0x40, 0xbf, 0xff, 0xff, 0x0, 0x0,
-    0x17, 0xff, 0xff, 0xff, 0xff, 0x0, 0xbf, 0xff,
-    0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xfc,
-    0x0, 0xbf, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
-    0xff, 0xff, 0xf4, 0x0, 0xbf, 0xff, 0xff, 0xff,
-    0xff, 0xff, 0xff, 0xff, 0xff, 0xd0, 0x0, 0xbf,
-    0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
-    0x40, 0x0, 0xbf, 0xff, 0xff, 0xff, 0xff, 0xff,
-    0xff, 0xff, 0xfc, 0x0, 0x0, 0xbf, 0xff, 0xff,
-    0xff, 0xff, 0xff, 0xff, 0xff, 0xe0, 0x0, 0x0,
-    0xbf, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xfe,
-    0x0, 0x0, 0x0, 0xbf, 0xff, 0xff, 0xff, 0xff,
-    0xff, 0xff, 0x90, 0x0, 0x0, 0x0, 0xbf, 0xff,
-    0xff, 0xff, 0xff, 0xfe, 0x90, 0x0, 0x0, 0x0,
-    0x0,
-
-    /* U+0045 "E" */
-    0xbf, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
-    0xfe, 0xbf, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
-    0xff, 0xfe, 0xbf, 0xff, 0xff, 0xff, 0xff, 0xff,
-    0xff, 0xff, 0xfe, 0xbf, 0xff, 0xff, 0xff, 0xff,
-    0xff, 0xff, 0xff, 0xfe, 0xbf, 0xff, 0xff, 0xff,
-    0xff, 0xff, 0xff, 0xff, 0xfe, 0xbf, 0xff, 0xff,
-    0xff, 0xff, 0xff, 0xff, 0xff, 0xfe, 0xbf, 0xff,
-    0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xfe, 0xbf,
-    0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xfe,
-    0xbf, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
-    0xfe, 0xbf, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
-    0xff, 0xfe, 0xbf, 0xff, 0xff, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0xbf, 0xff, 0xff, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0xbf, 0xff, 0xff, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0xbf, 0xff, 0xff,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0xbf, 0xff,
-    0xff, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0xbf,
-    0xff, 0xff, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0xbf, 0xff, 0xff, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0xbf, 0xff, 0xff, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0xbf, 0xff, 0xff, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0xbf, 0xff, 0xff, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0xbf, 0xff, 0xff, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0xbf, 0xff, 0xff,
-    0xff, 0xff, 0xff, 0xff, 0xff, 0x80, 0xbf, 0xff,
-    0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0x80, 0xbf,
-    0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0x80,
-    0xbf, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
-    0x80, 0xbf, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
-    0xff, 0x80, 0xbf, 0xff, 0xff, 0xff, 0xff, 0xff,
-    0xff, 0xff, 0x80, 0xbf, 0xff, 0xff, 0xff, 0xff,
-    0xff, 0xff, 0xff, 0x80, 0xbf, 0xff, 0xff, 0xff,
-    0xff, 0xff, 0xff, 0xff, 0x80, 0xbf, 0xff, 0xff,
-    0xff, 0xff, 0xff, 0xff, 0xff, 0x80, 0xbf, 0xff,
-    0xff, 0x40, 0x0, 0x0, 0x0, 0x0, 0x0, 0xbf,
-    0xff, 0xff, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0xbf, 0xff, 0xff, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0xbf, 0xff, 0xff, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0xbf, 0xff, 0xff, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0xbf, 0xff, 0xff, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0xbf, 0xff, 0xff, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0xbf, 0xff, 0xff,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0xbf, 0xff,
-    0xff, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0xbf,
-    0xff, 0xff, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0xbf, 0xff, 0xff, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0xbf, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
-    0xff, 0xfe, 0xbf, 0xff, 0xff, 0xff, 0xff, 0xff,
-    0xff, 0xff, 0xfe, 0xbf, 0xff, 0xff, 0xff, 0xff,
-    0xff, 0xff, 0xff, 0xfe, 0xbf, 0xff, 0xff, 0xff,
-    0xff, 0xff, 0xff, 0xff, 0xfe, 0xbf, 0xff, 0xff,
-    0xff, 0xff, 0xff, 0xff, 0xff, 0xfe, 0xbf, 0xff,
-    0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xfe, 0xbf,
-    0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xfe,
-    0xbf, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
-    0xfe, 0xbf, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
-    0xff, 0xfe, 0xbf, 0xff, 0xff, 0xff, 0xff, 0xff,
-    0xff, 0xff, 0xfe,
-
-    /* U+0046 "F" */
-    0xbf, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
-    0xeb, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
-    0xfe, 0xbf, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
-    0xff, 0xeb, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
-    0xff, 0xfe, 0xbf, 0xff, 0xff, 0xff, 0xff, 0xff,
-    0xff, 0xff, 0xeb, 0xff, 0xff, 0xff, 0xff, 0xff,
-    0xff, 0xff, 0xfe, 0xbf, 0xff, 0xff, 0xff, 0xff,
-    0xff, 0xff, 0xff, 0xeb, 0xff, 0xff, 0xff, 0xff,
-    0xff, 0xff, 0xff, 0xfe, 0xbf, 0xff, 0xff, 0xff,
-    0xff, 0xff, 0xff, 0xff, 0xeb, 0xff, 0xff, 0xff,
-    0xff, 0xff, 0xff, 0xff, 0xfe, 0xbf, 0xff, 0xff,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0xb, 0xff, 0xff,
-    0xf0, 0x0, 0x0, 0x0, 0x0, 0x0, 0xbf, 0xff,
-    0xff, 0x0, 0x0, 0x0, 0x0, 0x0, 0xb, 0xff,
-    0xff, 0xf0, 0x0, 0x0, 0x0, 0x0, 0x0, 0xbf,
-    0xff, 0xff, 0x0, 0x0, 0x0, 0x0, 0x0, 0xb,
-    0xff, 0xff, 0xf0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0xbf, 0xff, 0xff, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0xb, 0xff, 0xff, 0xf0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0xbf, 0xff, 0xff, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0xb, 0xff, 0xff, 0xf0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0xbf, 0xff, 0xff, 0x40, 0x0, 0x0,
-    0x0, 0x0, 0xb, 0xff, 0xff, 0xff, 0xff, 0xff,
-    0xff, 0xff, 0xc0, 0xbf, 0xff, 0xff, 0xff, 0xff,
-    0xff, 0xff, 0xfc, 0xb, 0xff, 0xff, 0xff, 0xff,
-    0xff, 0xff, 0xff, 0xc0, 0xbf, 0xff, 0xff, 0xff,
-    0xff, 0xff, 0xff, 0xfc, 0xb, 0xff, 0xff, 0xff,
-    0xff, 0xff, 0xff, 0xff, 0xc0, 0xbf, 0xff, 0xff,
-    0xff, 0xff, 0xff, 0xff, 0xfc, 0xb, 0xff, 0xff,
-    0xff, 0xff, 0xff, 0xff, 0xff, 0xc0, 0xbf, 0xff,
-    0xff, 0xff, 0xff, 0xff, 0xff, 0xfc, 0xb, 0xff,
-    0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xc0, 0xbf,
-    0xff, 0xff, 0x0, 0x0, 0x0, 0x0, 0x0, 0xb,
-    0xff, 0xff, 0xf0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0xbf, 0xff, 0xff, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0xb, 0xff, 0xff, 0xf0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0xbf, 0xff, 0xff, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0xb, 0xff, 0xff, 0xf0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0xbf, 0xff, 0xff, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0xb, 0xff, 0xff, 0xf0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0xbf, 0xff, 0xff, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0xb, 0xff, 0xff, 0xf0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0xbf, 0xff, 0xff, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0xb, 0xff, 0xff, 0xf0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0xbf, 0xff, 0xff,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0xb, 0xff, 0xff,
-    0xf0, 0x0, 0x0, 0x0, 0x0, 0x0, 0xbf, 0xff,
-    0xff, 0x0, 0x0, 0x0, 0x0, 0x0, 0xb, 0xff,
-    0xff, 0xf0, 0x0, 0x0, 0x0, 0x0, 0x0, 0xbf,
-    0xff, 0xff, 0x0, 0x0, 0x0, 0x0, 0x0, 0xb,
-    0xff, 0xff, 0xf0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0xbf, 0xff, 0xff, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0xb, 0xff, 0xff, 0xf0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0xbf, 0xff, 0xff, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0,
-
-    /* U+0047 "G" */
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x5, 0xbf, 0xff,
-    0xe5, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x2f, 0xff, 0xff, 0xff, 0xff, 0xa4, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x7f, 0xff, 0xff, 0xff, 0xff,
-    0xff, 0xf8, 0x0, 0x0, 0x0, 0x0, 0xbf, 0xff,
-    0xff, 0xff, 0xff, 0xff, 0xff, 0xe0, 0x0, 0x0,
-    0x0, 0x7f, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
-    0xfe, 0x0, 0x0, 0x0, 0x2f, 0xff, 0xff, 0xff,
-    0xff, 0xff, 0xff, 0xff, 0xe0, 0x0, 0x0, 0xf,
-    0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xfe,
-    0x0, 0x0, 0x3, 0xff, 0xff, 0xff, 0xff, 0xff,
-    0xff, 0xff, 0xff, 0xe0, 0x0, 0x0, 0xff, 0xff,
-    0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xfe, 0x0,
-    0x0, 0x3f, 0xff, 0xff, 0xff, 0xfe, 0x40, 0x0,
-    0x5b, 0xff, 0xe0, 0x0, 0xb, 0xff, 0xff, 0xff,
-    0xf4, 0x0, 0x0, 0x0, 0x1, 0xbe, 0x0, 0x1,
-    0xff, 0xff, 0xff, 0xf4, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x10, 0x0, 0x3f, 0xff, 0xff, 0xfc, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0xb, 0xff,
-    0xff, 0xfe, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0xff, 0xff, 0xff, 0x80, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x2f, 0xff, 0xff,
-    0xf0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x3, 0xff, 0xff, 0xfd, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x7f, 0xff, 0xff, 0xc0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0xf,
-    0xff, 0xff, 0xf4, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0xff, 0xff, 0xff, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x1f, 0xff,
-    0xff, 0xe0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x2, 0xff, 0xff, 0xfd, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x2f, 0xff, 0xff,
-    0xc0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x3, 0xff, 0xff, 0xfc, 0x0, 0x0, 0x0, 0x2,
-    0xff, 0xff, 0xff, 0xfc, 0x3f, 0xff, 0xff, 0xc0,
-    0x0, 0x0, 0x0, 0x2f, 0xff, 0xff, 0xff, 0xc3,
-    0xff, 0xff, 0xfc, 0x0, 0x0, 0x0, 0x2, 0xff,
-    0xff, 0xff, 0xfc, 0x3f, 0xff, 0xff, 0x80, 0x0,
-    0x0, 0x0, 0x2f, 0xff, 0xff, 0xff, 0xc3, 0xff,
-    0xff, 0xf8, 0x0, 0x0, 0x0, 0x2, 0xff, 0xff,
-    0xff, 0xfc, 0x3f, 0xff, 0xff, 0xc0, 0x0, 0x0,
-    0x0, 0x2f, 0xff, 0xff, 0xff, 0xc3, 0xff, 0xff,
-    0xfc, 0x0, 0x0, 0x0, 0x2, 0xff, 0xff, 0xff,
-    0xfc, 0x3f, 0xff, 0xff, 0xc0, 0x0, 0x0, 0x0,
-    0x2f, 0xff, 0xff, 0xff, 0xc3, 0xff, 0xff, 0xfc,
-    0x0, 0x0, 0x0, 0x2, 0xff, 0xff, 0xff, 0xfc,
-    0x2f, 0xff, 0xff, 0xd0, 0x0, 0x0, 0x0, 0x0,
-    0x3, 0xff, 0xff, 0xc1, 0xff, 0xff, 0xff, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x3f, 0xff, 0xfc, 0xf,
-    0xff, 0xff, 0xf0, 0x0, 0x0, 0x0, 0x0, 0x3,
-    0xff, 0xff, 0xc0, 0xff, 0xff, 0xff, 0x80, 0x0,
-    0x0, 0x0, 0x0, 0x3f, 0xff, 0xfc, 0xb, 0xff,
-    0xff, 0xfd, 0x0, 0x0, 0x0, 0x0, 0x3, 0xff,
-    0xff, 0xc0, 0x3f, 0xff, 0xff, 0xf0, 0x0, 0x0,
-    0x0, 0x0, 0x3f, 0xff, 0xfc, 0x2, 0xff, 0xff,
-    0xff, 0xc0, 0x0, 0x0, 0x0, 0x3, 0xff, 0xff,
-    0xc0, 0xf, 0xff, 0xff, 0xff, 0x0, 0x0, 0x0,
-    0x0, 0x3f, 0xff, 0xfc, 0x0, 0xbf, 0xff, 0xff,
-    0xfd, 0x0, 0x0, 0x0, 0x3, 0xff, 0xff, 0xc0,
-    0x3, 0xff, 0xff, 0xff, 0xfc, 0x0, 0x0, 0x0,
-    0x3f, 0xff, 0xfc, 0x0, 0x1f, 0xff, 0xff, 0xff,
-    0xfe, 0x0, 0x0, 0x3, 0xff, 0xff, 0xc0, 0x0,
-    0xbf, 0xff, 0xff, 0xff, 0xff, 0xe9, 0x56, 0xbf,
-    0xff, 0xfc, 0x0, 0x2, 0xff, 0xff, 0xff, 0xff,
-    0xff, 0xff, 0xff, 0xff, 0xff, 0xc0, 0x0, 0xb,
-    0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
-    0xfc, 0x0, 0x0, 0x2f, 0xff, 0xff, 0xff, 0xff,
-    0xff, 0xff, 0xff, 0xff, 0xc0, 0x0, 0x0, 0x7f,
-    0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xfc,
-    0x0, 0x0, 0x0, 0xff, 0xff, 0xff, 0xff, 0xff,
-    0xff, 0xff, 0xff, 0xc0, 0x0, 0x0, 0x1, 0xff,
-    0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xfc, 0x0,
-    0x0, 0x0, 0x0, 0xbf, 0xff, 0xff, 0xff, 0xff,
-    0xff, 0xfe, 0x0, 0x0, 0x0, 0x0, 0x0, 0x6f,
-    0xff, 0xff, 0xff, 0xff, 0xf9, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x6, 0xaf, 0xff, 0xfa, 0x50,
-    0x0, 0x0,
-
-    /* U+0048 "H" */
-    0x6a, 0xaa, 0xaa, 0x0, 0x0, 0x0, 0x0, 0x1,
-    0xaa, 0xaa, 0xa9, 0xbf, 0xff, 0xff, 0x0, 0x0,
-    0x0, 0x0, 0x1, 0xff, 0xff, 0xfd, 0xbf, 0xff,
-    0xff, 0x0, 0x0, 0x0, 0x0, 0x1, 0xff, 0xff,
-    0xfd, 0xbf, 0xff, 0xff, 0x0, 0x0, 0x0, 0x0,
-    0x1, 0xff, 0xff, 0xfd, 0xbf, 0xff, 0xff, 0x0,
-    0x0, 0x0, 0x0, 0x1, 0xff, 0xff, 0xfd, 0xbf,
-    0xff, 0xff, 0x0, 0x0, 0x0, 0x0, 0x1, 0xff,
-    0xff, 0xfd, 0xbf, 0xff, 0xff, 0x0, 0x0, 0x0,
-    0x0, 0x1, 0xff, 0xff, 0xfd, 0xbf, 0xff, 0xff,
-    0x0, 0x0, 0x0, 0x0, 0x1, 0xff, 0xff, 0xfd,
-    0xbf, 0xff, 0xff, 0x0, 0x0, 0x0, 0x0, 0x1,
-    0xff, 0xff, 0xfd, 0xbf, 0xff, 0xff, 0x0, 0x0,
-    0x0, 0x0, 0x1, 0xff, 0xff, 0xfd, 0xbf, 0xff,
-    0xff, 0x0, 0x0, 0x0, 0x0, 0x1, 0xff, 0xff,
-    0xfd, 0xbf, 0xff, 0xff, 0x0, 0x0, 0x0, 0x0,
-    0x1, 0xff, 0xff, 0xfd, 0xbf, 0xff, 0xff, 0x0,
-    0x0, 0x0, 0x0, 0x1, 0xff, 0xff, 0xfd, 0xbf,
-    0xff, 0xff, 0x0, 0x0, 0x0, 0x0, 0x1, 0xff,
-    0xff, 0xfd, 0xbf, 0xff, 0xff, 0x0, 0x0, 0x0,
-    0x0, 0x1, 0xff, 0xff, 0xfd, 0xbf, 0xff, 0xff,
-    0x0, 0x0, 0x0, 0x0, 0x1, 0xff, 0xff, 0xfd,
-    0xbf, 0xff, 0xff, 0x0, 0x0, 0x0, 0x0, 0x1,
-    0xff, 0xff, 0xfd, 0xbf, 0xff, 0xff, 0x0, 0x0,
-    0x0, 0x0, 0x1, 0xff, 0xff, 0xfd, 0xbf, 0xff,
-    0xff, 0x0, 0x0, 0x0, 0x0, 0x1, 0xff, 0xff,
-    0xfd, 0xbf, 0xff, 0xff, 0x0, 0x0, 0x0, 0x0,
-    0x1, 0xff, 0xff, 0xfd, 0xbf, 0xff, 0xff, 0xff,
-    0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xfd, 0xbf,
-    0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
-    0xff, 0xfd, 0xbf, 0xff, 0xff, 0xff, 0xff, 0xff,
-    0xff, 0xff, 0xff, 0xff, 0xfd, 0xbf, 0xff, 0xff,
-    0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xfd,
-    0xbf, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
-    0xff, 0xff, 0xfd, 0xbf, 0xff, 0xff, 0xff, 0xff,
-    0xff, 0xff, 0xff, 0xff, 0xff, 0xfd, 0xbf, 0xff,
-    0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
-    0xfd, 0xbf, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
-    0xff, 0xff, 0xff, 0xfd, 0xbf, 0xff, 0xff, 0xff,
-    0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xfd, 0xbf,
-    0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
-    0xff, 0xfd, 0xbf, 0xff, 0xff, 0x0, 0x0, 0x0,
-    0x0, 0x1, 0xff, 0xff, 0xfd, 0xbf, 0xff, 0xff,
-    0x0, 0x0, 0x0, 0x0, 0x1, 0xff, 0xff, 0xfd,
-    0xbf, 0xff, 0xff, 0x0, 0x0, 0x0, 0x0, 0x1,
-    0xff, 0xff, 0xfd, 0xbf, 0xff, 0xff, 0x0, 0x0,
-    0x0, 0x0, 0x1, 0xff, 0xff, 0xfd, 0xbf, 0xff,
-    0xff, 0x0, 0x0, 0x0, 0x0, 0x1, 0xff, 0xff,
-    0xfd, 0xbf, 0xff, 0xff, 0x0, 0x0, 0x0, 0x0,
-    0x1, 0xff, 0xff, 0xfd, 0xbf, 0xff, 0xff, 0x0,
-    0x0, 0x0, 0x0, 0x1, 0xff, 0xff, 0xfd, 0xbf,
-    0xff, 0xff, 0x0, 0x0, 0x0, 0x0, 0x1, 0xff,
-    0xff, 0xfd, 0xbf, 0xff, 0xff, 0x0, 0x0, 0x0,
-    0x0, 0x1, 0xff, 0xff, 0xfd, 0xbf, 0xff, 0xff,
-    0x0, 0x0, 0x0, 0x0, 0x1, 0xff, 0xff, 0xfd,
-    0xbf, 0xff, 0xff, 0x0, 0x0, 0x0, 0x0, 0x1,
-    0xff, 0xff, 0xfd, 0xbf, 0xff, 0xff, 0x0, 0x0,
-    0x0, 0x0, 0x1, 0xff, 0xff, 0xfd, 0xbf, 0xff,
-    0xff, 0x0, 0x0, 0x0, 0x0, 0x1, 0xff, 0xff,
-    0xfd, 0xbf, 0xff, 0xff, 0x0, 0x0, 0x0, 0x0,
-    0x1, 0xff, 0xff, 0xfd, 0xbf, 0xff, 0xff, 0x0,
-    0x0, 0x0, 0x0, 0x1, 0xff, 0xff, 0xfd, 0xbf,
-    0xff, 0xff, 0x0, 0x0, 0x0, 0x0, 0x1, 0xff,
-    0xff, 0xfd, 0xbf, 0xff, 0xff, 0x0, 0x0, 0x0,
-    0x0, 0x1, 0xff, 0xff, 0xfd, 0xbf, 0xff, 0xff,
-    0x0, 0x0, 0x0, 0x0, 0x1, 0xff, 0xff, 0xfd,
-    0xbf, 0xff, 0xff, 0x0, 0x0, 0x0, 0x0, 0x1,
-    0xff, 0xff, 0xfd, 0xbf, 0xff, 0xff, 0x0, 0x0,
-    0x0, 0x0, 0x1, 0xff, 0xff, 0xfd, 0xbf, 0xff,
-    0xff, 0x0, 0x0, 0x0, 0x0, 0x1, 0xff, 0xff,
-    0xfd,
-
-    /* U+0049 "I" */
-    0x6a, 0xaa, 0xaa, 0x5f, 0xff, 0xff, 0xd7, 0xff,
-    0xff, 0xf5, 0xff, 0xff, 0xfd, 0x7f, 0xff, 0xff,
-    0x5f, 0xff, 0xff, 0xd7, 0xff, 0xff, 0xf5, 0xff,
-    0xff, 0xfd, 0x7f, 0xff, 0xff, 0x5f, 0xff, 0xff,
-    0xd7, 0xff, 0xff, 0xf5, 0xff, 0xff, 0xfd, 0x7f,
-    0xff, 0xff, 0x5f, 0xff, 0xff, 0xd7, 0xff, 0xff,
-    0xf5, 0xff, 0xff, 0xfd, 0x7f, 0xff, 0xff, 0x5f,
-    0xff, 0xff, 0xd7, 0xff, 0xff, 0xf5, 0xff, 0xff,
-    0xfd, 0x7f, 0xff, 0xff, 0x5f, 0xff, 0xff, 0xd7,
-    0xff, 0xff, 0xf5, 0xff, 0xff, 0xfd, 0x7f, 0xff,
-    0xff, 0x5f, 0xff, 0xff, 0xd7, 0xff, 0xff, 0xf5,
-    0xff, 0xff, 0xfd, 0x7f, 0xff, 0xff, 0x5f, 0xff,
-    0xff, 0xd7, 0xff, 0xff, 0xf5, 0xff, 0xff, 0xfd,
-    0x7f, 0xff, 0xff, 0x5f, 0xff, 0xff, 0xd7, 0xff,
-    0xff, 0xf5, 0xff, 0xff, 0xfd, 0x7f, 0xff, 0xff,
-    0x5f, 0xff, 0xff, 0xd7, 0xff, 0xff, 0xf5, 0xff,
-    0xff, 0xfd, 0x7f, 0xff, 0xff, 0x5f, 0xff, 0xff,
-    0xd7, 0xff, 0xff, 0xf5, 0xff, 0xff, 0xfd, 0x7f,
-    0xff, 0xff, 0x5f, 0xff, 0xff, 0xd7, 0xff, 0xff,
-    0xf5, 0xff, 0xff, 0xfd, 0x7f, 0xff, 0xff, 0x5f,
-    0xff, 0xff, 0xd7, 0xff, 0xff, 0xf4,
-
-    /* U+004A "J" */
-    0x0, 0x0, 0x1f, 0xff, 0xff, 0xd0, 0x0, 0x1,
-    0xff, 0xff, 0xfd, 0x0, 0x0, 0x1f, 0xff, 0xff,
-    0xd0, 0x0, 0x1, 0xff, 0xff, 0xfd, 0x0, 0x0,
-    0x1f, 0xff, 0xff, 0xd0, 0x0, 0x1, 0xff, 0xff,
-    0xfd, 0x0, 0x0, 0x1f, 0xff, 0xff, 0xd0, 0x0,
-    0x1, 0xff, 0xff, 0xfd, 0x0, 0x0, 0x1f, 0xff,
-    0xff, 0xd0, 0x0, 0x1, 0xff, 0xff, 0xfd, 0x0,
-    0x0, 0x1f, 0xff, 0xff, 0xd0, 0x0, 0x1, 0xff,
-    0xff, 0xfd, 0x0, 0x0, 0x1f, 0xff, 0xff, 0xd0,
-    0x0, 0x1, 0xff, 0xff, 0xfd, 0x0, 0x0, 0x1f,
-    0xff, 0xff, 0xd0, 0x0, 0x1, 0xff, 0xff, 0xfd,
-    0x0, 0x0, 0x1f, 0xff, 0xff, 0xd0, 0x0, 0x1,
-    0xff, 0xff, 0xfd, 0x0, 0x0, 0x1f, 0xff, 0xff,
-    0xd0, 0x0, 0x1, 0xff, 0xff, 0xfd, 0x0, 0x0,
-    0x1f, 0xff, 0xff, 0xd0, 0x0, 0x1, 0xff, 0xff,
-    0xfd, 0x0, 0x0, 0x1f, 0xff, 0xff, 0xd0, 0x0,
-    0x1, 0xff, 0xff, 0xfd, 0x0, 0x0, 0x1f, 0xff,
-    0xff, 0xd0, 0x0, 0x1, 0xff, 0xff, 0xfd, 0x0,
-    0x0, 0x1f, 0xff, 0xff, 0xd0, 0x0, 0x1, 0xff,
-    0xff, 0xfd, 0x0, 0x0, 0x1f, 0xff, 0xff, 0xd0,
-    0x0, 0x1, 0xff, 0xff, 0xfd, 0x0, 0x0, 0x1f,
-    0xff, 0xff, 0xd0, 0x0, 0x1, 0xff, 0xff, 0xfd,
-    0x0, 0x0, 0x1f, 0xff, 0xff, 0xd0, 0x0, 0x1,
-    0xff, 0xff, 0xfd, 0x0, 0x0, 0x1f, 0xff, 0xff,
-    0xd0, 0x0, 0x1, 0xff, 0xff, 0xfd, 0x0, 0x0,
-    0x1f, 0xff, 0xff, 0xd0, 0x0, 0x1, 0xff, 0xff,
-    0xfd, 0x0, 0x0, 0x1f, 0xff, 0xff, 0xd0, 0x0,
-    0x1, 0xff, 0xff, 0xfd, 0x0, 0x0, 0x1f, 0xff,
-    0xff, 0xd0, 0x0, 0x2, 0xff, 0xff, 0xfd, 0x0,
-    0x0, 0x2f, 0xff, 0xff, 0xd0, 0x0, 0x2, 0xff,
-    0xff, 0xfd, 0x0, 0x0, 0x3f, 0xff, 0xff, 0xd0,
-    0x0, 0x3, 0xff, 0xff, 0xfc, 0x0, 0x0, 0x3f,
-    0xff, 0xff, 0xc0, 0x0, 0xb, 0xff, 0xff, 0xfc,
-    0x0, 0x1, 0xff, 0xff, 0xff, 0x80, 0x0, 0xbf,
-    0xff, 0xff, 0xf4, 0x6a, 0xff, 0xff, 0xff, 0xff,
-    0x7, 0xff, 0xff, 0xff, 0xff, 0xe0, 0x7f, 0xff,
-    0xff, 0xff, 0xfc, 0x7, 0xff, 0xff, 0xff, 0xff,
-    0x80, 0x7f, 0xff, 0xff, 0xff, 0xf0, 0x7, 0xff,
-    0xff, 0xff, 0xfc, 0x0, 0x7f, 0xff, 0xff, 0xff,
-    0x0, 0x7, 0xff, 0xff, 0xff, 0x80, 0x0, 0x7f,
-    0xff, 0xff, 0x90, 0x0, 0x7, 0xff, 0xff, 0x80,
-    0x0, 0x0, 0x7f, 0xe9, 0x0, 0x0, 0x0, 0x0,
-
-    /* U+004B "K" */
-    0x6a, 0xaa, 0xaa, 0x0, 0x0, 0x0, 0x0, 0x2a,
-    0xaa, 0xaa, 0x90, 0x2f, 0xff, 0xff, 0xc0, 0x0,
-    0x0, 0x0, 0x3f, 0xff, 0xff, 0xf0, 0xb, 0xff,
-    0xff, 0xf0, 0x0, 0x0, 0x0, 0x2f, 0xff, 0xff,
-    0xf4, 0x2, 0xff, 0xff, 0xfc, 0x0, 0x0, 0x0,
-    0xf, 0xff, 0xff, 0xf8, 0x0, 0xbf, 0xff, 0xff,
-    0x0, 0x0, 0x0, 0xf, 0xff, 0xff, 0xfc, 0x0,
-    0x2f, 0xff, 0xff, 0xc0, 0x0, 0x0, 0xb, 0xff,
-    0xff, 0xfd, 0x0, 0xb, 0xff, 0xff, 0xf0, 0x0,
-    0x0, 0x7, 0xff, 0xff, 0xfe, 0x0, 0x2, 0xff,
-    0xff, 0xfc, 0x0, 0x0, 0x3, 0xff, 0xff, 0xff,
-    0x0, 0x0, 0xbf, 0xff, 0xff, 0x0, 0x0, 0x2,
-    0xff, 0xff, 0xff, 0x0, 0x0, 0x2f, 0xff, 0xff,
-    0xc0, 0x0, 0x1, 0xff, 0xff, 0xff, 0x80, 0x0,
-    0xb, 0xff, 0xff, 0xf0, 0x0, 0x0, 0xff, 0xff,
-    0xff, 0xc0, 0x0, 0x2, 0xff, 0xff, 0xfc, 0x0,
-    0x0, 0xbf, 0xff, 0xff, 0xc0, 0x0, 0x0, 0xbf,
-    0xff, 0xff, 0x0, 0x0, 0x7f, 0xff, 0xff, 0xd0,
-    0x0, 0x0, 0x2f, 0xff, 0xff, 0xc0, 0x0, 0x3f,
-    0xff, 0xff, 0xe0, 0x0, 0x0, 0xb, 0xff, 0xff,
-    0xf0, 0x0, 0x2f, 0xff, 0xff, 0xf0, 0x0, 0x0,
-    0x2, 0xff, 0xff, 0xfc, 0x0, 0x1f, 0xff, 0xff,
-    0xf4, 0x0, 0x0, 0x0, 0xbf, 0xff, 0xff, 0x0,
-    0xf, 0xff, 0xff, 0xf8, 0x0, 0x0, 0x0, 0x2f,
-    0xff, 0xff, 0xc0, 0xf, 0xff, 0xff, 0xfc, 0x0,
-    0x0, 0x0, 0xb, 0xff, 0xff, 0xf0, 0x7, 0xff,
-    0xff, 0xfd, 0x0, 0x0, 0x0, 0x2, 0xff, 0xff,
-    0xfc, 0x3, 0xff, 0xff, 0xfe, 0x0, 0x0, 0x0,
-    0x0, 0xbf, 0xff, 0xff, 0x3, 0xff, 0xff, 0xff,
-    0x0, 0x0, 0x0, 0x0, 0x2f, 0xff, 0xff, 0xff,
-    0xff, 0xff, 0xff, 0x0, 0x0, 0x0, 0x0, 0xb,
-    0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0x40, 0x0,
-    0x0, 0x0, 0x2, 0xff, 0xff, 0xff, 0xff, 0xff,
-    0xff, 0xc0, 0x0, 0x0, 0x0, 0x0, 0xbf, 0xff,
-    0xff, 0xff, 0xff, 0xff, 0xc0, 0x0, 0x0, 0x0,
-    0x0, 0x2f, 0xff, 0xff, 0xff, 0xff, 0xff, 0xf0,
-    0x0, 0x0, 0x0, 0x0, 0xb, 0xff, 0xff, 0xff,
-    0xff, 0xff, 0xff, 0x0, 0x0, 0x0, 0x0, 0x2,
-    0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xf0, 0x0,
-    0x0, 0x0, 0x0, 0xbf, 0xff, 0xff, 0xff, 0xff,
-    0xff, 0xff, 0x0, 0x0, 0x0, 0x0, 0x2f, 0xff,
-    0xff, 0xff, 0xff, 0xff, 0xff, 0xf0, 0x0, 0x0,
-    0x0, 0xb, 0xff, 0xff, 0xfe, 0xaf, 0xff, 0xff,
-    0xff, 0x0, 0x0, 0x0, 0x2, 0xff, 0xff, 0xfc,
-    0x0, 0xbf, 0xff, 0xff, 0xe0, 0x0, 0x0, 0x0,
-    0xbf, 0xff, 0xff, 0x0, 0xb, 0xff, 0xff, 0xfe,
-    0x0, 0x0, 0x0, 0x2f, 0xff, 0xff, 0xc0, 0x0,
-    0xbf, 0xff, 0xff, 0xd0, 0x0, 0x0, 0xb, 0xff,
-    0xff, 0xf0, 0x0, 0xb, 0xff, 0xff, 0xfc, 0x0,
-    0x0, 0x2, 0xff, 0xff, 0xfc, 0x0, 0x0, 0xff,
-    0xff, 0xff, 0xc0, 0x0, 0x0, 0xbf, 0xff, 0xff,
-    0x0, 0x0, 0xf, 0xff, 0xff, 0xfc, 0x0, 0x0,
-    0x2f, 0xff, 0xff, 0xc0, 0x0, 0x0, 0xff, 0xff,
-    0xff, 0x80, 0x0, 0xb, 0xff, 0xff, 0xf0, 0x0,
-    0x0, 0x1f, 0xff, 0xff, 0xf4, 0x0, 0x2, 0xff,
-    0xff, 0xfc, 0x0, 0x0, 0x2, 0xff, 0xff, 0xff,
-    0x0, 0x0, 0xbf, 0xff, 0xff, 0x0, 0x0, 0x0,
-    0x3f, 0xff, 0xff, 0xe0, 0x0, 0x2f, 0xff, 0xff,
-    0xc0, 0x0, 0x0, 0x3, 0xff, 0xff, 0xfd, 0x0,
-    0xb, 0xff, 0xff, 0xf0, 0x0, 0x0, 0x0, 0x7f,
-    0xff, 0xff, 0xc0, 0x2, 0xff, 0xff, 0xfc, 0x0,
-    0x0, 0x0, 0xb, 0xff, 0xff, 0xf8, 0x0, 0xbf,
-    0xff, 0xff, 0x0, 0x0, 0x0, 0x0, 0xff, 0xff,
-    0xff, 0x40, 0x2f, 0xff, 0xff, 0xc0, 0x0, 0x0,
-    0x0, 0x1f, 0xff, 0xff, 0xf0, 0xb, 0xff, 0xff,
-    0xf0, 0x0, 0x0, 0x0, 0x3, 0xff, 0xff, 0xfe,
-    0x2, 0xff, 0xff, 0xfc, 0x0, 0x0, 0x0, 0x0,
-    0x3f, 0xff, 0xff, 0xd0, 0xbf, 0xff, 0xff, 0x0,
-    0x0, 0x0, 0x0, 0xb, 0xff, 0xff, 0xfc, 0x2f,
-    0xff, 0xff, 0xc0, 0x0, 0x0, 0x0, 0x0, 0xff,
-    0xff, 0xff, 0x4b, 0xff, 0xff, 0xf0, 0x0, 0x0,
-    0x0, 0x0, 0x1f, 0xff, 0xff, 0xf0,
-
-    /* U+004C "L" */
-    0x55, 0x55, 0x55, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x2f, 0xff, 0xff, 0xc0, 0x0, 0x0, 0x0, 0x0,
-    0xb, 0xff, 0xff, 0xf0, 0x0, 0x0, 0x0, 0x0,
-    0x2, 0xff, 0xff, 0xfc, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0xbf, 0xff, 0xff, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x2f, 0xff, 0xff, 0xc0, 0x0, 0x0, 0x0,
-    0x0, 0xb, 0xff, 0xff, 0xf0, 0x0, 0x0, 0x0,
-    0x0, 0x2, 0xff, 0xff, 0xfc, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0xbf, 0xff, 0xff, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x2f, 0xff, 0xff, 0xc0, 0x0, 0x0,
-    0x0, 0x0, 0xb, 0xff, 0xff, 0xf0, 0x0, 0x0,
-    0x0, 0x0, 0x2, 0xff, 0xff, 0xfc, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0xbf, 0xff, 0xff, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x2f, 0xff, 0xff, 0xc0, 0x0,
-    0x0, 0x0, 0x0, 0xb, 0xff, 0xff, 0xf0, 0x0,
-    0x0, 0x0, 0x0, 0x2, 0xff, 0xff, 0xfc, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0xbf, 0xff, 0xff, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x2f, 0xff, 0xff, 0xc0,
-    0x0, 0x0, 0x0, 0x0, 0xb, 0xff, 0xff, 0xf0,
-    0x0, 0x0, 0x0, 0x0, 0x2, 0xff, 0xff, 0xfc,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0xbf, 0xff, 0xff,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x2f, 0xff, 0xff,
-    0xc0, 0x0, 0x0, 0x0, 0x0, 0xb, 0xff, 0xff,
-    0xf0, 0x0, 0x0, 0x0, 0x0, 0x2, 0xff, 0xff,
-    0xfc, 0x0, 0x0, 0x0, 0x0, 0x0, 0xbf, 0xff,
-    0xff, 0x0, 0x0, 0x0, 0x0, 0x0, 0x2f, 0xff,
-    0xff, 0xc0, 0x0, 0x0, 0x0, 0x0, 0xb, 0xff,
-    0xff, 0xf0, 0x0, 0x0, 0x0, 0x0, 0x2, 0xff,
-    0xff, 0xfc, 0x0, 0x0, 0x0, 0x0, 0x0, 0xbf,
-    0xff, 0xff, 0x0, 0x0, 0x0, 0x0, 0x0, 0x2f,
-    0xff, 0xff, 0xc0, 0x0, 0x0, 0x0, 0x0, 0xb,
-    0xff, 0xff, 0xf0, 0x0, 0x0, 0x0, 0x0, 0x2,
-    0xff, 0xff, 0xfc, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0xbf, 0xff, 0xff, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x2f, 0xff, 0xff, 0xc0, 0x0, 0x0, 0x0, 0x0,
-    0xb, 0xff, 0xff, 0xf0, 0x0, 0x0, 0x0, 0x0,
-    0x2, 0xff, 0xff, 0xfc, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0xbf, 0xff, 0xff, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x2f, 0xff, 0xff, 0xc0, 0x0, 0x0, 0x0,
-    0x0, 0xb, 0xff, 0xff, 0xf0, 0x0, 0x0, 0x0,
-    0x0, 0x2, 0xff, 0xff, 0xfc, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0xbf, 0xff, 0xff, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x2f, 0xff, 0xff, 0xff, 0xff, 0xff,
-    0xff, 0xff, 0xdb, 0xff, 0xff, 0xff, 0xff, 0xff,
-    0xff, 0xff, 0xfa, 0xff, 0xff, 0xff, 0xff, 0xff,
-    0xff, 0xff, 0xfe, 0xbf, 0xff, 0xff, 0xff, 0xff,
-    0xff, 0xff, 0xff, 0xaf, 0xff, 0xff, 0xff, 0xff,
-    0xff, 0xff, 0xff, 0xeb, 0xff, 0xff, 0xff, 0xff,
-    0xff, 0xff, 0xff, 0xfa, 0xff, 0xff, 0xff, 0xff,
-    0xff, 0xff, 0xff, 0xfe, 0xbf, 0xff, 0xff, 0xff,
-    0xff, 0xff, 0xff, 0xff, 0xaf, 0xff, 0xff, 0xff,
-    0xff, 0xff, 0xff, 0xff, 0xeb, 0xff, 0xff, 0xff,
-    0xff, 0xff, 0xff, 0xff, 0xf8,
-
-    /* U+004D "M" */
-    0xbf, 0xff, 0xff, 0xff, 0xff, 0xc0, 0x0, 0x0,
-    0x3, 0xff, 0xff, 0xff, 0xff, 0xfe, 0xbf, 0xff,
-    0xff, 0xff, 0xff, 0xd0, 0x0, 0x0, 0x7, 0xff,
-    0xff, 0xff, 0xff, 0xfe, 0xbf, 0xff, 0xff, 0xff,
-    0xff, 0xd0, 0x0, 0x0, 0xb, 0xff, 0xff, 0xff,
-    0xff, 0xfe, 0xbf, 0xff, 0xff, 0xff, 0xff, 0xe0,
-    0x0, 0x0, 0xb, 0xff, 0xff, 0xff, 0xff, 0xfe,
-    0xbf, 0xff, 0xff, 0xff, 0xff, 0xf0, 0x0, 0x0,
-    0xf, 0xff, 0xff, 0xff, 0xff, 0xfe, 0xbf, 0xff,
-    0xff, 0xff, 0xff, 0xf0, 0x0, 0x0, 0xf, 0xff,
-    0xff, 0xff, 0xff, 0xfe, 0xbf, 0xff, 0xff, 0xff,
-    0xff, 0xf0, 0x0, 0x0, 0x1f, 0xff, 0xff, 0xff,
-    0xff, 0xfe, 0xbf, 0xff, 0xff, 0xff, 0xff, 0xf4,
-    0x0, 0x0, 0x1f, 0xff, 0xff, 0xff, 0xff, 0xfe,
-    0xbf, 0xff, 0xff, 0xff, 0xff, 0xf8, 0x0, 0x0,
-    0x2f, 0xff, 0xff, 0xff, 0xff, 0xfe, 0xbf, 0xff,
-    0xff, 0x7f, 0xff, 0xfc, 0x0, 0x0, 0x3f, 0xff,
-    0xfd, 0xff, 0xff, 0xfe, 0xbf, 0xff, 0xff, 0x7f,
-    0xff, 0xfc, 0x0, 0x0, 0x3f, 0xff, 0xfd, 0xff,
-    0xff, 0xfe, 0xbf, 0xff, 0xff, 0x3f, 0xff, 0xfc,
-    0x0, 0x0, 0x3f, 0xff, 0xfc, 0xff, 0xff, 0xfe,
-    0xbf, 0xff, 0xff, 0x3f, 0xff, 0xfd, 0x0, 0x0,
-    0x7f, 0xff, 0xfc, 0xff, 0xff, 0xfe, 0xbf, 0xff,
-    0xff, 0x2f, 0xff, 0xfe, 0x0, 0x0, 0xbf, 0xff,
-    0xf8, 0xff, 0xff, 0xfe, 0xbf, 0xff, 0xff, 0x1f,
-    0xff, 0xfe, 0x0, 0x0, 0xff, 0xff, 0xf4, 0xff,
-    0xff, 0xfe, 0xbf, 0xff, 0xff, 0x1f, 0xff, 0xff,
-    0x0, 0x0, 0xff, 0xff, 0xf4, 0xff, 0xff, 0xfe,
-    0xbf, 0xff, 0xff, 0xf, 0xff, 0xff, 0x0, 0x0,
-    0xff, 0xff, 0xf0, 0xff, 0xff, 0xfe, 0xbf, 0xff,
-    0xff, 0xf, 0xff, 0xff, 0x40, 0x1, 0xff, 0xff,
-    0xf0, 0xff, 0xff, 0xfe, 0xbf, 0xff, 0xff, 0xb,
-    0xff, 0xff, 0x40, 0x2, 0xff, 0xff, 0xe0, 0xff,
-    0xff, 0xfe, 0xbf, 0xff, 0xff, 0x7, 0xff, 0xff,
-    0x80, 0x2, 0xff, 0xff, 0xd0, 0xff, 0xff, 0xfe,
-    0xbf, 0xff, 0xff, 0x3, 0xff, 0xff, 0xc0, 0x3,
-    0xff, 0xff, 0xc0, 0xff, 0xff, 0xfe, 0xbf, 0xff,
-    0xff, 0x3, 0xff, 0xff, 0xc0, 0x3, 0xff, 0xff,
-    0xc0, 0xff, 0xff, 0xfe, 0xbf, 0xff, 0xff, 0x3,
-    0xff, 0xff, 0xc0, 0x7, 0xff, 0xff, 0xc0, 0xff,
-    0xff, 0xfe, 0xbf, 0xff, 0xff, 0x2, 0xff, 0xff,
-    0xd0, 0x7, 0xff, 0xff, 0x80, 0xff, 0xff, 0xfe,
-    0xbf, 0xff, 0xff, 0x1, 0xff, 0xff, 0xe0, 0xb,
-    0xff, 0xff, 0x40, 0xff, 0xff, 0xfe, 0xbf, 0xff,
-    0xff, 0x0, 0xff, 0xff, 0xf0, 0xf, 0xff, 0xff,
-    0x0, 0xff, 0xff, 0xfe, 0xbf, 0xff, 0xff, 0x0,
-    0xff, 0xff, 0xf0, 0xf, 0xff, 0xff, 0x0, 0xff,
-    0xff, 0xfe, 0xbf, 0xff, 0xff, 0x0, 0xff, 0xff,
-    0xf0, 0xf, 0xff, 0xff, 0x0, 0xff, 0xff, 0xfe,
-    0xbf, 0xff, 0xff, 0x0, 0xbf, 0xff, 0xf4, 0x1f,
-    0xff, 0xfe, 0x0, 0xff, 0xff, 0xfe, 0xbf, 0xff,
-    0xff, 0x0, 0x7f, 0xff, 0xf8, 0x2f, 0xff, 0xfd,
-    0x0, 0xff, 0xff, 0xfe, 0xbf, 0xff, 0xff, 0x0,
-    0x3f, 0xff, 0xf8, 0x3f, 0xff, 0xfc, 0x0, 0xff,
-    0xff, 0xfe, 0xbf, 0xff, 0xff, 0x0, 0x3f, 0xff,
-    0xfc, 0x3f, 0xff, 0xfc, 0x0, 0xff, 0xff, 0xfe,
-    0xbf, 0xff, 0xff, 0x0, 0x3f, 0xff, 0xfc, 0x3f,
-    0xff, 0xfc, 0x0, 0xff, 0xff, 0xfe, 0xbf, 0xff,
-    0xff, 0x0, 0x2f, 0xff, 0xfd, 0x7f, 0xff, 0xf8,
-    0x0, 0xff, 0xff, 0xfe, 0xbf, 0xff, 0xff, 0x0,
-    0x1f, 0xff, 0xfd, 0xbf, 0xff, 0xf4, 0x0, 0xff,
-    0xff, 0xfe, 0xbf, 0xff, 0xff, 0x0, 0xf, 0xff,
-    0xfe, 0xbf, 0xff, 0xf0, 0x0, 0xff, 0xff, 0xfe,
-    0xbf, 0xff, 0xff, 0x0, 0xf, 0xff, 0xff, 0xff,
-    0xff, 0xf0, 0x0, 0xff, 0xff, 0xfe, 0xbf, 0xff,
-    0xff, 0x0, 0xf, 0xff, 0xff, 0xff, 0xff, 0xe0,
-    0x0, 0xff, 0xff, 0xfe, 0xbf, 0xff, 0xff, 0x0,
-    0xb, 0xff, 0xff, 0xff, 0xff, 0xe0, 0x0, 0xff,
-    0xff, 0xfe, 0xbf, 0xff, 0xff, 0x0, 0x7, 0xff,
-    0xff, 0xff, 0xff, 0xd0, 0x0, 0xff, 0xff, 0xfe,
-    0xbf, 0xff, 0xff, 0x0, 0x3, 0xff, 0xff, 0xff,
-    0xff, 0xc0, 0x0, 0xff, 0xff, 0xfe, 0xbf, 0xff,
-    0xff, 0x0, 0x3, 0xff, 0xff, 0xff, 0xff, 0xc0,
-    0x0, 0xff, 0xff, 0xfe, 0xbf, 0xff, 0xff, 0x0,
-    0x2, 0xff, 0xff, 0xff, 0xff, 0x80, 0x0, 0xff,
-    0xff, 0xfe, 0xbf, 0xff, 0xff, 0x0, 0x2, 0xff,
-    0xff, 0xff, 0xff, 0x40, 0x0, 0xff, 0xff, 0xfe,
-    0xbf, 0xff, 0xff, 0x0, 0x1, 0xff, 0xff, 0xff,
-    0xff, 0x40, 0x0, 0xff, 0xff, 0xfe, 0xbf, 0xff,
-    0xff, 0x0, 0x0, 0xff, 0xff, 0xff, 0xff, 0x0,
-    0x0, 0xff, 0xff, 0xfe, 0xbf, 0xff, 0xff, 0x0,
-    0x0, 0xff, 0xff, 0xff, 0xff, 0x0, 0x0, 0xff,
-    0xff, 0xfe, 0xbf, 0xff, 0xff, 0x0, 0x0, 0xbf,
-    0xff, 0xff, 0xfe, 0x0, 0x0, 0xff, 0xff, 0xfe,
-    0xbf, 0xff, 0xff, 0x0, 0x0, 0xbf, 0xff, 0xff,
-    0xfd, 0x0, 0x0, 0xff, 0xff, 0xfe, 0xbf, 0xff,
-    0xff, 0x0, 0x0, 0x7f, 0xff, 0xff, 0xfd, 0x0,
-    0x0, 0xff, 0xff, 0xfe, 0xbf, 0xff, 0xff, 0x0,
-    0x0, 0x3f, 0xff, 0xff, 0xfc, 0x0, 0x0, 0xff,
-    0xff, 0xfe,
-
-    /* U+004E "N" */
-    0x6a, 0xaa, 0xaa, 0xaa, 0xa8, 0x0, 0x0, 0x0,
-    0xaa, 0xaa, 0xaa, 0xbf, 0xff, 0xff, 0xff, 0xfe,
-    0x0, 0x0, 0x0, 0xff, 0xff, 0xff, 0xbf, 0xff,
-    0xff, 0xff, 0xff, 0x0, 0x0, 0x0, 0xff, 0xff,
-    0xff, 0xbf, 0xff, 0xff, 0xff, 0xff, 0x0, 0x0,
-    0x0, 0xff, 0xff, 0xff, 0xbf, 0xff, 0xff, 0xff,
-    0xff, 0x40, 0x0, 0x0, 0xff, 0xff, 0xff, 0xbf,
-    0xff, 0xff, 0xff, 0xff, 0xc0, 0x0, 0x0, 0xff,
-    0xff, 0xff, 0xbf, 0xff, 0xff, 0xff, 0xff, 0xc0,
-    0x0, 0x0, 0xff, 0xff, 0xff, 0xbf, 0xff, 0xff,
-    0xff, 0xff, 0xd0, 0x0, 0x0, 0xff, 0xff, 0xff,
-    0xbf, 0xff, 0xff, 0xff, 0xff, 0xe0, 0x0, 0x0,
-    0xff, 0xff, 0xff, 0xbf, 0xff, 0xff, 0xff, 0xff,
-    0xf0, 0x0, 0x0, 0xff, 0xff, 0xff, 0xbf, 0xff,
-    0xff, 0xff, 0xff, 0xf4, 0x0, 0x0, 0xff, 0xff,
-    0xff, 0xbf, 0xff, 0xff, 0xff, 0xff, 0xf8, 0x0,
-    0x0, 0xff, 0xff, 0xff, 0xbf, 0xff, 0xff, 0x7f,
-    0xff, 0xfc, 0x0, 0x0, 0xff, 0xff, 0xff, 0xbf,
-    0xff, 0xff, 0x3f, 0xff, 0xfc, 0x0, 0x0, 0xff,
-    0xff, 0xff, 0xbf, 0xff, 0xff, 0x2f, 0xff, 0xfe,
-    0x0, 0x0, 0xff, 0xff, 0xff, 0xbf, 0xff, 0xff,
-    0x1f, 0xff, 0xff, 0x0, 0x0, 0xff, 0xff, 0xff,
-    0xbf, 0xff, 0xff, 0xf, 0xff, 0xff, 0x0, 0x0,
-    0xff, 0xff, 0xff, 0xbf, 0xff, 0xff, 0xf, 0xff,
-    0xff, 0x40, 0x0, 0xff, 0xff, 0xff, 0xbf, 0xff,
-    0xff, 0x7, 0xff, 0xff, 0x80, 0x0, 0xff, 0xff,
-    0xff, 0xbf, 0xff, 0xff, 0x3, 0xff, 0xff, 0xc0,
-    0x0, 0xff, 0xff, 0xff, 0xbf, 0xff, 0xff, 0x3,
-    0xff, 0xff, 0xd0, 0x0, 0xff, 0xff, 0xff, 0xbf,
-    0xff, 0xff, 0x2, 0xff, 0xff, 0xe0, 0x0, 0xff,
-    0xff, 0xff, 0xbf, 0xff, 0xff, 0x0, 0xff, 0xff,
-    0xf0, 0x0, 0xff, 0xff, 0xff, 0xbf, 0xff, 0xff,
-    0x0, 0xff, 0xff, 0xf0, 0x0, 0xff, 0xff, 0xff,
-    0xbf, 0xff, 0xff, 0x0, 0xbf, 0xff, 0xf8, 0x0,
-    0xff, 0xff, 0xff, 0xbf, 0xff, 0xff, 0x0, 0x7f,
-    0xff, 0xfc, 0x0, 0xff, 0xff, 0xff, 0xbf, 0xff,
-    0xff, 0x0, 0x3f, 0xff, 0xfc, 0x0, 0xff, 0xff,
-    0xff, 0xbf, 0xff, 0xff, 0x0, 0x2f, 0xff, 0xfd,
-    0x0, 0xff, 0xff, 0xff, 0xbf, 0xff, 0xff, 0x0,
-    0x1f, 0xff, 0xfe, 0x0, 0xff, 0xff, 0xff, 0xbf,
-    0xff, 0xff, 0x0, 0xf, 0xff, 0xff, 0x0, 0xff,
-    0xff, 0xff, 0xbf, 0xff, 0xff, 0x0, 0xf, 0xff,
-    0xff, 0x40, 0xff, 0xff, 0xff, 0xbf, 0xff, 0xff,
-    0x0, 0x7, 0xff, 0xff, 0x80, 0xff, 0xff, 0xff,
-    0xbf, 0xff, 0xff, 0x0, 0x3, 0xff, 0xff, 0xc0,
-    0xff, 0xff, 0xff, 0xbf, 0xff, 0xff, 0x0, 0x3,
-    0xff, 0xff, 0xc0, 0xff, 0xff, 0xff, 0xbf, 0xff,
-    0xff, 0x0, 0x2, 0xff, 0xff, 0xe0, 0xff, 0xff,
-    0xff, 0xbf, 0xff, 0xff, 0x0, 0x0, 0xff, 0xff,
-    0xf0, 0xff, 0xff, 0xff, 0xbf, 0xff, 0xff, 0x0,
-    0x0, 0xff, 0xff, 0xf0, 0xff, 0xff, 0xff, 0xbf,
-    0xff, 0xff, 0x0, 0x0, 0xbf, 0xff, 0xf4, 0xff,
-    0xff, 0xff, 0xbf, 0xff, 0xff, 0x0, 0x0, 0x7f,
-    0xff, 0xf8, 0xff, 0xff, 0xff, 0xbf, 0xff, 0xff,
-    0x0, 0x0, 0x3f, 0xff, 0xfc, 0xff, 0xff, 0xff,
-    0xbf, 0xff, 0xff, 0x0, 0x0, 0x2f, 0xff, 0xfe,
-    0xff, 0xff, 0xff, 0xbf, 0xff, 0xff, 0x0, 0x0,
-    0x1f, 0xff, 0xff, 0xff, 0xff, 0xff, 0xbf, 0xff,
-    0xff, 0x0, 0x0, 0xf, 0xff, 0xff, 0xff, 0xff,
-    0xff, 0xbf, 0xff, 0xff, 0x0, 0x0, 0xf, 0xff,
-    0xff, 0xff, 0xff, 0xff, 0xbf, 0xff, 0xff, 0x0,
-    0x0, 0x7, 0xff, 0xff, 0xff, 0xff, 0xff, 0xbf,
-    0xff, 0xff, 0x0, 0x0, 0x3, 0xff, 0xff, 0xff,
-    0xff, 0xff, 0xbf, 0xff, 0xff, 0x0, 0x0, 0x3,
-    0xff, 0xff, 0xff, 0xff, 0xff, 0xbf, 0xff, 0xff,
-    0x0, 0x0, 0x2, 0xff, 0xff, 0xff, 0xff, 0xff,
-    0xbf, 0xff, 0xff, 0x0, 0x0, 0x1, 0xff, 0xff,
-    0xff, 0xff, 0xff, 0xbf, 0xff, 0xff, 0x0, 0x0,
-    0x0, 0xff, 0xff, 0xff, 0xff, 0xff, 0xbf, 0xff,
-    0xff, 0x0, 0x0, 0x0, 0xbf, 0xff, 0xff, 0xff,
-    0xff,
-
-    /* U+004F "O" */
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x6a, 0xff, 0xea,
-    0x40, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x1b, 0xff, 0xff, 0xff, 0xff, 0x90, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x7f, 0xff,
-    0xff, 0xff, 0xff, 0xff, 0x40, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x1, 0xff, 0xff, 0xff, 0xff, 0xff,
-    0xff, 0xfd, 0x0, 0x0, 0x0, 0x0, 0x0, 0x3,
-    0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xf0,
-    0x0, 0x0, 0x0, 0x0, 0x3, 0xff, 0xff, 0xff,
-    0xff, 0xff, 0xff, 0xff, 0xff, 0x40, 0x0, 0x0,
-    0x0, 0x7, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
-    0xff, 0xff, 0xf4, 0x0, 0x0, 0x0, 0x7, 0xff,
-    0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
-    0x40, 0x0, 0x0, 0x3, 0xff, 0xff, 0xff, 0xff,
-    0xff, 0xff, 0xff, 0xff, 0xff, 0xf4, 0x0, 0x0,
-    0x3, 0xff, 0xff, 0xff, 0xff, 0x50, 0x6, 0xff,
-    0xff, 0xff, 0xff, 0x0, 0x0, 0x2, 0xff, 0xff,
-    0xff, 0xfc, 0x0, 0x0, 0xb, 0xff, 0xff, 0xff,
-    0xe0, 0x0, 0x1, 0xff, 0xff, 0xff, 0xf8, 0x0,
-    0x0, 0x0, 0x7f, 0xff, 0xff, 0xfd, 0x0, 0x0,
-    0xff, 0xff, 0xff, 0xf4, 0x0, 0x0, 0x0, 0x7,
-    0xff, 0xff, 0xff, 0xc0, 0x0, 0x3f, 0xff, 0xff,
-    0xf8, 0x0, 0x0, 0x0, 0x0, 0x7f, 0xff, 0xff,
-    0xf4, 0x0, 0x2f, 0xff, 0xff, 0xfc, 0x0, 0x0,
-    0x0, 0x0, 0xb, 0xff, 0xff, 0xff, 0x0, 0xf,
-    0xff, 0xff, 0xfc, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0xff, 0xff, 0xff, 0xd0, 0xb, 0xff, 0xff, 0xfe,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x2f, 0xff, 0xff,
-    0xf8, 0x3, 0xff, 0xff, 0xff, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x3, 0xff, 0xff, 0xff, 0x0, 0xff,
-    0xff, 0xff, 0xc0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0xbf, 0xff, 0xff, 0xc0, 0x7f, 0xff, 0xff, 0xe0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x1f, 0xff, 0xff,
-    0xf4, 0x2f, 0xff, 0xff, 0xf4, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x3, 0xff, 0xff, 0xfe, 0xb, 0xff,
-    0xff, 0xfc, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0xff, 0xff, 0xff, 0xc3, 0xff, 0xff, 0xff, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x2f, 0xff, 0xff,
-    0xf0, 0xff, 0xff, 0xff, 0x80, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0xb, 0xff, 0xff, 0xfc, 0x3f, 0xff,
-    0xff, 0xe0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x2,
-    0xff, 0xff, 0xff, 0xf, 0xff, 0xff, 0xf8, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0xbf, 0xff, 0xff,
-    0xc3, 0xff, 0xff, 0xfe, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x1f, 0xff, 0xff, 0xf0, 0xff, 0xff,
-    0xff, 0x80, 0x0, 0x0, 0x0, 0x0, 0x0, 0x7,
-    0xff, 0xff, 0xfc, 0x3f, 0xff, 0xff, 0xe0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x1, 0xff, 0xff, 0xff,
-    0xf, 0xff, 0xff, 0xf8, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0xbf, 0xff, 0xff, 0xc3, 0xff, 0xff,
-    0xfe, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x2f,
-    0xff, 0xff, 0xf0, 0xff, 0xff, 0xff, 0xc0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0xb, 0xff, 0xff, 0xfc,
-    0x2f, 0xff, 0xff, 0xf0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x3, 0xff, 0xff, 0xff, 0xb, 0xff, 0xff,
-    0xfc, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0xff,
-    0xff, 0xff, 0x81, 0xff, 0xff, 0xff, 0x40, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x7f, 0xff, 0xff, 0xd0,
-    0x3f, 0xff, 0xff, 0xf0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x3f, 0xff, 0xff, 0xf0, 0xf, 0xff, 0xff,
-    0xfc, 0x0, 0x0, 0x0, 0x0, 0x0, 0xf, 0xff,
-    0xff, 0xfc, 0x1, 0xff, 0xff, 0xff, 0x80, 0x0,
-    0x0, 0x0, 0x0, 0xb, 0xff, 0xff, 0xfe, 0x0,
-    0x3f, 0xff, 0xff, 0xf4, 0x0, 0x0, 0x0, 0x0,
-    0x3, 0xff, 0xff, 0xff, 0x0, 0xb, 0xff, 0xff,
-    0xff, 0x0, 0x0, 0x0, 0x0, 0x3, 0xff, 0xff,
-    0xff, 0xc0, 0x0, 0xff, 0xff, 0xff, 0xe0, 0x0,
-    0x0, 0x0, 0x2, 0xff, 0xff, 0xff, 0xd0, 0x0,
-    0x2f, 0xff, 0xff, 0xfe, 0x0, 0x0, 0x0, 0x2,
-    0xff, 0xff, 0xff, 0xf0, 0x0, 0x3, 0xff, 0xff,
-    0xff, 0xf4, 0x0, 0x0, 0x7, 0xff, 0xff, 0xff,
-    0xf4, 0x0, 0x0, 0x7f, 0xff, 0xff, 0xff, 0xe0,
-    0x0, 0x1f, 0xff, 0xff, 0xff, 0xf8, 0x0, 0x0,
-    0xb, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
-    0xff, 0xff, 0xf8, 0x0, 0x0, 0x0, 0xff, 0xff,
-    0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xfc,
-    0x0, 0x0, 0x0, 0xb, 0xff, 0xff, 0xff, 0xff,
-    0xff, 0xff, 0xff, 0xff, 0xfc, 0x0, 0x0, 0x0,
-    0x0, 0xbf, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
-    0xff, 0xf8, 0x0, 0x0, 0x0, 0x0, 0x7, 0xff,
-    0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xf8, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x2f, 0xff, 0xff, 0xff,
-    0xff, 0xff, 0xff, 0xe0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0xbf, 0xff, 0xff, 0xff, 0xff, 0xff,
-    0x80, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x1,
-    0xbf, 0xff, 0xff, 0xff, 0xf9, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x6b, 0xff,
-    0xfa, 0x40, 0x0, 0x0, 0x0, 0x0, 0x0,
-
-    /* U+0050 "P" */
-    0x6a, 0xaa, 0xaa, 0xaa, 0xaa, 0xaa, 0x95, 0x0,
-    0x0, 0x0, 0xb, 0xff, 0xff, 0xff, 0xff, 0xff,
-    0xff, 0xff, 0x90, 0x0, 0x0, 0xbf, 0xff, 0xff,
-    0xff, 0xff, 0xff, 0xff, 0xff, 0xe0, 0x0, 0xb,
-    0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
-    0xd0, 0x0, 0xbf, 0xff, 0xff, 0xff, 0xff, 0xff,
-    0xff, 0xff, 0xff, 0x80, 0xb, 0xff, 0xff, 0xff,
-    0xff, 0xff, 0xff, 0xff, 0xff, 0xfe, 0x0, 0xbf,
-    0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
-    0xf4, 0xb, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
-    0xff, 0xff, 0xff, 0xc0, 0xbf, 0xff, 0xff, 0xff,
-    0xff, 0xff, 0xff, 0xff, 0xff, 0xfe, 0xb, 0xff,
-    0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
-    0xf0, 0xbf, 0xff, 0xff, 0x0, 0x0, 0x0, 0xb,
-    0xff, 0xff, 0xff, 0x8b, 0xff, 0xff, 0xf0, 0x0,
-    0x0, 0x0, 0xb, 0xff, 0xff, 0xfc, 0xbf, 0xff,
-    0xff, 0x0, 0x0, 0x0, 0x0, 0x2f, 0xff, 0xff,
-    0xcb, 0xff, 0xff, 0xf0, 0x0, 0x0, 0x0, 0x0,
-    0xff, 0xff, 0xfc, 0xbf, 0xff, 0xff, 0x0, 0x0,
-    0x0, 0x0, 0xb, 0xff, 0xff, 0xdb, 0xff, 0xff,
-    0xf0, 0x0, 0x0, 0x0, 0x0, 0x7f, 0xff, 0xfd,
-    0xbf, 0xff, 0xff, 0x0, 0x0, 0x0, 0x0, 0x3,
-    0xff, 0xff, 0xdb, 0xff, 0xff, 0xf0, 0x0, 0x0,
-    0x0, 0x0, 0x7f, 0xff, 0xfd, 0xbf, 0xff, 0xff,
-    0x0, 0x0, 0x0, 0x0, 0x7, 0xff, 0xff, 0xdb,
-    0xff, 0xff, 0xf0, 0x0, 0x0, 0x0, 0x0, 0xff,
-    0xff, 0xfd, 0xbf, 0xff, 0xff, 0x0, 0x0, 0x0,
-    0x0, 0x1f, 0xff, 0xff, 0xcb, 0xff, 0xff, 0xf0,
-    0x0, 0x0, 0x0, 0x3, 0xff, 0xff, 0xfc, 0xbf,
-    0xff, 0xff, 0x0, 0x0, 0x0, 0x2, 0xff, 0xff,
-    0xff, 0x8b, 0xff, 0xff, 0xfa, 0xaa, 0xaa, 0xab,
-    0xff, 0xff, 0xff, 0xf4, 0xbf, 0xff, 0xff, 0xff,
-    0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xb, 0xff,
-    0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
-    0xd0, 0xbf, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
-    0xff, 0xff, 0xfc, 0xb, 0xff, 0xff, 0xff, 0xff,
-    0xff, 0xff, 0xff, 0xff, 0xff, 0x0, 0xbf, 0xff,
-    0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xc0,
-    0xb, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
-    0xff, 0xf0, 0x0, 0xbf, 0xff, 0xff, 0xff, 0xff,
-    0xff, 0xff, 0xff, 0xf8, 0x0, 0xb, 0xff, 0xff,
-    0xff, 0xff, 0xff, 0xff, 0xff, 0xf8, 0x0, 0x0,
-    0xbf, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0x90,
-    0x0, 0x0, 0xb, 0xff, 0xff, 0xf0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0xbf, 0xff, 0xff,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0xb,
-    0xff, 0xff, 0xf0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0xbf, 0xff, 0xff, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0xb, 0xff, 0xff, 0xf0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0xbf,
-    0xff, 0xff, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0xb, 0xff, 0xff, 0xf0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0xbf, 0xff, 0xff, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0xb, 0xff,
-    0xff, 0xf0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0xbf, 0xff, 0xff, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0xb, 0xff, 0xff, 0xf0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0xbf, 0xff,
-    0xff, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0xb, 0xff, 0xff, 0xf0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0xbf, 0xff, 0xff, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0xb, 0xff, 0xff,
-    0xf0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0xbf, 0xff, 0xff, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0xb, 0xff, 0xff, 0xf0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0xbf, 0xff, 0xff,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-
-    /* U+0051 "Q" */
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x16, 0xaa, 0xa5,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x1, 0xbf, 0xff, 0xff, 0xfe, 0x40, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x1f, 0xff,
-    0xff, 0xff, 0xff, 0xfe, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x7f, 0xff, 0xff, 0xff, 0xff,
-    0xff, 0xf8, 0x0, 0x0, 0x0, 0x0, 0x0, 0x1,
-    0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xe0,
-    0x0, 0x0, 0x0, 0x0, 0x1, 0xff, 0xff, 0xff,
-    0xff, 0xff, 0xff, 0xff, 0xff, 0x0, 0x0, 0x0,
-    0x0, 0x2, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
-    0xff, 0xff, 0xf4, 0x0, 0x0, 0x0, 0x3, 0xff,
-    0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
-    0x40, 0x0, 0x0, 0x2, 0xff, 0xff, 0xff, 0xff,
-    0xff, 0xff, 0xff, 0xff, 0xff, 0xf4, 0x0, 0x0,
-    0x1, 0xff, 0xff, 0xff, 0xff, 0x50, 0x6, 0xff,
-    0xff, 0xff, 0xff, 0x0, 0x0, 0x0, 0xff, 0xff,
-    0xff, 0xf8, 0x0, 0x0, 0x7, 0xff, 0xff, 0xff,
-    0xf0, 0x0, 0x0, 0xff, 0xff, 0xff, 0xf4, 0x0,
-    0x0, 0x0, 0x2f, 0xff, 0xff, 0xfe, 0x0, 0x0,
-    0xbf, 0xff, 0xff, 0xf0, 0x0, 0x0, 0x0, 0x1,
-    0xff, 0xff, 0xff, 0xc0, 0x0, 0x3f, 0xff, 0xff,
-    0xf0, 0x0, 0x0, 0x0, 0x0, 0x1f, 0xff, 0xff,
-    0xf8, 0x0, 0x1f, 0xff, 0xff, 0xf0, 0x0, 0x0,
-    0x0, 0x0, 0x2, 0xff, 0xff, 0xff, 0x0, 0xf,
-    0xff, 0xff, 0xf8, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x3f, 0xff, 0xff, 0xe0, 0x7, 0xff, 0xff, 0xfc,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x7, 0xff, 0xff,
-    0xfc, 0x2, 0xff, 0xff, 0xfd, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0xff, 0xff, 0xff, 0x40, 0xff,
-    0xff, 0xff, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x1f, 0xff, 0xff, 0xe0, 0x3f, 0xff, 0xff, 0x80,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x3, 0xff, 0xff,
-    0xfc, 0x1f, 0xff, 0xff, 0xc0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0xbf, 0xff, 0xff, 0xb, 0xff,
-    0xff, 0xf0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x1f, 0xff, 0xff, 0xd3, 0xff, 0xff, 0xf8, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x3, 0xff, 0xff,
-    0xf4, 0xff, 0xff, 0xfe, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0xff, 0xff, 0xfd, 0x3f, 0xff,
-    0xff, 0x40, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x3f, 0xff, 0xff, 0x8f, 0xff, 0xff, 0xd0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0xf, 0xff, 0xff,
-    0xe3, 0xff, 0xff, 0xf4, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x2, 0xff, 0xff, 0xfc, 0xff, 0xff,
-    0xfd, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0xbf, 0xff, 0xff, 0x3f, 0xff, 0xff, 0x40, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x3f, 0xff, 0xff,
-    0x8f, 0xff, 0xff, 0xd0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0xf, 0xff, 0xff, 0xe3, 0xff, 0xff,
-    0xf8, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x3,
-    0xff, 0xff, 0xf8, 0xff, 0xff, 0xfe, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0xff, 0xff, 0xfd,
-    0x2f, 0xff, 0xff, 0xc0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x7f, 0xff, 0xff, 0x47, 0xff, 0xff,
-    0xf0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x2f,
-    0xff, 0xff, 0xc1, 0xff, 0xff, 0xfe, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0xf, 0xff, 0xff, 0xf0,
-    0x3f, 0xff, 0xff, 0xc0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x7, 0xff, 0xff, 0xf8, 0xb, 0xff, 0xff,
-    0xf4, 0x0, 0x0, 0x0, 0x0, 0x0, 0x3, 0xff,
-    0xff, 0xfd, 0x1, 0xff, 0xff, 0xff, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x1, 0xff, 0xff, 0xff, 0x0,
-    0x3f, 0xff, 0xff, 0xe0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0xff, 0xff, 0xff, 0x80, 0xb, 0xff, 0xff,
-    0xfd, 0x0, 0x0, 0x0, 0x0, 0x0, 0xff, 0xff,
-    0xff, 0xc0, 0x0, 0xff, 0xff, 0xff, 0xd0, 0x0,
-    0x0, 0x0, 0x0, 0xff, 0xff, 0xff, 0xe0, 0x0,
-    0x1f, 0xff, 0xff, 0xfe, 0x0, 0x0, 0x0, 0x0,
-    0xff, 0xff, 0xff, 0xf0, 0x0, 0x3, 0xff, 0xff,
-    0xff, 0xf4, 0x0, 0x0, 0x2, 0xff, 0xff, 0xff,
-    0xf8, 0x0, 0x0, 0x3f, 0xff, 0xff, 0xff, 0xe4,
-    0x0, 0x1f, 0xff, 0xff, 0xff, 0xfc, 0x0, 0x0,
-    0x7, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
-    0xff, 0xff, 0xfc, 0x0, 0x0, 0x0, 0x7f, 0xff,
-    0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xfc,
-    0x0, 0x0, 0x0, 0x7, 0xff, 0xff, 0xff, 0xff,
-    0xff, 0xff, 0xff, 0xff, 0xfc, 0x0, 0x0, 0x0,
-    0x0, 0x7f, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
-    0xff, 0xfc, 0x0, 0x0, 0x0, 0x0, 0x3, 0xff,
-    0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xf8, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x1f, 0xff, 0xff, 0xff,
-    0xff, 0xff, 0xff, 0xe0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x7f, 0xff, 0xff, 0xff, 0xff, 0xff,
-    0xd0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x1,
-    0xbf, 0xff, 0xff, 0xff, 0xff, 0xf8, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x6b, 0xff,
-    0xff, 0xff, 0xff, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x3, 0xff, 0xff,
-    0xe0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0xbf, 0xff, 0xfc, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0xf, 0xff, 0xff, 0x80, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x2, 0xff, 0xff,
-    0xf0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x7f, 0xff, 0xfd, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x5, 0x55, 0x55, 0x40, 0x0, 0x0,
-
-    /* U+0052 "R" */
-    0xbf, 0xff, 0xff, 0xff, 0xff, 0xff, 0xfe, 0x40,
-    0x0, 0x0, 0x2, 0xff, 0xff, 0xff, 0xff, 0xff,
-    0xff, 0xff, 0xf8, 0x0, 0x0, 0xb, 0xff, 0xff,
-    0xff, 0xff, 0xff, 0xff, 0xff, 0xfe, 0x0, 0x0,
-    0x2f, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
-    0xff, 0x0, 0x0, 0xbf, 0xff, 0xff, 0xff, 0xff,
-    0xff, 0xff, 0xff, 0xff, 0x0, 0x2, 0xff, 0xff,
-    0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0x0,
-    0xb, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
-    0xff, 0xff, 0x0, 0x2f, 0xff, 0xff, 0xff, 0xff,
-    0xff, 0xff, 0xff, 0xff, 0xfd, 0x0, 0xbf, 0xff,
-    0xff, 0x55, 0x55, 0x55, 0x6f, 0xff, 0xff, 0xfc,
-    0x2, 0xff, 0xff, 0xfc, 0x0, 0x0, 0x0, 0xb,
-    0xff, 0xff, 0xf0, 0xb, 0xff, 0xff, 0xf0, 0x0,
-    0x0, 0x0, 0x7, 0xff, 0xff, 0xe0, 0x2f, 0xff,
-    0xff, 0xc0, 0x0, 0x0, 0x0, 0xb, 0xff, 0xff,
-    0xc0, 0xbf, 0xff, 0xff, 0x0, 0x0, 0x0, 0x0,
-    0xf, 0xff, 0xff, 0x2, 0xff, 0xff, 0xfc, 0x0,
-    0x0, 0x0, 0x0, 0x2f, 0xff, 0xfc, 0xb, 0xff,
-    0xff, 0xf0, 0x0, 0x0, 0x0, 0x0, 0xbf, 0xff,
-    0xf0, 0x2f, 0xff, 0xff, 0xc0, 0x0, 0x0, 0x0,
-    0x2, 0xff, 0xff, 0xc0, 0xbf, 0xff, 0xff, 0x0,
-    0x0, 0x0, 0x0, 0xb, 0xff, 0xff, 0x2, 0xff,
-    0xff, 0xfc, 0x0, 0x0, 0x0, 0x0, 0x3f, 0xff,
-    0xfc, 0xb, 0xff, 0xff, 0xf0, 0x0, 0x0, 0x0,
-    0x2, 0xff, 0xff, 0xf0, 0x2f, 0xff, 0xff, 0xc0,
-    0x0, 0x0, 0x0, 0x1f, 0xff, 0xff, 0x80, 0xbf,
-    0xff, 0xff, 0x0, 0x0, 0x0, 0x2, 0xff, 0xff,
-    0xfd, 0x2, 0xff, 0xff, 0xfd, 0x55, 0x55, 0x55,
-    0xbf, 0xff, 0xff, 0xf0, 0xb, 0xff, 0xff, 0xff,
-    0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0x40, 0x2f,
-    0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
-    0xfc, 0x0, 0xbf, 0xff, 0xff, 0xff, 0xff, 0xff,
-    0xff, 0xff, 0xff, 0xc0, 0x2, 0xff, 0xff, 0xff,
-    0xff, 0xff, 0xff, 0xff, 0xff, 0xfd, 0x0, 0xb,
-    0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
-    0xd0, 0x0, 0x2f, 0xff, 0xff, 0xff, 0xff, 0xff,
-    0xff, 0xff, 0xf8, 0x0, 0x0, 0xbf, 0xff, 0xff,
-    0xff, 0xff, 0xff, 0xff, 0xfe, 0x0, 0x0, 0x2,
-    0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0x0,
-    0x0, 0x0, 0xb, 0xff, 0xff, 0xf0, 0xb, 0xff,
-    0xff, 0xfd, 0x0, 0x0, 0x0, 0x2f, 0xff, 0xff,
-    0xc0, 0xb, 0xff, 0xff, 0xfc, 0x0, 0x0, 0x0,
-    0xbf, 0xff, 0xff, 0x0, 0xf, 0xff, 0xff, 0xfc,
-    0x0, 0x0, 0x2, 0xff, 0xff, 0xfc, 0x0, 0xf,
-    0xff, 0xff, 0xfc, 0x0, 0x0, 0xb, 0xff, 0xff,
-    0xf0, 0x0, 0xf, 0xff, 0xff, 0xf8, 0x0, 0x0,
-    0x2f, 0xff, 0xff, 0xc0, 0x0, 0x1f, 0xff, 0xff,
-    0xf4, 0x0, 0x0, 0xbf, 0xff, 0xff, 0x0, 0x0,
-    0x2f, 0xff, 0xff, 0xf0, 0x0, 0x2, 0xff, 0xff,
-    0xfc, 0x0, 0x0, 0x3f, 0xff, 0xff, 0xe0, 0x0,
-    0xb, 0xff, 0xff, 0xf0, 0x0, 0x0, 0x3f, 0xff,
-    0xff, 0xd0, 0x0, 0x2f, 0xff, 0xff, 0xc0, 0x0,
-    0x0, 0x7f, 0xff, 0xff, 0xc0, 0x0, 0xbf, 0xff,
-    0xff, 0x0, 0x0, 0x0, 0xff, 0xff, 0xff, 0x80,
-    0x2, 0xff, 0xff, 0xfc, 0x0, 0x0, 0x0, 0xff,
-    0xff, 0xff, 0x40, 0xb, 0xff, 0xff, 0xf0, 0x0,
-    0x0, 0x2, 0xff, 0xff, 0xff, 0x0, 0x2f, 0xff,
-    0xff, 0xc0, 0x0, 0x0, 0x3, 0xff, 0xff, 0xfd,
-    0x0, 0xbf, 0xff, 0xff, 0x0, 0x0, 0x0, 0x7,
-    0xff, 0xff, 0xfc, 0x2, 0xff, 0xff, 0xfc, 0x0,
-    0x0, 0x0, 0xf, 0xff, 0xff, 0xf8, 0xb, 0xff,
-    0xff, 0xf0, 0x0, 0x0, 0x0, 0x1f, 0xff, 0xff,
-    0xf0, 0x2f, 0xff, 0xff, 0xc0, 0x0, 0x0, 0x0,
-    0x3f, 0xff, 0xff, 0xe0, 0xbf, 0xff, 0xff, 0x0,
-    0x0, 0x0, 0x0, 0x7f, 0xff, 0xff, 0xc2, 0xff,
-    0xff, 0xfc, 0x0, 0x0, 0x0, 0x0, 0xff, 0xff,
-    0xff, 0x85, 0x55, 0x55, 0x50, 0x0, 0x0, 0x0,
-    0x0, 0x55, 0x55, 0x55, 0x0,
-
-    /* U+0053 "S" */
-    0x0, 0x0, 0x0, 0x6f, 0xff, 0xff, 0x94, 0x0,
-    0x0, 0x0, 0x0, 0x7, 0xff, 0xff, 0xff, 0xff,
-    0xf9, 0x0, 0x0, 0x0, 0x1f, 0xff, 0xff, 0xff,
-    0xff, 0xff, 0xfc, 0x0, 0x0, 0x3f, 0xff, 0xff,
-    0xff, 0xff, 0xff, 0xff, 0x0, 0x0, 0x3f, 0xff,
-    0xff, 0xff, 0xff, 0xff, 0xff, 0xc0, 0x0, 0x3f,
-    0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xf0, 0x0,
-    0x2f, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xfc,
-    0x0, 0xf, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
-    0xff, 0x0, 0xb, 0xff, 0xff, 0xff, 0xff, 0xff,
-    0xff, 0xff, 0xc0, 0x3, 0xff, 0xff, 0xff, 0x90,
-    0x0, 0x1a, 0xff, 0xf0, 0x1, 0xff, 0xff, 0xff,
-    0x0, 0x0, 0x0, 0x1, 0xbc, 0x0, 0xbf, 0xff,
-    0xff, 0x0, 0x0, 0x0, 0x0, 0x1, 0x0, 0x2f,
-    0xff, 0xff, 0x80, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0xf, 0xff, 0xff, 0xd0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x3, 0xff, 0xff, 0xf4, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0xbf, 0xff, 0xff, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x2f, 0xff, 0xff, 0xd0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x7, 0xff, 0xff,
-    0xfd, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0xff,
-    0xff, 0xff, 0xe0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x3f, 0xff, 0xff, 0xff, 0x80, 0x0, 0x0, 0x0,
-    0x0, 0x7, 0xff, 0xff, 0xff, 0xfe, 0x40, 0x0,
-    0x0, 0x0, 0x0, 0xff, 0xff, 0xff, 0xff, 0xfe,
-    0x40, 0x0, 0x0, 0x0, 0xf, 0xff, 0xff, 0xff,
-    0xff, 0xfe, 0x0, 0x0, 0x0, 0x1, 0xff, 0xff,
-    0xff, 0xff, 0xff, 0xf8, 0x0, 0x0, 0x0, 0xb,
-    0xff, 0xff, 0xff, 0xff, 0xff, 0xe0, 0x0, 0x0,
-    0x0, 0x7f, 0xff, 0xff, 0xff, 0xff, 0xff, 0x40,
-    0x0, 0x0, 0x2, 0xff, 0xff, 0xff, 0xff, 0xff,
-    0xf4, 0x0, 0x0, 0x0, 0x7, 0xff, 0xff, 0xff,
-    0xff, 0xff, 0x40, 0x0, 0x0, 0x0, 0x7, 0xff,
-    0xff, 0xff, 0xff, 0xf0, 0x0, 0x0, 0x0, 0x0,
-    0xb, 0xff, 0xff, 0xff, 0xff, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x1f, 0xff, 0xff, 0xff, 0xc0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0xbf, 0xff, 0xff, 0xf8,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x7, 0xff, 0xff,
-    0xff, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x7f,
-    0xff, 0xff, 0xc0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0xb, 0xff, 0xff, 0xf4, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0xff, 0xff, 0xfd, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x3f, 0xff, 0xff, 0x80, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0xf, 0xff, 0xff, 0xe7,
-    0x80, 0x0, 0x0, 0x0, 0x0, 0x3, 0xff, 0xff,
-    0xf5, 0xfe, 0x0, 0x0, 0x0, 0x0, 0x1, 0xff,
-    0xff, 0xfd, 0x7f, 0xf9, 0x0, 0x0, 0x0, 0x0,
-    0xff, 0xff, 0xff, 0x1f, 0xff, 0xf9, 0x0, 0x0,
-    0x0, 0xff, 0xff, 0xff, 0xc7, 0xff, 0xff, 0xfe,
-    0x50, 0x6, 0xff, 0xff, 0xff, 0xe1, 0xff, 0xff,
-    0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xf0, 0x7f,
-    0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xf8,
-    0x1f, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
-    0xfc, 0x7, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
-    0xff, 0xfd, 0x1, 0xff, 0xff, 0xff, 0xff, 0xff,
-    0xff, 0xff, 0xfe, 0x0, 0x1f, 0xff, 0xff, 0xff,
-    0xff, 0xff, 0xff, 0xfd, 0x0, 0x0, 0x6f, 0xff,
-    0xff, 0xff, 0xff, 0xff, 0xfc, 0x0, 0x0, 0x0,
-    0x6f, 0xff, 0xff, 0xff, 0xff, 0xe4, 0x0, 0x0,
-    0x0, 0x0, 0x16, 0xff, 0xff, 0xfe, 0x40, 0x0,
-    0x0,
-
-    /* U+0054 "T" */
-    0xbf, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
-    0xff, 0xf3, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
-    0xff, 0xff, 0xff, 0xcf, 0xff, 0xff, 0xff, 0xff,
-    0xff, 0xff, 0xff, 0xff, 0xff, 0x3f, 0xff, 0xff,
-    0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xfc, 0xff,
-    0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
-    0xf3, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
-    0xff, 0xff, 0xcf, 0xff, 0xff, 0xff, 0xff, 0xff,
-    0xff, 0xff, 0xff, 0xff, 0x3f, 0xff, 0xff, 0xff,
-    0xff, 0xff, 0xff, 0xff, 0xff, 0xfc, 0xff, 0xff,
-    0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xf3,
-    0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
-    0xff, 0xc0, 0x0, 0x0, 0x3, 0xff, 0xff, 0xfc,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0xf, 0xff,
-    0xff, 0xf0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x3f, 0xff, 0xff, 0xc0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0xff, 0xff, 0xff, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x3, 0xff, 0xff, 0xfc, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0xf, 0xff, 0xff,
-    0xf0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x3f,
-    0xff, 0xff, 0xc0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0xff, 0xff, 0xff, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x3, 0xff, 0xff, 0xfc, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0xf, 0xff, 0xff, 0xf0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x3f, 0xff,
-    0xff, 0xc0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0xff, 0xff, 0xff, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x3, 0xff, 0xff, 0xfc, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0xf, 0xff, 0xff, 0xf0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x3f, 0xff, 0xff,
-    0xc0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0xff,
-    0xff, 0xff, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x3, 0xff, 0xff, 0xfc, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0xf, 0xff, 0xff, 0xf0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x3f, 0xff, 0xff, 0xc0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0xff, 0xff,
-    0xff, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x3,
-    0xff, 0xff, 0xfc, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0xf, 0xff, 0xff, 0xf0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x3f, 0xff, 0xff, 0xc0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0xff, 0xff, 0xff,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x3, 0xff,
-    0xff, 0xfc, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0xf, 0xff, 0xff, 0xf0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x3f, 0xff, 0xff, 0xc0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0xff, 0xff, 0xff, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x3, 0xff, 0xff,
-    0xfc, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0xf,
-    0xff, 0xff, 0xf0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x3f, 0xff, 0xff, 0xc0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0xff, 0xff, 0xff, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x3, 0xff, 0xff, 0xfc,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0xf, 0xff,
-    0xff, 0xf0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x3f, 0xff, 0xff, 0xc0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0xff, 0xff, 0xff, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x3, 0xff, 0xff, 0xfc, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0xf, 0xff, 0xff,
-    0xf0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x3f,
-    0xff, 0xff, 0xc0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0xff, 0xff, 0xff, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x3, 0xff, 0xff, 0xfc, 0x0, 0x0,
-    0x0, 0x0,
-
-    /* U+0055 "U" */
-    0x55, 0x55, 0x55, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x15, 0x55, 0x55, 0x6f, 0xff, 0xff, 0xc0, 0x0,
-    0x0, 0x0, 0x0, 0x1f, 0xff, 0xff, 0xeb, 0xff,
-    0xff, 0xf0, 0x0, 0x0, 0x0, 0x0, 0x7, 0xff,
-    0xff, 0xfa, 0xff, 0xff, 0xfc, 0x0, 0x0, 0x0,
-    0x0, 0x1, 0xff, 0xff, 0xfe, 0xbf, 0xff, 0xff,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x7f, 0xff, 0xff,
-    0xaf, 0xff, 0xff, 0xc0, 0x0, 0x0, 0x0, 0x0,
-    0x1f, 0xff, 0xff, 0xeb, 0xff, 0xff, 0xf0, 0x0,
-    0x0, 0x0, 0x0, 0x7, 0xff, 0xff, 0xfa, 0xff,
-    0xff, 0xfc, 0x0, 0x0, 0x0, 0x0, 0x1, 0xff,
-    0xff, 0xfe, 0xbf, 0xff, 0xff, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x7f, 0xff, 0xff, 0xaf, 0xff, 0xff,
-    0xc0, 0x0, 0x0, 0x0, 0x0, 0x1f, 0xff, 0xff,
-    0xeb, 0xff, 0xff, 0xf0, 0x0, 0x0, 0x0, 0x0,
-    0x7, 0xff, 0xff, 0xfa, 0xff, 0xff, 0xfc, 0x0,
-    0x0, 0x0, 0x0, 0x1, 0xff, 0xff, 0xfe, 0xbf,
-    0xff, 0xff, 0x0, 0x0, 0x0, 0x0, 0x0, 0x7f,
-    0xff, 0xff, 0xaf, 0xff, 0xff, 0xc0, 0x0, 0x0,
-    0x0, 0x0, 0x1f, 0xff, 0xff, 0xeb, 0xff, 0xff,
-    0xf0, 0x0, 0x0, 0x0, 0x0, 0x7, 0xff, 0xff,
-    0xfa, 0xff, 0xff, 0xfc, 0x0, 0x0, 0x0, 0x0,
-    0x1, 0xff, 0xff, 0xfe, 0xbf, 0xff, 0xff, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x7f, 0xff, 0xff, 0xaf,
-    0xff, 0xff, 0xc0, 0x0, 0x0, 0x0, 0x0, 0x1f,
-    0xff, 0xff, 0xeb, 0xff, 0xff, 0xf0, 0x0, 0x0,
-    0x0, 0x0, 0x7, 0xff, 0xff, 0xfa, 0xff, 0xff,
-    0xfc, 0x0, 0x0, 0x0, 0x0, 0x1, 0xff, 0xff,
-    0xfe, 0xbf, 0xff, 0xff, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x7f, 0xff, 0xff, 0xaf, 0xff, 0xff, 0xc0,
-    0x0, 0x0, 0x0, 0x0, 0x1f, 0xff, 0xff, 0xeb,
-    0xff, 0xff, 0xf0, 0x0, 0x0, 0x0, 0x0, 0x7,
-    0xff, 0xff, 0xfa, 0xff, 0xff, 0xfc, 0x0, 0x0,
-    0x0, 0x0, 0x1, 0xff, 0xff, 0xfe, 0xbf, 0xff,
-    0xff, 0x0, 0x0, 0x0, 0x0, 0x0, 0x7f, 0xff,
-    0xff, 0xaf, 0xff, 0xff, 0xc0, 0x0, 0x0, 0x0,
-    0x0, 0x1f, 0xff, 0xff, 0xeb, 0xff, 0xff, 0xf0,
-    0x0, 0x0, 0x0, 0x0, 0x7, 0xff, 0xff, 0xfa,
-    0xff, 0xff, 0xfc, 0x0, 0x0, 0x0, 0x0, 0x1,
-    0xff, 0xff, 0xfe, 0xbf, 0xff, 0xff, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x7f, 0xff, 0xff, 0xaf, 0xff,
-    0xff, 0xc0, 0x0, 0x0, 0x0, 0x0, 0x1f, 0xff,
-    0xff, 0xeb, 0xff, 0xff, 0xf0, 0x0, 0x0, 0x0,
-    0x0, 0x7, 0xff, 0xff, 0xfa, 0xff, 0xff, 0xfc,
-    0x0, 0x0, 0x0, 0x0, 0x1, 0xff, 0xff, 0xfe,
-    0xbf, 0xff, 0xff, 0x40, 0x0, 0x0, 0x0, 0x0,
-    0x7f, 0xff, 0xff, 0x6f, 0xff, 0xff, 0xd0, 0x0,
-    0x0, 0x0, 0x0, 0x1f, 0xff, 0xff, 0xd7, 0xff,
-    0xff, 0xf8, 0x0, 0x0, 0x0, 0x0, 0xb, 0xff,
-    0xff, 0xf5, 0xff, 0xff, 0xff, 0x0, 0x0, 0x0,
-    0x0, 0x3, 0xff, 0xff, 0xfc, 0x3f, 0xff, 0xff,
-    0xd0, 0x0, 0x0, 0x0, 0x2, 0xff, 0xff, 0xff,
-    0xf, 0xff, 0xff, 0xfc, 0x0, 0x0, 0x0, 0x0,
-    0xff, 0xff, 0xff, 0xc2, 0xff, 0xff, 0xff, 0xc0,
-    0x0, 0x0, 0x0, 0xff, 0xff, 0xff, 0xd0, 0x7f,
-    0xff, 0xff, 0xfc, 0x0, 0x0, 0x0, 0xff, 0xff,
-    0xff, 0xf0, 0xf, 0xff, 0xff, 0xff, 0xd0, 0x0,
-    0x1, 0xff, 0xff, 0xff, 0xfc, 0x1, 0xff, 0xff,
-    0xff, 0xff, 0x95, 0x5b, 0xff, 0xff, 0xff, 0xfc,
-    0x0, 0x3f, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
-    0xff, 0xff, 0xfe, 0x0, 0x3, 0xff, 0xff, 0xff,
-    0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0x0, 0x0,
-    0x7f, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
-    0xff, 0x40, 0x0, 0xb, 0xff, 0xff, 0xff, 0xff,
-    0xff, 0xff, 0xff, 0xff, 0x40, 0x0, 0x0, 0xbf,
-    0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0x80,
-    0x0, 0x0, 0x7, 0xff, 0xff, 0xff, 0xff, 0xff,
-    0xff, 0xff, 0x40, 0x0, 0x0, 0x0, 0x3f, 0xff,
-    0xff, 0xff, 0xff, 0xff, 0xff, 0x0, 0x0, 0x0,
-    0x0, 0x1, 0xff, 0xff, 0xff, 0xff, 0xff, 0xf9,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x2, 0xff, 0xff,
-    0xff, 0xff, 0xe0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x1, 0xaf, 0xff, 0xe9, 0x0, 0x0, 0x0,
-    0x0,
-
-    /* U+0056 "V" */
-    0x15, 0x55, 0x55, 0x50, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x5, 0x55, 0x55, 0x54, 0xff, 0xff, 0xff,
-    0xc0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x3f, 0xff,
-    0xff, 0xe2, 0xff, 0xff, 0xff, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x1, 0xff, 0xff, 0xff, 0x47, 0xff,
-    0xff, 0xfd, 0x0, 0x0, 0x0, 0x0, 0x0, 0xf,
-    0xff, 0xff, 0xfc, 0xf, 0xff, 0xff, 0xf8, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x3f, 0xff, 0xff, 0xe0,
-    0x2f, 0xff, 0xff, 0xf0, 0x0, 0x0, 0x0, 0x0,
-    0x1, 0xff, 0xff, 0xff, 0x40, 0x7f, 0xff, 0xff,
-    0xd0, 0x0, 0x0, 0x0, 0x0, 0xb, 0xff, 0xff,
-    0xfc, 0x0, 0xff, 0xff, 0xff, 0x80, 0x0, 0x0,
-    0x0, 0x0, 0x3f, 0xff, 0xff, 0xf0, 0x3, 0xff,
-    0xff, 0xff, 0x0, 0x0, 0x0, 0x0, 0x0, 0xff,
-    0xff, 0xff, 0x80, 0xb, 0xff, 0xff, 0xfc, 0x0,
-    0x0, 0x0, 0x0, 0x7, 0xff, 0xff, 0xfc, 0x0,
-    0xf, 0xff, 0xff, 0xf4, 0x0, 0x0, 0x0, 0x0,
-    0x3f, 0xff, 0xff, 0xf0, 0x0, 0x3f, 0xff, 0xff,
-    0xe0, 0x0, 0x0, 0x0, 0x0, 0xff, 0xff, 0xff,
-    0x80, 0x0, 0xbf, 0xff, 0xff, 0xc0, 0x0, 0x0,
-    0x0, 0x7, 0xff, 0xff, 0xfd, 0x0, 0x1, 0xff,
-    0xff, 0xff, 0x40, 0x0, 0x0, 0x0, 0x2f, 0xff,
-    0xff, 0xf0, 0x0, 0x3, 0xff, 0xff, 0xfe, 0x0,
-    0x0, 0x0, 0x0, 0xff, 0xff, 0xff, 0x80, 0x0,
-    0xb, 0xff, 0xff, 0xfc, 0x0, 0x0, 0x0, 0x3,
-    0xff, 0xff, 0xfd, 0x0, 0x0, 0x1f, 0xff, 0xff,
-    0xf0, 0x0, 0x0, 0x0, 0x1f, 0xff, 0xff, 0xf0,
-    0x0, 0x0, 0x3f, 0xff, 0xff, 0xd0, 0x0, 0x0,
-    0x0, 0xff, 0xff, 0xff, 0x80, 0x0, 0x0, 0xbf,
-    0xff, 0xff, 0x80, 0x0, 0x0, 0x3, 0xff, 0xff,
-    0xfd, 0x0, 0x0, 0x1, 0xff, 0xff, 0xff, 0x0,
-    0x0, 0x0, 0x1f, 0xff, 0xff, 0xf0, 0x0, 0x0,
-    0x3, 0xff, 0xff, 0xfd, 0x0, 0x0, 0x0, 0xbf,
-    0xff, 0xff, 0xc0, 0x0, 0x0, 0xf, 0xff, 0xff,
-    0xf8, 0x0, 0x0, 0x3, 0xff, 0xff, 0xfe, 0x0,
-    0x0, 0x0, 0x2f, 0xff, 0xff, 0xf0, 0x0, 0x0,
-    0xf, 0xff, 0xff, 0xf0, 0x0, 0x0, 0x0, 0x3f,
-    0xff, 0xff, 0xc0, 0x0, 0x0, 0x7f, 0xff, 0xff,
-    0xc0, 0x0, 0x0, 0x0, 0xff, 0xff, 0xff, 0x40,
-    0x0, 0x2, 0xff, 0xff, 0xfe, 0x0, 0x0, 0x0,
-    0x2, 0xff, 0xff, 0xfe, 0x0, 0x0, 0xf, 0xff,
-    0xff, 0xf4, 0x0, 0x0, 0x0, 0x7, 0xff, 0xff,
-    0xfc, 0x0, 0x0, 0x7f, 0xff, 0xff, 0xc0, 0x0,
-    0x0, 0x0, 0xf, 0xff, 0xff, 0xf4, 0x0, 0x2,
-    0xff, 0xff, 0xfe, 0x0, 0x0, 0x0, 0x0, 0x2f,
-    0xff, 0xff, 0xe0, 0x0, 0xf, 0xff, 0xff, 0xf4,
-    0x0, 0x0, 0x0, 0x0, 0x7f, 0xff, 0xff, 0xc0,
-    0x0, 0x3f, 0xff, 0xff, 0xc0, 0x0, 0x0, 0x0,
-    0x0, 0xff, 0xff, 0xff, 0x0, 0x1, 0xff, 0xff,
-    0xfe, 0x0, 0x0, 0x0, 0x0, 0x2, 0xff, 0xff,
-    0xfd, 0x0, 0xb, 0xff, 0xff, 0xf4, 0x0, 0x0,
-    0x0, 0x0, 0x7, 0xff, 0xff, 0xf8, 0x0, 0x3f,
-    0xff, 0xff, 0xc0, 0x0, 0x0, 0x0, 0x0, 0xf,
-    0xff, 0xff, 0xf0, 0x1, 0xff, 0xff, 0xff, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x3f, 0xff, 0xff, 0xd0,
-    0xb, 0xff, 0xff, 0xf4, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0xbf, 0xff, 0xff, 0x80, 0x3f, 0xff, 0xff,
-    0xc0, 0x0, 0x0, 0x0, 0x0, 0x0, 0xff, 0xff,
-    0xff, 0x0, 0xff, 0xff, 0xff, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x3, 0xff, 0xff, 0xfc, 0x7, 0xff,
-    0xff, 0xf8, 0x0, 0x0, 0x0, 0x0, 0x0, 0xb,
-    0xff, 0xff, 0xf4, 0x2f, 0xff, 0xff, 0xd0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x1f, 0xff, 0xff, 0xe0,
-    0xff, 0xff, 0xff, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x3f, 0xff, 0xff, 0xc7, 0xff, 0xff, 0xf8,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0xbf, 0xff,
-    0xff, 0x6f, 0xff, 0xff, 0xd0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x1, 0xff, 0xff, 0xfe, 0xff, 0xff,
-    0xff, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x3,
-    0xff, 0xff, 0xff, 0xff, 0xff, 0xf8, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0xb, 0xff, 0xff, 0xff,
-    0xff, 0xff, 0xd0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x1f, 0xff, 0xff, 0xff, 0xff, 0xff, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x3f, 0xff,
-    0xff, 0xff, 0xff, 0xfc, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0xff, 0xff, 0xff, 0xff, 0xff,
-    0xd0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x2,
-    0xff, 0xff, 0xff, 0xff, 0xff, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x3, 0xff, 0xff, 0xff,
-    0xff, 0xfc, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0xf, 0xff, 0xff, 0xff, 0xff, 0xe0, 0x0,
-    0x0, 0x0, 0x0,
-
-    /* U+0057 "W" */
-    0x55, 0x55, 0x55, 0x40, 0x0, 0x0, 0x1, 0x55,
-    0x55, 0x50, 0x0, 0x0, 0x0, 0x15, 0x55, 0x55,
-    0x4b, 0xff, 0xff, 0xf8, 0x0, 0x0, 0x0, 0x3f,
-    0xff, 0xff, 0x0, 0x0, 0x0, 0x7, 0xff, 0xff,
-    0xfc, 0x7f, 0xff, 0xff, 0xc0, 0x0, 0x0, 0x3,
-    0xff, 0xff, 0xf4, 0x0, 0x0, 0x0, 0xbf, 0xff,
-    0xff, 0x83, 0xff, 0xff, 0xfc, 0x0, 0x0, 0x0,
-    0x7f, 0xff, 0xff, 0x80, 0x0, 0x0, 0xf, 0xff,
-    0xff, 0xf4, 0x3f, 0xff, 0xff, 0xc0, 0x0, 0x0,
-    0xb, 0xff, 0xff, 0xfc, 0x0, 0x0, 0x0, 0xff,
-    0xff, 0xff, 0x2, 0xff, 0xff, 0xfd, 0x0, 0x0,
-    0x0, 0xff, 0xff, 0xff, 0xc0, 0x0, 0x0, 0xf,
-    0xff, 0xff, 0xf0, 0x1f, 0xff, 0xff, 0xe0, 0x0,
-    0x0, 0xf, 0xff, 0xff, 0xfc, 0x0, 0x0, 0x1,
-    0xff, 0xff, 0xfe, 0x0, 0xff, 0xff, 0xff, 0x0,
-    0x0, 0x0, 0xff, 0xff, 0xff, 0xd0, 0x0, 0x0,
-    0x2f, 0xff, 0xff, 0xd0, 0xf, 0xff, 0xff, 0xf0,
-    0x0, 0x0, 0x1f, 0xff, 0xff, 0xfe, 0x0, 0x0,
-    0x3, 0xff, 0xff, 0xfc, 0x0, 0xbf, 0xff, 0xff,
-    0x0, 0x0, 0x2, 0xff, 0xff, 0xff, 0xe0, 0x0,
-    0x0, 0x3f, 0xff, 0xff, 0xc0, 0x7, 0xff, 0xff,
-    0xf4, 0x0, 0x0, 0x2f, 0xff, 0xff, 0xff, 0x0,
-    0x0, 0x3, 0xff, 0xff, 0xf8, 0x0, 0x7f, 0xff,
-    0xff, 0x80, 0x0, 0x3, 0xff, 0xff, 0xff, 0xf0,
-    0x0, 0x0, 0x7f, 0xff, 0xff, 0x40, 0x3, 0xff,
-    0xff, 0xf8, 0x0, 0x0, 0x3f, 0xff, 0xff, 0xff,
-    0x40, 0x0, 0xb, 0xff, 0xff, 0xf0, 0x0, 0x3f,
-    0xff, 0xff, 0xc0, 0x0, 0x7, 0xff, 0xff, 0xff,
-    0xf4, 0x0, 0x0, 0xbf, 0xff, 0xff, 0x0, 0x2,
-    0xff, 0xff, 0xfc, 0x0, 0x0, 0x7f, 0xff, 0xff,
-    0xff, 0x80, 0x0, 0xf, 0xff, 0xff, 0xe0, 0x0,
-    0x1f, 0xff, 0xff, 0xd0, 0x0, 0xb, 0xff, 0xff,
-    0xff, 0xfc, 0x0, 0x0, 0xff, 0xff, 0xfd, 0x0,
-    0x0, 0xff, 0xff, 0xfd, 0x0, 0x0, 0xff, 0xff,
-    0xff, 0xff, 0xc0, 0x0, 0x1f, 0xff, 0xff, 0xc0,
-    0x0, 0xf, 0xff, 0xff, 0xe0, 0x0, 0xf, 0xff,
-    0xff, 0xff, 0xfc, 0x0, 0x1, 0xff, 0xff, 0xfc,
-    0x0, 0x0, 0xbf, 0xff, 0xff, 0x0, 0x0, 0xff,
-    0xff, 0xbf, 0xff, 0xd0, 0x0, 0x2f, 0xff, 0xff,
-    0x80, 0x0, 0x7, 0xff, 0xff, 0xf0, 0x0, 0x1f,
-    0xff, 0xf7, 0xff, 0xfe, 0x0, 0x3, 0xff, 0xff,
-    0xf4, 0x0, 0x0, 0x3f, 0xff, 0xff, 0x0, 0x2,
-    0xff, 0xff, 0x3f, 0xff, 0xf0, 0x0, 0x3f, 0xff,
-    0xff, 0x0, 0x0, 0x3, 0xff, 0xff, 0xf4, 0x0,
-    0x3f, 0xff, 0xf2, 0xff, 0xff, 0x0, 0x7, 0xff,
-    0xff, 0xf0, 0x0, 0x0, 0x2f, 0xff, 0xff, 0x80,
-    0x3, 0xff, 0xff, 0x2f, 0xff, 0xf0, 0x0, 0x7f,
-    0xff, 0xff, 0x0, 0x0, 0x1, 0xff, 0xff, 0xfc,
-    0x0, 0x3f, 0xff, 0xe1, 0xff, 0xff, 0x40, 0xb,
-    0xff, 0xff, 0xe0, 0x0, 0x0, 0xf, 0xff, 0xff,
-    0xc0, 0x7, 0xff, 0xfd, 0xf, 0xff, 0xf8, 0x0,
-    0xff, 0xff, 0xfd, 0x0, 0x0, 0x0, 0xff, 0xff,
-    0xfc, 0x0, 0xbf, 0xff, 0xc0, 0xff, 0xff, 0x80,
-    0xf, 0xff, 0xff, 0xc0, 0x0, 0x0, 0xb, 0xff,
-    0xff, 0xd0, 0xf, 0xff, 0xfc, 0xf, 0xff, 0xfc,
-    0x0, 0xff, 0xff, 0xfc, 0x0, 0x0, 0x0, 0x7f,
-    0xff, 0xfe, 0x0, 0xff, 0xff, 0xc0, 0xbf, 0xff,
-    0xc0, 0x1f, 0xff, 0xff, 0x80, 0x0, 0x0, 0x3,
-    0xff, 0xff, 0xe0, 0xf, 0xff, 0xf8, 0x7, 0xff,
-    0xfd, 0x2, 0xff, 0xff, 0xf4, 0x0, 0x0, 0x0,
-    0x3f, 0xff, 0xff, 0x1, 0xff, 0xff, 0x80, 0x7f,
-    0xff, 0xd0, 0x3f, 0xff, 0xff, 0x0, 0x0, 0x0,
-    0x2, 0xff, 0xff, 0xf0, 0x2f, 0xff, 0xf4, 0x3,
-    0xff, 0xfe, 0x3, 0xff, 0xff, 0xf0, 0x0, 0x0,
-    0x0, 0x1f, 0xff, 0xff, 0x42, 0xff, 0xff, 0x0,
-    0x3f, 0xff, 0xf0, 0x3f, 0xff, 0xfe, 0x0, 0x0,
-    0x0, 0x0, 0xff, 0xff, 0xf8, 0x3f, 0xff, 0xf0,
-    0x3, 0xff, 0xff, 0x7, 0xff, 0xff, 0xd0, 0x0,
-    0x0, 0x0, 0xf, 0xff, 0xff, 0x83, 0xff, 0xff,
-    0x0, 0x2f, 0xff, 0xf4, 0xbf, 0xff, 0xfc, 0x0,
-    0x0, 0x0, 0x0, 0xbf, 0xff, 0xfc, 0x7f, 0xff,
-    0xe0, 0x1, 0xff, 0xff, 0x4b, 0xff, 0xff, 0xc0,
-    0x0, 0x0, 0x0, 0x7, 0xff, 0xff, 0xc7, 0xff,
-    0xfd, 0x0, 0x1f, 0xff, 0xf8, 0xff, 0xff, 0xf8,
-    0x0, 0x0, 0x0, 0x0, 0x3f, 0xff, 0xfd, 0xbf,
-    0xff, 0xd0, 0x0, 0xff, 0xff, 0xcf, 0xff, 0xff,
-    0x40, 0x0, 0x0, 0x0, 0x3, 0xff, 0xff, 0xdf,
-    0xff, 0xfc, 0x0, 0xf, 0xff, 0xfd, 0xff, 0xff,
-    0xf0, 0x0, 0x0, 0x0, 0x0, 0x2f, 0xff, 0xff,
-    0xff, 0xff, 0xc0, 0x0, 0xff, 0xff, 0xff, 0xff,
-    0xff, 0x0, 0x0, 0x0, 0x0, 0x1, 0xff, 0xff,
-    0xff, 0xff, 0xfc, 0x0, 0xb, 0xff, 0xff, 0xff,
-    0xff, 0xe0, 0x0, 0x0, 0x0, 0x0, 0xf, 0xff,
-    0xff, 0xff, 0xff, 0x80, 0x0, 0x7f, 0xff, 0xff,
-    0xff, 0xfd, 0x0, 0x0, 0x0, 0x0, 0x0, 0xff,
-    0xff, 0xff, 0xff, 0xf4, 0x0, 0x3, 0xff, 0xff,
-    0xff, 0xff, 0xc0, 0x0, 0x0, 0x0, 0x0, 0xb,
-    0xff, 0xff, 0xff, 0xff, 0x40, 0x0, 0x3f, 0xff,
-    0xff, 0xff, 0xfc, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0xbf, 0xff, 0xff, 0xff, 0xf0, 0x0, 0x3, 0xff,
-    0xff, 0xff, 0xff, 0x80, 0x0, 0x0, 0x0, 0x0,
-    0x7, 0xff, 0xff, 0xff, 0xff, 0x0, 0x0, 0x2f,
-    0xff, 0xff, 0xff, 0xf4, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x3f, 0xff, 0xff, 0xff, 0xf0, 0x0, 0x2,
-    0xff, 0xff, 0xff, 0xff, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x3, 0xff, 0xff, 0xff, 0xfe, 0x0, 0x0,
-    0x1f, 0xff, 0xff, 0xff, 0xf0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x2f, 0xff, 0xff, 0xff, 0xd0, 0x0,
-    0x0, 0xff, 0xff, 0xff, 0xfe, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x1, 0xff, 0xff, 0xff, 0xfc, 0x0,
-    0x0, 0xf, 0xff, 0xff, 0xff, 0xd0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0xf, 0xff, 0xff, 0xff, 0xc0,
-    0x0, 0x0, 0xff, 0xff, 0xff, 0xfc, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0xff, 0xff, 0xff, 0xfc,
-    0x0, 0x0, 0xb, 0xff, 0xff, 0xff, 0xc0, 0x0,
-    0x0, 0x0,
-
-    /* U+0058 "X" */
-    0x6a, 0xaa, 0xaa, 0xa0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x2a, 0xaa, 0xaa, 0xa0, 0xff, 0xff, 0xff,
-    0xd0, 0x0, 0x0, 0x0, 0x0, 0x3, 0xff, 0xff,
-    0xff, 0x81, 0xff, 0xff, 0xff, 0xc0, 0x0, 0x0,
-    0x0, 0x0, 0x2f, 0xff, 0xff, 0xfc, 0x2, 0xff,
-    0xff, 0xff, 0xc0, 0x0, 0x0, 0x0, 0x1, 0xff,
-    0xff, 0xff, 0xd0, 0x3, 0xff, 0xff, 0xff, 0x80,
-    0x0, 0x0, 0x0, 0xf, 0xff, 0xff, 0xfe, 0x0,
-    0x7, 0xff, 0xff, 0xff, 0x0, 0x0, 0x0, 0x0,
-    0xbf, 0xff, 0xff, 0xf0, 0x0, 0xb, 0xff, 0xff,
-    0xff, 0x0, 0x0, 0x0, 0x7, 0xff, 0xff, 0xff,
-    0x0, 0x0, 0xf, 0xff, 0xff, 0xfe, 0x0, 0x0,
-    0x0, 0x3f, 0xff, 0xff, 0xf4, 0x0, 0x0, 0xf,
-    0xff, 0xff, 0xfd, 0x0, 0x0, 0x2, 0xff, 0xff,
-    0xff, 0xc0, 0x0, 0x0, 0x2f, 0xff, 0xff, 0xfc,
-    0x0, 0x0, 0x1f, 0xff, 0xff, 0xfc, 0x0, 0x0,
-    0x0, 0x3f, 0xff, 0xff, 0xf8, 0x0, 0x0, 0xff,
-    0xff, 0xff, 0xd0, 0x0, 0x0, 0x0, 0x3f, 0xff,
-    0xff, 0xf4, 0x0, 0xf, 0xff, 0xff, 0xfe, 0x0,
-    0x0, 0x0, 0x0, 0x7f, 0xff, 0xff, 0xf0, 0x0,
-    0xbf, 0xff, 0xff, 0xf0, 0x0, 0x0, 0x0, 0x0,
-    0xbf, 0xff, 0xff, 0xf0, 0x3, 0xff, 0xff, 0xff,
-    0x40, 0x0, 0x0, 0x0, 0x0, 0xff, 0xff, 0xff,
-    0xd0, 0x3f, 0xff, 0xff, 0xf8, 0x0, 0x0, 0x0,
-    0x0, 0x1, 0xff, 0xff, 0xff, 0xc2, 0xff, 0xff,
-    0xff, 0xc0, 0x0, 0x0, 0x0, 0x0, 0x2, 0xff,
-    0xff, 0xff, 0xdf, 0xff, 0xff, 0xfc, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x3, 0xff, 0xff, 0xff, 0xff,
-    0xff, 0xff, 0xd0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x3, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x7, 0xff, 0xff,
-    0xff, 0xff, 0xff, 0xf0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0xf, 0xff, 0xff, 0xff, 0xff, 0xff,
-    0x40, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0xf,
-    0xff, 0xff, 0xff, 0xff, 0xf8, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x1f, 0xff, 0xff, 0xff,
-    0xff, 0xc0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x2f, 0xff, 0xff, 0xff, 0xfd, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x3f, 0xff,
-    0xff, 0xff, 0xe0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x7f, 0xff, 0xff, 0xff, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x1,
-    0xff, 0xff, 0xff, 0xfc, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0xf, 0xff, 0xff, 0xff,
-    0xf8, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0xff, 0xff, 0xff, 0xff, 0xf4, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0xb, 0xff, 0xff,
-    0xff, 0xff, 0xf0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x3f, 0xff, 0xff, 0xff, 0xff, 0xf0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x3, 0xff,
-    0xff, 0xff, 0xff, 0xff, 0xe0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x2f, 0xff, 0xff, 0xff, 0xff,
-    0xff, 0xd0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x1,
-    0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xc0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0xf, 0xff, 0xff, 0xff,
-    0xff, 0xff, 0xff, 0x80, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0xbf, 0xff, 0xff, 0xe3, 0xff, 0xff, 0xff,
-    0x40, 0x0, 0x0, 0x0, 0x0, 0x7, 0xff, 0xff,
-    0xff, 0x7, 0xff, 0xff, 0xff, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x3f, 0xff, 0xff, 0xf4, 0xf, 0xff,
-    0xff, 0xfe, 0x0, 0x0, 0x0, 0x0, 0x3, 0xff,
-    0xff, 0xff, 0x80, 0xf, 0xff, 0xff, 0xfd, 0x0,
-    0x0, 0x0, 0x0, 0x2f, 0xff, 0xff, 0xfc, 0x0,
-    0x1f, 0xff, 0xff, 0xfc, 0x0, 0x0, 0x0, 0x0,
-    0xff, 0xff, 0xff, 0xd0, 0x0, 0x3f, 0xff, 0xff,
-    0xfc, 0x0, 0x0, 0x0, 0xf, 0xff, 0xff, 0xfe,
-    0x0, 0x0, 0x3f, 0xff, 0xff, 0xf8, 0x0, 0x0,
-    0x0, 0xbf, 0xff, 0xff, 0xf0, 0x0, 0x0, 0x7f,
-    0xff, 0xff, 0xf0, 0x0, 0x0, 0x7, 0xff, 0xff,
-    0xff, 0x40, 0x0, 0x0, 0xbf, 0xff, 0xff, 0xf0,
-    0x0, 0x0, 0x3f, 0xff, 0xff, 0xf8, 0x0, 0x0,
-    0x0, 0xff, 0xff, 0xff, 0xe0, 0x0, 0x2, 0xff,
-    0xff, 0xff, 0xc0, 0x0, 0x0, 0x1, 0xff, 0xff,
-    0xff, 0xd0, 0x0, 0x1f, 0xff, 0xff, 0xfd, 0x0,
-    0x0, 0x0, 0x2, 0xff, 0xff, 0xff, 0xc0, 0x0,
-    0xff, 0xff, 0xff, 0xe0, 0x0, 0x0, 0x0, 0x3,
-    0xff, 0xff, 0xff, 0x80, 0xf, 0xff, 0xff, 0xff,
-    0x0, 0x0, 0x0, 0x0, 0x7, 0xff, 0xff, 0xff,
-    0x40, 0xbf, 0xff, 0xff, 0xf0, 0x0, 0x0, 0x0,
-    0x0, 0xb, 0xff, 0xff, 0xff, 0x3, 0xff, 0xff,
-    0xff, 0x80, 0x0, 0x0, 0x0, 0x0, 0xf, 0xff,
-    0xff, 0xff, 0x0,
-
-    /* U+0059 "Y" */
-    0x15, 0x55, 0x55, 0x50, 0x0, 0x0, 0x0, 0x0,
-    0x15, 0x55, 0x55, 0x52, 0xff, 0xff, 0xff, 0x40,
-    0x0, 0x0, 0x0, 0xb, 0xff, 0xff, 0xfd, 0xf,
-    0xff, 0xff, 0xfc, 0x0, 0x0, 0x0, 0x0, 0xff,
-    0xff, 0xff, 0xc0, 0xbf, 0xff, 0xff, 0xd0, 0x0,
-    0x0, 0x0, 0x2f, 0xff, 0xff, 0xf4, 0x3, 0xff,
-    0xff, 0xff, 0x0, 0x0, 0x0, 0x3, 0xff, 0xff,
-    0xfe, 0x0, 0x2f, 0xff, 0xff, 0xf4, 0x0, 0x0,
-    0x0, 0xbf, 0xff, 0xff, 0xc0, 0x0, 0xff, 0xff,
-    0xff, 0xc0, 0x0, 0x0, 0xf, 0xff, 0xff, 0xf8,
-    0x0, 0x7, 0xff, 0xff, 0xfd, 0x0, 0x0, 0x2,
-    0xff, 0xff, 0xff, 0x0, 0x0, 0x3f, 0xff, 0xff,
-    0xe0, 0x0, 0x0, 0x3f, 0xff, 0xff, 0xd0, 0x0,
-    0x1, 0xff, 0xff, 0xff, 0x0, 0x0, 0xb, 0xff,
-    0xff, 0xfc, 0x0, 0x0, 0xb, 0xff, 0xff, 0xf8,
-    0x0, 0x0, 0xff, 0xff, 0xff, 0x40, 0x0, 0x0,
-    0x3f, 0xff, 0xff, 0xc0, 0x0, 0x2f, 0xff, 0xff,
-    0xf0, 0x0, 0x0, 0x2, 0xff, 0xff, 0xfe, 0x0,
-    0x3, 0xff, 0xff, 0xfd, 0x0, 0x0, 0x0, 0xf,
-    0xff, 0xff, 0xf0, 0x0, 0xbf, 0xff, 0xff, 0x80,
-    0x0, 0x0, 0x0, 0xbf, 0xff, 0xff, 0x80, 0xf,
-    0xff, 0xff, 0xf0, 0x0, 0x0, 0x0, 0x3, 0xff,
-    0xff, 0xfc, 0x2, 0xff, 0xff, 0xfe, 0x0, 0x0,
-    0x0, 0x0, 0x1f, 0xff, 0xff, 0xe0, 0x3f, 0xff,
-    0xff, 0xc0, 0x0, 0x0, 0x0, 0x0, 0xff, 0xff,
-    0xff, 0x7, 0xff, 0xff, 0xf8, 0x0, 0x0, 0x0,
-    0x0, 0x7, 0xff, 0xff, 0xf8, 0xff, 0xff, 0xff,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x3f, 0xff, 0xff,
-    0xef, 0xff, 0xff, 0xd0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0xff, 0xff, 0xff, 0xff, 0xff, 0xfc, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0xb, 0xff, 0xff, 0xff,
-    0xff, 0xff, 0x40, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x3f, 0xff, 0xff, 0xff, 0xff, 0xe0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x2, 0xff, 0xff, 0xff, 0xff,
-    0xfc, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0xf,
-    0xff, 0xff, 0xff, 0xff, 0x80, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x7f, 0xff, 0xff, 0xff, 0xf0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x3, 0xff,
-    0xff, 0xff, 0xfe, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x1f, 0xff, 0xff, 0xff, 0xc0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0xff, 0xff,
-    0xff, 0xf4, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x3, 0xff, 0xff, 0xff, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x2f, 0xff, 0xff,
-    0xd0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x2, 0xff, 0xff, 0xfd, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x2f, 0xff, 0xff, 0xd0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x2,
-    0xff, 0xff, 0xfd, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x2f, 0xff, 0xff, 0xd0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x2, 0xff,
-    0xff, 0xfd, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x2f, 0xff, 0xff, 0xd0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x2, 0xff, 0xff,
-    0xfd, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x2f, 0xff, 0xff, 0xd0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x2, 0xff, 0xff, 0xfd,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x2f, 0xff, 0xff, 0xd0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x2, 0xff, 0xff, 0xfd, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x2f,
-    0xff, 0xff, 0xd0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x2, 0xff, 0xff, 0xfd, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x2f, 0xff,
-    0xff, 0xd0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x2, 0xff, 0xff, 0xfd, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x2f, 0xff, 0xff,
-    0xd0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x2, 0xff, 0xff, 0xfd, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x2f, 0xff, 0xff, 0xd0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x2,
-    0xff, 0xff, 0xfd, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x2f, 0xff, 0xff, 0xd0, 0x0,
-    0x0, 0x0, 0x0,
-
-    /* U+005A "Z" */
-    0x1a, 0xaa, 0xaa, 0xaa, 0xaa, 0xaa, 0xaa, 0xaa,
-    0xaa, 0xaa, 0xa0, 0x7f, 0xff, 0xff, 0xff, 0xff,
-    0xff, 0xff, 0xff, 0xff, 0xff, 0xc1, 0xff, 0xff,
-    0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
-    0x7, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
-    0xff, 0xff, 0xfc, 0x1f, 0xff, 0xff, 0xff, 0xff,
-    0xff, 0xff, 0xff, 0xff, 0xff, 0xf0, 0x7f, 0xff,
-    0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
-    0xc1, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
-    0xff, 0xff, 0xff, 0x7, 0xff, 0xff, 0xff, 0xff,
-    0xff, 0xff, 0xff, 0xff, 0xff, 0xfc, 0x1f, 0xff,
-    0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
-    0xf0, 0x7f, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
-    0xff, 0xff, 0xff, 0xc0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x3f, 0xff, 0xff, 0xfe, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x2, 0xff, 0xff, 0xff,
-    0xf0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x2f,
-    0xff, 0xff, 0xff, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x1, 0xff, 0xff, 0xff, 0xf0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x1f, 0xff, 0xff, 0xff,
-    0x40, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0xff,
-    0xff, 0xff, 0xf4, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0xf, 0xff, 0xff, 0xff, 0x80, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0xff, 0xff, 0xff, 0xfc,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0xf, 0xff,
-    0xff, 0xff, 0xc0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0xbf, 0xff, 0xff, 0xfc, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0xb, 0xff, 0xff, 0xff, 0xd0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x7f, 0xff,
-    0xff, 0xfd, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x7, 0xff, 0xff, 0xff, 0xe0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x3f, 0xff, 0xff, 0xfe, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x3, 0xff, 0xff,
-    0xff, 0xf0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x3f, 0xff, 0xff, 0xff, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x2, 0xff, 0xff, 0xff, 0xf0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x2f, 0xff, 0xff,
-    0xff, 0x40, 0x0, 0x0, 0x0, 0x0, 0x0, 0x1,
-    0xff, 0xff, 0xff, 0xf4, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x1f, 0xff, 0xff, 0xff, 0x80, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0xff, 0xff, 0xff,
-    0xf8, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0xf,
-    0xff, 0xff, 0xff, 0xc0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0xff, 0xff, 0xff, 0xfc, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0xf, 0xff, 0xff, 0xff,
-    0xc0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0xbf,
-    0xff, 0xff, 0xfd, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0xb, 0xff, 0xff, 0xff, 0xe0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x7f, 0xff, 0xff, 0xfe,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x7, 0xff,
-    0xff, 0xff, 0xf0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x3f, 0xff, 0xff, 0xff, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x3, 0xff, 0xff, 0xff, 0xf0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x3f, 0xff,
-    0xff, 0xff, 0x40, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x1, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
-    0xff, 0xff, 0xff, 0xe7, 0xff, 0xff, 0xff, 0xff,
-    0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xdf, 0xff,
-    0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
-    0xff, 0x7f, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
-    0xff, 0xff, 0xff, 0xfd, 0xff, 0xff, 0xff, 0xff,
-    0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xf7, 0xff,
-    0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
-    0xff, 0xdf, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
-    0xff, 0xff, 0xff, 0xff, 0x7f, 0xff, 0xff, 0xff,
-    0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xfd, 0xff,
-    0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
-    0xff, 0xf7, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
-    0xff, 0xff, 0xff, 0xff, 0xc0,
-
-    /* U+005B "[" */
-    0xaa, 0xaa, 0xaa, 0xaa, 0x8f, 0xff, 0xff, 0xff,
-    0xfc, 0xff, 0xff, 0xff, 0xff, 0xcf, 0xff, 0xff,
-    0xff, 0xfc, 0xff, 0xff, 0xff, 0xff, 0xcf, 0xff,
-    0xff, 0xff, 0xfc, 0xff, 0xff, 0xff, 0xff, 0xcf,
-    0xff, 0xff, 0xff, 0xfc, 0xff, 0xff, 0xff, 0xff,
-    0xcf, 0xff, 0xff, 0xff, 0xfc, 0xff, 0xff, 0xff,
-    0xff, 0xcf, 0xff, 0xff, 0x40, 0x0, 0xff, 0xff,
-    0xf4, 0x0, 0xf, 0xff, 0xff, 0x40, 0x0, 0xff,
-    0xff, 0xf4, 0x0, 0xf, 0xff, 0xff, 0x40, 0x0,
-    0xff, 0xff, 0xf4, 0x0, 0xf, 0xff, 0xff, 0x40,
-    0x0, 0xff, 0xff, 0xf4, 0x0, 0xf, 0xff, 0xff,
-    0x40, 0x0, 0xff, 0xff, 0xf4, 0x0, 0xf, 0xff,
-    0xff, 0x40, 0x0, 0xff, 0xff, 0xf4, 0x0, 0xf,
-    0xff, 0xff, 0x40, 0x0, 0xff, 0xff, 0xf4, 0x0,
-    0xf, 0xff, 0xff, 0x40, 0x0, 0xff, 0xff, 0xf4,
-    0x0, 0xf, 0xff, 0xff, 0x40, 0x0, 0xff, 0xff,
-    0xf4, 0x0, 0xf, 0xff, 0xff, 0x40, 0x0, 0xff,
-    0xff, 0xf4, 0x0, 0xf, 0xff, 0xff, 0x40, 0x0,
-    0xff, 0xff, 0xf4, 0x0, 0xf, 0xff, 0xff, 0x40,
-    0x0, 0xff, 0xff, 0xf4, 0x0, 0xf, 0xff, 0xff,
-    0x40, 0x0, 0xff, 0xff, 0xf4, 0x0, 0xf, 0xff,
-    0xff, 0x40, 0x0, 0xff, 0xff, 0xf4, 0x0, 0xf,
-    0xff, 0xff, 0x40, 0x0, 0xff, 0xff, 0xf4, 0x0,
-    0xf, 0xff, 0xff, 0x40, 0x0, 0xff, 0xff, 0xf4,
-    0x0, 0xf, 0xff, 0xff, 0x40, 0x0, 0xff, 0xff,
-    0xf4, 0x0, 0xf, 0xff, 0xff, 0x40, 0x0, 0xff,
-    0xff, 0xf4, 0x0, 0xf, 0xff, 0xff, 0x40, 0x0,
-    0xff, 0xff, 0xf4, 0x0, 0xf, 0xff, 0xff, 0x40,
-    0x0, 0xff, 0xff, 0xf4, 0x0, 0xf, 0xff, 0xff,
-    0x40, 0x0, 0xff, 0xff, 0xf4, 0x0, 0xf, 0xff,
-    0xff, 0x40, 0x0, 0xff, 0xff, 0xf4, 0x0, 0xf,
-    0xff, 0xff, 0x40, 0x0, 0xff, 0xff, 0xf4, 0x0,
-    0xf, 0xff, 0xff, 0x40, 0x0, 0xff, 0xff, 0xf4,
-    0x0, 0xf, 0xff, 0xff, 0xea, 0xa8, 0xff, 0xff,
-    0xff, 0xff, 0xcf, 0xff, 0xff, 0xff, 0xfc, 0xff,
-    0xff, 0xff, 0xff, 0xcf, 0xff, 0xff, 0xff, 0xfc,
-    0xff, 0xff, 0xff, 0xff, 0xcf, 0xff, 0xff, 0xff,
-    0xfc, 0xff, 0xff, 0xff, 0xff, 0xcf, 0xff, 0xff,
-    0xff, 0xfc, 0xff, 0xff, 0xff, 0xff, 0xcf, 0xff,
-    0xff, 0xff, 0xfc,
-
-    /* U+005C "\\" */
-    0xff, 0xff, 0xd0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x1, 0xff, 0xff, 0xc0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x3, 0xff, 0xff, 0x40, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0xb, 0xff, 0xfe, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0xf, 0xff, 0xfc, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x3f, 0xff, 0xf8, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x7f, 0xff, 0xf0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0xff, 0xff,
-    0xd0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x2, 0xff,
-    0xff, 0x80, 0x0, 0x0, 0x0, 0x0, 0x0, 0x3,
-    0xff, 0xff, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0xb, 0xff, 0xfe, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x1f, 0xff, 0xfc, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x3f, 0xff, 0xf4, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0xbf, 0xff, 0xf0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0xff, 0xff, 0xc0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x2, 0xff, 0xff, 0x80,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x7, 0xff, 0xff,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0xf, 0xff,
-    0xfd, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x1f,
-    0xff, 0xfc, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x3f, 0xff, 0xf0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0xbf, 0xff, 0xe0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x1, 0xff, 0xff, 0xc0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x3, 0xff, 0xff, 0x40, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x7, 0xff, 0xff, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0xf, 0xff, 0xfc, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x2f, 0xff, 0xf8,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x3f, 0xff,
-    0xf0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0xff,
-    0xff, 0xd0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x1,
-    0xff, 0xff, 0xc0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x3, 0xff, 0xff, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0xb, 0xff, 0xfe, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0xf, 0xff, 0xfc, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x3f, 0xff, 0xf4, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x7f, 0xff, 0xf0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0xff, 0xff, 0xd0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x2, 0xff, 0xff,
-    0x80, 0x0, 0x0, 0x0, 0x0, 0x0, 0x3, 0xff,
-    0xff, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0xf,
-    0xff, 0xfd, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x1f, 0xff, 0xfc, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x3f, 0xff, 0xf4, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0xbf, 0xff, 0xe0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0xff, 0xff, 0xc0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x3, 0xff, 0xff, 0x80, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x7, 0xff, 0xff, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0xf, 0xff, 0xfd,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x2f, 0xff,
-    0xf8, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x3f,
-    0xff, 0xf0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0xbf, 0xff, 0xe0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x1, 0xff, 0xff, 0xc0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x3, 0xff, 0xff, 0x40, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0xb, 0xff, 0xff, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0xf, 0xff, 0xfc, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x2f, 0xff, 0xf8, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x7f, 0xff, 0xf0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0xff, 0xff,
-    0xd0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x1, 0xff,
-    0xff, 0xc0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x3,
-    0xff, 0xff, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0xb, 0xff, 0xfe, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x1f, 0xff, 0xfc, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x3f, 0xff, 0xf4, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x7f, 0xff, 0xf0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0xff, 0xff, 0xc0,
-
-    /* U+005D "]" */
-    0x2a, 0xaa, 0xaa, 0xaa, 0x97, 0xff, 0xff, 0xff,
-    0xff, 0x7f, 0xff, 0xff, 0xff, 0xf7, 0xff, 0xff,
-    0xff, 0xff, 0x7f, 0xff, 0xff, 0xff, 0xf7, 0xff,
-    0xff, 0xff, 0xff, 0x7f, 0xff, 0xff, 0xff, 0xf7,
-    0xff, 0xff, 0xff, 0xff, 0x7f, 0xff, 0xff, 0xff,
-    0xf7, 0xff, 0xff, 0xff, 0xff, 0x7f, 0xff, 0xff,
-    0xff, 0xf0, 0x0, 0x2f, 0xff, 0xff, 0x0, 0x2,
-    0xff, 0xff, 0xf0, 0x0, 0x2f, 0xff, 0xff, 0x0,
-    0x2, 0xff, 0xff, 0xf0, 0x0, 0x2f, 0xff, 0xff,
-    0x0, 0x2, 0xff, 0xff, 0xf0, 0x0, 0x2f, 0xff,
-    0xff, 0x0, 0x2, 0xff, 0xff, 0xf0, 0x0, 0x2f,
-    0xff, 0xff, 0x0, 0x2, 0xff, 0xff, 0xf0, 0x0,
-    0x2f, 0xff, 0xff, 0x0, 0x2, 0xff, 0xff, 0xf0,
-    0x0, 0x2f, 0xff, 0xff, 0x0, 0x2, 0xff, 0xff,
-    0xf0, 0x0, 0x2f, 0xff, 0xff, 0x0, 0x2, 0xff,
-    0xff, 0xf0, 0x0, 0x2f, 0xff, 0xff, 0x0, 0x2,
-    0xff, 0xff, 0xf0, 0x0, 0x2f, 0xff, 0xff, 0x0,
-    0x2, 0xff, 0xff, 0xf0, 0x0, 0x2f, 0xff, 0xff,
-    0x0, 0x2, 0xff, 0xff, 0xf0, 0x0, 0x2f, 0xff,
-    0xff, 0x0, 0x2, 0xff, 0xff, 0xf0, 0x0, 0x2f,
-    0xff, 0xff, 0x0, 0x2, 0xff, 0xff, 0xf0, 0x0,
-    0x2f, 0xff, 0xff, 0x0, 0x2, 0xff, 0xff, 0xf0,
-    0x0, 0x2f, 0xff, 0xff, 0x0, 0x2, 0xff, 0xff,
-    0xf0, 0x0, 0x2f, 0xff, 0xff, 0x0, 0x2, 0xff,
-    0xff, 0xf0, 0x0, 0x2f, 0xff, 0xff, 0x0, 0x2,
-    0xff, 0xff, 0xf0, 0x0, 0x2f, 0xff, 0xff, 0x0,
-    0x2, 0xff, 0xff, 0xf0, 0x0, 0x2f, 0xff, 0xff,
-    0x0, 0x2, 0xff, 0xff, 0xf0, 0x0, 0x2f, 0xff,
-    0xff, 0x0, 0x2, 0xff, 0xff, 0xf0, 0x0, 0x2f,
-    0xff, 0xff, 0x0, 0x2, 0xff, 0xff, 0xf0, 0x0,
-    0x2f, 0xff, 0xff, 0x0, 0x2, 0xff, 0xff, 0xf0,
-    0x0, 0x2f, 0xff, 0xff, 0x0, 0x2, 0xff, 0xff,
-    0xf0, 0x0, 0x2f, 0xff, 0xff, 0x0, 0x2, 0xff,
-    0xff, 0xf2, 0xaa, 0xbf, 0xff, 0xff, 0x7f, 0xff,
-    0xff, 0xff, 0xf7, 0xff, 0xff, 0xff, 0xff, 0x7f,
-    0xff, 0xff, 0xff, 0xf7, 0xff, 0xff, 0xff, 0xff,
-    0x7f, 0xff, 0xff, 0xff, 0xf7, 0xff, 0xff, 0xff,
-    0xff, 0x7f, 0xff, 0xff, 0xff, 0xf7, 0xff, 0xff,
-    0xff, 0xff, 0x7f, 0xff, 0xff, 0xff, 0xf7, 0xff,
-    0xff, 0xff, 0xff,
-
-    /* U+005E "^" */
-    0x0, 0x0, 0x1, 0x55, 0x55, 0x54, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x3f, 0xff, 0xff, 0xc0, 0x0,
-    0x0, 0x0, 0x0, 0xb, 0xff, 0xff, 0xfc, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0xff, 0xff, 0xff, 0xe0,
-    0x0, 0x0, 0x0, 0x0, 0x1f, 0xff, 0xff, 0xff,
-    0x0, 0x0, 0x0, 0x0, 0x2, 0xff, 0xff, 0xff,
-    0xf4, 0x0, 0x0, 0x0, 0x0, 0x3f, 0xff, 0xff,
-    0xff, 0xc0, 0x0, 0x0, 0x0, 0xb, 0xff, 0xff,
-    0xff, 0xfc, 0x0, 0x0, 0x0, 0x0, 0xff, 0xff,
-    0xff, 0xff, 0xe0, 0x0, 0x0, 0x0, 0x1f, 0xff,
-    0xfb, 0xff, 0xff, 0x0, 0x0, 0x0, 0x2, 0xff,
-    0xff, 0x1f, 0xff, 0xf4, 0x0, 0x0, 0x0, 0x3f,
-    0xff, 0xf0, 0xff, 0xff, 0xc0, 0x0, 0x0, 0xb,
-    0xff, 0xfd, 0xb, 0xff, 0xfd, 0x0, 0x0, 0x0,
-    0xff, 0xff, 0xc0, 0x7f, 0xff, 0xe0, 0x0, 0x0,
-    0x1f, 0xff, 0xf8, 0x3, 0xff, 0xff, 0x0, 0x0,
-    0x2, 0xff, 0xff, 0x40, 0x2f, 0xff, 0xf4, 0x0,
-    0x0, 0x3f, 0xff, 0xf0, 0x0, 0xff, 0xff, 0xc0,
-    0x0, 0xb, 0xff, 0xfe, 0x0, 0xf, 0xff, 0xfd,
-    0x0, 0x0, 0xff, 0xff, 0xc0, 0x0, 0x7f, 0xff,
-    0xe0, 0x0, 0x1f, 0xff, 0xfc, 0x0, 0x3, 0xff,
-    0xff, 0x0, 0x2, 0xff, 0xff, 0x40, 0x0, 0x2f,
-    0xff, 0xf4, 0x0, 0x3f, 0xff, 0xf0, 0x0, 0x1,
-    0xff, 0xff, 0xc0, 0xb, 0xff, 0xfe, 0x0, 0x0,
-    0xf, 0xff, 0xfd, 0x0, 0xff, 0xff, 0xc0, 0x0,
-    0x0, 0x7f, 0xff, 0xe0, 0x1f, 0xff, 0xfc, 0x0,
-    0x0, 0x3, 0xff, 0xff, 0x2, 0xff, 0xff, 0x40,
-    0x0, 0x0, 0x2f, 0xff, 0xf8, 0x3f, 0xff, 0xf0,
-    0x0, 0x0, 0x1, 0xff, 0xff, 0xcb, 0xff, 0xfe,
-    0x0, 0x0, 0x0, 0xf, 0xff, 0xfd,
-
-    /* U+005F "_" */
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
-    0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
-    0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
-    0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
-    0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
-    0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
-    0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
-    0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
-
-    /* U+0060 "`" */
-    0x0, 0x0, 0x0, 0x0, 0x0, 0xff, 0xff, 0xfc,
-    0x0, 0x0, 0xbf, 0xff, 0xfc, 0x0, 0x0, 0xbf,
-    0xff, 0xf4, 0x0, 0x0, 0xbf, 0xff, 0xf0, 0x0,
-    0x0, 0xbf, 0xff, 0xe0, 0x0, 0x0, 0xbf, 0xff,
-    0xd0, 0x0, 0x0, 0xbf, 0xff, 0xc0, 0x0, 0x0,
-    0x7f, 0xff, 0x80, 0x0, 0x0, 0x7f, 0xff, 0x40,
-    0x0, 0x0, 0x7f, 0xff, 0x0,
-
-    /* U+0061 "a" */
-    0x0, 0x0, 0x0, 0x1b, 0xff, 0x90, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x1, 0xff, 0xff, 0xff,
-    0xd0, 0xbf, 0xff, 0xff, 0x0, 0x0, 0x3, 0xff,
-    0xff, 0xff, 0xff, 0x2f, 0xff, 0xff, 0xc0, 0x0,
-    0xb, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
-    0xf0, 0x0, 0xb, 0xff, 0xff, 0xff, 0xff, 0xff,
-    0xff, 0xff, 0xfc, 0x0, 0xb, 0xff, 0xff, 0xff,
-    0xff, 0xff, 0xff, 0xff, 0xff, 0x0, 0xb, 0xff,
-    0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xc0,
-    0x3, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
-    0xff, 0xf0, 0x3, 0xff, 0xff, 0xff, 0xfe, 0x5b,
-    0xff, 0xff, 0xff, 0xfc, 0x1, 0xff, 0xff, 0xff,
-    0xe0, 0x0, 0xb, 0xff, 0xff, 0xff, 0x0, 0xff,
-    0xff, 0xff, 0xd0, 0x0, 0x0, 0x7f, 0xff, 0xff,
-    0xc0, 0x7f, 0xff, 0xff, 0xd0, 0x0, 0x0, 0x7,
-    0xff, 0xff, 0xf0, 0x2f, 0xff, 0xff, 0xe0, 0x0,
-    0x0, 0x0, 0xbf, 0xff, 0xfc, 0xf, 0xff, 0xff,
-    0xf0, 0x0, 0x0, 0x0, 0x2f, 0xff, 0xff, 0x3,
-    0xff, 0xff, 0xf4, 0x0, 0x0, 0x0, 0xb, 0xff,
-    0xff, 0xc1, 0xff, 0xff, 0xfc, 0x0, 0x0, 0x0,
-    0x2, 0xff, 0xff, 0xf0, 0xbf, 0xff, 0xff, 0x0,
-    0x0, 0x0, 0x0, 0xbf, 0xff, 0xfc, 0x2f, 0xff,
-    0xff, 0x80, 0x0, 0x0, 0x0, 0x2f, 0xff, 0xff,
-    0xb, 0xff, 0xff, 0xd0, 0x0, 0x0, 0x0, 0xb,
-    0xff, 0xff, 0xc3, 0xff, 0xff, 0xf4, 0x0, 0x0,
-    0x0, 0x2, 0xff, 0xff, 0xf0, 0xff, 0xff, 0xfc,
-    0x0, 0x0, 0x0, 0x0, 0xbf, 0xff, 0xfc, 0x3f,
-    0xff, 0xff, 0x0, 0x0, 0x0, 0x0, 0x2f, 0xff,
-    0xff, 0xb, 0xff, 0xff, 0xd0, 0x0, 0x0, 0x0,
-    0xb, 0xff, 0xff, 0xc2, 0xff, 0xff, 0xf4, 0x0,
-    0x0, 0x0, 0x2, 0xff, 0xff, 0xf0, 0xbf, 0xff,
-    0xfe, 0x0, 0x0, 0x0, 0x0, 0xbf, 0xff, 0xfc,
-    0x1f, 0xff, 0xff, 0xc0, 0x0, 0x0, 0x0, 0x2f,
-    0xff, 0xff, 0x3, 0xff, 0xff, 0xf4, 0x0, 0x0,
-    0x0, 0xb, 0xff, 0xff, 0xc0, 0xff, 0xff, 0xff,
-    0x0, 0x0, 0x0, 0x2, 0xff, 0xff, 0xf0, 0x2f,
-    0xff, 0xff, 0xe0, 0x0, 0x0, 0x0, 0xbf, 0xff,
-    0xfc, 0x7, 0xff, 0xff, 0xfd, 0x0, 0x0, 0x0,
-    0x7f, 0xff, 0xff, 0x0, 0xff, 0xff, 0xff, 0xd0,
-    0x0, 0x0, 0x7f, 0xff, 0xff, 0xc0, 0x1f, 0xff,
-    0xff, 0xfe, 0x0, 0x0, 0xbf, 0xff, 0xff, 0xf0,
-    0x3, 0xff, 0xff, 0xff, 0xf9, 0x56, 0xff, 0xff,
-    0xff, 0xfc, 0x0, 0x7f, 0xff, 0xff, 0xff, 0xff,
-    0xff, 0xff, 0xff, 0xff, 0x0, 0xb, 0xff, 0xff,
-    0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xc0, 0x0,
-    0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
-    0xf4, 0x0, 0xb, 0xff, 0xff, 0xff, 0xff, 0xff,
-    0xff, 0xff, 0xfd, 0x0, 0x0, 0xbf, 0xff, 0xff,
-    0xff, 0xff, 0xef, 0xff, 0xff, 0x80, 0x0, 0x7,
-    0xff, 0xff, 0xff, 0xff, 0xd3, 0xff, 0xff, 0xf0,
-    0x0, 0x0, 0x1f, 0xff, 0xff, 0xff, 0x40, 0xbf,
-    0xff, 0xfc, 0x0, 0x0, 0x0, 0x1a, 0xff, 0xe4,
-    0x0, 0x0, 0x0, 0x0, 0x0,
-
-    /* U+0062 "b" */
-    0x1f, 0xff, 0xff, 0xc0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x7, 0xff, 0xff, 0xf0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x1, 0xff, 0xff, 0xfc,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x7f,
-    0xff, 0xff, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x1f, 0xff, 0xff, 0xc0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x7, 0xff, 0xff, 0xf0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x1, 0xff, 0xff,
-    0xfc, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x7f, 0xff, 0xff, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x1f, 0xff, 0xff, 0xc0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x7, 0xff, 0xff, 0xf0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x1, 0xff,
-    0xff, 0xfc, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x7f, 0xff, 0xff, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x1f, 0xff, 0xff, 0xc0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x7, 0xff, 0xff,
-    0xf0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x1,
-    0xff, 0xff, 0xfc, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x7f, 0xff, 0xff, 0x0, 0x0, 0x10,
-    0x0, 0x0, 0x0, 0x0, 0x1f, 0xff, 0xff, 0xc0,
-    0x1b, 0xff, 0xfe, 0x40, 0x0, 0x0, 0x7, 0xff,
-    0xff, 0xf0, 0x7f, 0xff, 0xff, 0xfe, 0x0, 0x0,
-    0x1, 0xff, 0xff, 0xfd, 0xff, 0xff, 0xff, 0xff,
-    0xf4, 0x0, 0x0, 0x7f, 0xff, 0xff, 0xff, 0xff,
-    0xff, 0xff, 0xff, 0x80, 0x0, 0x1f, 0xff, 0xff,
-    0xff, 0xff, 0xff, 0xff, 0xff, 0xf8, 0x0, 0x7,
-    0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
-    0x80, 0x1, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
-    0xff, 0xff, 0xf4, 0x0, 0x7f, 0xff, 0xff, 0xff,
-    0xff, 0xff, 0xff, 0xff, 0xff, 0x0, 0x1f, 0xff,
-    0xff, 0xff, 0x90, 0xb, 0xff, 0xff, 0xff, 0xe0,
-    0x7, 0xff, 0xff, 0xfe, 0x0, 0x0, 0x2f, 0xff,
-    0xff, 0xfc, 0x1, 0xff, 0xff, 0xfd, 0x0, 0x0,
-    0x1, 0xff, 0xff, 0xff, 0x80, 0x7f, 0xff, 0xfe,
-    0x0, 0x0, 0x0, 0x2f, 0xff, 0xff, 0xf0, 0x1f,
-    0xff, 0xff, 0x0, 0x0, 0x0, 0x3, 0xff, 0xff,
-    0xfd, 0x7, 0xff, 0xff, 0xc0, 0x0, 0x0, 0x0,
-    0x3f, 0xff, 0xff, 0x81, 0xff, 0xff, 0xf0, 0x0,
-    0x0, 0x0, 0xf, 0xff, 0xff, 0xf0, 0x7f, 0xff,
-    0xfc, 0x0, 0x0, 0x0, 0x1, 0xff, 0xff, 0xfc,
-    0x1f, 0xff, 0xff, 0x0, 0x0, 0x0, 0x0, 0x3f,
-    0xff, 0xff, 0x7, 0xff, 0xff, 0xc0, 0x0, 0x0,
-    0x0, 0xf, 0xff, 0xff, 0xc1, 0xff, 0xff, 0xf0,
-    0x0, 0x0, 0x0, 0x2, 0xff, 0xff, 0xf4, 0x7f,
-    0xff, 0xfc, 0x0, 0x0, 0x0, 0x0, 0xbf, 0xff,
-    0xfd, 0x1f, 0xff, 0xff, 0x0, 0x0, 0x0, 0x0,
-    0x2f, 0xff, 0xff, 0x47, 0xff, 0xff, 0xc0, 0x0,
-    0x0, 0x0, 0xb, 0xff, 0xff, 0xd1, 0xff, 0xff,
-    0xf0, 0x0, 0x0, 0x0, 0x3, 0xff, 0xff, 0xf0,
-    0x7f, 0xff, 0xfc, 0x0, 0x0, 0x0, 0x0, 0xff,
-    0xff, 0xfc, 0x1f, 0xff, 0xff, 0x0, 0x0, 0x0,
-    0x0, 0x7f, 0xff, 0xff, 0x7, 0xff, 0xff, 0xc0,
-    0x0, 0x0, 0x0, 0x2f, 0xff, 0xff, 0xc1, 0xff,
-    0xff, 0xf0, 0x0, 0x0, 0x0, 0xf, 0xff, 0xff,
-    0xe0, 0x7f, 0xff, 0xfc, 0x0, 0x0, 0x0, 0xf,
-    0xff, 0xff, 0xf4, 0x1f, 0xff, 0xff, 0x80, 0x0,
-    0x0, 0x7, 0xff, 0xff, 0xfc, 0x7, 0xff, 0xff,
-    0xf4, 0x0, 0x0, 0x7, 0xff, 0xff, 0xfe, 0x1,
-    0xff, 0xff, 0xff, 0x80, 0x0, 0xb, 0xff, 0xff,
-    0xff, 0x0, 0x7f, 0xff, 0xff, 0xfe, 0x40, 0x2f,
-    0xff, 0xff, 0xff, 0xc0, 0x1f, 0xff, 0xff, 0xff,
-    0xff, 0xff, 0xff, 0xff, 0xff, 0xc0, 0xb, 0xff,
-    0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xd0,
-    0x2, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
-    0xff, 0xe0, 0x0, 0xff, 0xff, 0xff, 0xff, 0xff,
-    0xff, 0xff, 0xff, 0xe0, 0x0, 0x3f, 0xff, 0xff,
-    0xff, 0xff, 0xff, 0xff, 0xff, 0xe0, 0x0, 0xf,
-    0xff, 0xff, 0x9f, 0xff, 0xff, 0xff, 0xff, 0xd0,
-    0x0, 0x7, 0xff, 0xff, 0xd0, 0x7f, 0xff, 0xff,
-    0xff, 0x80, 0x0, 0x1, 0xaa, 0xaa, 0xa0, 0x1,
-    0xbf, 0xff, 0xf9, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x0,
-
-    /* U+0063 "c" */
-    0x0, 0x0, 0x0, 0x0, 0x6b, 0xff, 0xfa, 0x40,
-    0x0, 0x0, 0x0, 0x2, 0xff, 0xff, 0xff, 0xff,
-    0xe4, 0x0, 0x0, 0x2, 0xff, 0xff, 0xff, 0xff,
-    0xff, 0xd0, 0x0, 0x2, 0xff, 0xff, 0xff, 0xff,
-    0xff, 0xfd, 0x0, 0x0, 0xff, 0xff, 0xff, 0xff,
-    0xff, 0xff, 0xd0, 0x0, 0x7f, 0xff, 0xff, 0xff,
-    0xff, 0xff, 0xfd, 0x0, 0x1f, 0xff, 0xff, 0xff,
-    0xff, 0xff, 0xff, 0xd0, 0x7, 0xff, 0xff, 0xff,
-    0xff, 0xff, 0xff, 0xfd, 0x0, 0xff, 0xff, 0xff,
-    0xff, 0xff, 0xff, 0xff, 0xd0, 0x2f, 0xff, 0xff,
-    0xff, 0xe5, 0x0, 0x56, 0xfd, 0x7, 0xff, 0xff,
-    0xff, 0xd0, 0x0, 0x0, 0x1, 0x90, 0xff, 0xff,
-    0xff, 0xd0, 0x0, 0x0, 0x0, 0x0, 0x1f, 0xff,
-    0xff, 0xf4, 0x0, 0x0, 0x0, 0x0, 0x2, 0xff,
-    0xff, 0xfd, 0x0, 0x0, 0x0, 0x0, 0x0, 0x3f,
-    0xff, 0xff, 0xc0, 0x0, 0x0, 0x0, 0x0, 0x3,
-    0xff, 0xff, 0xf4, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x7f, 0xff, 0xff, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0xb, 0xff, 0xff, 0xe0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0xbf, 0xff, 0xfe, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0xb, 0xff, 0xff, 0xd0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0xff, 0xff, 0xfd, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0xf, 0xff, 0xff, 0xd0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0xbf, 0xff, 0xfe, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0xb, 0xff, 0xff, 0xe0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x7f, 0xff, 0xff, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x7, 0xff, 0xff, 0xf4,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x3f, 0xff, 0xff,
-    0xc0, 0x0, 0x0, 0x0, 0x0, 0x2, 0xff, 0xff,
-    0xff, 0x0, 0x0, 0x0, 0x0, 0x0, 0x1f, 0xff,
-    0xff, 0xfc, 0x0, 0x0, 0x0, 0x0, 0x0, 0xff,
-    0xff, 0xff, 0xf4, 0x0, 0x0, 0x0, 0x3, 0x3,
-    0xff, 0xff, 0xff, 0xf4, 0x0, 0x0, 0x2, 0xf0,
-    0x2f, 0xff, 0xff, 0xff, 0xfa, 0x50, 0x5b, 0xff,
-    0x0, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
-    0xf0, 0x3, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
-    0xff, 0x0, 0x1f, 0xff, 0xff, 0xff, 0xff, 0xff,
-    0xff, 0xf0, 0x0, 0x7f, 0xff, 0xff, 0xff, 0xff,
-    0xff, 0xff, 0x0, 0x0, 0xff, 0xff, 0xff, 0xff,
-    0xff, 0xff, 0xf0, 0x0, 0x2, 0xff, 0xff, 0xff,
-    0xff, 0xff, 0xff, 0x0, 0x0, 0x2, 0xff, 0xff,
-    0xff, 0xff, 0xff, 0xf0, 0x0, 0x0, 0x1, 0xbf,
-    0xff, 0xff, 0xff, 0xe4, 0x0, 0x0, 0x0, 0x0,
-    0x6a, 0xff, 0xfa, 0x40, 0x0,
-
-    /* U+0064 "d" */
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x2, 0xff,
-    0xff, 0xfc, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0xbf, 0xff, 0xff, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x2f, 0xff, 0xff, 0xc0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0xb, 0xff, 0xff,
-    0xf0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x2,
-    0xff, 0xff, 0xfc, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0xbf, 0xff, 0xff, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x2f, 0xff, 0xff, 0xc0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0xb, 0xff,
-    0xff, 0xf0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x2, 0xff, 0xff, 0xfc, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0xbf, 0xff, 0xff, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x2f, 0xff, 0xff,
-    0xc0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0xb,
-    0xff, 0xff, 0xf0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x2, 0xff, 0xff, 0xfc, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0xbf, 0xff, 0xff, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x2f, 0xff,
-    0xff, 0xc0, 0x0, 0x0, 0x0, 0x0, 0x50, 0x0,
-    0xb, 0xff, 0xff, 0xf0, 0x0, 0x0, 0x0, 0x7f,
-    0xff, 0xf8, 0x2, 0xff, 0xff, 0xfc, 0x0, 0x0,
-    0x3, 0xff, 0xff, 0xff, 0xe0, 0xbf, 0xff, 0xff,
-    0x0, 0x0, 0xb, 0xff, 0xff, 0xff, 0xff, 0xaf,
-    0xff, 0xff, 0xc0, 0x0, 0xf, 0xff, 0xff, 0xff,
-    0xff, 0xff, 0xff, 0xff, 0xf0, 0x0, 0xf, 0xff,
-    0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xfc, 0x0,
-    0xf, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
-    0xff, 0x0, 0xf, 0xff, 0xff, 0xff, 0xff, 0xff,
-    0xff, 0xff, 0xff, 0xc0, 0x7, 0xff, 0xff, 0xff,
-    0xff, 0xff, 0xff, 0xff, 0xff, 0xf0, 0x3, 0xff,
-    0xff, 0xff, 0xf4, 0x1, 0xff, 0xff, 0xff, 0xfc,
-    0x2, 0xff, 0xff, 0xff, 0xd0, 0x0, 0x7, 0xff,
-    0xff, 0xff, 0x0, 0xff, 0xff, 0xff, 0xc0, 0x0,
-    0x0, 0x3f, 0xff, 0xff, 0xc0, 0x7f, 0xff, 0xff,
-    0xc0, 0x0, 0x0, 0x3, 0xff, 0xff, 0xf0, 0x2f,
-    0xff, 0xff, 0xd0, 0x0, 0x0, 0x0, 0x7f, 0xff,
-    0xfc, 0xf, 0xff, 0xff, 0xf0, 0x0, 0x0, 0x0,
-    0xf, 0xff, 0xff, 0x3, 0xff, 0xff, 0xf4, 0x0,
-    0x0, 0x0, 0x3, 0xff, 0xff, 0xc1, 0xff, 0xff,
-    0xfc, 0x0, 0x0, 0x0, 0x0, 0xff, 0xff, 0xf0,
-    0xbf, 0xff, 0xfe, 0x0, 0x0, 0x0, 0x0, 0x3f,
-    0xff, 0xfc, 0x2f, 0xff, 0xff, 0x40, 0x0, 0x0,
-    0x0, 0xf, 0xff, 0xff, 0xb, 0xff, 0xff, 0xd0,
-    0x0, 0x0, 0x0, 0x3, 0xff, 0xff, 0xc3, 0xff,
-    0xff, 0xf0, 0x0, 0x0, 0x0, 0x0, 0xff, 0xff,
-    0xf0, 0xff, 0xff, 0xfc, 0x0, 0x0, 0x0, 0x0,
-    0x3f, 0xff, 0xfc, 0x2f, 0xff, 0xff, 0x40, 0x0,
-    0x0, 0x0, 0xf, 0xff, 0xff, 0xb, 0xff, 0xff,
-    0xd0, 0x0, 0x0, 0x0, 0x3, 0xff, 0xff, 0xc2,
-    0xff, 0xff, 0xf8, 0x0, 0x0, 0x0, 0x0, 0xff,
-    0xff, 0xf0, 0x7f, 0xff, 0xff, 0x0, 0x0, 0x0,
-    0x0, 0x3f, 0xff, 0xfc, 0x1f, 0xff, 0xff, 0xd0,
-    0x0, 0x0, 0x0, 0xf, 0xff, 0xff, 0x3, 0xff,
-    0xff, 0xf8, 0x0, 0x0, 0x0, 0x3, 0xff, 0xff,
-    0xc0, 0xff, 0xff, 0xff, 0x40, 0x0, 0x0, 0x1,
-    0xff, 0xff, 0xf0, 0x2f, 0xff, 0xff, 0xf0, 0x0,
-    0x0, 0x0, 0xff, 0xff, 0xfc, 0x3, 0xff, 0xff,
-    0xff, 0x0, 0x0, 0x0, 0xff, 0xff, 0xff, 0x0,
-    0xbf, 0xff, 0xff, 0xf4, 0x0, 0x1, 0xff, 0xff,
-    0xff, 0xc0, 0xf, 0xff, 0xff, 0xff, 0xd0, 0x7,
-    0xff, 0xff, 0xff, 0xf0, 0x2, 0xff, 0xff, 0xff,
-    0xff, 0xff, 0xff, 0xff, 0xff, 0xfc, 0x0, 0x3f,
-    0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
-    0x0, 0x3, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
-    0xff, 0xff, 0xc0, 0x0, 0x3f, 0xff, 0xff, 0xff,
-    0xff, 0xff, 0xff, 0xff, 0xf4, 0x0, 0x3, 0xff,
-    0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xfd, 0x0,
-    0x0, 0x2f, 0xff, 0xff, 0xff, 0xff, 0x8f, 0xff,
-    0xff, 0x80, 0x0, 0x0, 0xbf, 0xff, 0xff, 0xfe,
-    0x43, 0xff, 0xff, 0xf0, 0x0, 0x0, 0x1, 0xbf,
-    0xff, 0xe4, 0x0, 0x6a, 0xaa, 0xa8, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x0,
-
-    /* U+0065 "e" */
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x1b, 0xff, 0xff,
-    0xe4, 0x0, 0x0, 0x0, 0x0, 0x0, 0x7, 0xff,
-    0xff, 0xff, 0xff, 0x80, 0x0, 0x0, 0x0, 0x0,
-    0x7f, 0xff, 0xff, 0xff, 0xff, 0xf8, 0x0, 0x0,
-    0x0, 0x2, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
-    0x40, 0x0, 0x0, 0xf, 0xff, 0xff, 0xff, 0xff,
-    0xff, 0xff, 0xe0, 0x0, 0x0, 0x3f, 0xff, 0xff,
-    0xff, 0xff, 0xff, 0xff, 0xf8, 0x0, 0x0, 0xbf,
-    0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xfd, 0x0,
-    0x2, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
-    0xff, 0x0, 0x3, 0xff, 0xff, 0xff, 0xd0, 0x6,
-    0xff, 0xff, 0xff, 0xc0, 0xb, 0xff, 0xff, 0xfd,
-    0x0, 0x0, 0x3f, 0xff, 0xff, 0xd0, 0xf, 0xff,
-    0xff, 0xf0, 0x0, 0x0, 0xf, 0xff, 0xff, 0xf0,
-    0x1f, 0xff, 0xff, 0xd0, 0x0, 0x0, 0x3, 0xff,
-    0xff, 0xf0, 0x3f, 0xff, 0xff, 0x80, 0x0, 0x0,
-    0x1, 0xff, 0xff, 0xf4, 0x3f, 0xff, 0xff, 0x40,
-    0x0, 0x0, 0x0, 0xff, 0xff, 0xf8, 0x7f, 0xff,
-    0xff, 0x0, 0x0, 0x0, 0x0, 0xbf, 0xff, 0xfc,
-    0x7f, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
-    0xff, 0xfc, 0xbf, 0xff, 0xff, 0xff, 0xff, 0xff,
-    0xff, 0xff, 0xff, 0xfd, 0xbf, 0xff, 0xff, 0xff,
-    0xff, 0xff, 0xff, 0xff, 0xff, 0xfd, 0xbf, 0xff,
-    0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xfd,
-    0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
-    0xff, 0xfe, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
-    0xff, 0xff, 0xff, 0xfe, 0xbf, 0xff, 0xff, 0xff,
-    0xff, 0xff, 0xff, 0xff, 0xff, 0xfd, 0xbf, 0xff,
-    0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xfd,
-    0xbf, 0xff, 0xfe, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x7f, 0xff, 0xfe, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x7f, 0xff, 0xff, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x3f, 0xff,
-    0xff, 0x40, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x2f, 0xff, 0xff, 0xc0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x1f, 0xff, 0xff, 0xe0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x80, 0xf, 0xff, 0xff, 0xf8,
-    0x0, 0x0, 0x0, 0x0, 0x7, 0xc0, 0xb, 0xff,
-    0xff, 0xfe, 0x0, 0x0, 0x0, 0x0, 0x7f, 0xc0,
-    0x3, 0xff, 0xff, 0xff, 0xe0, 0x0, 0x0, 0x1b,
-    0xff, 0xc0, 0x1, 0xff, 0xff, 0xff, 0xff, 0xa9,
-    0xab, 0xff, 0xff, 0xc0, 0x0, 0xbf, 0xff, 0xff,
-    0xff, 0xff, 0xff, 0xff, 0xff, 0xc0, 0x0, 0x2f,
-    0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xc0,
-    0x0, 0xf, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
-    0xff, 0xc0, 0x0, 0x2, 0xff, 0xff, 0xff, 0xff,
-    0xff, 0xff, 0xff, 0xc0, 0x0, 0x0, 0x3f, 0xff,
-    0xff, 0xff, 0xff, 0xff, 0xff, 0xc0, 0x0, 0x0,
-    0x7, 0xff, 0xff, 0xff, 0xff, 0xff, 0xfd, 0x0,
-    0x0, 0x0, 0x0, 0x2f, 0xff, 0xff, 0xff, 0xff,
-    0x90, 0x0, 0x0, 0x0, 0x0, 0x0, 0x6a, 0xff,
-    0xfe, 0x90, 0x0, 0x0,
-
-    /* U+0066 "f" */
-    0x0, 0x0, 0x0, 0x6, 0xbf, 0xff, 0xfc, 0x0,
-    0x0, 0x0, 0x3f, 0xff, 0xff, 0xff, 0x40, 0x0,
-    0x0, 0xbf, 0xff, 0xff, 0xff, 0xd0, 0x0, 0x0,
-    0xbf, 0xff, 0xff, 0xff, 0xf4, 0x0, 0x0, 0x7f,
-    0xff, 0xff, 0xff, 0xfd, 0x0, 0x0, 0x2f, 0xff,
-    0xff, 0xff, 0xff, 0x40, 0x0, 0xf, 0xff, 0xff,
-    0xff, 0xff, 0xd0, 0x0, 0x7, 0xff, 0xff, 0xff,
-    0xff, 0xf4, 0x0, 0x1, 0xff, 0xff, 0xff, 0xff,
-    0xfd, 0x0, 0x0, 0xbf, 0xff, 0xff, 0xd0, 0x0,
-    0x0, 0x0, 0x2f, 0xff, 0xff, 0xd0, 0x0, 0x0,
-    0x0, 0xb, 0xff, 0xff, 0xf0, 0x0, 0x0, 0x0,
-    0x2, 0xff, 0xff, 0xfc, 0x0, 0x0, 0x0, 0x0,
-    0xbf, 0xff, 0xff, 0x0, 0x0, 0x0, 0x0, 0x2f,
-    0xff, 0xff, 0xc0, 0x0, 0x0, 0x0, 0xb, 0xff,
-    0xff, 0xf0, 0x0, 0x0, 0x0, 0x2, 0xff, 0xff,
-    0xfc, 0x0, 0x0, 0x1f, 0xff, 0xff, 0xff, 0xff,
-    0xff, 0xff, 0xd7, 0xff, 0xff, 0xff, 0xff, 0xff,
-    0xff, 0xf5, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
-    0xfd, 0x7f, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
-    0x5f, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xd7,
-    0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xf5, 0xff,
-    0xff, 0xff, 0xff, 0xff, 0xff, 0xfd, 0x7f, 0xff,
-    0xff, 0xff, 0xff, 0xff, 0xff, 0x5f, 0xff, 0xff,
-    0xff, 0xff, 0xff, 0xff, 0xd0, 0x0, 0x2f, 0xff,
-    0xff, 0xc0, 0x0, 0x0, 0x0, 0xb, 0xff, 0xff,
-    0xf0, 0x0, 0x0, 0x0, 0x2, 0xff, 0xff, 0xfc,
-    0x0, 0x0, 0x0, 0x0, 0xbf, 0xff, 0xff, 0x0,
-    0x0, 0x0, 0x0, 0x2f, 0xff, 0xff, 0xc0, 0x0,
-    0x0, 0x0, 0xb, 0xff, 0xff, 0xf0, 0x0, 0x0,
-    0x0, 0x2, 0xff, 0xff, 0xfc, 0x0, 0x0, 0x0,
-    0x0, 0xbf, 0xff, 0xff, 0x0, 0x0, 0x0, 0x0,
-    0x2f, 0xff, 0xff, 0xc0, 0x0, 0x0, 0x0, 0xb,
-    0xff, 0xff, 0xf0, 0x0, 0x0, 0x0, 0x2, 0xff,
-    0xff, 0xfc, 0x0, 0x0, 0x0, 0x0, 0xbf, 0xff,
-    0xff, 0x0, 0x0, 0x0, 0x0, 0x2f, 0xff, 0xff,
-    0xc0, 0x0, 0x0, 0x0, 0xb, 0xff, 0xff, 0xf0,
-    0x0, 0x0, 0x0, 0x2, 0xff, 0xff, 0xfc, 0x0,
-    0x0, 0x0, 0x0, 0xbf, 0xff, 0xff, 0x0, 0x0,
-    0x0, 0x0, 0x2f, 0xff, 0xff, 0xc0, 0x0, 0x0,
-    0x0, 0xb, 0xff, 0xff, 0xf0, 0x0, 0x0, 0x0,
-    0x2, 0xff, 0xff, 0xfc, 0x0, 0x0, 0x0, 0x0,
-    0xbf, 0xff, 0xff, 0x0, 0x0, 0x0, 0x0, 0x2f,
-    0xff, 0xff, 0xc0, 0x0, 0x0, 0x0, 0xb, 0xff,
-    0xff, 0xf0, 0x0, 0x0, 0x0, 0x2, 0xff, 0xff,
-    0xfc, 0x0, 0x0, 0x0, 0x0, 0xbf, 0xff, 0xff,
-    0x0, 0x0, 0x0, 0x0, 0x2f, 0xff, 0xff, 0xc0,
-    0x0, 0x0, 0x0, 0xb, 0xff, 0xff, 0xf0, 0x0,
-    0x0, 0x0, 0x2, 0xff, 0xff, 0xfc, 0x0, 0x0,
-    0x0, 0x0, 0xbf, 0xff, 0xff, 0x0, 0x0, 0x0,
-    0x0, 0x2f, 0xff, 0xff, 0xc0, 0x0, 0x0, 0x0,
-    0xb, 0xff, 0xff, 0xe0, 0x0, 0x0,
-
-    /* U+0067 "g" */
-    0x0, 0x0, 0x0, 0x0, 0x15, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x2, 0xff, 0xff, 0xe0,
-    0x5, 0x55, 0x55, 0x40, 0x0, 0x0, 0xff, 0xff,
-    0xff, 0xfc, 0x2f, 0xff, 0xff, 0x80, 0x0, 0x2f,
-    0xff, 0xff, 0xff, 0xfe, 0xff, 0xff, 0xfe, 0x0,
-    0x3, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
-    0xf8, 0x0, 0x3f, 0xff, 0xff, 0xff, 0xff, 0xff,
-    0xff, 0xff, 0xe0, 0x3, 0xff, 0xff, 0xff, 0xff,
-    0xff, 0xff, 0xff, 0xff, 0x80, 0x3f, 0xff, 0xff,
-    0xff, 0xff, 0xff, 0xff, 0xff, 0xfe, 0x2, 0xff,
-    0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xf8,
-    0xf, 0xff, 0xff, 0xff, 0xd0, 0x7, 0xff, 0xff,
-    0xff, 0xe0, 0xbf, 0xff, 0xff, 0xf4, 0x0, 0x1,
-    0xff, 0xff, 0xff, 0x83, 0xff, 0xff, 0xff, 0x0,
-    0x0, 0x0, 0xff, 0xff, 0xfe, 0x1f, 0xff, 0xff,
-    0xf0, 0x0, 0x0, 0x0, 0xff, 0xff, 0xf8, 0xff,
-    0xff, 0xff, 0x40, 0x0, 0x0, 0x1, 0xff, 0xff,
-    0xe3, 0xff, 0xff, 0xf8, 0x0, 0x0, 0x0, 0x3,
-    0xff, 0xff, 0x8f, 0xff, 0xff, 0xd0, 0x0, 0x0,
-    0x0, 0xf, 0xff, 0xfe, 0x7f, 0xff, 0xff, 0x0,
-    0x0, 0x0, 0x0, 0x3f, 0xff, 0xfa, 0xff, 0xff,
-    0xf8, 0x0, 0x0, 0x0, 0x0, 0xff, 0xff, 0xeb,
-    0xff, 0xff, 0xd0, 0x0, 0x0, 0x0, 0x3, 0xff,
-    0xff, 0xaf, 0xff, 0xff, 0x40, 0x0, 0x0, 0x0,
-    0xf, 0xff, 0xfe, 0xff, 0xff, 0xfc, 0x0, 0x0,
-    0x0, 0x0, 0x3f, 0xff, 0xfb, 0xff, 0xff, 0xf0,
-    0x0, 0x0, 0x0, 0x0, 0xff, 0xff, 0xeb, 0xff,
-    0xff, 0xd0, 0x0, 0x0, 0x0, 0x3, 0xff, 0xff,
-    0xaf, 0xff, 0xff, 0x40, 0x0, 0x0, 0x0, 0xf,
-    0xff, 0xfe, 0xbf, 0xff, 0xfe, 0x0, 0x0, 0x0,
-    0x0, 0x3f, 0xff, 0xf9, 0xff, 0xff, 0xfc, 0x0,
-    0x0, 0x0, 0x0, 0xff, 0xff, 0xe7, 0xff, 0xff,
-    0xf4, 0x0, 0x0, 0x0, 0x3, 0xff, 0xff, 0x8f,
-    0xff, 0xff, 0xe0, 0x0, 0x0, 0x0, 0xf, 0xff,
-    0xfe, 0x3f, 0xff, 0xff, 0xd0, 0x0, 0x0, 0x0,
-    0x7f, 0xff, 0xf8, 0xbf, 0xff, 0xff, 0xc0, 0x0,
-    0x0, 0x3, 0xff, 0xff, 0xe0, 0xff, 0xff, 0xff,
-    0xc0, 0x0, 0x0, 0x3f, 0xff, 0xff, 0x82, 0xff,
-    0xff, 0xff, 0xd0, 0x0, 0x7, 0xff, 0xff, 0xfe,
-    0x3, 0xff, 0xff, 0xff, 0xf4, 0x1, 0xff, 0xff,
-    0xff, 0xf8, 0xb, 0xff, 0xff, 0xff, 0xff, 0xff,
-    0xff, 0xff, 0xff, 0xe0, 0xf, 0xff, 0xff, 0xff,
-    0xff, 0xff, 0xff, 0xff, 0xff, 0x80, 0xf, 0xff,
-    0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xfe, 0x0,
-    0xf, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
-    0xf8, 0x0, 0xf, 0xff, 0xff, 0xff, 0xff, 0xff,
-    0xff, 0xff, 0xe0, 0x0, 0xb, 0xff, 0xff, 0xff,
-    0xff, 0xff, 0xff, 0xff, 0x80, 0x0, 0x3, 0xff,
-    0xff, 0xff, 0xf8, 0xff, 0xff, 0xfe, 0x0, 0x0,
-    0x0, 0x7f, 0xff, 0xfd, 0x3, 0xff, 0xff, 0xf8,
-    0x0, 0x0, 0x0, 0x0, 0x50, 0x0, 0xf, 0xff,
-    0xff, 0xd0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0xbf, 0xff, 0xff, 0x40, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x3, 0xff, 0xff, 0xfd, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x3f, 0xff, 0xff, 0xf0, 0x25,
-    0x0, 0x0, 0x0, 0x0, 0x7, 0xff, 0xff, 0xff,
-    0xc0, 0xff, 0xf9, 0x54, 0x0, 0x6, 0xff, 0xff,
-    0xff, 0xfe, 0x3, 0xff, 0xff, 0xff, 0xff, 0xff,
-    0xff, 0xff, 0xff, 0xf4, 0xf, 0xff, 0xff, 0xff,
-    0xff, 0xff, 0xff, 0xff, 0xff, 0xc0, 0x3f, 0xff,
-    0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xfd, 0x0,
-    0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
-    0xe0, 0x3, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
-    0xff, 0xff, 0x0, 0xf, 0xff, 0xff, 0xff, 0xff,
-    0xff, 0xff, 0xff, 0xf0, 0x0, 0x3f, 0xff, 0xff,
-    0xff, 0xff, 0xff, 0xff, 0xfe, 0x0, 0x0, 0xff,
-    0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xc0, 0x0,
-    0x0, 0x1b, 0xff, 0xff, 0xff, 0xff, 0xff, 0xe0,
-    0x0, 0x0, 0x0, 0x0, 0x16, 0xbf, 0xff, 0xfe,
-    0x90, 0x0, 0x0, 0x0,
-
-    /* U+0068 "h" */
-    0x7f, 0xff, 0xff, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x1f, 0xff, 0xff, 0xc0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x7, 0xff, 0xff, 0xf0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x1, 0xff, 0xff, 0xfc, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x7f, 0xff, 0xff,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x1f, 0xff,
-    0xff, 0xc0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x7,
-    0xff, 0xff, 0xf0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x1, 0xff, 0xff, 0xfc, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x7f, 0xff, 0xff, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x1f, 0xff, 0xff, 0xc0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x7, 0xff, 0xff, 0xf0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x1, 0xff, 0xff,
-    0xfc, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x7f,
-    0xff, 0xff, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x1f, 0xff, 0xff, 0xc0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x7, 0xff, 0xff, 0xf0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x1, 0xff, 0xff, 0xfc, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x7f, 0xff, 0xff, 0x0,
-    0x0, 0x6b, 0xfa, 0x0, 0x0, 0x1f, 0xff, 0xff,
-    0xc0, 0xb, 0xff, 0xff, 0xfd, 0x0, 0x7, 0xff,
-    0xff, 0xf0, 0x2f, 0xff, 0xff, 0xff, 0xf0, 0x1,
-    0xff, 0xff, 0xfc, 0x7f, 0xff, 0xff, 0xff, 0xff,
-    0x0, 0x7f, 0xff, 0xff, 0xbf, 0xff, 0xff, 0xff,
-    0xff, 0xf0, 0x1f, 0xff, 0xff, 0xff, 0xff, 0xff,
-    0xff, 0xff, 0xfe, 0x7, 0xff, 0xff, 0xff, 0xff,
-    0xff, 0xff, 0xff, 0xff, 0xc1, 0xff, 0xff, 0xff,
-    0xff, 0xff, 0xff, 0xff, 0xff, 0xf8, 0x7f, 0xff,
-    0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0x1f,
-    0xff, 0xff, 0xff, 0xe4, 0x7, 0xff, 0xff, 0xff,
-    0xc7, 0xff, 0xff, 0xff, 0x40, 0x0, 0x2f, 0xff,
-    0xff, 0xf5, 0xff, 0xff, 0xff, 0x0, 0x0, 0x3,
-    0xff, 0xff, 0xfd, 0x7f, 0xff, 0xff, 0x0, 0x0,
-    0x0, 0x7f, 0xff, 0xff, 0x5f, 0xff, 0xff, 0xc0,
-    0x0, 0x0, 0xf, 0xff, 0xff, 0xd7, 0xff, 0xff,
-    0xf0, 0x0, 0x0, 0x3, 0xff, 0xff, 0xf5, 0xff,
-    0xff, 0xfc, 0x0, 0x0, 0x0, 0xff, 0xff, 0xfd,
-    0x7f, 0xff, 0xff, 0x0, 0x0, 0x0, 0x3f, 0xff,
-    0xff, 0x5f, 0xff, 0xff, 0xc0, 0x0, 0x0, 0xf,
-    0xff, 0xff, 0xd7, 0xff, 0xff, 0xf0, 0x0, 0x0,
-    0x3, 0xff, 0xff, 0xf5, 0xff, 0xff, 0xfc, 0x0,
-    0x0, 0x0, 0xff, 0xff, 0xfd, 0x7f, 0xff, 0xff,
-    0x0, 0x0, 0x0, 0x3f, 0xff, 0xff, 0x5f, 0xff,
-    0xff, 0xc0, 0x0, 0x0, 0xf, 0xff, 0xff, 0xd7,
-    0xff, 0xff, 0xf0, 0x0, 0x0, 0x3, 0xff, 0xff,
-    0xf5, 0xff, 0xff, 0xfc, 0x0, 0x0, 0x0, 0xff,
-    0xff, 0xfd, 0x7f, 0xff, 0xff, 0x0, 0x0, 0x0,
-    0x3f, 0xff, 0xff, 0x5f, 0xff, 0xff, 0xc0, 0x0,
-    0x0, 0xf, 0xff, 0xff, 0xd7, 0xff, 0xff, 0xf0,
-    0x0, 0x0, 0x3, 0xff, 0xff, 0xf5, 0xff, 0xff,
-    0xfc, 0x0, 0x0, 0x0, 0xff, 0xff, 0xfd, 0x7f,
-    0xff, 0xff, 0x0, 0x0, 0x0, 0x3f, 0xff, 0xff,
-    0x5f, 0xff, 0xff, 0xc0, 0x0, 0x0, 0xf, 0xff,
-    0xff, 0xd7, 0xff, 0xff, 0xf0, 0x0, 0x0, 0x3,
-    0xff, 0xff, 0xf5, 0xff, 0xff, 0xfc, 0x0, 0x0,
-    0x0, 0xff, 0xff, 0xfd, 0x7f, 0xff, 0xff, 0x0,
-    0x0, 0x0, 0x3f, 0xff, 0xff, 0x5f, 0xff, 0xff,
-    0xc0, 0x0, 0x0, 0xf, 0xff, 0xff, 0xd7, 0xff,
-    0xff, 0xf0, 0x0, 0x0, 0x3, 0xff, 0xff, 0xf5,
-    0xff, 0xff, 0xfc, 0x0, 0x0, 0x0, 0xff, 0xff,
-    0xfd, 0x7f, 0xff, 0xff, 0x0, 0x0, 0x0, 0x3f,
-    0xff, 0xff, 0x5f, 0xff, 0xff, 0xc0, 0x0, 0x0,
-    0xf, 0xff, 0xff, 0xd7, 0xff, 0xff, 0xf0, 0x0,
-    0x0, 0x3, 0xff, 0xff, 0xf5, 0xaa, 0xaa, 0xa8,
-    0x0, 0x0, 0x0, 0xaa, 0xaa, 0xa8,
-
-    /* U+0069 "i" */
-    0x7f, 0xff, 0xff, 0x1f, 0xff, 0xff, 0xc7, 0xff,
-    0xff, 0xf1, 0xff, 0xff, 0xfc, 0x7f, 0xff, 0xff,
-    0x1f, 0xff, 0xff, 0xc7, 0xff, 0xff, 0xf1, 0xff,
-    0xff, 0xfc, 0x7f, 0xff, 0xff, 0x1f, 0xff, 0xff,
-    0xc7, 0xff, 0xff, 0xf1, 0xaa, 0xaa, 0xa8, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x1f,
-    0xff, 0xff, 0xc7, 0xff, 0xff, 0xf1, 0xff, 0xff,
-    0xfc, 0x7f, 0xff, 0xff, 0x1f, 0xff, 0xff, 0xc7,
-    0xff, 0xff, 0xf1, 0xff, 0xff, 0xfc, 0x7f, 0xff,
-    0xff, 0x1f, 0xff, 0xff, 0xc7, 0xff, 0xff, 0xf1,
-    0xff, 0xff, 0xfc, 0x7f, 0xff, 0xff, 0x1f, 0xff,
-    0xff, 0xc7, 0xff, 0xff, 0xf1, 0xff, 0xff, 0xfc,
-    0x7f, 0xff, 0xff, 0x1f, 0xff, 0xff, 0xc7, 0xff,
-    0xff, 0xf1, 0xff, 0xff, 0xfc, 0x7f, 0xff, 0xff,
-    0x1f, 0xff, 0xff, 0xc7, 0xff, 0xff, 0xf1, 0xff,
-    0xff, 0xfc, 0x7f, 0xff, 0xff, 0x1f, 0xff, 0xff,
-    0xc7, 0xff, 0xff, 0xf1, 0xff, 0xff, 0xfc, 0x7f,
-    0xff, 0xff, 0x1f, 0xff, 0xff, 0xc7, 0xff, 0xff,
-    0xf1, 0xff, 0xff, 0xfc, 0x7f, 0xff, 0xff, 0x1f,
-    0xff, 0xff, 0xc7, 0xff, 0xff, 0xf1, 0xff, 0xff,
-    0xfc, 0x7f, 0xff, 0xff, 0x1f, 0xff, 0xff, 0xc7,
-    0xff, 0xff, 0xf1, 0xff, 0xff, 0xfc,
-
-    /* U+006A "j" */
-    0x0, 0x0, 0x1f, 0xff, 0xff, 0xc0, 0x0, 0x1,
-    0xff, 0xff, 0xfc, 0x0, 0x0, 0x1f, 0xff, 0xff,
-    0xc0, 0x0, 0x1, 0xff, 0xff, 0xfc, 0x0, 0x0,
-    0x1f, 0xff, 0xff, 0xc0, 0x0, 0x1, 0xff, 0xff,
-    0xfc, 0x0, 0x0, 0x1f, 0xff, 0xff, 0xc0, 0x0,
-    0x1, 0xff, 0xff, 0xfc, 0x0, 0x0, 0x1f, 0xff,
-    0xff, 0xc0, 0x0, 0x1, 0xff, 0xff, 0xfc, 0x0,
-    0x0, 0x1f, 0xff, 0xff, 0xc0, 0x0, 0x0, 0xaa,
-    0xaa, 0xa8, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x5, 0x55, 0x55, 0x40, 0x0, 0x1,
-    0xff, 0xff, 0xfc, 0x0, 0x0, 0x1f, 0xff, 0xff,
-    0xc0, 0x0, 0x1, 0xff, 0xff, 0xfc, 0x0, 0x0,
-    0x1f, 0xff, 0xff, 0xc0, 0x0, 0x1, 0xff, 0xff,
-    0xfc, 0x0, 0x0, 0x1f, 0xff, 0xff, 0xc0, 0x0,
-    0x1, 0xff, 0xff, 0xfc, 0x0, 0x0, 0x1f, 0xff,
-    0xff, 0xc0, 0x0, 0x1, 0xff, 0xff, 0xfc, 0x0,
-    0x0, 0x1f, 0xff, 0xff, 0xc0, 0x0, 0x1, 0xff,
-    0xff, 0xfc, 0x0, 0x0, 0x1f, 0xff, 0xff, 0xc0,
-    0x0, 0x1, 0xff, 0xff, 0xfc, 0x0, 0x0, 0x1f,
-    0xff, 0xff, 0xc0, 0x0, 0x1, 0xff, 0xff, 0xfc,
-    0x0, 0x0, 0x1f, 0xff, 0xff, 0xc0, 0x0, 0x1,
-    0xff, 0xff, 0xfc, 0x0, 0x0, 0x1f, 0xff, 0xff,
-    0xc0, 0x0, 0x1, 0xff, 0xff, 0xfc, 0x0, 0x0,
-    0x1f, 0xff, 0xff, 0xc0, 0x0, 0x1, 0xff, 0xff,
-    0xfc, 0x0, 0x0, 0x1f, 0xff, 0xff, 0xc0, 0x0,
-    0x1, 0xff, 0xff, 0xfc, 0x0, 0x0, 0x1f, 0xff,
-    0xff, 0xc0, 0x0, 0x1, 0xff, 0xff, 0xfc, 0x0,
-    0x0, 0x1f, 0xff, 0xff, 0xc0, 0x0, 0x1, 0xff,
-    0xff, 0xfc, 0x0, 0x0, 0x1f, 0xff, 0xff, 0xc0,
-    0x0, 0x1, 0xff, 0xff, 0xfc, 0x0, 0x0, 0x1f,
-    0xff, 0xff, 0xc0, 0x0, 0x1, 0xff, 0xff, 0xfc,
-    0x0, 0x0, 0x1f, 0xff, 0xff, 0xc0, 0x0, 0x1,
-    0xff, 0xff, 0xfc, 0x0, 0x0, 0x1f, 0xff, 0xff,
-    0xc0, 0x0, 0x1, 0xff, 0xff, 0xfc, 0x0, 0x0,
-    0x1f, 0xff, 0xff, 0xc0, 0x0, 0x1, 0xff, 0xff,
-    0xfc, 0x0, 0x0, 0x1f, 0xff, 0xff, 0xc0, 0x0,
-    0x2, 0xff, 0xff, 0xfc, 0x0, 0x0, 0x2f, 0xff,
-    0xff, 0xc0, 0x0, 0x3, 0xff, 0xff, 0xfc, 0x0,
-    0x0, 0x7f, 0xff, 0xff, 0xc0, 0x0, 0xf, 0xff,
-    0xff, 0xf8, 0x0, 0x3, 0xff, 0xff, 0xff, 0x40,
-    0x2, 0xff, 0xff, 0xff, 0xf0, 0x7f, 0xff, 0xff,
-    0xff, 0xfe, 0x7, 0xff, 0xff, 0xff, 0xff, 0xc0,
-    0x7f, 0xff, 0xff, 0xff, 0xf8, 0x7, 0xff, 0xff,
-    0xff, 0xff, 0x0, 0x7f, 0xff, 0xff, 0xff, 0xc0,
-    0x7, 0xff, 0xff, 0xff, 0xf0, 0x0, 0x7f, 0xff,
-    0xff, 0xf8, 0x0, 0x7, 0xff, 0xff, 0xfd, 0x0,
-    0x0, 0x7f, 0xff, 0xf8, 0x0, 0x0, 0x7, 0xfe,
-    0x90, 0x0, 0x0, 0x0,
-
-    /* U+006B "k" */
-    0x7f, 0xff, 0xff, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x7f, 0xff, 0xff, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x7f, 0xff, 0xff, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x7f, 0xff, 0xff, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x7f, 0xff, 0xff, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x7f, 0xff, 0xff,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x7f, 0xff,
-    0xff, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x7f,
-    0xff, 0xff, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x7f, 0xff, 0xff, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x7f, 0xff, 0xff, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x7f, 0xff, 0xff, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x7f, 0xff, 0xff, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x7f, 0xff, 0xff, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x7f, 0xff, 0xff,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x7f, 0xff,
-    0xff, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x7f,
-    0xff, 0xff, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x7f, 0xff, 0xff, 0x0, 0x0, 0x1, 0x55, 0x55,
-    0x54, 0x7f, 0xff, 0xff, 0x0, 0x0, 0xf, 0xff,
-    0xff, 0xf0, 0x7f, 0xff, 0xff, 0x0, 0x0, 0x2f,
-    0xff, 0xff, 0xd0, 0x7f, 0xff, 0xff, 0x0, 0x0,
-    0x7f, 0xff, 0xff, 0x80, 0x7f, 0xff, 0xff, 0x0,
-    0x0, 0xff, 0xff, 0xff, 0x0, 0x7f, 0xff, 0xff,
-    0x0, 0x3, 0xff, 0xff, 0xfc, 0x0, 0x7f, 0xff,
-    0xff, 0x0, 0x7, 0xff, 0xff, 0xf4, 0x0, 0x7f,
-    0xff, 0xff, 0x0, 0xf, 0xff, 0xff, 0xe0, 0x0,
-    0x7f, 0xff, 0xff, 0x0, 0x3f, 0xff, 0xff, 0xc0,
-    0x0, 0x7f, 0xff, 0xff, 0x0, 0xbf, 0xff, 0xff,
-    0x0, 0x0, 0x7f, 0xff, 0xff, 0x1, 0xff, 0xff,
-    0xfd, 0x0, 0x0, 0x7f, 0xff, 0xff, 0x3, 0xff,
-    0xff, 0xf8, 0x0, 0x0, 0x7f, 0xff, 0xff, 0xf,
-    0xff, 0xff, 0xf0, 0x0, 0x0, 0x7f, 0xff, 0xff,
-    0xff, 0xff, 0xff, 0xc0, 0x0, 0x0, 0x7f, 0xff,
-    0xff, 0xff, 0xff, 0xff, 0x40, 0x0, 0x0, 0x7f,
-    0xff, 0xff, 0xff, 0xff, 0xfe, 0x0, 0x0, 0x0,
-    0x7f, 0xff, 0xff, 0xff, 0xff, 0xfc, 0x0, 0x0,
-    0x0, 0x7f, 0xff, 0xff, 0xff, 0xff, 0xf8, 0x0,
-    0x0, 0x0, 0x7f, 0xff, 0xff, 0xff, 0xff, 0xfd,
-    0x0, 0x0, 0x0, 0x7f, 0xff, 0xff, 0xff, 0xff,
-    0xff, 0x40, 0x0, 0x0, 0x7f, 0xff, 0xff, 0xff,
-    0xff, 0xff, 0xc0, 0x0, 0x0, 0x7f, 0xff, 0xff,
-    0xff, 0xff, 0xff, 0xf0, 0x0, 0x0, 0x7f, 0xff,
-    0xff, 0x7, 0xff, 0xff, 0xf8, 0x0, 0x0, 0x7f,
-    0xff, 0xff, 0x1, 0xff, 0xff, 0xfd, 0x0, 0x0,
-    0x7f, 0xff, 0xff, 0x0, 0xbf, 0xff, 0xff, 0x0,
-    0x0, 0x7f, 0xff, 0xff, 0x0, 0x2f, 0xff, 0xff,
-    0x80, 0x0, 0x7f, 0xff, 0xff, 0x0, 0xf, 0xff,
-    0xff, 0xd0, 0x0, 0x7f, 0xff, 0xff, 0x0, 0x7,
-    0xff, 0xff, 0xf0, 0x0, 0x7f, 0xff, 0xff, 0x0,
-    0x2, 0xff, 0xff, 0xf8, 0x0, 0x7f, 0xff, 0xff,
-    0x0, 0x0, 0xff, 0xff, 0xfc, 0x0, 0x7f, 0xff,
-    0xff, 0x0, 0x0, 0x7f, 0xff, 0xfe, 0x0, 0x7f,
-    0xff, 0xff, 0x0, 0x0, 0x3f, 0xff, 0xff, 0x0,
-    0x7f, 0xff, 0xff, 0x0, 0x0, 0x1f, 0xff, 0xff,
-    0x80, 0x7f, 0xff, 0xff, 0x0, 0x0, 0xf, 0xff,
-    0xff, 0xc0, 0x7f, 0xff, 0xff, 0x0, 0x0, 0x7,
-    0xff, 0xff, 0xe0, 0x7f, 0xff, 0xff, 0x0, 0x0,
-    0x3, 0xff, 0xff, 0xf0, 0x7f, 0xff, 0xff, 0x0,
-    0x0, 0x1, 0xff, 0xff, 0xf4, 0x7f, 0xff, 0xff,
-    0x0, 0x0, 0x0, 0xff, 0xff, 0xfc, 0x7f, 0xff,
-    0xff, 0x0, 0x0, 0x0, 0xbf, 0xff, 0xfd, 0x6a,
-    0xaa, 0xaa, 0x0, 0x0, 0x0, 0x2a, 0xaa, 0xa9,
-
-    /* U+006C "l" */
-    0x7f, 0xff, 0xff, 0x0, 0x0, 0x7f, 0xff, 0xff,
-    0x0, 0x0, 0x7f, 0xff, 0xff, 0x0, 0x0, 0x7f,
-    0xff, 0xff, 0x0, 0x0, 0x7f, 0xff, 0xff, 0x0,
-    0x0, 0x7f, 0xff, 0xff, 0x0, 0x0, 0x7f, 0xff,
-    0xff, 0x0, 0x0, 0x7f, 0xff, 0xff, 0x0, 0x0,
-    0x7f, 0xff, 0xff, 0x0, 0x0, 0x7f, 0xff, 0xff,
-    0x0, 0x0, 0x7f, 0xff, 0xff, 0x0, 0x0, 0x7f,
-    0xff, 0xff, 0x0, 0x0, 0x7f, 0xff, 0xff, 0x0,
-    0x0, 0x7f, 0xff, 0xff, 0x0, 0x0, 0x7f, 0xff,
-    0xff, 0x0, 0x0, 0x7f, 0xff, 0xff, 0x0, 0x0,
-    0x7f, 0xff, 0xff, 0x0, 0x0, 0x7f, 0xff, 0xff,
-    0x0, 0x0, 0x7f, 0xff, 0xff, 0x0, 0x0, 0x7f,
-    0xff, 0xff, 0x0, 0x0, 0x7f, 0xff, 0xff, 0x0,
-    0x0, 0x7f, 0xff, 0xff, 0x0, 0x0, 0x7f, 0xff,
-    0xff, 0x0, 0x0, 0x7f, 0xff, 0xff, 0x0, 0x0,
-    0x7f, 0xff, 0xff, 0x0, 0x0, 0x7f, 0xff, 0xff,
-    0x0, 0x0, 0x7f, 0xff, 0xff, 0x0, 0x0, 0x7f,
-    0xff, 0xff, 0x0, 0x0, 0x7f, 0xff, 0xff, 0x0,
-    0x0, 0x7f, 0xff, 0xff, 0x0, 0x0, 0x7f, 0xff,
-    0xff, 0x0, 0x0, 0x7f, 0xff, 0xff, 0x0, 0x0,
-    0x7f, 0xff, 0xff, 0x0, 0x0, 0x7f, 0xff, 0xff,
-    0x0, 0x0, 0x7f, 0xff, 0xff, 0x0, 0x0, 0x7f,
-    0xff, 0xff, 0x0, 0x0, 0x7f, 0xff, 0xff, 0x0,
-    0x0, 0x7f, 0xff, 0xff, 0x0, 0x0, 0x7f, 0xff,
-    0xff, 0x0, 0x0, 0x7f, 0xff, 0xff, 0x0, 0x0,
-    0x7f, 0xff, 0xff, 0x0, 0x0, 0x7f, 0xff, 0xff,
-    0x40, 0x0, 0x7f, 0xff, 0xff, 0x40, 0x0, 0x7f,
-    0xff, 0xff, 0x80, 0x0, 0x3f, 0xff, 0xff, 0xc0,
-    0x0, 0x3f, 0xff, 0xff, 0xf0, 0x0, 0x3f, 0xff,
-    0xff, 0xff, 0xa8, 0x2f, 0xff, 0xff, 0xff, 0xfc,
-    0x1f, 0xff, 0xff, 0xff, 0xfc, 0xf, 0xff, 0xff,
-    0xff, 0xfc, 0x7, 0xff, 0xff, 0xff, 0xfc, 0x2,
-    0xff, 0xff, 0xff, 0xfc, 0x0, 0xff, 0xff, 0xff,
-    0xfc, 0x0, 0x2f, 0xff, 0xff, 0xfc, 0x0, 0x7,
-    0xff, 0xff, 0xfc, 0x0, 0x0, 0x1b, 0xff, 0xfc,
-
-    /* U+006D "m" */
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x7, 0xff,
-    0xff, 0xf0, 0x0, 0x1b, 0xff, 0xe4, 0x0, 0x0,
-    0x1, 0xbf, 0xf9, 0x0, 0x0, 0x7f, 0xff, 0xff,
-    0x0, 0x6f, 0xff, 0xff, 0xf4, 0x0, 0x7, 0xff,
-    0xff, 0xff, 0x0, 0x7, 0xff, 0xff, 0xf0, 0x7f,
-    0xff, 0xff, 0xff, 0xf0, 0xb, 0xff, 0xff, 0xff,
-    0xfd, 0x0, 0x7f, 0xff, 0xff, 0x2f, 0xff, 0xff,
-    0xff, 0xff, 0xc7, 0xff, 0xff, 0xff, 0xff, 0xf8,
-    0x7, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
-    0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xd0, 0x7f,
-    0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
-    0xff, 0xff, 0xff, 0xff, 0xff, 0x7, 0xff, 0xff,
-    0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
-    0xff, 0xff, 0xff, 0xf4, 0x7f, 0xff, 0xff, 0xff,
-    0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
-    0xff, 0xff, 0x87, 0xff, 0xff, 0xff, 0xff, 0xff,
-    0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
-    0xfc, 0x7f, 0xff, 0xff, 0xff, 0x40, 0x1f, 0xff,
-    0xff, 0xff, 0xe4, 0x2, 0xff, 0xff, 0xff, 0xc7,
-    0xff, 0xff, 0xff, 0x0, 0x0, 0x3f, 0xff, 0xff,
-    0xf0, 0x0, 0x7, 0xff, 0xff, 0xfc, 0x7f, 0xff,
-    0xff, 0x80, 0x0, 0x1, 0xff, 0xff, 0xfe, 0x0,
-    0x0, 0x3f, 0xff, 0xff, 0xd7, 0xff, 0xff, 0xf0,
-    0x0, 0x0, 0xf, 0xff, 0xff, 0xe0, 0x0, 0x1,
-    0xff, 0xff, 0xfd, 0x7f, 0xff, 0xff, 0x0, 0x0,
-    0x0, 0xff, 0xff, 0xfe, 0x0, 0x0, 0x1f, 0xff,
-    0xff, 0xd7, 0xff, 0xff, 0xf0, 0x0, 0x0, 0xf,
-    0xff, 0xff, 0xe0, 0x0, 0x0, 0xff, 0xff, 0xfd,
-    0x7f, 0xff, 0xff, 0x0, 0x0, 0x0, 0xff, 0xff,
-    0xfe, 0x0, 0x0, 0xf, 0xff, 0xff, 0xd7, 0xff,
-    0xff, 0xf0, 0x0, 0x0, 0xf, 0xff, 0xff, 0xe0,
-    0x0, 0x0, 0xff, 0xff, 0xfd, 0x7f, 0xff, 0xff,
-    0x0, 0x0, 0x0, 0xff, 0xff, 0xfe, 0x0, 0x0,
-    0xf, 0xff, 0xff, 0xd7, 0xff, 0xff, 0xf0, 0x0,
-    0x0, 0xf, 0xff, 0xff, 0xe0, 0x0, 0x0, 0xff,
-    0xff, 0xfd, 0x7f, 0xff, 0xff, 0x0, 0x0, 0x0,
-    0xff, 0xff, 0xfe, 0x0, 0x0, 0xf, 0xff, 0xff,
-    0xd7, 0xff, 0xff, 0xf0, 0x0, 0x0, 0xf, 0xff,
-    0xff, 0xe0, 0x0, 0x0, 0xff, 0xff, 0xfd, 0x7f,
-    0xff, 0xff, 0x0, 0x0, 0x0, 0xff, 0xff, 0xfe,
-    0x0, 0x0, 0xf, 0xff, 0xff, 0xd7, 0xff, 0xff,
-    0xf0, 0x0, 0x0, 0xf, 0xff, 0xff, 0xe0, 0x0,
-    0x0, 0xff, 0xff, 0xfd, 0x7f, 0xff, 0xff, 0x0,
-    0x0, 0x0, 0xff, 0xff, 0xfe, 0x0, 0x0, 0xf,
-    0xff, 0xff, 0xd7, 0xff, 0xff, 0xf0, 0x0, 0x0,
-    0xf, 0xff, 0xff, 0xe0, 0x0, 0x0, 0xff, 0xff,
-    0xfd, 0x7f, 0xff, 0xff, 0x0, 0x0, 0x0, 0xff,
-    0xff, 0xfe, 0x0, 0x0, 0xf, 0xff, 0xff, 0xd7,
-    0xff, 0xff, 0xf0, 0x0, 0x0, 0xf, 0xff, 0xff,
-    0xe0, 0x0, 0x0, 0xff, 0xff, 0xfd, 0x7f, 0xff,
-    0xff, 0x0, 0x0, 0x0, 0xff, 0xff, 0xfe, 0x0,
-    0x0, 0xf, 0xff, 0xff, 0xd7, 0xff, 0xff, 0xf0,
-    0x0, 0x0, 0xf, 0xff, 0xff, 0xe0, 0x0, 0x0,
-    0xff, 0xff, 0xfd, 0x7f, 0xff, 0xff, 0x0, 0x0,
-    0x0, 0xff, 0xff, 0xfe, 0x0, 0x0, 0xf, 0xff,
-    0xff, 0xd7, 0xff, 0xff, 0xf0, 0x0, 0x0, 0xf,
-    0xff, 0xff, 0xe0, 0x0, 0x0, 0xff, 0xff, 0xfd,
-    0x7f, 0xff, 0xff, 0x0, 0x0, 0x0, 0xff, 0xff,
-    0xfe, 0x0, 0x0, 0xf, 0xff, 0xff, 0xd7, 0xff,
-    0xff, 0xf0, 0x0, 0x0, 0xf, 0xff, 0xff, 0xe0,
-    0x0, 0x0, 0xff, 0xff, 0xfd, 0x7f, 0xff, 0xff,
-    0x0, 0x0, 0x0, 0xff, 0xff, 0xfe, 0x0, 0x0,
-    0xf, 0xff, 0xff, 0xd7, 0xff, 0xff, 0xf0, 0x0,
-    0x0, 0xf, 0xff, 0xff, 0xe0, 0x0, 0x0, 0xff,
-    0xff, 0xfd, 0x7f, 0xff, 0xff, 0x0, 0x0, 0x0,
-    0xff, 0xff, 0xfe, 0x0, 0x0, 0xf, 0xff, 0xff,
-    0xd7, 0xff, 0xff, 0xf0, 0x0, 0x0, 0xf, 0xff,
-    0xff, 0xe0, 0x0, 0x0, 0xff, 0xff, 0xfd, 0x7f,
-    0xff, 0xff, 0x0, 0x0, 0x0, 0xff, 0xff, 0xfe,
-    0x0, 0x0, 0xf, 0xff, 0xff, 0xd7, 0xff, 0xff,
-    0xf0, 0x0, 0x0, 0xf, 0xff, 0xff, 0xe0, 0x0,
-    0x0, 0xff, 0xff, 0xfd,
-
-    /* U+006E "n" */
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x7, 0xff, 0xff, 0xf0, 0x0, 0x6, 0xff,
-    0xf9, 0x0, 0x0, 0x7f, 0xff, 0xff, 0x0, 0x1f,
-    0xff, 0xff, 0xfd, 0x0, 0x7, 0xff, 0xff, 0xf0,
-    0x1f, 0xff, 0xff, 0xff, 0xfc, 0x0, 0x7f, 0xff,
-    0xff, 0xf, 0xff, 0xff, 0xff, 0xff, 0xf0, 0x7,
-    0xff, 0xff, 0xfb, 0xff, 0xff, 0xff, 0xff, 0xff,
-    0xc0, 0x7f, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
-    0xff, 0xfe, 0x7, 0xff, 0xff, 0xff, 0xff, 0xff,
-    0xff, 0xff, 0xff, 0xf0, 0x7f, 0xff, 0xff, 0xff,
-    0xff, 0xff, 0xff, 0xff, 0xff, 0x47, 0xff, 0xff,
-    0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xf8, 0x7f,
-    0xff, 0xff, 0xff, 0x90, 0xb, 0xff, 0xff, 0xff,
-    0xc7, 0xff, 0xff, 0xff, 0x80, 0x0, 0xf, 0xff,
-    0xff, 0xfc, 0x7f, 0xff, 0xff, 0xd0, 0x0, 0x0,
-    0x3f, 0xff, 0xff, 0xc7, 0xff, 0xff, 0xf0, 0x0,
-    0x0, 0x2, 0xff, 0xff, 0xfc, 0x7f, 0xff, 0xff,
-    0x0, 0x0, 0x0, 0x1f, 0xff, 0xff, 0xc7, 0xff,
-    0xff, 0xf0, 0x0, 0x0, 0x1, 0xff, 0xff, 0xfc,
-    0x7f, 0xff, 0xff, 0x0, 0x0, 0x0, 0x1f, 0xff,
-    0xff, 0xc7, 0xff, 0xff, 0xf0, 0x0, 0x0, 0x1,
-    0xff, 0xff, 0xfc, 0x7f, 0xff, 0xff, 0x0, 0x0,
-    0x0, 0x1f, 0xff, 0xff, 0xc7, 0xff, 0xff, 0xf0,
-    0x0, 0x0, 0x1, 0xff, 0xff, 0xfc, 0x7f, 0xff,
-    0xff, 0x0, 0x0, 0x0, 0x1f, 0xff, 0xff, 0xc7,
-    0xff, 0xff, 0xf0, 0x0, 0x0, 0x1, 0xff, 0xff,
-    0xfc, 0x7f, 0xff, 0xff, 0x0, 0x0, 0x0, 0x1f,
-    0xff, 0xff, 0xc7, 0xff, 0xff, 0xf0, 0x0, 0x0,
-    0x1, 0xff, 0xff, 0xfc, 0x7f, 0xff, 0xff, 0x0,
-    0x0, 0x0, 0x1f, 0xff, 0xff, 0xc7, 0xff, 0xff,
-    0xf0, 0x0, 0x0, 0x1, 0xff, 0xff, 0xfc, 0x7f,
-    0xff, 0xff, 0x0, 0x0, 0x0, 0x1f, 0xff, 0xff,
-    0xc7, 0xff, 0xff, 0xf0, 0x0, 0x0, 0x1, 0xff,
-    0xff, 0xfc, 0x7f, 0xff, 0xff, 0x0, 0x0, 0x0,
-    0x1f, 0xff, 0xff, 0xc7, 0xff, 0xff, 0xf0, 0x0,
-    0x0, 0x1, 0xff, 0xff, 0xfc, 0x7f, 0xff, 0xff,
-    0x0, 0x0, 0x0, 0x1f, 0xff, 0xff, 0xc7, 0xff,
-    0xff, 0xf0, 0x0, 0x0, 0x1, 0xff, 0xff, 0xfc,
-    0x7f, 0xff, 0xff, 0x0, 0x0, 0x0, 0x1f, 0xff,
-    0xff, 0xc7, 0xff, 0xff, 0xf0, 0x0, 0x0, 0x1,
-    0xff, 0xff, 0xfc, 0x7f, 0xff, 0xff, 0x0, 0x0,
-    0x0, 0x1f, 0xff, 0xff, 0xc7, 0xff, 0xff, 0xf0,
-    0x0, 0x0, 0x1, 0xff, 0xff, 0xfc, 0x7f, 0xff,
-    0xff, 0x0, 0x0, 0x0, 0x1f, 0xff, 0xff, 0xc7,
-    0xff, 0xff, 0xf0, 0x0, 0x0, 0x1, 0xff, 0xff,
-    0xfc, 0x7f, 0xff, 0xff, 0x0, 0x0, 0x0, 0x1f,
-    0xff, 0xff, 0xc7, 0xff, 0xff, 0xf0, 0x0, 0x0,
-    0x1, 0xff, 0xff, 0xfc,
-
-    /* U+006F "o" */
-    0x0, 0x0, 0x0, 0x6, 0xbf, 0xff, 0xa4, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x7f, 0xff, 0xff,
-    0xff, 0xf4, 0x0, 0x0, 0x0, 0x0, 0x1, 0xff,
-    0xff, 0xff, 0xff, 0xff, 0xe0, 0x0, 0x0, 0x0,
-    0x3, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0x40,
-    0x0, 0x0, 0x7, 0xff, 0xff, 0xff, 0xff, 0xff,
-    0xff, 0xf8, 0x0, 0x0, 0xb, 0xff, 0xff, 0xff,
-    0xff, 0xff, 0xff, 0xff, 0x80, 0x0, 0x7, 0xff,
-    0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xf8, 0x0,
-    0x7, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
-    0xff, 0x40, 0x3, 0xff, 0xff, 0xff, 0xf9, 0x5b,
-    0xff, 0xff, 0xff, 0xf0, 0x1, 0xff, 0xff, 0xff,
-    0xd0, 0x0, 0x1f, 0xff, 0xff, 0xfe, 0x0, 0xff,
-    0xff, 0xff, 0xc0, 0x0, 0x0, 0xbf, 0xff, 0xff,
-    0xc0, 0x7f, 0xff, 0xff, 0xc0, 0x0, 0x0, 0xf,
-    0xff, 0xff, 0xf8, 0x2f, 0xff, 0xff, 0xd0, 0x0,
-    0x0, 0x0, 0xff, 0xff, 0xff, 0xf, 0xff, 0xff,
-    0xf0, 0x0, 0x0, 0x0, 0x2f, 0xff, 0xff, 0xc3,
-    0xff, 0xff, 0xf4, 0x0, 0x0, 0x0, 0x3, 0xff,
-    0xff, 0xf5, 0xff, 0xff, 0xfc, 0x0, 0x0, 0x0,
-    0x0, 0xff, 0xff, 0xfe, 0xbf, 0xff, 0xff, 0x0,
-    0x0, 0x0, 0x0, 0x2f, 0xff, 0xff, 0xaf, 0xff,
-    0xff, 0x80, 0x0, 0x0, 0x0, 0xb, 0xff, 0xff,
-    0xfb, 0xff, 0xff, 0xe0, 0x0, 0x0, 0x0, 0x1,
-    0xff, 0xff, 0xff, 0xff, 0xff, 0xf8, 0x0, 0x0,
-    0x0, 0x0, 0x7f, 0xff, 0xff, 0xff, 0xff, 0xfe,
-    0x0, 0x0, 0x0, 0x0, 0x1f, 0xff, 0xff, 0xef,
-    0xff, 0xff, 0x80, 0x0, 0x0, 0x0, 0x7, 0xff,
-    0xff, 0xfb, 0xff, 0xff, 0xe0, 0x0, 0x0, 0x0,
-    0x2, 0xff, 0xff, 0xfe, 0xff, 0xff, 0xfc, 0x0,
-    0x0, 0x0, 0x0, 0xbf, 0xff, 0xfe, 0x7f, 0xff,
-    0xff, 0x0, 0x0, 0x0, 0x0, 0x3f, 0xff, 0xff,
-    0x9f, 0xff, 0xff, 0xd0, 0x0, 0x0, 0x0, 0xf,
-    0xff, 0xff, 0xd3, 0xff, 0xff, 0xf8, 0x0, 0x0,
-    0x0, 0x7, 0xff, 0xff, 0xf0, 0xbf, 0xff, 0xff,
-    0x0, 0x0, 0x0, 0x3, 0xff, 0xff, 0xfc, 0x1f,
-    0xff, 0xff, 0xe0, 0x0, 0x0, 0x1, 0xff, 0xff,
-    0xfe, 0x3, 0xff, 0xff, 0xfd, 0x0, 0x0, 0x0,
-    0xff, 0xff, 0xff, 0x0, 0xbf, 0xff, 0xff, 0xd0,
-    0x0, 0x0, 0xff, 0xff, 0xff, 0x80, 0xf, 0xff,
-    0xff, 0xfe, 0x0, 0x1, 0xff, 0xff, 0xff, 0xc0,
-    0x2, 0xff, 0xff, 0xff, 0xfa, 0x5b, 0xff, 0xff,
-    0xff, 0xe0, 0x0, 0x3f, 0xff, 0xff, 0xff, 0xff,
-    0xff, 0xff, 0xff, 0xf0, 0x0, 0x3, 0xff, 0xff,
-    0xff, 0xff, 0xff, 0xff, 0xff, 0xf0, 0x0, 0x0,
-    0x3f, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xf4,
-    0x0, 0x0, 0x3, 0xff, 0xff, 0xff, 0xff, 0xff,
-    0xff, 0xf0, 0x0, 0x0, 0x0, 0x2f, 0xff, 0xff,
-    0xff, 0xff, 0xff, 0xe0, 0x0, 0x0, 0x0, 0x0,
-    0xbf, 0xff, 0xff, 0xff, 0xff, 0xd0, 0x0, 0x0,
-    0x0, 0x0, 0x2, 0xff, 0xff, 0xff, 0xfe, 0x40,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x1, 0xaf, 0xff,
-    0xa0, 0x0, 0x0, 0x0, 0x0,
-
-    /* U+0070 "p" */
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x1, 0x40, 0x0,
-    0x0, 0x0, 0x0, 0xaa, 0xaa, 0xa8, 0x0, 0x2f,
-    0xff, 0xfd, 0x0, 0x0, 0x0, 0x1f, 0xff, 0xff,
-    0xc0, 0x3f, 0xff, 0xff, 0xff, 0x0, 0x0, 0x1,
-    0xff, 0xff, 0xfc, 0x2f, 0xff, 0xff, 0xff, 0xfe,
-    0x0, 0x0, 0x1f, 0xff, 0xff, 0xdf, 0xff, 0xff,
-    0xff, 0xff, 0xfc, 0x0, 0x1, 0xff, 0xff, 0xff,
-    0xff, 0xff, 0xff, 0xff, 0xff, 0xf0, 0x0, 0x1f,
-    0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
-    0xc0, 0x1, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
-    0xff, 0xff, 0xfe, 0x0, 0x1f, 0xff, 0xff, 0xff,
-    0xff, 0xff, 0xff, 0xff, 0xff, 0xf4, 0x1, 0xff,
-    0xff, 0xff, 0xfe, 0x40, 0x1f, 0xff, 0xff, 0xff,
-    0xc0, 0x1f, 0xff, 0xff, 0xff, 0x40, 0x0, 0x1f,
-    0xff, 0xff, 0xfe, 0x1, 0xff, 0xff, 0xff, 0xc0,
-    0x0, 0x0, 0x3f, 0xff, 0xff, 0xf0, 0x1f, 0xff,
-    0xff, 0xf0, 0x0, 0x0, 0x0, 0xff, 0xff, 0xff,
-    0x41, 0xff, 0xff, 0xfd, 0x0, 0x0, 0x0, 0x7,
-    0xff, 0xff, 0xf8, 0x1f, 0xff, 0xff, 0xc0, 0x0,
-    0x0, 0x0, 0x3f, 0xff, 0xff, 0xc1, 0xff, 0xff,
-    0xfc, 0x0, 0x0, 0x0, 0x1, 0xff, 0xff, 0xfc,
-    0x1f, 0xff, 0xff, 0xc0, 0x0, 0x0, 0x0, 0xf,
-    0xff, 0xff, 0xd1, 0xff, 0xff, 0xfc, 0x0, 0x0,
-    0x0, 0x0, 0xbf, 0xff, 0xfe, 0x1f, 0xff, 0xff,
-    0xc0, 0x0, 0x0, 0x0, 0x7, 0xff, 0xff, 0xe1,
-    0xff, 0xff, 0xfc, 0x0, 0x0, 0x0, 0x0, 0x7f,
-    0xff, 0xfe, 0x1f, 0xff, 0xff, 0xc0, 0x0, 0x0,
-    0x0, 0x7, 0xff, 0xff, 0xe1, 0xff, 0xff, 0xfc,
-    0x0, 0x0, 0x0, 0x0, 0x7f, 0xff, 0xfe, 0x1f,
-    0xff, 0xff, 0xc0, 0x0, 0x0, 0x0, 0x7, 0xff,
-    0xff, 0xe1, 0xff, 0xff, 0xfc, 0x0, 0x0, 0x0,
-    0x0, 0x7f, 0xff, 0xfe, 0x1f, 0xff, 0xff, 0xc0,
-    0x0, 0x0, 0x0, 0xb, 0xff, 0xff, 0xe1, 0xff,
-    0xff, 0xfc, 0x0, 0x0, 0x0, 0x0, 0xff, 0xff,
-    0xfd, 0x1f, 0xff, 0xff, 0xc0, 0x0, 0x0, 0x0,
-    0x1f, 0xff, 0xff, 0xc1, 0xff, 0xff, 0xfc, 0x0,
-    0x0, 0x0, 0x3, 0xff, 0xff, 0xfc, 0x1f, 0xff,
-    0xff, 0xd0, 0x0, 0x0, 0x0, 0x7f, 0xff, 0xff,
-    0x81, 0xff, 0xff, 0xff, 0x0, 0x0, 0x0, 0xf,
-    0xff, 0xff, 0xf4, 0x1f, 0xff, 0xff, 0xfc, 0x0,
-    0x0, 0x3, 0xff, 0xff, 0xff, 0x1, 0xff, 0xff,
-    0xff, 0xf4, 0x0, 0x1, 0xff, 0xff, 0xff, 0xe0,
-    0x1f, 0xff, 0xff, 0xff, 0xe4, 0x1, 0xff, 0xff,
-    0xff, 0xfc, 0x1, 0xff, 0xff, 0xff, 0xff, 0xff,
-    0xff, 0xff, 0xff, 0xff, 0x80, 0x1f, 0xff, 0xff,
-    0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xf0, 0x1,
-    0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
-    0xfc, 0x0, 0x1f, 0xff, 0xff, 0xff, 0xff, 0xff,
-    0xff, 0xff, 0xff, 0x0, 0x1, 0xff, 0xff, 0xff,
-    0xff, 0xff, 0xff, 0xff, 0xff, 0xc0, 0x0, 0x1f,
-    0xff, 0xff, 0xcb, 0xff, 0xff, 0xff, 0xff, 0xe0,
-    0x0, 0x1, 0xff, 0xff, 0xfc, 0xb, 0xff, 0xff,
-    0xff, 0xe0, 0x0, 0x0, 0x1f, 0xff, 0xff, 0xc0,
-    0x6, 0xff, 0xff, 0x90, 0x0, 0x0, 0x1, 0xff,
-    0xff, 0xfc, 0x0, 0x0, 0x14, 0x0, 0x0, 0x0,
-    0x0, 0x1f, 0xff, 0xff, 0xc0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x1, 0xff, 0xff, 0xfc, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x1f, 0xff,
-    0xff, 0xc0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x1, 0xff, 0xff, 0xfc, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x1f, 0xff, 0xff, 0xc0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x2, 0xff, 0xff,
-    0xfc, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x2f, 0xff, 0xff, 0xc0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x2, 0xff, 0xff, 0xfc, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x2f, 0xff, 0xff,
-    0x80, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x3,
-    0xff, 0xff, 0xf8, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x3f, 0xff, 0xff, 0x40, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x3, 0xff, 0xff, 0xf4,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x3f,
-    0xff, 0xff, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x7, 0xff, 0xff, 0xf0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0xbf, 0xff, 0xff, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-
-    /* U+0071 "q" */
-    0x0, 0x0, 0x0, 0x0, 0x14, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0xb, 0xff, 0xff,
-    0x80, 0x2, 0xaa, 0xaa, 0xa0, 0x0, 0x0, 0xf,
-    0xff, 0xff, 0xff, 0x80, 0x3f, 0xff, 0xff, 0x40,
-    0x0, 0xb, 0xff, 0xff, 0xff, 0xff, 0x83, 0xff,
-    0xff, 0xf4, 0x0, 0x3, 0xff, 0xff, 0xff, 0xff,
-    0xff, 0x7f, 0xff, 0xff, 0x40, 0x0, 0xff, 0xff,
-    0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xf4, 0x0,
-    0x3f, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
-    0xff, 0x40, 0xf, 0xff, 0xff, 0xff, 0xff, 0xff,
-    0xff, 0xff, 0xff, 0xf4, 0x2, 0xff, 0xff, 0xff,
-    0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0x40, 0x3f,
-    0xff, 0xff, 0xff, 0x40, 0x1f, 0xff, 0xff, 0xff,
-    0xf4, 0xb, 0xff, 0xff, 0xff, 0x40, 0x0, 0x1f,
-    0xff, 0xff, 0xff, 0x40, 0xff, 0xff, 0xff, 0xc0,
-    0x0, 0x0, 0x3f, 0xff, 0xff, 0xf4, 0x1f, 0xff,
-    0xff, 0xf0, 0x0, 0x0, 0x0, 0xff, 0xff, 0xff,
-    0x43, 0xff, 0xff, 0xfd, 0x0, 0x0, 0x0, 0x7,
-    0xff, 0xff, 0xf4, 0x3f, 0xff, 0xff, 0x80, 0x0,
-    0x0, 0x0, 0x3f, 0xff, 0xff, 0x43, 0xff, 0xff,
-    0xf4, 0x0, 0x0, 0x0, 0x3, 0xff, 0xff, 0xf4,
-    0x7f, 0xff, 0xff, 0x0, 0x0, 0x0, 0x0, 0x3f,
-    0xff, 0xff, 0x4b, 0xff, 0xff, 0xe0, 0x0, 0x0,
-    0x0, 0x3, 0xff, 0xff, 0xf4, 0xbf, 0xff, 0xfd,
-    0x0, 0x0, 0x0, 0x0, 0x3f, 0xff, 0xff, 0x4b,
-    0xff, 0xff, 0xd0, 0x0, 0x0, 0x0, 0x3, 0xff,
-    0xff, 0xf4, 0xff, 0xff, 0xfc, 0x0, 0x0, 0x0,
-    0x0, 0x3f, 0xff, 0xff, 0x4f, 0xff, 0xff, 0xc0,
-    0x0, 0x0, 0x0, 0x3, 0xff, 0xff, 0xf4, 0xbf,
-    0xff, 0xfd, 0x0, 0x0, 0x0, 0x0, 0x3f, 0xff,
-    0xff, 0x4b, 0xff, 0xff, 0xd0, 0x0, 0x0, 0x0,
-    0x3, 0xff, 0xff, 0xf4, 0xbf, 0xff, 0xfe, 0x0,
-    0x0, 0x0, 0x0, 0x3f, 0xff, 0xff, 0x47, 0xff,
-    0xff, 0xf0, 0x0, 0x0, 0x0, 0x3, 0xff, 0xff,
-    0xf4, 0x7f, 0xff, 0xff, 0x40, 0x0, 0x0, 0x0,
-    0x3f, 0xff, 0xff, 0x43, 0xff, 0xff, 0xf8, 0x0,
-    0x0, 0x0, 0x3, 0xff, 0xff, 0xf4, 0x3f, 0xff,
-    0xff, 0xd0, 0x0, 0x0, 0x0, 0x7f, 0xff, 0xff,
-    0x42, 0xff, 0xff, 0xff, 0x0, 0x0, 0x0, 0xf,
-    0xff, 0xff, 0xf4, 0xf, 0xff, 0xff, 0xfc, 0x0,
-    0x0, 0x3, 0xff, 0xff, 0xff, 0x40, 0xbf, 0xff,
-    0xff, 0xf4, 0x0, 0x1, 0xff, 0xff, 0xff, 0xf4,
-    0x3, 0xff, 0xff, 0xff, 0xf4, 0x1, 0xff, 0xff,
-    0xff, 0xff, 0x40, 0x2f, 0xff, 0xff, 0xff, 0xff,
-    0xff, 0xff, 0xff, 0xff, 0xf4, 0x0, 0xff, 0xff,
-    0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0x40,
-    0x3, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
-    0xff, 0xf4, 0x0, 0xf, 0xff, 0xff, 0xff, 0xff,
-    0xff, 0xff, 0xff, 0xff, 0x40, 0x0, 0x3f, 0xff,
-    0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xf4, 0x0,
-    0x0, 0xbf, 0xff, 0xff, 0xff, 0xfd, 0x3f, 0xff,
-    0xff, 0x40, 0x0, 0x0, 0xff, 0xff, 0xff, 0xfe,
-    0x3, 0xff, 0xff, 0xf4, 0x0, 0x0, 0x0, 0x7f,
-    0xff, 0xf9, 0x0, 0x3f, 0xff, 0xff, 0x40, 0x0,
-    0x0, 0x0, 0x1, 0x40, 0x0, 0x3, 0xff, 0xff,
-    0xf4, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x3f, 0xff, 0xff, 0x40, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x3, 0xff, 0xff, 0xf4, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x3f, 0xff, 0xff,
-    0x40, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x3,
-    0xff, 0xff, 0xf4, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x3f, 0xff, 0xff, 0x40, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x3, 0xff, 0xff, 0xf4,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x3f,
-    0xff, 0xff, 0x80, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x3, 0xff, 0xff, 0xf8, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x3f, 0xff, 0xff, 0x80,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x2, 0xff,
-    0xff, 0xfc, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x2f, 0xff, 0xff, 0xc0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x1, 0xff, 0xff, 0xfc, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x1f, 0xff,
-    0xff, 0xc0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0xff, 0xff, 0xfd, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0xf, 0xff, 0xff, 0xe0,
-
-    /* U+0072 "r" */
-    0x7f, 0xff, 0xff, 0x0, 0x6, 0xff, 0x87, 0xff,
-    0xff, 0xf0, 0xf, 0xff, 0xfc, 0x7f, 0xff, 0xff,
-    0xb, 0xff, 0xff, 0xc7, 0xff, 0xff, 0xf7, 0xff,
-    0xff, 0xfc, 0x7f, 0xff, 0xff, 0xff, 0xff, 0xff,
-    0xc7, 0xff, 0xff, 0xff, 0xff, 0xff, 0xfc, 0x7f,
-    0xff, 0xff, 0xff, 0xff, 0xff, 0xc7, 0xff, 0xff,
-    0xff, 0xff, 0xff, 0xfc, 0x7f, 0xff, 0xff, 0xff,
-    0xff, 0xff, 0xc7, 0xff, 0xff, 0xff, 0xf9, 0x0,
-    0x4, 0x7f, 0xff, 0xff, 0xf8, 0x0, 0x0, 0x7,
-    0xff, 0xff, 0xfd, 0x0, 0x0, 0x0, 0x7f, 0xff,
-    0xff, 0x40, 0x0, 0x0, 0x7, 0xff, 0xff, 0xf0,
-    0x0, 0x0, 0x0, 0x7f, 0xff, 0xff, 0x0, 0x0,
-    0x0, 0x7, 0xff, 0xff, 0xf0, 0x0, 0x0, 0x0,
-    0x7f, 0xff, 0xff, 0x0, 0x0, 0x0, 0x7, 0xff,
-    0xff, 0xf0, 0x0, 0x0, 0x0, 0x7f, 0xff, 0xff,
-    0x0, 0x0, 0x0, 0x7, 0xff, 0xff, 0xf0, 0x0,
-    0x0, 0x0, 0x7f, 0xff, 0xff, 0x0, 0x0, 0x0,
-    0x7, 0xff, 0xff, 0xf0, 0x0, 0x0, 0x0, 0x7f,
-    0xff, 0xff, 0x0, 0x0, 0x0, 0x7, 0xff, 0xff,
-    0xf0, 0x0, 0x0, 0x0, 0x7f, 0xff, 0xff, 0x0,
-    0x0, 0x0, 0x7, 0xff, 0xff, 0xf0, 0x0, 0x0,
-    0x0, 0x7f, 0xff, 0xff, 0x0, 0x0, 0x0, 0x7,
-    0xff, 0xff, 0xf0, 0x0, 0x0, 0x0, 0x7f, 0xff,
-    0xff, 0x0, 0x0, 0x0, 0x7, 0xff, 0xff, 0xf0,
-    0x0, 0x0, 0x0, 0x7f, 0xff, 0xff, 0x0, 0x0,
-    0x0, 0x7, 0xff, 0xff, 0xf0, 0x0, 0x0, 0x0,
-    0x7f, 0xff, 0xff, 0x0, 0x0, 0x0, 0x7, 0xff,
-    0xff, 0xf0, 0x0, 0x0, 0x0, 0x7f, 0xff, 0xff,
-    0x0, 0x0, 0x0, 0x7, 0xff, 0xff, 0xf0, 0x0,
-    0x0, 0x0, 0x7f, 0xff, 0xff, 0x0, 0x0, 0x0,
-    0x7, 0xff, 0xff, 0xf0, 0x0, 0x0, 0x0, 0x7f,
-    0xff, 0xff, 0x0, 0x0, 0x0, 0x0,
-
-    /* U+0073 "s" */
-    0x0, 0x0, 0x6, 0xff, 0xff, 0xa4, 0x0, 0x0,
-    0x0, 0x6, 0xff, 0xff, 0xff, 0xff, 0x90, 0x0,
-    0x0, 0xff, 0xff, 0xff, 0xff, 0xff, 0xf0, 0x0,
-    0x1f, 0xff, 0xff, 0xff, 0xff, 0xff, 0xc0, 0x2,
-    0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0x0, 0x1f,
-    0xff, 0xff, 0xff, 0xff, 0xff, 0xfc, 0x0, 0xff,
-    0xff, 0xff, 0xff, 0xff, 0xff, 0xf0, 0xb, 0xff,
-    0xff, 0xff, 0xff, 0xff, 0xff, 0xc0, 0x3f, 0xff,
-    0xff, 0xfe, 0xab, 0xff, 0xff, 0x0, 0xff, 0xff,
-    0xff, 0x0, 0x0, 0x6f, 0xfc, 0x7, 0xff, 0xff,
-    0xf0, 0x0, 0x0, 0x2, 0xf0, 0x1f, 0xff, 0xff,
-    0xc0, 0x0, 0x0, 0x0, 0x40, 0x7f, 0xff, 0xff,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0xff, 0xff, 0xfe,
-    0x0, 0x0, 0x0, 0x0, 0x3, 0xff, 0xff, 0xff,
-    0x0, 0x0, 0x0, 0x0, 0xb, 0xff, 0xff, 0xff,
-    0xd0, 0x0, 0x0, 0x0, 0x1f, 0xff, 0xff, 0xff,
-    0xf9, 0x0, 0x0, 0x0, 0x2f, 0xff, 0xff, 0xff,
-    0xff, 0x80, 0x0, 0x0, 0x3f, 0xff, 0xff, 0xff,
-    0xff, 0xe0, 0x0, 0x0, 0x2f, 0xff, 0xff, 0xff,
-    0xff, 0xf8, 0x0, 0x0, 0x1f, 0xff, 0xff, 0xff,
-    0xff, 0xfc, 0x0, 0x0, 0xb, 0xff, 0xff, 0xff,
-    0xff, 0xfc, 0x0, 0x0, 0x1, 0xff, 0xff, 0xff,
-    0xff, 0xfc, 0x0, 0x0, 0x0, 0x2f, 0xff, 0xff,
-    0xff, 0xf8, 0x0, 0x0, 0x0, 0x1, 0xff, 0xff,
-    0xff, 0xf0, 0x0, 0x0, 0x0, 0x0, 0x7f, 0xff,
-    0xff, 0xd0, 0x0, 0x0, 0x0, 0x0, 0x7f, 0xff,
-    0xff, 0x94, 0x0, 0x0, 0x0, 0x0, 0xff, 0xff,
-    0xfe, 0x78, 0x0, 0x0, 0x0, 0x2, 0xff, 0xff,
-    0xfd, 0xfe, 0x40, 0x0, 0x0, 0xf, 0xff, 0xff,
-    0xf7, 0xff, 0xd0, 0x0, 0x0, 0x7f, 0xff, 0xff,
-    0x9f, 0xff, 0xfe, 0x40, 0x1b, 0xff, 0xff, 0xfe,
-    0x7f, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xf1,
-    0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xc7,
-    0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xfd, 0x1f,
-    0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xf0, 0x7f,
-    0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0x1, 0xff,
-    0xff, 0xff, 0xff, 0xff, 0xff, 0xf0, 0x0, 0x7f,
-    0xff, 0xff, 0xff, 0xff, 0xfe, 0x0, 0x0, 0x6,
-    0xff, 0xff, 0xff, 0xff, 0xd0, 0x0, 0x0, 0x0,
-    0x16, 0xbf, 0xff, 0x90, 0x0, 0x0,
-
-    /* U+0074 "t" */
-    0x0, 0x1f, 0xff, 0xff, 0x40, 0x0, 0x0, 0x1f,
-    0xff, 0xff, 0x40, 0x0, 0x0, 0x1f, 0xff, 0xff,
-    0x40, 0x0, 0x0, 0x1f, 0xff, 0xff, 0x40, 0x0,
-    0x0, 0x1f, 0xff, 0xff, 0x40, 0x0, 0x0, 0x1f,
-    0xff, 0xff, 0x40, 0x0, 0x0, 0x1f, 0xff, 0xff,
-    0x40, 0x0, 0x0, 0x1f, 0xff, 0xff, 0x40, 0x0,
-    0x0, 0x1f, 0xff, 0xff, 0x40, 0x0, 0x0, 0x1f,
-    0xff, 0xff, 0x40, 0x0, 0x0, 0x1f, 0xff, 0xff,
-    0x40, 0x0, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
-    0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
-    0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
-    0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
-    0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
-    0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
-    0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
-    0x0, 0x1f, 0xff, 0xff, 0x40, 0x0, 0x0, 0x1f,
-    0xff, 0xff, 0x40, 0x0, 0x0, 0x1f, 0xff, 0xff,
-    0x40, 0x0, 0x0, 0x1f, 0xff, 0xff, 0x40, 0x0,
-    0x0, 0x1f, 0xff, 0xff, 0x40, 0x0, 0x0, 0x1f,
-    0xff, 0xff, 0x40, 0x0, 0x0, 0x1f, 0xff, 0xff,
-    0x40, 0x0, 0x0, 0x1f, 0xff, 0xff, 0x40, 0x0,
-    0x0, 0x1f, 0xff, 0xff, 0x40, 0x0, 0x0, 0x1f,
-    0xff, 0xff, 0x40, 0x0, 0x0, 0x1f, 0xff, 0xff,
-    0x40, 0x0, 0x0, 0x1f, 0xff, 0xff, 0x40, 0x0,
-    0x0, 0x1f, 0xff, 0xff, 0x40, 0x0, 0x0, 0x1f,
-    0xff, 0xff, 0x40, 0x0, 0x0, 0x1f, 0xff, 0xff,
-    0x40, 0x0, 0x0, 0x1f, 0xff, 0xff, 0x40, 0x0,
-    0x0, 0x1f, 0xff, 0xff, 0x40, 0x0, 0x0, 0x1f,
-    0xff, 0xff, 0x40, 0x0, 0x0, 0x1f, 0xff, 0xff,
-    0x40, 0x0, 0x0, 0x1f, 0xff, 0xff, 0x80, 0x0,
-    0x0, 0x1f, 0xff, 0xff, 0xc0, 0x0, 0x0, 0x1f,
-    0xff, 0xff, 0xf0, 0x0, 0x0, 0xf, 0xff, 0xff,
-    0xff, 0xfe, 0x0, 0xf, 0xff, 0xff, 0xff, 0xfe,
-    0x0, 0xb, 0xff, 0xff, 0xff, 0xfe, 0x0, 0x7,
-    0xff, 0xff, 0xff, 0xfe, 0x0, 0x3, 0xff, 0xff,
-    0xff, 0xfe, 0x0, 0x1, 0xff, 0xff, 0xff, 0xfe,
-    0x0, 0x0, 0xbf, 0xff, 0xff, 0xfe, 0x0, 0x0,
-    0x1f, 0xff, 0xff, 0xfe, 0x0, 0x0, 0x1, 0xaf,
-    0xff, 0xf9,
-
-    /* U+0075 "u" */
-    0x7f, 0xff, 0xff, 0x0, 0x0, 0x0, 0x1f, 0xff,
-    0xff, 0xc1, 0xff, 0xff, 0xfc, 0x0, 0x0, 0x0,
-    0x7f, 0xff, 0xff, 0x7, 0xff, 0xff, 0xf0, 0x0,
-    0x0, 0x1, 0xff, 0xff, 0xfc, 0x1f, 0xff, 0xff,
-    0xc0, 0x0, 0x0, 0x7, 0xff, 0xff, 0xf0, 0x7f,
-    0xff, 0xff, 0x0, 0x0, 0x0, 0x1f, 0xff, 0xff,
-    0xc1, 0xff, 0xff, 0xfc, 0x0, 0x0, 0x0, 0x7f,
-    0xff, 0xff, 0x7, 0xff, 0xff, 0xf0, 0x0, 0x0,
-    0x1, 0xff, 0xff, 0xfc, 0x1f, 0xff, 0xff, 0xc0,
-    0x0, 0x0, 0x7, 0xff, 0xff, 0xf0, 0x7f, 0xff,
-    0xff, 0x0, 0x0, 0x0, 0x1f, 0xff, 0xff, 0xc1,
-    0xff, 0xff, 0xfc, 0x0, 0x0, 0x0, 0x7f, 0xff,
-    0xff, 0x7, 0xff, 0xff, 0xf0, 0x0, 0x0, 0x1,
-    0xff, 0xff, 0xfc, 0x1f, 0xff, 0xff, 0xc0, 0x0,
-    0x0, 0x7, 0xff, 0xff, 0xf0, 0x7f, 0xff, 0xff,
-    0x0, 0x0, 0x0, 0x1f, 0xff, 0xff, 0xc1, 0xff,
-    0xff, 0xfc, 0x0, 0x0, 0x0, 0x7f, 0xff, 0xff,
-    0x7, 0xff, 0xff, 0xf0, 0x0, 0x0, 0x1, 0xff,
-    0xff, 0xfc, 0x1f, 0xff, 0xff, 0xc0, 0x0, 0x0,
-    0x7, 0xff, 0xff, 0xf0, 0x7f, 0xff, 0xff, 0x0,
-    0x0, 0x0, 0x1f, 0xff, 0xff, 0xc1, 0xff, 0xff,
-    0xfc, 0x0, 0x0, 0x0, 0x7f, 0xff, 0xff, 0x7,
-    0xff, 0xff, 0xf0, 0x0, 0x0, 0x1, 0xff, 0xff,
-    0xfc, 0x1f, 0xff, 0xff, 0xc0, 0x0, 0x0, 0x7,
-    0xff, 0xff, 0xf0, 0x7f, 0xff, 0xff, 0x0, 0x0,
-    0x0, 0x1f, 0xff, 0xff, 0xc1, 0xff, 0xff, 0xfc,
-    0x0, 0x0, 0x0, 0x7f, 0xff, 0xff, 0x7, 0xff,
-    0xff, 0xf0, 0x0, 0x0, 0x1, 0xff, 0xff, 0xfc,
-    0x1f, 0xff, 0xff, 0xc0, 0x0, 0x0, 0x7, 0xff,
-    0xff, 0xf0, 0x7f, 0xff, 0xff, 0x0, 0x0, 0x0,
-    0x1f, 0xff, 0xff, 0xc1, 0xff, 0xff, 0xfc, 0x0,
-    0x0, 0x0, 0x7f, 0xff, 0xff, 0x7, 0xff, 0xff,
-    0xf0, 0x0, 0x0, 0x1, 0xff, 0xff, 0xfc, 0x1f,
-    0xff, 0xff, 0xc0, 0x0, 0x0, 0xb, 0xff, 0xff,
-    0xf0, 0x7f, 0xff, 0xff, 0x80, 0x0, 0x0, 0xbf,
-    0xff, 0xff, 0xc1, 0xff, 0xff, 0xff, 0x0, 0x0,
-    0x2f, 0xff, 0xff, 0xff, 0x7, 0xff, 0xff, 0xff,
-    0x80, 0x1b, 0xff, 0xff, 0xff, 0xfc, 0xf, 0xff,
-    0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xf0,
-    0x3f, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
-    0xff, 0xc0, 0x7f, 0xff, 0xff, 0xff, 0xff, 0xff,
-    0xff, 0xff, 0xff, 0x0, 0xff, 0xff, 0xff, 0xff,
-    0xff, 0xff, 0xff, 0xff, 0xfc, 0x1, 0xff, 0xff,
-    0xff, 0xff, 0xff, 0xf2, 0xff, 0xff, 0xf4, 0x1,
-    0xff, 0xff, 0xff, 0xff, 0xfe, 0x7, 0xff, 0xff,
-    0xe0, 0x1, 0xff, 0xff, 0xff, 0xff, 0x80, 0xf,
-    0xff, 0xff, 0xc0, 0x0, 0xbf, 0xff, 0xff, 0xe0,
-    0x0, 0x2f, 0xff, 0xff, 0x0, 0x0, 0x1b, 0xff,
-    0xa0, 0x0, 0x0, 0x0, 0x0, 0x0,
-
-    /* U+0076 "v" */
-    0x7f, 0xff, 0xff, 0x0, 0x0, 0x0, 0x0, 0x3,
-    0xff, 0xff, 0xf4, 0xff, 0xff, 0xfd, 0x0, 0x0,
-    0x0, 0x0, 0x1f, 0xff, 0xff, 0xc3, 0xff, 0xff,
-    0xfc, 0x0, 0x0, 0x0, 0x0, 0xbf, 0xff, 0xff,
-    0xb, 0xff, 0xff, 0xf0, 0x0, 0x0, 0x0, 0x3,
-    0xff, 0xff, 0xf8, 0xf, 0xff, 0xff, 0xd0, 0x0,
-    0x0, 0x0, 0x1f, 0xff, 0xff, 0xc0, 0x3f, 0xff,
-    0xff, 0x80, 0x0, 0x0, 0x0, 0xbf, 0xff, 0xff,
-    0x0, 0xbf, 0xff, 0xff, 0x0, 0x0, 0x0, 0x3,
-    0xff, 0xff, 0xf8, 0x1, 0xff, 0xff, 0xfc, 0x0,
-    0x0, 0x0, 0xf, 0xff, 0xff, 0xd0, 0x3, 0xff,
-    0xff, 0xf4, 0x0, 0x0, 0x0, 0x7f, 0xff, 0xff,
-    0x0, 0xb, 0xff, 0xff, 0xf0, 0x0, 0x0, 0x3,
-    0xff, 0xff, 0xf8, 0x0, 0x1f, 0xff, 0xff, 0xc0,
-    0x0, 0x0, 0xf, 0xff, 0xff, 0xd0, 0x0, 0x3f,
-    0xff, 0xff, 0x40, 0x0, 0x0, 0x7f, 0xff, 0xff,
-    0x0, 0x0, 0xbf, 0xff, 0xfe, 0x0, 0x0, 0x2,
-    0xff, 0xff, 0xf8, 0x0, 0x1, 0xff, 0xff, 0xfc,
-    0x0, 0x0, 0xf, 0xff, 0xff, 0xd0, 0x0, 0x3,
-    0xff, 0xff, 0xf0, 0x0, 0x0, 0x3f, 0xff, 0xff,
-    0x0, 0x0, 0xb, 0xff, 0xff, 0xe0, 0x0, 0x2,
-    0xff, 0xff, 0xf8, 0x0, 0x0, 0x1f, 0xff, 0xff,
-    0xc0, 0x0, 0xf, 0xff, 0xff, 0xd0, 0x0, 0x0,
-    0x3f, 0xff, 0xff, 0x0, 0x0, 0x3f, 0xff, 0xff,
-    0x0, 0x0, 0x0, 0xff, 0xff, 0xfd, 0x0, 0x1,
-    0xff, 0xff, 0xfc, 0x0, 0x0, 0x1, 0xff, 0xff,
-    0xf8, 0x0, 0xb, 0xff, 0xff, 0xd0, 0x0, 0x0,
-    0x3, 0xff, 0xff, 0xf0, 0x0, 0x3f, 0xff, 0xff,
-    0x0, 0x0, 0x0, 0xf, 0xff, 0xff, 0xd0, 0x1,
-    0xff, 0xff, 0xfc, 0x0, 0x0, 0x0, 0x2f, 0xff,
-    0xff, 0x80, 0xb, 0xff, 0xff, 0xe0, 0x0, 0x0,
-    0x0, 0x3f, 0xff, 0xff, 0x0, 0x3f, 0xff, 0xff,
-    0x0, 0x0, 0x0, 0x0, 0xff, 0xff, 0xfc, 0x0,
-    0xff, 0xff, 0xfc, 0x0, 0x0, 0x0, 0x2, 0xff,
-    0xff, 0xf4, 0x7, 0xff, 0xff, 0xe0, 0x0, 0x0,
-    0x0, 0x7, 0xff, 0xff, 0xe0, 0x2f, 0xff, 0xff,
-    0x40, 0x0, 0x0, 0x0, 0xf, 0xff, 0xff, 0xc0,
-    0xff, 0xff, 0xfc, 0x0, 0x0, 0x0, 0x0, 0x2f,
-    0xff, 0xff, 0x47, 0xff, 0xff, 0xe0, 0x0, 0x0,
-    0x0, 0x0, 0x7f, 0xff, 0xfe, 0x2f, 0xff, 0xff,
-    0x40, 0x0, 0x0, 0x0, 0x0, 0xff, 0xff, 0xfc,
-    0xff, 0xff, 0xfc, 0x0, 0x0, 0x0, 0x0, 0x2,
-    0xff, 0xff, 0xf7, 0xff, 0xff, 0xe0, 0x0, 0x0,
-    0x0, 0x0, 0x7, 0xff, 0xff, 0xff, 0xff, 0xff,
-    0x40, 0x0, 0x0, 0x0, 0x0, 0xf, 0xff, 0xff,
-    0xff, 0xff, 0xfc, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x3f, 0xff, 0xff, 0xff, 0xff, 0xe0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x7f, 0xff, 0xff, 0xff, 0xff,
-    0x40, 0x0, 0x0, 0x0, 0x0, 0x0, 0xff, 0xff,
-    0xff, 0xff, 0xfc, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x3, 0xff, 0xff, 0xff, 0xff, 0xf0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x7, 0xff, 0xff, 0xff, 0xff,
-    0x40, 0x0, 0x0, 0x0,
-
-    /* U+0077 "w" */
-    0xff, 0xff, 0xfe, 0x0, 0x0, 0x0, 0x2f, 0xff,
-    0xff, 0x0, 0x0, 0x0, 0xf, 0xff, 0xff, 0xc7,
-    0xff, 0xff, 0xf0, 0x0, 0x0, 0x3, 0xff, 0xff,
-    0xf0, 0x0, 0x0, 0x1, 0xff, 0xff, 0xfc, 0x3f,
-    0xff, 0xff, 0x0, 0x0, 0x0, 0x3f, 0xff, 0xff,
-    0x40, 0x0, 0x0, 0x2f, 0xff, 0xff, 0x83, 0xff,
-    0xff, 0xf4, 0x0, 0x0, 0x3, 0xff, 0xff, 0xf8,
-    0x0, 0x0, 0x3, 0xff, 0xff, 0xf0, 0x2f, 0xff,
-    0xff, 0x80, 0x0, 0x0, 0x7f, 0xff, 0xff, 0xc0,
-    0x0, 0x0, 0x3f, 0xff, 0xff, 0x1, 0xff, 0xff,
-    0xfc, 0x0, 0x0, 0xb, 0xff, 0xff, 0xfc, 0x0,
-    0x0, 0x7, 0xff, 0xff, 0xe0, 0xf, 0xff, 0xff,
-    0xc0, 0x0, 0x0, 0xff, 0xff, 0xff, 0xd0, 0x0,
-    0x0, 0xbf, 0xff, 0xfd, 0x0, 0xbf, 0xff, 0xfd,
-    0x0, 0x0, 0xf, 0xff, 0xff, 0xfe, 0x0, 0x0,
-    0xf, 0xff, 0xff, 0xc0, 0x7, 0xff, 0xff, 0xd0,
-    0x0, 0x1, 0xff, 0xff, 0xff, 0xf0, 0x0, 0x0,
-    0xff, 0xff, 0xfc, 0x0, 0x3f, 0xff, 0xfe, 0x0,
-    0x0, 0x2f, 0xff, 0xff, 0xff, 0x0, 0x0, 0x1f,
-    0xff, 0xff, 0x40, 0x3, 0xff, 0xff, 0xf0, 0x0,
-    0x3, 0xff, 0xff, 0xff, 0xf4, 0x0, 0x2, 0xff,
-    0xff, 0xf0, 0x0, 0x2f, 0xff, 0xff, 0x0, 0x0,
-    0x3f, 0xff, 0xff, 0xff, 0x40, 0x0, 0x3f, 0xff,
-    0xff, 0x0, 0x0, 0xff, 0xff, 0xf4, 0x0, 0x7,
-    0xff, 0xff, 0xff, 0xf8, 0x0, 0x3, 0xff, 0xff,
-    0xe0, 0x0, 0xf, 0xff, 0xff, 0x80, 0x0, 0xbf,
-    0xff, 0xbf, 0xff, 0xc0, 0x0, 0x7f, 0xff, 0xfd,
-    0x0, 0x0, 0xbf, 0xff, 0xfc, 0x0, 0xf, 0xff,
-    0xf3, 0xff, 0xfc, 0x0, 0xb, 0xff, 0xff, 0xc0,
-    0x0, 0x7, 0xff, 0xff, 0xc0, 0x0, 0xff, 0xff,
-    0x2f, 0xff, 0xd0, 0x0, 0xff, 0xff, 0xf8, 0x0,
-    0x0, 0x3f, 0xff, 0xfd, 0x0, 0xf, 0xff, 0xf2,
-    0xff, 0xfe, 0x0, 0xf, 0xff, 0xff, 0x40, 0x0,
-    0x3, 0xff, 0xff, 0xe0, 0x1, 0xff, 0xfe, 0x1f,
-    0xff, 0xf0, 0x1, 0xff, 0xff, 0xf0, 0x0, 0x0,
-    0x1f, 0xff, 0xff, 0x0, 0x2f, 0xff, 0xd0, 0xff,
-    0xff, 0x0, 0x2f, 0xff, 0xff, 0x0, 0x0, 0x0,
-    0xff, 0xff, 0xf0, 0x3, 0xff, 0xfc, 0xf, 0xff,
-    0xf4, 0x3, 0xff, 0xff, 0xe0, 0x0, 0x0, 0xf,
-    0xff, 0xff, 0x40, 0x3f, 0xff, 0xc0, 0xbf, 0xff,
-    0x80, 0x3f, 0xff, 0xfc, 0x0, 0x0, 0x0, 0xbf,
-    0xff, 0xf8, 0x7, 0xff, 0xfc, 0x7, 0xff, 0xfc,
-    0x7, 0xff, 0xff, 0xc0, 0x0, 0x0, 0x7, 0xff,
-    0xff, 0xc0, 0xbf, 0xff, 0x80, 0x7f, 0xff, 0xc0,
-    0xbf, 0xff, 0xf8, 0x0, 0x0, 0x0, 0x3f, 0xff,
-    0xfc, 0xf, 0xff, 0xf4, 0x3, 0xff, 0xfc, 0xf,
-    0xff, 0xff, 0x40, 0x0, 0x0, 0x2, 0xff, 0xff,
-    0xd0, 0xff, 0xff, 0x0, 0x3f, 0xff, 0xd0, 0xff,
-    0xff, 0xf0, 0x0, 0x0, 0x0, 0x1f, 0xff, 0xfe,
-    0x1f, 0xff, 0xf0, 0x2, 0xff, 0xfe, 0xf, 0xff,
-    0xfe, 0x0, 0x0, 0x0, 0x0, 0xff, 0xff, 0xf2,
-    0xff, 0xff, 0x0, 0x1f, 0xff, 0xf1, 0xff, 0xff,
-    0xd0, 0x0, 0x0, 0x0, 0xf, 0xff, 0xff, 0x3f,
-    0xff, 0xe0, 0x0, 0xff, 0xff, 0x2f, 0xff, 0xfc,
-    0x0, 0x0, 0x0, 0x0, 0xbf, 0xff, 0xf7, 0xff,
-    0xfd, 0x0, 0xf, 0xff, 0xf7, 0xff, 0xff, 0xc0,
-    0x0, 0x0, 0x0, 0x3, 0xff, 0xff, 0xff, 0xff,
-    0xc0, 0x0, 0xff, 0xff, 0xff, 0xff, 0xf8, 0x0,
-    0x0, 0x0, 0x0, 0x3f, 0xff, 0xff, 0xff, 0xfc,
-    0x0, 0xb, 0xff, 0xff, 0xff, 0xff, 0x40, 0x0,
-    0x0, 0x0, 0x2, 0xff, 0xff, 0xff, 0xff, 0x80,
-    0x0, 0x7f, 0xff, 0xff, 0xff, 0xf0, 0x0, 0x0,
-    0x0, 0x0, 0x1f, 0xff, 0xff, 0xff, 0xf8, 0x0,
-    0x3, 0xff, 0xff, 0xff, 0xfe, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0xff, 0xff, 0xff, 0xff, 0x40, 0x0,
-    0x3f, 0xff, 0xff, 0xff, 0xd0, 0x0, 0x0, 0x0,
-    0x0, 0xb, 0xff, 0xff, 0xff, 0xf0, 0x0, 0x3,
-    0xff, 0xff, 0xff, 0xfc, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x7f, 0xff, 0xff, 0xff, 0x0, 0x0, 0x2f,
-    0xff, 0xff, 0xff, 0xc0, 0x0, 0x0, 0x0, 0x0,
-    0x3, 0xff, 0xff, 0xff, 0xe0, 0x0, 0x1, 0xff,
-    0xff, 0xff, 0xf8, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x3f, 0xff, 0xff, 0xfe, 0x0, 0x0, 0xf, 0xff,
-    0xff, 0xff, 0x0, 0x0, 0x0, 0x0, 0x0, 0x2,
-    0xff, 0xff, 0xff, 0xd0, 0x0, 0x0, 0xff, 0xff,
-    0xff, 0xf0, 0x0, 0x0, 0x0,
-
-    /* U+0078 "x" */
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x3, 0xff, 0xff, 0xf4, 0x0, 0x0,
-    0x0, 0x3, 0xff, 0xff, 0xfc, 0x1f, 0xff, 0xff,
-    0xc0, 0x0, 0x0, 0x0, 0xbf, 0xff, 0xff, 0x0,
-    0xbf, 0xff, 0xff, 0x0, 0x0, 0x0, 0xf, 0xff,
-    0xff, 0xd0, 0x3, 0xff, 0xff, 0xf4, 0x0, 0x0,
-    0x3, 0xff, 0xff, 0xf8, 0x0, 0x1f, 0xff, 0xff,
-    0xc0, 0x0, 0x0, 0xbf, 0xff, 0xff, 0x0, 0x0,
-    0xbf, 0xff, 0xff, 0x0, 0x0, 0xf, 0xff, 0xff,
-    0xd0, 0x0, 0x3, 0xff, 0xff, 0xf4, 0x0, 0x3,
-    0xff, 0xff, 0xf8, 0x0, 0x0, 0xf, 0xff, 0xff,
-    0xc0, 0x0, 0xbf, 0xff, 0xff, 0x0, 0x0, 0x0,
-    0xbf, 0xff, 0xff, 0x0, 0xf, 0xff, 0xff, 0xc0,
-    0x0, 0x0, 0x3, 0xff, 0xff, 0xf8, 0x3, 0xff,
-    0xff, 0xf4, 0x0, 0x0, 0x0, 0xf, 0xff, 0xff,
-    0xc0, 0xbf, 0xff, 0xfe, 0x0, 0x0, 0x0, 0x0,
-    0x7f, 0xff, 0xff, 0xf, 0xff, 0xff, 0xc0, 0x0,
-    0x0, 0x0, 0x2, 0xff, 0xff, 0xfb, 0xff, 0xff,
-    0xf4, 0x0, 0x0, 0x0, 0x0, 0xf, 0xff, 0xff,
-    0xff, 0xff, 0xfe, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x7f, 0xff, 0xff, 0xff, 0xff, 0xc0, 0x0, 0x0,
-    0x0, 0x0, 0x2, 0xff, 0xff, 0xff, 0xff, 0xf0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0xf, 0xff, 0xff,
-    0xff, 0xfd, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x3f, 0xff, 0xff, 0xff, 0xc0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x1, 0xff, 0xff, 0xff, 0xf0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0xf, 0xff, 0xff,
-    0xfd, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x1,
-    0xff, 0xff, 0xff, 0xf0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x3f, 0xff, 0xff, 0xff, 0x80, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0xb, 0xff, 0xff, 0xff,
-    0xfd, 0x0, 0x0, 0x0, 0x0, 0x0, 0x1, 0xff,
-    0xff, 0xff, 0xff, 0xf0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x3f, 0xff, 0xff, 0xff, 0xff, 0x80, 0x0,
-    0x0, 0x0, 0x0, 0xf, 0xff, 0xff, 0xff, 0xff,
-    0xfd, 0x0, 0x0, 0x0, 0x0, 0x1, 0xff, 0xff,
-    0xff, 0xff, 0xff, 0xf0, 0x0, 0x0, 0x0, 0x0,
-    0x3f, 0xff, 0xff, 0x1f, 0xff, 0xff, 0xc0, 0x0,
-    0x0, 0x0, 0xf, 0xff, 0xff, 0xd0, 0xff, 0xff,
-    0xfe, 0x0, 0x0, 0x0, 0x2, 0xff, 0xff, 0xf8,
-    0x3, 0xff, 0xff, 0xf0, 0x0, 0x0, 0x0, 0x7f,
-    0xff, 0xff, 0x0, 0x1f, 0xff, 0xff, 0xc0, 0x0,
-    0x0, 0xf, 0xff, 0xff, 0xd0, 0x0, 0xff, 0xff,
-    0xfe, 0x0, 0x0, 0x2, 0xff, 0xff, 0xfc, 0x0,
-    0x3, 0xff, 0xff, 0xf4, 0x0, 0x0, 0x7f, 0xff,
-    0xff, 0x0, 0x0, 0x2f, 0xff, 0xff, 0xc0, 0x0,
-    0xf, 0xff, 0xff, 0xd0, 0x0, 0x0, 0xff, 0xff,
-    0xfe, 0x0, 0x3, 0xff, 0xff, 0xfc, 0x0, 0x0,
-    0x3, 0xff, 0xff, 0xf4, 0x0, 0xbf, 0xff, 0xff,
-    0x0, 0x0, 0x0, 0x2f, 0xff, 0xff, 0xc0, 0xf,
-    0xff, 0xff, 0xe0, 0x0, 0x0, 0x0, 0xff, 0xff,
-    0xff, 0x3, 0xff, 0xff, 0xfc, 0x0, 0x0, 0x0,
-    0x3, 0xff, 0xff, 0xf8,
-
-    /* U+0079 "y" */
-    0x55, 0x55, 0x55, 0x0, 0x0, 0x0, 0x0, 0x5,
-    0x55, 0x55, 0x5b, 0xff, 0xff, 0xf0, 0x0, 0x0,
-    0x0, 0x1, 0xff, 0xff, 0xfe, 0x3f, 0xff, 0xff,
-    0x80, 0x0, 0x0, 0x0, 0x2f, 0xff, 0xff, 0xc3,
-    0xff, 0xff, 0xfc, 0x0, 0x0, 0x0, 0x3, 0xff,
-    0xff, 0xfc, 0x1f, 0xff, 0xff, 0xd0, 0x0, 0x0,
-    0x0, 0x3f, 0xff, 0xff, 0x80, 0xff, 0xff, 0xfe,
-    0x0, 0x0, 0x0, 0xb, 0xff, 0xff, 0xf4, 0xb,
-    0xff, 0xff, 0xf0, 0x0, 0x0, 0x0, 0xff, 0xff,
-    0xff, 0x0, 0x3f, 0xff, 0xff, 0x40, 0x0, 0x0,
-    0xf, 0xff, 0xff, 0xe0, 0x2, 0xff, 0xff, 0xfc,
-    0x0, 0x0, 0x1, 0xff, 0xff, 0xfd, 0x0, 0x1f,
-    0xff, 0xff, 0xc0, 0x0, 0x0, 0x2f, 0xff, 0xff,
-    0xc0, 0x0, 0xff, 0xff, 0xfe, 0x0, 0x0, 0x3,
-    0xff, 0xff, 0xfc, 0x0, 0x7, 0xff, 0xff, 0xf0,
-    0x0, 0x0, 0x3f, 0xff, 0xff, 0x40, 0x0, 0x3f,
-    0xff, 0xff, 0x40, 0x0, 0x7, 0xff, 0xff, 0xf0,
-    0x0, 0x2, 0xff, 0xff, 0xf8, 0x0, 0x0, 0xff,
-    0xff, 0xff, 0x0, 0x0, 0xf, 0xff, 0xff, 0xc0,
-    0x0, 0xf, 0xff, 0xff, 0xe0, 0x0, 0x0, 0xff,
-    0xff, 0xfe, 0x0, 0x1, 0xff, 0xff, 0xfc, 0x0,
-    0x0, 0x7, 0xff, 0xff, 0xf0, 0x0, 0x2f, 0xff,
-    0xff, 0xc0, 0x0, 0x0, 0x3f, 0xff, 0xff, 0x40,
-    0x3, 0xff, 0xff, 0xf8, 0x0, 0x0, 0x2, 0xff,
-    0xff, 0xf8, 0x0, 0x3f, 0xff, 0xff, 0x40, 0x0,
-    0x0, 0xf, 0xff, 0xff, 0xc0, 0x7, 0xff, 0xff,
-    0xf0, 0x0, 0x0, 0x0, 0xbf, 0xff, 0xfd, 0x0,
-    0xbf, 0xff, 0xfe, 0x0, 0x0, 0x0, 0x7, 0xff,
-    0xff, 0xf0, 0xf, 0xff, 0xff, 0xd0, 0x0, 0x0,
-    0x0, 0x3f, 0xff, 0xff, 0x1, 0xff, 0xff, 0xfc,
-    0x0, 0x0, 0x0, 0x1, 0xff, 0xff, 0xf8, 0x2f,
-    0xff, 0xff, 0xc0, 0x0, 0x0, 0x0, 0xf, 0xff,
-    0xff, 0xc3, 0xff, 0xff, 0xf4, 0x0, 0x0, 0x0,
-    0x0, 0xbf, 0xff, 0xfd, 0x3f, 0xff, 0xff, 0x0,
-    0x0, 0x0, 0x0, 0x7, 0xff, 0xff, 0xf7, 0xff,
-    0xff, 0xf0, 0x0, 0x0, 0x0, 0x0, 0x3f, 0xff,
-    0xff, 0xff, 0xff, 0xfe, 0x0, 0x0, 0x0, 0x0,
-    0x1, 0xff, 0xff, 0xff, 0xff, 0xff, 0xc0, 0x0,
-    0x0, 0x0, 0x0, 0xf, 0xff, 0xff, 0xff, 0xff,
-    0xfc, 0x0, 0x0, 0x0, 0x0, 0x0, 0xbf, 0xff,
-    0xff, 0xff, 0xff, 0x80, 0x0, 0x0, 0x0, 0x0,
-    0x3, 0xff, 0xff, 0xff, 0xff, 0xf4, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x3f, 0xff, 0xff, 0xff, 0xff,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x1, 0xff, 0xff,
-    0xff, 0xff, 0xe0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x5, 0x55, 0xff, 0xff, 0xfd, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0xf, 0xff, 0xff, 0xc0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0xff,
-    0xff, 0xfc, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x1f, 0xff, 0xff, 0x40, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x3, 0xff, 0xff, 0xf0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x3f, 0xff,
-    0xff, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0xb, 0xff, 0xff, 0xe0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0xff, 0xff, 0xfc, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x3f, 0xff, 0xff,
-    0xc0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0xf,
-    0xff, 0xff, 0xf4, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x7, 0xff, 0xff, 0xff, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x7, 0xff, 0xff, 0xff, 0xd0,
-    0x0, 0x0, 0x0, 0x0, 0x55, 0xaf, 0xff, 0xff,
-    0xff, 0xf8, 0x0, 0x0, 0x0, 0x0, 0xf, 0xff,
-    0xff, 0xff, 0xff, 0xff, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0xff, 0xff, 0xff, 0xff, 0xff, 0xc0, 0x0,
-    0x0, 0x0, 0x0, 0xf, 0xff, 0xff, 0xff, 0xff,
-    0xf4, 0x0, 0x0, 0x0, 0x0, 0x0, 0xff, 0xff,
-    0xff, 0xff, 0xfd, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0xf, 0xff, 0xff, 0xff, 0xff, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0xff, 0xff, 0xff, 0xff, 0x40,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0xf, 0xff, 0xff,
-    0xff, 0x40, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0xff, 0xff, 0xfd, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0xf, 0xfe, 0x90, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0,
-
-    /* U+007A "z" */
-    0x1f, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
-    0xc1, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
-    0xfc, 0x1f, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
-    0xff, 0xc1, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
-    0xff, 0xfc, 0x1f, 0xff, 0xff, 0xff, 0xff, 0xff,
-    0xff, 0xff, 0xc1, 0xff, 0xff, 0xff, 0xff, 0xff,
-    0xff, 0xff, 0xfc, 0x1f, 0xff, 0xff, 0xff, 0xff,
-    0xff, 0xff, 0xff, 0xc1, 0xff, 0xff, 0xff, 0xff,
-    0xff, 0xff, 0xff, 0xfc, 0x1f, 0xff, 0xff, 0xff,
-    0xff, 0xff, 0xff, 0xff, 0xc0, 0x0, 0x0, 0x0,
-    0x0, 0x1f, 0xff, 0xff, 0xf0, 0x0, 0x0, 0x0,
-    0x0, 0x7, 0xff, 0xff, 0xfd, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0xff, 0xff, 0xff, 0x40, 0x0, 0x0,
-    0x0, 0x0, 0x3f, 0xff, 0xff, 0xd0, 0x0, 0x0,
-    0x0, 0x0, 0xf, 0xff, 0xff, 0xf4, 0x0, 0x0,
-    0x0, 0x0, 0x3, 0xff, 0xff, 0xfe, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0xff, 0xff, 0xff, 0x80, 0x0,
-    0x0, 0x0, 0x0, 0x3f, 0xff, 0xff, 0xe0, 0x0,
-    0x0, 0x0, 0x0, 0xf, 0xff, 0xff, 0xf8, 0x0,
-    0x0, 0x0, 0x0, 0x2, 0xff, 0xff, 0xfe, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0xbf, 0xff, 0xff, 0xc0,
-    0x0, 0x0, 0x0, 0x0, 0x2f, 0xff, 0xff, 0xf0,
-    0x0, 0x0, 0x0, 0x0, 0xb, 0xff, 0xff, 0xfc,
-    0x0, 0x0, 0x0, 0x0, 0x2, 0xff, 0xff, 0xff,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x7f, 0xff, 0xff,
-    0xc0, 0x0, 0x0, 0x0, 0x0, 0x1f, 0xff, 0xff,
-    0xf0, 0x0, 0x0, 0x0, 0x0, 0x7, 0xff, 0xff,
-    0xfc, 0x0, 0x0, 0x0, 0x0, 0x1, 0xff, 0xff,
-    0xff, 0x0, 0x0, 0x0, 0x0, 0x0, 0x3f, 0xff,
-    0xff, 0xd0, 0x0, 0x0, 0x0, 0x0, 0xf, 0xff,
-    0xff, 0xf4, 0x0, 0x0, 0x0, 0x0, 0x3, 0xff,
-    0xff, 0xfd, 0x0, 0x0, 0x0, 0x0, 0x0, 0xff,
-    0xff, 0xff, 0xea, 0xaa, 0xaa, 0xaa, 0xaa, 0x9f,
-    0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xfd,
-    0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
-    0xdf, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
-    0xfd, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
-    0xff, 0xdf, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
-    0xff, 0xfd, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
-    0xff, 0xff, 0xdf, 0xff, 0xff, 0xff, 0xff, 0xff,
-    0xff, 0xff, 0xfd, 0xff, 0xff, 0xff, 0xff, 0xff,
-    0xff, 0xff, 0xff, 0xd0,
-
-    /* U+007B "{" */
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x40, 0x0, 0x0,
-    0x0, 0xaf, 0xfe, 0x0, 0x0, 0x1, 0xff, 0xff,
-    0xe0, 0x0, 0x0, 0xbf, 0xff, 0xfe, 0x0, 0x0,
-    0x3f, 0xff, 0xff, 0xe0, 0x0, 0xf, 0xff, 0xff,
-    0xfe, 0x0, 0x2, 0xff, 0xff, 0xff, 0xe0, 0x0,
-    0x3f, 0xff, 0xff, 0xfe, 0x0, 0xb, 0xff, 0xff,
-    0xff, 0xe0, 0x0, 0xff, 0xff, 0xff, 0xfe, 0x0,
-    0xf, 0xff, 0xff, 0xe4, 0x0, 0x1, 0xff, 0xff,
-    0xf8, 0x0, 0x0, 0x1f, 0xff, 0xff, 0x0, 0x0,
-    0x1, 0xff, 0xff, 0xf0, 0x0, 0x0, 0x2f, 0xff,
-    0xff, 0x0, 0x0, 0x2, 0xff, 0xff, 0xf0, 0x0,
-    0x0, 0x2f, 0xff, 0xff, 0x0, 0x0, 0x2, 0xff,
-    0xff, 0xf0, 0x0, 0x0, 0x2f, 0xff, 0xff, 0x0,
-    0x0, 0x2, 0xff, 0xff, 0xf0, 0x0, 0x0, 0x2f,
-    0xff, 0xff, 0x0, 0x0, 0x2, 0xff, 0xff, 0xf0,
-    0x0, 0x0, 0x2f, 0xff, 0xff, 0x0, 0x0, 0x2,
-    0xff, 0xff, 0xf0, 0x0, 0x0, 0x2f, 0xff, 0xff,
-    0x0, 0x0, 0x2, 0xff, 0xff, 0xf0, 0x0, 0x0,
-    0x2f, 0xff, 0xff, 0x0, 0x0, 0x2, 0xff, 0xff,
-    0xf0, 0x0, 0x0, 0x2f, 0xff, 0xff, 0x0, 0x0,
-    0x3, 0xff, 0xff, 0xe0, 0x0, 0x0, 0xff, 0xff,
-    0xfd, 0x0, 0x6, 0xff, 0xff, 0xff, 0xc0, 0x0,
-    0xbf, 0xff, 0xff, 0xf0, 0x0, 0xb, 0xff, 0xff,
-    0xfc, 0x0, 0x0, 0xbf, 0xff, 0xf9, 0x0, 0x0,
-    0xb, 0xff, 0xfe, 0x0, 0x0, 0x0, 0xbf, 0xff,
-    0xff, 0x40, 0x0, 0xb, 0xff, 0xff, 0xfe, 0x0,
-    0x0, 0xbf, 0xff, 0xff, 0xf8, 0x0, 0x0, 0x2f,
-    0xff, 0xff, 0xc0, 0x0, 0x0, 0x7f, 0xff, 0xfe,
-    0x0, 0x0, 0x3, 0xff, 0xff, 0xe0, 0x0, 0x0,
-    0x2f, 0xff, 0xff, 0x0, 0x0, 0x2, 0xff, 0xff,
-    0xf0, 0x0, 0x0, 0x2f, 0xff, 0xff, 0x0, 0x0,
-    0x2, 0xff, 0xff, 0xf0, 0x0, 0x0, 0x2f, 0xff,
-    0xff, 0x0, 0x0, 0x2, 0xff, 0xff, 0xf0, 0x0,
-    0x0, 0x2f, 0xff, 0xff, 0x0, 0x0, 0x2, 0xff,
-    0xff, 0xf0, 0x0, 0x0, 0x2f, 0xff, 0xff, 0x0,
-    0x0, 0x2, 0xff, 0xff, 0xf0, 0x0, 0x0, 0x2f,
-    0xff, 0xff, 0x0, 0x0, 0x2, 0xff, 0xff, 0xf0,
-    0x0, 0x0, 0x2f, 0xff, 0xff, 0x0, 0x0, 0x2,
-    0xff, 0xff, 0xf0, 0x0, 0x0, 0x1f, 0xff, 0xff,
-    0x0, 0x0, 0x1, 0xff, 0xff, 0xf0, 0x0, 0x0,
-    0x1f, 0xff, 0xff, 0x40, 0x0, 0x1, 0xff, 0xff,
-    0xfc, 0x0, 0x0, 0xf, 0xff, 0xff, 0xf9, 0x40,
-    0x0, 0xff, 0xff, 0xff, 0xfe, 0x0, 0x7, 0xff,
-    0xff, 0xff, 0xe0, 0x0, 0x3f, 0xff, 0xff, 0xfe,
-    0x0, 0x1, 0xff, 0xff, 0xff, 0xe0, 0x0, 0xb,
-    0xff, 0xff, 0xfe, 0x0, 0x0, 0x2f, 0xff, 0xff,
-    0xe0, 0x0, 0x0, 0x7f, 0xff, 0xfe, 0x0, 0x0,
-    0x0, 0x7f, 0xff, 0xe0, 0x0, 0x0, 0x0, 0x1b,
-    0xfe,
-
-    /* U+007C "|" */
-    0x15, 0x55, 0x47, 0xff, 0xfe, 0x7f, 0xff, 0xe7,
-    0xff, 0xfe, 0x7f, 0xff, 0xe7, 0xff, 0xfe, 0x7f,
-    0xff, 0xe7, 0xff, 0xfe, 0x7f, 0xff, 0xe7, 0xff,
-    0xfe, 0x7f, 0xff, 0xe7, 0xff, 0xfe, 0x7f, 0xff,
-    0xe7, 0xff, 0xfe, 0x7f, 0xff, 0xe7, 0xff, 0xfe,
-    0x7f, 0xff, 0xe7, 0xff, 0xfe, 0x7f, 0xff, 0xe7,
-    0xff, 0xfe, 0x7f, 0xff, 0xe7, 0xff, 0xfe, 0x7f,
-    0xff, 0xe7, 0xff, 0xfe, 0x7f, 0xff, 0xe7, 0xff,
-    0xfe, 0x7f, 0xff, 0xe7, 0xff, 0xfe, 0x7f, 0xff,
-    0xe7, 0xff, 0xfe, 0x7f, 0xff, 0xe7, 0xff, 0xfe,
-    0x7f, 0xff, 0xe7, 0xff, 0xfe, 0x7f, 0xff, 0xe7,
-    0xff, 0xfe, 0x7f, 0xff, 0xe7, 0xff, 0xfe, 0x7f,
-    0xff, 0xe7, 0xff, 0xfe, 0x7f, 0xff, 0xe7, 0xff,
-    0xfe, 0x7f, 0xff, 0xe7, 0xff, 0xfe, 0x7f, 0xff,
-    0xe7, 0xff, 0xfe, 0x7f, 0xff, 0xe7, 0xff, 0xfe,
-    0x7f, 0xff, 0xe7, 0xff, 0xfe, 0x7f, 0xff, 0xe7,
-    0xff, 0xfe, 0x7f, 0xff, 0xe7, 0xff, 0xfe, 0x7f,
-    0xff, 0xe7, 0xff, 0xfe, 0x7f, 0xff, 0xe7, 0xff,
-    0xfe, 0x7f, 0xff, 0xe7, 0xff, 0xfe, 0x7f, 0xff,
-    0xe7, 0xff, 0xfe, 0x7f, 0xff, 0xe7, 0xff, 0xfe,
-    0x7f, 0xff, 0xe7, 0xff, 0xfe, 0x7f, 0xff, 0xe7,
-    0xff, 0xfe, 0x7f, 0xff, 0xe7, 0xff, 0xfe,
-
-    /* U+007D "}" */
-    0x10, 0x0, 0x0, 0x0, 0x0, 0x7, 0xff, 0xa0,
-    0x0, 0x0, 0x0, 0x7f, 0xff, 0xf4, 0x0, 0x0,
-    0x7, 0xff, 0xff, 0xf0, 0x0, 0x0, 0x7f, 0xff,
-    0xff, 0xd0, 0x0, 0x7, 0xff, 0xff, 0xff, 0x0,
-    0x0, 0x7f, 0xff, 0xff, 0xfc, 0x0, 0x7, 0xff,
-    0xff, 0xff, 0xd0, 0x0, 0x7f, 0xff, 0xff, 0xff,
-    0x0, 0x7, 0xff, 0xff, 0xff, 0xf0, 0x0, 0x0,
-    0xbf, 0xff, 0xff, 0x40, 0x0, 0x2, 0xff, 0xff,
-    0xf8, 0x0, 0x0, 0xf, 0xff, 0xff, 0x80, 0x0,
-    0x0, 0xff, 0xff, 0xf8, 0x0, 0x0, 0xf, 0xff,
-    0xff, 0x80, 0x0, 0x0, 0xff, 0xff, 0xf8, 0x0,
-    0x0, 0xf, 0xff, 0xff, 0x80, 0x0, 0x0, 0xff,
-    0xff, 0xf8, 0x0, 0x0, 0xf, 0xff, 0xff, 0x80,
-    0x0, 0x0, 0xff, 0xff, 0xf8, 0x0, 0x0, 0xf,
-    0xff, 0xff, 0x80, 0x0, 0x0, 0xff, 0xff, 0xf8,
-    0x0, 0x0, 0xf, 0xff, 0xff, 0x80, 0x0, 0x0,
-    0xff, 0xff, 0xf8, 0x0, 0x0, 0xf, 0xff, 0xff,
-    0x80, 0x0, 0x0, 0xff, 0xff, 0xf8, 0x0, 0x0,
-    0xf, 0xff, 0xff, 0x80, 0x0, 0x0, 0xff, 0xff,
-    0xfc, 0x0, 0x0, 0xb, 0xff, 0xff, 0xc0, 0x0,
-    0x0, 0xbf, 0xff, 0xfd, 0x0, 0x0, 0x3, 0xff,
-    0xff, 0xf4, 0x0, 0x0, 0x2f, 0xff, 0xff, 0xfa,
-    0x0, 0x0, 0xff, 0xff, 0xff, 0xf0, 0x0, 0x2,
-    0xff, 0xff, 0xff, 0x0, 0x0, 0x6, 0xff, 0xff,
-    0xf0, 0x0, 0x0, 0xb, 0xff, 0xff, 0x0, 0x0,
-    0x1f, 0xff, 0xff, 0xf0, 0x0, 0xb, 0xff, 0xff,
-    0xff, 0x0, 0x1, 0xff, 0xff, 0xff, 0xf0, 0x0,
-    0x3f, 0xff, 0xff, 0x90, 0x0, 0x7, 0xff, 0xff,
-    0xe0, 0x0, 0x0, 0xbf, 0xff, 0xfc, 0x0, 0x0,
-    0xb, 0xff, 0xff, 0xc0, 0x0, 0x0, 0xff, 0xff,
-    0xf8, 0x0, 0x0, 0xf, 0xff, 0xff, 0x80, 0x0,
-    0x0, 0xff, 0xff, 0xf8, 0x0, 0x0, 0xf, 0xff,
-    0xff, 0x80, 0x0, 0x0, 0xff, 0xff, 0xf8, 0x0,
-    0x0, 0xf, 0xff, 0xff, 0x80, 0x0, 0x0, 0xff,
-    0xff, 0xf8, 0x0, 0x0, 0xf, 0xff, 0xff, 0x80,
-    0x0, 0x0, 0xff, 0xff, 0xf8, 0x0, 0x0, 0xf,
-    0xff, 0xff, 0x80, 0x0, 0x0, 0xff, 0xff, 0xf8,
-    0x0, 0x0, 0xf, 0xff, 0xff, 0x80, 0x0, 0x0,
-    0xff, 0xff, 0xf8, 0x0, 0x0, 0xf, 0xff, 0xff,
-    0x80, 0x0, 0x0, 0xff, 0xff, 0xf8, 0x0, 0x0,
-    0xf, 0xff, 0xff, 0x80, 0x0, 0x3, 0xff, 0xff,
-    0xf4, 0x0, 0x16, 0xff, 0xff, 0xff, 0x0, 0x7,
-    0xff, 0xff, 0xff, 0xf0, 0x0, 0x7f, 0xff, 0xff,
-    0xfe, 0x0, 0x7, 0xff, 0xff, 0xff, 0xc0, 0x0,
-    0x7f, 0xff, 0xff, 0xf8, 0x0, 0x7, 0xff, 0xff,
-    0xff, 0x0, 0x0, 0x7f, 0xff, 0xff, 0xc0, 0x0,
-    0x7, 0xff, 0xff, 0xe0, 0x0, 0x0, 0x7f, 0xff,
-    0xe0, 0x0, 0x0, 0x7, 0xfe, 0x40, 0x0, 0x0,
-    0x0,
-
-    /* U+007E "~" */
-    0x0, 0x0, 0x55, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x6, 0xff, 0xff, 0xe0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x7, 0xff, 0xff, 0xff, 0xf4,
-    0x0, 0x0, 0x0, 0x0, 0x2, 0xff, 0xff, 0xff,
-    0xff, 0xe0, 0x0, 0x0, 0x0, 0xa, 0xff, 0xff,
-    0xff, 0xff, 0xff, 0xd0, 0x0, 0x0, 0x7, 0xef,
-    0xff, 0xff, 0xff, 0xff, 0xff, 0xd0, 0x0, 0x7,
-    0xfe, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xe9,
-    0x6b, 0xff, 0xef, 0xff, 0xff, 0xff, 0xff, 0xff,
-    0xff, 0xff, 0xff, 0xfe, 0xff, 0xff, 0xff, 0xff,
-    0xff, 0xff, 0xff, 0xff, 0xff, 0xef, 0xff, 0xff,
-    0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xfe, 0xff,
-    0xf9, 0x0, 0x6f, 0xff, 0xff, 0xff, 0xff, 0xff,
-    0xef, 0xe0, 0x0, 0x0, 0x2f, 0xff, 0xff, 0xff,
-    0xff, 0xfe, 0xf4, 0x0, 0x0, 0x0, 0x3f, 0xff,
-    0xff, 0xff, 0xff, 0xcc, 0x0, 0x0, 0x0, 0x0,
-    0x7f, 0xff, 0xff, 0xff, 0xf0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x7f, 0xff, 0xff, 0xf4, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x1b, 0xff, 0x90, 0x0
-};
-
-
-/*---------------------
- *  GLYPH DESCRIPTION
- *--------------------*/
-
-static const lv_font_fmt_txt_glyph_dsc_t glyph_dsc[] = {
-    {.bitmap_index = 0, .adv_w = 0, .box_w = 0, .box_h = 0, .ofs_x = 0, .ofs_y = 0} /* id = 0 reserved */,
-    {.bitmap_index = 0, .adv_w = 300, .box_w = 0, .box_h = 0, .ofs_x = 0, .ofs_y = 0},
-    {.bitmap_index = 0, .adv_w = 429, .box_w = 13, .box_h = 51, .ofs_x = 7, .ofs_y = 0},
-    {.bitmap_index = 166, .adv_w = 479, .box_w = 24, .box_h = 22, .ofs_x = 3, .ofs_y = 36},
-    {.bitmap_index = 298, .adv_w = 691, .box_w = 42, .box_h = 51, .ofs_x = 1, .ofs_y = 0},
-    {.bitmap_index = 834, .adv_w = 680, .box_w = 36, .box_h = 68, .ofs_x = 3, .ofs_y = -10},
-    {.bitmap_index = 1446, .adv_w = 958, .box_w = 52, .box_h = 52, .ofs_x = 4, .ofs_y = 0},
-    {.bitmap_index = 2122, .adv_w = 759, .box_w = 46, .box_h = 53, .ofs_x = 1, .ofs_y = -1},
-    {.bitmap_index = 2732, .adv_w = 264, .box_w = 11, .box_h = 22, .ofs_x = 3, .ofs_y = 36},
-    {.bitmap_index = 2793, .adv_w = 456, .box_w = 22, .box_h = 70, .ofs_x = 5, .ofs_y = -10},
-    {.bitmap_index = 3178, .adv_w = 456, .box_w = 22, .box_h = 70, .ofs_x = 2, .ofs_y = -10},
-    {.bitmap_index = 3563, .adv_w = 532, .box_w = 30, .box_h = 28, .ofs_x = 2, .ofs_y = 28},
-    {.bitmap_index = 3773, .adv_w = 667, .box_w = 38, .box_h = 38, .ofs_x = 2, .ofs_y = 5},
-    {.bitmap_index = 4134, .adv_w = 379, .box_w = 17, .box_h = 22, .ofs_x = 2, .ofs_y = -10},
-    {.bitmap_index = 4228, .adv_w = 507, .box_w = 23, .box_h = 9, .ofs_x = 4, .ofs_y = 18},
-    {.bitmap_index = 4280, .adv_w = 379, .box_w = 13, .box_h = 12, .ofs_x = 5, .ofs_y = 0},
-    {.bitmap_index = 4319, .adv_w = 577, .box_w = 28, .box_h = 55, .ofs_x = 4, .ofs_y = -2},
-    {.bitmap_index = 4704, .adv_w = 680, .box_w = 37, .box_h = 53, .ofs_x = 3, .ofs_y = -1},
-    {.bitmap_index = 5195, .adv_w = 484, .box_w = 21, .box_h = 51, .ofs_x = 3, .ofs_y = 0},
-    {.bitmap_index = 5463, .adv_w = 680, .box_w = 36, .box_h = 52, .ofs_x = 3, .ofs_y = 0},
-    {.bitmap_index = 5931, .adv_w = 680, .box_w = 35, .box_h = 53, .ofs_x = 4, .ofs_y = -1},
-    {.bitmap_index = 6395, .adv_w = 680, .box_w = 38, .box_h = 51, .ofs_x = 2, .ofs_y = 0},
-    {.bitmap_index = 6880, .adv_w = 680, .box_w = 35, .box_h = 52, .ofs_x = 4, .ofs_y = -1},
-    {.bitmap_index = 7335, .adv_w = 680, .box_w = 37, .box_h = 53, .ofs_x = 3, .ofs_y = -1},
-    {.bitmap_index = 7826, .adv_w = 634, .box_w = 36, .box_h = 51, .ofs_x = 3, .ofs_y = 0},
-    {.bitmap_index = 8285, .adv_w = 680, .box_w = 38, .box_h = 53, .ofs_x = 2, .ofs_y = -1},
-    {.bitmap_index = 8789, .adv_w = 680, .box_w = 37, .box_h = 53, .ofs_x = 3, .ofs_y = -1},
-    {.bitmap_index = 9280, .adv_w = 465, .box_w = 13, .box_h = 39, .ofs_x = 8, .ofs_y = 0},
-    {.bitmap_index = 9407, .adv_w = 465, .box_w = 18, .box_h = 49, .ofs_x = 3, .ofs_y = -10},
-    {.bitmap_index = 9628, .adv_w = 667, .box_w = 38, .box_h = 43, .ofs_x = 2, .ofs_y = 2},
-    {.bitmap_index = 10037, .adv_w = 667, .box_w = 38, .box_h = 28, .ofs_x = 2, .ofs_y = 10},
-    {.bitmap_index = 10303, .adv_w = 667, .box_w = 38, .box_h = 43, .ofs_x = 2, .ofs_y = 2},
-    {.bitmap_index = 10712, .adv_w = 517, .box_w = 29, .box_h = 52, .ofs_x = 2, .ofs_y = 0},
-    {.bitmap_index = 11089, .adv_w = 984, .box_w = 58, .box_h = 59, .ofs_x = 2, .ofs_y = -7},
-    {.bitmap_index = 11945, .adv_w = 835, .box_w = 50, .box_h = 52, .ofs_x = 1, .ofs_y = -1},
-    {.bitmap_index = 12595, .adv_w = 776, .box_w = 42, .box_h = 51, .ofs_x = 4, .ofs_y = 0},
-    {.bitmap_index = 13131, .adv_w = 788, .box_w = 44, .box_h = 53, .ofs_x = 2, .ofs_y = -1},
-    {.bitmap_index = 13714, .adv_w = 810, .box_w = 44, .box_h = 51, .ofs_x = 4, .ofs_y = 0},
-    {.bitmap_index = 14275, .adv_w = 670, .box_w = 36, .box_h = 51, .ofs_x = 4, .ofs_y = 0},
-    {.bitmap_index = 14734, .adv_w = 638, .box_w = 34, .box_h = 51, .ofs_x = 4, .ofs_y = 0},
-    {.bitmap_index = 15168, .adv_w = 811, .box_w = 46, .box_h = 53, .ofs_x = 2, .ofs_y = -1},
-    {.bitmap_index = 15778, .adv_w = 828, .box_w = 44, .box_h = 51, .ofs_x = 4, .ofs_y = 0},
-    {.bitmap_index = 16339, .adv_w = 335, .box_w = 13, .box_h = 51, .ofs_x = 4, .ofs_y = 0},
-    {.bitmap_index = 16505, .adv_w = 380, .box_w = 22, .box_h = 61, .ofs_x = -2, .ofs_y = -11},
-    {.bitmap_index = 16841, .adv_w = 775, .box_w = 45, .box_h = 51, .ofs_x = 4, .ofs_y = 0},
-    {.bitmap_index = 17415, .adv_w = 601, .box_w = 33, .box_h = 51, .ofs_x = 4, .ofs_y = 0},
-    {.bitmap_index = 17836, .adv_w = 1023, .box_w = 56, .box_h = 51, .ofs_x = 4, .ofs_y = 0},
-    {.bitmap_index = 18550, .adv_w = 835, .box_w = 44, .box_h = 51, .ofs_x = 4, .ofs_y = 0},
-    {.bitmap_index = 19111, .adv_w = 914, .box_w = 53, .box_h = 53, .ofs_x = 2, .ofs_y = -1},
-    {.bitmap_index = 19814, .adv_w = 763, .box_w = 42, .box_h = 51, .ofs_x = 4, .ofs_y = 0},
-    {.bitmap_index = 20350, .adv_w = 923, .box_w = 53, .box_h = 59, .ofs_x = 2, .ofs_y = -7},
-    {.bitmap_index = 21132, .adv_w = 760, .box_w = 43, .box_h = 51, .ofs_x = 4, .ofs_y = 0},
-    {.bitmap_index = 21681, .adv_w = 654, .box_w = 37, .box_h = 52, .ofs_x = 2, .ofs_y = -1},
-    {.bitmap_index = 22162, .adv_w = 645, .box_w = 39, .box_h = 51, .ofs_x = 1, .ofs_y = 0},
-    {.bitmap_index = 22660, .adv_w = 847, .box_w = 45, .box_h = 52, .ofs_x = 4, .ofs_y = -1},
-    {.bitmap_index = 23245, .adv_w = 827, .box_w = 51, .box_h = 51, .ofs_x = 0, .ofs_y = 0},
-    {.bitmap_index = 23896, .adv_w = 1075, .box_w = 66, .box_h = 51, .ofs_x = 1, .ofs_y = 0},
-    {.bitmap_index = 24738, .adv_w = 841, .box_w = 51, .box_h = 51, .ofs_x = 1, .ofs_y = 0},
-    {.bitmap_index = 25389, .adv_w = 746, .box_w = 46, .box_h = 51, .ofs_x = 0, .ofs_y = 0},
-    {.bitmap_index = 25976, .adv_w = 751, .box_w = 43, .box_h = 51, .ofs_x = 2, .ofs_y = 0},
-    {.bitmap_index = 26525, .adv_w = 381, .box_w = 18, .box_h = 70, .ofs_x = 5, .ofs_y = -10},
-    {.bitmap_index = 26840, .adv_w = 582, .box_w = 35, .box_h = 62, .ofs_x = 1, .ofs_y = -6},
-    {.bitmap_index = 27383, .adv_w = 381, .box_w = 18, .box_h = 70, .ofs_x = 1, .ofs_y = -10},
-    {.bitmap_index = 27698, .adv_w = 667, .box_w = 34, .box_h = 28, .ofs_x = 4, .ofs_y = 25},
-    {.bitmap_index = 27936, .adv_w = 576, .box_w = 36, .box_h = 8, .ofs_x = 0, .ofs_y = -14},
-    {.bitmap_index = 28008, .adv_w = 499, .box_w = 19, .box_h = 11, .ofs_x = 4, .ofs_y = 48},
-    {.bitmap_index = 28061, .adv_w = 713, .box_w = 41, .box_h = 41, .ofs_x = 2, .ofs_y = -1},
-    {.bitmap_index = 28482, .adv_w = 713, .box_w = 41, .box_h = 57, .ofs_x = 2, .ofs_y = -1},
-    {.bitmap_index = 29067, .adv_w = 611, .box_w = 34, .box_h = 41, .ofs_x = 2, .ofs_y = -1},
-    {.bitmap_index = 29416, .adv_w = 713, .box_w = 41, .box_h = 57, .ofs_x = 2, .ofs_y = -1},
-    {.bitmap_index = 30001, .adv_w = 699, .box_w = 40, .box_h = 42, .ofs_x = 2, .ofs_y = -1},
-    {.bitmap_index = 30421, .adv_w = 461, .box_w = 29, .box_h = 56, .ofs_x = 0, .ofs_y = 0},
-    {.bitmap_index = 30827, .adv_w = 706, .box_w = 39, .box_h = 57, .ofs_x = 2, .ofs_y = -16},
-    {.bitmap_index = 31383, .adv_w = 688, .box_w = 37, .box_h = 56, .ofs_x = 3, .ofs_y = 0},
-    {.bitmap_index = 31901, .adv_w = 329, .box_w = 13, .box_h = 56, .ofs_x = 4, .ofs_y = 0},
-    {.bitmap_index = 32083, .adv_w = 365, .box_w = 22, .box_h = 72, .ofs_x = -2, .ofs_y = -16},
-    {.bitmap_index = 32479, .adv_w = 632, .box_w = 36, .box_h = 56, .ofs_x = 3, .ofs_y = 0},
-    {.bitmap_index = 32983, .adv_w = 366, .box_w = 20, .box_h = 56, .ofs_x = 3, .ofs_y = 0},
-    {.bitmap_index = 33263, .adv_w = 1022, .box_w = 58, .box_h = 40, .ofs_x = 3, .ofs_y = 0},
-    {.bitmap_index = 33843, .adv_w = 699, .box_w = 38, .box_h = 40, .ofs_x = 3, .ofs_y = 0},
-    {.bitmap_index = 34223, .adv_w = 722, .box_w = 41, .box_h = 41, .ofs_x = 2, .ofs_y = -1},
-    {.bitmap_index = 34644, .adv_w = 729, .box_w = 42, .box_h = 57, .ofs_x = 2, .ofs_y = -16},
-    {.bitmap_index = 35243, .adv_w = 735, .box_w = 42, .box_h = 57, .ofs_x = 2, .ofs_y = -16},
-    {.bitmap_index = 35842, .adv_w = 470, .box_w = 26, .box_h = 39, .ofs_x = 3, .ofs_y = 0},
-    {.bitmap_index = 36096, .adv_w = 552, .box_w = 31, .box_h = 41, .ofs_x = 2, .ofs_y = -1},
-    {.bitmap_index = 36414, .adv_w = 422, .box_w = 24, .box_h = 51, .ofs_x = 1, .ofs_y = -1},
-    {.bitmap_index = 36720, .adv_w = 698, .box_w = 39, .box_h = 40, .ofs_x = 3, .ofs_y = -1},
-    {.bitmap_index = 37110, .adv_w = 688, .box_w = 43, .box_h = 39, .ofs_x = 0, .ofs_y = 0},
-    {.bitmap_index = 37530, .adv_w = 1014, .box_w = 62, .box_h = 39, .ofs_x = 1, .ofs_y = 0},
-    {.bitmap_index = 38135, .adv_w = 698, .box_w = 42, .box_h = 40, .ofs_x = 1, .ofs_y = 0},
-    {.bitmap_index = 38555, .adv_w = 669, .box_w = 42, .box_h = 56, .ofs_x = 0, .ofs_y = -16},
-    {.bitmap_index = 39143, .adv_w = 594, .box_w = 34, .box_h = 39, .ofs_x = 2, .ofs_y = 0},
-    {.bitmap_index = 39475, .adv_w = 402, .box_w = 22, .box_h = 70, .ofs_x = 2, .ofs_y = -10},
-    {.bitmap_index = 39860, .adv_w = 258, .box_w = 10, .box_h = 70, .ofs_x = 3, .ofs_y = -11},
-    {.bitmap_index = 40035, .adv_w = 402, .box_w = 22, .box_h = 70, .ofs_x = 1, .ofs_y = -10},
-    {.bitmap_index = 40420, .adv_w = 667, .box_w = 38, .box_h = 16, .ofs_x = 2, .ofs_y = 17}
-};
-
-/*---------------------
- *  CHARACTER MAPPING
- *--------------------*/
+static const uint16_t unicode_list_0[] = {
+    0x0, 0xd, 0xe
+};
 
+static const uint16_t unicode_list_2[] = {
+    0x0
+};
 
 
 /*Collect the unicode lists and glyph_id offsets*/
 static const lv_font_fmt_txt_cmap_t cmaps[] =
 {
     {
-        .range_start = 32, .range_length = 95, .glyph_id_start = 1,
+        .range_start = 32, .range_length = 15, .glyph_id_start = 1,
+        .unicode_list = unicode_list_0, .glyph_id_ofs_list = NULL, .list_length = 3, .type = LV_FONT_FMT_TXT_CMAP_SPARSE_TINY
+    },
+    {
+        .range_start = 48, .range_length = 11, .glyph_id_start = 4,
         .unicode_list = NULL, .glyph_id_ofs_list = NULL, .list_length = 0, .type = LV_FONT_FMT_TXT_CMAP_FORMAT0_TINY
+    },
+    {
+        .range_start = 87, .range_length = 1, .glyph_id_start = 15,
+        .unicode_list = unicode_list_2, .glyph_id_ofs_list = NULL, .list_length = 1, .type = LV_FONT_FMT_TXT_CMAP_SPARSE_TINY
     }
 };
 
@@ -5451,305 +823,18 @@ static const lv_font_fmt_txt_cmap_t cmaps[] =
 /*Pair left and right glyphs for kerning*/
 static const uint8_t kern_pair_glyph_ids[] =
 {
-    7, 43,
-    9, 75,
-    19, 21,
-    19, 23,
-    19, 26,
-    21, 26,
-    34, 43,
-    34, 53,
-    34, 55,
-    34, 56,
-    34, 58,
-    34, 66,
-    34, 68,
-    34, 70,
-    34, 72,
-    34, 80,
-    34, 82,
-    36, 43,
-    37, 43,
-    37, 53,
-    37, 55,
-    37, 56,
-    37, 57,
-    37, 58,
-    37, 59,
-    38, 43,
-    39, 15,
-    39, 34,
-    39, 66,
-    39, 68,
-    39, 70,
-    39, 72,
-    39, 80,
-    39, 82,
-    40, 43,
-    41, 43,
-    42, 43,
-    44, 43,
-    44, 48,
-    44, 66,
-    44, 68,
-    44, 70,
-    44, 72,
-    44, 80,
-    44, 82,
-    45, 34,
-    45, 43,
-    45, 48,
-    45, 53,
-    45, 55,
-    45, 56,
-    45, 58,
-    46, 43,
-    47, 43,
-    48, 43,
-    48, 53,
-    48, 55,
-    48, 56,
-    48, 57,
-    48, 58,
-    48, 59,
-    49, 15,
-    49, 34,
-    49, 57,
-    50, 43,
-    50, 53,
-    50, 55,
-    50, 56,
-    50, 57,
-    50, 58,
-    50, 59,
-    51, 43,
-    51, 58,
-    51, 66,
-    51, 68,
-    51, 70,
-    51, 72,
-    51, 80,
-    51, 82,
-    53, 15,
-    53, 34,
-    53, 40,
-    53, 48,
-    53, 50,
-    53, 66,
-    53, 68,
-    53, 70,
-    53, 72,
-    53, 75,
-    53, 78,
-    53, 79,
-    53, 80,
-    53, 81,
-    53, 82,
-    53, 83,
-    53, 84,
-    53, 86,
-    55, 15,
-    55, 34,
-    55, 40,
-    55, 48,
-    55, 50,
-    55, 66,
-    55, 68,
-    55, 70,
-    55, 72,
-    55, 75,
-    55, 78,
-    55, 79,
-    55, 80,
-    55, 81,
-    55, 82,
-    55, 83,
-    55, 84,
-    55, 86,
-    56, 15,
-    56, 34,
-    56, 40,
-    56, 48,
-    56, 50,
-    56, 66,
-    56, 68,
-    56, 70,
-    56, 72,
-    56, 75,
-    56, 78,
-    56, 79,
-    56, 80,
-    56, 81,
-    56, 82,
-    56, 83,
-    56, 84,
-    56, 86,
-    57, 15,
-    57, 40,
-    57, 43,
-    57, 48,
-    57, 50,
-    57, 66,
-    57, 68,
-    57, 70,
-    57, 72,
-    57, 80,
-    57, 82,
-    57, 84,
-    58, 15,
-    58, 34,
-    58, 40,
-    58, 48,
-    58, 50,
-    58, 66,
-    58, 68,
-    58, 69,
-    58, 70,
-    58, 72,
-    58, 75,
-    58, 78,
-    58, 79,
-    58, 80,
-    58, 81,
-    58, 82,
-    58, 83,
-    58, 84,
-    58, 85,
-    58, 86,
-    59, 40,
-    59, 43,
-    59, 48,
-    59, 50,
-    60, 43,
-    60, 75,
-    61, 43,
-    61, 75,
-    66, 43,
-    67, 53,
-    67, 55,
-    67, 56,
-    67, 57,
-    67, 58,
-    67, 87,
-    67, 88,
-    67, 89,
-    67, 90,
-    68, 43,
-    69, 43,
-    70, 53,
-    70, 55,
-    70, 56,
-    70, 57,
-    70, 58,
-    70, 87,
-    70, 88,
-    70, 89,
-    70, 90,
-    72, 43,
-    76, 43,
-    76, 66,
-    76, 68,
-    76, 70,
-    76, 72,
-    76, 80,
-    76, 82,
-    77, 43,
-    79, 43,
-    80, 43,
-    80, 53,
-    80, 55,
-    80, 56,
-    80, 57,
-    80, 58,
-    80, 87,
-    80, 88,
-    80, 89,
-    80, 90,
-    81, 53,
-    81, 55,
-    81, 56,
-    81, 57,
-    81, 58,
-    81, 87,
-    81, 88,
-    81, 89,
-    81, 90,
-    82, 43,
-    82, 75,
-    83, 66,
-    83, 68,
-    83, 70,
-    83, 72,
-    83, 80,
-    83, 82,
-    84, 53,
-    84, 55,
-    84, 56,
-    84, 57,
-    84, 58,
-    85, 43,
-    86, 43,
-    88, 66,
-    88, 68,
-    88, 70,
-    88, 72,
-    88, 80,
-    88, 82,
-    89, 43,
-    89, 66,
-    89, 68,
-    89, 70,
-    89, 72,
-    89, 80,
-    89, 82,
-    90, 66,
-    90, 68,
-    90, 70,
-    90, 72,
-    90, 80,
-    90, 82,
-    91, 43,
-    92, 43,
-    92, 75
+    6, 8,
+    6, 10,
+    6, 13,
+    8, 13,
+    15, 3
 };
 
 /* Kerning between the respective left and right glyphs
  * 4.4 format which needs to scaled with `kern_scale`*/
 static const int8_t kern_pair_values[] =
 {
-    49, 39, -19, -19, -19, -10, 19, -58,
-    -68, -49, -58, -19, -19, -19, -19, -19,
-    -19, 19, -19, -19, -10, -10, -29, -29,
-    -10, 19, -97, -39, -19, -19, -19, -19,
-    -19, -19, 19, 19, 19, 29, -39, -39,
-    -39, -39, -39, -39, -39, 10, 29, -19,
-    -97, -68, -49, -97, 19, 19, -19, -19,
-    -10, -10, -29, -29, -10, -107, -29, -19,
-    -19, -19, -10, -10, -29, -29, -10, 29,
-    -10, -10, -10, -10, -10, -10, -10, -116,
-    -58, -19, -19, -19, -58, -58, -58, -58,
-    -39, -39, -39, -58, -39, -58, -39, -49,
-    -39, -78, -68, -10, -10, -10, -39, -39,
-    -39, -29, -29, -19, -19, -39, -19, -39,
-    -19, -19, -19, -58, -49, -10, -10, -10,
-    -29, -29, -29, -29, -29, -19, -19, -29,
-    -19, -29, -19, -19, -19, -19, -29, 29,
-    -29, -29, -39, -39, -39, -39, -39, -39,
-    -29, -97, -58, -29, -29, -29, -87, -87,
-    -87, -87, -87, -39, -39, -39, -87, -39,
-    -87, -39, -68, -39, -39, -10, 29, -10,
-    -10, 49, 39, 49, 39, 19, -58, -29,
-    -29, -39, -87, -19, -10, -19, -19, 19,
-    19, -58, -29, -29, -39, -87, -19, -10,
-    -19, -19, 19, 19, -19, -19, -19, -19,
-    -19, -19, 29, 10, -19, -58, -39, -29,
-    -39, -87, -19, -10, -19, -19, -58, -29,
-    -29, -39, -87, -19, -10, -19, -19, 19,
-    39, -19, -19, -19, -19, -19, -19, -49,
-    -19, -19, -29, -68, 19, 10, -10, -10,
-    -10, -10, -10, -10, 19, -10, -10, -10,
-    -10, -10, -10, -10, -10, -10, -10, -10,
-    -10, 19, 49, 39
+    -19, -19, -19, -10, -58
 };
 
 /*Collect the kern pair's data in one place*/
@@ -5757,7 +842,7 @@ static const lv_font_fmt_txt_kern_pair_t kern_pairs =
 {
     .glyph_ids = kern_pair_glyph_ids,
     .values = kern_pair_values,
-    .pair_cnt = 260,
+    .pair_cnt = 5,
     .glyph_ids_size = 0
 };
 
@@ -5780,7 +865,7 @@ static lv_font_fmt_txt_dsc_t font_dsc = {
     .cmaps = cmaps,
     .kern_dsc = &kern_pairs,
     .kern_scale = 19,
-    .cmap_num = 1,
+    .cmap_num = 3,
     .bpp = 2,
     .kern_classes = 0,
     .bitmap_format = 0,
@@ -4,6 +4,7 @@
 // Project name: SquareLine_Project
 
 #include "ui2_helpers.h"
+#include "esp_timer.h"
 
 void _ui2_bar_set_property(lv_obj_t * target, int id, int val)
 {
@@ -51,8 +52,14 @@ void _ui2_slider_set_property(lv_obj_t * target, int id, int val)
 
 void _ui2_screen_change(lv_obj_t ** target, lv_scr_load_anim_t fademode, int spd, int delay, void (*target_init)(void))
 {
-    if(*target == NULL)
+    if(*target == NULL) {
+        int64_t start_us = esp_timer_get_time();
         target_init();
+        
+        // 通知DisplayManager屏幕已按需创建（注册资源替换、补齐显示数据）
+        extern void notifyDisplayManagerScreenCreated(void* screen, uint32_t build_us);
+        notifyDisplayManagerScreenCreated(*target, (uint32_t)(esp_timer_get_time() - start_us));
+    }
     lv_scr_load_anim(*target, fademode, spd, delay, false);
     
     // 通知DisplayManager更新当前页面状态
@@ -2,6 +2,7 @@
  * Size: 36 px
  * Bpp: 4
  * Opts: --bpp 4 --size 36 --font C:/Users/north/SquareLine/assets/AlimamaDaoLiTi.ttf -o C:/Users/north/SquareLine/assets\ui_font_DaoLiti36.c --format lvgl -r 0x20-0x7f --symbols 123456789一二三四五六七星期 --no-compress --no-prefilter
+ * Subset: 16/104 glyphs (font_subsetter.py)
  ******************************************************************************/
 
 #include "ui.h"
@@ -20,268 +21,6 @@
 static LV_ATTRIBUTE_LARGE_CONST const uint8_t glyph_bitmap[] = {
     /* U+0020 " " */
 
-    /* U+0021 "!" */
-    0x0, 0x12, 0x2d, 0xff, 0xfa, 0xdf, 0xff, 0x8b,
-    0xff, 0xf6, 0x9f, 0xff, 0x58, 0xff, 0xf3, 0x6f,
-    0xff, 0x15, 0xff, 0xf0, 0x4f, 0xff, 0x3, 0xff,
-    0xf0, 0x3f, 0xfe, 0x2, 0xff, 0xe0, 0x2f, 0xfd,
-    0x1, 0xff, 0xd0, 0x2f, 0xfd, 0x2, 0xff, 0xe0,
-    0x3f, 0xff, 0x2, 0x75, 0x30, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x9d, 0xef, 0x8c, 0xff, 0xf5, 0xbf,
-    0xff, 0x4c, 0xff, 0xf4, 0x65, 0x42, 0x0,
-
-    /* U+0022 "\"" */
-    0x7f, 0xff, 0x7f, 0xff, 0x92, 0xff, 0xf0, 0xdf,
-    0xf5, 0xe, 0xfd, 0xa, 0xff, 0x20, 0xcf, 0xa0,
-    0x7f, 0xf0, 0x9, 0xf9, 0x4, 0xfe, 0x0, 0x8f,
-    0x80, 0x3f, 0xd0, 0x1, 0x31, 0x0, 0x32, 0x0,
-
-    /* U+0023 "#" */
-    0x0, 0x0, 0x0, 0x0, 0x2, 0x0, 0x0, 0x0,
-    0x1, 0x10, 0x0, 0x0, 0x0, 0x0, 0x6f, 0xff,
-    0x0, 0x0, 0x1e, 0xff, 0x50, 0x0, 0x0, 0x0,
-    0x0, 0x9f, 0xfc, 0x0, 0x0, 0x3f, 0xff, 0x20,
-    0x0, 0x0, 0x0, 0x0, 0xbf, 0xf9, 0x0, 0x0,
-    0x5f, 0xff, 0x0, 0x0, 0x0, 0x0, 0x0, 0xdf,
-    0xf6, 0x0, 0x0, 0x7f, 0xfc, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0xef, 0xf3, 0x0, 0x0, 0x9f, 0xf9,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0xff, 0xf0, 0x0,
-    0x0, 0xbf, 0xf6, 0x0, 0x0, 0x2, 0xff, 0xff,
-    0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xf8,
-    0x0, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
-    0xff, 0xff, 0xf6, 0x0, 0xef, 0xff, 0xff, 0xff,
-    0xff, 0xff, 0xff, 0xff, 0xff, 0xf5, 0x0, 0x34,
-    0x4b, 0xff, 0x84, 0x44, 0x47, 0xff, 0xc4, 0x44,
-    0x40, 0x0, 0x0, 0xc, 0xff, 0x30, 0x0, 0x6,
-    0xff, 0x90, 0x0, 0x0, 0x0, 0x0, 0xe, 0xff,
-    0x0, 0x0, 0x9, 0xff, 0x60, 0x0, 0x0, 0x0,
-    0x0, 0x1f, 0xfd, 0x0, 0x0, 0xc, 0xff, 0x30,
-    0x0, 0x0, 0x0, 0x0, 0x4f, 0xfb, 0x0, 0x0,
-    0xe, 0xff, 0x10, 0x0, 0x0, 0xbf, 0xff, 0xff,
-    0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0x0,
-    0x9f, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
-    0xff, 0xfd, 0x0, 0x7f, 0xff, 0xff, 0xff, 0xff,
-    0xff, 0xff, 0xff, 0xff, 0xfb, 0x0, 0x14, 0x44,
-    0xff, 0xf6, 0x44, 0x44, 0xbf, 0xfa, 0x44, 0x42,
-    0x0, 0x0, 0x1, 0xff, 0xf0, 0x0, 0x0, 0xbf,
-    0xf6, 0x0, 0x0, 0x0, 0x0, 0x4, 0xff, 0xe0,
-    0x0, 0x0, 0xef, 0xf4, 0x0, 0x0, 0x0, 0x0,
-    0x7, 0xff, 0xc0, 0x0, 0x2, 0xff, 0xf2, 0x0,
-    0x0, 0x0, 0x0, 0xb, 0xff, 0xa0, 0x0, 0x5,
-    0xff, 0xf0, 0x0, 0x0, 0x0, 0x0, 0xe, 0xff,
-    0x80, 0x0, 0x8, 0xff, 0xe0, 0x0, 0x0, 0x0,
-    0x0, 0xa, 0x87, 0x20, 0x0, 0x7, 0x98, 0x50,
-    0x0, 0x0, 0x0,
-
-    /* U+0024 "$" */
-    0x0, 0x0, 0x0, 0x0, 0x57, 0x40, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0xdf, 0x80, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0xcf, 0x80,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x5, 0xad, 0xff,
-    0xfe, 0xdc, 0x95, 0x20, 0x0, 0x4, 0xef, 0xff,
-    0xff, 0xff, 0xff, 0xff, 0xe0, 0x0, 0x4f, 0xff,
-    0xfe, 0xef, 0xff, 0xff, 0xff, 0xb0, 0x0, 0xef,
-    0xff, 0x60, 0xbf, 0x71, 0x7e, 0xff, 0x70, 0x5,
-    0xff, 0xf6, 0x0, 0xbf, 0x60, 0x0, 0x8f, 0x40,
-    0x8, 0xff, 0xf0, 0x0, 0xbf, 0x60, 0x0, 0x2,
-    0x10, 0x8, 0xff, 0xc0, 0x0, 0xbf, 0x60, 0x0,
-    0x0, 0x0, 0x6, 0xff, 0xe0, 0x0, 0xaf, 0x60,
-    0x0, 0x0, 0x0, 0x1, 0xff, 0xf6, 0x0, 0xaf,
-    0x60, 0x0, 0x0, 0x0, 0x0, 0x8f, 0xff, 0x71,
-    0xaf, 0x60, 0x0, 0x0, 0x0, 0x0, 0xc, 0xff,
-    0xff, 0xef, 0x60, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0xaf, 0xff, 0xff, 0xfd, 0x95, 0x0, 0x0, 0x0,
-    0x0, 0x4, 0xbf, 0xff, 0xff, 0xff, 0xf7, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0xbf, 0xff, 0xff, 0xff,
-    0x90, 0x0, 0x0, 0x0, 0x0, 0xaf, 0x63, 0xcf,
-    0xff, 0xf3, 0x0, 0x0, 0x0, 0x0, 0xaf, 0x60,
-    0xd, 0xff, 0xf9, 0x0, 0x0, 0x0, 0x0, 0xaf,
-    0x60, 0x7, 0xff, 0xfc, 0x0, 0x0, 0x0, 0x0,
-    0xaf, 0x60, 0x5, 0xff, 0xfc, 0x1e, 0x71, 0x0,
-    0x0, 0xbf, 0x60, 0x9, 0xff, 0xf9, 0xf, 0xff,
-    0xa4, 0x0, 0xbf, 0x60, 0x4f, 0xff, 0xf3, 0xd,
-    0xff, 0xff, 0xfb, 0xef, 0xcc, 0xff, 0xff, 0xa0,
-    0xc, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xfb,
-    0x0, 0xa, 0xff, 0xff, 0xff, 0xff, 0xff, 0xfe,
-    0x70, 0x0, 0x0, 0x37, 0xac, 0xdf, 0xff, 0xe9,
-    0x60, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0xcf,
-    0x80, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0xdf, 0x90, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x77, 0x30, 0x0, 0x0, 0x0,
-
-    /* U+0025 "%" */
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x3, 0x40, 0x0, 0x0, 0x0, 0x0, 0x17, 0xdf,
-    0xeb, 0x40, 0x0, 0x0, 0x0, 0xb, 0xfe, 0xa3,
-    0x0, 0x0, 0x2, 0xdf, 0xff, 0xff, 0xf7, 0x0,
-    0x0, 0x0, 0x1f, 0xff, 0xf3, 0x0, 0x0, 0xc,
-    0xff, 0xb5, 0x6e, 0xff, 0x40, 0x0, 0x0, 0x8f,
-    0xff, 0x70, 0x0, 0x0, 0x5f, 0xfc, 0x0, 0x3,
-    0xff, 0xb0, 0x0, 0x0, 0xff, 0xfc, 0x0, 0x0,
-    0x0, 0xaf, 0xf4, 0x0, 0x0, 0xdf, 0xf0, 0x0,
-    0x7, 0xff, 0xf2, 0x0, 0x0, 0x0, 0xcf, 0xf0,
-    0x0, 0x0, 0xaf, 0xf2, 0x0, 0x1f, 0xff, 0x60,
-    0x0, 0x0, 0x0, 0xcf, 0xf0, 0x0, 0x0, 0xbf,
-    0xf1, 0x0, 0x8f, 0xfc, 0x0, 0x0, 0x0, 0x0,
-    0xbf, 0xf1, 0x0, 0x0, 0xef, 0xf0, 0x2, 0xff,
-    0xf2, 0x0, 0x0, 0x0, 0x0, 0x6f, 0xf7, 0x0,
-    0x7, 0xff, 0xa0, 0xb, 0xff, 0x80, 0x0, 0x0,
-    0x0, 0x0, 0xe, 0xff, 0x84, 0x7f, 0xff, 0x20,
-    0x4f, 0xfd, 0x0, 0x0, 0x0, 0x0, 0x0, 0x3,
-    0xef, 0xff, 0xff, 0xf5, 0x0, 0xdf, 0xf4, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x19, 0xef, 0xea,
-    0x20, 0x8, 0xff, 0xa0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x2f, 0xff,
-    0x10, 0x18, 0xdf, 0xeb, 0x30, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0xcf, 0xf8, 0x2, 0xdf, 0xff,
-    0xff, 0xf6, 0x0, 0x0, 0x0, 0x0, 0x0, 0x6,
-    0xff, 0xe0, 0xd, 0xff, 0xb4, 0x6e, 0xff, 0x30,
-    0x0, 0x0, 0x0, 0x0, 0x2f, 0xff, 0x60, 0x5f,
-    0xfc, 0x0, 0x3, 0xff, 0xb0, 0x0, 0x0, 0x0,
-    0x0, 0xbf, 0xfd, 0x0, 0xbf, 0xf3, 0x0, 0x0,
-    0xdf, 0xf0, 0x0, 0x0, 0x0, 0x6, 0xff, 0xf5,
-    0x0, 0xdf, 0xf0, 0x0, 0x0, 0xbf, 0xf1, 0x0,
-    0x0, 0x0, 0x2f, 0xff, 0xc0, 0x0, 0xdf, 0xf0,
-    0x0, 0x0, 0xcf, 0xf1, 0x0, 0x0, 0x0, 0xcf,
-    0xff, 0x40, 0x0, 0xbf, 0xf1, 0x0, 0x0, 0xff,
-    0xf0, 0x0, 0x0, 0x8, 0xff, 0xfd, 0x0, 0x0,
-    0x7f, 0xf7, 0x0, 0x8, 0xff, 0xa0, 0x0, 0x0,
-    0x5f, 0xff, 0xf5, 0x0, 0x0, 0xe, 0xff, 0x74,
-    0x8f, 0xff, 0x20, 0x0, 0x2, 0xef, 0xff, 0xd0,
-    0x0, 0x0, 0x3, 0xff, 0xff, 0xff, 0xf4, 0x0,
-    0x0, 0x0, 0x6d, 0xff, 0x60, 0x0, 0x0, 0x0,
-    0x29, 0xef, 0xea, 0x20, 0x0, 0x0, 0x0, 0x0,
-    0x39, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0,
-
-    /* U+0026 "&" */
-    0x0, 0x0, 0x0, 0x6c, 0xef, 0xd7, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x1d, 0xff, 0xff,
-    0xff, 0xd1, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0xcf, 0xfa, 0x78, 0xff, 0xfb, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x4, 0xff, 0x70, 0x0, 0x2f, 0xff,
-    0x30, 0x0, 0x0, 0x0, 0x0, 0x8, 0xff, 0x40,
-    0x0, 0xc, 0xff, 0x70, 0x0, 0x0, 0x0, 0x0,
-    0xa, 0xff, 0x70, 0x0, 0xc, 0xff, 0x70, 0x0,
-    0x0, 0x0, 0x0, 0x8, 0xff, 0xe0, 0x0, 0x2f,
-    0xff, 0x40, 0x0, 0x0, 0x0, 0x0, 0x3, 0xff,
-    0xf9, 0x3, 0xef, 0xfb, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0xbf, 0xff, 0x9f, 0xff, 0x90, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x1e, 0xff, 0xff,
-    0xe4, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0xb, 0xff, 0xfe, 0x10, 0x0, 0x0, 0x6, 0x90,
-    0x0, 0x0, 0x1, 0xcf, 0xff, 0xff, 0xa0, 0x0,
-    0x0, 0xd, 0xf8, 0x0, 0x0, 0xc, 0xff, 0x99,
-    0xff, 0xf7, 0x0, 0x0, 0x5f, 0xff, 0x80, 0x0,
-    0xaf, 0xf9, 0x0, 0xcf, 0xff, 0x50, 0x0, 0xcf,
-    0xff, 0xd0, 0x4, 0xff, 0xd0, 0x0, 0x1e, 0xff,
-    0xf3, 0x5, 0xff, 0xff, 0x30, 0xb, 0xff, 0x60,
-    0x0, 0x3, 0xff, 0xfe, 0x2d, 0xff, 0xf7, 0x0,
-    0x1f, 0xff, 0x40, 0x0, 0x0, 0x5f, 0xff, 0xff,
-    0xff, 0xb0, 0x0, 0x3f, 0xff, 0x50, 0x0, 0x0,
-    0x8, 0xff, 0xff, 0xfd, 0x0, 0x0, 0x4f, 0xff,
-    0xb0, 0x0, 0x0, 0x0, 0xbf, 0xff, 0xf2, 0x0,
-    0x0, 0x1f, 0xff, 0xf4, 0x0, 0x0, 0x1, 0xcf,
-    0xff, 0xfa, 0x0, 0x0, 0xc, 0xff, 0xff, 0x50,
-    0x0, 0x4d, 0xff, 0xff, 0xff, 0x90, 0x0, 0x3,
-    0xff, 0xff, 0xfd, 0xbe, 0xff, 0xf8, 0x5f, 0xff,
-    0xf8, 0x0, 0x0, 0x6f, 0xff, 0xff, 0xff, 0xfa,
-    0x20, 0x8, 0xff, 0xff, 0x70, 0x0, 0x2, 0x9e,
-    0xfe, 0xc7, 0x20, 0x0, 0x0, 0xbf, 0xed, 0xc2,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x0,
-
-    /* U+0027 "'" */
-    0xaf, 0xff, 0x25, 0xff, 0xd0, 0x2f, 0xfa, 0x0,
-    0xff, 0x70, 0xc, 0xf6, 0x0, 0xbf, 0x50, 0x2,
-    0x31, 0x0,
-
-    /* U+0028 "(" */
-    0x0, 0x0, 0x4, 0x20, 0x0, 0x0, 0x0, 0x2f,
-    0xfa, 0x20, 0x0, 0x0, 0xcf, 0xff, 0xf7, 0x0,
-    0x5, 0xff, 0xff, 0xc0, 0x0, 0xc, 0xff, 0xfd,
-    0x10, 0x0, 0x3f, 0xff, 0xf2, 0x0, 0x0, 0x9f,
-    0xff, 0x80, 0x0, 0x0, 0xef, 0xfe, 0x0, 0x0,
-    0x3, 0xff, 0xf7, 0x0, 0x0, 0x7, 0xff, 0xf1,
-    0x0, 0x0, 0xa, 0xff, 0xb0, 0x0, 0x0, 0xd,
-    0xff, 0x70, 0x0, 0x0, 0xf, 0xff, 0x30, 0x0,
-    0x0, 0x1f, 0xff, 0x10, 0x0, 0x0, 0x2f, 0xfe,
-    0x0, 0x0, 0x0, 0x3f, 0xfd, 0x0, 0x0, 0x0,
-    0x3f, 0xfd, 0x0, 0x0, 0x0, 0x3f, 0xfe, 0x0,
-    0x0, 0x0, 0x2f, 0xff, 0x0, 0x0, 0x0, 0x1f,
-    0xff, 0x10, 0x0, 0x0, 0xf, 0xff, 0x40, 0x0,
-    0x0, 0xd, 0xff, 0x70, 0x0, 0x0, 0xa, 0xff,
-    0xc0, 0x0, 0x0, 0x6, 0xff, 0xf2, 0x0, 0x0,
-    0x2, 0xff, 0xf8, 0x0, 0x0, 0x0, 0xef, 0xff,
-    0x10, 0x0, 0x0, 0x8f, 0xff, 0xa0, 0x0, 0x0,
-    0x2f, 0xff, 0xf4, 0x0, 0x0, 0xb, 0xff, 0xff,
-    0x20, 0x0, 0x3, 0xff, 0xff, 0xe2, 0x0, 0x0,
-    0x9f, 0xff, 0xd5, 0x0, 0x0, 0xd, 0xd6, 0x0,
-    0x0, 0x0, 0x1, 0x0, 0x0,
-
-    /* U+0029 ")" */
-    0x0, 0x0, 0x51, 0x0, 0x0, 0x0, 0x5d, 0xfb,
-    0x0, 0x0, 0xc, 0xff, 0xff, 0x60, 0x0, 0x4,
-    0xff, 0xff, 0xe0, 0x0, 0x0, 0x5f, 0xff, 0xf6,
-    0x0, 0x0, 0x8, 0xff, 0xfd, 0x0, 0x0, 0x0,
-    0xdf, 0xff, 0x30, 0x0, 0x0, 0x5f, 0xff, 0x80,
-    0x0, 0x0, 0xd, 0xff, 0xd0, 0x0, 0x0, 0x7,
-    0xff, 0xf1, 0x0, 0x0, 0x2, 0xff, 0xf4, 0x0,
-    0x0, 0x0, 0xdf, 0xf7, 0x0, 0x0, 0x0, 0x9f,
-    0xf9, 0x0, 0x0, 0x0, 0x7f, 0xfb, 0x0, 0x0,
-    0x0, 0x5f, 0xfc, 0x0, 0x0, 0x0, 0x4f, 0xfc,
-    0x0, 0x0, 0x0, 0x3f, 0xfd, 0x0, 0x0, 0x0,
-    0x4f, 0xfc, 0x0, 0x0, 0x0, 0x5f, 0xfc, 0x0,
-    0x0, 0x0, 0x7f, 0xfa, 0x0, 0x0, 0x0, 0xaf,
-    0xf9, 0x0, 0x0, 0x0, 0xef, 0xf6, 0x0, 0x0,
-    0x2, 0xff, 0xf3, 0x0, 0x0, 0x8, 0xff, 0xf0,
-    0x0, 0x0, 0xe, 0xff, 0xc0, 0x0, 0x0, 0x6f,
-    0xff, 0x70, 0x0, 0x1, 0xef, 0xff, 0x20, 0x0,
-    0xa, 0xff, 0xfc, 0x0, 0x0, 0x7f, 0xff, 0xf5,
-    0x0, 0x7, 0xff, 0xff, 0xc0, 0x0, 0x9, 0xff,
-    0xff, 0x30, 0x0, 0x0, 0x19, 0xf8, 0x0, 0x0,
-    0x0, 0x0, 0x10, 0x0, 0x0,
-
-    /* U+002A "*" */
-    0x0, 0x0, 0x0, 0x11, 0x0, 0x0, 0x0, 0x0,
-    0x7f, 0xf5, 0x0, 0x0, 0x3, 0x0, 0x7f, 0xf4,
-    0x2, 0x0, 0xd, 0xd3, 0x6f, 0xf3, 0x6f, 0x80,
-    0x3f, 0xff, 0xcf, 0xfc, 0xff, 0xf4, 0x3c, 0xff,
-    0xff, 0xff, 0xff, 0xa2, 0x0, 0x4e, 0xff, 0xff,
-    0xc2, 0x0, 0x4, 0xcf, 0xff, 0xff, 0xfa, 0x30,
-    0x8f, 0xff, 0xff, 0xff, 0xff, 0xf2, 0x1e, 0xfc,
-    0x7f, 0xf6, 0xdf, 0xc0, 0x4, 0x70, 0x6f, 0xf3,
-    0x8, 0x50, 0x0, 0x0, 0x7f, 0xf4, 0x0, 0x0,
-    0x0, 0x0, 0x58, 0x61, 0x0, 0x0,
-
-    /* U+002B "+" */
-    0x0, 0x0, 0x0, 0x2, 0x42, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x7, 0xff, 0xd0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x7, 0xff, 0xd0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x6, 0xff,
-    0xc0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x6,
-    0xff, 0xc0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x5, 0xff, 0xc0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x5, 0xff, 0xb0, 0x0, 0x0, 0x0, 0x5,
-    0x55, 0x55, 0x59, 0xff, 0xd5, 0x55, 0x55, 0x52,
-    0xf, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
-    0xf7, 0xe, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
-    0xff, 0xf5, 0xc, 0xff, 0xff, 0xff, 0xff, 0xff,
-    0xff, 0xff, 0xf4, 0x0, 0x0, 0x0, 0x6, 0xff,
-    0xc0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x6,
-    0xff, 0xd0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x6, 0xff, 0xd0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x6, 0xff, 0xe0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x7, 0xff, 0xf0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x7, 0xff, 0xf0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x3, 0x89, 0xb0, 0x0,
-    0x0, 0x0,
-
-    /* U+002C "," */
-    0x0, 0x0, 0x0, 0x0, 0xa, 0xde, 0xf1, 0x0,
-    0xef, 0xfc, 0x0, 0x1f, 0xff, 0x70, 0x5, 0xff,
-    0xf1, 0x0, 0xbf, 0xf9, 0x0, 0x2f, 0xfd, 0x10,
-    0x8, 0xb9, 0x20, 0x0,
 
     /* U+002D "-" */
     0x5, 0x55, 0x55, 0x55, 0x56, 0x67, 0x89, 0x1,
@@ -294,39 +33,6 @@ static LV_ATTRIBUTE_LARGE_CONST const uint8_t glyph_bitmap[] = {
     0x0, 0x0, 0xa, 0xde, 0xf8, 0xcf, 0xff, 0x5b,
     0xff, 0xf4, 0xcf, 0xff, 0x36, 0x54, 0x20,
 
-    /* U+002F "/" */
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x1, 0x84, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x5f, 0xff,
-    0xc4, 0x0, 0x0, 0x0, 0x0, 0x0, 0xa, 0xff,
-    0xfe, 0x10, 0x0, 0x0, 0x0, 0x0, 0x0, 0xef,
-    0xff, 0x70, 0x0, 0x0, 0x0, 0x0, 0x0, 0x4f,
-    0xff, 0xe0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x9,
-    0xff, 0xf7, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0xef, 0xfe, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x4f, 0xff, 0x60, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x9, 0xff, 0xe0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0xff, 0xf8, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x5f, 0xff, 0x10, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0xc, 0xff, 0xa0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x2, 0xff, 0xf3, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x8f, 0xfc, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0xe, 0xff, 0x60, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x5, 0xff, 0xf1, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0xcf, 0xfa, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x3f, 0xff, 0x40, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0xa, 0xff, 0xe0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x2, 0xff, 0xf9, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x9f, 0xff, 0x30, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x2f, 0xff, 0xe0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0xa, 0xff, 0xf9, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x2, 0xff, 0xff, 0x30,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0xbf, 0xff, 0xe0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x5f, 0xff, 0xf9,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0xe, 0xff, 0xff,
-    0x40, 0x0, 0x0, 0x0, 0x0, 0x0, 0x27, 0xcf,
-    0xf0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x14, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-
     /* U+0030 "0" */
     0x0, 0x0, 0x0, 0x6b, 0xef, 0xed, 0x83, 0x0,
     0x0, 0x0, 0x0, 0x3, 0xdf, 0xff, 0xff, 0xff,
@@ -609,147 +315,6 @@ static LV_ATTRIBUTE_LARGE_CONST const uint8_t glyph_bitmap[] = {
     0x0, 0x2, 0xef, 0xff, 0xf4, 0x0, 0x0, 0x0,
     0x0,
 
-    /* U+003A ":" */
-    0x34, 0x67, 0x4d, 0xff, 0xf6, 0xcf, 0xff, 0x4c,
-    0xff, 0xf4, 0xce, 0xcb, 0x20, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0xa, 0xde, 0xf8, 0xcf, 0xff, 0x5b, 0xff, 0xf4,
-    0xcf, 0xff, 0x36, 0x54, 0x20,
-
-    /* U+003B ";" */
-    0x0, 0x34, 0x67, 0x40, 0xd, 0xff, 0xf6, 0x0,
-    0xcf, 0xff, 0x40, 0xc, 0xff, 0xf4, 0x0, 0xce,
-    0xcb, 0x20, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0xa, 0xde,
-    0xf1, 0x0, 0xef, 0xfc, 0x0, 0x1f, 0xff, 0x70,
-    0x5, 0xff, 0xf1, 0x0, 0xbf, 0xf9, 0x0, 0x2f,
-    0xfd, 0x10, 0x8, 0xb9, 0x20, 0x0,
-
-    /* U+003C "<" */
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x20,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x8, 0xe0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x4, 0xdf, 0xf0,
-    0x0, 0x0, 0x0, 0x0, 0x1, 0xaf, 0xff, 0xf1,
-    0x0, 0x0, 0x0, 0x0, 0x7f, 0xff, 0xff, 0xf2,
-    0x0, 0x0, 0x0, 0x4d, 0xff, 0xff, 0xfc, 0x40,
-    0x0, 0x0, 0x1a, 0xff, 0xff, 0xfc, 0x40, 0x0,
-    0x0, 0x8, 0xff, 0xff, 0xfc, 0x40, 0x0, 0x0,
-    0x6, 0xef, 0xff, 0xfd, 0x40, 0x0, 0x0, 0x0,
-    0x3f, 0xff, 0xfe, 0x60, 0x0, 0x0, 0x0, 0x0,
-    0x3f, 0xff, 0xf3, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x3f, 0xff, 0xfe, 0x60, 0x0, 0x0, 0x0, 0x0,
-    0x7, 0xef, 0xff, 0xfc, 0x30, 0x0, 0x0, 0x0,
-    0x0, 0x18, 0xff, 0xff, 0xfb, 0x30, 0x0, 0x0,
-    0x0, 0x0, 0x2b, 0xff, 0xff, 0xfb, 0x40, 0x0,
-    0x0, 0x0, 0x0, 0x4d, 0xff, 0xff, 0xfc, 0x40,
-    0x0, 0x0, 0x0, 0x0, 0x7f, 0xff, 0xff, 0xf2,
-    0x0, 0x0, 0x0, 0x0, 0x2, 0xbf, 0xff, 0xf1,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x5, 0xef, 0xf0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x9, 0xe0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x30,
-
-    /* U+003D "=" */
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x11, 0x22,
-    0x32, 0xf, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
-    0xff, 0xf7, 0xe, 0xff, 0xff, 0xff, 0xff, 0xff,
-    0xff, 0xff, 0xf6, 0xd, 0xff, 0xff, 0xff, 0xff,
-    0xff, 0xff, 0xff, 0xf4, 0x3, 0x55, 0x55, 0x55,
-    0x55, 0x55, 0x55, 0x55, 0x51, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x5, 0x55, 0x55, 0x55, 0x55, 0x56, 0x67,
-    0x78, 0x95, 0xf, 0xff, 0xff, 0xff, 0xff, 0xff,
-    0xff, 0xff, 0xf7, 0xe, 0xff, 0xff, 0xff, 0xff,
-    0xff, 0xff, 0xff, 0xf5, 0xc, 0xff, 0xff, 0xff,
-    0xff, 0xff, 0xff, 0xff, 0xf4,
-
-    /* U+003E ">" */
-    0x11, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x4,
-    0xe5, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x5f,
-    0xfa, 0x10, 0x0, 0x0, 0x0, 0x0, 0x7, 0xff,
-    0xff, 0x70, 0x0, 0x0, 0x0, 0x0, 0x8f, 0xff,
-    0xff, 0xd3, 0x0, 0x0, 0x0, 0x0, 0x7e, 0xff,
-    0xff, 0xfa, 0x10, 0x0, 0x0, 0x0, 0x7, 0xef,
-    0xff, 0xff, 0x70, 0x0, 0x0, 0x0, 0x0, 0x7e,
-    0xff, 0xff, 0xd5, 0x0, 0x0, 0x0, 0x0, 0x7,
-    0xff, 0xff, 0xfc, 0x30, 0x0, 0x0, 0x0, 0x1,
-    0xaf, 0xff, 0xfd, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x8f, 0xff, 0xd0, 0x0, 0x0, 0x0, 0x1, 0x9f,
-    0xff, 0xfd, 0x0, 0x0, 0x0, 0x7, 0xef, 0xff,
-    0xfc, 0x40, 0x0, 0x0, 0x6e, 0xff, 0xff, 0xe5,
-    0x0, 0x0, 0x6, 0xef, 0xff, 0xff, 0x70, 0x0,
-    0x0, 0x7e, 0xff, 0xff, 0xfa, 0x10, 0x0, 0x0,
-    0x8f, 0xff, 0xff, 0xd4, 0x0, 0x0, 0x0, 0x7,
-    0xff, 0xff, 0x70, 0x0, 0x0, 0x0, 0x0, 0x5f,
-    0xfb, 0x20, 0x0, 0x0, 0x0, 0x0, 0x4, 0xe5,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x11, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-
-    /* U+003F "?" */
-    0x0, 0x0, 0x7c, 0xef, 0xeb, 0x50, 0x0, 0x0,
-    0x2d, 0xff, 0xff, 0xff, 0xfa, 0x0, 0x3, 0xef,
-    0xff, 0xfb, 0xdf, 0xff, 0x80, 0x2e, 0xff, 0xf8,
-    0x0, 0x5, 0xff, 0xe0, 0x4f, 0xff, 0x40, 0x0,
-    0x0, 0xbf, 0xf2, 0xa, 0xf5, 0x0, 0x0, 0x0,
-    0x9f, 0xf3, 0x1, 0x80, 0x0, 0x0, 0x0, 0xdf,
-    0xf0, 0x0, 0x0, 0x0, 0x0, 0x9, 0xff, 0x90,
-    0x0, 0x0, 0x0, 0x0, 0xaf, 0xfd, 0x0, 0x0,
-    0x0, 0x0, 0x1c, 0xff, 0xd1, 0x0, 0x0, 0x0,
-    0x0, 0xbf, 0xfb, 0x10, 0x0, 0x0, 0x0, 0x4,
-    0xff, 0xc0, 0x0, 0x0, 0x0, 0x0, 0xa, 0xff,
-    0x40, 0x0, 0x0, 0x0, 0x0, 0xe, 0xff, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0xf, 0xff, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x1f, 0xff, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x1b, 0xa8, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x58,
-    0xab, 0x80, 0x0, 0x0, 0x0, 0x0, 0xaf, 0xff,
-    0x80, 0x0, 0x0, 0x0, 0x0, 0x9f, 0xff, 0x60,
-    0x0, 0x0, 0x0, 0x0, 0xaf, 0xff, 0x60, 0x0,
-    0x0, 0x0, 0x0, 0x8a, 0x87, 0x20, 0x0, 0x0,
-
-    /* U+0040 "@" */
-    0x0, 0x0, 0x0, 0x0, 0x28, 0xbe, 0xff, 0xda,
-    0x50, 0x0, 0x0, 0x0, 0x0, 0x0, 0x2, 0xaf,
-    0xff, 0xff, 0xff, 0xff, 0xe5, 0x0, 0x0, 0x0,
-    0x0, 0x6, 0xff, 0xff, 0xa7, 0x56, 0x8d, 0xff,
-    0xf9, 0x0, 0x0, 0x0, 0x8, 0xff, 0xf9, 0x10,
-    0x0, 0x0, 0x5, 0xff, 0xf8, 0x0, 0x0, 0x6,
-    0xff, 0xf6, 0x0, 0x0, 0x0, 0x0, 0x2, 0xef,
-    0xf3, 0x0, 0x3, 0xff, 0xf5, 0x0, 0x5, 0x75,
-    0x10, 0x45, 0x65, 0xff, 0xc0, 0x0, 0xcf, 0xfa,
-    0x0, 0x5e, 0xff, 0xff, 0x8f, 0xfe, 0xd, 0xff,
-    0x20, 0x5f, 0xfe, 0x0, 0x5f, 0xff, 0xff, 0xff,
-    0xff, 0xb0, 0x7f, 0xf7, 0xb, 0xff, 0x80, 0x1e,
-    0xff, 0xa2, 0x2, 0xaf, 0xfa, 0x4, 0xff, 0x90,
-    0xff, 0xf3, 0x8, 0xff, 0xb0, 0x0, 0x0, 0xef,
-    0x80, 0x3f, 0xfa, 0x4f, 0xff, 0x0, 0xdf, 0xf3,
-    0x0, 0x0, 0xe, 0xf7, 0x2, 0xff, 0xa6, 0xff,
-    0xd0, 0x1f, 0xff, 0x0, 0x0, 0x0, 0xef, 0x60,
-    0x3f, 0xf8, 0x7f, 0xfc, 0x2, 0xff, 0xc0, 0x0,
-    0x0, 0xf, 0xf5, 0x5, 0xff, 0x46, 0xff, 0xc0,
-    0x1f, 0xfd, 0x0, 0x0, 0x1, 0xff, 0x40, 0x9f,
-    0xf0, 0x4f, 0xfe, 0x0, 0xef, 0xf2, 0x0, 0x0,
-    0xaf, 0xf5, 0xe, 0xf8, 0x1, 0xff, 0xf1, 0x9,
-    0xff, 0xc3, 0x2, 0xaf, 0xff, 0x9a, 0xfd, 0x0,
-    0xc, 0xff, 0x70, 0x2f, 0xff, 0xff, 0xff, 0xac,
-    0xff, 0xfe, 0x20, 0x0, 0x6f, 0xfe, 0x10, 0x5f,
-    0xff, 0xff, 0xa0, 0x4e, 0xfb, 0x20, 0x0, 0x0,
-    0xdf, 0xfb, 0x0, 0x17, 0x97, 0x30, 0x0, 0x0,
-    0x10, 0x0, 0x0, 0x4, 0xff, 0xfb, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x79, 0x0, 0x0, 0x0, 0x7,
-    0xff, 0xfe, 0x71, 0x0, 0x0, 0x48, 0xef, 0x70,
-    0x0, 0x0, 0x0, 0x6, 0xff, 0xff, 0xff, 0xef,
-    0xff, 0xff, 0xf5, 0x0, 0x0, 0x0, 0x0, 0x3,
-    0xcf, 0xff, 0xff, 0xff, 0xff, 0xfd, 0x20, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x39, 0xdf, 0xff, 0xeb,
-    0x83, 0x0, 0x0, 0x0,
-
     /* U+0041 "A" */
     0x0, 0x0, 0x0, 0x0, 0x26, 0x78, 0x94, 0x0,
     0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
@@ -790,650 +355,6 @@ static LV_ATTRIBUTE_LARGE_CONST const uint8_t glyph_bitmap[] = {
     0x44, 0x21, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
     0x0, 0x0, 0x0, 0x0,
 
-    /* U+0042 "B" */
-    0x5, 0x32, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0xef, 0xff, 0xff, 0xff, 0xff, 0xeb,
-    0x60, 0x0, 0x0, 0xb, 0xff, 0xff, 0xff, 0xff,
-    0xff, 0xff, 0xe4, 0x0, 0x0, 0x9f, 0xff, 0xff,
-    0xff, 0xff, 0xff, 0xff, 0xf4, 0x0, 0x8, 0xff,
-    0xf8, 0x43, 0x33, 0x46, 0xef, 0xff, 0xd0, 0x0,
-    0x6f, 0xff, 0x30, 0x0, 0x0, 0x0, 0xef, 0xff,
-    0x30, 0x5, 0xff, 0xf1, 0x0, 0x0, 0x0, 0x7,
-    0xff, 0xf5, 0x0, 0x5f, 0xff, 0x10, 0x0, 0x0,
-    0x0, 0x5f, 0xff, 0x60, 0x4, 0xff, 0xf0, 0x0,
-    0x0, 0x0, 0x7, 0xff, 0xf4, 0x0, 0x4f, 0xff,
-    0x0, 0x0, 0x0, 0x0, 0xcf, 0xff, 0x0, 0x4,
-    0xff, 0xf0, 0x0, 0x0, 0x1, 0xaf, 0xff, 0x80,
-    0x0, 0x3f, 0xff, 0xc9, 0x77, 0x9b, 0xff, 0xff,
-    0xb0, 0x0, 0x4, 0xff, 0xff, 0xff, 0xff, 0xff,
-    0xff, 0xe1, 0x0, 0x0, 0x4f, 0xff, 0xff, 0xff,
-    0xff, 0xff, 0xff, 0xe5, 0x0, 0x5, 0xff, 0xe5,
-    0x21, 0x1, 0x26, 0xbf, 0xff, 0xf5, 0x0, 0x5f,
-    0xfe, 0x0, 0x0, 0x0, 0x0, 0x4f, 0xff, 0xf1,
-    0x6, 0xff, 0xe0, 0x0, 0x0, 0x0, 0x0, 0x5f,
-    0xff, 0x70, 0x6f, 0xfe, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0xff, 0xfb, 0x7, 0xff, 0xe0, 0x0, 0x0,
-    0x0, 0x0, 0xf, 0xff, 0xc0, 0x7f, 0xff, 0x0,
-    0x0, 0x0, 0x0, 0x5, 0xff, 0xfb, 0x8, 0xff,
-    0xf0, 0x0, 0x0, 0x0, 0x3, 0xef, 0xff, 0x80,
-    0xaf, 0xff, 0x20, 0x0, 0x0, 0x4a, 0xff, 0xff,
-    0xf2, 0xb, 0xff, 0xff, 0xfe, 0xee, 0xff, 0xff,
-    0xff, 0xf6, 0x0, 0xcf, 0xff, 0xff, 0xff, 0xff,
-    0xff, 0xff, 0xe5, 0x0, 0xe, 0xff, 0xff, 0xff,
-    0xff, 0xff, 0xda, 0x50, 0x0, 0x0, 0x64, 0x20,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-
-    /* U+0043 "C" */
-    0x0, 0x0, 0x0, 0x4, 0x9c, 0xef, 0xfd, 0xb7,
-    0x20, 0x0, 0x0, 0x0, 0x4d, 0xff, 0xff, 0xff,
-    0xff, 0xff, 0xc3, 0x0, 0x0, 0x8f, 0xff, 0xff,
-    0xff, 0xff, 0xff, 0xff, 0x40, 0x0, 0x9f, 0xff,
-    0xfe, 0x84, 0x23, 0x6c, 0xff, 0xf1, 0x0, 0x7f,
-    0xff, 0xfb, 0x10, 0x0, 0x0, 0x4, 0xee, 0x0,
-    0x2f, 0xff, 0xfa, 0x0, 0x0, 0x0, 0x0, 0x2,
-    0xa0, 0x9, 0xff, 0xfd, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x1, 0xff, 0xff, 0x40, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x5f, 0xff, 0xd0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x9, 0xff, 0xf8,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0xcf,
-    0xff, 0x40, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0xe, 0xff, 0xf2, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0xef, 0xff, 0x10, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0xd, 0xff, 0xf2, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0xcf, 0xff, 0x40,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x9, 0xff,
-    0xf8, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x4f, 0xff, 0xe0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x30, 0xef, 0xff, 0x90, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0xb6, 0x7, 0xff, 0xff, 0x80, 0x0,
-    0x0, 0x0, 0x4, 0xdf, 0x50, 0xd, 0xff, 0xff,
-    0xc6, 0x10, 0x1, 0x5b, 0xff, 0xf4, 0x0, 0x2e,
-    0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0x30,
-    0x0, 0x2e, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
-    0xf2, 0x0, 0x0, 0x9, 0xff, 0xff, 0xff, 0xff,
-    0xff, 0xe5, 0x0, 0x0, 0x0, 0x1, 0x6a, 0xdf,
-    0xff, 0xda, 0x50, 0x0,
-
-    /* U+0044 "D" */
-    0x5, 0x32, 0x10, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0xef, 0xff, 0xff, 0xff, 0xfe, 0xc8,
-    0x20, 0x0, 0x0, 0xb, 0xff, 0xff, 0xff, 0xff,
-    0xff, 0xff, 0x80, 0x0, 0x0, 0x9f, 0xff, 0xff,
-    0xff, 0xff, 0xff, 0xff, 0xb0, 0x0, 0x8, 0xff,
-    0xf7, 0x20, 0x13, 0x7d, 0xff, 0xff, 0x80, 0x0,
-    0x6f, 0xff, 0x30, 0x0, 0x0, 0x7, 0xff, 0xff,
-    0x20, 0x5, 0xff, 0xf2, 0x0, 0x0, 0x0, 0x8,
-    0xff, 0xf9, 0x0, 0x5f, 0xff, 0x10, 0x0, 0x0,
-    0x0, 0xe, 0xff, 0xe0, 0x4, 0xff, 0xf0, 0x0,
-    0x0, 0x0, 0x0, 0x8f, 0xff, 0x30, 0x4f, 0xff,
-    0x0, 0x0, 0x0, 0x0, 0x4, 0xff, 0xf6, 0x4,
-    0xff, 0xf0, 0x0, 0x0, 0x0, 0x0, 0x1f, 0xff,
-    0x90, 0x3f, 0xfe, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0xff, 0xfa, 0x4, 0xff, 0xe0, 0x0, 0x0, 0x0,
-    0x0, 0xf, 0xff, 0xb0, 0x4f, 0xfe, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0xff, 0xfb, 0x5, 0xff, 0xe0,
-    0x0, 0x0, 0x0, 0x0, 0x1f, 0xff, 0xa0, 0x5f,
-    0xfe, 0x0, 0x0, 0x0, 0x0, 0x3, 0xff, 0xf9,
-    0x6, 0xff, 0xe0, 0x0, 0x0, 0x0, 0x0, 0x6f,
-    0xff, 0x70, 0x6f, 0xff, 0x0, 0x0, 0x0, 0x0,
-    0xb, 0xff, 0xf3, 0x7, 0xff, 0xf0, 0x0, 0x0,
-    0x0, 0x2, 0xff, 0xfe, 0x0, 0x7f, 0xff, 0x0,
-    0x0, 0x0, 0x0, 0xcf, 0xff, 0x90, 0x9, 0xff,
-    0xf0, 0x0, 0x0, 0x1, 0xbf, 0xff, 0xf2, 0x0,
-    0xaf, 0xff, 0x42, 0x12, 0x59, 0xff, 0xff, 0xf8,
-    0x0, 0xb, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
-    0xfa, 0x0, 0x0, 0xdf, 0xff, 0xff, 0xff, 0xff,
-    0xff, 0xf8, 0x0, 0x0, 0xe, 0xff, 0xff, 0xff,
-    0xff, 0xec, 0x82, 0x0, 0x0, 0x0, 0x53, 0x21,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-
-    /* U+0045 "E" */
-    0x5, 0x43, 0x21, 0x0, 0x0, 0x0, 0x11, 0x23,
-    0x53, 0xd, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
-    0xff, 0xf9, 0xb, 0xff, 0xff, 0xff, 0xff, 0xff,
-    0xff, 0xff, 0xf7, 0x9, 0xff, 0xff, 0xff, 0xff,
-    0xff, 0xff, 0xff, 0xf5, 0x8, 0xff, 0xf5, 0x22,
-    0x22, 0x23, 0x56, 0x9b, 0xf3, 0x6, 0xff, 0xf2,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x5, 0xff,
-    0xf1, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x5,
-    0xff, 0xf1, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x4, 0xff, 0xf0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x4, 0xff, 0xf0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x4, 0xff, 0xf0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x3, 0xff, 0xe0, 0x1, 0x12,
-    0x34, 0x57, 0x98, 0x0, 0x4, 0xff, 0xff, 0xff,
-    0xff, 0xff, 0xff, 0xf8, 0x0, 0x4, 0xff, 0xff,
-    0xff, 0xff, 0xff, 0xff, 0xf6, 0x0, 0x5, 0xff,
-    0xff, 0xff, 0xff, 0xff, 0xff, 0xf4, 0x0, 0x5,
-    0xff, 0xe0, 0x0, 0x0, 0x0, 0x1, 0x20, 0x0,
-    0x6, 0xff, 0xe0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x6, 0xff, 0xe0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x7, 0xff, 0xe0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x7, 0xff, 0xf0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x8, 0xff, 0xf0, 0x0,
-    0x0, 0x0, 0x0, 0x1, 0x6a, 0xa, 0xff, 0xf5,
-    0x43, 0x34, 0x56, 0x8a, 0xdf, 0xfa, 0xb, 0xff,
-    0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xf9, 0xc,
-    0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xf7,
-    0xe, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
-    0xf6, 0x5, 0x31, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0,
-
-    /* U+0046 "F" */
-    0x5, 0x43, 0x21, 0x0, 0x0, 0x0, 0x11, 0x23,
-    0x53, 0xd, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
-    0xff, 0xf9, 0xb, 0xff, 0xff, 0xff, 0xff, 0xff,
-    0xff, 0xff, 0xf7, 0x9, 0xff, 0xff, 0xff, 0xff,
-    0xff, 0xff, 0xff, 0xf4, 0x7, 0xff, 0xf5, 0x22,
-    0x22, 0x23, 0x46, 0x8a, 0xd2, 0x6, 0xff, 0xf2,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x5, 0xff,
-    0xf1, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x5,
-    0xff, 0xf0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x4, 0xff, 0xf0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x4, 0xff, 0xf0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x4, 0xff, 0xe1, 0x12, 0x23, 0x35,
-    0x68, 0xa7, 0x0, 0x3, 0xff, 0xff, 0xff, 0xff,
-    0xff, 0xff, 0xf8, 0x0, 0x4, 0xff, 0xff, 0xff,
-    0xff, 0xff, 0xff, 0xf6, 0x0, 0x4, 0xff, 0xff,
-    0xff, 0xff, 0xff, 0xff, 0xf4, 0x0, 0x5, 0xff,
-    0xe0, 0x0, 0x0, 0x0, 0x1, 0x20, 0x0, 0x5,
-    0xff, 0xe0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x6, 0xff, 0xe0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x6, 0xff, 0xe0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x7, 0xff, 0xf0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x8, 0xff, 0xf0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x9, 0xff, 0xf0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0xa, 0xff, 0xf1,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0xc, 0xff,
-    0xf2, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0xe,
-    0xff, 0xf3, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0xb, 0xa9, 0x71, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x0,
-
-    /* U+0047 "G" */
-    0x0, 0x0, 0x0, 0x4, 0x9c, 0xef, 0xfd, 0xb7,
-    0x20, 0x0, 0x0, 0x0, 0x4d, 0xff, 0xff, 0xff,
-    0xff, 0xff, 0xc3, 0x0, 0x0, 0x8f, 0xff, 0xff,
-    0xff, 0xff, 0xff, 0xff, 0x40, 0x0, 0x9f, 0xff,
-    0xfe, 0x84, 0x23, 0x6c, 0xff, 0xf1, 0x0, 0x6f,
-    0xff, 0xfb, 0x10, 0x0, 0x0, 0x4, 0xee, 0x0,
-    0x1f, 0xff, 0xfa, 0x0, 0x0, 0x0, 0x0, 0x2,
-    0xa0, 0x9, 0xff, 0xfd, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x1, 0xff, 0xff, 0x40, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x5f, 0xff, 0xd0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x9, 0xff, 0xf8,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0xcf,
-    0xff, 0x40, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0xe, 0xff, 0xf2, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0xef, 0xff, 0x10, 0x0, 0x0, 0x0,
-    0x0, 0x7b, 0xcd, 0xbd, 0xff, 0xf1, 0x0, 0x0,
-    0x0, 0x0, 0xa, 0xff, 0xf9, 0xcf, 0xff, 0x30,
-    0x0, 0x0, 0x0, 0x0, 0x8f, 0xff, 0x79, 0xff,
-    0xf7, 0x0, 0x0, 0x0, 0x0, 0x6, 0xff, 0xf6,
-    0x4f, 0xff, 0xd0, 0x0, 0x0, 0x0, 0x0, 0x4f,
-    0xff, 0x40, 0xef, 0xff, 0x80, 0x0, 0x0, 0x0,
-    0x3, 0xff, 0xf4, 0x7, 0xff, 0xff, 0x50, 0x0,
-    0x0, 0x0, 0x2f, 0xff, 0x30, 0xd, 0xff, 0xff,
-    0x80, 0x0, 0x0, 0x2, 0xff, 0xf2, 0x0, 0x2e,
-    0xff, 0xff, 0xe9, 0x53, 0x23, 0x8f, 0xff, 0x20,
-    0x0, 0x2e, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
-    0xf1, 0x0, 0x0, 0x9, 0xff, 0xff, 0xff, 0xff,
-    0xff, 0xe5, 0x0, 0x0, 0x0, 0x1, 0x6a, 0xdf,
-    0xff, 0xd9, 0x50, 0x0,
-
-    /* U+0048 "H" */
-    0x2, 0x34, 0x64, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x24, 0x56, 0x20, 0xef, 0xff, 0x80, 0x0, 0x0,
-    0x0, 0x0, 0x4f, 0xff, 0xf2, 0xb, 0xff, 0xf6,
-    0x0, 0x0, 0x0, 0x0, 0x1, 0xff, 0xff, 0x10,
-    0x9f, 0xff, 0x50, 0x0, 0x0, 0x0, 0x0, 0xf,
-    0xff, 0xf0, 0x8, 0xff, 0xf3, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0xdf, 0xfe, 0x0, 0x6f, 0xff, 0x20,
-    0x0, 0x0, 0x0, 0x0, 0xc, 0xff, 0xc0, 0x5,
-    0xff, 0xf1, 0x0, 0x0, 0x0, 0x0, 0x0, 0xbf,
-    0xfb, 0x0, 0x5f, 0xff, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0xa, 0xff, 0xb0, 0x4, 0xff, 0xf0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x9f, 0xfa, 0x0, 0x4f,
-    0xff, 0x10, 0x0, 0x0, 0x11, 0x24, 0x6c, 0xff,
-    0xa0, 0x4, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
-    0xff, 0xff, 0xf9, 0x0, 0x3f, 0xff, 0xff, 0xff,
-    0xff, 0xff, 0xff, 0xff, 0xff, 0x90, 0x4, 0xff,
-    0xfe, 0xdd, 0xcb, 0xbb, 0xaa, 0xaa, 0xdf, 0xf8,
-    0x0, 0x4f, 0xfe, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x9, 0xff, 0x80, 0x5, 0xff, 0xe0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0xaf, 0xf8, 0x0, 0x5f, 0xfe,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0xa, 0xff, 0x80,
-    0x6, 0xff, 0xe0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0xbf, 0xf8, 0x0, 0x6f, 0xfe, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0xc, 0xff, 0x80, 0x7, 0xff, 0xf0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0xdf, 0xf9, 0x0,
-    0x8f, 0xff, 0x0, 0x0, 0x0, 0x0, 0x0, 0xe,
-    0xff, 0xa0, 0x9, 0xff, 0xf0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0xff, 0xfa, 0x0, 0xbf, 0xff, 0x10,
-    0x0, 0x0, 0x0, 0x0, 0x1f, 0xff, 0xb0, 0xc,
-    0xff, 0xf2, 0x0, 0x0, 0x0, 0x0, 0x3, 0xff,
-    0xfd, 0x0, 0xef, 0xff, 0x40, 0x0, 0x0, 0x0,
-    0x0, 0x5f, 0xff, 0xe0, 0x5, 0x32, 0x10, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-
-    /* U+0049 "I" */
-    0x0, 0x0, 0x22, 0xd, 0xff, 0xf8, 0xc, 0xff,
-    0xf7, 0xa, 0xff, 0xf5, 0x8, 0xff, 0xf4, 0x7,
-    0xff, 0xf2, 0x6, 0xff, 0xf1, 0x5, 0xff, 0xf0,
-    0x4, 0xff, 0xf0, 0x4, 0xff, 0xf0, 0x4, 0xff,
-    0xf0, 0x3, 0xff, 0xf0, 0x4, 0xff, 0xe0, 0x4,
-    0xff, 0xe0, 0x5, 0xff, 0xe0, 0x5, 0xff, 0xe0,
-    0x6, 0xff, 0xe0, 0x6, 0xff, 0xe0, 0x7, 0xff,
-    0xe0, 0x8, 0xff, 0xf0, 0x9, 0xff, 0xf0, 0xa,
-    0xff, 0xf1, 0xc, 0xff, 0xf2, 0xd, 0xff, 0xf3,
-    0xc, 0xba, 0x82,
-
-    /* U+004A "J" */
-    0x0, 0x0, 0x5, 0x8a, 0xbb, 0x0, 0x0, 0x8,
-    0xff, 0xfc, 0x0, 0x0, 0x5, 0xff, 0xfb, 0x0,
-    0x0, 0x3, 0xff, 0xf9, 0x0, 0x0, 0x2, 0xff,
-    0xf8, 0x0, 0x0, 0x1, 0xff, 0xf7, 0x0, 0x0,
-    0x0, 0xff, 0xf6, 0x0, 0x0, 0x0, 0xff, 0xf6,
-    0x0, 0x0, 0x0, 0xff, 0xf6, 0x0, 0x0, 0x0,
-    0xff, 0xf6, 0x0, 0x0, 0x0, 0xff, 0xf6, 0x0,
-    0x0, 0x0, 0xef, 0xf6, 0x0, 0x0, 0x0, 0xef,
-    0xf6, 0x0, 0x0, 0x0, 0xef, 0xf6, 0x0, 0x0,
-    0x0, 0xef, 0xf6, 0x0, 0x0, 0x0, 0xef, 0xf7,
-    0x0, 0x0, 0x0, 0xef, 0xf7, 0x0, 0x0, 0x0,
-    0xef, 0xf7, 0x0, 0x0, 0x0, 0xef, 0xf7, 0x0,
-    0x0, 0x0, 0xef, 0xf7, 0x0, 0x0, 0x0, 0xef,
-    0xf7, 0x0, 0x0, 0x0, 0xff, 0xf6, 0x0, 0x0,
-    0x2, 0xff, 0xf5, 0x0, 0x0, 0x8, 0xff, 0xf3,
-    0x74, 0x11, 0x7f, 0xff, 0xf0, 0x9f, 0xff, 0xff,
-    0xff, 0x80, 0x5f, 0xff, 0xff, 0xfc, 0x0, 0x2f,
-    0xff, 0xff, 0xc1, 0x0, 0xd, 0xfe, 0xb5, 0x0,
-    0x0,
-
-    /* U+004B "K" */
-    0x3, 0x10, 0x0, 0x0, 0x0, 0x0, 0x1, 0x0,
-    0x0, 0x0, 0xef, 0xff, 0x80, 0x0, 0x0, 0x9,
-    0xfd, 0x83, 0x0, 0xb, 0xff, 0xf7, 0x0, 0x0,
-    0x4, 0xff, 0xff, 0xc1, 0x0, 0x9f, 0xff, 0x50,
-    0x0, 0x1, 0xef, 0xff, 0xb0, 0x0, 0x8, 0xff,
-    0xf4, 0x0, 0x0, 0xcf, 0xff, 0xb0, 0x0, 0x0,
-    0x6f, 0xff, 0x20, 0x0, 0x9f, 0xff, 0xb0, 0x0,
-    0x0, 0x5, 0xff, 0xf1, 0x0, 0x7f, 0xff, 0xc0,
-    0x0, 0x0, 0x0, 0x5f, 0xff, 0x0, 0x4f, 0xff,
-    0xd1, 0x0, 0x0, 0x0, 0x4, 0xff, 0xf0, 0x2e,
-    0xff, 0xe1, 0x0, 0x0, 0x0, 0x0, 0x4f, 0xff,
-    0x1d, 0xff, 0xf2, 0x0, 0x0, 0x0, 0x0, 0x4,
-    0xff, 0xeb, 0xff, 0xf4, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x3f, 0xff, 0xff, 0xf6, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x4, 0xff, 0xff, 0xff, 0x70, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x4f, 0xff, 0xff, 0xff,
-    0x40, 0x0, 0x0, 0x0, 0x0, 0x5, 0xff, 0xfd,
-    0xef, 0xfe, 0x20, 0x0, 0x0, 0x0, 0x0, 0x5f,
-    0xff, 0x24, 0xff, 0xfd, 0x0, 0x0, 0x0, 0x0,
-    0x6, 0xff, 0xe0, 0x7, 0xff, 0xfa, 0x0, 0x0,
-    0x0, 0x0, 0x6f, 0xfe, 0x0, 0xb, 0xff, 0xf7,
-    0x0, 0x0, 0x0, 0x7, 0xff, 0xe0, 0x0, 0x1d,
-    0xff, 0xf4, 0x0, 0x0, 0x0, 0x8f, 0xff, 0x0,
-    0x0, 0x3f, 0xff, 0xf2, 0x0, 0x0, 0x9, 0xff,
-    0xf0, 0x0, 0x0, 0x6f, 0xff, 0xe1, 0x0, 0x0,
-    0xaf, 0xff, 0x10, 0x0, 0x0, 0xaf, 0xff, 0xd0,
-    0x0, 0xc, 0xff, 0xf2, 0x0, 0x0, 0x0, 0xdf,
-    0xff, 0xc0, 0x0, 0xdf, 0xff, 0x30, 0x0, 0x0,
-    0x3, 0xff, 0xff, 0xa0, 0xc, 0xba, 0x82, 0x0,
-    0x0, 0x0, 0x7, 0xcb, 0xa9, 0x30,
-
-    /* U+004C "L" */
-    0x5, 0x67, 0x96, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0xe, 0xff, 0xf8, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0xb, 0xff, 0xf6, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x9, 0xff, 0xf4, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x8, 0xff, 0xf3, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x6, 0xff, 0xf2,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x5, 0xff,
-    0xf1, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x5,
-    0xff, 0xf0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x4, 0xff, 0xf0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x4, 0xff, 0xf0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x3, 0xff, 0xf0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x3, 0xff, 0xf0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x4, 0xff, 0xe0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x4, 0xff, 0xe0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x5, 0xff,
-    0xe0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x5,
-    0xff, 0xe0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x6, 0xff, 0xf0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x6, 0xff, 0xf0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x7, 0xff, 0xf0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x8, 0xff, 0xf0, 0x0, 0x0,
-    0x0, 0x0, 0x1, 0x7a, 0x9, 0xff, 0xf5, 0x43,
-    0x34, 0x56, 0x8a, 0xdf, 0xfa, 0xb, 0xff, 0xff,
-    0xff, 0xff, 0xff, 0xff, 0xff, 0xf9, 0xc, 0xff,
-    0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xf7, 0xe,
-    0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xf6,
-    0x5, 0x31, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x0,
-
-    /* U+004D "M" */
-    0x0, 0x0, 0x0, 0x22, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x22, 0x10, 0x0, 0x0, 0x0, 0xb,
-    0xff, 0xff, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0xdf, 0xff, 0xe1, 0x0, 0x0, 0xd, 0xff, 0xff,
-    0x40, 0x0, 0x0, 0x0, 0x0, 0x1, 0xff, 0xff,
-    0xf1, 0x0, 0x0, 0xd, 0xff, 0xff, 0x80, 0x0,
-    0x0, 0x0, 0x0, 0x5, 0xff, 0xff, 0xf1, 0x0,
-    0x0, 0xd, 0xff, 0xff, 0xc0, 0x0, 0x0, 0x0,
-    0x0, 0x9, 0xff, 0xff, 0xf2, 0x0, 0x0, 0xe,
-    0xff, 0xff, 0xf0, 0x0, 0x0, 0x0, 0x0, 0xd,
-    0xff, 0xff, 0xf2, 0x0, 0x0, 0xf, 0xff, 0xff,
-    0xf5, 0x0, 0x0, 0x0, 0x0, 0x1f, 0xff, 0xff,
-    0xf3, 0x0, 0x0, 0xf, 0xff, 0xff, 0xfa, 0x0,
-    0x0, 0x0, 0x0, 0x6f, 0xff, 0xff, 0xf4, 0x0,
-    0x0, 0x2f, 0xff, 0x9f, 0xfe, 0x0, 0x0, 0x0,
-    0x0, 0xbf, 0xfa, 0xff, 0xf6, 0x0, 0x0, 0x3f,
-    0xff, 0x1f, 0xff, 0x30, 0x0, 0x0, 0x0, 0xff,
-    0xf3, 0xcf, 0xf7, 0x0, 0x0, 0x5f, 0xfd, 0xa,
-    0xff, 0x90, 0x0, 0x0, 0x5, 0xff, 0xd0, 0xaf,
-    0xf9, 0x0, 0x0, 0x7f, 0xfb, 0x4, 0xff, 0xe0,
-    0x0, 0x0, 0xb, 0xff, 0x70, 0x7f, 0xfa, 0x0,
-    0x0, 0x8f, 0xf9, 0x0, 0xef, 0xf4, 0x0, 0x0,
-    0x1f, 0xff, 0x10, 0x5f, 0xfc, 0x0, 0x0, 0xaf,
-    0xf7, 0x0, 0x9f, 0xfa, 0x0, 0x0, 0x6f, 0xfc,
-    0x0, 0x3f, 0xfe, 0x0, 0x0, 0xcf, 0xf5, 0x0,
-    0x4f, 0xff, 0x0, 0x0, 0xcf, 0xf6, 0x0, 0x2f,
-    0xff, 0x0, 0x0, 0xef, 0xf3, 0x0, 0xe, 0xff,
-    0x50, 0x2, 0xff, 0xf1, 0x0, 0xf, 0xff, 0x20,
-    0x1, 0xff, 0xf1, 0x0, 0x9, 0xff, 0xc0, 0x9,
-    0xff, 0xc0, 0x0, 0xe, 0xff, 0x50, 0x3, 0xff,
-    0xf0, 0x0, 0x5, 0xff, 0xf2, 0xf, 0xff, 0x70,
-    0x0, 0xc, 0xff, 0x70, 0x6, 0xff, 0xe0, 0x0,
-    0x0, 0xff, 0xf9, 0x6f, 0xff, 0x20, 0x0, 0xb,
-    0xff, 0xa0, 0x8, 0xff, 0xd0, 0x0, 0x0, 0xbf,
-    0xff, 0xdf, 0xfd, 0x0, 0x0, 0xa, 0xff, 0xc0,
-    0xb, 0xff, 0xc0, 0x0, 0x0, 0x6f, 0xff, 0xff,
-    0xf8, 0x0, 0x0, 0x9, 0xff, 0xf0, 0xe, 0xff,
-    0xb0, 0x0, 0x0, 0x2f, 0xff, 0xff, 0xf4, 0x0,
-    0x0, 0x8, 0xff, 0xf2, 0x1f, 0xff, 0xb0, 0x0,
-    0x0, 0xd, 0xff, 0xff, 0xf0, 0x0, 0x0, 0x7,
-    0xff, 0xf5, 0x5f, 0xff, 0xb0, 0x0, 0x0, 0x9,
-    0xff, 0xff, 0xb0, 0x0, 0x0, 0x7, 0xff, 0xf9,
-    0x7c, 0xa9, 0x50, 0x0, 0x0, 0x4, 0xcb, 0xa9,
-    0x40, 0x0, 0x0, 0x3, 0x9a, 0xba,
-
-    /* U+004E "N" */
-    0x6, 0x78, 0x99, 0x0, 0x0, 0x0, 0x0, 0x1,
-    0x67, 0x9a, 0x20, 0xef, 0xff, 0xf5, 0x0, 0x0,
-    0x0, 0x0, 0x3f, 0xff, 0xf2, 0xb, 0xff, 0xff,
-    0xd0, 0x0, 0x0, 0x0, 0x1, 0xff, 0xff, 0x0,
-    0x9f, 0xff, 0xff, 0x60, 0x0, 0x0, 0x0, 0xf,
-    0xff, 0xf0, 0x7, 0xff, 0xff, 0xfe, 0x0, 0x0,
-    0x0, 0x0, 0xdf, 0xfd, 0x0, 0x6f, 0xff, 0xff,
-    0xf7, 0x0, 0x0, 0x0, 0xb, 0xff, 0xc0, 0x5,
-    0xff, 0xfb, 0xff, 0xf1, 0x0, 0x0, 0x0, 0xaf,
-    0xfb, 0x0, 0x4f, 0xff, 0x2f, 0xff, 0xa0, 0x0,
-    0x0, 0x9, 0xff, 0xb0, 0x4, 0xff, 0xf0, 0x6f,
-    0xff, 0x30, 0x0, 0x0, 0x9f, 0xfa, 0x0, 0x4f,
-    0xff, 0x0, 0xcf, 0xfc, 0x0, 0x0, 0x9, 0xff,
-    0xa0, 0x3, 0xff, 0xe0, 0x3, 0xff, 0xf6, 0x0,
-    0x0, 0x8f, 0xf9, 0x0, 0x3f, 0xfe, 0x0, 0x8,
-    0xff, 0xe1, 0x0, 0x8, 0xff, 0x90, 0x4, 0xff,
-    0xe0, 0x0, 0xe, 0xff, 0x90, 0x0, 0x9f, 0xf8,
-    0x0, 0x4f, 0xfe, 0x0, 0x0, 0x5f, 0xff, 0x30,
-    0x9, 0xff, 0x80, 0x5, 0xff, 0xe0, 0x0, 0x0,
-    0xcf, 0xfd, 0x0, 0x9f, 0xf8, 0x0, 0x5f, 0xfe,
-    0x0, 0x0, 0x3, 0xff, 0xf8, 0xa, 0xff, 0x80,
-    0x6, 0xff, 0xe0, 0x0, 0x0, 0x9, 0xff, 0xf3,
-    0xbf, 0xf8, 0x0, 0x6f, 0xfe, 0x0, 0x0, 0x0,
-    0x1f, 0xff, 0xdc, 0xff, 0x90, 0x7, 0xff, 0xf0,
-    0x0, 0x0, 0x0, 0x7f, 0xff, 0xff, 0xf9, 0x0,
-    0x8f, 0xff, 0x0, 0x0, 0x0, 0x0, 0xef, 0xff,
-    0xff, 0xa0, 0x9, 0xff, 0xf0, 0x0, 0x0, 0x0,
-    0x5, 0xff, 0xff, 0xfa, 0x0, 0xbf, 0xff, 0x10,
-    0x0, 0x0, 0x0, 0xc, 0xff, 0xff, 0xb0, 0xc,
-    0xff, 0xf2, 0x0, 0x0, 0x0, 0x0, 0x3f, 0xff,
-    0xfd, 0x0, 0xef, 0xff, 0x40, 0x0, 0x0, 0x0,
-    0x0, 0xaf, 0xff, 0xe0, 0x5, 0x32, 0x10, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-
-    /* U+004F "O" */
-    0x0, 0x0, 0x0, 0x4, 0x9d, 0xef, 0xfd, 0xa5,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x4d, 0xff,
-    0xff, 0xff, 0xff, 0xfe, 0x70, 0x0, 0x0, 0x0,
-    0x0, 0x9f, 0xff, 0xff, 0xa8, 0x8b, 0xff, 0xff,
-    0xb1, 0x0, 0x0, 0x0, 0xaf, 0xff, 0xf8, 0x0,
-    0x0, 0x1, 0xaf, 0xff, 0xc0, 0x0, 0x0, 0x8f,
-    0xff, 0xf4, 0x0, 0x0, 0x0, 0x0, 0x9f, 0xff,
-    0xa0, 0x0, 0x3f, 0xff, 0xf6, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0xdf, 0xff, 0x30, 0xb, 0xff, 0xfb,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x5, 0xff, 0xfb,
-    0x2, 0xff, 0xff, 0x20, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0xe, 0xff, 0xf1, 0x7f, 0xff, 0xc0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0xaf, 0xff, 0x5b,
-    0xff, 0xf7, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x6, 0xff, 0xf8, 0xdf, 0xff, 0x30, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x4f, 0xff, 0xae, 0xff,
-    0xf2, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x3,
-    0xff, 0xfb, 0xef, 0xff, 0x10, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x4f, 0xff, 0xbd, 0xff, 0xf2,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x5, 0xff,
-    0xfa, 0xbf, 0xff, 0x30, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x9f, 0xff, 0x88, 0xff, 0xf6, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0xe, 0xff, 0xf4,
-    0x3f, 0xff, 0xb0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x5, 0xff, 0xfe, 0x0, 0xdf, 0xff, 0x10, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0xdf, 0xff, 0x80, 0x6,
-    0xff, 0xf9, 0x0, 0x0, 0x0, 0x0, 0x0, 0x8f,
-    0xff, 0xe1, 0x0, 0xc, 0xff, 0xf6, 0x0, 0x0,
-    0x0, 0x0, 0x6f, 0xff, 0xf5, 0x0, 0x0, 0x1e,
-    0xff, 0xf7, 0x0, 0x0, 0x0, 0x9f, 0xff, 0xf7,
-    0x0, 0x0, 0x0, 0x1d, 0xff, 0xfe, 0x97, 0x8a,
-    0xff, 0xff, 0xf6, 0x0, 0x0, 0x0, 0x0, 0x8,
-    0xff, 0xff, 0xff, 0xff, 0xff, 0xc3, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x1, 0x6a, 0xdf, 0xfe, 0xc9,
-    0x30, 0x0, 0x0, 0x0,
-
-    /* U+0050 "P" */
-    0x5, 0x32, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0xdf, 0xff, 0xff, 0xff, 0xff, 0xfd,
-    0xa5, 0x0, 0x0, 0xb, 0xff, 0xff, 0xff, 0xff,
-    0xff, 0xff, 0xfd, 0x40, 0x0, 0x9f, 0xff, 0xff,
-    0xff, 0xff, 0xff, 0xff, 0xff, 0x50, 0x7, 0xff,
-    0xf6, 0x10, 0x0, 0x26, 0xbf, 0xff, 0xfe, 0x10,
-    0x6f, 0xff, 0x20, 0x0, 0x0, 0x0, 0x4e, 0xff,
-    0xf6, 0x5, 0xff, 0xf1, 0x0, 0x0, 0x0, 0x0,
-    0x5f, 0xff, 0xa0, 0x5f, 0xff, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0xff, 0xfb, 0x4, 0xff, 0xf0, 0x0,
-    0x0, 0x0, 0x0, 0xf, 0xff, 0xa0, 0x4f, 0xff,
-    0x0, 0x0, 0x0, 0x0, 0x5, 0xff, 0xf8, 0x4,
-    0xff, 0xf0, 0x0, 0x0, 0x0, 0x4, 0xef, 0xff,
-    0x30, 0x3f, 0xfe, 0x21, 0x11, 0x13, 0x7c, 0xff,
-    0xff, 0xa0, 0x4, 0xff, 0xff, 0xff, 0xff, 0xff,
-    0xff, 0xff, 0xb0, 0x0, 0x4f, 0xff, 0xff, 0xff,
-    0xff, 0xff, 0xff, 0x70, 0x0, 0x5, 0xff, 0xff,
-    0xff, 0xff, 0xfd, 0xa6, 0x0, 0x0, 0x0, 0x5f,
-    0xfe, 0x32, 0x10, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x6, 0xff, 0xe0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x6f, 0xfe, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x7, 0xff, 0xf0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x8f, 0xff, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x9, 0xff,
-    0xf0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0xaf, 0xff, 0x10, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0xc, 0xff, 0xf2, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0xef, 0xff, 0x30, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0xa, 0x98, 0x71, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-
-    /* U+0051 "Q" */
-    0x0, 0x0, 0x0, 0x4, 0x9d, 0xef, 0xfd, 0xa5,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x4d, 0xff,
-    0xff, 0xff, 0xff, 0xfe, 0x70, 0x0, 0x0, 0x0,
-    0x0, 0x9f, 0xff, 0xff, 0xa8, 0x8a, 0xff, 0xff,
-    0xc1, 0x0, 0x0, 0x0, 0xaf, 0xff, 0xf8, 0x0,
-    0x0, 0x1, 0xaf, 0xff, 0xc0, 0x0, 0x0, 0x8f,
-    0xff, 0xf4, 0x0, 0x0, 0x0, 0x0, 0xaf, 0xff,
-    0xa0, 0x0, 0x3f, 0xff, 0xf6, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0xdf, 0xff, 0x40, 0xb, 0xff, 0xfb,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x5, 0xff, 0xfb,
-    0x2, 0xff, 0xff, 0x20, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0xe, 0xff, 0xf1, 0x7f, 0xff, 0xc0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0xaf, 0xff, 0x6b,
-    0xff, 0xf7, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x6, 0xff, 0xf9, 0xdf, 0xff, 0x30, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x5f, 0xff, 0xbe, 0xff,
-    0xf2, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x3,
-    0xff, 0xfb, 0xef, 0xff, 0x10, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x4f, 0xff, 0xbd, 0xff, 0xf2,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x5, 0xff,
-    0xfa, 0xbf, 0xff, 0x30, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x9f, 0xff, 0x88, 0xff, 0xf6, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0xe, 0xff, 0xf4,
-    0x3f, 0xff, 0xb0, 0x0, 0x0, 0x3, 0x63, 0x0,
-    0x4, 0xff, 0xfe, 0x0, 0xdf, 0xff, 0x10, 0x0,
-    0xd, 0xff, 0xe1, 0x0, 0xdf, 0xff, 0x80, 0x6,
-    0xff, 0xf9, 0x0, 0x0, 0x2e, 0xff, 0xc0, 0x8f,
-    0xff, 0xe1, 0x0, 0xc, 0xff, 0xf6, 0x0, 0x0,
-    0x2f, 0xff, 0xcf, 0xff, 0xf5, 0x0, 0x0, 0x1e,
-    0xff, 0xf7, 0x0, 0x0, 0x4f, 0xff, 0xff, 0xf7,
-    0x0, 0x0, 0x0, 0x1d, 0xff, 0xfe, 0x97, 0x8a,
-    0xff, 0xff, 0xf7, 0x0, 0x0, 0x0, 0x0, 0x8,
-    0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0x90, 0x0,
-    0x0, 0x0, 0x0, 0x1, 0x6a, 0xdf, 0xfe, 0xc8,
-    0xbf, 0xff, 0xa0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0xdf, 0xff, 0xb0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x3,
-    0xff, 0xfe, 0x90, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x1, 0x0, 0x0, 0x0,
-
-    /* U+0052 "R" */
-    0x5, 0x32, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0xe, 0xff, 0xff, 0xff, 0xff, 0xff,
-    0xda, 0x50, 0x0, 0x0, 0xb, 0xff, 0xff, 0xff,
-    0xff, 0xff, 0xff, 0xfd, 0x40, 0x0, 0x9, 0xff,
-    0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xf5, 0x0,
-    0x7, 0xff, 0xf6, 0x10, 0x0, 0x26, 0xbf, 0xff,
-    0xff, 0x10, 0x6, 0xff, 0xf2, 0x0, 0x0, 0x0,
-    0x4, 0xef, 0xff, 0x60, 0x5, 0xff, 0xf1, 0x0,
-    0x0, 0x0, 0x0, 0x5f, 0xff, 0xa0, 0x5, 0xff,
-    0xf0, 0x0, 0x0, 0x0, 0x0, 0xf, 0xff, 0xb0,
-    0x4, 0xff, 0xf0, 0x0, 0x0, 0x0, 0x0, 0xf,
-    0xff, 0xb0, 0x4, 0xff, 0xf0, 0x0, 0x0, 0x0,
-    0x0, 0x5f, 0xff, 0x70, 0x4, 0xff, 0xf0, 0x0,
-    0x0, 0x0, 0x3, 0xef, 0xff, 0x20, 0x3, 0xff,
-    0xe0, 0x0, 0x1, 0x36, 0xbf, 0xff, 0xf6, 0x0,
-    0x4, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
-    0x60, 0x0, 0x4, 0xff, 0xff, 0xff, 0xff, 0xff,
-    0xff, 0xa2, 0x0, 0x0, 0x5, 0xff, 0xfe, 0xdc,
-    0xbf, 0xff, 0xd1, 0x0, 0x0, 0x0, 0x5, 0xff,
-    0xe0, 0x0, 0x5, 0xff, 0xf4, 0x0, 0x0, 0x0,
-    0x6, 0xff, 0xe0, 0x0, 0x0, 0xbf, 0xfd, 0x0,
-    0x0, 0x0, 0x6, 0xff, 0xe0, 0x0, 0x0, 0x1f,
-    0xff, 0x70, 0x0, 0x0, 0x7, 0xff, 0xe0, 0x0,
-    0x0, 0x7, 0xff, 0xf1, 0x0, 0x0, 0x8, 0xff,
-    0xf0, 0x0, 0x0, 0x0, 0xdf, 0xfb, 0x0, 0x0,
-    0x9, 0xff, 0xf0, 0x0, 0x0, 0x0, 0x5f, 0xff,
-    0x60, 0x0, 0xa, 0xff, 0xf0, 0x0, 0x0, 0x0,
-    0xd, 0xff, 0xf2, 0x0, 0xc, 0xff, 0xf1, 0x0,
-    0x0, 0x0, 0x5, 0xff, 0xfc, 0x0, 0xd, 0xff,
-    0xf3, 0x0, 0x0, 0x0, 0x0, 0xdf, 0xff, 0x90,
-    0xc, 0xb9, 0x82, 0x0, 0x0, 0x0, 0x0, 0x6c,
-    0xa9, 0x80,
-
-    /* U+0053 "S" */
-    0x0, 0x0, 0x17, 0xbd, 0xff, 0xfd, 0xca, 0x74,
-    0x10, 0x0, 0x9, 0xff, 0xff, 0xff, 0xff, 0xff,
-    0xff, 0xa0, 0x1, 0xdf, 0xff, 0xfc, 0xbc, 0xff,
-    0xff, 0xff, 0x60, 0xa, 0xff, 0xfb, 0x10, 0x0,
-    0x4, 0xbf, 0xff, 0x30, 0x1f, 0xff, 0xc0, 0x0,
-    0x0, 0x0, 0x2, 0xbf, 0x0, 0x5f, 0xff, 0x50,
-    0x0, 0x0, 0x0, 0x0, 0x4, 0x0, 0x6f, 0xff,
-    0x20, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x4f,
-    0xff, 0x40, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0xf, 0xff, 0xb0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x7, 0xff, 0xfb, 0x30, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0xbf, 0xff, 0xfc, 0x84, 0x10,
-    0x0, 0x0, 0x0, 0x0, 0x7, 0xff, 0xff, 0xff,
-    0xfd, 0xa5, 0x0, 0x0, 0x0, 0x0, 0x6, 0xbf,
-    0xff, 0xff, 0xff, 0xe4, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x38, 0xdf, 0xff, 0xff, 0x30, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x5, 0xef, 0xff, 0xd0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x4f, 0xff, 0xf3,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0xc, 0xff,
-    0xf6, 0x10, 0x0, 0x0, 0x0, 0x0, 0x0, 0xa,
-    0xff, 0xf7, 0xc9, 0x20, 0x0, 0x0, 0x0, 0x0,
-    0xe, 0xff, 0xf5, 0xbf, 0xfc, 0x61, 0x0, 0x0,
-    0x0, 0xaf, 0xff, 0xe0, 0x9f, 0xff, 0xff, 0xda,
-    0x88, 0x9e, 0xff, 0xff, 0x60, 0x8f, 0xff, 0xff,
-    0xff, 0xff, 0xff, 0xff, 0xf9, 0x0, 0x6f, 0xff,
-    0xff, 0xff, 0xff, 0xff, 0xfe, 0x50, 0x0, 0x2,
-    0x59, 0xbd, 0xef, 0xfe, 0xc9, 0x50, 0x0, 0x0,
-
-    /* U+0054 "T" */
-    0x11, 0x10, 0x0, 0x0, 0x0, 0x0, 0x1, 0x12,
-    0x23, 0x52, 0x7f, 0xff, 0xff, 0xff, 0xff, 0xff,
-    0xff, 0xff, 0xff, 0xf5, 0x3f, 0xff, 0xff, 0xff,
-    0xff, 0xff, 0xff, 0xff, 0xff, 0xf3, 0xf, 0xff,
-    0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xf1,
-    0xa, 0xb8, 0x65, 0x55, 0xff, 0xfc, 0x55, 0x57,
-    0x8a, 0xd0, 0x0, 0x0, 0x0, 0x0, 0xff, 0xfa,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0xef, 0xf9, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0xdf, 0xf8, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0xcf, 0xf7, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0xcf, 0xf6,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0xcf, 0xf6, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0xbf, 0xf6, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0xbf, 0xf6, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0xcf, 0xf5,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0xcf, 0xf5, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0xdf, 0xf5, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0xef, 0xf5, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0xef, 0xf6,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0xff, 0xf6, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0xff, 0xf7, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x1, 0xff, 0xf7, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x3, 0xff, 0xf8,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x4,
-    0xff, 0xf9, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x6, 0xff, 0xfb, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x5, 0x98, 0x64, 0x0, 0x0,
-    0x0, 0x0,
-
-    /* U+0055 "U" */
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0xc, 0xdf, 0xf8, 0x0, 0x0, 0x0,
-    0x0, 0xc, 0xef, 0xf6, 0xc, 0xff, 0xf6, 0x0,
-    0x0, 0x0, 0x0, 0xe, 0xff, 0xf5, 0xa, 0xff,
-    0xf4, 0x0, 0x0, 0x0, 0x0, 0xd, 0xff, 0xf3,
-    0x9, 0xff, 0xf3, 0x0, 0x0, 0x0, 0x0, 0xb,
-    0xff, 0xf2, 0x8, 0xff, 0xf2, 0x0, 0x0, 0x0,
-    0x0, 0xa, 0xff, 0xf2, 0x7, 0xff, 0xf1, 0x0,
-    0x0, 0x0, 0x0, 0x9, 0xff, 0xf1, 0x6, 0xff,
-    0xf0, 0x0, 0x0, 0x0, 0x0, 0x9, 0xff, 0xf0,
-    0x6, 0xff, 0xf0, 0x0, 0x0, 0x0, 0x0, 0x8,
-    0xff, 0xf0, 0x6, 0xff, 0xf0, 0x0, 0x0, 0x0,
-    0x0, 0x8, 0xff, 0xf0, 0x6, 0xff, 0xf0, 0x0,
-    0x0, 0x0, 0x0, 0x8, 0xff, 0xf0, 0x6, 0xff,
-    0xe0, 0x0, 0x0, 0x0, 0x0, 0x7, 0xff, 0xf0,
-    0x6, 0xff, 0xe0, 0x0, 0x0, 0x0, 0x0, 0x7,
-    0xff, 0xe0, 0x6, 0xff, 0xe0, 0x0, 0x0, 0x0,
-    0x0, 0x7, 0xff, 0xe0, 0x6, 0xff, 0xe0, 0x0,
-    0x0, 0x0, 0x0, 0x7, 0xff, 0xe0, 0x6, 0xff,
-    0xe0, 0x0, 0x0, 0x0, 0x0, 0x8, 0xff, 0xd0,
-    0x6, 0xff, 0xf0, 0x0, 0x0, 0x0, 0x0, 0x9,
-    0xff, 0xc0, 0x4, 0xff, 0xf2, 0x0, 0x0, 0x0,
-    0x0, 0xc, 0xff, 0xa0, 0x1, 0xff, 0xf7, 0x0,
-    0x0, 0x0, 0x0, 0x1f, 0xff, 0x60, 0x0, 0xcf,
-    0xfe, 0x10, 0x0, 0x0, 0x0, 0xaf, 0xff, 0x10,
-    0x0, 0x5f, 0xff, 0xc1, 0x0, 0x0, 0x8, 0xff,
-    0xf9, 0x0, 0x0, 0xb, 0xff, 0xff, 0x96, 0x57,
-    0xdf, 0xff, 0xe1, 0x0, 0x0, 0x0, 0xcf, 0xff,
-    0xff, 0xff, 0xff, 0xfe, 0x20, 0x0, 0x0, 0x0,
-    0x9, 0xff, 0xff, 0xff, 0xff, 0xb1, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x28, 0xdf, 0xfd, 0xa4, 0x0,
-    0x0, 0x0,
-
     /* U+0056 "V" */
     0x0, 0x1, 0x20, 0x0, 0x0, 0x0, 0x0, 0x0,
     0x0, 0x31, 0x0, 0x0, 0xaf, 0xff, 0xf4, 0x0,
@@ -1528,1347 +449,7 @@ static LV_ATTRIBUTE_LARGE_CONST const uint8_t glyph_bitmap[] = {
     0x0, 0xc, 0xff, 0xff, 0x10, 0x0, 0x0, 0x0,
     0x0, 0x0, 0x0, 0x2, 0xa9, 0x76, 0x10, 0x0,
     0x0, 0x0, 0x3, 0x78, 0x99, 0x0, 0x0, 0x0,
-    0x0,
-
-    /* U+0058 "X" */
-    0x0, 0x1, 0x30, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x1, 0x0, 0x0, 0x6, 0xff, 0xff, 0x70, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0xdf, 0xa5, 0x0, 0xb,
-    0xff, 0xff, 0x10, 0x0, 0x0, 0x0, 0x0, 0x8f,
-    0xff, 0xfd, 0x10, 0xd, 0xff, 0xfa, 0x0, 0x0,
-    0x0, 0x0, 0x3f, 0xff, 0xfe, 0x20, 0x0, 0x2f,
-    0xff, 0xf4, 0x0, 0x0, 0x0, 0xd, 0xff, 0xfe,
-    0x20, 0x0, 0x0, 0x5f, 0xff, 0xe0, 0x0, 0x0,
-    0x8, 0xff, 0xff, 0x20, 0x0, 0x0, 0x0, 0x8f,
-    0xff, 0x90, 0x0, 0x4, 0xff, 0xff, 0x40, 0x0,
-    0x0, 0x0, 0x0, 0xcf, 0xff, 0x40, 0x1, 0xef,
-    0xff, 0x60, 0x0, 0x0, 0x0, 0x0, 0x2, 0xff,
-    0xfe, 0x10, 0xbf, 0xff, 0x80, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x5, 0xff, 0xfa, 0x7f, 0xff, 0xb0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0xa, 0xff,
-    0xff, 0xff, 0xd0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0xd, 0xff, 0xff, 0xf2, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x3f, 0xff,
-    0xf5, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x8, 0xff, 0xff, 0x70, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x4, 0xff, 0xff, 0xff,
-    0x30, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x2,
-    0xff, 0xfe, 0xef, 0xfe, 0x10, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x1, 0xdf, 0xff, 0x55, 0xff, 0xfb,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0xbf, 0xff,
-    0xa0, 0xa, 0xff, 0xf7, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x9f, 0xff, 0xd0, 0x0, 0x1e, 0xff, 0xf3,
-    0x0, 0x0, 0x0, 0x0, 0x7f, 0xff, 0xf4, 0x0,
-    0x0, 0x4f, 0xff, 0xe1, 0x0, 0x0, 0x0, 0x5f,
-    0xff, 0xf9, 0x0, 0x0, 0x0, 0x9f, 0xff, 0xc0,
-    0x0, 0x0, 0x5f, 0xff, 0xfe, 0x0, 0x0, 0x0,
-    0x1, 0xef, 0xff, 0x90, 0x0, 0x4f, 0xff, 0xff,
-    0x40, 0x0, 0x0, 0x0, 0x5, 0xff, 0xff, 0x60,
-    0x5, 0xef, 0xff, 0xb0, 0x0, 0x0, 0x0, 0x0,
-    0xb, 0xff, 0xff, 0x30, 0x0, 0x9f, 0xf2, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x2d, 0xca, 0x97, 0x0,
-    0x0, 0x37, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x0,
-
-    /* U+0059 "Y" */
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x6, 0xcd, 0xef, 0x10, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x4f, 0xed, 0xb4, 0x1d,
-    0xff, 0xf8, 0x0, 0x0, 0x0, 0x0, 0x0, 0xc,
-    0xff, 0xfa, 0x0, 0x2f, 0xff, 0xf2, 0x0, 0x0,
-    0x0, 0x0, 0x5, 0xff, 0xfc, 0x0, 0x0, 0x5f,
-    0xff, 0xb0, 0x0, 0x0, 0x0, 0x1, 0xef, 0xfe,
-    0x10, 0x0, 0x0, 0x8f, 0xff, 0x50, 0x0, 0x0,
-    0x0, 0xaf, 0xff, 0x30, 0x0, 0x0, 0x0, 0xcf,
-    0xfe, 0x10, 0x0, 0x0, 0x4f, 0xff, 0x70, 0x0,
-    0x0, 0x0, 0x2, 0xff, 0xfb, 0x0, 0x0, 0x1e,
-    0xff, 0xc0, 0x0, 0x0, 0x0, 0x0, 0x6, 0xff,
-    0xf7, 0x0, 0xb, 0xff, 0xf1, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0xb, 0xff, 0xf4, 0x8, 0xff, 0xf6,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x1e, 0xff,
-    0xe7, 0xff, 0xfb, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x5f, 0xff, 0xff, 0xff, 0x20, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0xbf, 0xff,
-    0xff, 0x70, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x1, 0xff, 0xff, 0xd0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x9, 0xff, 0xf5,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x7f, 0xff, 0x30, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x5, 0xff, 0xf1, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x3f, 0xff, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x3, 0xff, 0xf0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x2f,
-    0xff, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x3, 0xff, 0xf0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x3f, 0xff,
-    0x10, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x4, 0xff, 0xf2, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x7f, 0xff, 0x50,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0xa, 0xff, 0xf7, 0x0, 0x0, 0x0, 0x0, 0x0,
-
-    /* U+005A "Z" */
-    0xd, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
-    0xff, 0xe0, 0xb, 0xff, 0xff, 0xff, 0xff, 0xff,
-    0xff, 0xff, 0xff, 0xb0, 0x9, 0xff, 0xff, 0xff,
-    0xff, 0xff, 0xff, 0xff, 0xff, 0x90, 0x8, 0xff,
-    0xfe, 0xdc, 0xcb, 0xbb, 0xbb, 0xff, 0xff, 0x60,
-    0x2, 0x41, 0x0, 0x0, 0x0, 0x0, 0x9, 0xff,
-    0xff, 0x20, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x6f, 0xff, 0xf4, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x3, 0xff, 0xff, 0x60, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x1e, 0xff, 0xf7, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0xcf, 0xff, 0x90,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x9, 0xff,
-    0xfb, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x6f, 0xff, 0xd0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x3, 0xff, 0xfe, 0x10, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x2e, 0xff, 0xf3, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x1, 0xdf, 0xff, 0x50,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0xc, 0xff,
-    0xf8, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0xbf, 0xff, 0xb0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x9, 0xff, 0xfd, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x8f, 0xff, 0xf2, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x6, 0xff, 0xff, 0x60,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x5, 0x4f, 0xff,
-    0xf9, 0x0, 0x0, 0x0, 0x0, 0x2, 0x6a, 0xfc,
-    0xaf, 0xff, 0xf9, 0x99, 0x9a, 0xbc, 0xde, 0xff,
-    0xff, 0xf9, 0x9f, 0xff, 0xff, 0xff, 0xff, 0xff,
-    0xff, 0xff, 0xff, 0xf7, 0x7f, 0xff, 0xff, 0xff,
-    0xff, 0xff, 0xff, 0xff, 0xff, 0xf4, 0x5f, 0xff,
-    0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xf1,
-
-    /* U+005B "[" */
-    0x7f, 0xff, 0xff, 0xff, 0x36, 0xff, 0xff, 0xff,
-    0xf2, 0x6f, 0xff, 0xff, 0xff, 0x15, 0xff, 0xfe,
-    0xff, 0xf0, 0x4f, 0xff, 0x40, 0x12, 0x4, 0xff,
-    0xf4, 0x0, 0x0, 0x3f, 0xff, 0x30, 0x0, 0x2,
-    0xff, 0xf3, 0x0, 0x0, 0x2f, 0xff, 0x20, 0x0,
-    0x2, 0xff, 0xf2, 0x0, 0x0, 0x2f, 0xff, 0x20,
-    0x0, 0x1, 0xff, 0xf1, 0x0, 0x0, 0x1f, 0xff,
-    0x10, 0x0, 0x1, 0xff, 0xf1, 0x0, 0x0, 0x1f,
-    0xff, 0x10, 0x0, 0x1, 0xff, 0xf1, 0x0, 0x0,
-    0x1f, 0xff, 0x10, 0x0, 0x1, 0xff, 0xf1, 0x0,
-    0x0, 0x1f, 0xff, 0x10, 0x0, 0x1, 0xff, 0xf1,
-    0x0, 0x0, 0x2f, 0xff, 0x20, 0x0, 0x2, 0xff,
-    0xf2, 0x0, 0x0, 0x2f, 0xff, 0x20, 0x0, 0x2,
-    0xff, 0xf3, 0x0, 0x0, 0x3f, 0xff, 0x30, 0x0,
-    0x4, 0xff, 0xf4, 0x0, 0x0, 0x4f, 0xff, 0x40,
-    0x1, 0x5, 0xff, 0xfd, 0xef, 0xf0, 0x6f, 0xff,
-    0xff, 0xff, 0x6, 0xff, 0xff, 0xff, 0xf2, 0x7f,
-    0xff, 0xff, 0xff, 0x30, 0x10, 0x0, 0x0, 0x10,
-
-    /* U+005C "\\" */
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x3, 0x7c, 0xb0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0xb, 0xff, 0xff, 0x10, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x4f, 0xff, 0xf7,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0xaf,
-    0xff, 0xd0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x1, 0xff, 0xff, 0x30, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x7, 0xff, 0xfa, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0xd, 0xff, 0xf1, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x4f, 0xff,
-    0x70, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0xcf, 0xfe, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x4, 0xff, 0xf5, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0xc, 0xff, 0xd0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x3f, 0xff, 0x40,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0xbf,
-    0xfc, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x3, 0xff, 0xf4, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0xc, 0xff, 0xc0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x4f, 0xff, 0x40, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0xdf, 0xfc,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x6,
-    0xff, 0xf5, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0xe, 0xff, 0xd0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x8f, 0xff, 0x70, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x2, 0xff, 0xff, 0x10,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0xb, 0xff,
-    0xfa, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x5f, 0xff, 0xf4, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0xef, 0xff, 0xe0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x8, 0xff, 0xff, 0xa0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x2f, 0xff, 0xfe,
-    0x20, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0xcf,
-    0xb5, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x3, 0x20, 0x0, 0x0,
-
-    /* U+005D "]" */
-    0x7f, 0xff, 0xff, 0xff, 0x45, 0xff, 0xff, 0xff,
-    0xf3, 0x4f, 0xff, 0xff, 0xff, 0x23, 0xff, 0xff,
-    0xff, 0xf2, 0x2, 0x0, 0x8f, 0xff, 0x10, 0x0,
-    0x7, 0xff, 0xf0, 0x0, 0x0, 0x6f, 0xff, 0x0,
-    0x0, 0x6, 0xff, 0xf0, 0x0, 0x0, 0x5f, 0xff,
-    0x0, 0x0, 0x5, 0xff, 0xf0, 0x0, 0x0, 0x4f,
-    0xfe, 0x0, 0x0, 0x4, 0xff, 0xe0, 0x0, 0x0,
-    0x4f, 0xfe, 0x0, 0x0, 0x4, 0xff, 0xe0, 0x0,
-    0x0, 0x4f, 0xfd, 0x0, 0x0, 0x3, 0xff, 0xd0,
-    0x0, 0x0, 0x3f, 0xfd, 0x0, 0x0, 0x4, 0xff,
-    0xe0, 0x0, 0x0, 0x4f, 0xfe, 0x0, 0x0, 0x4,
-    0xff, 0xe0, 0x0, 0x0, 0x4f, 0xfe, 0x0, 0x0,
-    0x5, 0xff, 0xf0, 0x0, 0x0, 0x5f, 0xff, 0x0,
-    0x0, 0x6, 0xff, 0xf0, 0x0, 0x0, 0x6f, 0xff,
-    0x0, 0x0, 0x7, 0xff, 0xf0, 0x1, 0x0, 0x8f,
-    0xff, 0x12, 0xff, 0xde, 0xff, 0xf2, 0x4f, 0xff,
-    0xff, 0xff, 0x25, 0xff, 0xff, 0xff, 0xf3, 0x6f,
-    0xff, 0xff, 0xff, 0x40, 0x10, 0x0, 0x0, 0x10,
-
-    /* U+005E "^" */
-    0x0, 0x0, 0x3, 0xff, 0xf4, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0xb, 0xff, 0xfc, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x3f, 0xff, 0xff, 0x40, 0x0, 0x0,
-    0x0, 0x0, 0xbf, 0xff, 0xff, 0xc0, 0x0, 0x0,
-    0x0, 0x3, 0xff, 0xf7, 0xff, 0xf4, 0x0, 0x0,
-    0x0, 0xb, 0xff, 0xc0, 0xaf, 0xfd, 0x0, 0x0,
-    0x0, 0x4f, 0xff, 0x30, 0x2f, 0xff, 0x50, 0x0,
-    0x0, 0xcf, 0xfb, 0x0, 0xa, 0xff, 0xd0, 0x0,
-    0x5, 0xff, 0xf4, 0x0, 0x3, 0xff, 0xf6, 0x0,
-    0xd, 0xff, 0xe0, 0x0, 0x0, 0xcf, 0xfe, 0x0,
-    0x7f, 0xff, 0x70, 0x0, 0x0, 0x6f, 0xff, 0x70,
-    0x69, 0xac, 0x10, 0x0, 0x0, 0xc, 0xb9, 0x70,
-
-    /* U+005F "_" */
-    0x55, 0x55, 0x55, 0x55, 0x55, 0x56, 0x66, 0x77,
-    0x89, 0x3e, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
-    0xff, 0xff, 0xf3, 0xcf, 0xff, 0xff, 0xff, 0xff,
-    0xff, 0xff, 0xff, 0xff, 0x2b, 0xff, 0xff, 0xff,
-    0xff, 0xff, 0xff, 0xff, 0xff, 0xf0,
-
-    /* U+0060 "`" */
-    0x0, 0x0, 0x0, 0x0, 0x3d, 0x0, 0x0, 0x1e,
-    0xf8, 0x0, 0x8, 0xff, 0xf3, 0x0, 0xd, 0xff,
-    0xe1, 0x0, 0x1e, 0xff, 0xc0, 0x0, 0x2e, 0xff,
-    0x90, 0x0, 0x1d, 0xb1, 0x0, 0x0, 0x0, 0x0,
-
-    /* U+0061 "a" */
-    0x0, 0x0, 0x1, 0x8d, 0xff, 0xd8, 0x16, 0xbc,
-    0xdb, 0x0, 0x0, 0x6, 0xff, 0xff, 0xff, 0xfe,
-    0xbf, 0xff, 0xa0, 0x0, 0x7, 0xff, 0xff, 0xec,
-    0xcf, 0xff, 0xff, 0xf9, 0x0, 0x3, 0xff, 0xff,
-    0x50, 0x0, 0x7, 0xff, 0xff, 0x70, 0x0, 0xdf,
-    0xff, 0x40, 0x0, 0x0, 0x6, 0xff, 0xf6, 0x0,
-    0x5f, 0xff, 0xb0, 0x0, 0x0, 0x0, 0xe, 0xff,
-    0x60, 0xa, 0xff, 0xf4, 0x0, 0x0, 0x0, 0x0,
-    0xdf, 0xf5, 0x0, 0xef, 0xff, 0x10, 0x0, 0x0,
-    0x0, 0xd, 0xff, 0x50, 0xf, 0xff, 0xe0, 0x0,
-    0x0, 0x0, 0x0, 0xcf, 0xf5, 0x1, 0xff, 0xfd,
-    0x0, 0x0, 0x0, 0x0, 0xc, 0xff, 0x50, 0xf,
-    0xff, 0xe0, 0x0, 0x0, 0x0, 0x0, 0xdf, 0xf6,
-    0x0, 0xdf, 0xff, 0x0, 0x0, 0x0, 0x0, 0xe,
-    0xff, 0x70, 0x9, 0xff, 0xf4, 0x0, 0x0, 0x0,
-    0x0, 0xff, 0xf8, 0x0, 0x3f, 0xff, 0xb0, 0x0,
-    0x0, 0x0, 0x9f, 0xff, 0xa0, 0x0, 0xbf, 0xff,
-    0x80, 0x0, 0x2, 0xaf, 0xff, 0xfc, 0x0, 0x2,
-    0xef, 0xff, 0xfb, 0xbd, 0xff, 0xef, 0xff, 0xf0,
-    0x0, 0x2, 0xef, 0xff, 0xff, 0xff, 0xa7, 0xff,
-    0xff, 0x20, 0x0, 0x1, 0x8d, 0xff, 0xd9, 0x30,
-    0xaf, 0xff, 0xf6,
-
-    /* U+0062 "b" */
-    0x39, 0xab, 0xd2, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x4f, 0xff, 0xf1, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x1f, 0xff, 0xf0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0xf, 0xff, 0xe0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0xe, 0xff, 0xc0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0xd, 0xff, 0xb0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0xc, 0xff,
-    0xa0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0xb,
-    0xff, 0x90, 0x4a, 0xef, 0xeb, 0x50, 0x0, 0x0,
-    0xb, 0xff, 0x99, 0xff, 0xff, 0xff, 0xfc, 0x10,
-    0x0, 0xb, 0xff, 0xef, 0xfd, 0xbc, 0xff, 0xff,
-    0xd2, 0x0, 0xa, 0xff, 0xfd, 0x30, 0x0, 0x1a,
-    0xff, 0xfc, 0x0, 0xa, 0xff, 0xe1, 0x0, 0x0,
-    0x0, 0xbf, 0xff, 0x70, 0xb, 0xff, 0x70, 0x0,
-    0x0, 0x0, 0x1f, 0xff, 0xe0, 0xb, 0xff, 0x70,
-    0x0, 0x0, 0x0, 0xb, 0xff, 0xf4, 0xc, 0xff,
-    0x70, 0x0, 0x0, 0x0, 0x7, 0xff, 0xf8, 0xc,
-    0xff, 0x70, 0x0, 0x0, 0x0, 0x5, 0xff, 0xfa,
-    0xd, 0xff, 0x70, 0x0, 0x0, 0x0, 0x4, 0xff,
-    0xfa, 0xd, 0xff, 0x80, 0x0, 0x0, 0x0, 0x5,
-    0xff, 0xf9, 0xd, 0xff, 0x80, 0x0, 0x0, 0x0,
-    0x7, 0xff, 0xf7, 0xf, 0xff, 0xa0, 0x0, 0x0,
-    0x0, 0xb, 0xff, 0xf2, 0xf, 0xff, 0xf5, 0x0,
-    0x0, 0x0, 0x4f, 0xff, 0xd0, 0x1f, 0xff, 0xff,
-    0x82, 0x0, 0x6, 0xff, 0xff, 0x50, 0x2f, 0xff,
-    0xcd, 0xff, 0xfe, 0xff, 0xff, 0xfa, 0x0, 0x4f,
-    0xff, 0xc2, 0xcf, 0xff, 0xff, 0xff, 0xa0, 0x0,
-    0x6e, 0xcb, 0x80, 0x6, 0xbe, 0xfe, 0xb5, 0x0,
-    0x0,
-
-    /* U+0063 "c" */
-    0x0, 0x0, 0x1, 0x7c, 0xef, 0xec, 0x82, 0x0,
-    0x0, 0x5, 0xff, 0xff, 0xff, 0xff, 0xf6, 0x0,
-    0x7, 0xff, 0xff, 0xca, 0xbf, 0xff, 0x40, 0x4,
-    0xff, 0xfd, 0x20, 0x0, 0x19, 0xf1, 0x0, 0xdf,
-    0xff, 0x20, 0x0, 0x0, 0x7, 0x0, 0x6f, 0xff,
-    0x80, 0x0, 0x0, 0x0, 0x0, 0xb, 0xff, 0xf2,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0xef, 0xff, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0xf, 0xff, 0xd0, 0x0,
-    0x0, 0x0, 0x0, 0x1, 0xff, 0xfd, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0xf, 0xff, 0xe0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0xdf, 0xff, 0x10, 0x0, 0x0,
-    0x0, 0x0, 0x8, 0xff, 0xf7, 0x0, 0x0, 0x0,
-    0x0, 0x40, 0x3f, 0xff, 0xf2, 0x0, 0x0, 0x1,
-    0xb7, 0x0, 0x9f, 0xff, 0xe6, 0x10, 0x16, 0xef,
-    0x60, 0x0, 0xcf, 0xff, 0xff, 0xff, 0xff, 0xf5,
-    0x0, 0x0, 0x9f, 0xff, 0xff, 0xff, 0xfe, 0x20,
-    0x0, 0x0, 0x38, 0xcf, 0xfe, 0xc7, 0x10,
-
-    /* U+0064 "d" */
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x3, 0x57,
-    0x87, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x9f, 0xff, 0xc0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x6, 0xff, 0xfb, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x4f, 0xff, 0xa0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x2, 0xff, 0xf9, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x1f, 0xff,
-    0x90, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0xff, 0xf8, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0xe, 0xff, 0x80, 0x0, 0x0, 0x1, 0x8d,
-    0xff, 0xd8, 0x10, 0xef, 0xf7, 0x0, 0x0, 0x6,
-    0xff, 0xff, 0xff, 0xfe, 0x4d, 0xff, 0x70, 0x0,
-    0x7, 0xff, 0xff, 0xeb, 0xcf, 0xff, 0xef, 0xf7,
-    0x0, 0x3, 0xff, 0xff, 0x50, 0x0, 0x7, 0xff,
-    0xff, 0x70, 0x0, 0xdf, 0xff, 0x40, 0x0, 0x0,
-    0x6, 0xff, 0xf7, 0x0, 0x5f, 0xff, 0xa0, 0x0,
-    0x0, 0x0, 0xd, 0xff, 0x70, 0xa, 0xff, 0xf4,
-    0x0, 0x0, 0x0, 0x0, 0xcf, 0xf7, 0x0, 0xef,
-    0xff, 0x0, 0x0, 0x0, 0x0, 0xd, 0xff, 0x70,
-    0xf, 0xff, 0xe0, 0x0, 0x0, 0x0, 0x0, 0xdf,
-    0xf8, 0x1, 0xff, 0xfd, 0x0, 0x0, 0x0, 0x0,
-    0xe, 0xff, 0x90, 0xf, 0xff, 0xe0, 0x0, 0x0,
-    0x0, 0x0, 0xff, 0xfa, 0x0, 0xdf, 0xff, 0x0,
-    0x0, 0x0, 0x0, 0xf, 0xff, 0xb0, 0x9, 0xff,
-    0xf5, 0x0, 0x0, 0x0, 0x1, 0xff, 0xfc, 0x0,
-    0x3f, 0xff, 0xc0, 0x0, 0x0, 0x0, 0xbf, 0xff,
-    0xe0, 0x0, 0xbf, 0xff, 0xb3, 0x0, 0x4, 0xcf,
-    0xff, 0xff, 0x0, 0x2, 0xef, 0xff, 0xff, 0xef,
-    0xff, 0xdf, 0xff, 0xf3, 0x0, 0x2, 0xef, 0xff,
-    0xff, 0xff, 0x87, 0xff, 0xff, 0x60, 0x0, 0x1,
-    0x8d, 0xff, 0xd9, 0x20, 0xaf, 0xff, 0xfb,
-
-    /* U+0065 "e" */
-    0x0, 0x0, 0x1, 0x8d, 0xff, 0xd9, 0x20, 0x0,
-    0x0, 0x0, 0x5f, 0xff, 0xff, 0xff, 0xf7, 0x0,
-    0x0, 0x5, 0xff, 0xff, 0xb9, 0xdf, 0xff, 0x70,
-    0x0, 0x2f, 0xff, 0xd2, 0x0, 0x5, 0xff, 0xf2,
-    0x0, 0xcf, 0xff, 0x30, 0x0, 0x0, 0xbf, 0xf8,
-    0x4, 0xff, 0xfa, 0x0, 0x0, 0x0, 0x8f, 0xfc,
-    0x9, 0xff, 0xf5, 0x0, 0x0, 0x0, 0x8f, 0xfd,
-    0xd, 0xff, 0xf5, 0x55, 0x56, 0x78, 0xdf, 0xfc,
-    0xf, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xfa,
-    0x1f, 0xff, 0xff, 0xff, 0xed, 0xdd, 0xde, 0xf6,
-    0xf, 0xff, 0xf2, 0x10, 0x0, 0x0, 0x0, 0x0,
-    0xe, 0xff, 0xf1, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0xa, 0xff, 0xf5, 0x0, 0x0, 0x0, 0x0, 0x40,
-    0x4, 0xff, 0xfd, 0x0, 0x0, 0x0, 0x8, 0xd0,
-    0x0, 0xbf, 0xff, 0xb3, 0x0, 0x27, 0xef, 0xc0,
-    0x0, 0x1d, 0xff, 0xff, 0xff, 0xff, 0xff, 0xb0,
-    0x0, 0x1, 0xbf, 0xff, 0xff, 0xff, 0xff, 0x80,
-    0x0, 0x0, 0x4, 0xad, 0xff, 0xeb, 0x72, 0x0,
-
-    /* U+0066 "f" */
-    0x0, 0x0, 0x0, 0x5, 0xbe, 0xfc, 0x0, 0x0,
-    0x0, 0x1c, 0xff, 0xff, 0xf0, 0x0, 0x0, 0xc,
-    0xff, 0xff, 0xff, 0x20, 0x0, 0x7, 0xff, 0xff,
-    0xff, 0xf5, 0x0, 0x0, 0xef, 0xff, 0x70, 0x4,
-    0x30, 0x0, 0x2f, 0xff, 0xb0, 0x0, 0x0, 0x0,
-    0x3, 0xff, 0xf6, 0x0, 0x0, 0x0, 0x0, 0x4f,
-    0xff, 0x40, 0x0, 0x0, 0xcf, 0xff, 0xff, 0xff,
-    0xff, 0xf8, 0x6, 0xff, 0xff, 0xff, 0xff, 0xff,
-    0x50, 0x1f, 0xff, 0xff, 0xff, 0xff, 0xf3, 0x0,
-    0x32, 0x5f, 0xff, 0x10, 0x13, 0x0, 0x0, 0x4,
-    0xff, 0xf1, 0x0, 0x0, 0x0, 0x0, 0x4f, 0xff,
-    0x10, 0x0, 0x0, 0x0, 0x4, 0xff, 0xf1, 0x0,
-    0x0, 0x0, 0x0, 0x4f, 0xff, 0x20, 0x0, 0x0,
-    0x0, 0x5, 0xff, 0xf2, 0x0, 0x0, 0x0, 0x0,
-    0x5f, 0xff, 0x30, 0x0, 0x0, 0x0, 0x6, 0xff,
-    0xf3, 0x0, 0x0, 0x0, 0x0, 0x7f, 0xff, 0x40,
-    0x0, 0x0, 0x0, 0x8, 0xff, 0xf5, 0x0, 0x0,
-    0x0, 0x0, 0x9f, 0xff, 0x70, 0x0, 0x0, 0x0,
-    0xb, 0xff, 0xf8, 0x0, 0x0, 0x0, 0x0, 0xdf,
-    0xff, 0xb0, 0x0, 0x0, 0x0, 0xc, 0xba, 0x96,
-    0x0, 0x0, 0x0,
-
-    /* U+0067 "g" */
-    0x0, 0x0, 0x1, 0x8d, 0xff, 0xd8, 0x16, 0xac,
-    0xde, 0x20, 0x0, 0x6, 0xff, 0xff, 0xff, 0xfe,
-    0xbf, 0xff, 0xf0, 0x0, 0x7, 0xff, 0xff, 0xeb,
-    0xcf, 0xff, 0xff, 0xfe, 0x0, 0x3, 0xff, 0xff,
-    0x50, 0x0, 0x7, 0xff, 0xff, 0xd0, 0x0, 0xdf,
-    0xff, 0x40, 0x0, 0x0, 0x6, 0xff, 0xfb, 0x0,
-    0x5f, 0xff, 0xa0, 0x0, 0x0, 0x0, 0xf, 0xff,
-    0xa0, 0xa, 0xff, 0xf4, 0x0, 0x0, 0x0, 0x0,
-    0xff, 0xf9, 0x0, 0xef, 0xff, 0x0, 0x0, 0x0,
-    0x0, 0xe, 0xff, 0x90, 0xf, 0xff, 0xe0, 0x0,
-    0x0, 0x0, 0x0, 0xdf, 0xf8, 0x1, 0xff, 0xfd,
-    0x0, 0x0, 0x0, 0x0, 0xd, 0xff, 0x80, 0xf,
-    0xff, 0xe0, 0x0, 0x0, 0x0, 0x0, 0xdf, 0xf7,
-    0x0, 0xdf, 0xff, 0x0, 0x0, 0x0, 0x0, 0xd,
-    0xff, 0x70, 0x9, 0xff, 0xf5, 0x0, 0x0, 0x0,
-    0x1, 0xff, 0xf7, 0x0, 0x3f, 0xff, 0xc0, 0x0,
-    0x0, 0x0, 0xbf, 0xff, 0x60, 0x0, 0xbf, 0xff,
-    0xb3, 0x0, 0x5, 0xcf, 0xff, 0xf6, 0x0, 0x2,
-    0xef, 0xff, 0xff, 0xef, 0xff, 0x8e, 0xff, 0x60,
-    0x0, 0x2, 0xef, 0xff, 0xff, 0xff, 0x80, 0xff,
-    0xf6, 0x0, 0x0, 0x1, 0x8d, 0xff, 0xd9, 0x20,
-    0x1f, 0xff, 0x40, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x4, 0xff, 0xf1, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0xcf, 0xfa, 0x0, 0x0, 0xb9,
-    0x30, 0x0, 0x0, 0x0, 0x8f, 0xff, 0x30, 0x0,
-    0xb, 0xff, 0xeb, 0x87, 0x78, 0xdf, 0xff, 0x80,
-    0x0, 0x0, 0xaf, 0xff, 0xff, 0xff, 0xff, 0xff,
-    0x90, 0x0, 0x0, 0x8, 0xff, 0xff, 0xff, 0xff,
-    0xfe, 0x60, 0x0, 0x0, 0x0, 0x27, 0xad, 0xef,
-    0xfe, 0xb6, 0x10, 0x0, 0x0, 0x0,
-
-    /* U+0068 "h" */
-    0x39, 0xbc, 0xd2, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x4f, 0xff, 0xf1, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x1f, 0xff, 0xf0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0xf, 0xff, 0xe0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0xe, 0xff, 0xc0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0xd, 0xff, 0xb0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0xc, 0xff,
-    0xa0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0xb,
-    0xff, 0x90, 0x1, 0x7c, 0xee, 0xb4, 0x0, 0x0,
-    0xb, 0xff, 0x90, 0x5e, 0xff, 0xff, 0xff, 0x80,
-    0x0, 0xb, 0xff, 0x88, 0xff, 0xff, 0xff, 0xff,
-    0xf6, 0x0, 0xa, 0xff, 0xef, 0xe7, 0x31, 0x39,
-    0xff, 0xfe, 0x10, 0xa, 0xff, 0xfc, 0x10, 0x0,
-    0x0, 0x7f, 0xff, 0x60, 0xb, 0xff, 0xe1, 0x0,
-    0x0, 0x0, 0xe, 0xff, 0xb0, 0xb, 0xff, 0x70,
-    0x0, 0x0, 0x0, 0xa, 0xff, 0xd0, 0xb, 0xff,
-    0x70, 0x0, 0x0, 0x0, 0x8, 0xff, 0xf0, 0xc,
-    0xff, 0x70, 0x0, 0x0, 0x0, 0x7, 0xff, 0xf0,
-    0xc, 0xff, 0x70, 0x0, 0x0, 0x0, 0x6, 0xff,
-    0xf0, 0xd, 0xff, 0x70, 0x0, 0x0, 0x0, 0x6,
-    0xff, 0xf0, 0xd, 0xff, 0x80, 0x0, 0x0, 0x0,
-    0x7, 0xff, 0xf0, 0xe, 0xff, 0x80, 0x0, 0x0,
-    0x0, 0x8, 0xff, 0xf1, 0xf, 0xff, 0x90, 0x0,
-    0x0, 0x0, 0x8, 0xff, 0xf1, 0xf, 0xff, 0xa0,
-    0x0, 0x0, 0x0, 0xa, 0xff, 0xf2, 0x2f, 0xff,
-    0xb0, 0x0, 0x0, 0x0, 0xb, 0xff, 0xf4, 0x3f,
-    0xff, 0xc0, 0x0, 0x0, 0x0, 0xd, 0xff, 0xf5,
-    0x5f, 0xff, 0xd0, 0x0, 0x0, 0x0, 0xf, 0xff,
-    0xf7, 0x24, 0x31, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0,
-
-    /* U+0069 "i" */
-    0x8, 0x9b, 0xc3, 0xf, 0xff, 0xf2, 0xf, 0xff,
-    0xf1, 0xf, 0xff, 0xf0, 0x1a, 0x87, 0x50, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x3a, 0xbc, 0xe2,
-    0x4f, 0xff, 0xf0, 0x1f, 0xff, 0xe0, 0xe, 0xff,
-    0xb0, 0xb, 0xff, 0x90, 0xa, 0xff, 0x80, 0x9,
-    0xff, 0x70, 0x9, 0xff, 0x60, 0x8, 0xff, 0x60,
-    0x9, 0xff, 0x50, 0xa, 0xff, 0x50, 0xa, 0xff,
-    0x60, 0xb, 0xff, 0x60, 0xd, 0xff, 0x70, 0xf,
-    0xff, 0x90, 0x1f, 0xff, 0xb0, 0x4f, 0xff, 0xc0,
-    0x5c, 0xb9, 0x70,
-
-    /* U+006A "j" */
-    0x0, 0x0, 0x4, 0x67, 0x95, 0x0, 0x0, 0xc,
-    0xff, 0xf6, 0x0, 0x0, 0xb, 0xff, 0xf4, 0x0,
-    0x0, 0xc, 0xff, 0xf4, 0x0, 0x0, 0xb, 0xca,
-    0x92, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x6, 0x89, 0xa5,
-    0x0, 0x0, 0xf, 0xff, 0xf5, 0x0, 0x0, 0xd,
-    0xff, 0xf3, 0x0, 0x0, 0xb, 0xff, 0xf2, 0x0,
-    0x0, 0xa, 0xff, 0xf0, 0x0, 0x0, 0xa, 0xff,
-    0xf0, 0x0, 0x0, 0x9, 0xff, 0xe0, 0x0, 0x0,
-    0x8, 0xff, 0xd0, 0x0, 0x0, 0x8, 0xff, 0xd0,
-    0x0, 0x0, 0x7, 0xff, 0xd0, 0x0, 0x0, 0x7,
-    0xff, 0xd0, 0x0, 0x0, 0x7, 0xff, 0xd0, 0x0,
-    0x0, 0x6, 0xff, 0xd0, 0x0, 0x0, 0x6, 0xff,
-    0xd0, 0x0, 0x0, 0x6, 0xff, 0xd0, 0x0, 0x0,
-    0x6, 0xff, 0xd0, 0x0, 0x0, 0x6, 0xff, 0xd0,
-    0x0, 0x0, 0x7, 0xff, 0xc0, 0x0, 0x0, 0x9,
-    0xff, 0xb0, 0x0, 0x0, 0xe, 0xff, 0xa0, 0x62,
-    0x1, 0xaf, 0xff, 0x60, 0xdf, 0xff, 0xff, 0xfe,
-    0x0, 0xaf, 0xff, 0xff, 0xf5, 0x0, 0x8f, 0xff,
-    0xff, 0x60, 0x0, 0x5f, 0xfd, 0x82, 0x0, 0x0,
-
-    /* U+006B "k" */
-    0x38, 0xab, 0xc2, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x4, 0xff, 0xff, 0x10, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x2f, 0xff, 0xf0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0xff, 0xfe, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0xe, 0xff, 0xc0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0xdf, 0xfb, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0xc, 0xff, 0xa0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0xbf, 0xfa, 0x0, 0x0,
-    0x2, 0xc5, 0x0, 0x0, 0xb, 0xff, 0x90, 0x0,
-    0x1, 0xdf, 0xfd, 0x40, 0x0, 0xaf, 0xf9, 0x0,
-    0x1, 0xdf, 0xff, 0xf9, 0x0, 0xa, 0xff, 0x90,
-    0x1, 0xcf, 0xff, 0xe4, 0x0, 0x0, 0xaf, 0xf8,
-    0x1, 0xcf, 0xff, 0xc1, 0x0, 0x0, 0xb, 0xff,
-    0x81, 0xdf, 0xff, 0xa0, 0x0, 0x0, 0x0, 0xbf,
-    0xf9, 0xdf, 0xff, 0x80, 0x0, 0x0, 0x0, 0xc,
-    0xff, 0xff, 0xff, 0xc0, 0x0, 0x0, 0x0, 0x0,
-    0xcf, 0xff, 0xff, 0xff, 0x60, 0x0, 0x0, 0x0,
-    0xd, 0xff, 0xff, 0xcf, 0xff, 0x20, 0x0, 0x0,
-    0x0, 0xdf, 0xfe, 0x31, 0xef, 0xfc, 0x0, 0x0,
-    0x0, 0xe, 0xff, 0x90, 0x4, 0xff, 0xf9, 0x0,
-    0x0, 0x0, 0xff, 0xf9, 0x0, 0x9, 0xff, 0xf5,
-    0x0, 0x0, 0xf, 0xff, 0xa0, 0x0, 0xe, 0xff,
-    0xf2, 0x0, 0x1, 0xff, 0xfa, 0x0, 0x0, 0x4f,
-    0xff, 0xd0, 0x0, 0x3f, 0xff, 0xb0, 0x0, 0x0,
-    0xaf, 0xff, 0xa0, 0x4, 0xff, 0xfd, 0x0, 0x0,
-    0x1, 0xef, 0xff, 0x70, 0x5c, 0xb9, 0x70, 0x0,
-    0x0, 0x6, 0xcb, 0xa8, 0x10,
-
-    /* U+006C "l" */
-    0x38, 0xab, 0xc2, 0x4f, 0xff, 0xf1, 0x2f, 0xff,
-    0xf0, 0xf, 0xff, 0xe0, 0xe, 0xff, 0xd0, 0xd,
-    0xff, 0xb0, 0xc, 0xff, 0xa0, 0xb, 0xff, 0xa0,
-    0xb, 0xff, 0xa0, 0xa, 0xff, 0x90, 0xa, 0xff,
-    0x90, 0xa, 0xff, 0x80, 0xb, 0xff, 0x80, 0xb,
-    0xff, 0x70, 0xc, 0xff, 0x70, 0xc, 0xff, 0x70,
-    0xd, 0xff, 0x70, 0xd, 0xff, 0x80, 0xe, 0xff,
-    0x80, 0xf, 0xff, 0x90, 0xf, 0xff, 0x90, 0x1f,
-    0xff, 0xa0, 0x3f, 0xff, 0xb0, 0x4f, 0xff, 0xd0,
-    0x5c, 0xb9, 0x70,
-
-    /* U+006D "m" */
-    0x3a, 0xcd, 0xe2, 0x1, 0x7c, 0xef, 0xb4, 0x0,
-    0x0, 0x2, 0x9d, 0xfe, 0x91, 0x0, 0x4, 0xff,
-    0xff, 0x5, 0xef, 0xff, 0xff, 0xf5, 0x0, 0x8,
-    0xff, 0xff, 0xff, 0xe2, 0x0, 0x1f, 0xff, 0xd8,
-    0xff, 0xff, 0xff, 0xff, 0xf2, 0xc, 0xff, 0xff,
-    0xff, 0xff, 0xc0, 0x0, 0xef, 0xff, 0xfe, 0x63,
-    0x14, 0xbf, 0xff, 0xab, 0xfc, 0x42, 0x26, 0xef,
-    0xff, 0x40, 0xb, 0xff, 0xfc, 0x10, 0x0, 0x0,
-    0xbf, 0xff, 0xf8, 0x0, 0x0, 0x2, 0xff, 0xfa,
-    0x0, 0xaf, 0xfe, 0x10, 0x0, 0x0, 0x4, 0xff,
-    0xfa, 0x0, 0x0, 0x0, 0x9, 0xff, 0xe0, 0xa,
-    0xff, 0x70, 0x0, 0x0, 0x0, 0xf, 0xff, 0x50,
-    0x0, 0x0, 0x0, 0x5f, 0xff, 0x0, 0x9f, 0xf6,
-    0x0, 0x0, 0x0, 0x0, 0xef, 0xf6, 0x0, 0x0,
-    0x0, 0x3, 0xff, 0xf1, 0x8, 0xff, 0x50, 0x0,
-    0x0, 0x0, 0xd, 0xff, 0x70, 0x0, 0x0, 0x0,
-    0x2f, 0xff, 0x10, 0x9f, 0xf5, 0x0, 0x0, 0x0,
-    0x0, 0xcf, 0xf7, 0x0, 0x0, 0x0, 0x1, 0xff,
-    0xf2, 0x9, 0xff, 0x50, 0x0, 0x0, 0x0, 0xc,
-    0xff, 0x70, 0x0, 0x0, 0x0, 0x1f, 0xff, 0x20,
-    0xaf, 0xf6, 0x0, 0x0, 0x0, 0x0, 0xdf, 0xf7,
-    0x0, 0x0, 0x0, 0x2, 0xff, 0xf2, 0xb, 0xff,
-    0x60, 0x0, 0x0, 0x0, 0xd, 0xff, 0x80, 0x0,
-    0x0, 0x0, 0x3f, 0xff, 0x30, 0xcf, 0xf7, 0x0,
-    0x0, 0x0, 0x0, 0xef, 0xf8, 0x0, 0x0, 0x0,
-    0x3, 0xff, 0xf3, 0xe, 0xff, 0x80, 0x0, 0x0,
-    0x0, 0xf, 0xff, 0x90, 0x0, 0x0, 0x0, 0x5f,
-    0xff, 0x40, 0xff, 0xfa, 0x0, 0x0, 0x0, 0x1,
-    0xff, 0xfb, 0x0, 0x0, 0x0, 0x7, 0xff, 0xf6,
-    0x3f, 0xff, 0xb0, 0x0, 0x0, 0x0, 0x3f, 0xff,
-    0xd0, 0x0, 0x0, 0x0, 0x8f, 0xff, 0x75, 0xff,
-    0xfd, 0x0, 0x0, 0x0, 0x5, 0xff, 0xfe, 0x0,
-    0x0, 0x0, 0xa, 0xff, 0xf9, 0x24, 0x31, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0,
-
-    /* U+006E "n" */
-    0x3a, 0xcd, 0xe2, 0x1, 0x7c, 0xee, 0xb4, 0x0,
-    0x0, 0x4f, 0xff, 0xf0, 0x5e, 0xff, 0xff, 0xff,
-    0x80, 0x0, 0x1f, 0xff, 0xd8, 0xff, 0xff, 0xff,
-    0xff, 0xf5, 0x0, 0xe, 0xff, 0xff, 0xe7, 0x31,
-    0x39, 0xff, 0xfe, 0x0, 0xb, 0xff, 0xfc, 0x10,
-    0x0, 0x0, 0x7f, 0xff, 0x40, 0xa, 0xff, 0xe1,
-    0x0, 0x0, 0x0, 0xe, 0xff, 0x80, 0xa, 0xff,
-    0x70, 0x0, 0x0, 0x0, 0xa, 0xff, 0xa0, 0x9,
-    0xff, 0x60, 0x0, 0x0, 0x0, 0x8, 0xff, 0xc0,
-    0x8, 0xff, 0x50, 0x0, 0x0, 0x0, 0x7, 0xff,
-    0xc0, 0x9, 0xff, 0x50, 0x0, 0x0, 0x0, 0x6,
-    0xff, 0xd0, 0x9, 0xff, 0x50, 0x0, 0x0, 0x0,
-    0x6, 0xff, 0xd0, 0xa, 0xff, 0x60, 0x0, 0x0,
-    0x0, 0x7, 0xff, 0xd0, 0xb, 0xff, 0x60, 0x0,
-    0x0, 0x0, 0x8, 0xff, 0xe0, 0xc, 0xff, 0x70,
-    0x0, 0x0, 0x0, 0x8, 0xff, 0xe0, 0xe, 0xff,
-    0x80, 0x0, 0x0, 0x0, 0xa, 0xff, 0xf0, 0xf,
-    0xff, 0xa0, 0x0, 0x0, 0x0, 0xb, 0xff, 0xf1,
-    0x3f, 0xff, 0xb0, 0x0, 0x0, 0x0, 0xd, 0xff,
-    0xf2, 0x5f, 0xff, 0xd0, 0x0, 0x0, 0x0, 0xf,
-    0xff, 0xf4, 0x24, 0x31, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x0,
-
-    /* U+006F "o" */
-    0x0, 0x0, 0x1, 0x8c, 0xff, 0xeb, 0x60, 0x0,
-    0x0, 0x0, 0x0, 0x6f, 0xff, 0xff, 0xff, 0xfe,
-    0x30, 0x0, 0x0, 0x9, 0xff, 0xfe, 0x75, 0x7d,
-    0xff, 0xf5, 0x0, 0x0, 0x5f, 0xff, 0xd1, 0x0,
-    0x0, 0xaf, 0xff, 0x20, 0x1, 0xff, 0xff, 0x20,
-    0x0, 0x0, 0xe, 0xff, 0xb0, 0x7, 0xff, 0xf9,
-    0x0, 0x0, 0x0, 0x9, 0xff, 0xf2, 0xc, 0xff,
-    0xf3, 0x0, 0x0, 0x0, 0x5, 0xff, 0xf6, 0xf,
-    0xff, 0xe0, 0x0, 0x0, 0x0, 0x3, 0xff, 0xf9,
-    0x1f, 0xff, 0xd0, 0x0, 0x0, 0x0, 0x3, 0xff,
-    0xfa, 0x1f, 0xff, 0xc0, 0x0, 0x0, 0x0, 0x3,
-    0xff, 0xfa, 0xf, 0xff, 0xc0, 0x0, 0x0, 0x0,
-    0x5, 0xff, 0xf8, 0xd, 0xff, 0xe0, 0x0, 0x0,
-    0x0, 0x9, 0xff, 0xf5, 0x8, 0xff, 0xf2, 0x0,
-    0x0, 0x0, 0xe, 0xff, 0xf1, 0x2, 0xff, 0xf8,
-    0x0, 0x0, 0x0, 0x8f, 0xff, 0x90, 0x0, 0x8f,
-    0xff, 0x40, 0x0, 0x6, 0xff, 0xfe, 0x0, 0x0,
-    0xc, 0xff, 0xfa, 0x67, 0xcf, 0xff, 0xe3, 0x0,
-    0x0, 0x0, 0x9f, 0xff, 0xff, 0xff, 0xfd, 0x20,
-    0x0, 0x0, 0x0, 0x3, 0x9d, 0xff, 0xeb, 0x50,
-    0x0, 0x0,
-
-    /* U+0070 "p" */
-    0x5f, 0xff, 0xfe, 0x1, 0x7c, 0xef, 0xd9, 0x20,
-    0x0, 0x1, 0xff, 0xff, 0xb4, 0xef, 0xff, 0xff,
-    0xff, 0x50, 0x0, 0xd, 0xff, 0xfd, 0xff, 0xff,
-    0xef, 0xff, 0xff, 0x50, 0x0, 0xbf, 0xff, 0xfe,
-    0x61, 0x0, 0x19, 0xff, 0xfe, 0x0, 0x9, 0xff,
-    0xfe, 0x10, 0x0, 0x0, 0x9, 0xff, 0xf8, 0x0,
-    0x7f, 0xff, 0x50, 0x0, 0x0, 0x0, 0x1f, 0xff,
-    0xd0, 0x6, 0xff, 0xf3, 0x0, 0x0, 0x0, 0x0,
-    0xcf, 0xff, 0x20, 0x5f, 0xff, 0x30, 0x0, 0x0,
-    0x0, 0xa, 0xff, 0xf4, 0x4, 0xff, 0xf2, 0x0,
-    0x0, 0x0, 0x0, 0x9f, 0xff, 0x50, 0x3f, 0xff,
-    0x10, 0x0, 0x0, 0x0, 0xa, 0xff, 0xf5, 0x3,
-    0xff, 0xf1, 0x0, 0x0, 0x0, 0x0, 0xcf, 0xff,
-    0x30, 0x2f, 0xff, 0x10, 0x0, 0x0, 0x0, 0xf,
-    0xff, 0xf0, 0x2, 0xff, 0xf2, 0x0, 0x0, 0x0,
-    0x6, 0xff, 0xf9, 0x0, 0x2f, 0xff, 0xa0, 0x0,
-    0x0, 0x1, 0xef, 0xff, 0x20, 0x2, 0xff, 0xff,
-    0xa1, 0x0, 0x3, 0xdf, 0xff, 0x70, 0x0, 0x2f,
-    0xff, 0xdf, 0xfc, 0xbd, 0xff, 0xff, 0xa0, 0x0,
-    0x2, 0xff, 0xf3, 0xdf, 0xff, 0xff, 0xff, 0x90,
-    0x0, 0x0, 0x2f, 0xff, 0x20, 0x6c, 0xef, 0xea,
-    0x30, 0x0, 0x0, 0x2, 0xff, 0xf3, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x2f, 0xff, 0x40,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x3, 0xff,
-    0xf6, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x4f, 0xff, 0x80, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x4, 0xff, 0xfa, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x5f, 0xff, 0xc0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x4, 0xcb, 0x97, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-
-    /* U+0071 "q" */
-    0x0, 0x0, 0x1, 0x8d, 0xff, 0xd8, 0x16, 0xac,
-    0xde, 0x0, 0x0, 0x6, 0xff, 0xff, 0xff, 0xfe,
-    0xbf, 0xff, 0xd0, 0x0, 0x7, 0xff, 0xff, 0xeb,
-    0xce, 0xff, 0xff, 0xfb, 0x0, 0x3, 0xff, 0xff,
-    0x50, 0x0, 0x7, 0xff, 0xff, 0xa0, 0x0, 0xdf,
-    0xff, 0x40, 0x0, 0x0, 0x6, 0xff, 0xf9, 0x0,
-    0x5f, 0xff, 0xa0, 0x0, 0x0, 0x0, 0x1f, 0xff,
-    0x80, 0xa, 0xff, 0xf4, 0x0, 0x0, 0x0, 0x0,
-    0xff, 0xf7, 0x0, 0xef, 0xff, 0x0, 0x0, 0x0,
-    0x0, 0xf, 0xff, 0x60, 0xf, 0xff, 0xe0, 0x0,
-    0x0, 0x0, 0x0, 0xef, 0xf6, 0x1, 0xff, 0xfd,
-    0x0, 0x0, 0x0, 0x0, 0xe, 0xff, 0x50, 0xf,
-    0xff, 0xe0, 0x0, 0x0, 0x0, 0x0, 0xef, 0xf5,
-    0x0, 0xdf, 0xff, 0x0, 0x0, 0x0, 0x0, 0xe,
-    0xff, 0x50, 0x9, 0xff, 0xf5, 0x0, 0x0, 0x0,
-    0x1, 0xff, 0xf4, 0x0, 0x3f, 0xff, 0xc0, 0x0,
-    0x0, 0x0, 0xbf, 0xff, 0x40, 0x0, 0xbf, 0xff,
-    0xb3, 0x0, 0x4, 0xcf, 0xff, 0xf4, 0x0, 0x2,
-    0xef, 0xff, 0xff, 0xef, 0xff, 0x8f, 0xff, 0x40,
-    0x0, 0x2, 0xef, 0xff, 0xff, 0xff, 0x80, 0xff,
-    0xf4, 0x0, 0x0, 0x1, 0x8d, 0xff, 0xd9, 0x20,
-    0xf, 0xff, 0x40, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x1, 0xff, 0xf5, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x2f, 0xff, 0x50, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x3, 0xff, 0xf6, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x5f, 0xff,
-    0x70, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x6,
-    0xff, 0xf7, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x8f, 0xff, 0x90, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x8, 0xcb, 0x95, 0x0,
-
-    /* U+0072 "r" */
-    0x39, 0xbc, 0xe2, 0x0, 0x6b, 0xfc, 0x4f, 0xff,
-    0xf0, 0x3d, 0xff, 0xfa, 0x1f, 0xff, 0xd6, 0xff,
-    0xff, 0xf6, 0xe, 0xff, 0xef, 0xfb, 0x8a, 0xf3,
-    0xb, 0xff, 0xfd, 0x20, 0x0, 0x30, 0xa, 0xff,
-    0xf1, 0x0, 0x0, 0x0, 0x9, 0xff, 0x70, 0x0,
-    0x0, 0x0, 0x9, 0xff, 0x60, 0x0, 0x0, 0x0,
-    0x8, 0xff, 0x50, 0x0, 0x0, 0x0, 0x9, 0xff,
-    0x50, 0x0, 0x0, 0x0, 0x9, 0xff, 0x50, 0x0,
-    0x0, 0x0, 0xa, 0xff, 0x60, 0x0, 0x0, 0x0,
-    0xb, 0xff, 0x60, 0x0, 0x0, 0x0, 0xc, 0xff,
-    0x70, 0x0, 0x0, 0x0, 0xf, 0xff, 0x80, 0x0,
-    0x0, 0x0, 0x1f, 0xff, 0xa0, 0x0, 0x0, 0x0,
-    0x3f, 0xff, 0xc0, 0x0, 0x0, 0x0, 0x6f, 0xdc,
-    0x90, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0,
-
-    /* U+0073 "s" */
-    0x0, 0x5, 0xbd, 0xff, 0xed, 0xa7, 0x30, 0x2,
-    0xdf, 0xff, 0xff, 0xff, 0xff, 0x70, 0xd, 0xff,
-    0xc7, 0x58, 0xcf, 0xff, 0x40, 0x6f, 0xfc, 0x0,
-    0x0, 0x3, 0xcf, 0x10, 0x8f, 0xf5, 0x0, 0x0,
-    0x0, 0x5, 0x0, 0x7f, 0xf6, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x3f, 0xfd, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x9, 0xff, 0xe8, 0x20, 0x0, 0x0, 0x0,
-    0x0, 0x8f, 0xff, 0xfe, 0xb8, 0x50, 0x0, 0x0,
-    0x1, 0x7b, 0xff, 0xff, 0xfe, 0x30, 0x0, 0x0,
-    0x0, 0x5, 0xdf, 0xff, 0xd0, 0x0, 0x0, 0x0,
-    0x0, 0xc, 0xff, 0xf4, 0x0, 0x0, 0x0, 0x0,
-    0x6, 0xff, 0xf6, 0xb7, 0x20, 0x0, 0x0, 0x8,
-    0xff, 0xf4, 0xcf, 0xfd, 0x96, 0x55, 0x9f, 0xff,
-    0xe0, 0xbf, 0xff, 0xff, 0xff, 0xff, 0xff, 0x40,
-    0x9f, 0xff, 0xff, 0xff, 0xff, 0xe4, 0x0, 0x27,
-    0xad, 0xef, 0xfd, 0xa5, 0x0, 0x0,
-
-    /* U+0074 "t" */
-    0x0, 0x0, 0x1, 0x22, 0x0, 0x0, 0x0, 0x0,
-    0xcf, 0xff, 0x90, 0x0, 0x0, 0x0, 0xa, 0xff,
-    0xf7, 0x0, 0x0, 0x0, 0x0, 0x7f, 0xff, 0x50,
-    0x0, 0x0, 0x0, 0x6, 0xff, 0xf4, 0x0, 0x0,
-    0x0, 0x0, 0x4f, 0xff, 0x30, 0x0, 0x0, 0xbe,
-    0xee, 0xff, 0xfe, 0xee, 0xe7, 0x7, 0xff, 0xff,
-    0xff, 0xff, 0xff, 0x60, 0x2f, 0xff, 0xff, 0xff,
-    0xff, 0xf3, 0x0, 0x42, 0x3f, 0xff, 0x11, 0x24,
-    0x0, 0x0, 0x3, 0xff, 0xf0, 0x0, 0x0, 0x0,
-    0x0, 0x3f, 0xff, 0x0, 0x0, 0x0, 0x0, 0x3,
-    0xff, 0xf0, 0x0, 0x0, 0x0, 0x0, 0x3f, 0xff,
-    0x0, 0x0, 0x0, 0x0, 0x3, 0xff, 0xf0, 0x0,
-    0x0, 0x0, 0x0, 0x2f, 0xff, 0x0, 0x0, 0x0,
-    0x0, 0x1, 0xff, 0xf3, 0x0, 0x0, 0x0, 0x0,
-    0xf, 0xff, 0x70, 0x0, 0x0, 0x0, 0x0, 0xcf,
-    0xff, 0x40, 0x3, 0x30, 0x0, 0x5, 0xff, 0xff,
-    0xef, 0xf5, 0x0, 0x0, 0xb, 0xff, 0xff, 0xff,
-    0x20, 0x0, 0x0, 0x1b, 0xff, 0xff, 0xf0, 0x0,
-    0x0, 0x0, 0x5, 0xbe, 0xfc, 0x0,
-
-    /* U+0075 "u" */
-    0x38, 0x9b, 0xa0, 0x0, 0x0, 0x0, 0x27, 0x9a,
-    0xb0, 0x5f, 0xff, 0xc0, 0x0, 0x0, 0x0, 0x2f,
-    0xff, 0xd0, 0x4f, 0xff, 0xa0, 0x0, 0x0, 0x0,
-    0xf, 0xff, 0xb0, 0x2f, 0xff, 0x80, 0x0, 0x0,
-    0x0, 0xc, 0xff, 0xa0, 0x1f, 0xff, 0x60, 0x0,
-    0x0, 0x0, 0xa, 0xff, 0x90, 0xf, 0xff, 0x60,
-    0x0, 0x0, 0x0, 0x9, 0xff, 0x80, 0xf, 0xff,
-    0x50, 0x0, 0x0, 0x0, 0x8, 0xff, 0x70, 0xf,
-    0xff, 0x40, 0x0, 0x0, 0x0, 0x7, 0xff, 0x70,
-    0xf, 0xff, 0x40, 0x0, 0x0, 0x0, 0x7, 0xff,
-    0x70, 0xf, 0xff, 0x50, 0x0, 0x0, 0x0, 0x7,
-    0xff, 0x70, 0xe, 0xff, 0x50, 0x0, 0x0, 0x0,
-    0x8, 0xff, 0x80, 0xd, 0xff, 0x70, 0x0, 0x0,
-    0x0, 0x9, 0xff, 0x90, 0xb, 0xff, 0xc0, 0x0,
-    0x0, 0x0, 0x2f, 0xff, 0xa0, 0x6, 0xff, 0xf5,
-    0x0, 0x0, 0x1, 0xdf, 0xff, 0xc0, 0x1, 0xff,
-    0xff, 0x83, 0x13, 0x7f, 0xff, 0xff, 0xe0, 0x0,
-    0x8f, 0xff, 0xff, 0xff, 0xff, 0x6f, 0xff, 0xf1,
-    0x0, 0xa, 0xff, 0xff, 0xff, 0xd3, 0x2f, 0xff,
-    0xf4, 0x0, 0x0, 0x5c, 0xfe, 0xb6, 0x0, 0x4f,
-    0xff, 0xf8,
-
-    /* U+0076 "v" */
-    0x6a, 0xcd, 0xa0, 0x0, 0x0, 0x0, 0x5, 0xec,
-    0xb9, 0x5, 0xff, 0xfe, 0x0, 0x0, 0x0, 0x0,
-    0x9f, 0xff, 0xb0, 0xe, 0xff, 0xf2, 0x0, 0x0,
-    0x0, 0xd, 0xff, 0xf3, 0x0, 0x7f, 0xff, 0x70,
-    0x0, 0x0, 0x2, 0xff, 0xfc, 0x0, 0x1, 0xff,
-    0xfc, 0x0, 0x0, 0x0, 0x7f, 0xff, 0x50, 0x0,
-    0x9, 0xff, 0xf1, 0x0, 0x0, 0xc, 0xff, 0xd0,
-    0x0, 0x0, 0x3f, 0xff, 0x60, 0x0, 0x2, 0xff,
-    0xf6, 0x0, 0x0, 0x0, 0xdf, 0xfc, 0x0, 0x0,
-    0x9f, 0xfe, 0x0, 0x0, 0x0, 0x6, 0xff, 0xf2,
-    0x0, 0xe, 0xff, 0x70, 0x0, 0x0, 0x0, 0x1f,
-    0xff, 0x80, 0x6, 0xff, 0xf1, 0x0, 0x0, 0x0,
-    0x0, 0xbf, 0xfe, 0x0, 0xdf, 0xfa, 0x0, 0x0,
-    0x0, 0x0, 0x5, 0xff, 0xf5, 0x5f, 0xff, 0x40,
-    0x0, 0x0, 0x0, 0x0, 0xf, 0xff, 0xcc, 0xff,
-    0xd0, 0x0, 0x0, 0x0, 0x0, 0x0, 0xaf, 0xff,
-    0xff, 0xf7, 0x0, 0x0, 0x0, 0x0, 0x0, 0x5,
-    0xff, 0xff, 0xff, 0x10, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x1f, 0xff, 0xff, 0xa0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0xcf, 0xff, 0xf3, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x7, 0xcb, 0x97, 0x0,
-    0x0, 0x0, 0x0,
-
-    /* U+0077 "w" */
-    0x1, 0x34, 0x30, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x3, 0x43, 0x10, 0x7f, 0xff,
-    0xd0, 0x0, 0x0, 0x2f, 0xff, 0xb0, 0x0, 0x0,
-    0x0, 0xb, 0xff, 0xf9, 0x1f, 0xff, 0xf1, 0x0,
-    0x0, 0xb, 0xff, 0xe0, 0x0, 0x0, 0x0, 0xf,
-    0xff, 0xf1, 0x9, 0xff, 0xf4, 0x0, 0x0, 0x4,
-    0xff, 0xf2, 0x0, 0x0, 0x0, 0x3f, 0xff, 0x90,
-    0x2, 0xff, 0xf9, 0x0, 0x0, 0x0, 0xdf, 0xf7,
-    0x0, 0x0, 0x0, 0x7f, 0xff, 0x20, 0x0, 0xbf,
-    0xfe, 0x0, 0x0, 0x0, 0x8f, 0xfc, 0x0, 0x0,
-    0x0, 0xdf, 0xfb, 0x0, 0x0, 0x5f, 0xff, 0x30,
-    0x0, 0x0, 0xcf, 0xff, 0x10, 0x0, 0x2, 0xff,
-    0xf4, 0x0, 0x0, 0xe, 0xff, 0x80, 0x0, 0x2,
-    0xff, 0xff, 0x60, 0x0, 0x7, 0xff, 0xd0, 0x0,
-    0x0, 0x8, 0xff, 0xd0, 0x0, 0x7, 0xff, 0xff,
-    0xc0, 0x0, 0xd, 0xff, 0x70, 0x0, 0x0, 0x3,
-    0xff, 0xf3, 0x0, 0xd, 0xf9, 0xef, 0xf1, 0x0,
-    0x3f, 0xff, 0x10, 0x0, 0x0, 0x0, 0xef, 0xf8,
-    0x0, 0x4f, 0xf2, 0x9f, 0xf7, 0x0, 0x9f, 0xfa,
-    0x0, 0x0, 0x0, 0x0, 0x9f, 0xfe, 0x0, 0xaf,
-    0xd0, 0x4f, 0xfd, 0x1, 0xff, 0xf4, 0x0, 0x0,
-    0x0, 0x0, 0x3f, 0xff, 0x51, 0xff, 0x70, 0xe,
-    0xff, 0x48, 0xff, 0xe0, 0x0, 0x0, 0x0, 0x0,
-    0xe, 0xff, 0xb9, 0xff, 0x10, 0x9, 0xff, 0xbe,
-    0xff, 0x90, 0x0, 0x0, 0x0, 0x0, 0xa, 0xff,
-    0xff, 0xfb, 0x0, 0x5, 0xff, 0xff, 0xff, 0x30,
-    0x0, 0x0, 0x0, 0x0, 0x6, 0xff, 0xff, 0xf6,
-    0x0, 0x0, 0xff, 0xff, 0xfd, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x2, 0xff, 0xff, 0xf1, 0x0, 0x0,
-    0xcf, 0xff, 0xf7, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0xef, 0xff, 0xb0, 0x0, 0x0, 0x7f, 0xff,
-    0xf2, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x45,
-    0x32, 0x0, 0x0, 0x0, 0x1, 0x34, 0x50, 0x0,
-    0x0, 0x0,
-
-    /* U+0078 "x" */
-    0x6, 0xac, 0xdc, 0x0, 0x0, 0x0, 0xc, 0xa6,
-    0x20, 0x2, 0xef, 0xff, 0x60, 0x0, 0x0, 0x8f,
-    0xff, 0xf6, 0x0, 0x4f, 0xff, 0xe1, 0x0, 0x2,
-    0xff, 0xff, 0x70, 0x0, 0x7, 0xff, 0xf9, 0x0,
-    0xc, 0xff, 0xf8, 0x0, 0x0, 0x0, 0xbf, 0xff,
-    0x40, 0x8f, 0xff, 0x90, 0x0, 0x0, 0x0, 0x1e,
-    0xff, 0xd4, 0xff, 0xfc, 0x0, 0x0, 0x0, 0x0,
-    0x4, 0xff, 0xff, 0xff, 0xd1, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x8f, 0xff, 0xff, 0x20, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0xd, 0xff, 0xf6, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x4f, 0xff, 0xfb, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x2, 0xef, 0xff, 0xff,
-    0x70, 0x0, 0x0, 0x0, 0x0, 0xd, 0xff, 0xfc,
-    0xff, 0xf3, 0x0, 0x0, 0x0, 0x0, 0xbf, 0xff,
-    0x61, 0xef, 0xfd, 0x10, 0x0, 0x0, 0x9, 0xff,
-    0xfb, 0x0, 0x5f, 0xff, 0xb0, 0x0, 0x0, 0x7f,
-    0xff, 0xe1, 0x0, 0xb, 0xff, 0xf7, 0x0, 0x7,
-    0xff, 0xff, 0x50, 0x0, 0x1, 0xff, 0xff, 0x40,
-    0x7, 0xff, 0xfc, 0x0, 0x0, 0x0, 0x6f, 0xff,
-    0xf2, 0x0, 0x1a, 0xf3, 0x0, 0x0, 0x0, 0xb,
-    0xca, 0x96, 0x0, 0x0, 0x20, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x0,
-
-    /* U+0079 "y" */
-    0x47, 0x9a, 0x70, 0x0, 0x0, 0x0, 0x4, 0xa9,
-    0x86, 0x6, 0xff, 0xfe, 0x0, 0x0, 0x0, 0x0,
-    0x9f, 0xff, 0xb0, 0xe, 0xff, 0xf3, 0x0, 0x0,
-    0x0, 0xe, 0xff, 0xf3, 0x0, 0x7f, 0xff, 0x70,
-    0x0, 0x0, 0x4, 0xff, 0xfc, 0x0, 0x0, 0xff,
-    0xfd, 0x0, 0x0, 0x0, 0x9f, 0xff, 0x40, 0x0,
-    0x8, 0xff, 0xf2, 0x0, 0x0, 0xe, 0xff, 0xd0,
-    0x0, 0x0, 0x2f, 0xff, 0x70, 0x0, 0x5, 0xff,
-    0xf6, 0x0, 0x0, 0x0, 0xbf, 0xfe, 0x0, 0x0,
-    0xbf, 0xfe, 0x0, 0x0, 0x0, 0x4, 0xff, 0xf4,
-    0x0, 0x2f, 0xff, 0x70, 0x0, 0x0, 0x0, 0xd,
-    0xff, 0xa0, 0x8, 0xff, 0xf0, 0x0, 0x0, 0x0,
-    0x0, 0x7f, 0xff, 0x20, 0xef, 0xf8, 0x0, 0x0,
-    0x0, 0x0, 0x1, 0xff, 0xf9, 0x5f, 0xff, 0x10,
-    0x0, 0x0, 0x0, 0x0, 0xb, 0xff, 0xfc, 0xff,
-    0xa0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x5f, 0xff,
-    0xff, 0xf2, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0xff, 0xff, 0xfb, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0xb, 0xff, 0xff, 0x40, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x6f, 0xff, 0xd0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x3, 0xff, 0xf5, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0xbf, 0xfe,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x4f,
-    0xff, 0x70, 0x0, 0x0, 0x0, 0x0, 0x1, 0x30,
-    0x4e, 0xff, 0xf0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x1f, 0xff, 0xff, 0xf8, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0xff, 0xff, 0xfe, 0x10, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0xe, 0xff, 0xff, 0x50, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0xbf, 0xeb, 0x40,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-
-    /* U+007A "z" */
-    0x1f, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0x0,
-    0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xc0, 0xe,
-    0xff, 0xff, 0xff, 0xff, 0xff, 0xfa, 0x0, 0xaa,
-    0x87, 0x66, 0x55, 0xcf, 0xff, 0x70, 0x0, 0x0,
-    0x0, 0x0, 0x4f, 0xff, 0xd0, 0x0, 0x0, 0x0,
-    0x0, 0x1e, 0xff, 0xe1, 0x0, 0x0, 0x0, 0x0,
-    0xc, 0xff, 0xf3, 0x0, 0x0, 0x0, 0x0, 0x8,
-    0xff, 0xf5, 0x0, 0x0, 0x0, 0x0, 0x5, 0xff,
-    0xf7, 0x0, 0x0, 0x0, 0x0, 0x2, 0xff, 0xfa,
-    0x0, 0x0, 0x0, 0x0, 0x1, 0xdf, 0xfd, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0xcf, 0xff, 0x20, 0x0,
-    0x0, 0x0, 0x0, 0xaf, 0xff, 0x50, 0x0, 0x0,
-    0x0, 0x0, 0x8f, 0xff, 0x90, 0x0, 0x0, 0x0,
-    0x25, 0x6f, 0xff, 0xc1, 0x11, 0x23, 0x58, 0xcf,
-    0x9a, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xf6,
-    0x9f, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0x47,
-    0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xf2, 0x13,
-    0x21, 0x10, 0x0, 0x0, 0x12, 0x34, 0x0,
-
-    /* U+007B "{" */
-    0x0, 0x0, 0x3, 0x78, 0x84, 0x0, 0x0, 0xbf,
-    0xff, 0xf7, 0x0, 0xa, 0xff, 0xff, 0xf6, 0x0,
-    0x2f, 0xff, 0xff, 0xf4, 0x0, 0x6f, 0xff, 0x78,
-    0xb3, 0x0, 0x7f, 0xfa, 0x0, 0x0, 0x0, 0x8f,
-    0xf9, 0x0, 0x0, 0x0, 0x8f, 0xf9, 0x0, 0x0,
-    0x0, 0x8f, 0xf9, 0x0, 0x0, 0x0, 0x8f, 0xf9,
-    0x0, 0x0, 0x0, 0x8f, 0xf9, 0x0, 0x0, 0x0,
-    0x8f, 0xf9, 0x0, 0x0, 0x0, 0xbf, 0xf8, 0x0,
-    0x0, 0x7, 0xff, 0xf6, 0x0, 0x0, 0x5f, 0xff,
-    0xf1, 0x0, 0x0, 0x6f, 0xff, 0x50, 0x0, 0x0,
-    0x6f, 0xfb, 0x0, 0x0, 0x0, 0x6f, 0xff, 0xc0,
-    0x0, 0x0, 0x3e, 0xff, 0xf4, 0x0, 0x0, 0x1,
-    0xef, 0xf8, 0x0, 0x0, 0x0, 0x9f, 0xf9, 0x0,
-    0x0, 0x0, 0x8f, 0xf9, 0x0, 0x0, 0x0, 0x8f,
-    0xf9, 0x0, 0x0, 0x0, 0x8f, 0xf9, 0x0, 0x0,
-    0x0, 0x8f, 0xf9, 0x0, 0x0, 0x0, 0x8f, 0xf9,
-    0x0, 0x0, 0x0, 0x8f, 0xf9, 0x0, 0x0, 0x0,
-    0x7f, 0xfc, 0x0, 0x31, 0x0, 0x5f, 0xff, 0xff,
-    0xf4, 0x0, 0xe, 0xff, 0xff, 0xf5, 0x0, 0x4,
-    0xff, 0xff, 0xf6, 0x0, 0x0, 0x3b, 0xff, 0xf8,
-
-    /* U+007C "|" */
-    0x0, 0x0, 0x5, 0xde, 0xf0, 0x6f, 0xfe, 0x5,
-    0xff, 0xe0, 0x5f, 0xfe, 0x5, 0xff, 0xd0, 0x5f,
-    0xfd, 0x4, 0xff, 0xd0, 0x4f, 0xfd, 0x4, 0xff,
-    0xd0, 0x4f, 0xfd, 0x4, 0xff, 0xd0, 0x4f, 0xfd,
-    0x4, 0xff, 0xd0, 0x4f, 0xfd, 0x4, 0xff, 0xd0,
-    0x4f, 0xfd, 0x4, 0xff, 0xd0, 0x4f, 0xfd, 0x4,
-    0xff, 0xd0, 0x4f, 0xfd, 0x4, 0xff, 0xd0, 0x4f,
-    0xfe, 0x4, 0xff, 0xe0, 0x4f, 0xfe, 0x4, 0xff,
-    0xe0, 0x4f, 0xfe, 0x4, 0xff, 0xf0, 0x4f, 0xff,
-    0x4, 0xff, 0xf0, 0x5f, 0xff, 0x5, 0xff, 0xf0,
-    0x5f, 0xff, 0x16, 0xff, 0xf2, 0x13, 0x20, 0x0,
-
-    /* U+007D "}" */
-    0x28, 0x87, 0x40, 0x0, 0x0, 0x4f, 0xff, 0xfd,
-    0x10, 0x0, 0x3f, 0xff, 0xff, 0xd0, 0x0, 0x2f,
-    0xff, 0xff, 0xf5, 0x0, 0xb, 0x97, 0xef, 0xf9,
-    0x0, 0x0, 0x0, 0x7f, 0xfa, 0x0, 0x0, 0x0,
-    0x6f, 0xfb, 0x0, 0x0, 0x0, 0x6f, 0xfb, 0x0,
-    0x0, 0x0, 0x6f, 0xfb, 0x0, 0x0, 0x0, 0x6f,
-    0xfb, 0x0, 0x0, 0x0, 0x6f, 0xfb, 0x0, 0x0,
-    0x0, 0x6f, 0xfb, 0x0, 0x0, 0x0, 0x5f, 0xfd,
-    0x0, 0x0, 0x0, 0x4f, 0xff, 0x90, 0x0, 0x0,
-    0xe, 0xff, 0xf8, 0x0, 0x0, 0x3, 0xef, 0xf9,
-    0x0, 0x0, 0x0, 0x9f, 0xf9, 0x0, 0x0, 0x9,
-    0xff, 0xf9, 0x0, 0x0, 0x1f, 0xff, 0xf5, 0x0,
-    0x0, 0x5f, 0xff, 0x30, 0x0, 0x0, 0x6f, 0xfc,
-    0x0, 0x0, 0x0, 0x6f, 0xfb, 0x0, 0x0, 0x0,
-    0x6f, 0xfb, 0x0, 0x0, 0x0, 0x6f, 0xfb, 0x0,
-    0x0, 0x0, 0x6f, 0xfb, 0x0, 0x0, 0x0, 0x6f,
-    0xfb, 0x0, 0x0, 0x0, 0x6f, 0xfb, 0x0, 0x3,
-    0x0, 0xaf, 0xfa, 0x0, 0x1f, 0xff, 0xff, 0xf7,
-    0x0, 0x2f, 0xff, 0xff, 0xf2, 0x0, 0x4f, 0xff,
-    0xff, 0x70, 0x0, 0x5f, 0xff, 0xc5, 0x0, 0x0,
-
-    /* U+007E "~" */
-    0x0, 0x0, 0x2, 0x10, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x2a, 0xff, 0xfc, 0x30, 0x0,
-    0x0, 0x0, 0x10, 0x0, 0x2, 0xef, 0xff, 0xff,
-    0xf5, 0x0, 0x0, 0x0, 0x8f, 0xb5, 0xc, 0xff,
-    0xff, 0xff, 0xff, 0x50, 0x0, 0x0, 0x9f, 0xfe,
-    0x3f, 0xff, 0xf7, 0x12, 0xdf, 0xf4, 0x0, 0x0,
-    0xdf, 0xfc, 0x6f, 0xff, 0x90, 0x0, 0x1c, 0xff,
-    0x30, 0x2, 0xff, 0xf8, 0x8f, 0xff, 0x20, 0x0,
-    0x1, 0xdf, 0xf5, 0x2c, 0xff, 0xf2, 0x16, 0xbe,
-    0x0, 0x0, 0x0, 0x1c, 0xff, 0xff, 0xff, 0x50,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x7d, 0xfe,
-    0xa3, 0x0,
-
-    /* U+4E00 "一" */
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x1, 0x23, 0x45, 0x67, 0x8a,
-    0xbd, 0xfa, 0x6c, 0xcc, 0xcc, 0xcc, 0xcd, 0xdf,
-    0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xf6, 0x5f,
-    0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
-    0xff, 0xff, 0xff, 0xf2, 0x2f, 0xff, 0xff, 0xff,
-    0xfe, 0xee, 0xee, 0xee, 0xff, 0xff, 0xff, 0xff,
-    0xe0, 0xe, 0xda, 0x74, 0x10, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x12, 0x33, 0x56, 0x50, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x0,
-
-    /* U+4E03 "七" */
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x7, 0xaa, 0x92,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0xef, 0xff, 0x50,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0xc, 0xff, 0xf3, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0xaf, 0xff, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x8, 0xff, 0xe0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x7f, 0xfd, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x5, 0xff, 0xd0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x4f, 0xfc, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x20, 0x53, 0x0, 0x0, 0x0,
-    0x0, 0x3, 0xff, 0xc0, 0x0, 0x0, 0x0, 0x0,
-    0x1, 0x47, 0xbc, 0x8, 0xff, 0xa6, 0x31, 0x0,
-    0x0, 0x3f, 0xfd, 0x0, 0x12, 0x45, 0x79, 0xbe,
-    0xff, 0xff, 0x70, 0x3f, 0xff, 0xff, 0xff, 0xed,
-    0xde, 0xff, 0xfe, 0xff, 0xff, 0xff, 0xff, 0xff,
-    0xff, 0xf2, 0x0, 0xef, 0xff, 0xff, 0xff, 0xff,
-    0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
-    0xfd, 0x0, 0x9, 0xff, 0xff, 0xff, 0xff, 0xff,
-    0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
-    0x70, 0x0, 0x3f, 0xfe, 0xba, 0x86, 0x54, 0x4e,
-    0xff, 0x33, 0x33, 0x33, 0x33, 0x33, 0x33, 0x20,
-    0x0, 0x0, 0x51, 0x0, 0x0, 0x0, 0x0, 0xdf,
-    0xe0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0xd, 0xfd,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0xdf, 0xc0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0xd, 0xfc, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0xdf, 0xc0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0xd, 0xfb, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0xdf, 0xd0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x32, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0xd, 0xff, 0x93, 0x11, 0x1,
-    0x24, 0x69, 0xdf, 0x50, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0xdf, 0xff, 0xff, 0xff, 0xff,
-    0xff, 0xff, 0xf1, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0xb, 0xff, 0xff, 0xff, 0xff, 0xff,
-    0xff, 0xfc, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x5f, 0xff, 0xff, 0xff, 0xff, 0xff,
-    0xff, 0x80, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x1, 0x34, 0x67, 0x89, 0xaa, 0xbc,
-    0xd3, 0x0, 0x0,
-
-    /* U+4E09 "三" */
-    0x0, 0x0, 0x0, 0x0, 0x37, 0x54, 0x32, 0x23,
-    0x34, 0x67, 0x9b, 0x60, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x3f, 0xff, 0xff, 0xff,
-    0xff, 0xff, 0xff, 0x20, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0xf, 0xff, 0xff, 0xff,
-    0xff, 0xff, 0xfe, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0xc, 0xff, 0xff, 0xff,
-    0xfe, 0xed, 0xd8, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x8, 0xc8, 0x53, 0x10,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x88, 0x54, 0x44, 0x55,
-    0x56, 0x78, 0xbd, 0xb0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x9f, 0xff, 0xff, 0xff,
-    0xff, 0xff, 0xff, 0xa0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x7f, 0xff, 0xff, 0xff,
-    0xff, 0xff, 0xff, 0x90, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x3c, 0xcd, 0xdd, 0xdd,
-    0xdd, 0xdd, 0xdd, 0x60, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x44,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x4, 0x9e, 0xf2,
-    0x89, 0x30, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x2, 0x57, 0xad, 0xff, 0xff, 0xc0,
-    0x5f, 0xfe, 0xb9, 0x75, 0x54, 0x44, 0x55, 0x68,
-    0x9b, 0xdf, 0xff, 0xff, 0xff, 0xff, 0xff, 0x50,
-    0x1f, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
-    0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xfe, 0x0,
-    0xc, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
-    0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xf8, 0x0,
-    0x8, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
-    0xff, 0xff, 0xff, 0xff, 0xfe, 0xed, 0xc2, 0x0,
-    0x3, 0xff, 0xfd, 0xb9, 0x76, 0x54, 0x33, 0x33,
-    0x22, 0x21, 0x10, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x32, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-
-    /* U+4E8C "二" */
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x24, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x31, 0x0, 0x0, 0x2, 0x36,
-    0x9d, 0xf9, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0xaf, 0xff, 0xff, 0xff, 0xff, 0xff,
-    0xf6, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x5f, 0xff, 0xff, 0xff, 0xff, 0xff, 0xf2,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0xf, 0xff, 0xff, 0xff, 0xff, 0xff, 0xf0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x5,
-    0x54, 0x43, 0x33, 0x33, 0x32, 0x20, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x27, 0xd0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x2, 0x47,
-    0xad, 0xff, 0xa0, 0x8, 0x53, 0x22, 0x23, 0x34,
-    0x56, 0x89, 0xab, 0xcd, 0xef, 0xff, 0xff, 0xff,
-    0xff, 0x50, 0xd, 0xff, 0xff, 0xff, 0xff, 0xff,
-    0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
-    0x10, 0x8, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
-    0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xfd, 0x0,
-    0x2, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
-    0xff, 0xff, 0xff, 0xff, 0xff, 0xf8, 0x0, 0x0,
-    0xce, 0xc9, 0x76, 0x54, 0x43, 0x33, 0x32, 0x22,
-    0x21, 0x11, 0x11, 0x11, 0x10, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x0,
-
-    /* U+4E94 "五" */
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x1, 0x47, 0x20, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0xed, 0xcb, 0xbb,
-    0xbb, 0xbb, 0xbc, 0xdf, 0xff, 0xf0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0xa, 0xff, 0xff,
-    0xff, 0xff, 0xff, 0xff, 0xff, 0xfc, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x6f, 0xff,
-    0xff, 0xff, 0xff, 0xcd, 0xde, 0xff, 0x80, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x2, 0xa7,
-    0x42, 0xb, 0xff, 0xa0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0xff, 0xf5, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x3f, 0xff, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x8, 0xff, 0xa0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0xcf, 0xf6, 0x23, 0x57, 0x81,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x8e, 0xcc, 0xcc, 0xef, 0xff, 0xff, 0xff, 0xff,
-    0x10, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x5, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
-    0xf0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x2f, 0xff, 0xff, 0xff, 0xfb, 0x98, 0x7f,
-    0xff, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x75, 0x21, 0xaf, 0xfc, 0x0, 0x0,
-    0xff, 0xe0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0xe, 0xff, 0x50, 0x0,
-    0xf, 0xfd, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x6, 0xff, 0xe0, 0x0,
-    0x1, 0xff, 0xd0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0xdf, 0xf7, 0x0,
-    0x0, 0x2f, 0xfc, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x10, 0x0, 0x0, 0x0, 0x0, 0x5f, 0xff, 0x10,
-    0x0, 0x3, 0xff, 0xb0, 0x0, 0x0, 0x0, 0x16,
-    0x86, 0xd7, 0x30, 0x0, 0x0, 0xe, 0xff, 0xa0,
-    0x0, 0x0, 0x4f, 0xfd, 0x54, 0x45, 0x7a, 0xdf,
-    0xf3, 0x2f, 0xff, 0xfc, 0xa8, 0x7b, 0xff, 0xfd,
-    0xcd, 0xef, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
-    0xfb, 0x0, 0xef, 0xff, 0xff, 0xff, 0xff, 0xff,
-    0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
-    0xff, 0x20, 0x9, 0xff, 0xff, 0xff, 0xff, 0xff,
-    0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
-    0xff, 0x60, 0x0, 0x5f, 0xff, 0xec, 0x97, 0x64,
-    0x32, 0x10, 0x0, 0x0, 0x11, 0x23, 0x57, 0x9b,
-    0xee, 0x80, 0x0, 0x0, 0x43, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0,
-
-    /* U+516D "六" */
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x10,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x2, 0xf3,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0xb, 0xfd,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x5f, 0xff,
-    0x90, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0xdf, 0xff,
-    0xf4, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x26, 0x9c,
-    0xee, 0x0, 0x0, 0x0, 0x0, 0x0, 0x27, 0xb0,
-    0x2, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x1, 0x10, 0x0, 0x0, 0x36, 0x9d, 0xff, 0x70,
-    0xd, 0xeb, 0x85, 0x21, 0x0, 0x0, 0x0, 0x1,
-    0x23, 0x57, 0x9b, 0xef, 0xff, 0xff, 0xff, 0x10,
-    0x7, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
-    0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xf9, 0x0,
-    0x2, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
-    0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xf2, 0x0,
-    0x0, 0xdf, 0xff, 0xff, 0xff, 0xff, 0xee, 0xdc,
-    0xbb, 0xba, 0xaa, 0xaa, 0xaa, 0x99, 0x70, 0x0,
-    0x0, 0x59, 0x76, 0x43, 0x21, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x1c, 0x20, 0x0,
-    0x0, 0x1a, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x3, 0xef, 0x0, 0x0,
-    0x0, 0xd, 0xd3, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x8f, 0xfb, 0x0, 0x0,
-    0x0, 0x8, 0xff, 0xa1, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x5e, 0xff, 0xf7, 0x0, 0x0,
-    0x0, 0x3, 0xff, 0xff, 0x93, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x6d, 0xff, 0xff, 0xf2, 0x0, 0x0,
-    0x0, 0x0, 0xdf, 0xff, 0xff, 0xc5, 0x0, 0x0,
-    0x0, 0x2, 0xdf, 0xff, 0xff, 0xe0, 0x0, 0x0,
-    0x0, 0x0, 0x7f, 0xff, 0xff, 0xe3, 0x0, 0x0,
-    0x0, 0x0, 0x9, 0xff, 0xff, 0x90, 0x0, 0x0,
-    0x0, 0x0, 0x2f, 0xff, 0xfc, 0x10, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x4d, 0xff, 0x40, 0x0, 0x0,
-    0x0, 0x0, 0xc, 0xff, 0x80, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x7b, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x4, 0xb3, 0x0, 0x0, 0x0, 0x0,
-
-    /* U+56DB "四" */
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x13, 0xb, 0xa8, 0x77, 0x66,
-    0x55, 0x43, 0x33, 0x34, 0x45, 0x67, 0x8a, 0xdf,
-    0xb0, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
-    0xff, 0xff, 0xff, 0xff, 0xfb, 0xe, 0xff, 0xff,
-    0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
-    0xff, 0xb0, 0xdf, 0xfd, 0xdd, 0xdd, 0xff, 0xb9,
-    0xff, 0xfc, 0xbb, 0xaa, 0xae, 0xfc, 0xc, 0xff,
-    0x20, 0x0, 0x4f, 0xf2, 0xf, 0xfb, 0x0, 0x0,
-    0x0, 0xcf, 0xc0, 0xbf, 0xf1, 0x0, 0x5, 0xff,
-    0x0, 0xff, 0xa0, 0x0, 0x0, 0xc, 0xfc, 0xb,
-    0xff, 0x0, 0x0, 0x8f, 0xe0, 0xf, 0xf9, 0x0,
-    0x0, 0x0, 0xcf, 0xc0, 0xaf, 0xf0, 0x0, 0xc,
-    0xfb, 0x0, 0xff, 0x90, 0x0, 0x0, 0xc, 0xfc,
-    0x9, 0xff, 0x0, 0x3, 0xff, 0x80, 0xf, 0xf9,
-    0x34, 0x7a, 0x70, 0xdf, 0xc0, 0x8f, 0xf0, 0x3,
-    0xef, 0xf3, 0x0, 0xff, 0xff, 0xff, 0xf6, 0xe,
-    0xfc, 0x8, 0xfe, 0x6, 0xff, 0xfe, 0x0, 0xe,
-    0xff, 0xff, 0xff, 0x40, 0xef, 0xc0, 0x7f, 0xe0,
-    0x7, 0xce, 0x50, 0x0, 0xef, 0xff, 0xca, 0x70,
-    0xe, 0xfd, 0x7, 0xff, 0x0, 0x0, 0x0, 0x0,
-    0x3, 0x31, 0x0, 0x0, 0x0, 0xff, 0xd0, 0x6f,
-    0xf0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0xf, 0xfd, 0x6, 0xff, 0x10, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0xff, 0xe0,
-    0x6f, 0xf5, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x1, 0x24, 0x9f, 0xfe, 0x6, 0xff, 0xfe, 0xdb,
-    0xba, 0xaa, 0xbc, 0xcd, 0xef, 0xff, 0xff, 0xff,
-    0xe0, 0x6f, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
-    0xff, 0xff, 0xff, 0xff, 0xff, 0x4, 0xff, 0xff,
-    0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
-    0xff, 0xf0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x1, 0x12, 0x34, 0x0,
-
-    /* U+661F "星" */
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x2, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x7, 0x95, 0x33, 0x33, 0x33, 0x33,
-    0x47, 0xcf, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x7, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
-    0xff, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x4, 0xff, 0xfd, 0xdc, 0xbb, 0xa9, 0x8e, 0xff,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x2,
-    0xff, 0x90, 0x0, 0x0, 0x0, 0x1c, 0xff, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x2, 0xff,
-    0xff, 0xff, 0xff, 0xff, 0xff, 0xfe, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x1, 0xff, 0xfe,
-    0xee, 0xee, 0xee, 0xef, 0xfe, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0xff, 0x90, 0x0,
-    0x0, 0x0, 0xc, 0xfe, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0xff, 0xea, 0xa9, 0x99,
-    0x99, 0xbf, 0xfe, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0xff, 0xff, 0xff, 0xff, 0xff,
-    0xff, 0xfe, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
-    0xfd, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x52, 0x11, 0x12, 0x77, 0x40, 0x0, 0x13,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0xc,
-    0x95, 0x0, 0x0, 0xff, 0xa0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x3f, 0xf9,
-    0x0, 0x0, 0xff, 0xb0, 0x2, 0x6a, 0xe6, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0xbf, 0xff, 0xee,
-    0xdd, 0xff, 0xfe, 0xff, 0xff, 0xf3, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x4, 0xff, 0xff, 0xff, 0xff,
-    0xff, 0xff, 0xff, 0xff, 0xf0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x1e, 0xff, 0xa7, 0x76, 0x66, 0xff,
-    0xc6, 0x54, 0x43, 0x20, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0xcf, 0xfb, 0x0, 0x0, 0x0, 0xff, 0xb3,
-    0x45, 0x8b, 0x20, 0x0, 0x0, 0x0, 0x0, 0x1,
-    0xbf, 0xf4, 0xef, 0xff, 0xfe, 0xff, 0xff, 0xff,
-    0xff, 0x10, 0x0, 0x0, 0x0, 0x0, 0x0, 0x4,
-    0xa0, 0xbf, 0xff, 0xff, 0xff, 0xff, 0xff, 0xfe,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x7e, 0xca, 0x87, 0xff, 0x84, 0x43, 0x32, 0x0,
-    0x0, 0x0, 0x0, 0x11, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0xff, 0x40, 0x0, 0x0, 0x0, 0x0,
-    0x27, 0xc7, 0x3f, 0xc8, 0x40, 0x0, 0x0, 0x0,
-    0x3, 0xff, 0x74, 0x56, 0x79, 0xab, 0xdf, 0xff,
-    0xf3, 0xf, 0xff, 0xff, 0xee, 0xee, 0xee, 0xff,
-    0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xf0,
-    0xd, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
-    0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0x90, 0x9,
-    0xff, 0xff, 0xff, 0xff, 0xff, 0xed, 0xdc, 0xcc,
-    0xbb, 0xbb, 0xaa, 0xa9, 0x97, 0x10, 0x4, 0xff,
-    0xfd, 0xa7, 0x42, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x0,
-
-    /* U+671F "期" */
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x1d, 0xef,
-    0x40, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x99, 0x93, 0x0, 0xf, 0xff,
-    0x30, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x10,
-    0x0, 0x0, 0x0, 0xef, 0xf3, 0x0, 0xc, 0xff,
-    0x20, 0x0, 0x6, 0xa7, 0x64, 0x57, 0x8b, 0xf2,
-    0x0, 0x0, 0x0, 0xbf, 0xf0, 0x0, 0x9, 0xff,
-    0x10, 0x0, 0x7, 0xff, 0xff, 0xff, 0xff, 0xf2,
-    0x0, 0x0, 0x0, 0x9f, 0xf0, 0x0, 0x7, 0xff,
-    0x0, 0x0, 0x6, 0xff, 0xff, 0xff, 0xff, 0xf2,
-    0x0, 0x5, 0x74, 0xaf, 0xf6, 0x67, 0x9d, 0xff,
-    0x8b, 0xf4, 0x4, 0xff, 0xee, 0xef, 0xff, 0xf2,
-    0x0, 0x6, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
-    0xff, 0xf5, 0x4, 0xff, 0x0, 0x0, 0x4f, 0xf3,
-    0x0, 0x4, 0xff, 0xff, 0xfe, 0xed, 0xdf, 0xff,
-    0xa9, 0x82, 0x3, 0xff, 0x0, 0x0, 0x3f, 0xf3,
-    0x0, 0x0, 0x75, 0x9f, 0xd0, 0x0, 0xa, 0xff,
-    0x0, 0x0, 0x3, 0xff, 0x77, 0x77, 0x9f, 0xf3,
-    0x0, 0x0, 0x0, 0x6f, 0xfb, 0xbc, 0xcf, 0xff,
-    0x0, 0x0, 0x3, 0xff, 0xff, 0xff, 0xff, 0xf3,
-    0x0, 0x0, 0x0, 0x6f, 0xff, 0xfe, 0xdf, 0xff,
-    0x0, 0x0, 0x4, 0xff, 0xff, 0xff, 0xff, 0xf3,
-    0x0, 0x0, 0x0, 0x6f, 0xd1, 0x0, 0xc, 0xff,
-    0x0, 0x0, 0x4, 0xff, 0x43, 0x20, 0x4f, 0xf3,
-    0x0, 0x0, 0x0, 0x6f, 0xb0, 0x1, 0x4d, 0xff,
-    0x0, 0x0, 0x4, 0xfe, 0x0, 0x0, 0x4f, 0xf3,
-    0x0, 0x0, 0x0, 0x6f, 0xfe, 0xff, 0xff, 0xff,
-    0x0, 0x0, 0x5, 0xff, 0x65, 0x55, 0x8f, 0xf3,
-    0x0, 0x0, 0x0, 0x5f, 0xfe, 0xdc, 0xcf, 0xff,
-    0x0, 0x0, 0x6, 0xff, 0xff, 0xff, 0xff, 0xf3,
-    0x0, 0x0, 0x0, 0x5f, 0xc0, 0x0, 0xf, 0xff,
-    0x47, 0x80, 0x7, 0xff, 0xff, 0xff, 0xff, 0xf3,
-    0xb, 0x73, 0x0, 0x5f, 0xd1, 0x35, 0x7f, 0xff,
-    0xff, 0xa0, 0x9, 0xfa, 0x22, 0x22, 0x5f, 0xf2,
-    0xc, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
-    0xff, 0x70, 0xb, 0xf7, 0x0, 0x0, 0x4f, 0xf2,
-    0x9, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
-    0xff, 0x30, 0xe, 0xf3, 0x0, 0x0, 0x5f, 0xf2,
-    0x5, 0xa8, 0x75, 0x42, 0x31, 0x0, 0x50, 0x0,
-    0x0, 0x0, 0x3f, 0xf0, 0x0, 0x0, 0x5f, 0xf2,
-    0x0, 0x0, 0x0, 0x5, 0xa0, 0x0, 0xc8, 0x0,
-    0x1, 0x56, 0xdf, 0xc0, 0x0, 0x0, 0x6f, 0xf2,
-    0x0, 0x0, 0x2, 0xbf, 0x70, 0x0, 0x8f, 0xc3,
-    0x3, 0xff, 0xff, 0x80, 0x0, 0x0, 0x8f, 0xf2,
-    0x0, 0x1, 0x8f, 0xff, 0x20, 0x0, 0x4f, 0xff,
-    0x92, 0xef, 0xff, 0x30, 0x0, 0x0, 0xaf, 0xf2,
-    0x0, 0x6f, 0xff, 0xfd, 0x0, 0x0, 0xf, 0xff,
-    0xff, 0xcf, 0xfd, 0x0, 0x0, 0x0, 0xef, 0xf1,
-    0x0, 0x8, 0xff, 0xf8, 0x0, 0x0, 0xb, 0xff,
-    0xc2, 0x3f, 0xf5, 0x0, 0x0, 0x7, 0xff, 0xf1,
-    0x0, 0x0, 0x3c, 0xf2, 0x0, 0x0, 0x6, 0xe6,
-    0x0, 0xb, 0xa0, 0x0, 0x0, 0x4f, 0xff, 0xf1,
-    0x0, 0x0, 0x0, 0x30, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x4b, 0xef, 0xf1,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x1, 0x30
+    0x0
 };
 
 
@@ -2879,130 +460,50 @@ static LV_ATTRIBUTE_LARGE_CONST const uint8_t glyph_bitmap[] = {
 static const lv_font_fmt_txt_glyph_dsc_t glyph_dsc[] = {
     {.bitmap_index = 0, .adv_w = 0, .box_w = 0, .box_h = 0, .ofs_x = 0, .ofs_y = 0} /* id = 0 reserved */,
     {.bitmap_index = 0, .adv_w = 173, .box_w = 0, .box_h = 0, .ofs_x = 0, .ofs_y = 0},
-    {.bitmap_index = 0, .adv_w = 204, .box_w = 5, .box_h = 25, .ofs_x = 4, .ofs_y = -2},
-    {.bitmap_index = 63, .adv_w = 179, .box_w = 9, .box_h = 7, .ofs_x = 1, .ofs_y = 15},
-    {.bitmap_index = 95, .adv_w = 344, .box_w = 22, .box_h = 25, .ofs_x = 0, .ofs_y = -2},
-    {.bitmap_index = 370, .adv_w = 340, .box_w = 18, .box_h = 30, .ofs_x = 1, .ofs_y = -5},
-    {.bitmap_index = 640, .adv_w = 437, .box_w = 26, .box_h = 26, .ofs_x = 1, .ofs_y = -3},
-    {.bitmap_index = 978, .adv_w = 394, .box_w = 22, .box_h = 25, .ofs_x = 2, .ofs_y = -3},
-    {.bitmap_index = 1253, .adv_w = 104, .box_w = 5, .box_h = 7, .ofs_x = 1, .ofs_y = 15},
-    {.bitmap_index = 1271, .adv_w = 218, .box_w = 10, .box_h = 33, .ofs_x = 2, .ofs_y = -7},
-    {.bitmap_index = 1436, .adv_w = 218, .box_w = 10, .box_h = 33, .ofs_x = 2, .ofs_y = -7},
-    {.bitmap_index = 1601, .adv_w = 221, .box_w = 12, .box_h = 13, .ofs_x = 1, .ofs_y = 10},
-    {.bitmap_index = 1679, .adv_w = 295, .box_w = 18, .box_h = 18, .ofs_x = 0, .ofs_y = 2},
-    {.bitmap_index = 1841, .adv_w = 166, .box_w = 7, .box_h = 8, .ofs_x = 1, .ofs_y = -4},
-    {.bitmap_index = 1869, .adv_w = 238, .box_w = 15, .box_h = 5, .ofs_x = 0, .ofs_y = 7},
-    {.bitmap_index = 1907, .adv_w = 172, .box_w = 5, .box_h = 6, .ofs_x = 3, .ofs_y = -2},
-    {.bitmap_index = 1922, .adv_w = 342, .box_w = 17, .box_h = 29, .ofs_x = 2, .ofs_y = -5},
-    {.bitmap_index = 2169, .adv_w = 308, .box_w = 19, .box_h = 24, .ofs_x = 0, .ofs_y = -2},
-    {.bitmap_index = 2397, .adv_w = 204, .box_w = 8, .box_h = 25, .ofs_x = 1, .ofs_y = -2},
-    {.bitmap_index = 2497, .adv_w = 308, .box_w = 17, .box_h = 24, .ofs_x = 1, .ofs_y = -2},
-    {.bitmap_index = 2701, .adv_w = 308, .box_w = 17, .box_h = 24, .ofs_x = 1, .ofs_y = -2},
-    {.bitmap_index = 2905, .adv_w = 308, .box_w = 19, .box_h = 25, .ofs_x = 0, .ofs_y = -2},
-    {.bitmap_index = 3143, .adv_w = 308, .box_w = 17, .box_h = 25, .ofs_x = 1, .ofs_y = -2},
-    {.bitmap_index = 3356, .adv_w = 308, .box_w = 18, .box_h = 25, .ofs_x = 1, .ofs_y = -2},
-    {.bitmap_index = 3581, .adv_w = 276, .box_w = 17, .box_h = 24, .ofs_x = 0, .ofs_y = -2},
-    {.bitmap_index = 3785, .adv_w = 308, .box_w = 18, .box_h = 24, .ofs_x = 1, .ofs_y = -2},
-    {.bitmap_index = 4001, .adv_w = 308, .box_w = 18, .box_h = 25, .ofs_x = 1, .ofs_y = -2},
-    {.bitmap_index = 4226, .adv_w = 172, .box_w = 5, .box_h = 18, .ofs_x = 3, .ofs_y = -2},
-    {.bitmap_index = 4271, .adv_w = 172, .box_w = 7, .box_h = 20, .ofs_x = 1, .ofs_y = -4},
-    {.bitmap_index = 4341, .adv_w = 283, .box_w = 16, .box_h = 21, .ofs_x = 1, .ofs_y = 0},
-    {.bitmap_index = 4509, .adv_w = 295, .box_w = 18, .box_h = 13, .ofs_x = 0, .ofs_y = 4},
-    {.bitmap_index = 4626, .adv_w = 282, .box_w = 15, .box_h = 21, .ofs_x = 1, .ofs_y = 0},
-    {.bitmap_index = 4784, .adv_w = 256, .box_w = 14, .box_h = 24, .ofs_x = 1, .ofs_y = -2},
-    {.bitmap_index = 4952, .adv_w = 475, .box_w = 23, .box_h = 24, .ofs_x = 3, .ofs_y = -2},
-    {.bitmap_index = 5228, .adv_w = 379, .box_w = 24, .box_h = 25, .ofs_x = 0, .ofs_y = -3},
-    {.bitmap_index = 5528, .adv_w = 334, .box_w = 19, .box_h = 26, .ofs_x = 1, .ofs_y = -3},
-    {.bitmap_index = 5775, .adv_w = 332, .box_w = 19, .box_h = 24, .ofs_x = 1, .ofs_y = -2},
-    {.bitmap_index = 6003, .adv_w = 334, .box_w = 19, .box_h = 26, .ofs_x = 1, .ofs_y = -3},
-    {.bitmap_index = 6250, .adv_w = 324, .box_w = 18, .box_h = 26, .ofs_x = 1, .ofs_y = -3},
-    {.bitmap_index = 6484, .adv_w = 310, .box_w = 18, .box_h = 25, .ofs_x = 1, .ofs_y = -2},
-    {.bitmap_index = 6709, .adv_w = 338, .box_w = 19, .box_h = 24, .ofs_x = 1, .ofs_y = -2},
-    {.bitmap_index = 6937, .adv_w = 373, .box_w = 21, .box_h = 25, .ofs_x = 1, .ofs_y = -3},
-    {.bitmap_index = 7200, .adv_w = 138, .box_w = 6, .box_h = 25, .ofs_x = 1, .ofs_y = -2},
-    {.bitmap_index = 7275, .adv_w = 207, .box_w = 10, .box_h = 29, .ofs_x = 1, .ofs_y = -7},
-    {.bitmap_index = 7420, .adv_w = 331, .box_w = 19, .box_h = 25, .ofs_x = 1, .ofs_y = -2},
-    {.bitmap_index = 7658, .adv_w = 324, .box_w = 18, .box_h = 25, .ofs_x = 1, .ofs_y = -3},
-    {.bitmap_index = 7883, .adv_w = 452, .box_w = 28, .box_h = 25, .ofs_x = 0, .ofs_y = -2},
-    {.bitmap_index = 8233, .adv_w = 373, .box_w = 21, .box_h = 25, .ofs_x = 1, .ofs_y = -3},
-    {.bitmap_index = 8496, .adv_w = 397, .box_w = 23, .box_h = 24, .ofs_x = 1, .ofs_y = -2},
-    {.bitmap_index = 8772, .adv_w = 334, .box_w = 19, .box_h = 25, .ofs_x = 1, .ofs_y = -2},
-    {.bitmap_index = 9010, .adv_w = 397, .box_w = 23, .box_h = 27, .ofs_x = 1, .ofs_y = -5},
-    {.bitmap_index = 9321, .adv_w = 345, .box_w = 20, .box_h = 25, .ofs_x = 1, .ofs_y = -2},
-    {.bitmap_index = 9571, .adv_w = 313, .box_w = 18, .box_h = 24, .ofs_x = 1, .ofs_y = -2},
-    {.bitmap_index = 9787, .adv_w = 317, .box_w = 20, .box_h = 25, .ofs_x = 0, .ofs_y = -2},
-    {.bitmap_index = 10037, .adv_w = 360, .box_w = 20, .box_h = 25, .ofs_x = 1, .ofs_y = -2},
-    {.bitmap_index = 10287, .adv_w = 370, .box_w = 24, .box_h = 25, .ofs_x = 0, .ofs_y = -2},
-    {.bitmap_index = 10587, .adv_w = 538, .box_w = 34, .box_h = 25, .ofs_x = 0, .ofs_y = -2},
-    {.bitmap_index = 11012, .adv_w = 361, .box_w = 23, .box_h = 26, .ofs_x = 0, .ofs_y = -3},
-    {.bitmap_index = 11311, .adv_w = 365, .box_w = 23, .box_h = 25, .ofs_x = 0, .ofs_y = -2},
-    {.bitmap_index = 11599, .adv_w = 356, .box_w = 20, .box_h = 24, .ofs_x = 1, .ofs_y = -2},
-    {.bitmap_index = 11839, .adv_w = 173, .box_w = 9, .box_h = 32, .ofs_x = 1, .ofs_y = -7},
-    {.bitmap_index = 11983, .adv_w = 342, .box_w = 19, .box_h = 29, .ofs_x = 1, .ofs_y = -4},
-    {.bitmap_index = 12259, .adv_w = 173, .box_w = 9, .box_h = 32, .ofs_x = 1, .ofs_y = -7},
-    {.bitmap_index = 12403, .adv_w = 305, .box_w = 16, .box_h = 12, .ofs_x = 2, .ofs_y = 10},
-    {.bitmap_index = 12499, .adv_w = 294, .box_w = 19, .box_h = 4, .ofs_x = 0, .ofs_y = -8},
-    {.bitmap_index = 12537, .adv_w = 173, .box_w = 7, .box_h = 9, .ofs_x = 2, .ofs_y = 15},
-    {.bitmap_index = 12569, .adv_w = 320, .box_w = 19, .box_h = 18, .ofs_x = 0, .ofs_y = -2},
-    {.bitmap_index = 12740, .adv_w = 313, .box_w = 18, .box_h = 25, .ofs_x = 1, .ofs_y = -2},
-    {.bitmap_index = 12965, .adv_w = 256, .box_w = 15, .box_h = 18, .ofs_x = 0, .ofs_y = -2},
-    {.bitmap_index = 13100, .adv_w = 325, .box_w = 19, .box_h = 26, .ofs_x = 0, .ofs_y = -2},
-    {.bitmap_index = 13347, .adv_w = 268, .box_w = 16, .box_h = 18, .ofs_x = 0, .ofs_y = -2},
-    {.bitmap_index = 13491, .adv_w = 233, .box_w = 13, .box_h = 25, .ofs_x = 1, .ofs_y = -2},
-    {.bitmap_index = 13654, .adv_w = 316, .box_w = 19, .box_h = 25, .ofs_x = 0, .ofs_y = -9},
-    {.bitmap_index = 13892, .adv_w = 321, .box_w = 18, .box_h = 26, .ofs_x = 1, .ofs_y = -3},
-    {.bitmap_index = 14126, .adv_w = 126, .box_w = 6, .box_h = 25, .ofs_x = 1, .ofs_y = -2},
-    {.bitmap_index = 14201, .adv_w = 179, .box_w = 10, .box_h = 32, .ofs_x = 0, .ofs_y = -9},
-    {.bitmap_index = 14361, .adv_w = 277, .box_w = 17, .box_h = 25, .ofs_x = 1, .ofs_y = -2},
-    {.bitmap_index = 14574, .adv_w = 125, .box_w = 6, .box_h = 25, .ofs_x = 1, .ofs_y = -2},
-    {.bitmap_index = 14649, .adv_w = 499, .box_w = 29, .box_h = 19, .ofs_x = 1, .ofs_y = -3},
-    {.bitmap_index = 14925, .adv_w = 318, .box_w = 18, .box_h = 19, .ofs_x = 1, .ofs_y = -3},
-    {.bitmap_index = 15096, .adv_w = 297, .box_w = 18, .box_h = 18, .ofs_x = 0, .ofs_y = -2},
-    {.bitmap_index = 15258, .adv_w = 324, .box_w = 19, .box_h = 25, .ofs_x = 1, .ofs_y = -9},
-    {.bitmap_index = 15496, .adv_w = 313, .box_w = 19, .box_h = 25, .ofs_x = 0, .ofs_y = -9},
-    {.bitmap_index = 15734, .adv_w = 212, .box_w = 12, .box_h = 19, .ofs_x = 1, .ofs_y = -3},
-    {.bitmap_index = 15848, .adv_w = 244, .box_w = 14, .box_h = 18, .ofs_x = 1, .ofs_y = -2},
-    {.bitmap_index = 15974, .adv_w = 233, .box_w = 13, .box_h = 23, .ofs_x = 1, .ofs_y = -2},
-    {.bitmap_index = 16124, .adv_w = 322, .box_w = 18, .box_h = 18, .ofs_x = 1, .ofs_y = -2},
-    {.bitmap_index = 16286, .adv_w = 291, .box_w = 19, .box_h = 18, .ofs_x = 0, .ofs_y = -2},
-    {.bitmap_index = 16457, .adv_w = 450, .box_w = 28, .box_h = 19, .ofs_x = 0, .ofs_y = -2},
-    {.bitmap_index = 16723, .adv_w = 301, .box_w = 18, .box_h = 19, .ofs_x = 0, .ofs_y = -3},
-    {.bitmap_index = 16894, .adv_w = 294, .box_w = 19, .box_h = 25, .ofs_x = 0, .ofs_y = -9},
-    {.bitmap_index = 17132, .adv_w = 272, .box_w = 15, .box_h = 19, .ofs_x = 1, .ofs_y = -3},
-    {.bitmap_index = 17275, .adv_w = 210, .box_w = 10, .box_h = 32, .ofs_x = 2, .ofs_y = -6},
-    {.bitmap_index = 17435, .adv_w = 140, .box_w = 5, .box_h = 35, .ofs_x = 2, .ofs_y = -7},
-    {.bitmap_index = 17523, .adv_w = 210, .box_w = 10, .box_h = 32, .ofs_x = 2, .ofs_y = -6},
-    {.bitmap_index = 17683, .adv_w = 327, .box_w = 20, .box_h = 9, .ofs_x = 0, .ofs_y = 6},
-    {.bitmap_index = 17773, .adv_w = 576, .box_w = 26, .box_h = 7, .ofs_x = 5, .ofs_y = 9},
-    {.bitmap_index = 17864, .adv_w = 576, .box_w = 31, .box_h = 26, .ofs_x = 3, .ofs_y = -1},
-    {.bitmap_index = 18267, .adv_w = 576, .box_w = 32, .box_h = 24, .ofs_x = 2, .ofs_y = -1},
-    {.bitmap_index = 18651, .adv_w = 576, .box_w = 30, .box_h = 19, .ofs_x = 3, .ofs_y = 1},
-    {.bitmap_index = 18936, .adv_w = 576, .box_w = 33, .box_h = 23, .ofs_x = 1, .ofs_y = 0},
-    {.bitmap_index = 19316, .adv_w = 576, .box_w = 32, .box_h = 24, .ofs_x = 2, .ofs_y = 0},
-    {.bitmap_index = 19700, .adv_w = 576, .box_w = 25, .box_h = 21, .ofs_x = 6, .ofs_y = 1},
-    {.bitmap_index = 19963, .adv_w = 576, .box_w = 30, .box_h = 27, .ofs_x = 3, .ofs_y = -2},
-    {.bitmap_index = 20368, .adv_w = 576, .box_w = 32, .box_h = 29, .ofs_x = 0, .ofs_y = -2}
+    {.bitmap_index = 0, .adv_w = 238, .box_w = 15, .box_h = 5, .ofs_x = 0, .ofs_y = 7},
+    {.bitmap_index = 38, .adv_w = 172, .box_w = 5, .box_h = 6, .ofs_x = 3, .ofs_y = -2},
+    {.bitmap_index = 53, .adv_w = 308, .box_w = 19, .box_h = 24, .ofs_x = 0, .ofs_y = -2},
+    {.bitmap_index = 281, .adv_w = 204, .box_w = 8, .box_h = 25, .ofs_x = 1, .ofs_y = -2},
+    {.bitmap_index = 381, .adv_w = 308, .box_w = 17, .box_h = 24, .ofs_x = 1, .ofs_y = -2},
+    {.bitmap_index = 585, .adv_w = 308, .box_w = 17, .box_h = 24, .ofs_x = 1, .ofs_y = -2},
+    {.bitmap_index = 789, .adv_w = 308, .box_w = 19, .box_h = 25, .ofs_x = 0, .ofs_y = -2},
+    {.bitmap_index = 1027, .adv_w = 308, .box_w = 17, .box_h = 25, .ofs_x = 1, .ofs_y = -2},
+    {.bitmap_index = 1240, .adv_w = 308, .box_w = 18, .box_h = 25, .ofs_x = 1, .ofs_y = -2},
+    {.bitmap_index = 1465, .adv_w = 276, .box_w = 17, .box_h = 24, .ofs_x = 0, .ofs_y = -2},
+    {.bitmap_index = 1669, .adv_w = 308, .box_w = 18, .box_h = 24, .ofs_x = 1, .ofs_y = -2},
+    {.bitmap_index = 1885, .adv_w = 308, .box_w = 18, .box_h = 25, .ofs_x = 1, .ofs_y = -2},
+    {.bitmap_index = 2110, .adv_w = 379, .box_w = 24, .box_h = 25, .ofs_x = 0, .ofs_y = -3},
+    {.bitmap_index = 2410, .adv_w = 370, .box_w = 24, .box_h = 25, .ofs_x = 0, .ofs_y = -2},
+    {.bitmap_index = 2710, .adv_w = 538, .box_w = 34, .box_h = 25, .ofs_x = 0, .ofs_y = -2}
 };
 
 /*---------------------
  *  CHARACTER MAPPING
  *--------------------*/
 
-static const uint16_t unicode_list_1[] = {
-    0x0, 0x3, 0x9, 0x8c, 0x94, 0x36d, 0x8db, 0x181f,
-    0x191f
+static const uint16_t unicode_list_0[] = {
+    0x0, 0xd, 0xe
 };
 
+static const uint16_t unicode_list_2[] = {
+    0x0, 0x15, 0x16
+};
+
+
 /*Collect the unicode lists and glyph_id offsets*/
 static const lv_font_fmt_txt_cmap_t cmaps[] =
 {
     {
-        .range_start = 32, .range_length = 95, .glyph_id_start = 1,
+        .range_start = 32, .range_length = 15, .glyph_id_start = 1,
+        .unicode_list = unicode_list_0, .glyph_id_ofs_list = NULL, .list_length = 3, .type = LV_FONT_FMT_TXT_CMAP_SPARSE_TINY
+    },
+    {
+        .range_start = 48, .range_length = 10, .glyph_id_start = 4,
         .unicode_list = NULL, .glyph_id_ofs_list = NULL, .list_length = 0, .type = LV_FONT_FMT_TXT_CMAP_FORMAT0_TINY
     },
     {
-        .range_start = 19968, .range_length = 6432, .glyph_id_start = 96,
-        .unicode_list = unicode_list_1, .glyph_id_ofs_list = NULL, .list_length = 9, .type = LV_FONT_FMT_TXT_CMAP_SPARSE_TINY
+        .range_start = 65, .range_length = 23, .glyph_id_start = 14,
+        .unicode_list = unicode_list_2, .glyph_id_ofs_list = NULL, .list_length = 3, .type = LV_FONT_FMT_TXT_CMAP_SPARSE_TINY
     }
 };
 
@@ -3014,39 +515,17 @@ static const lv_font_fmt_txt_cmap_t cmaps[] =
 /*Map glyph_ids to kern left classes*/
 static const uint8_t kern_left_class_mapping[] =
 {
-    0, 0, 0, 0, 0, 0, 0, 0,
-    0, 1, 0, 0, 0, 0, 0, 0,
-    0, 0, 0, 2, 0, 0, 0, 0,
-    3, 0, 0, 0, 0, 0, 0, 0,
-    0, 0, 4, 5, 0, 6, 0, 7,
-    8, 0, 0, 0, 9, 10, 11, 12,
-    13, 14, 6, 15, 16, 17, 12, 18,
-    19, 20, 21, 22, 1, 0, 0, 0,
-    0, 0, 23, 24, 24, 0, 24, 25,
-    0, 26, 0, 0, 27, 0, 26, 26,
-    28, 29, 0, 30, 31, 32, 33, 34,
-    35, 36, 37, 36, 1, 0, 0, 0,
-    0, 0, 0, 0, 0, 0, 0, 0,
-    0
+    0, 0, 0, 0, 0, 0, 2, 0,
+    0, 0, 0, 3, 0, 0, 4, 18,
+    19
 };
 
 /*Map glyph_ids to kern right classes*/
 static const uint8_t kern_right_class_mapping[] =
 {
-    0, 0, 0, 0, 0, 0, 0, 0,
-    0, 0, 0, 0, 0, 1, 0, 1,
-    0, 0, 0, 0, 0, 2, 0, 3,
-    3, 0, 0, 0, 0, 0, 0, 0,
-    0, 0, 4, 0, 5, 0, 0, 0,
-    5, 0, 0, 6, 0, 0, 0, 0,
-    5, 0, 5, 0, 0, 7, 0, 8,
-    9, 10, 11, 12, 0, 0, 0, 0,
-    0, 0, 13, 14, 13, 13, 13, 15,
-    13, 0, 0, 16, 0, 0, 17, 17,
-    13, 17, 13, 18, 19, 20, 21, 22,
-    23, 24, 25, 26, 0, 0, 0, 0,
-    0, 0, 0, 0, 0, 0, 0, 0,
-    0
+    0, 0, 0, 1, 0, 0, 0, 0,
+    2, 0, 3, 3, 0, 0, 4, 8,
+    9
 };
 
 /*Kern values between classes*/
@@ -3205,7 +684,7 @@ static lv_font_fmt_txt_dsc_t font_dsc = {
     .cmaps = cmaps,
     .kern_dsc = &kern_classes,
     .kern_scale = 16,
-    .cmap_num = 2,
+    .cmap_num = 3,
     .bpp = 4,
     .kern_classes = 1,
     .bitmap_format = 0,